@@ -7,6 +7,11 @@
 #include <c10/util/llvmMathExtras.h>
 #include <c10/util/irange.h>
 
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace at {
 
 // Given a linear index, return the actual index.
@@ -66,6 +71,57 @@ static bool isInplaceOp(const c10::FunctionSchema& schema) {
   return return_alias_info && return_alias_info->isWrite();
 }
 
+namespace {
+
+struct VmapFallbackStatsRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::string, VmapFallbackStats> stats;
+};
+
+VmapFallbackStatsRegistry& vmapFallbackStatsRegistry() {
+  static VmapFallbackStatsRegistry registry;
+  return registry;
+}
+
+// Records one fallback invocation for the given operator when destroyed,
+// attributing the wall time between construction and destruction to it.
+class VmapFallbackTimer {
+ public:
+  explicit VmapFallbackTimer(const c10::FunctionSchema& schema)
+      : name_(toString(schema.operator_name())),
+        start_(std::chrono::steady_clock::now()) {}
+
+  ~VmapFallbackTimer() {
+    const auto elapsed_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_)
+            .count();
+    auto& registry = vmapFallbackStatsRegistry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    auto& stat = registry.stats[name_];
+    stat.count += 1;
+    stat.total_ns += elapsed_ns;
+  }
+
+ private:
+  std::string name_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace
+
+std::unordered_map<std::string, VmapFallbackStats> getVmapFallbackStats() {
+  auto& registry = vmapFallbackStatsRegistry();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  return registry.stats;
+}
+
+void resetVmapFallbackStats() {
+  auto& registry = vmapFallbackStatsRegistry();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  registry.stats.clear();
+}
+
 static void warnFallback(const c10::FunctionSchema& schema) {
   if (!globalContext().areVmapFallbackWarningsEnabled()) {
     return;
@@ -92,6 +148,7 @@ static void warnFallback(const c10::FunctionSchema& schema) {
 void batchedTensorInplaceForLoopFallback(const c10::OperatorHandle& op, torch::jit::Stack* stack) {
   const auto& schema = op.schema();
   warnFallback(schema);
+  VmapFallbackTimer stats_timer(schema);
 
   const auto num_arguments = static_cast<int64_t>(schema.arguments().size());
   const auto arguments = torch::jit::last(stack, num_arguments);
@@ -264,6 +321,7 @@ void batchedTensorForLoopFallback(const c10::OperatorHandle& op, torch::jit::Sta
               "Batching rule not implemented for ", schema.operator_name(), ". ",
               "The fallback path does not support operations with no returns.");
   warnFallback(schema);
+  VmapFallbackTimer stats_timer(schema);
 
   const auto num_arguments = static_cast<int64_t>(schema.arguments().size());
   const auto arguments = torch::jit::last(stack, num_arguments);
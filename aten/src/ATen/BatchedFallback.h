@@ -22,4 +22,20 @@ void batchedTensorForLoopFallback(
     const c10::OperatorHandle& op,
     torch::jit::Stack* stack);
 
+// Per-operator statistics about the slow for-loop fallback, so performance
+// investigations can see which ops fell back under vmap and how much wall
+// time the fallback loops consumed.
+struct VmapFallbackStats {
+  int64_t count = 0;
+  int64_t total_ns = 0;
+};
+
+// Returns a snapshot of the per-operator fallback statistics collected so
+// far, keyed by operator name (including the overload name).
+TORCH_API std::unordered_map<std::string, VmapFallbackStats>
+getVmapFallbackStats();
+
+// Clears the collected fallback statistics.
+TORCH_API void resetVmapFallbackStats();
+
 } // namespace at
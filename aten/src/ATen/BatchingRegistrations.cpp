@@ -917,6 +917,34 @@ Tensor mm_batching_rule(const Tensor& self, const Tensor& other) {
   TORCH_INTERNAL_ASSERT(false, "either self or other must be a BatchedTensor");
 }
 
+Tensor addmm_batching_rule(
+    const Tensor& self,
+    const Tensor& mat1,
+    const Tensor& mat2,
+    const Scalar& beta,
+    const Scalar& alpha) {
+  TORCH_CHECK(/*logical*/mat1.dim() == 2 && /*logical*/mat2.dim() == 2,
+      "addmm(self, mat1, mat2): Shape mismatch: expected matrix "
+      "(got `mat1` of size ", mat1.sizes(), ") ",
+      "and matrix (got `mat2` of size ", mat2.sizes(), ")");
+
+  // Decompose into operators that have batching rules. In particular the
+  // matrix product lowers to a single fused matmul over all of the batch
+  // dimensions (see mm_batching_rule) instead of the per-sample fallback
+  // loop, and the scaled addition is handled by the pointwise rules.
+  auto product = at::mm(mat1, mat2);
+  if (!alpha.equal(1)) {
+    product = product.mul(alpha);
+  }
+  if (beta.equal(0)) {
+    return product;
+  }
+  if (beta.equal(1)) {
+    return product.add(self);
+  }
+  return product.add(self.mul(beta));
+}
+
 Tensor cat_batching_rule(TensorList tensors, int64_t dim) {
   auto physical_views = MultiBatchVmapTransform::logicalToPhysical(tensors);
   auto physical_tensors = fmap(
@@ -1247,6 +1275,7 @@ TORCH_LIBRARY_IMPL(aten, Batched, m) {
   m.impl("dot", dot_batching_rule);
   m.impl("bmm", bmm_batching_rule);
   m.impl("mm", mm_batching_rule);
+  m.impl("addmm", addmm_batching_rule);
 
   // cat/stack
   m.impl("cat", cat_batching_rule);
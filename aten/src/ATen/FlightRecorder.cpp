@@ -0,0 +1,171 @@
+#include <ATen/FlightRecorder.h>
+
+#include <ATen/core/Tensor.h>
+#include <c10/util/SmallVector.h>
+#include <c10/util/hash.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace at {
+
+namespace {
+
+// Bound on the number of nested RecordFunctions tracked per thread. Ops
+// whose end runs on a different thread (async events) can leave unmatched
+// starts behind; the matching scan in onFunctionExit heals those, and the
+// cap keeps a pathological imbalance from growing without bound.
+constexpr size_t kMaxPending = 512;
+
+int64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct PendingOp {
+  const RecordFunction* fn;
+  int64_t start_ns;
+  uint64_t shapes_hash;
+};
+
+struct ThreadBuffer {
+  explicit ThreadBuffer(size_t capacity) : entries(capacity) {}
+
+  std::vector<FlightRecorderEntry> entries;
+  // Total number of entries ever written; the writer publishes finished
+  // entries with a release store so dumpFlightRecorder can read up to the
+  // head it acquires.
+  std::atomic<uint64_t> head{0};
+  c10::SmallVector<PendingOp, 16> pending;
+};
+
+struct Registry {
+  std::mutex mutex;
+  // Buffers are kept alive here even after their thread exits, so a dump
+  // still covers short-lived worker threads.
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  std::atomic<bool> enabled{false};
+  size_t capacity{8192};
+  CallbackHandle handle{0};
+};
+
+Registry& registry() {
+  static Registry r;
+  return r;
+}
+
+ThreadBuffer& localBuffer() {
+  static thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+    auto& r = registry();
+    auto b = std::make_shared<ThreadBuffer>(r.capacity);
+    std::lock_guard<std::mutex> guard(r.mutex);
+    r.buffers.push_back(b);
+    return b;
+  }();
+  return *buffer;
+}
+
+uint64_t shapesHash(const RecordFunction& fn) {
+  uint64_t h = 0;
+  for (const auto& input : fn.inputs()) {
+    if (!input.isTensor()) {
+      continue;
+    }
+    const auto& t = input.toTensor();
+    if (!t.defined()) {
+      continue;
+    }
+    h = c10::hash_combine(h, static_cast<size_t>(t.scalar_type()));
+    for (const auto s : t.sizes()) {
+      h = c10::hash_combine(h, static_cast<size_t>(s));
+    }
+  }
+  return h;
+}
+
+std::unique_ptr<ObserverContext> onFunctionEnter(const RecordFunction& fn) {
+  auto& buffer = localBuffer();
+  if (buffer.pending.size() < kMaxPending) {
+    buffer.pending.push_back({&fn, now_ns(), shapesHash(fn)});
+  }
+  // Returning nullptr avoids an ObserverContext allocation per call.
+  return nullptr;
+}
+
+void onFunctionExit(const RecordFunction& fn, ObserverContext* /* unused */) {
+  auto& buffer = localBuffer();
+  auto& pending = buffer.pending;
+  // The match is almost always the top of the stack; scanning downwards
+  // additionally discards starts whose end ran on another thread.
+  for (size_t i = pending.size(); i > 0; --i) {
+    const auto& op = pending[i - 1];
+    if (op.fn != &fn) {
+      continue;
+    }
+    const auto head = buffer.head.load(std::memory_order_relaxed);
+    auto& entry = buffer.entries[head % buffer.entries.size()];
+    entry.start_ns = op.start_ns;
+    entry.end_ns = now_ns();
+    entry.shapes_hash = op.shapes_hash;
+    entry.thread_id = fn.threadId();
+    entry.scope = fn.scope();
+    strncpy(entry.name, fn.name(), FlightRecorderEntry::kNameLength - 1);
+    entry.name[FlightRecorderEntry::kNameLength - 1] = '\0';
+    buffer.head.store(head + 1, std::memory_order_release);
+    pending.resize(i - 1);
+    return;
+  }
+}
+
+} // namespace
+
+void enableFlightRecorder(size_t entries_per_thread) {
+  TORCH_CHECK(
+      entries_per_thread > 0,
+      "enableFlightRecorder expects a positive number of entries per thread");
+  auto& r = registry();
+  std::lock_guard<std::mutex> guard(r.mutex);
+  TORCH_CHECK(!r.enabled.load(), "flight recorder is already enabled");
+  // Buffers created during a previous enable keep their old capacity; only
+  // buffers of threads seen for the first time pick up the new value.
+  r.capacity = entries_per_thread;
+  r.handle = addGlobalCallback(
+      RecordFunctionCallback(&onFunctionEnter, &onFunctionExit)
+          .needsInputs(true));
+  r.enabled.store(true);
+}
+
+void disableFlightRecorder() {
+  auto& r = registry();
+  std::lock_guard<std::mutex> guard(r.mutex);
+  TORCH_CHECK(r.enabled.load(), "flight recorder is not enabled");
+  removeCallback(r.handle);
+  r.handle = 0;
+  r.enabled.store(false);
+}
+
+bool isFlightRecorderEnabled() {
+  return registry().enabled.load();
+}
+
+std::vector<FlightRecorderEntry> dumpFlightRecorder() {
+  auto& r = registry();
+  std::vector<FlightRecorderEntry> result;
+  std::lock_guard<std::mutex> guard(r.mutex);
+  for (const auto& buffer : r.buffers) {
+    const auto head = buffer->head.load(std::memory_order_acquire);
+    const auto size = buffer->entries.size();
+    const auto n = std::min(head, static_cast<uint64_t>(size));
+    for (uint64_t i = head - n; i < head; ++i) {
+      result.push_back(buffer->entries[i % size]);
+    }
+  }
+  return result;
+}
+
+} // namespace at
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <ATen/record_function.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace at {
+
+// A single fixed-size flight recorder entry. Entries are written into
+// per-thread ring buffers and never allocate after the buffer is created,
+// so the recorder is cheap enough to stay enabled in production.
+struct FlightRecorderEntry {
+  static constexpr size_t kNameLength = 64;
+
+  // steady-clock timestamps, in nanoseconds
+  int64_t start_ns{0};
+  int64_t end_ns{0};
+  // hash of the input tensors' dtypes and shapes; 0 if there were no
+  // tensor inputs
+  uint64_t shapes_hash{0};
+  // see RecordFunction::currentThreadId()
+  uint64_t thread_id{0};
+  RecordScope scope{RecordScope::FUNCTION};
+  // operator name, truncated to kNameLength - 1 characters
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  char name[kNameLength]{};
+};
+
+// Starts recording every RecordFunction event into a per-thread ring buffer
+// of `entries_per_thread` fixed-size entries. Writes are lock-free: each
+// buffer has a single writer (its thread), and the only lock is taken once
+// per thread to register the buffer for dumping. Throws if the recorder is
+// already enabled.
+TORCH_API void enableFlightRecorder(size_t entries_per_thread = 8192);
+
+// Stops recording. Already recorded entries are kept and remain dumpable.
+TORCH_API void disableFlightRecorder();
+
+TORCH_API bool isFlightRecorderEnabled();
+
+// Returns a snapshot of all threads' buffers, oldest entry of each thread
+// first. May be called while the recorder is running; entries that are
+// concurrently overwritten by their owning thread can come out torn, which
+// is acceptable for the diagnostic use case this is meant for.
+TORCH_API std::vector<FlightRecorderEntry> dumpFlightRecorder();
+
+} // namespace at
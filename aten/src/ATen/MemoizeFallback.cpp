@@ -0,0 +1,301 @@
+#include <ATen/MemoizeFallback.h>
+
+#include <ATen/ATen.h>
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/stack.h>
+#include <c10/core/GradMode.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
+#include <c10/util/hash.h>
+#include <torch/library.h>
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace at {
+
+namespace {
+
+std::atomic<size_t> g_memo_hits{0};
+std::atomic<size_t> g_memo_misses{0};
+std::atomic<size_t> g_memo_bypasses{0};
+
+// FNV-1a over a byte range; used for tensor storage contents.
+size_t hash_bytes(const void* data, size_t nbytes, size_t seed) {
+  const auto* p = static_cast<const unsigned char*>(data);
+  size_t h = seed ^ 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < nbytes; ++i) {
+    h = (h ^ p[i]) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+// Folds one argument into the hash. Returns false if the value is of a
+// kind we do not know how to hash by content, in which case the call is
+// not cached.
+bool hash_argument(const IValue& value, size_t& seed) {
+  if (value.isNone()) {
+    seed = c10::hash_combine(seed, 0x9e3779b9);
+    return true;
+  }
+  if (value.isBool()) {
+    seed = c10::hash_combine(seed, value.toBool() ? 1 : 2);
+    return true;
+  }
+  if (value.isInt()) {
+    seed = c10::hash_combine(seed, c10::get_hash(value.toInt()));
+    return true;
+  }
+  if (value.isDouble()) {
+    seed = c10::hash_combine(seed, c10::get_hash(value.toDouble()));
+    return true;
+  }
+  if (value.isString()) {
+    seed = c10::hash_combine(
+        seed, std::hash<std::string>{}(value.toStringRef()));
+    return true;
+  }
+  if (value.isDevice()) {
+    seed = c10::hash_combine(
+        seed, std::hash<std::string>{}(value.toDevice().str()));
+    return true;
+  }
+  if (value.isList()) {
+    for (const IValue& element : value.toListRef()) {
+      if (!hash_argument(element, seed)) {
+        return false;
+      }
+    }
+    seed = c10::hash_combine(seed, value.toListRef().size());
+    return true;
+  }
+  if (value.isTensor()) {
+    const auto& tensor = value.toTensor();
+    // Only plain CPU tensors outside of autograd are content-addressable;
+    // a cached result would not carry the right graph otherwise.
+    if (!tensor.defined() || !tensor.device().is_cpu() ||
+        tensor.is_sparse() || tensor.is_quantized() ||
+        (tensor.requires_grad() && GradMode::is_enabled())) {
+      return false;
+    }
+    seed = c10::hash_combine(
+        seed, static_cast<size_t>(tensor.scalar_type()));
+    for (auto size : tensor.sizes()) {
+      seed = c10::hash_combine(seed, c10::get_hash(size));
+    }
+    auto contiguous = tensor.contiguous();
+    seed = hash_bytes(
+        contiguous.data_ptr(), static_cast<size_t>(contiguous.nbytes()), seed);
+    return true;
+  }
+  return false;
+}
+
+// Schema-level eligibility: value semantics only. Mutation or aliasing
+// would make a cached output observably wrong.
+bool is_pure_functional(const c10::FunctionSchema& schema) {
+  if (schema.is_mutable()) {
+    return false;
+  }
+  for (const auto& argument : schema.arguments()) {
+    if (argument.alias_info() != nullptr) {
+      return false;
+    }
+  }
+  if (schema.returns().empty()) {
+    return false;
+  }
+  for (const auto& ret : schema.returns()) {
+    if (ret.alias_info() != nullptr ||
+        ret.type()->kind() != c10::TypeKind::TensorType) {
+      return false;
+    }
+  }
+  return true;
+}
+
+class MemoizationCache {
+ public:
+  static MemoizationCache& singleton() {
+    static MemoizationCache cache;
+    return cache;
+  }
+
+  void addOp(const std::string& op_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    allowlist_.insert(op_name);
+  }
+
+  void clearOps() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    allowlist_.clear();
+    entries_.clear();
+    lookup_.clear();
+    cached_bytes_ = 0;
+  }
+
+  void setLimit(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_bytes_ = bytes;
+    evictLocked();
+  }
+
+  bool isAllowlisted(const c10::OperatorName& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (allowlist_.count(name.name) != 0) {
+      return true;
+    }
+    return !name.overload_name.empty() &&
+        allowlist_.count(name.name + "." + name.overload_name) != 0;
+  }
+
+  // On hit, replaces the call's arguments on the stack with clones of the
+  // cached outputs. Clones keep later in-place mutation by the caller from
+  // corrupting the cache.
+  bool lookup(size_t key, torch::jit::Stack* stack, size_t num_args) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lookup_.find(key);
+    if (it == lookup_.end()) {
+      return false;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    torch::jit::drop(*stack, num_args);
+    for (const auto& output : it->second->outputs) {
+      torch::jit::push(*stack, output.clone());
+    }
+    return true;
+  }
+
+  // Stores the top `num_outputs` stack values (the just-computed results).
+  void store(size_t key, torch::jit::Stack* stack, size_t num_outputs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (max_bytes_ == 0 || lookup_.count(key) != 0) {
+      return;
+    }
+    Entry entry;
+    entry.key = key;
+    for (const IValue& value : torch::jit::last(*stack, num_outputs)) {
+      auto output = value.toTensor().clone();
+      entry.bytes += static_cast<size_t>(output.nbytes());
+      entry.outputs.push_back(std::move(output));
+    }
+    if (entry.bytes > max_bytes_) {
+      return;
+    }
+    cached_bytes_ += entry.bytes;
+    entries_.push_front(std::move(entry));
+    lookup_.emplace(key, entries_.begin());
+    evictLocked();
+  }
+
+  MemoizationStats stats() {
+    MemoizationStats stats;
+    stats.hits = g_memo_hits.load(std::memory_order_relaxed);
+    stats.misses = g_memo_misses.load(std::memory_order_relaxed);
+    stats.bypasses = g_memo_bypasses.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.cached_bytes = cached_bytes_;
+    stats.entries = entries_.size();
+    return stats;
+  }
+
+ private:
+  struct Entry {
+    size_t key = 0;
+    size_t bytes = 0;
+    std::vector<Tensor> outputs;
+  };
+
+  void evictLocked() {
+    while (cached_bytes_ > max_bytes_ && !entries_.empty()) {
+      const auto& victim = entries_.back();
+      cached_bytes_ -= victim.bytes;
+      lookup_.erase(victim.key);
+      entries_.pop_back();
+    }
+  }
+
+  std::mutex mutex_;
+  std::unordered_set<std::string> allowlist_;
+  std::list<Entry> entries_; // front = most recently used
+  std::unordered_map<size_t, std::list<Entry>::iterator> lookup_;
+  size_t cached_bytes_ = 0;
+  size_t max_bytes_ = 256 * 1024 * 1024;
+};
+
+void memoizeFallback(
+    const c10::OperatorHandle& op,
+    c10::DispatchKeySet dispatch_keys,
+    torch::jit::Stack* stack) {
+  c10::impl::ExcludeDispatchKeyGuard guard(c10::DispatchKey::Memoize);
+  auto& cache = MemoizationCache::singleton();
+  const auto& schema = op.schema();
+  const auto num_args = schema.arguments().size();
+
+  if (!cache.isAllowlisted(schema.operator_name()) ||
+      !is_pure_functional(schema)) {
+    op.callBoxed(stack);
+    return;
+  }
+
+  // Content-addressed key: op identity plus every argument. A 64-bit hash
+  // can in principle collide; ops where a one-in-2^64 stale result is
+  // unacceptable should not be allowlisted.
+  size_t key = std::hash<std::string>{}(toString(schema.operator_name()));
+  bool hashable = true;
+  for (const IValue& argument : torch::jit::last(*stack, num_args)) {
+    if (!hash_argument(argument, key)) {
+      hashable = false;
+      break;
+    }
+  }
+  if (!hashable) {
+    g_memo_bypasses.fetch_add(1, std::memory_order_relaxed);
+    op.callBoxed(stack);
+    return;
+  }
+
+  if (cache.lookup(key, stack, num_args)) {
+    g_memo_hits.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  g_memo_misses.fetch_add(1, std::memory_order_relaxed);
+  op.callBoxed(stack);
+  cache.store(key, stack, schema.returns().size());
+}
+
+} // namespace
+
+void setMemoizationEnabled(bool enabled) {
+  c10::impl::tls_set_dispatch_key_included(
+      c10::DispatchKey::Memoize, enabled);
+}
+
+bool isMemoizationEnabled() {
+  return c10::impl::tls_is_dispatch_key_included(c10::DispatchKey::Memoize);
+}
+
+void addMemoizedOp(const std::string& op_name) {
+  MemoizationCache::singleton().addOp(op_name);
+}
+
+void clearMemoizedOps() {
+  MemoizationCache::singleton().clearOps();
+}
+
+void setMemoizationCacheLimit(size_t bytes) {
+  MemoizationCache::singleton().setLimit(bytes);
+}
+
+MemoizationStats getMemoizationStats() {
+  return MemoizationCache::singleton().stats();
+}
+
+TORCH_LIBRARY_IMPL(_, Memoize, m) {
+  m.fallback(torch::CppFunction::makeFromBoxedFunction<&memoizeFallback>());
+}
+
+} // namespace at
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+
+#include <cstddef>
+#include <string>
+
+namespace at {
+
+// Opt-in memoization of pure functional ops at the dispatcher boundary.
+//
+// When enabled, a boxed fallback registered on DispatchKey::Memoize
+// intercepts calls to allowlisted ops, content-hashes their inputs
+// (tensor arguments are hashed by dtype, shape and storage bytes) and
+// serves cached outputs on a repeat call instead of recomputing. Only
+// calls with a pure functional schema (no mutation, no aliasing, tensor
+// returns) and CPU tensor inputs that do not require grad are cached;
+// anything else transparently falls through to the regular kernel.
+//
+// The switch is thread-local, matching other dispatch-key based modes;
+// a service that wants it process-wide enables it on each worker thread.
+TORCH_API void setMemoizationEnabled(bool enabled);
+TORCH_API bool isMemoizationEnabled();
+
+// Allowlist management. Names are qualified op names, optionally with an
+// overload, e.g. "aten::layer_norm" or "aten::mean.dim". An empty
+// allowlist (the default) caches nothing.
+TORCH_API void addMemoizedOp(const std::string& op_name);
+TORCH_API void clearMemoizedOps();
+
+// Byte budget for cached outputs (default 256MB). Least recently used
+// entries are evicted once the budget is exceeded; 0 clears the cache and
+// disables insertion.
+TORCH_API void setMemoizationCacheLimit(size_t bytes);
+
+struct TORCH_API MemoizationStats {
+  size_t hits = 0;
+  size_t misses = 0;
+  // allowlisted calls that could not be cached (unhashable argument,
+  // non-CPU input, grad required, ...)
+  size_t bypasses = 0;
+  size_t cached_bytes = 0;
+  size_t entries = 0;
+};
+TORCH_API MemoizationStats getMemoizationStats();
+
+} // namespace at
@@ -2,6 +2,9 @@
 #include <ATen/Config.h>
 #include <c10/macros/Macros.h>
 #include <functional>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace at {
 
@@ -25,6 +28,102 @@ TORCH_API int get_thread_num();
 // Checks whether the code runs in parallel region
 TORCH_API bool in_parallel_region();
 
+// Pins intra-op pool worker threads to the given CPU set: each pool worker
+// is assigned a stable slot i on first use and pinned to
+// cpu_ids[i % cpu_ids.size()]. Thread number 0 is the calling thread and is
+// never re-pinned. Because parallel_for
+// partitions its range statically over thread numbers, pinning worker threads
+// to NUMA-node-local cores also makes the range partition NUMA-local across
+// calls. Pass an empty vector to clear the pinning. Pinning is applied lazily
+// by each worker on its next parallel task; only effective with the native
+// parallel backend on Linux, a no-op elsewhere.
+TORCH_API void set_thread_affinity(const std::vector<int>& cpu_ids);
+
+// Returns the CPU set configured via set_thread_affinity (empty when no
+// affinity has been set).
+TORCH_API std::vector<int> get_thread_affinity();
+
+// Enables profile-guided selection of the intra-op task count. While enabled,
+// parallel regions are bucketed by their grain size and the log2 of their
+// range -- the closest thing to a per-op-site signature available at this
+// layer -- and candidate task counts (powers of two up to the pool size) are
+// timed in turn; once every candidate has been measured a few times, the
+// fastest one is used for all subsequent regions in that bucket. Small
+// regions that lose to fork-join overhead thereby converge to fewer tasks.
+// Can also be enabled at startup via the TORCH_PARALLEL_TUNING environment
+// variable. Only effective with the native parallel backend.
+TORCH_API void set_parallel_tuning_enabled(bool enabled);
+TORCH_API bool get_parallel_tuning_enabled();
+
+// Returns the decided buckets of the tuning table, one
+// "<grain_size> <range_log2> <num_tasks>" line per bucket. The output can be
+// saved and fed back to load_parallel_tuning_table at startup so a process
+// skips the measurement phase.
+TORCH_API std::string dump_parallel_tuning_table();
+
+// Preloads decisions in the format produced by dump_parallel_tuning_table.
+// Preloaded buckets are treated as decided and are not re-measured.
+TORCH_API void load_parallel_tuning_table(const std::string& table);
+
+// Heterogeneous-core (e.g. P/E-core) aware scheduling for intra-op parallel
+// regions. Core classes are detected once from the per-CPU maximum
+// frequencies reported by the kernel; on hybrid machines the even range
+// split of at::parallel_for makes the slow cores the critical path of every
+// region. While enabled, per-task wall times are measured and folded into
+// per-slot throughput estimates, and static range partitions are sized
+// proportionally to those estimates, so the split keeps tracking the cores
+// the pool threads actually land on. Can be enabled at startup via the
+// TORCH_HETEROGENEOUS_SCHED environment variable. Only effective with the
+// native parallel backend.
+TORCH_API void set_heterogeneous_scheduling_enabled(bool enabled);
+TORCH_API bool get_heterogeneous_scheduling_enabled();
+
+// Selects dynamic chunk self-scheduling instead of weighted static
+// partitions while heterogeneous scheduling is enabled: tasks claim
+// grain-size chunks from a shared counter and faster cores naturally claim
+// more of them. Better suited to irregular per-element costs, at the price
+// of one atomic increment per chunk.
+TORCH_API void set_dynamic_chunk_scheduling(bool enabled);
+TORCH_API bool get_dynamic_chunk_scheduling();
+
+// Cooperative preemption for long intra-op parallel regions. Pool tasks are
+// not preemptible, so one huge region can block a latency-critical request
+// for its whole duration. While enabled, regions that are not marked high
+// priority process their range as chunks claimed from a shared counter, and
+// after each chunk a pool worker checks whether a high-priority region is
+// waiting; if so it queues a continuation for its remaining chunks and hands
+// the worker back, so high-priority tasks wait for at most one chunk instead
+// of a whole region. Can be enabled at startup via the
+// TORCH_COOPERATIVE_PREEMPTION environment variable. Only effective with the
+// native parallel backend.
+TORCH_API void set_cooperative_preemption_enabled(bool enabled);
+TORCH_API bool get_cooperative_preemption_enabled();
+
+// Thread-local priority of the parallel regions launched from the current
+// thread. While cooperative preemption is enabled, a high-priority region in
+// flight makes low-priority regions yield their pool workers (see above) and
+// is itself never checkpointed. Prefer ParallelPriorityGuard over setting
+// this directly.
+TORCH_API void set_parallel_priority(bool high_priority);
+TORCH_API bool get_parallel_priority();
+
+// RAII guard marking parallel regions launched from this thread as high (or
+// low) priority while in scope.
+class ParallelPriorityGuard {
+ public:
+  explicit ParallelPriorityGuard(bool high_priority)
+      : prev_(at::get_parallel_priority()) {
+    at::set_parallel_priority(high_priority);
+  }
+
+  ~ParallelPriorityGuard() {
+    at::set_parallel_priority(prev_);
+  }
+
+ private:
+  bool prev_;
+};
+
 namespace internal {
 
 // Initialise num_threads lazily at first parallel call
@@ -38,6 +137,48 @@ inline TORCH_API void lazy_init_num_threads() {
 
 TORCH_API void set_thread_num(int);
 
+// Returns the number of tasks to use for a parallel region with the given
+// grain size and range, given that the backend would otherwise use
+// max_tasks. Sets *measure when the region should be timed and reported via
+// record_parallel_region_time because its bucket is still being explored.
+// Only called when parallel tuning is enabled.
+TORCH_API int choose_num_tasks(
+    int64_t grain_size,
+    int64_t range,
+    int max_tasks,
+    bool* measure);
+
+// Reports the wall time of a measured parallel region back to the tuning
+// table.
+TORCH_API void record_parallel_region_time(
+    int64_t grain_size,
+    int64_t range,
+    int num_tasks,
+    uint64_t elapsed_ns);
+
+// Splits [begin, end) into num_tasks contiguous chunks sized proportionally
+// to the measured throughput of each task slot. Returns false when nothing
+// useful has been measured yet, in which case the caller should fall back
+// to even chunks. Only called when heterogeneous scheduling is enabled.
+TORCH_API bool compute_weighted_chunks(
+    int64_t begin,
+    int64_t end,
+    int num_tasks,
+    std::vector<std::pair<int64_t, int64_t>>& chunks);
+
+// Feeds the measured wall time of one task back into the throughput
+// estimate of its slot.
+TORCH_API void record_task_throughput(
+    int task_id,
+    int64_t work_items,
+    uint64_t elapsed_ns);
+
+// Re-applies the affinity configured via at::set_thread_affinity for the
+// worker with the given thread number, if the configuration changed since
+// this thread last applied it. Called by the native backend on entry to a
+// parallel region.
+TORCH_API void apply_thread_affinity(int thread_num);
+
 class TORCH_API ThreadIdGuard {
  public:
   ThreadIdGuard(int new_id) : old_id_(at::get_thread_num()) {
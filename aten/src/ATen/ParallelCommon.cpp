@@ -4,8 +4,20 @@
 #include <ATen/PTThreadPool.h>
 #include <ATen/Version.h>
 
+#include <c10/util/irange.h>
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <mutex>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 #if AT_MKL_ENABLED()
 #include <mkl.h>
@@ -107,4 +119,413 @@ int intraop_default_num_threads() {
 #endif
 }
 
+namespace {
+
+// Configured affinity map plus a generation counter; workers compare their
+// thread-local generation against it on entry to a parallel region so that
+// updates take effect lazily without stopping the pool.
+std::mutex thread_affinity_mutex;
+std::vector<int> thread_affinity_cpus;
+std::atomic<uint64_t> thread_affinity_generation{0};
+
+} // namespace
+
+void set_thread_affinity(const std::vector<int>& cpu_ids) {
+  for (auto cpu : cpu_ids) {
+    TORCH_CHECK(cpu >= 0, "set_thread_affinity: invalid CPU id ", cpu);
+  }
+  {
+    std::lock_guard<std::mutex> lock(thread_affinity_mutex);
+    thread_affinity_cpus = cpu_ids;
+  }
+  thread_affinity_generation.fetch_add(1);
+}
+
+std::vector<int> get_thread_affinity() {
+  std::lock_guard<std::mutex> lock(thread_affinity_mutex);
+  return thread_affinity_cpus;
+}
+
+namespace {
+
+// Tuning table for profile-guided task counts, see
+// at::set_parallel_tuning_enabled. Buckets are keyed by grain size and the
+// log2 of the range; each bucket cycles through candidate task counts,
+// keeps the best wall time seen per candidate and locks in the fastest one
+// once every candidate has enough trials.
+constexpr int kTuningTrialsPerCandidate = 3;
+
+struct TuningKey {
+  int64_t grain_size;
+  int range_log2;
+
+  bool operator==(const TuningKey& other) const {
+    return grain_size == other.grain_size && range_log2 == other.range_log2;
+  }
+};
+
+struct TuningKeyHash {
+  size_t operator()(const TuningKey& key) const {
+    return std::hash<int64_t>()(key.grain_size) * 31 +
+        std::hash<int>()(key.range_log2);
+  }
+};
+
+struct TuningEntry {
+  struct Candidate {
+    int num_tasks;
+    int trials = 0;
+    uint64_t best_ns = std::numeric_limits<uint64_t>::max();
+  };
+  // 0 while still measuring, the chosen task count afterwards.
+  int decided = 0;
+  std::vector<Candidate> candidates;
+};
+
+// -1: read TORCH_PARALLEL_TUNING on first use, otherwise 0/1.
+std::atomic<int> parallel_tuning_enabled{-1};
+std::mutex parallel_tuning_mutex;
+std::unordered_map<TuningKey, TuningEntry, TuningKeyHash>
+    parallel_tuning_table;
+
+int range_log2(int64_t range) {
+  int log2 = 0;
+  while (range >>= 1) {
+    ++log2;
+  }
+  return log2;
+}
+
+} // namespace
+
+void set_parallel_tuning_enabled(bool enabled) {
+  parallel_tuning_enabled.store(enabled ? 1 : 0);
+}
+
+bool get_parallel_tuning_enabled() {
+  auto enabled = parallel_tuning_enabled.load();
+  if (C10_UNLIKELY(enabled < 0)) {
+    enabled = get_env_var("TORCH_PARALLEL_TUNING") != nullptr ? 1 : 0;
+    parallel_tuning_enabled.store(enabled);
+  }
+  return enabled == 1;
+}
+
+std::string dump_parallel_tuning_table() {
+  std::ostringstream ss;
+  std::lock_guard<std::mutex> lock(parallel_tuning_mutex);
+  for (const auto& kv : parallel_tuning_table) {
+    if (kv.second.decided > 0) {
+      ss << kv.first.grain_size << " " << kv.first.range_log2 << " "
+         << kv.second.decided << std::endl;
+    }
+  }
+  return ss.str();
+}
+
+void load_parallel_tuning_table(const std::string& table) {
+  std::istringstream ss(table);
+  std::string line;
+  std::lock_guard<std::mutex> lock(parallel_tuning_mutex);
+  while (std::getline(ss, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream line_ss(line);
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    TuningKey key;
+    int num_tasks = 0;
+    line_ss >> key.grain_size >> key.range_log2 >> num_tasks;
+    TORCH_CHECK(
+        !line_ss.fail() && key.grain_size >= 0 && key.range_log2 >= 0 &&
+            num_tasks > 0,
+        "load_parallel_tuning_table: invalid line '", line, "'");
+    parallel_tuning_table[key].decided = num_tasks;
+  }
+}
+
+namespace {
+
+// Heterogeneous scheduling state, see
+// at::set_heterogeneous_scheduling_enabled. Core classes are detected once
+// from the maximum frequencies the kernel reports per CPU; per-task-slot
+// throughputs (work items per nanosecond, exponential moving average) are
+// measured while the feature is on and drive the weighted partitions, so
+// the weights recalibrate continuously as regions execute.
+constexpr double kThroughputEwmaAlpha = 0.25;
+// Max/min frequency ratio above which a machine is considered hybrid.
+constexpr double kCoreClassFreqRatio = 1.05;
+
+// -1: read TORCH_HETEROGENEOUS_SCHED on first use, otherwise 0/1.
+std::atomic<int> heterogeneous_sched_enabled{-1};
+std::atomic<bool> dynamic_chunk_sched{false};
+// -1: read TORCH_COOPERATIVE_PREEMPTION on first use, otherwise 0/1.
+std::atomic<int> cooperative_preemption_enabled{-1};
+// Priority of parallel regions launched from this thread, see
+// at::set_parallel_priority.
+thread_local bool parallel_high_priority = false;
+std::mutex task_throughput_mutex;
+std::vector<double> task_throughput;  // items/ns per task slot, 0 = unmeasured
+
+double read_cpu_max_freq(int cpu) {
+  std::ostringstream path;
+  path << "/sys/devices/system/cpu/cpu" << cpu
+       << "/cpufreq/cpuinfo_max_freq";
+  std::ifstream file(path.str());
+  double freq = 0;
+  if (file) {
+    file >> freq;
+  }
+  return freq;
+}
+
+// True when the CPUs advertise more than one core class. Detected once;
+// false when sysfs is unavailable (non-Linux, containers without /sys).
+bool detect_hybrid_cores() {
+  double min_freq = std::numeric_limits<double>::max();
+  double max_freq = 0;
+  for (const auto cpu : c10::irange(std::thread::hardware_concurrency())) {
+    const auto freq = read_cpu_max_freq(cpu);
+    if (freq <= 0) {
+      return false;
+    }
+    min_freq = std::min(min_freq, freq);
+    max_freq = std::max(max_freq, freq);
+  }
+  return max_freq > 0 && max_freq / min_freq >= kCoreClassFreqRatio;
+}
+
+bool is_hybrid_machine() {
+  static const bool hybrid = detect_hybrid_cores();
+  return hybrid;
+}
+
+} // namespace
+
+void set_heterogeneous_scheduling_enabled(bool enabled) {
+  heterogeneous_sched_enabled.store(enabled ? 1 : 0);
+}
+
+bool get_heterogeneous_scheduling_enabled() {
+  auto enabled = heterogeneous_sched_enabled.load();
+  if (C10_UNLIKELY(enabled < 0)) {
+    // Auto-enable via the environment only on machines that actually have
+    // more than one core class; explicit calls to
+    // set_heterogeneous_scheduling_enabled bypass the detection.
+    enabled = get_env_var("TORCH_HETEROGENEOUS_SCHED") != nullptr &&
+            is_hybrid_machine()
+        ? 1
+        : 0;
+    heterogeneous_sched_enabled.store(enabled);
+  }
+  return enabled == 1;
+}
+
+void set_dynamic_chunk_scheduling(bool enabled) {
+  dynamic_chunk_sched.store(enabled);
+}
+
+bool get_dynamic_chunk_scheduling() {
+  return dynamic_chunk_sched.load();
+}
+
+void set_cooperative_preemption_enabled(bool enabled) {
+  cooperative_preemption_enabled.store(enabled ? 1 : 0);
+}
+
+bool get_cooperative_preemption_enabled() {
+  auto enabled = cooperative_preemption_enabled.load();
+  if (C10_UNLIKELY(enabled < 0)) {
+    enabled = get_env_var("TORCH_COOPERATIVE_PREEMPTION") != nullptr ? 1 : 0;
+    cooperative_preemption_enabled.store(enabled);
+  }
+  return enabled == 1;
+}
+
+void set_parallel_priority(bool high_priority) {
+  parallel_high_priority = high_priority;
+}
+
+bool get_parallel_priority() {
+  return parallel_high_priority;
+}
+
+namespace internal {
+
+int choose_num_tasks(
+    int64_t grain_size,
+    int64_t range,
+    int max_tasks,
+    bool* measure) {
+  *measure = false;
+  std::lock_guard<std::mutex> lock(parallel_tuning_mutex);
+  auto& entry = parallel_tuning_table[{grain_size, range_log2(range)}];
+  if (entry.decided > 0) {
+    return std::min(entry.decided, max_tasks);
+  }
+  if (entry.candidates.empty()) {
+    // Powers of two up to max_tasks, plus max_tasks itself.
+    for (int num_tasks = 1; num_tasks < max_tasks; num_tasks *= 2) {
+      entry.candidates.push_back({num_tasks});
+    }
+    entry.candidates.push_back({max_tasks});
+  }
+  // Explore the candidate with the fewest trials so far.
+  auto* next = &entry.candidates[0];
+  for (auto& candidate : entry.candidates) {
+    if (candidate.trials < next->trials) {
+      next = &candidate;
+    }
+  }
+  if (next->trials >= kTuningTrialsPerCandidate) {
+    // Every candidate has enough trials: lock in the fastest one.
+    int best = entry.candidates[0].num_tasks;
+    auto best_ns = entry.candidates[0].best_ns;
+    for (const auto& candidate : entry.candidates) {
+      if (candidate.best_ns < best_ns) {
+        best = candidate.num_tasks;
+        best_ns = candidate.best_ns;
+      }
+    }
+    entry.decided = best;
+    return std::min(best, max_tasks);
+  }
+  *measure = true;
+  return next->num_tasks;
+}
+
+void record_parallel_region_time(
+    int64_t grain_size,
+    int64_t range,
+    int num_tasks,
+    uint64_t elapsed_ns) {
+  std::lock_guard<std::mutex> lock(parallel_tuning_mutex);
+  auto it = parallel_tuning_table.find({grain_size, range_log2(range)});
+  if (it == parallel_tuning_table.end()) {
+    return;
+  }
+  for (auto& candidate : it->second.candidates) {
+    if (candidate.num_tasks == num_tasks) {
+      ++candidate.trials;
+      candidate.best_ns = std::min(candidate.best_ns, elapsed_ns);
+      return;
+    }
+  }
+}
+
+bool compute_weighted_chunks(
+    int64_t begin,
+    int64_t end,
+    int num_tasks,
+    std::vector<std::pair<int64_t, int64_t>>& chunks) {
+  std::vector<double> weights(num_tasks, 0);
+  double measured_sum = 0;
+  int measured = 0;
+  {
+    std::lock_guard<std::mutex> lock(task_throughput_mutex);
+    for (const auto i : c10::irange(num_tasks)) {
+      if ((size_t)i < task_throughput.size() && task_throughput[i] > 0) {
+        weights[i] = task_throughput[i];
+        measured_sum += task_throughput[i];
+        ++measured;
+      }
+    }
+  }
+  if (measured == 0) {
+    // Nothing measured yet: run this region with even chunks; their timings
+    // bootstrap the estimates for the next region.
+    return false;
+  }
+  // Slots without measurements yet are assumed average.
+  const double fallback = measured_sum / measured;
+  double total = 0;
+  for (auto& weight : weights) {
+    if (weight <= 0) {
+      weight = fallback;
+    }
+    total += weight;
+  }
+  const int64_t range = end - begin;
+  chunks.clear();
+  chunks.reserve(num_tasks);
+  int64_t pos = begin;
+  double acc = 0;
+  for (const auto i : c10::irange(num_tasks)) {
+    acc += weights[i];
+    int64_t next = (i == num_tasks - 1)
+        ? end
+        : begin + (int64_t)((double)range * acc / total + 0.5);
+    next = std::max(pos, std::min(next, end));
+    chunks.emplace_back(pos, next);
+    pos = next;
+  }
+  return true;
+}
+
+void record_task_throughput(
+    int task_id,
+    int64_t work_items,
+    uint64_t elapsed_ns) {
+  if (task_id < 0 || work_items <= 0 || elapsed_ns == 0) {
+    return;
+  }
+  const double sample = (double)work_items / (double)elapsed_ns;
+  std::lock_guard<std::mutex> lock(task_throughput_mutex);
+  if ((size_t)task_id >= task_throughput.size()) {
+    task_throughput.resize(task_id + 1, 0);
+  }
+  auto& estimate = task_throughput[task_id];
+  estimate = estimate > 0
+      ? (1 - kThroughputEwmaAlpha) * estimate + kThroughputEwmaAlpha * sample
+      : sample;
+}
+
+void apply_thread_affinity(int thread_num) {
+  thread_local uint64_t applied_generation = 0;
+  const auto generation = thread_affinity_generation.load();
+  if (C10_LIKELY(applied_generation == generation)) {
+    return;
+  }
+  applied_generation = generation;
+  if (thread_num == 0) {
+    // Thread number 0 is the thread that invoked the parallel region; its
+    // placement belongs to the caller.
+    return;
+  }
+#ifdef __linux__
+  // Pool threads execute varying task ids across parallel regions, so the
+  // pinning slot has to be a stable per-thread index, handed out on first
+  // application.
+  static std::atomic<int> next_worker_slot{0};
+  thread_local int worker_slot = -1;
+  if (worker_slot < 0) {
+    worker_slot = next_worker_slot.fetch_add(1);
+  }
+  int cpu = -1;
+  {
+    std::lock_guard<std::mutex> lock(thread_affinity_mutex);
+    if (!thread_affinity_cpus.empty()) {
+      cpu = thread_affinity_cpus[worker_slot % thread_affinity_cpus.size()];
+    }
+  }
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  if (cpu >= 0) {
+    CPU_SET(cpu, &cpuset);
+  } else {
+    // Affinity was cleared: allow the worker to run anywhere again.
+    for (const auto i : c10::irange(std::thread::hardware_concurrency())) {
+      CPU_SET(i, &cpuset);
+    }
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set_t), &cpuset) != 0) {
+    TORCH_WARN_ONCE(
+        "set_thread_affinity: sched_setaffinity failed for intra-op worker ",
+        thread_num);
+  }
+#endif // __linux__
+}
+
+} // namespace internal
+
 } // namespace at
@@ -12,6 +12,10 @@
 #endif // C10_MOBILE
 
 #include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -82,6 +86,11 @@ TaskThreadPoolBase& _get_intraop_pool() {
   return *pool;
 }
 
+// Number of high-priority parallel regions currently holding or waiting for
+// pool workers; preemptible tasks poll this at chunk boundaries. See
+// at::set_cooperative_preemption_enabled.
+std::atomic<int> high_priority_regions{0};
+
 #endif // C10_MOBILE
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
@@ -110,6 +119,7 @@ void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
 struct ParallelRegionGuard {
   ParallelRegionGuard(int task_id) {
     internal::set_thread_num(task_id);
+    internal::apply_thread_affinity(task_id);
     _set_in_parallel_region(true);
   }
 
@@ -148,6 +158,49 @@ void invoke_parallel(
   std::tie(num_tasks, chunk_size) =
       internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
 
+  // Profile-guided task count, see at::set_parallel_tuning_enabled.
+  bool measure = false;
+  if (num_tasks > 1 && get_parallel_tuning_enabled()) {
+    const auto tuned_tasks = internal::choose_num_tasks(
+        grain_size, end - begin, (int)num_tasks, &measure);
+    if ((size_t)tuned_tasks != num_tasks) {
+      num_tasks = tuned_tasks;
+      chunk_size = divup((end - begin), num_tasks);
+    }
+  }
+
+  // Cooperative preemption, see at::set_cooperative_preemption_enabled.
+#ifndef C10_MOBILE
+  const bool preemption =
+      num_tasks > 1 && get_cooperative_preemption_enabled();
+  const bool high_priority = preemption && get_parallel_priority();
+  const bool preemptible = preemption && !high_priority;
+#else
+  const bool preemptible = false;
+#endif
+
+  // Heterogeneous-core scheduling, see
+  // at::set_heterogeneous_scheduling_enabled.
+  const bool hetero = num_tasks > 1 && get_heterogeneous_scheduling_enabled();
+  std::vector<std::pair<int64_t, int64_t>> weighted_chunks;
+  bool use_weighted = false;
+  // Shared chunk counter for dynamic self-scheduling (null otherwise).
+  std::shared_ptr<std::atomic<int64_t>> next_chunk;
+  int64_t dyn_chunk_size = 0;
+  if ((hetero && get_dynamic_chunk_scheduling()) || preemptible) {
+    // Preemptible regions always self-schedule: the chunk boundaries double
+    // as yield checkpoints.
+    next_chunk = std::make_shared<std::atomic<int64_t>>(begin);
+    // Several chunks per task so fast cores can claim more than their
+    // even share, but no smaller than the grain size.
+    dyn_chunk_size = std::max(
+        std::max(grain_size, (int64_t)1),
+        (int64_t)divup(end - begin, num_tasks * 4));
+  } else if (hetero) {
+    use_weighted = internal::compute_weighted_chunks(
+        begin, end, (int)num_tasks, weighted_chunks);
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   struct {
     std::atomic_flag err_flag = ATOMIC_FLAG_INIT;
@@ -157,14 +210,77 @@ void invoke_parallel(
     std::condition_variable cv;
   } state;
 
-  auto task = [f, &state, begin, end, chunk_size]
+  std::function<void(int, size_t)> task;
+  task = [f, &state, &task, begin, end, chunk_size, hetero, use_weighted,
+          &weighted_chunks, next_chunk, dyn_chunk_size, preemptible]
       (int /* unused */, size_t task_id) {
-    int64_t local_start = begin + task_id * chunk_size;
-    if (local_start < end) {
-      int64_t local_end = std::min(end, (int64_t)(chunk_size + local_start));
+    if (next_chunk) {
+      // Dynamic self-scheduling: claim grain-size chunks until the range
+      // is exhausted; faster cores naturally process more of them.
+#ifndef C10_MOBILE
+      bool yielded = false;
+#endif
       try {
         ParallelRegionGuard guard(task_id);
+        int64_t chunk_begin = 0;
+        while ((chunk_begin = next_chunk->fetch_add(dyn_chunk_size)) < end) {
+          f(chunk_begin, std::min(end, chunk_begin + dyn_chunk_size));
+#ifndef C10_MOBILE
+          // Task 0 runs on the caller's thread and never yields, which
+          // guarantees the region makes progress even if every pool worker
+          // is handed over to high-priority work.
+          if (preemptible && task_id != 0 &&
+              high_priority_regions.load(std::memory_order_relaxed) > 0) {
+            yielded = true;
+            break;
+          }
+#endif
+        }
+      } catch (...) {
+        if (!state.err_flag.test_and_set()) {
+          state.eptr = std::current_exception();
+        }
+      }
+#ifndef C10_MOBILE
+      if (yielded) {
+        // Hand the worker back to the pool and queue a continuation for the
+        // remaining chunks behind the waiting high-priority tasks. `task`
+        // outlives the continuation because invoke_parallel does not return
+        // until state.remaining reaches zero, and a yield does not
+        // decrement it.
+        _get_intraop_pool().run(
+            [&task, task_id]() { task((int)task_id, task_id); });
+        return;
+      }
+#endif
+      std::unique_lock<std::mutex> lk(state.mutex);
+      if (--state.remaining == 0) {
+        state.cv.notify_one();
+      }
+      return;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    int64_t local_start, local_end;
+    if (use_weighted) {
+      std::tie(local_start, local_end) = weighted_chunks[task_id];
+    } else {
+      local_start = begin + task_id * chunk_size;
+      local_end = std::min(end, (int64_t)(chunk_size + local_start));
+    }
+    if (local_start < local_end) {
+      try {
+        ParallelRegionGuard guard(task_id);
+        const auto task_start = hetero
+            ? std::chrono::steady_clock::now()
+            : std::chrono::steady_clock::time_point();
         f(local_start, local_end);
+        if (hetero) {
+          const auto task_ns =
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - task_start).count();
+          internal::record_task_throughput(
+              (int)task_id, local_end - local_start, (uint64_t)task_ns);
+        }
       } catch (...) {
         if (!state.err_flag.test_and_set()) {
           state.eptr = std::current_exception();
@@ -179,6 +295,15 @@ void invoke_parallel(
     }
   };
   state.remaining = num_tasks;
+#ifndef C10_MOBILE
+  // Advertise the region to running preemptible tasks for as long as it
+  // holds or waits for pool workers.
+  if (high_priority) {
+    high_priority_regions.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
+  const auto start_time = measure ? std::chrono::steady_clock::now()
+                                  : std::chrono::steady_clock::time_point();
   _run_with_pool(task, num_tasks);
 
   // Wait for all tasks to finish.
@@ -188,6 +313,17 @@ void invoke_parallel(
       state.cv.wait(lk);
     }
   }
+#ifndef C10_MOBILE
+  if (high_priority) {
+    high_priority_regions.fetch_sub(1, std::memory_order_relaxed);
+  }
+#endif
+  if (measure && !state.eptr) {
+    const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+    internal::record_parallel_region_time(
+        grain_size, end - begin, (int)num_tasks, (uint64_t)elapsed_ns);
+  }
   if (state.eptr) {
     std::rethrow_exception(state.eptr);
   }
@@ -13,6 +13,7 @@
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/TensorOperators.h>
 #include <ATen/TensorIteratorInternal.h>
+#include <ATen/record_function.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -28,6 +29,21 @@
 #include <algorithm>
 #include <cmath>
 
+/**
+ * Like ENABLE_RECORD_KERNEL_FUNCTION_DTYPE (see Dispatch.h), this tracepoint
+ * is only compiled into builds that do overhead attribution, so regular
+ * profiles are unchanged.
+ */
+#if defined ENABLE_RECORD_TENSORITERATOR_BUILD
+#define RECORD_TENSORITERATOR_BUILD()       \
+  RECORD_FUNCTION_WITH_SCOPE(               \
+      at::RecordScope::TENSOR_ITERATOR,     \
+      "TensorIterator::build",              \
+      c10::ArrayRef<const c10::IValue>{})
+#else
+#define RECORD_TENSORITERATOR_BUILD()
+#endif
+
 namespace at {
 
 using DimMask = TensorIteratorBase::DimMask;
@@ -754,6 +770,37 @@ void TensorIteratorBase::for_each(loop2d_t loop, int64_t grain_size) {
   }
 }
 
+int64_t TensorIteratorBase::suggested_grain_size() const {
+  if (ndim() == 0) {
+    return at::internal::GRAIN_SIZE;
+  }
+  // GRAIN_SIZE corresponds to roughly kBaseBytesPerElement bytes moved per
+  // element (a contiguous float input and output). Keep the bytes per chunk
+  // roughly constant by scaling the grain with the bytes this iteration
+  // actually touches per element: contiguous operands cost their element
+  // size, operands strided along the inner dimension cost a full cache line,
+  // and operands broadcast along it are effectively free.
+  constexpr int64_t kCacheLineSize = 64;
+  constexpr int64_t kBaseBytesPerElement = 8;
+  int64_t bytes_per_element = 0;
+  for (const auto i : c10::irange(ntensors())) {
+    const int64_t inner_stride = strides(i)[0];
+    if (inner_stride == 0) {
+      continue;
+    } else if (inner_stride == element_size(i)) {
+      bytes_per_element += element_size(i);
+    } else {
+      bytes_per_element += kCacheLineSize;
+    }
+  }
+  if (bytes_per_element <= 0) {
+    return at::internal::GRAIN_SIZE;
+  }
+  const int64_t grain =
+      at::internal::GRAIN_SIZE * kBaseBytesPerElement / bytes_per_element;
+  return std::max(grain, at::internal::GRAIN_SIZE / 16);
+}
+
 StrideVector TensorIteratorBase::get_strides() const {
   const auto dim = ndim();
   StrideVector strides(std::max(dim, 2) * ntensors());
@@ -1038,6 +1085,72 @@ void TensorIteratorBase::build_borrowing_unary_force_boolean_op(const TensorBase
       .add_input(a));
 }
 
+bool TensorIterator::can_use_flat_op(
+    const TensorBase& out, ArrayRef<const TensorBase*> inputs) {
+  if (!out.defined() || !out.device().is_cpu() ||
+      !out.is_contiguous(at::MemoryFormat::Contiguous) ||
+      out.is_conj() || out.is_neg() || isQIntType(out.scalar_type())) {
+    return false;
+  }
+  for (const TensorBase* input : inputs) {
+    const auto& t = *input;
+    if (!t.defined() || t.scalar_type() != out.scalar_type() ||
+        t.device() != out.device() ||
+        !t.is_contiguous(at::MemoryFormat::Contiguous) ||
+        t.is_conj() || t.is_neg() || !t.sizes().equals(out.sizes())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TensorIteratorBase::build_flat_op(
+    const TensorBase& out, ArrayRef<const TensorBase*> inputs) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(TensorIterator::can_use_flat_op(out, inputs));
+  num_outputs_ = 1;
+  operands_.reserve(inputs.size() + 1);
+  operands_.emplace_back(c10::MaybeOwned<TensorBase>::borrowed(out));
+  operands_[0].is_output = true;
+  for (const TensorBase* input : inputs) {
+    // Contiguous tensors cannot overlap internally, but an input sharing
+    // storage with the output must alias it exactly (in-place case).
+    assert_no_partial_overlap(out, *input);
+    if (input->is_same(out)) {
+      operands_[0].is_read_write = true;
+    }
+    operands_.emplace_back(c10::MaybeOwned<TensorBase>::borrowed(*input));
+  }
+  all_ops_same_shape_ = true;
+  common_dtype_ = out.scalar_type();
+  common_device_ = out.device();
+  // Iteration is a single flat dimension with the element stride, exactly
+  // what fast_set_up produces for the all-contiguous case.
+  shape_ = {out.numel()};
+  if (out.dim() > 1) {
+    has_coalesced_dimensions_ = true;
+  }
+  const auto element_size_in_bytes = out.element_size();
+  for (auto& op : operands_) {
+    op.stride_bytes.resize(1);
+    op.stride_bytes[0] = element_size_in_bytes;
+    op.data = op.tensor_base().data_ptr();
+  }
+  view_offsets_ = DimVector(1, 0);
+}
+
+TensorIterator TensorIterator::flat_unary_op(TensorBase& out, const TensorBase& a) {
+  TensorIterator iter;
+  iter.build_flat_op(out, {&a});
+  return iter;
+}
+
+TensorIterator TensorIterator::flat_binary_op(
+    TensorBase& out, const TensorBase& a, const TensorBase& b) {
+  TensorIterator iter;
+  iter.build_flat_op(out, {&a, &b});
+  return iter;
+}
+
 TensorIterator TensorIterator::binary_op(TensorBase& out, const TensorBase& a, const TensorBase& b) {
   TensorIterator iter;
   iter.build_binary_op(out, a, b);
@@ -1456,6 +1569,12 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
 TensorIteratorBase::TensorIteratorBase() = default;
 
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
+  // tracepoint for overhead attribution: shows up nested under the op's
+  // event so profilers can split its time into iterator setup, kernel
+  // execution (see ENABLE_RECORD_KERNEL_FUNCTION_DTYPE in Dispatch.h) and,
+  // by subtraction, dispatch overhead
+  RECORD_TENSORITERATOR_BUILD();
+
   // populate some persistent configuration fields
   is_reduction_ = config.is_reduction_;
   enforce_linear_iteration_ = config.enforce_linear_iteration_;
@@ -408,6 +408,16 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
 
   void parallel_reduce(loop2d_t loop);
 
+  /// Returns a grain size for parallel loops over this iterator, derived from
+  /// at::internal::GRAIN_SIZE but normalized by the bytes each element of the
+  /// iteration actually moves. GRAIN_SIZE counts elements and was tuned for
+  /// contiguous float loops; for strided operands, which pull in a whole cache
+  /// line per element, and for wide dtypes the same element count can move an
+  /// order of magnitude more memory, so splitting on the raw constant makes
+  /// the chunks too large to balance and too big for cache. Conversely, for
+  /// narrow dtypes it splits too eagerly and fork-join overhead dominates.
+  int64_t suggested_grain_size() const;
+
   template <
       typename loop1d_t,
       std::enable_if_t<
@@ -538,6 +548,13 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
       const TensorBase& out,
       const TensorBase& a);
   void build_borrowing_unary_op(const TensorBase& out, const TensorBase& a);
+  // Fast-path build for operands pre-checked with
+  // TensorIterator::can_use_flat_op: iterates over the flat contiguous data
+  // directly, skipping broadcasting, type promotion, stride computation and
+  // dimension coalescing. Operands are borrowed; the caller keeps them alive.
+  void build_flat_op(
+      const TensorBase& out,
+      ArrayRef<const TensorBase*> inputs);
   TORCH_DISALLOW_TEMPORARIES(build_borrowing_unary_op)
   void build_borrowing_unary_force_boolean_op(
       const TensorBase& out,
@@ -706,6 +723,17 @@ struct TORCH_API TensorIterator final : public TensorIteratorBase {
       const TensorBase& b);
   static TensorIterator unary_op(TensorBase& out, const TensorBase& a);
   static TensorIterator unary_float_op(TensorBase& out, const TensorBase& a);
+  // True when all operands are defined, contiguous CPU tensors of the same
+  // dtype and shape (no broadcasting, no conj/neg views), i.e. when the
+  // flat_*_op factories below may be used instead of a full build.
+  static bool can_use_flat_op(
+      const TensorBase& out,
+      ArrayRef<const TensorBase*> inputs);
+  static TensorIterator flat_unary_op(TensorBase& out, const TensorBase& a);
+  static TensorIterator flat_binary_op(
+      TensorBase& out,
+      const TensorBase& a,
+      const TensorBase& b);
   static TensorIterator nullary_op(TensorBase& out);
   static TensorIterator borrowing_nullary_op(const TensorBase& out);
   static TensorIterator borrowing_nullary_op(TensorBase&& out) = delete;
@@ -1,5 +1,19 @@
 #include <ATen/TensorMeta.h>
 
 namespace at {
+namespace impl {
 
+namespace {
+thread_local bool meta_shape_checks_enabled_flag = true;
+} // namespace
+
+bool meta_shape_checks_enabled() {
+  return meta_shape_checks_enabled_flag;
+}
+
+void set_meta_shape_checks_enabled(bool enabled) {
+  meta_shape_checks_enabled_flag = enabled;
+}
+
+} // namespace impl
 } // namespace at
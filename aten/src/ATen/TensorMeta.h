@@ -62,6 +62,40 @@ namespace impl {
 //
 #define TORCH_IMPL_FUNC(name) void structured_##name::impl
 
+// Meta functions validate argument shapes with TORCH_CHECK on every call.
+// Callers that validated shapes ahead of time (e.g. the Static Runtime,
+// whose first iteration ran the full checks while building the memory plan)
+// can elide this per-call work by disabling the thread-local flag below.
+// Meta functions opt in by phrasing pure shape/argument validation with
+// TORCH_META_CHECK instead of TORCH_CHECK; output size computation and
+// allocation are unaffected, only the redundant validation is skipped.
+TORCH_API bool meta_shape_checks_enabled();
+TORCH_API void set_meta_shape_checks_enabled(bool enabled);
+
+// RAII guard that elides TORCH_META_CHECK validation on the current thread
+// for its lifetime. Only use this around calls whose shapes are known valid.
+struct TORCH_API MetaShapeChecksDisabledGuard {
+  MetaShapeChecksDisabledGuard() : prev_(meta_shape_checks_enabled()) {
+    set_meta_shape_checks_enabled(false);
+  }
+  ~MetaShapeChecksDisabledGuard() {
+    set_meta_shape_checks_enabled(prev_);
+  }
+  MetaShapeChecksDisabledGuard(const MetaShapeChecksDisabledGuard&) = delete;
+  MetaShapeChecksDisabledGuard& operator=(const MetaShapeChecksDisabledGuard&) =
+      delete;
+
+ private:
+  bool prev_;
+};
+
+#define TORCH_META_CHECK(...)                                \
+  do {                                                       \
+    if (C10_LIKELY(at::impl::meta_shape_checks_enabled())) { \
+      TORCH_CHECK(__VA_ARGS__);                              \
+    }                                                        \
+  } while (false)
+
 // Base class for all structured kernel classes.  The set_output virtual
 // method is varied depending whether or not the operator is
 // functional/out/inplace, and could also be specialized for CPU/CUDA/etc
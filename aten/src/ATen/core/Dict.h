@@ -7,6 +7,7 @@
 #include <c10/util/intrusive_ptr.h>
 #include <c10/util/order_preserving_flat_hash_map.h>
 #include <c10/util/Optional.h>
+#include <c10/util/string_view.h>
 #include <ATen/core/TensorBody.h>
 #include <ATen/core/jit_type_base.h>
 
@@ -31,10 +32,22 @@ namespace detail {
 
 struct DictKeyHash {
   size_t operator()(const IValue& ivalue) const;
+  // Heterogeneous overloads hashing unboxed keys exactly like their boxed
+  // counterparts, so statically typed dicts can probe the map without
+  // constructing an IValue (for string keys that is a heap allocation) per
+  // lookup.
+  size_t operator()(int64_t key) const;
+  size_t operator()(double key) const;
+  size_t operator()(bool key) const;
+  size_t operator()(c10::string_view key) const;
 };
 
 struct DictKeyEqualTo {
   bool operator()(const IValue& lhs, const IValue& rhs) const;
+  bool operator()(int64_t lhs, const IValue& rhs) const;
+  bool operator()(double lhs, const IValue& rhs) const;
+  bool operator()(bool lhs, const IValue& rhs) const;
+  bool operator()(c10::string_view lhs, const IValue& rhs) const;
 };
 
 struct DictImpl final : public c10::intrusive_ptr_target {
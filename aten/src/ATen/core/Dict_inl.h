@@ -14,6 +14,23 @@ inline bool DictKeyEqualTo::operator()(const IValue& lhs, const IValue& rhs) con
   // [container equality])
   return _fastEqualsForContainer(lhs, rhs);
 }
+
+inline bool DictKeyEqualTo::operator()(int64_t lhs, const IValue& rhs) const {
+  return rhs.isInt() && rhs.toInt() == lhs;
+}
+
+inline bool DictKeyEqualTo::operator()(double lhs, const IValue& rhs) const {
+  return rhs.isDouble() && rhs.toDouble() == lhs;
+}
+
+inline bool DictKeyEqualTo::operator()(bool lhs, const IValue& rhs) const {
+  return rhs.isBool() && rhs.toBool() == lhs;
+}
+
+inline bool DictKeyEqualTo::operator()(c10::string_view lhs, const IValue& rhs)
+    const {
+  return rhs.isString() && rhs.toStringView() == lhs;
+}
 }
 
 template<class T> decltype(auto) getTypePtr();
@@ -58,6 +75,65 @@ inline size_t DictKeyHash::operator()(const IValue& ivalue) const {
   }
 }
 
+inline size_t DictKeyHash::operator()(int64_t key) const {
+  return std::hash<int64_t>()(key);
+}
+
+inline size_t DictKeyHash::operator()(double key) const {
+  return std::hash<double>()(key);
+}
+
+inline size_t DictKeyHash::operator()(bool key) const {
+  return std::hash<bool>()(key);
+}
+
+inline size_t DictKeyHash::operator()(c10::string_view key) const {
+  return std::hash<c10::string_view>()(key);
+}
+
+// Probes for dicts whose static key type is a primitive skip boxing the key
+// into an IValue and search the map with the raw key instead, via the
+// heterogeneous DictKeyHash/DictKeyEqualTo overloads above. For string keys
+// the boxed probe would allocate a ConstantString per lookup.
+template <class Key>
+struct DictKeyProbe final {
+  static DictImpl::dict_map_type::iterator find(
+      DictImpl& impl,
+      const Key& key) {
+    return impl.dict.find(key);
+  }
+};
+
+template <>
+struct DictKeyProbe<int64_t> final {
+  static DictImpl::dict_map_type::iterator find(DictImpl& impl, int64_t key) {
+    return impl.dict.find_transparent(key);
+  }
+};
+
+template <>
+struct DictKeyProbe<double> final {
+  static DictImpl::dict_map_type::iterator find(DictImpl& impl, double key) {
+    return impl.dict.find_transparent(key);
+  }
+};
+
+template <>
+struct DictKeyProbe<bool> final {
+  static DictImpl::dict_map_type::iterator find(DictImpl& impl, bool key) {
+    return impl.dict.find_transparent(key);
+  }
+};
+
+template <>
+struct DictKeyProbe<std::string> final {
+  static DictImpl::dict_map_type::iterator find(
+      DictImpl& impl,
+      const std::string& key) {
+    return impl.dict.find_transparent(c10::string_view(key));
+  }
+};
+
 inline intrusive_ptr<DictImpl> DictImpl::copy() const {
   return make_intrusive<DictImpl>(dict, elementTypes);
 }
@@ -149,12 +225,16 @@ C10_NODISCARD size_t Dict<Key, Value>::erase(const Key& key) const {
 
 template<class Key, class Value>
 Value Dict<Key, Value>::at(const Key& key) const {
-  return impl_->dict.at(key).template to<Value>();
+  auto found = detail::DictKeyProbe<Key>::find(*impl_, key);
+  if (found == impl_->dict.end()) {
+    throw std::out_of_range("Argument passed to at() was not in the map.");
+  }
+  return found->second.template to<Value>();
 }
 
 template<class Key, class Value>
 typename Dict<Key, Value>::iterator Dict<Key, Value>::find(const Key& key) const {
-  return iterator{impl_->dict.find(key)};
+  return iterator{detail::DictKeyProbe<Key>::find(*impl_, key)};
 }
 
 template<class Key, class Value>
@@ -71,17 +71,76 @@ using can_unbox =
   >;
 
 //
-// boxArgs - utility for pushing unboxed args onto IValue stack
+// PooledStack - a torch::jit::Stack whose heap buffer is recycled through a
+// per-thread cache.
 //
-template <class... Args>
-torch::jit::Stack boxArgs(Args... args) {
-  // TODO Reuse stack vector instead of allocating?
-  torch::jit::Stack stack;
-  stack.reserve(sizeof...(Args));
-  torch::jit::push(stack, std::forward<Args>(args)...);
-  return stack;
+// The boxed calling convention is fixed to torch::jit::Stack
+// (std::vector<IValue>): every registered boxed kernel and fallback takes a
+// Stack*, so the argument stack cannot be swapped for a fixed-capacity
+// vector type without breaking that ABI. Instead, argument stacks hand their
+// buffer back to a small thread-local cache on destruction and reclaim it on
+// construction, so steady-state boxed calls (vmap, functionalization,
+// tracing fallbacks) do not touch the heap at all. The cache is a stack of
+// buffers rather than a single slot to stay correct under reentrant boxed
+// calls, where a fallback invokes another boxed op before returning.
+//
+
+// Minimum capacity of a pooled buffer; covers ops with up to this many
+// boxed arguments without reallocation.
+constexpr size_t kMinPooledStackCapacity = 8;
+// Buffers that grew beyond this are freed instead of cached, so one giant
+// op does not pin memory for the lifetime of the thread.
+constexpr size_t kMaxPooledStackCapacity = 64;
+// Upper bound on cached buffers per thread (bounds reentrancy depth served
+// from the cache).
+constexpr size_t kMaxPooledStacks = 8;
+
+inline std::vector<torch::jit::Stack>& pooledStackCache() {
+  static thread_local std::vector<torch::jit::Stack> cache;
+  return cache;
 }
 
+class PooledStack final {
+ public:
+  explicit PooledStack(size_t capacity) {
+    auto& cache = pooledStackCache();
+    if (!cache.empty()) {
+      stack_ = std::move(cache.back());
+      cache.pop_back();
+    }
+    stack_.reserve(std::max(capacity, kMinPooledStackCapacity));
+  }
+
+  PooledStack(PooledStack&&) = default;
+  PooledStack(const PooledStack&) = delete;
+  PooledStack& operator=(const PooledStack&) = delete;
+  PooledStack& operator=(PooledStack&&) = delete;
+
+  ~PooledStack() {
+    // A moved-from PooledStack has no buffer to give back.
+    if (stack_.capacity() == 0) {
+      return;
+    }
+    auto& cache = pooledStackCache();
+    if (cache.size() < kMaxPooledStacks &&
+        stack_.capacity() <= kMaxPooledStackCapacity) {
+      stack_.clear();
+      cache.push_back(std::move(stack_));
+    }
+  }
+
+  /* implicit */ operator torch::jit::Stack&() {
+    return stack_;
+  }
+
+  torch::jit::Stack& get() {
+    return stack_;
+  }
+
+ private:
+  torch::jit::Stack stack_;
+};
+
 template <class T>
 static inline constexpr size_t boxed_size_one() {
   static_assert(!std::is_same<std::decay_t<T>, c10::TensorOptions>::value, "need to patch this path to support TensorOptions passed by reference");
@@ -106,6 +165,16 @@ static inline constexpr size_t boxed_size() {
   return BoxedSize<Args...>::value;
 }
 
+//
+// boxArgs - utility for pushing unboxed args onto IValue stack
+//
+template <class... Args>
+PooledStack boxArgs(Args... args) {
+  PooledStack stack(boxed_size<Args...>());
+  torch::jit::push(stack.get(), std::forward<Args>(args)...);
+  return stack;
+}
+
 using IValueAlignedStorage = std::aligned_storage_t<sizeof(IValue), alignof(IValue)>;
 
 template <typename T>
@@ -223,7 +292,8 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     Args... args
   ) {
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    PooledStack pooled_stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    torch::jit::Stack& stack = pooled_stack;
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
 
     return guts::if_constexpr<!std::is_same<void, Result>::value>(
@@ -264,7 +334,8 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs<at::Tensor&, OtherArgs...>(outArg, std::forward<OtherArgs>(otherArgs)...);
+    PooledStack pooled_stack = boxArgs<at::Tensor&, OtherArgs...>(outArg, std::forward<OtherArgs>(otherArgs)...);
+    torch::jit::Stack& stack = pooled_stack;
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -291,7 +362,8 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     const at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs(outArg, otherArgs...);
+    PooledStack pooled_stack = boxArgs(outArg, otherArgs...);
+    torch::jit::Stack& stack = pooled_stack;
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -329,7 +401,8 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     FirstArg firstArg, RestArgs... restArgs
   ) {
-    torch::jit::Stack stack = boxArgs<FirstArg, RestArgs...>(std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
+    PooledStack pooled_stack = boxArgs<FirstArg, RestArgs...>(std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
+    torch::jit::Stack& stack = pooled_stack;
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -369,7 +442,8 @@ struct BoxedKernelWrapper<
     using ArgTuple = std::tuple<Args...>;
     constexpr int RetCount = std::tuple_size<Result>();
 
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    PooledStack pooled_stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    torch::jit::Stack& stack = pooled_stack;
     (*boxed_kernel_func)(functor, opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == RetCount,
@@ -2,6 +2,10 @@
 #include <list>
 #include <sstream>
 
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
 namespace c10 {
 
 namespace detail {
@@ -34,12 +38,53 @@ private:
 
 OpRegistrationListener::~OpRegistrationListener()= default;
 
+namespace {
+
+// Maps a backend name from TORCH_LAZY_BACKEND_MODULES (e.g. "CUDA") onto
+// its BackendComponent by comparing against the enum's "<name>Bit" strings.
+c10::optional<BackendComponent> parseBackendComponent(const std::string& name) {
+  for (uint8_t bit = 1;
+       bit <= static_cast<uint8_t>(BackendComponent::EndOfBackendKeys);
+       ++bit) {
+    auto backend = static_cast<BackendComponent>(bit);
+    if (name + "Bit" == toString(backend)) {
+      return backend;
+    }
+  }
+  return c10::nullopt;
+}
+
+} // namespace
+
 Dispatcher::Dispatcher()
 : operators_()
 , operatorLookupTable_()
+, operatorIdTable_()
 , backendFallbackKernels_()
 , listeners_(std::make_unique<detail::RegistrationListenerList>())
-, mutex_() {}
+, mutex_() {
+  // Comma separated backend=path entries, e.g.
+  // "CUDA=/usr/lib/libtorch_cuda.so".
+  const char* env = getenv("TORCH_LAZY_BACKEND_MODULES");
+  if (env == nullptr) {
+    return;
+  }
+  std::istringstream stream(env);
+  std::string entry;
+  while (std::getline(stream, entry, ',')) {
+    auto pos = entry.find('=');
+    auto backend = pos == std::string::npos
+        ? c10::nullopt
+        : parseBackendComponent(entry.substr(0, pos));
+    if (!backend) {
+      TORCH_WARN(
+          "Ignoring malformed TORCH_LAZY_BACKEND_MODULES entry '", entry,
+          "'; expected <backend>=<path>, e.g. CUDA=/usr/lib/libtorch_cuda.so");
+      continue;
+    }
+    registerLazyBackendModule(*backend, entry.substr(pos + 1));
+  }
+}
 
 Dispatcher::~Dispatcher() = default;
 
@@ -48,6 +93,54 @@ C10_EXPORT Dispatcher& Dispatcher::realSingleton() {
   return _singleton;
 }
 
+void Dispatcher::registerLazyBackendModule(
+    BackendComponent backend,
+    std::string library_path) {
+  TORCH_CHECK(
+      backend != BackendComponent::InvalidBit,
+      "registerLazyBackendModule: expected a valid backend component");
+  std::lock_guard<std::mutex> lock(lazyModuleMutex_);
+  lazyBackendModules_[static_cast<uint8_t>(backend)] = std::move(library_path);
+}
+
+bool Dispatcher::tryLoadLazyBackendModule(DispatchKey dispatch_key) {
+  auto backend = toBackendComponent(dispatch_key);
+  if (backend == BackendComponent::InvalidBit) {
+    return false;
+  }
+  const auto bit = static_cast<uint8_t>(backend);
+  // Deliberately not mutex_: the module's static initializers re-enter the
+  // dispatcher to register their kernels. A concurrent miss on the same
+  // backend blocks here until the load finishes, then sees the loaded bit
+  // and retries its lookup.
+  std::lock_guard<std::mutex> lock(lazyModuleMutex_);
+  if (lazyBackendsLoaded_ & (1ull << bit)) {
+    return true;
+  }
+  auto it = lazyBackendModules_.find(bit);
+  if (it == lazyBackendModules_.end()) {
+    return false;
+  }
+  const std::string path = std::move(it->second);
+  lazyBackendModules_.erase(it);
+#if defined(_WIN32)
+  TORCH_CHECK(
+      false,
+      "Lazy backend modules are not supported on Windows (requested '",
+      path, "' for ", toString(backend), ")");
+#else
+  void* handle = dlopen(path.c_str(), RTLD_LOCAL | RTLD_NOW);
+  TORCH_CHECK(
+      handle != nullptr,
+      "Could not load lazy backend module '", path, "' for ",
+      toString(backend), ": ", dlerror());
+  // The handle is deliberately leaked: the registrations the module
+  // installed must outlive any dispatch that uses them.
+  lazyBackendsLoaded_ |= (1ull << bit);
+  return true;
+#endif
+}
+
 c10::optional<OperatorHandle> Dispatcher::findOp(const OperatorName& overload_name) {
   return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> c10::optional<OperatorHandle> {
     auto found = operatorLookupTable.find(overload_name);
@@ -58,6 +151,51 @@ c10::optional<OperatorHandle> Dispatcher::findOp(const OperatorName& overload_na
   });
 }
 
+size_t Dispatcher::internOperatorName(const OperatorName& op_name) {
+  const auto existing = operatorIdTable_.read([&] (const OperatorIdTable& table) -> c10::optional<size_t> {
+    auto found = table.ids.find(op_name);
+    if (found == table.ids.end()) {
+      return c10::nullopt;
+    }
+    return found->second;
+  });
+  if (existing.has_value()) {
+    return *existing;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto op = findOp(op_name);
+  return operatorIdTable_.write([&] (OperatorIdTable& table) -> size_t {
+    // Re-check under the lock in case another thread interned the name
+    // after our read above.
+    auto found = table.ids.find(op_name);
+    if (found != table.ids.end()) {
+      return found->second;
+    }
+    const size_t id = table.operators.size();
+    table.ids.emplace(op_name, id);
+    if (op.has_value()) {
+      table.operators.push_back(op->operatorIterator_);
+    } else {
+      table.operators.push_back(c10::nullopt);
+    }
+    return id;
+  });
+}
+
+c10::optional<OperatorHandle> Dispatcher::findOpById(size_t id) {
+  return operatorIdTable_.read([&] (const OperatorIdTable& table) -> c10::optional<OperatorHandle> {
+    TORCH_INTERNAL_ASSERT(
+        id < table.operators.size(),
+        "Invalid interned operator id: ", id);
+    const auto& op = table.operators[id];
+    if (!op.has_value()) {
+      return c10::nullopt;
+    }
+    return OperatorHandle(*op);
+  });
+}
+
 c10::optional<OperatorHandle> Dispatcher::findSchema(const OperatorName& overload_name) {
   auto it = findOp(overload_name);
   if (it.has_value()) {
@@ -110,6 +248,14 @@ OperatorHandle Dispatcher::findOrRegisterName_(const OperatorName& op_name) {
   operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
     operatorLookupTable.emplace(op_name, handle);
   });
+  // If the name was interned before the operator was registered, fill in its
+  // slot so findOpById() resolves it from now on.
+  operatorIdTable_.write([&] (OperatorIdTable& table) {
+    auto found = table.ids.find(op_name);
+    if (found != table.ids.end()) {
+      table.operators[found->second] = handle.operatorIterator_;
+    }
+  });
 
   return handle;
 }
@@ -150,6 +296,8 @@ void Dispatcher::deregisterLibrary_(const std::string& ns) {
 RegistrationHandleRAII Dispatcher::registerDef(FunctionSchema schema, std::string debug) {
   // we need a lock to avoid concurrent writes
   std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(!finalized_, "Cannot register schema for ", schema.operator_name(),
+    " after the dispatcher has been finalized (registration: ", debug, ")");
 
   OperatorName op_name = schema.operator_name();
   auto op = findOrRegisterName_(op_name);
@@ -173,6 +321,12 @@ void Dispatcher::deregisterDef_(const OperatorHandle& op, const OperatorName& op
   // we need a lock to avoid concurrent writes
   std::lock_guard<std::mutex> lock(mutex_);
 
+  // After finalization the state this would unwind is gone; RAII handles
+  // destructed at process exit land here and must be no-ops.
+  if (finalized_) {
+    return;
+  }
+
   TORCH_INTERNAL_ASSERT(op.schema().operator_name() == op_name);
 
   // reduce def_count and actually deregister if no references left
@@ -201,6 +355,8 @@ RegistrationHandleRAII Dispatcher::registerImpl(
   std::string debug
 ) {
   std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(!finalized_, "Cannot register kernel for ", op_name,
+    " after the dispatcher has been finalized (registration: ", debug, ")");
 
   auto op = findOrRegisterName_(op_name);
 
@@ -224,6 +380,12 @@ RegistrationHandleRAII Dispatcher::registerImpl(
 void Dispatcher::deregisterImpl_(const OperatorHandle& op, const OperatorName& op_name, c10::optional<DispatchKey> dispatch_key, impl::OperatorEntry::AnnotatedKernelContainerIterator handle) {
   std::lock_guard<std::mutex> lock(mutex_);
 
+  // Finalization erased the overridden-kernel lists this handle points
+  // into; see deregisterDef_.
+  if (finalized_) {
+    return;
+  }
+
   op.operatorDef_->op.deregisterKernel_(*this, dispatch_key, handle);
 
   TORCH_INTERNAL_ASSERT(op.operator_name() == op_name);
@@ -236,6 +398,8 @@ void Dispatcher::deregisterImpl_(const OperatorHandle& op, const OperatorName& o
 
 RegistrationHandleRAII Dispatcher::registerName(OperatorName op_name) {
   std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(!finalized_, "Cannot register operator name ", op_name,
+    " after the dispatcher has been finalized");
   auto op = findOrRegisterName_(op_name);
   ++op.operatorDef_->def_and_impl_count;
   return RegistrationHandleRAII(
@@ -246,6 +410,9 @@ void Dispatcher::deregisterName_(
     const OperatorHandle& op,
     const OperatorName& op_name) {
   std::lock_guard<std::mutex> lock(mutex_);
+  if (finalized_) {
+    return;
+  }
   TORCH_INTERNAL_ASSERT(op.operator_name() == op_name);
   TORCH_INTERNAL_ASSERT(op.operatorDef_->def_and_impl_count > 0);
   --op.operatorDef_->def_and_impl_count;
@@ -261,11 +428,21 @@ void Dispatcher::cleanup(const OperatorHandle& op, const OperatorName& op_name)
     operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
       operatorLookupTable.erase(op_name);
     });
+    // Keep the interned id (ids are stable for the process lifetime) but
+    // empty out its slot so findOpById() no longer returns the dead operator.
+    operatorIdTable_.write([&] (OperatorIdTable& table) {
+      auto found = table.ids.find(op_name);
+      if (found != table.ids.end()) {
+        table.operators[found->second] = c10::nullopt;
+      }
+    });
   }
 }
 
 RegistrationHandleRAII Dispatcher::registerFallback(DispatchKey dispatchKey, KernelFunction kernel, std::string debug) {
   std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(!finalized_, "Cannot register backend fallback for ", dispatchKey,
+    " after the dispatcher has been finalized (registration: ", debug, ")");
 
   auto idx = getDispatchTableIndexForDispatchKey(dispatchKey);
   TORCH_CHECK(idx >= 0 && static_cast<uint64_t>(idx) < backendFallbackKernels_.size(), "idx=", idx);
@@ -287,8 +464,22 @@ RegistrationHandleRAII Dispatcher::registerFallback(DispatchKey dispatchKey, Ker
   });
 }
 
+void Dispatcher::finalizeDispatchTables() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (finalized_) {
+    return;
+  }
+  for (auto& op : operators_) {
+    op.op.finalizeForSharing();
+  }
+  finalized_.store(true, std::memory_order_release);
+}
+
 void Dispatcher::deregisterFallback_(DispatchKey dispatchKey) {
   std::lock_guard<std::mutex> lock(mutex_);
+  if (finalized_) {
+    return;
+  }
 
   auto idx = getDispatchTableIndexForDispatchKey(dispatchKey);
   backendFallbackKernels_[idx] = {};
@@ -9,6 +9,7 @@
 #include <ATen/record_function.h>
 #include <c10/util/Exception.h>
 #include <c10/util/LeftRight.h>
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <type_traits>
@@ -19,6 +20,7 @@ namespace c10 {
 
 class TORCH_API OperatorHandle;
 template<class FuncType> class TypedOperatorHandle;
+template<class FuncType> class FrozenTypedOperatorHandle;
 
 /**
  * Implement this interface and register your instance with the dispatcher
@@ -134,6 +136,23 @@ public:
   // Like findSchema, but also returns OperatorHandle even if there is no schema
   c10::optional<OperatorHandle> findOp(const OperatorName& operator_name);
 
+  /**
+   * Interns an operator name into a dense integer id, following the same
+   * symbol-table idea as the JIT's InternedStrings. Ids are assigned on first
+   * use and remain stable for the lifetime of the process, so hot callers
+   * that would otherwise resolve an operator by name on every call can intern
+   * once and use findOpById() afterwards, skipping string hashing entirely.
+   * The operator does not need to be registered yet at interning time.
+   */
+  size_t internOperatorName(const OperatorName& operator_name);
+
+  /**
+   * Like findOp, but resolves an id previously returned by
+   * internOperatorName() with a hash-free array lookup. Returns nullopt if
+   * the operator is not (or no longer) registered.
+   */
+  c10::optional<OperatorHandle> findOpById(size_t id);
+
   // Returns a list of all operator names present in the operatorLookupTable_
   const std::vector<OperatorName> getAllOpNames();
 
@@ -157,6 +176,12 @@ public:
   template<class Return, class... Args>
   Return redispatch(const TypedOperatorHandle<Return (Args...)>& op, DispatchKeySet currentDispatchKeySet, Args... args) const;
 
+  // Resolve the dispatch decision for the given (representative) arguments
+  // once and snapshot it into a handle that can replay it without redoing
+  // the per-call keyset computation. See Note [Frozen dispatch].
+  template<class Return, class... Args>
+  FrozenTypedOperatorHandle<Return (Args...)> freeze(const TypedOperatorHandle<Return (Args...)>& op, Args... args) const;
+
   // Invoke an operator via the boxed calling convention using an IValue stack
   void callBoxed(const OperatorHandle& op, Stack* stack) const;
 
@@ -210,6 +235,58 @@ public:
    */
   RegistrationHandleRAII registerLibrary(std::string ns, std::string debug);
 
+  // ------------------------------------------------------------------------
+  //
+  // Finalization
+  //
+  // ------------------------------------------------------------------------
+
+  /**
+   * Freeze the operator tables for the remainder of the process's lifetime.
+   * Intended to be called in a fork server right before spawning workers:
+   * each entry drops its registration-only metadata (overridden kernels kept
+   * around only so deregistration can resurrect them, inferred schemas kept
+   * only to cross-check later registrations), so the compacted tables are
+   * never written again and stay copy-on-write-shared across forked children
+   * instead of being faulted into every worker's RSS.
+   *
+   * After finalization any attempt to register a new operator, kernel,
+   * fallback or library is an error, and deregistrations (e.g. from RAII
+   * handles destructed at process exit) become no-ops since the state they
+   * would unwind is gone. Per-call mutable state (RecordFunction observers,
+   * dispatch TLS) lives outside the operator tables and is unaffected.
+   */
+  void finalizeDispatchTables();
+
+  bool isFinalized() const {
+    return finalized_.load(std::memory_order_acquire);
+  }
+
+  // ------------------------------------------------------------------------
+  //
+  // Lazy backend modules
+  //
+  // ------------------------------------------------------------------------
+
+  /**
+   * Register a shared library to be loaded the first time dispatch reaches
+   * `backend` without finding a kernel. The library's static initializers
+   * install its TORCH_LIBRARY registrations at load time and the failed
+   * lookup is retried, so processes that never touch the backend skip its
+   * registration work at startup entirely. Also configurable through the
+   * TORCH_LAZY_BACKEND_MODULES environment variable, as a comma separated
+   * list of backend=path entries (e.g. "CUDA=/usr/lib/libtorch_cuda.so").
+   */
+  void registerLazyBackendModule(BackendComponent backend, std::string library_path);
+
+  /**
+   * Load the lazy module registered for the backend of `dispatch_key`, if
+   * any. Returns true if the backend's module has been loaded (by this or
+   * an earlier call) and the lookup should be retried. Called from the
+   * missing-kernel slow path; see OperatorEntry::lookupSlowPath().
+   */
+  bool tryLoadLazyBackendModule(DispatchKey dispatch_key);
+
   // ------------------------------------------------------------------------
   //
   // Listeners on registrations
@@ -282,6 +359,19 @@ private:
   LeftRight<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
 #else
   RWSafeLeftRightWrapper<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
+#endif
+  // Symbol table backing internOperatorName()/findOpById(). `operators` is
+  // indexed by interned id; a slot is nullopt while its operator is not
+  // registered. Writes happen under mutex_; reads go through the same
+  // LeftRight synchronization as operatorLookupTable_.
+  struct OperatorIdTable final {
+    ska::flat_hash_map<OperatorName, size_t> ids;
+    std::vector<c10::optional<std::list<OperatorDef>::iterator>> operators;
+  };
+#if !defined(C10_MOBILE)
+  LeftRight<OperatorIdTable> operatorIdTable_;
+#else
+  RWSafeLeftRightWrapper<OperatorIdTable> operatorIdTable_;
 #endif
   // Map from namespace to debug string (saying, e.g., where the library was defined)
   ska::flat_hash_map<std::string, std::string> libraries_;
@@ -290,6 +380,19 @@ private:
 
   std::unique_ptr<detail::RegistrationListenerList> listeners_;
   std::mutex mutex_;
+
+  // Set (under mutex_) by finalizeDispatchTables(); atomic so isFinalized()
+  // can be queried without taking the lock.
+  std::atomic<bool> finalized_{false};
+
+  // Lazy backend modules, keyed by BackendComponent. Guarded by
+  // lazyModuleMutex_ rather than mutex_ so that loading a module - whose
+  // static initializers re-enter the dispatcher to register kernels - does
+  // not deadlock, and so that concurrent misses on the same backend block
+  // until the first load finishes.
+  ska::flat_hash_map<uint8_t, std::string> lazyBackendModules_;
+  uint64_t lazyBackendsLoaded_ = 0;
+  std::mutex lazyModuleMutex_;
 };
 
 /**
@@ -414,12 +517,85 @@ public:
     return c10::Dispatcher::singleton().redispatch<Return, Args...>(*this, currentDispatchKeySet, std::forward<Args>(args)...);
   }
 
+  // See Note [Frozen dispatch]. The arguments are only inspected for their
+  // dispatch keys, not consumed.
+  C10_ALWAYS_INLINE FrozenTypedOperatorHandle<Return (Args...)> freeze(Args... args) const {
+    return c10::Dispatcher::singleton().freeze<Return, Args...>(*this, std::forward<Args>(args)...);
+  }
+
 private:
   explicit TypedOperatorHandle(std::list<Dispatcher::OperatorDef>::iterator operatorIterator)
   : OperatorHandle(operatorIterator) {}
   friend class OperatorHandle;
 };
 
+// Note [Frozen dispatch]
+// ~~~~~~~~~~~~~~~~~~~~~~
+// Every unboxed call through Dispatcher::call recomputes the dispatch keyset
+// from scratch: the DispatchKeyExtractor inspects each tensor argument and
+// merges in the thread-local include/exclude sets before the resulting keyset
+// is turned into a dispatch table index. For callers that invoke the same
+// operator with arguments of an unchanging key profile -- typically
+// inference-only processes where every input is a plain dense CPU or CUDA
+// tensor with autograd disabled -- this work yields the same answer on every
+// call. A FrozenTypedOperatorHandle snapshots that answer once: it is created
+// from a representative ("warmup") set of arguments and stores the resolved
+// kernel together with the keyset that selected it, so subsequent calls jump
+// straight to the kernel.
+//
+// The caller takes on the obligation that every call through the frozen
+// handle would have resolved to the same kernel as the warmup call. In
+// particular the frozen handle must not be used if the arguments' backend,
+// dtype or layout keys can differ from the warmup arguments, or if
+// TLS-dependent dispatch state (autograd mode, inference mode, python mode,
+// torch_function, ...) can differ between freezing and calling. Like
+// redispatch, frozen calls also skip RecordFunction observers, so profiler
+// and other instrumentation will not see them.
+//
+// The stored kernel pointer aims at the operator's dispatch table slot, which
+// is updated in place by (de)registrations, so re-registering a kernel for
+// the frozen key is picked up transparently. The handle does keep the
+// operator alive the same way any OperatorHandle does.
+template<class FuncType>
+class FrozenTypedOperatorHandle final {
+  static_assert(guts::false_t<FuncType>(), "FuncType in TypedOperatorHandle::freeze was not a valid function type");
+};
+template<class Return, class... Args>
+class FrozenTypedOperatorHandle<Return (Args...)> final {
+public:
+  FrozenTypedOperatorHandle(FrozenTypedOperatorHandle&&) noexcept = default;
+  FrozenTypedOperatorHandle& operator=(FrozenTypedOperatorHandle&&) noexcept = default;
+  FrozenTypedOperatorHandle(const FrozenTypedOperatorHandle&) = default;
+  FrozenTypedOperatorHandle& operator=(const FrozenTypedOperatorHandle&) = default;
+
+  // See [Note: Argument forwarding in the dispatcher] for why Args doesn't use &&
+  C10_ALWAYS_INLINE Return call(Args... args) const {
+    return kernel_->template call<Return, Args...>(op_, dispatchKeySet_, std::forward<Args>(args)...);
+  }
+
+  const TypedOperatorHandle<Return (Args...)>& handle() const {
+    return op_;
+  }
+
+  // The keyset the warmup arguments resolved to; useful for asserting that
+  // later arguments would have dispatched the same way.
+  DispatchKeySet dispatchKeySet() const {
+    return dispatchKeySet_;
+  }
+
+private:
+  explicit FrozenTypedOperatorHandle(
+      TypedOperatorHandle<Return (Args...)> op,
+      const KernelFunction* kernel,
+      DispatchKeySet dispatchKeySet)
+  : op_(std::move(op)), kernel_(kernel), dispatchKeySet_(dispatchKeySet) {}
+  friend class Dispatcher;
+
+  TypedOperatorHandle<Return (Args...)> op_;
+  const KernelFunction* kernel_;
+  DispatchKeySet dispatchKeySet_;
+};
+
 namespace detail {
 template <class... Args> inline void unused_arg_(const Args&...) {}
 
@@ -562,6 +738,18 @@ inline Return Dispatcher::redispatch(const TypedOperatorHandle<Return (Args...)>
   return kernel.template call<Return, Args...>(op, currentDispatchKeySet, std::forward<Args>(args)...);
 }
 
+// See [Note: Argument forwarding in the dispatcher] for why Args doesn't use &&
+template<class Return, class... Args>
+inline FrozenTypedOperatorHandle<Return (Args...)> Dispatcher::freeze(const TypedOperatorHandle<Return (Args...)>& op, Args... args) const {
+  detail::unused_arg_(args...);  // workaround for a false-positive warning about unused parameters in gcc 5
+  auto dispatchKeySet = op.operatorDef_->op.dispatchKeyExtractor()
+    .template getDispatchKeySetUnboxed<Args...>(args...);
+  // lookup throws if there is no kernel for this keyset, so a frozen handle
+  // always holds a callable kernel.
+  const KernelFunction& kernel = op.operatorDef_->op.lookup(dispatchKeySet);
+  return FrozenTypedOperatorHandle<Return (Args...)>(op, &kernel, dispatchKeySet);
+}
+
 inline void Dispatcher::callBoxed(const OperatorHandle& op, Stack* stack) const {
   // note: this doesn't need the mutex because write operations on the list keep iterators intact.
   const auto& entry = op.operatorDef_->op;
@@ -177,6 +177,22 @@ void OperatorEntry::updateFallback(const c10::Dispatcher& dispatcher, DispatchKe
   updateDispatchTable_(dispatcher, dispatch_key);
 }
 
+void OperatorEntry::finalizeForSharing() {
+  for (auto& kv : kernels_) {
+#ifndef C10_DISPATCHER_ONE_KERNEL_PER_DISPATCH_KEY
+    // Only the front kernel of each list is live in the dispatch table;
+    // the ones behind it exist solely so a later deregistration can
+    // resurrect them, which finalization forbids.
+    kv.second.erase(std::next(kv.second.begin()), kv.second.end());
+#endif
+    for (auto& k : kv.second) {
+      // Inferred schemas are only consulted to cross-check a schema
+      // registration that arrives after the kernel; none can arrive now.
+      k.inferred_function_schema.reset();
+    }
+  }
+}
+
 const KernelFunction& OperatorEntry::computeDispatchTableEntry(const c10::Dispatcher& dispatcher, DispatchKey dispatch_key) const {
   return computeDispatchTableEntryWithDebug(dispatcher, dispatch_key).first.kernel;
 }
@@ -424,6 +440,18 @@ void OperatorEntry::reportSignatureError(const CppSignature call_signature) cons
   );
 };
 
+const KernelFunction& OperatorEntry::lookupSlowPath(DispatchKeySet ks) const {
+  if (c10::Dispatcher::singleton().tryLoadLazyBackendModule(
+          ks.highestPriorityTypeId())) {
+    const auto idx = ks.getDispatchTableIndexForDispatchKeySet();
+    const auto& kernel = dispatchTable_[idx];
+    if (kernel.isValid()) {
+      return kernel;
+    }
+  }
+  reportError(ks.highestPriorityTypeId());
+}
+
 void OperatorEntry::reportError(DispatchKey dispatchKey) const {
   // If there is an invariant problem, report it now.
   checkInvariants();
@@ -147,6 +147,12 @@ public:
     DispatchKey dispatch_key
   );
 
+  // Precondition: Dispatcher::mutex_ is held
+  // Drops metadata that only registration and deregistration would touch,
+  // leaving the entry read-only for the rest of the process's lifetime.
+  // See Dispatcher::finalizeDispatchTables().
+  void finalizeForSharing();
+
   // Precondition: Dispatcher::mutex_ is held
   void updateSchemaAliasAnalysis(AliasAnalysisKind a) {
     TORCH_INTERNAL_ASSERT(schema_.has_value());
@@ -173,6 +179,10 @@ public:
 
   [[noreturn]] void reportError(DispatchKey dispatchKey) const;
 
+  // Missing-kernel path: gives a lazily registered backend module the
+  // chance to supply the kernel before reporting the miss.
+  const KernelFunction& lookupSlowPath(DispatchKeySet ks) const;
+
   const KernelFunction& lookup(DispatchKeySet ks) const {
     const auto idx = ks.getDispatchTableIndexForDispatchKeySet();
     if (C10_UNLIKELY(idx == -1)) {
@@ -187,7 +197,7 @@ public:
     // in the common case.
     if (C10_UNLIKELY(!kernel.isValidUnboxed())) {
       if (!kernel.isValid()) {
-        reportError(ks.highestPriorityTypeId());
+        return lookupSlowPath(ks);
       }
     }
     return kernel;
@@ -612,6 +612,16 @@ struct TORCH_API Tuple : c10::intrusive_ptr_target {
     return c10::make_intrusive<Tuple>(std::move(elements_), std::move(type_));
   }
 
+  // Takes a generic TypePtr so that callers holding an erased tuple
+  // type (e.g. the interpreter's NAMED_TUPLE_CONSTRUCT path) can
+  // benefit from the inline TupleElements representation without
+  // round-tripping through std::vector.
+  static c10::intrusive_ptr<Tuple> createNamed(
+      TupleElements elements_,
+      c10::TypePtr type_) {
+    return c10::make_intrusive<Tuple>(std::move(elements_), std::move(type_));
+  }
+
   static c10::intrusive_ptr<Tuple> createNamed(
       std::initializer_list<IValue> elements_,
       std::shared_ptr<TupleType> type_) {
@@ -740,6 +750,9 @@ struct TORCH_API Tuple : c10::intrusive_ptr_target {
   explicit Tuple(TupleElements&& elements, std::shared_ptr<TupleType> type)
     : elements_(std::move(elements)), type_(std::move(type)) {}
 
+  explicit Tuple(TupleElements&& elements, c10::TypePtr type)
+    : elements_(std::move(elements)), type_(std::move(type)) {}
+
   explicit Tuple(IValue&& e1)
     : elements_(std::move(e1)) {}
 
@@ -797,12 +810,30 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
     std::string error_msg;
   };
 
+  ~Future() override {
+    // Free callbacks that were added but never ran because the future was
+    // abandoned without being marked completed.
+    CallbackNode* head = callbacks_.load(std::memory_order_relaxed);
+    if (head == completedTag()) {
+      return;
+    }
+    while (head != nullptr) {
+      CallbackNode* next = head->next;
+      delete head;
+      head = next;
+    }
+  }
+
   /**
    * Wait on the future until it completes.
    */
   void wait() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    finished_cv_.wait(lock, [&]() -> bool { return completed_; });
+    if (!completed_.load(std::memory_order_acquire)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      numWaiters_++;
+      finished_cv_.wait(lock, [&]() -> bool { return completed_; });
+      numWaiters_--;
+    }
     synchronizeWithCurrentStreams();
   }
 
@@ -862,10 +893,11 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
         "a Future can only be marked completed once.");
 
     // Only set value_ and completed_ flag once all checks and preparation steps
-    // have returned successfully to allow for proper error propagation.
+    // have returned successfully to allow for proper error propagation. The
+    // completed_ flag must be set last (with release semantics): lock-free
+    // readers that observe it use it as the license to read value_, storages_
+    // and events_ without taking the mutex.
     value_ = std::move(value);
-    completed_ = true;
-
     currentDevice_ = impl_.getDevice();
     storages_ = std::move(actualStorages);
     for (const c10::Device& device : usedDevices) {
@@ -873,15 +905,16 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
       event.record(impl_.getStream(device));
       events_.push_back(std::move(event));
     }
-
-    std::vector<std::function<void(Future&)>> cbs;
-    cbs.swap(callbacks_);
+    completed_.store(true, std::memory_order_release);
+    const bool hasWaiters = numWaiters_ > 0;
     lock.unlock();
 
-    finished_cv_.notify_all();
-    for (auto& callback : cbs) {
-      invokeCallback(std::move(callback));
+    // Waking up the condition variable is a syscall; then-chains that nobody
+    // wait()s on (callbacks do all the work) skip it entirely.
+    if (hasWaiters) {
+      finished_cv_.notify_all();
     }
+    invokePendingCallbacks();
   }
 
   void markCompleted() {
@@ -915,10 +948,11 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
     }
   }
 
-  // Get the result of the current future.
+  // Get the result of the current future. All fields are immutable once
+  // completed_ has been observed (with acquire semantics), so no lock is
+  // needed.
   IValue value() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    AT_ASSERT(completed());
+    AT_ASSERT(completed_.load(std::memory_order_acquire));
     if (eptr_) {
       std::rethrow_exception(eptr_);
     }
@@ -928,8 +962,7 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
   // This accessor should only be used if we know that the future is
   // completed() with no error.
   const IValue& constValue() const {
-    std::unique_lock<std::mutex> lock(mutex_);
-    AT_ASSERT(completed());
+    AT_ASSERT(completed_.load(std::memory_order_acquire));
     TORCH_INTERNAL_ASSERT(
       !eptr_,
       "value() accessor should only be used when future is not completed with ",
@@ -942,8 +975,7 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
   // This accessor should only be used if we know that the future is
   // completed() with no error.
   const std::vector<WeakStorage>& storages() const {
-    std::unique_lock<std::mutex> lock(mutex_);
-    AT_ASSERT(completed());
+    AT_ASSERT(completed_.load(std::memory_order_acquire));
     AT_ASSERT(!eptr_);
     return storages_;
   }
@@ -953,6 +985,11 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
    * The callbacks will be executed once the future completes.
    * If the future has already completed,
    * this function will execute the callback immediately.
+   *
+   * This is lock-free: pending callbacks form a Treiber stack that the
+   * completing thread exchanges for the completed tag, which is the
+   * linearization point between registering a callback and running the
+   * pending ones. Callbacks added after that point run inline.
    */
   template <typename T>
   void addCallback(T callback) {
@@ -961,13 +998,23 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
         std::is_invocable_r<void, T, Future&>::value,
         "The callback must have signature void(Future&)");
 #endif
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (completed()) {
-      lock.unlock();
+    CallbackNode* head = callbacks_.load(std::memory_order_acquire);
+    if (head == completedTag()) {
       invokeCallback(std::move(callback));
       return;
     }
-    callbacks_.emplace_back(std::move(callback));
+    auto* node = new CallbackNode(std::move(callback));
+    do {
+      if (head == completedTag()) {
+        // The future completed while we were trying to push.
+        auto cb = std::move(node->callback);
+        delete node;
+        invokeCallback(std::move(cb));
+        return;
+      }
+      node->next = head;
+    } while (!callbacks_.compare_exchange_weak(
+        head, node, std::memory_order_release, std::memory_order_acquire));
   }
 
   /**
@@ -1042,7 +1089,6 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
   // Tries to retrieve the error message from std::exception_ptr.
   std::string tryRetrieveErrorMessage() const {
     TORCH_CHECK(hasError(), "No error present on the future.");
-    std::unique_lock<std::mutex> lock(mutex_);
     return tryRetrieveErrorMessageInternal(eptr_);
   }
 
@@ -1052,17 +1098,18 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
   }
 
   bool hasValue() const {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return completed_ && !eptr_;
+    return completed_.load(std::memory_order_acquire) && !eptr_;
   }
 
   bool hasError() const {
-    std::unique_lock<std::mutex> lock(mutex_);
-    return eptr_ ? true : false;
+    // eptr_ is only ever set before completed_ becomes observable.
+    return completed_.load(std::memory_order_acquire) && eptr_ != nullptr;
   }
 
   std::exception_ptr exception_ptr() const {
-    std::unique_lock<std::mutex> lock(mutex_);
+    if (!completed_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
     return eptr_;
   }
 
@@ -1140,16 +1187,38 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
         ", trying to set error: ",
         tryRetrieveErrorMessageInternal(eptr));
     TORCH_INTERNAL_ASSERT(!completed(), "Future is already marked completed");
-    completed_ = true;
+    // As in markCompleted, the completed_ store publishes eptr_ to lock-free
+    // readers and so must come last.
     eptr_ = std::move(eptr);
-
-    std::vector<std::function<void(Future&)>> cbs;
-    cbs.swap(callbacks_);
+    completed_.store(true, std::memory_order_release);
+    const bool hasWaiters = numWaiters_ > 0;
     lock.unlock();
 
-    finished_cv_.notify_all();
-    for (auto& callback : cbs) {
-      invokeCallback(std::move(callback));
+    if (hasWaiters) {
+      finished_cv_.notify_all();
+    }
+    invokePendingCallbacks();
+  }
+
+  // Detaches the list of callbacks registered so far, replacing it with the
+  // completed tag, and runs them in registration order. Called exactly once,
+  // after the result has been published.
+  void invokePendingCallbacks() {
+    CallbackNode* head =
+        callbacks_.exchange(completedTag(), std::memory_order_acq_rel);
+    // The Treiber stack holds the callbacks in reverse registration order.
+    CallbackNode* ordered = nullptr;
+    while (head != nullptr) {
+      CallbackNode* next = head->next;
+      head->next = ordered;
+      ordered = head;
+      head = next;
+    }
+    while (ordered != nullptr) {
+      CallbackNode* next = ordered->next;
+      invokeCallback(std::move(ordered->callback));
+      delete ordered;
+      ordered = next;
     }
   }
 
@@ -1284,13 +1353,38 @@ struct C10_EXPORT ivalue::Future final : c10::intrusive_ptr_target {
         formatSetOfDevices(superset));
   }
 
+  // A node in the lock-free stack of pending callbacks.
+  struct CallbackNode {
+    CallbackNode() = default;
+    explicit CallbackNode(std::function<void(Future&)> cb)
+        : callback(std::move(cb)) {}
+    std::function<void(Future&)> callback;
+    CallbackNode* next = nullptr;
+  };
+
+  // Sentinel stored in callbacks_ once the future has completed and its
+  // pending callbacks have been detached; from then on callbacks run inline
+  // in addCallback.
+  static CallbackNode* completedTag() {
+    static CallbackNode tag;
+    return &tag;
+  }
+
+  // The mutex only guards the waiting path (finished_cv_ and numWaiters_) and
+  // the one-time transition in markCompleted/setError; the callback and
+  // completed-read paths are lock-free.
   mutable std::mutex mutex_;
   std::atomic_bool completed_ = {false}; // is this future complete
   std::condition_variable finished_cv_;
+  // Number of threads blocked in wait(); completion skips the notify_all
+  // syscall when it is zero. Guarded by mutex_.
+  int64_t numWaiters_ = 0;
 
   IValue value_; // when finished the value
   TypePtr type_;
-  std::vector<std::function<void(Future&)>> callbacks_;
+  // Treiber stack of callbacks registered before completion, in reverse
+  // registration order, or completedTag() after completion.
+  std::atomic<CallbackNode*> callbacks_{nullptr};
   std::exception_ptr eptr_;
 
   // An upcast pointer to a virtual class which allows us to manipulate events,
@@ -98,6 +98,73 @@ TEST(OperatorRegistrationTest, whenRegisteringWithoutSchema_thenFails) {
   }, "In operator registration: Tried to register an operator without specifying a schema or operator name.");
 }
 
+TEST(OperatorRegistrationTest, whenInterningOperatorName_thenCanBeFoundById) {
+  bool called = false;
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options().catchAllKernel<MockKernel>(&called));
+
+  auto id = Dispatcher::singleton().internOperatorName({"_test::dummy", ""});
+  // interning is idempotent
+  EXPECT_EQ(id, Dispatcher::singleton().internOperatorName({"_test::dummy", ""}));
+
+  auto op = Dispatcher::singleton().findOpById(id);
+  ASSERT_TRUE(op.has_value());
+  EXPECT_FALSE(called);
+  callOp(*op, dummyTensor(c10::DispatchKey::CPU));
+  EXPECT_TRUE(called);
+}
+
+TEST(OperatorRegistrationTest, whenInternedOperatorIsDeregistered_thenFindByIdReturnsNullopt) {
+  size_t id = 0;
+  {
+    auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options().catchAllKernel<DummyKernel>());
+    id = Dispatcher::singleton().internOperatorName({"_test::dummy", ""});
+    EXPECT_TRUE(Dispatcher::singleton().findOpById(id).has_value());
+  }
+  EXPECT_FALSE(Dispatcher::singleton().findOpById(id).has_value());
+
+  // re-registering the operator fills the slot for the existing id again
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options().catchAllKernel<DummyKernel>());
+  EXPECT_EQ(id, Dispatcher::singleton().internOperatorName({"_test::dummy", ""}));
+  EXPECT_TRUE(Dispatcher::singleton().findOpById(id).has_value());
+}
+
+TEST(OperatorRegistrationTest, whenFreezingDispatch_thenCallsSnapshottedKernel) {
+  bool called_kernel_cpu = false;
+  bool called_kernel_cuda = false;
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options()
+    .kernel<MockKernel>(c10::DispatchKey::CPU, &called_kernel_cpu)
+    .kernel<MockKernel>(c10::DispatchKey::CUDA, &called_kernel_cuda));
+
+  auto op = Dispatcher::singleton().findSchema({"_test::dummy", ""});
+  ASSERT_TRUE(op.has_value());
+  auto typed = op->typed<void(Tensor)>();
+  auto frozen = typed.freeze(dummyTensor(c10::DispatchKey::CPU));
+  EXPECT_EQ(c10::DispatchKey::CPU, frozen.dispatchKeySet().highestPriorityTypeId());
+  EXPECT_FALSE(called_kernel_cpu);
+
+  frozen.call(dummyTensor(c10::DispatchKey::CPU));
+  EXPECT_TRUE(called_kernel_cpu);
+
+  // The dispatch decision was made at freeze time; the keys of the actual
+  // arguments are not consulted anymore.
+  called_kernel_cpu = false;
+  frozen.call(dummyTensor(c10::DispatchKey::CUDA));
+  EXPECT_TRUE(called_kernel_cpu);
+  EXPECT_FALSE(called_kernel_cuda);
+}
+
+TEST(OperatorRegistrationTest, whenFreezingDispatchWithoutKernelForKey_thenFails) {
+  auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options().kernel<DummyKernel>(c10::DispatchKey::CPU));
+
+  auto op = Dispatcher::singleton().findSchema({"_test::dummy", ""});
+  ASSERT_TRUE(op.has_value());
+  auto typed = op->typed<void(Tensor)>();
+  expectThrows<c10::Error>([&] {
+    typed.freeze(dummyTensor(c10::DispatchKey::CUDA));
+  }, "Could not run '_test::dummy' with arguments from the 'CUDA'"
+  " backend.");
+}
+
 TEST(OperatorRegistrationTest, whenCallingOpWithWrongDispatchKey_thenFails) {
   auto registrar = c10::RegisterOperators().op("_test::dummy(Tensor dummy) -> ()", c10::RegisterOperators::options().kernel<DummyKernel>(c10::DispatchKey::CPU));
 
@@ -2159,6 +2226,24 @@ TEST(OperatorRegistrationTest, getRegistrationsForDispatchKey) {
   ASSERT_TRUE(std::includes(all_ops.begin(), all_ops.end(), cpu_ops.begin(), cpu_ops.end(), cmp_lambda));
 }
 
+TEST(OperatorRegistrationTest, lazyBackendModules) {
+  auto& dispatcher = Dispatcher::singleton();
+
+  // Nothing registered for this backend: the miss is reported normally.
+  EXPECT_FALSE(dispatcher.tryLoadLazyBackendModule(c10::DispatchKey::PrivateUse3));
+
+  // A registered module that cannot be loaded surfaces a loading error
+  // instead of a missing-kernel error.
+  dispatcher.registerLazyBackendModule(
+      c10::BackendComponent::PrivateUse3Bit, "/nonexistent/liblazy_backend.so");
+  expectThrows<c10::Error>([&] {
+    dispatcher.tryLoadLazyBackendModule(c10::DispatchKey::PrivateUse3);
+  }, "Could not load lazy backend module");
+
+  // The failing entry was consumed; later misses report normally again.
+  EXPECT_FALSE(dispatcher.tryLoadLazyBackendModule(c10::DispatchKey::PrivateUse3));
+}
+
 }
 
 #pragma GCC diagnostic pop
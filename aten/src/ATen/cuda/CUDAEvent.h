@@ -2,6 +2,7 @@
 
 #include <ATen/cuda/ATenCUDAGeneral.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAStream.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <ATen/cuda/Exceptions.h>
@@ -40,10 +41,11 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
   }
 
   // Note: event destruction done on creating device to avoid creating a
-  // CUDA context on other devices.
+  // CUDA context on other devices. Pooled events are returned to their
+  // device's freelist instead of destroyed.
   ~CUDAEvent() {
     try {
-      if (is_created_) {
+      if (is_created_ && !pooled_event_) {
         CUDAGuard guard(device_index_);
         cudaEventDestroy(event_);
       }
@@ -159,11 +161,19 @@ private:
   bool was_recorded_ = false;
   DeviceIndex device_index_ = -1;
   cudaEvent_t event_{};
+  c10::cuda::EventPool::Event pooled_event_;
 
   void createEvent(DeviceIndex device_index) {
     device_index_ = device_index;
     CUDAGuard guard(device_index_);
-    AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    if (flags_ == cudaEventDisableTiming) {
+      // The common (timing-disabled) case leases a recycled event from the
+      // per-device pool rather than paying for cudaEventCreate per use.
+      pooled_event_ = c10::cuda::getEventPool()->get(device_index_);
+      event_ = *pooled_event_;
+    } else {
+      AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    }
     is_created_ = true;
   }
 
@@ -173,6 +183,7 @@ private:
     std::swap(was_recorded_, other.was_recorded_);
     std::swap(device_index_, other.device_index_);
     std::swap(event_, other.event_);
+    std::swap(pooled_event_, other.pooled_event_);
   }
 };
 
@@ -0,0 +1,105 @@
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/NativeFunctions.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+
+#include <atomic>
+#include <cmath>
+
+namespace at {
+namespace native {
+
+namespace {
+// Single-tensor fallback for grads that are acceptable but not dense.
+// Composite ops keep the semantics without a custom strided kernel; this
+// path is expected to be rare.
+void _amp_non_finite_check_and_unscale_cpu_(
+    Tensor& scaled_grad,
+    Tensor& found_inf,
+    const Tensor& inv_scale) {
+  if (!at::all(at::isfinite(scaled_grad)).item<bool>()) {
+    found_inf.fill_(1.f);
+  }
+  scaled_grad.mul_(inv_scale);
+}
+} // anonymous namespace
+
+// CPU counterpart of _amp_foreach_non_finite_check_and_unscale_cuda_.
+// Multiplies each tensor in scaled_grads by inv_scale in-place and sets
+// found_inf to 1.0 if any element is inf or NaN. Dense tensors get a single
+// parallel pass over their flat data; there is no multi tensor apply on CPU,
+// so each tensor is processed separately.
+//
+// Args:
+// scaled_grads:  A TensorList of scaled gradient tensors.  May contain infs or NaNs.
+// found_inf:  A single-element float tensor to which 1.0 will be written if any gradient contain infs/nans.
+//             Pre-zeroing found_inf, if appropriate, is the responsibility of the caller.
+// inv_scale:  The inverse of the scale factor by which scaled_grads are currently multiplied.
+void _amp_foreach_non_finite_check_and_unscale_cpu_(
+    TensorList scaled_grads,
+    Tensor& found_inf,
+    const Tensor& inv_scale) {
+  if (scaled_grads.size() == 0) {
+    return;
+  }
+
+  TORCH_CHECK(inv_scale.device().is_cpu(), "inv_scale must be a CPU tensor.");
+  TORCH_CHECK(found_inf.device().is_cpu(), "found_inf must be a CPU tensor.");
+  TORCH_CHECK(inv_scale.numel() == 1, "inv_scale must be a 1-element tensor.");
+  TORCH_CHECK(found_inf.numel() == 1, "found_inf must be a 1-element tensor.");
+  TORCH_CHECK(inv_scale.scalar_type() == at::ScalarType::Float, "inv_scale must be a float tensor.");
+  TORCH_CHECK(found_inf.scalar_type() == at::ScalarType::Float, "found_inf must be a float tensor.");
+
+  const float inv_scale_val = *inv_scale.data_ptr<float>();
+  auto* found_inf_ptr = found_inf.data_ptr<float>();
+
+  for (const Tensor& t : scaled_grads) {
+    TORCH_CHECK(t.device().is_cpu(), "one of scaled_grads was not a CPU tensor.");
+    TORCH_CHECK(t.layout() == at::kStrided, "one of scaled_grads was not a strided tensor.");
+    TORCH_CHECK(at::isFloatingType(t.scalar_type()),
+                "one of scaled_grads was not a floating point tensor.");
+    if (!t.is_non_overlapping_and_dense()) {
+      _amp_non_finite_check_and_unscale_cpu_(
+          const_cast<Tensor&>(t), found_inf, inv_scale);
+      continue;
+    }
+
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        kHalf,
+        kBFloat16,
+        t.scalar_type(),
+        "_amp_foreach_non_finite_check_and_unscale_cpu",
+        [&] {
+          auto* data = t.data_ptr<scalar_t>();
+          // Relaxed is enough: every store writes the same value and the
+          // parallel_for join orders it before the read below.
+          std::atomic<bool> found_nonfinite(false);
+          at::parallel_for(
+              0,
+              t.numel(),
+              at::internal::GRAIN_SIZE,
+              [&](int64_t begin, int64_t end) {
+                using opmath_t = at::opmath_type<scalar_t>;
+                bool local_found = false;
+                for (int64_t i = begin; i < end; ++i) {
+                  const auto val = static_cast<opmath_t>(data[i]);
+                  if (!std::isfinite(val)) {
+                    local_found = true;
+                  }
+                  data[i] = static_cast<scalar_t>(
+                      inv_scale_val == 1.f ? val : val * inv_scale_val);
+                }
+                if (local_found) {
+                  found_nonfinite.store(true, std::memory_order_relaxed);
+                }
+              });
+          if (found_nonfinite.load(std::memory_order_relaxed)) {
+            *found_inf_ptr = 1.f;
+          }
+        });
+  }
+}
+
+} // namespace native
+} // namespace at
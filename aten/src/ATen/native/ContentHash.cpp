@@ -0,0 +1,116 @@
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+
+#include <cstring>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// splitmix64 finalizer; full-period 64-bit mixer.
+inline uint64_t mix64(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ull;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebull;
+  x ^= x >> 31;
+  return x;
+}
+
+inline uint64_t hash_chunk(const uint8_t* data, size_t nbytes, uint64_t seed) {
+  uint64_t h = mix64(seed + 0x9e3779b97f4a7c15ull);
+  size_t nwords = nbytes / sizeof(uint64_t);
+  const uint8_t* p = data;
+  for (const auto i : c10::irange(nwords)) {
+    (void)i;
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    h = mix64(h ^ word);
+    p += sizeof(word);
+  }
+  uint64_t tail = 0;
+  size_t tail_bytes = nbytes - nwords * sizeof(uint64_t);
+  if (tail_bytes > 0) {
+    std::memcpy(&tail, p, tail_bytes);
+    h = mix64(h ^ tail);
+  }
+  return h;
+}
+
+// Hashes chunks in parallel and folds the per-chunk hashes in index order,
+// so the result is independent of how parallel_for schedules the chunks.
+uint64_t hash_bytes(const uint8_t* data, size_t nbytes) {
+  constexpr size_t kChunkBytes = 256 * 1024;
+  const size_t num_chunks = std::max<size_t>(1, (nbytes + kChunkBytes - 1) / kChunkBytes);
+  std::vector<uint64_t> chunk_hashes(num_chunks);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      size_t offset = i * kChunkBytes;
+      size_t len = std::min(kChunkBytes, nbytes - offset);
+      chunk_hashes[i] = hash_chunk(data + offset, len, i);
+    }
+  });
+  uint64_t h = mix64(nbytes);
+  for (uint64_t chunk_hash : chunk_hashes) {
+    h = mix64(h ^ chunk_hash);
+  }
+  return h;
+}
+
+} // namespace
+
+int64_t _content_hash(const Tensor& self) {
+  TORCH_CHECK(
+      self.layout() == kStrided,
+      "_content_hash: expected a strided tensor, got layout ", self.layout());
+
+  // The data hash is cacheable on the storage when the tensor covers its
+  // whole storage and carries a version counter: in-place ops bump the
+  // counter, so the cache entry (keyed by counter identity and version)
+  // goes stale exactly when the bytes can have changed. Views and offset
+  // tensors are hashed from scratch since the storage-level cache cannot
+  // key on their windows.
+  const auto& storage = self.storage();
+  const auto& version_counter = self.unsafeGetTensorImpl()->version_counter();
+  const bool whole_storage = storage && self.is_contiguous() &&
+      self.storage_offset() == 0 &&
+      static_cast<size_t>(self.nbytes()) == storage.nbytes();
+  const bool cacheable = whole_storage && version_counter.enabled();
+
+  c10::optional<uint64_t> data_hash;
+  if (cacheable) {
+    data_hash = storage.unsafeGetStorageImpl()->read_content_hash(
+        version_counter.counter_id(), version_counter.current_version());
+  }
+  if (!data_hash) {
+    Tensor src = self;
+    if (!src.is_contiguous()) {
+      src = src.contiguous();
+    }
+    if (!src.device().is_cpu()) {
+      src = src.to(kCPU);
+    }
+    data_hash = hash_bytes(
+        static_cast<const uint8_t*>(src.data_ptr()), src.nbytes());
+    if (cacheable) {
+      storage.unsafeGetStorageImpl()->cache_content_hash(
+          version_counter.counter_id(),
+          version_counter.current_version(),
+          *data_hash);
+    }
+  }
+
+  // Fold in dtype and shape so equal bytes reinterpreted differently do not
+  // collide; this part is O(ndim) and never cached.
+  uint64_t h = mix64(*data_hash ^ static_cast<uint64_t>(self.scalar_type()));
+  for (auto size : self.sizes()) {
+    h = mix64(h ^ static_cast<uint64_t>(size));
+  }
+  // Keep the sign bit clear so the Python-visible value is stable across
+  // int64 round trips.
+  return static_cast<int64_t>(h >> 1);
+}
+
+} // namespace native
+} // namespace at
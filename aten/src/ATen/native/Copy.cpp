@@ -26,73 +26,54 @@ namespace {
 
 using namespace at;
 
+struct TransposedBatch {
+  int64_t batch;
+  int64_t rows;
+  int64_t cols;
+};
+
+// Detects whether src is, after collapsing adjacent contiguously-strided
+// dims, a transposed (column-major) matrix or a contiguous batch of them.
+// This is the access pattern pure permutations like NCHW <-> NHWC produce:
+// e.g. x.permute(0, 2, 3, 1) collapses to (N, H*W, C) with strides
+// (C*H*W, 1, H*W). Element (b, r, c) then lives at b * rows * cols +
+// r + c * rows.
+c10::optional<TransposedBatch> as_transposed_batch(const Tensor& src) {
+  c10::SmallVector<int64_t, 8> sizes(src.sizes().begin(), src.sizes().end());
+  c10::SmallVector<int64_t, 8> strides(
+      src.strides().begin(), src.strides().end());
+  size_t ndim = sizes.size();
+  size_t out = 0;
+  for (size_t i = 1; i < ndim; ++i) {
+    if (strides[out] == strides[i] * sizes[i]) {
+      sizes[out] *= sizes[i];
+      strides[out] = strides[i];
+    } else {
+      ++out;
+      sizes[out] = sizes[i];
+      strides[out] = strides[i];
+    }
+  }
+  ndim = out + 1;
+  if (ndim == 2 && strides[0] == 1 && strides[1] == sizes[0]) {
+    return TransposedBatch{1, sizes[0], sizes[1]};
+  }
+  if (ndim == 3 && strides[1] == 1 && strides[2] == sizes[1] &&
+      strides[0] == sizes[1] * sizes[2]) {
+    return TransposedBatch{sizes[0], sizes[1], sizes[2]};
+  }
+  return c10::nullopt;
+}
+
 bool copy_transpose_valid(const Tensor& self, const Tensor& src) {
   const int MIN_SZ = 60 * 60;
-  return self.is_contiguous() && src.numel() != 0 && src.dim() == 2 &&
-      src.stride(0) == 1 && src.stride(1) == src.size(0) &&
+  return self.is_contiguous() && src.numel() != 0 && src.dim() >= 2 &&
       self.scalar_type() == src.scalar_type() &&
       self.sizes().equals(src.sizes()) &&
       self.is_neg() == src.is_neg() &&
       self.is_conj() == src.is_conj() &&
-      self.numel() >= MIN_SZ;
-}
-
-// special case copy where tensor is contiguous and src is a transposed matrix
-// This can be generalized to most copies, but it's trickier
-void copy_same_type_transpose_(Tensor& self, const Tensor& src) {
-  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-  int64_t BLOCK_SZ;
-  if (self.scalar_type() == kByte) {
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    BLOCK_SZ = 120;
-  } else {
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    BLOCK_SZ = 60;
-  }
-  Tensor buf = empty({BLOCK_SZ, BLOCK_SZ}, self.options());
-
-  // The code below is implemented with the assumption that sizes are equal
-  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(self.sizes().equals(src.sizes()));
-
-  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(kHalf, kBool, kBFloat16, kComplexHalf, self.scalar_type(), "copy_", [&] {
-    scalar_t* sp = src.data_ptr<scalar_t>();
-    scalar_t* rp = self.data_ptr<scalar_t>();
-    scalar_t* bp = buf.data_ptr<scalar_t>();
-
-    int64_t NR = src.size(0);
-    int64_t NC = src.size(1);
-    for (int64_t R = 0; R < NR; R += BLOCK_SZ) {
-      for (int64_t C = 0; C < NC; C += BLOCK_SZ) {
-        scalar_t* spo = sp + R + C * NR;
-        scalar_t* rpo = rp + C + R * NC;
-
-        int nr = std::min(NR - R, BLOCK_SZ);
-        int nc = std::min(NC - C, BLOCK_SZ);
-
-        // 1. copy columns from src to buf
-        for (const auto c : c10::irange(nc)) {
-          memcpy(bp + c * BLOCK_SZ, spo + c * NR, nr * sizeof(scalar_t));
-        }
-
-        // 2. transpose buf in place
-        int rc_max = std::max(nr, nc);
-        int rc_min = std::min(nr, nc);
-        for (const auto r : c10::irange(rc_max)) {
-          int end = std::min(r, rc_min);
-          for (const auto c : c10::irange(end)) {
-            scalar_t tmp = bp[r + BLOCK_SZ * c];
-            bp[r + BLOCK_SZ * c] = bp[r * BLOCK_SZ + c];
-            bp[r * BLOCK_SZ + c] = tmp;
-          }
-        }
-
-        // 3. copy rows from buf to dst
-        for (const auto r : c10::irange(nr)) {
-          memcpy(rpo + r * NC, bp + r * BLOCK_SZ, nc * sizeof(scalar_t));
-        }
-      }
-    }
-  });
+      self.numel() >= MIN_SZ &&
+      as_transposed_batch(src).has_value();
 }
 
 // Devices directly supported by this copy implementation. Other device types
@@ -236,7 +217,9 @@ static Tensor & copy_impl(Tensor & self, const Tensor & src, bool non_blocking)
 
   // TODO: if we need to, we can also enable this path for quantized tensor
   if (device_type == kCPU && copy_transpose_valid(self, src) && !self.is_quantized()) {
-    copy_same_type_transpose_(self, src);
+    const auto batch = as_transposed_batch(src);
+    transpose_copy_stub(
+        kCPU, self, src, batch->batch, batch->rows, batch->cols);
     return self;
   }
 
@@ -304,6 +287,7 @@ void copy_ignoring_overlaps(const TensorBase &dst, const TensorBase &src) {
 }
 
 DEFINE_DISPATCH(copy_stub);
+DEFINE_DISPATCH(transpose_copy_stub);
 
 } // namespace native
 } // namespace at
@@ -14,6 +14,19 @@ using copy_fn = void (*)(TensorIterator&, bool non_blocking);
 
 DECLARE_DISPATCH(copy_fn, copy_stub);
 
+// Copies a batch of transposed (column-major) src matrices into a contiguous
+// self: src element (b, r, c) lives at b * rows * cols + r + c * rows and
+// lands at b * rows * cols + r * cols + c. See copy_transpose_valid in
+// Copy.cpp for the patterns that route here.
+using transpose_copy_fn = void (*)(
+    Tensor& /* self */,
+    const Tensor& /* src */,
+    int64_t /* batch */,
+    int64_t /* rows */,
+    int64_t /* cols */);
+
+DECLARE_DISPATCH(transpose_copy_fn, transpose_copy_stub);
+
 TORCH_API void copy_ignoring_overlaps(const TensorBase &dst, const TensorBase &src);
 
 } // namespace native
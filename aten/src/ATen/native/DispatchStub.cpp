@@ -20,6 +20,11 @@ static CPUCapability compute_cpu_capability() {
       return CPUCapability::ZVECTOR;
     }
 #else
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+    if (strcmp(envar, "avx512vnni") == 0) {
+      return CPUCapability::AVX512VNNI;
+    }
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
     if (strcmp(envar, "avx512") == 0) {
       return CPUCapability::AVX512;
@@ -39,6 +44,13 @@ static CPUCapability compute_cpu_capability() {
 
 #if !defined(__powerpc__) && !defined(__s390x__)
   if (cpuinfo_initialize()) {
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+    if (cpuinfo_has_x86_avx512vnni() && cpuinfo_has_x86_avx512vl() &&
+        cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() &&
+        cpuinfo_has_x86_fma3()) {
+      return CPUCapability::AVX512VNNI;
+    }
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
     // GCC supports some AVX512 intrinsics such as _mm512_set_epi16 only in
     // versions 9 & beyond. So, we want to ensure that only releases built with
@@ -73,6 +85,9 @@ CPUCapability get_cpu_capability() {
 void* DispatchStubImpl::get_call_ptr(
   DeviceType device_type
   , void *DEFAULT
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+  , void *AVX512VNNI
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
   , void *AVX512
 #endif
@@ -94,6 +109,9 @@ void* DispatchStubImpl::get_call_ptr(
       if (!fptr) {
         fptr = choose_cpu_impl(
           DEFAULT
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+          , AVX512VNNI
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
           , AVX512
 #endif
@@ -127,6 +145,9 @@ void* DispatchStubImpl::get_call_ptr(
 
 void* DispatchStubImpl::choose_cpu_impl(
   void *DEFAULT
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+  , void *AVX512VNNI
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
   , void *AVX512
 #endif
@@ -142,6 +163,22 @@ void* DispatchStubImpl::choose_cpu_impl(
 ) {
   auto capability = static_cast<int>(get_cpu_capability());
   (void)capability;
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+  if (capability >= static_cast<int>(CPUCapability::AVX512VNNI)) {
+    if (AVX512VNNI) {
+      return AVX512VNNI;
+    }
+    // dispatch to the plain AVX512 kernel (or below), since most stubs
+    // don't have a VNNI-specific kernel
+#ifdef HAVE_AVX512_CPU_DEFINITION
+    if (AVX512) {
+      return AVX512;
+    }
+#endif
+    TORCH_INTERNAL_ASSERT(AVX2, "DispatchStub: missing AVX2 kernel");
+    return AVX2;
+  }
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
   if (capability >= static_cast<int>(CPUCapability::AVX512)) {
     // Quantization kernels have also been disabled on Windows
@@ -54,6 +54,7 @@ enum class CPUCapability {
 #else
   AVX2 = 1,
   AVX512 = 2,
+  AVX512VNNI = 3,
 #endif
   NUM_OPTIONS
 };
@@ -73,6 +74,9 @@ struct TORCH_API DispatchStubImpl {
   void* get_call_ptr(
     DeviceType device_type
     , void *DEFAULT
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+      , void *AVX512VNNI
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
       , void *AVX512
 #endif
@@ -94,6 +98,9 @@ struct TORCH_API DispatchStubImpl {
    */
   void* choose_cpu_impl(
     void *DEFAULT
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+    , void *AVX512VNNI
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
     , void *AVX512
 #endif
@@ -134,6 +141,9 @@ private:
     return reinterpret_cast<FnPtr>(
       impl.get_call_ptr(device_type
       , reinterpret_cast<void*>(DEFAULT)
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+      , reinterpret_cast<void*>(AVX512VNNI)
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
       , reinterpret_cast<void*>(AVX512)
 #endif
@@ -166,6 +176,9 @@ public:
   }
 
   static TORCH_API FnPtr DEFAULT;
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+  static TORCH_API FnPtr AVX512VNNI;
+#endif
 #ifdef HAVE_AVX512_CPU_DEFINITION
   static TORCH_API FnPtr AVX512;
 #endif
@@ -223,6 +236,12 @@ struct RegisterHIPDispatch {
 #define REGISTER_AVX512_DISPATCH(name, fn)
 #endif
 
+#ifdef HAVE_AVX512VNNI_CPU_DEFINITION
+#define REGISTER_AVX512VNNI_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, AVX512VNNI, fn)
+#else
+#define REGISTER_AVX512VNNI_DISPATCH(name, fn)
+#endif
+
 #ifdef HAVE_AVX2_CPU_DEFINITION
 #define REGISTER_AVX2_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, AVX2, fn)
 #else
@@ -245,6 +264,7 @@ struct RegisterHIPDispatch {
 // if a kernel does not benefit from being recompiled across different arch types.
 #define REGISTER_ALL_CPU_DISPATCH(name, fn)                                    \
   REGISTER_ARCH_DISPATCH(name, DEFAULT, fn)                                    \
+  REGISTER_AVX512VNNI_DISPATCH(name, fn)                                       \
   REGISTER_AVX512_DISPATCH(name, fn)                                           \
   REGISTER_AVX2_DISPATCH(name, fn)                                             \
   REGISTER_VSX_DISPATCH(name, fn)                                              \
@@ -270,9 +290,17 @@ struct RegisterHIPDispatch {
 // #define REGISTER_DISPATCH(name, fn) REGISTER_HIP_DISPATCH(name, fn)
 #elif defined(CPU_CAPABILITY)
 #define REGISTER_DISPATCH(name, fn) REGISTER_ARCH_DISPATCH(name, CPU_CAPABILITY, fn)
+// Only registers the nullptr for the variant being compiled, so that the
+// AVX512 and AVX512VNNI translation units of a file don't both define the
+// same specialization.
+#if defined(CPU_CAPABILITY_AVX512VNNI)
+#define REGISTER_NO_AVX512_DISPATCH(name)       \
+  REGISTER_AVX512VNNI_DISPATCH(name, nullptr)
+#else
 #define REGISTER_NO_AVX512_DISPATCH(name)       \
   REGISTER_AVX512_DISPATCH(name, nullptr)
 #endif
+#endif
 
 
 }} // namespace at::native
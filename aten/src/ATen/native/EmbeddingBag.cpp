@@ -1,6 +1,7 @@
 #include <ATen/native/EmbeddingBag.h>
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/OpMathType.h>
 #include <ATen/Parallel.h>
 #include <ATen/TensorUtils.h>
 
@@ -1352,6 +1353,92 @@ static std::vector<index_t> compute_counts_uniq(
   return counts_uniq;
 }
 
+// Accumulates per-thread partial gradient shards over an unsorted slice of
+// the samples and merges them with a parallel reduction over rows. Unlike
+// the sorted path below, hot rows do not serialize: every thread owns a
+// full (num_weights x ddim) accumulator in opmath precision, so fp16/bf16
+// gradients are accumulated in fp32 and rounded once on the final merge.
+template <typename scalar_t, typename index_t>
+void _embedding_bag_dense_backward_cpu_sum_mean_sharded(
+    const Tensor& grad,
+    const Tensor& indices,
+    const Tensor& offset2bag,
+    const Tensor& bag_size_,
+    int64_t num_weights,
+    bool scale_grad_by_freq,
+    int64_t mode,
+    const Tensor& per_sample_weights,
+    Tensor& index_grad_weight,
+    int64_t padding_idx) {
+  using opmath_t = at::opmath_type<scalar_t>;
+
+  int64_t numel = indices.numel();
+  int64_t ddim = grad.size(1);
+  const int64_t num_threads = at::get_num_threads();
+
+  auto* indices_data = indices.data_ptr<index_t>();
+  auto* offset2bag_data = offset2bag.data_ptr<index_t>();
+  auto* bag_size_data = bag_size_.data_ptr<index_t>();
+  const scalar_t* grad_data = grad.data_ptr<scalar_t>();
+
+  const scalar_t* per_sample_weights_data = nullptr;
+  int64_t per_sample_weights_stride = 0;
+  if (per_sample_weights.defined()) {
+    per_sample_weights_data = per_sample_weights.data_ptr<scalar_t>();
+    per_sample_weights_stride = per_sample_weights.strides()[0];
+  }
+
+  auto counts = compute_counts(num_weights, indices_data, numel);
+
+  const int64_t shard_size = num_weights * ddim;
+  std::vector<opmath_t> shards(num_threads * shard_size, opmath_t(0));
+  opmath_t* shards_data = shards.data();
+
+  at::parallel_for(0, numel, 64, [&](int64_t begin, int64_t end) {
+    opmath_t* shard = shards_data + at::get_thread_num() * shard_size;
+    for (const auto i : c10::irange(begin, end)) {
+      index_t index = indices_data[i];
+      if (index == static_cast<index_t>(padding_idx)) {
+        continue;
+      }
+      index_t source = offset2bag_data[i];
+      double scale = 1.0;
+      if (per_sample_weights_data) {
+        AT_ASSERT(mode == MODE_SUM);
+        scale = per_sample_weights_data[per_sample_weights_stride * i];
+      }
+      if (scale_grad_by_freq) {
+        scale /= counts[index];
+      }
+      if (mode == MODE_MEAN) {
+        auto bag_size = bag_size_data[source];
+        if (bag_size != 0) {
+          scale /= bag_size;
+        }
+      }
+      const scalar_t* grad_row = grad_data + ddim * source;
+      opmath_t* shard_row = shard + ddim * index;
+      for (const auto d : c10::irange(ddim)) {
+        shard_row[d] +=
+            static_cast<opmath_t>(grad_row[d]) * static_cast<opmath_t>(scale);
+      }
+    }
+  });
+
+  scalar_t* index_grad_weight_data = index_grad_weight.data_ptr<scalar_t>();
+  at::parallel_for(0, num_weights, 64, [&](int64_t begin, int64_t end) {
+    for (const auto row : c10::irange(begin, end)) {
+      for (const auto d : c10::irange(ddim)) {
+        opmath_t acc = 0;
+        for (const auto t : c10::irange(num_threads)) {
+          acc += shards_data[t * shard_size + row * ddim + d];
+        }
+        index_grad_weight_data[row * ddim + d] = static_cast<scalar_t>(acc);
+      }
+    }
+  });
+}
+
 template <typename scalar_t>
 void _embedding_bag_dense_backward_cpu_sum_mean(
     const Tensor& grad,
@@ -1368,6 +1455,40 @@ void _embedding_bag_dense_backward_cpu_sum_mean(
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
   Tensor &offset2bag_ = const_cast<Tensor &>(offset2bag__);
 
+  {
+    using opmath_t = at::opmath_type<scalar_t>;
+    const int64_t numel = indices_.numel();
+    const int64_t ddim = grad.size(1);
+    const int64_t num_threads = at::get_num_threads();
+    // Memory budget for the per-thread accumulators of the sharded path
+    // (64M opmath elements, i.e. 256MB of fp32 across all threads).
+    constexpr int64_t kShardedAccumulatorBudget = int64_t(1) << 26;
+    const bool accumulates_in_higher_precision =
+        !std::is_same<scalar_t, opmath_t>::value;
+    if ((numel > 1000 || accumulates_in_higher_precision) &&
+        num_weights * ddim * num_threads <= kShardedAccumulatorBudget) {
+      AT_DISPATCH_INDEX_TYPES(
+          indices_.scalar_type(),
+          "_embedding_bag_dense_backward_cpu_sum_mean",
+          [&] {
+            _embedding_bag_dense_backward_cpu_sum_mean_sharded<
+                scalar_t,
+                index_t>(
+                grad,
+                indices_,
+                offset2bag_,
+                bag_size_,
+                num_weights,
+                scale_grad_by_freq,
+                mode,
+                per_sample_weights_,
+                index_grad_weight,
+                padding_idx);
+          });
+      return;
+    }
+  }
+
   auto ind_sort_ = indices_.sort();
   auto indices = std::get<0>(ind_sort_);
   auto ind_sort = std::get<1>(ind_sort_);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ATen/Parallel.h>
 #include <ATen/core/Tensor.h>
 #include <c10/util/irange.h>
 
@@ -133,5 +134,42 @@ bool can_use_fast_route(TensorList tensors1, TensorList tensors2, bool does_op_p
   return can_use_fast_route({tensors1, tensors2}, {}, does_op_promote_integer_inputs_to_float);
 }
 
+// Number of elements processed per multi_tensor_apply_cpu chunk. Matches
+// internal::GRAIN_SIZE so the flattened loop splits with the same
+// granularity as a single-tensor parallel_for.
+constexpr int64_t kMultiTensorApplyChunkSize = 32768;
+
+// CPU counterpart of the CUDA multi-tensor-apply harness: chunks every
+// tensor in `tensors` into kMultiTensorApplyChunkSize-element pieces and
+// runs `op` over the flattened chunk list in a single parallel_for, so a
+// long list of small parameter tensors shares one fork-join instead of
+// paying it per tensor, while large tensors still split across threads.
+//
+// `op` is called as op(tensor_index, begin, size) with element offsets into
+// tensors[tensor_index] and must only touch raw data pointers (it runs
+// inside a parallel region). Tensors are chunked by numel, so callers must
+// ensure the tensors they index with `tensor_index` (e.g. parallel lists of
+// optimizer states) are contiguous and of matching numel.
+template <typename F>
+void multi_tensor_apply_cpu(TensorList tensors, const F& op) {
+  struct Chunk {
+    size_t tensor_index;
+    int64_t begin;
+    int64_t size;
+  };
+  std::vector<Chunk> chunks;
+  for (const auto j : c10::irange(tensors.size())) {
+    const int64_t numel = tensors[j].numel();
+    for (int64_t begin = 0; begin < numel; begin += kMultiTensorApplyChunkSize) {
+      chunks.push_back({j, begin, std::min(kMultiTensorApplyChunkSize, numel - begin)});
+    }
+  }
+  at::parallel_for(0, chunks.size(), 1, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      op(chunks[i].tensor_index, chunks[i].begin, chunks[i].size);
+    }
+  });
+}
+
 }
 }} // at::native
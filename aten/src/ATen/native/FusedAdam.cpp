@@ -0,0 +1,125 @@
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/native/ForeachUtils.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+namespace {
+
+void check_fused_adam_inputs(TensorList params, TensorList others, const char* name) {
+  for (const auto i : c10::irange(params.size())) {
+    TORCH_CHECK(
+        others[i].is_contiguous(),
+        "_fused_adam_ requires contiguous ", name, " tensors");
+    TORCH_CHECK(
+        others[i].scalar_type() == params[i].scalar_type(),
+        "_fused_adam_ requires ", name, " to have the same dtype as the parameters, got ",
+        others[i].scalar_type(), " and ", params[i].scalar_type());
+    TORCH_CHECK(
+        others[i].sizes() == params[i].sizes(),
+        "_fused_adam_ requires ", name, " to have the same shape as the parameters, got ",
+        others[i].sizes(), " and ", params[i].sizes());
+  }
+}
+
+} // namespace
+
+// Horizontally fused Adam step. Unlike the unfused optimizer, which makes a
+// dozen `_foreach_*` passes over every parameter, this walks each parameter's
+// memory exactly once, updating exp_avg, exp_avg_sq and the parameter in the
+// same loop, and uses multi_tensor_apply_cpu so all parameters share a single
+// parallel region. The math is performed in opmath precision and matches the
+// eager-mode Adam update (including the decoupled bias correction via
+// step_size = lr / bias_correction1).
+void _fused_adam_kernel_cpu_(
+    TensorList self,
+    TensorList grads,
+    TensorList exp_avgs,
+    TensorList exp_avg_sqs,
+    TensorList max_exp_avg_sqs,
+    TensorList state_steps,
+    double lr,
+    double beta1,
+    double beta2,
+    double weight_decay,
+    double eps,
+    bool amsgrad,
+    bool maximize) {
+  check_foreach_api_restrictions(self, grads, exp_avgs);
+  check_foreach_api_restrictions(self, exp_avg_sqs, state_steps);
+  if (amsgrad) {
+    check_foreach_api_restrictions(self, max_exp_avg_sqs);
+  }
+  for (const auto i : c10::irange(self.size())) {
+    TORCH_CHECK(
+        self[i].is_contiguous(),
+        "_fused_adam_ requires contiguous parameter tensors");
+    TORCH_CHECK(
+        at::isFloatingType(self[i].scalar_type()),
+        "_fused_adam_ requires floating point parameters, got ",
+        self[i].scalar_type());
+  }
+  check_fused_adam_inputs(self, grads, "grad");
+  check_fused_adam_inputs(self, exp_avgs, "exp_avg");
+  check_fused_adam_inputs(self, exp_avg_sqs, "exp_avg_sq");
+  if (amsgrad) {
+    check_fused_adam_inputs(self, max_exp_avg_sqs, "max_exp_avg_sq");
+  }
+
+  // Advance the step counters and precompute the per-tensor bias corrections
+  // once, outside of the parallel region.
+  std::vector<double> step_sizes(self.size());
+  std::vector<double> bias_correction2_sqrts(self.size());
+  for (const auto i : c10::irange(self.size())) {
+    state_steps[i] += 1;
+    const auto step = state_steps[i].item<double>();
+    step_sizes[i] = lr / (1 - std::pow(beta1, step));
+    bias_correction2_sqrts[i] = std::sqrt(1 - std::pow(beta2, step));
+  }
+
+  multi_tensor_apply_cpu(self, [&](size_t i, int64_t begin, int64_t size) {
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        ScalarType::Half, ScalarType::BFloat16, self[i].scalar_type(), "_fused_adam_cpu_", [&] {
+      using opmath_t = at::opmath_type<scalar_t>;
+      scalar_t* param_ptr = self[i].data_ptr<scalar_t>() + begin;
+      const scalar_t* grad_ptr = grads[i].data_ptr<scalar_t>() + begin;
+      scalar_t* exp_avg_ptr = exp_avgs[i].data_ptr<scalar_t>() + begin;
+      scalar_t* exp_avg_sq_ptr = exp_avg_sqs[i].data_ptr<scalar_t>() + begin;
+      scalar_t* max_exp_avg_sq_ptr =
+          amsgrad ? max_exp_avg_sqs[i].data_ptr<scalar_t>() + begin : nullptr;
+      const opmath_t step_size = step_sizes[i];
+      const opmath_t bias_correction2_sqrt = bias_correction2_sqrts[i];
+
+      for (const auto k : c10::irange(size)) {
+        opmath_t grad = grad_ptr[k];
+        if (maximize) {
+          grad = -grad;
+        }
+        opmath_t param = param_ptr[k];
+        if (weight_decay != 0) {
+          grad += param * static_cast<opmath_t>(weight_decay);
+        }
+        const opmath_t exp_avg = static_cast<opmath_t>(beta1) * opmath_t(exp_avg_ptr[k]) +
+            (1 - static_cast<opmath_t>(beta1)) * grad;
+        const opmath_t exp_avg_sq = static_cast<opmath_t>(beta2) * opmath_t(exp_avg_sq_ptr[k]) +
+            (1 - static_cast<opmath_t>(beta2)) * grad * grad;
+        exp_avg_ptr[k] = exp_avg;
+        exp_avg_sq_ptr[k] = exp_avg_sq;
+        opmath_t denom_sq = exp_avg_sq;
+        if (amsgrad) {
+          denom_sq = std::max(opmath_t(max_exp_avg_sq_ptr[k]), exp_avg_sq);
+          max_exp_avg_sq_ptr[k] = denom_sq;
+        }
+        const opmath_t denom =
+            std::sqrt(denom_sq) / bias_correction2_sqrt + static_cast<opmath_t>(eps);
+        param_ptr[k] = param - step_size * exp_avg / denom;
+      }
+    });
+  });
+}
+
+}} // namespace at::native
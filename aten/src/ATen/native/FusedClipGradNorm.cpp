@@ -0,0 +1,137 @@
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/native/ForeachUtils.h>
+#include <c10/util/irange.h>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+// Fused gradient clipping. clip_grad_norm_ computes one norm per gradient
+// (thousands of small reductions for a large model) and combines them in
+// Python; here the whole epilogue is two multi-tensor passes:
+//
+//   1. _fused_clip_grad_sq_norm returns the norm_type-th power of the total
+//      norm (i.e. the squared L2 norm for the default norm_type=2) as a
+//      single 0-dim opmath tensor. The power of the norm, unlike the norm
+//      itself, is additive, so data-parallel callers can SUM-allreduce this
+//      scalar to obtain the global value.
+//   2. _fused_clip_grad_scale_ derives clip_coef = min(max_norm /
+//      (total_norm + 1e-6), 1) from that tensor and rescales every gradient
+//      in one fused pass. On CUDA the coefficient is computed on-device, so
+//      no synchronization is needed between the two passes.
+//
+// _fused_clip_grad_norm_ composes the two for the single-process case and
+// returns the total norm, matching clip_grad_norm_'s contract.
+
+namespace {
+
+void check_fused_clip_grad_inputs(TensorList grads, double norm_type) {
+  check_foreach_api_restrictions(grads);
+  TORCH_CHECK(
+      norm_type == 1.0 || norm_type == 2.0,
+      "_fused_clip_grad_norm_ supports only L1 and L2 norm, got norm_type=",
+      norm_type);
+  for (const auto i : c10::irange(grads.size())) {
+    TORCH_CHECK(
+        grads[i].is_contiguous(),
+        "_fused_clip_grad_norm_ requires contiguous gradient tensors");
+    TORCH_CHECK(
+        at::isFloatingType(grads[i].scalar_type()),
+        "_fused_clip_grad_norm_ requires floating point gradients, got ",
+        grads[i].scalar_type());
+    TORCH_CHECK(
+        grads[i].scalar_type() == grads[0].scalar_type(),
+        "_fused_clip_grad_norm_ requires all gradients to have the same dtype, got ",
+        grads[i].scalar_type(), " and ", grads[0].scalar_type());
+  }
+}
+
+} // namespace
+
+Tensor fused_clip_grad_sq_norm_cpu(TensorList grads, double norm_type) {
+  check_fused_clip_grad_inputs(grads, norm_type);
+
+  // One partial per multi_tensor_apply_cpu chunk. Chunk `begin` offsets are
+  // multiples of kMultiTensorApplyChunkSize, so chunk_offset[i] +
+  // begin / kMultiTensorApplyChunkSize numbers the chunks globally and the
+  // parallel region stays write-disjoint.
+  std::vector<int64_t> chunk_offset(grads.size());
+  int64_t num_chunks = 0;
+  for (const auto i : c10::irange(grads.size())) {
+    chunk_offset[i] = num_chunks;
+    num_chunks += (grads[i].numel() + kMultiTensorApplyChunkSize - 1) /
+        kMultiTensorApplyChunkSize;
+  }
+  std::vector<double> partials(num_chunks, 0.0);
+
+  multi_tensor_apply_cpu(grads, [&](size_t i, int64_t begin, int64_t size) {
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        ScalarType::Half, ScalarType::BFloat16, grads[i].scalar_type(), "_fused_clip_grad_sq_norm_cpu", [&] {
+      using opmath_t = at::opmath_type<scalar_t>;
+      const scalar_t* grad_ptr = grads[i].data_ptr<scalar_t>() + begin;
+      opmath_t val = 0;
+      if (norm_type == 1.0) {
+        for (const auto k : c10::irange(size)) {
+          val += std::abs(static_cast<opmath_t>(grad_ptr[k]));
+        }
+      } else {
+        for (const auto k : c10::irange(size)) {
+          const opmath_t g = grad_ptr[k];
+          val += g * g;
+        }
+      }
+      partials[chunk_offset[i] + begin / kMultiTensorApplyChunkSize] = val;
+    });
+  });
+
+  double total = 0;
+  for (const auto v : partials) {
+    total += v;
+  }
+  return at::scalar_tensor(
+      total, grads[0].options().dtype(toOpMathType(grads[0].scalar_type())));
+}
+
+void fused_clip_grad_scale_cpu_(
+    TensorList grads,
+    const Tensor& total_sq_norm,
+    double max_norm,
+    double norm_type) {
+  check_fused_clip_grad_inputs(grads, norm_type);
+  TORCH_CHECK(
+      total_sq_norm.numel() == 1,
+      "_fused_clip_grad_scale_ expects total_sq_norm to be a scalar tensor, got ",
+      total_sq_norm.numel(), " elements");
+  const double total_pow = total_sq_norm.item<double>();
+  const double total_norm = norm_type == 1.0 ? total_pow : std::sqrt(total_pow);
+  // Same coefficient as clip_grad_norm_, clamped at 1 so the behaviour is
+  // identical whether or not clipping kicks in.
+  const double clip_coef = std::min(max_norm / (total_norm + 1e-6), 1.0);
+  if (clip_coef == 1.0) {
+    // Unlike the CUDA kernel we already synchronized on item(), so the pass
+    // can be skipped entirely when no clipping is needed.
+    return;
+  }
+
+  multi_tensor_apply_cpu(grads, [&](size_t i, int64_t begin, int64_t size) {
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        ScalarType::Half, ScalarType::BFloat16, grads[i].scalar_type(), "_fused_clip_grad_scale_cpu", [&] {
+      using opmath_t = at::opmath_type<scalar_t>;
+      scalar_t* grad_ptr = grads[i].data_ptr<scalar_t>() + begin;
+      const opmath_t coef = static_cast<opmath_t>(clip_coef);
+      for (const auto k : c10::irange(size)) {
+        grad_ptr[k] = static_cast<opmath_t>(grad_ptr[k]) * coef;
+      }
+    });
+  });
+}
+
+Tensor fused_clip_grad_norm_(TensorList grads, double max_norm, double norm_type) {
+  auto total_pow = at::_fused_clip_grad_sq_norm(grads, norm_type);
+  at::_fused_clip_grad_scale_(grads, total_pow, max_norm, norm_type);
+  return norm_type == 1.0 ? total_pow : total_pow.sqrt();
+}
+
+}} // namespace at::native
@@ -48,9 +48,9 @@ namespace detail {
 namespace meta {
 
 #define ADDMM_META() \
-  TORCH_CHECK(mat1.dim() == 2, "mat1 must be a matrix, got ", mat1.dim(), "-D tensor"); \
-  TORCH_CHECK(mat2.dim() == 2, "mat2 must be a matrix, got ", mat2.dim(), "-D tensor"); \
-  TORCH_CHECK( \
+  TORCH_META_CHECK(mat1.dim() == 2, "mat1 must be a matrix, got ", mat1.dim(), "-D tensor"); \
+  TORCH_META_CHECK(mat2.dim() == 2, "mat2 must be a matrix, got ", mat2.dim(), "-D tensor"); \
+  TORCH_META_CHECK( \
       mat1.sizes()[1] == mat2.sizes()[0], "mat1 and mat2 shapes cannot be multiplied (", \
       mat1.sizes()[0], "x", mat1.sizes()[1], " and ", mat2.sizes()[0], "x", mat2.sizes()[1], ")"); \
  \
@@ -66,9 +66,9 @@ TORCH_META_FUNC(_addmm_activation)(const Tensor& self, const Tensor& mat1, const
 }
 
 TORCH_META_FUNC(mm)(const Tensor & self, const Tensor & mat2) {
-  TORCH_CHECK(self.dim() == 2, "self must be a matrix");
-  TORCH_CHECK(mat2.dim() == 2, "mat2 must be a matrix");
-  TORCH_CHECK(
+  TORCH_META_CHECK(self.dim() == 2, "self must be a matrix");
+  TORCH_META_CHECK(mat2.dim() == 2, "mat2 must be a matrix");
+  TORCH_META_CHECK(
       self.sizes()[1] == mat2.sizes()[0], "mat1 and mat2 shapes cannot be multiplied (",
       self.sizes()[0], "x", self.sizes()[1], " and ", mat2.sizes()[0], "x", mat2.sizes()[1], ")");
 
@@ -1646,6 +1646,92 @@ TORCH_IMPL_FUNC(bmm_out_cpu)
     }
 }
 
+// Multiplies each pair of matrices self[i] x other[i]. When every pair has
+// the same shape and contiguous row-major layout, all products are issued as
+// a single batched BLAS call (MKL's cblas batch API when available), which
+// amortizes the per-call dispatch and threading overhead that dominates for
+// groups of small matrices.
+std::vector<Tensor> _grouped_mm_cpu(TensorList self, TensorList other) {
+  TORCH_CHECK(self.size() == other.size(),
+      "_grouped_mm: expected self and other to contain the same number of tensors, but got ",
+      self.size(), " and ", other.size());
+  const size_t group_size = self.size();
+  std::vector<Tensor> results;
+  results.reserve(group_size);
+  if (group_size == 0) {
+    return results;
+  }
+
+  const auto dtype = self[0].scalar_type();
+  bool use_batched_gemm =
+      dtype == kFloat || dtype == kDouble ||
+      dtype == kComplexFloat || dtype == kComplexDouble;
+  for (const auto i : c10::irange(group_size)) {
+    const auto& mat1 = self[i];
+    const auto& mat2 = other[i];
+    TORCH_CHECK(mat1.dim() == 2 && mat2.dim() == 2,
+        "_grouped_mm: expected 2D tensors, but got ", mat1.dim(), "D and ", mat2.dim(),
+        "D tensors at position ", i);
+    TORCH_CHECK(mat1.sizes()[1] == mat2.sizes()[0],
+        "_grouped_mm: mat1 and mat2 shapes cannot be multiplied (",
+        mat1.sizes()[0], "x", mat1.sizes()[1], " and ",
+        mat2.sizes()[0], "x", mat2.sizes()[1], ") at position ", i);
+    TORCH_CHECK(mat1.scalar_type() == dtype && mat2.scalar_type() == dtype,
+        "_grouped_mm: expected all tensors to have dtype ", dtype, ", but got ",
+        mat1.scalar_type(), " and ", mat2.scalar_type(), " at position ", i);
+    use_batched_gemm = use_batched_gemm &&
+        mat1.sizes() == self[0].sizes() && mat2.sizes() == other[0].sizes() &&
+        mat1.is_contiguous() && mat2.is_contiguous() &&
+        !mat1.is_conj() && !mat2.is_conj() &&
+        mat1.numel() > 0 && mat2.numel() > 0;
+    results.push_back(at::empty({mat1.sizes()[0], mat2.sizes()[1]}, mat1.options()));
+  }
+
+  if (!use_batched_gemm) {
+    for (const auto i : c10::irange(group_size)) {
+      at::mm_out(results[i], self[i], other[i]);
+    }
+    return results;
+  }
+
+  // gemm expects fortran order matrices, so we swap argument order to
+  // transpose everything, as in baddbmm_with_gemm_ above.
+  const int64_t m = other[0].sizes()[1];
+  const int64_t n = self[0].sizes()[0];
+  const int64_t k = self[0].sizes()[1];
+  AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(dtype, "_grouped_mm", [&] {
+    std::vector<const scalar_t*> a(group_size);
+    std::vector<const scalar_t*> b(group_size);
+    std::vector<scalar_t*> c(group_size);
+    for (const auto i : c10::irange(group_size)) {
+      a[i] = other[i].data_ptr<scalar_t>();
+      b[i] = self[i].data_ptr<scalar_t>();
+      c[i] = results[i].data_ptr<scalar_t>();
+    }
+    at::native::cpublas::gemm_batched(
+        TransposeType::NoTranspose, TransposeType::NoTranspose,
+        group_size, m, n, k,
+        scalar_t(1),
+        a.data(), m,
+        b.data(), k,
+        scalar_t(0),
+        c.data(), m);
+  });
+  return results;
+}
+
+std::vector<Tensor> _grouped_mm_fallback(TensorList self, TensorList other) {
+  TORCH_CHECK(self.size() == other.size(),
+      "_grouped_mm: expected self and other to contain the same number of tensors, but got ",
+      self.size(), " and ", other.size());
+  std::vector<Tensor> results;
+  results.reserve(self.size());
+  for (const auto i : c10::irange(self.size())) {
+    results.push_back(at::mm(self[i], other[i]));
+  }
+  return results;
+}
+
 Tensor& dot_out(const Tensor& self, const Tensor& other, Tensor& result) {
   auto output_device = result.device();
   auto input1_device = self.device();
@@ -9,6 +9,24 @@ int64_t _debug_has_internal_overlap(const Tensor& self) {
   return static_cast<int64_t>(at::has_internal_overlap(self));
 }
 
+// Replicates a tensor's storage onto every NUMA node so that weight reads are
+// served from socket-local memory; see
+// c10::StorageImpl::replicate_across_numa_nodes for the contract (the tensor
+// must be treated as read-only afterwards). No-op on single-node systems and
+// non-NUMA builds.
+Tensor& _numa_replicate_(Tensor& self) {
+  TORCH_CHECK(
+      self.device().is_cpu(),
+      "_numa_replicate_ expects a CPU tensor, got ",
+      self.device());
+  self.storage().unsafeGetStorageImpl()->replicate_across_numa_nodes();
+  return self;
+}
+
+bool _is_numa_replicated(const Tensor& self) {
+  return self.storage().unsafeGetStorageImpl()->is_numa_replicated();
+}
+
 // Technically, we could force backends to explicitly say "no, we don't support
 // pinned memory, always return false", but this makes life a little easier when
 // you haven't loaded the backend extension at all (which can happen, e.g., on a
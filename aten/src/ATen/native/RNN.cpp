@@ -668,6 +668,15 @@ struct SimpleCell : Cell<Tensor, cell_params> {
   }
 };
 
+// The fused cell kernels bypass autograd, so they are only taken in inference
+// mode, and only for the contiguous float/double layouts they are written for.
+// Anything else falls through to the decomposed cell below.
+bool use_fused_cell_inference(const Tensor& gates, const Tensor& hx) {
+  return !GradMode::is_enabled() && hx.dim() == 2 && hx.is_contiguous() &&
+      gates.is_contiguous() && gates.scalar_type() == hx.scalar_type() &&
+      (hx.scalar_type() == kFloat || hx.scalar_type() == kDouble);
+}
+
 // TODO: can use inplace ops?
 template <typename cell_params>
 struct LSTMCell : Cell<std::tuple<Tensor, Tensor>, cell_params> {
@@ -695,6 +704,13 @@ struct LSTMCell : Cell<std::tuple<Tensor, Tensor>, cell_params> {
 
     const auto gates = params.linear_hh(hx).add_(
         pre_compute_input ? input : params.linear_ih(input));
+    if (use_fused_cell_inference(gates, cx)) {
+      auto hy = at::empty_like(cx);
+      auto cy = at::empty_like(cx);
+      fused_lstm_cell_inference_stub(kCPU, hy, cy, gates, cx);
+      hy = params.matmul_hr(hy);
+      return std::make_tuple(std::move(hy), std::move(cy));
+    }
     auto chunked_gates = gates.unsafe_chunk(4, 1);
     auto ingate = chunked_gates[0].sigmoid_();
     auto forgetgate = chunked_gates[1].sigmoid_();
@@ -726,10 +742,15 @@ struct GRUCell : Cell<Tensor, cell_params> {
       // Slice off the workspace argument (it's needed only for AD).
       return std::move(std::get<0>(result));
     }
-    const auto chunked_igates = pre_compute_input
-        ? input.unsafe_chunk(3, 1)
-        : params.linear_ih(input).unsafe_chunk(3, 1);
-    auto chunked_hgates = params.linear_hh(hidden).unsafe_chunk(3, 1);
+    const auto igates = pre_compute_input ? input : params.linear_ih(input);
+    auto hgates = params.linear_hh(hidden);
+    if (use_fused_cell_inference(igates, hidden) && hgates.is_contiguous()) {
+      auto hy = at::empty_like(hidden);
+      fused_gru_cell_inference_stub(kCPU, hy, igates, hgates, hidden);
+      return hy;
+    }
+    const auto chunked_igates = igates.unsafe_chunk(3, 1);
+    auto chunked_hgates = hgates.unsafe_chunk(3, 1);
     const auto reset_gate =
         chunked_hgates[0].add_(chunked_igates[0]).sigmoid_();
     const auto input_gate =
@@ -1133,6 +1154,9 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> _thnn_fused_lstm_cell_backwar
 // PUBLIC FUNCTIONS
 ////////////////////////////////////////////////////////////////////////////////
 
+DEFINE_DISPATCH(fused_lstm_cell_inference_stub);
+DEFINE_DISPATCH(fused_gru_cell_inference_stub);
+
 #define ONE_HIDDEN_RNN(NAME, CELL)                                          \
   DEFINE_DISPATCH(NAME##_cudnn_stub);                                       \
   DEFINE_DISPATCH(NAME##_miopen_stub);                                      \
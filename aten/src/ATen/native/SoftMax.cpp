@@ -551,6 +551,7 @@ DEFINE_DISPATCH(log_softmax_backward_lastdim_kernel);
 
 DEFINE_DISPATCH(softmax_kernel);
 DEFINE_DISPATCH(log_softmax_kernel);
+DEFINE_DISPATCH(padded_softmax_lastdim_kernel);
 
 Tensor softmax(const Tensor& self, Dimname dim, optional<ScalarType> dtype) {
   return at::softmax(self, dimname_to_position(self, dim), dtype);
@@ -588,6 +589,32 @@ Tensor masked_softmax_cpu(const Tensor& input_, const Tensor& mask_, const c10::
   return output;
 }
 
+// Softmax over the last dimension where batch element b only has
+// seq_lens[b] valid entries: attention scores with padding masks mask whole
+// row suffixes, so instead of a boolean mask per element the kernel reduces
+// just the valid prefix and zero-fills the tail. Rows whose length is <= 0
+// come back all zero. Inference only; supports float and double.
+Tensor padded_softmax_cpu(const Tensor& self, const Tensor& seq_lens) {
+  TORCH_CHECK(
+      self.dim() >= 2, "_padded_softmax: input must have at least 2 dimensions");
+  TORCH_CHECK(
+      seq_lens.scalar_type() == ScalarType::Long && seq_lens.dim() == 1,
+      "_padded_softmax: seq_lens should be a 1-D int64 tensor");
+  TORCH_CHECK(
+      seq_lens.numel() == self.size(0),
+      "_padded_softmax: expected one length per batch element, got ",
+      seq_lens.numel(),
+      " lengths for batch size ",
+      self.size(0));
+  auto input = self.contiguous();
+  auto lens = seq_lens.contiguous();
+  Tensor output = at::empty_like(input, input.options());
+  if (input.numel() > 0) {
+    padded_softmax_lastdim_kernel(kCPU, output, input, lens);
+  }
+  return output;
+}
+
 Tensor masked_softmax_backward_cpu(
     const Tensor& grad_,
     const Tensor& output_,
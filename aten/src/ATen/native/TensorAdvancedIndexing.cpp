@@ -424,6 +424,7 @@ DEFINE_DISPATCH(gather_stub);
 DEFINE_DISPATCH(scatter_stub);
 DEFINE_DISPATCH(scatter_fill_stub);
 DEFINE_DISPATCH(scatter_add_stub);
+DEFINE_DISPATCH(index_add_parallel_stub);
 DEFINE_DISPATCH(scatter_reduce_stub);
 DEFINE_DISPATCH(scatter_scalar_reduce_stub);
 DEFINE_DISPATCH(scatter_reduce_two_stub);
@@ -784,6 +785,23 @@ TORCH_IMPL_FUNC(index_add_cpu_out)
 
   auto index_contig = index.contiguous();
 
+  // Parallel deterministic fast path for the embedding-gradient layout
+  // (dim == 0, contiguous result/source): rows are divided into per-thread
+  // ranges and each row receives its updates in source order, so the result
+  // stays bitwise identical to the serial loop below while running on all
+  // threads. See index_add_parallel_cpu_kernel in cpu/ScatterGatherKernel.cpp.
+  if (dim == 0 && numel > 0 && result.dim() >= 1 && result.size(0) > 0 &&
+      result.is_contiguous() && source.is_contiguous() &&
+      source.dim() == result.dim() && source.size(0) == numel &&
+      result.scalar_type() == source.scalar_type() &&
+      (result.scalar_type() == ScalarType::Float ||
+       result.scalar_type() == ScalarType::Double) &&
+      at::get_num_threads() > 1 &&
+      source.numel() >= at::internal::GRAIN_SIZE) {
+    index_add_parallel_stub(kCPU, result, index_contig, source, alpha);
+    return;
+  }
+
   if (result.dim() > 1) {
     // Equivalent to:
     //   for (const auto i : c10::irange(numel)) {
@@ -1075,6 +1093,65 @@ Tensor & index_select_out_cpu_dim1_(
   return result_contig;
 }
 
+// How many indices ahead of the row currently being copied to issue
+// prefetches. Large enough to cover the copy of one row, small enough that
+// the prefetched lines are still resident when their row is reached.
+constexpr int64_t kIndexSelectRowPrefetchDistance = 8;
+
+static inline void prefetch_row(const char* ptr, int64_t row_bytes) {
+#if defined(__GNUC__)
+  for (int64_t b = 0; b < row_bytes; b += 64) {
+    __builtin_prefetch(ptr + b, /*rw=*/0, /*locality=*/1);
+  }
+#else
+  (void)ptr;
+  (void)row_bytes;
+#endif
+}
+
+// Row-gather fast path for embedding-style lookups: 2-D contiguous float
+// self indexed along dim 0. Output rows are gathered in parallel, and the
+// source rows of upcoming indices are prefetched while the current row is
+// being copied, so DRAM-resident tables keep several row fetches in flight.
+// AT_DISPATCH_INDEX_TYPES stamps a dedicated int32 variant, so 32-bit
+// indices are consumed directly instead of being widened to 64 bits first.
+static Tensor& index_select_out_cpu_dim0_rows_(
+    Tensor& result, const Tensor& self, const Tensor& index_contig) {
+  const int64_t num_rows = index_contig.numel();
+  const int64_t row_size = self.size(1);
+  const int64_t self_rows = self.size(0);
+  const int64_t row_bytes = row_size * static_cast<int64_t>(sizeof(float));
+  const float* src = self.data_ptr<float>();
+  float* dst = result.data_ptr<float>();
+
+  AT_DISPATCH_INDEX_TYPES(
+    index_contig.scalar_type(), "index_select_out_cpu_dim0_", [&]() {
+      const auto* idxs = index_contig.data_ptr<index_t>();
+      const int64_t grain_rows = std::max<int64_t>(
+          1, at::internal::GRAIN_SIZE / std::max<int64_t>(row_size, 1));
+      at::parallel_for(0, num_rows, grain_rows, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          const int64_t prefetch_i = i + kIndexSelectRowPrefetchDistance;
+          if (prefetch_i < num_rows) {
+            const auto prefetch_idx = idxs[prefetch_i];
+            // Out-of-range indices are diagnosed when their row is copied;
+            // just don't prefetch through them.
+            if (prefetch_idx >= 0 && prefetch_idx < self_rows) {
+              prefetch_row(
+                  reinterpret_cast<const char*>(src + prefetch_idx * row_size),
+                  row_bytes);
+            }
+          }
+          const auto self_i = idxs[i];
+          TORCH_CHECK_INDEX(
+              (self_i >= 0) && (self_i < self_rows), "index out of range in self");
+          memcpy(dst + i * row_size, src + self_i * row_size, row_bytes);
+        }
+      });
+    });
+  return result;
+}
+
 Tensor & index_select_out_cpu_(const Tensor & self, int64_t dim, const Tensor & index, Tensor & result) {
   if (self.is_quantized()) {
     TORCH_CHECK(
@@ -1121,6 +1198,13 @@ Tensor & index_select_out_cpu_(const Tensor & self, int64_t dim, const Tensor &
       return index_select_out_cpu_dim1_(result, self, index_contig);
     }
 
+    if (dim == 0 && self.dim() == 2 &&
+        self.scalar_type() == ScalarType::Float && !self.is_quantized() &&
+        self.is_contiguous() && result.is_contiguous()) {
+      // embedding-row gather fast pass
+      return index_select_out_cpu_dim0_rows_(result, self, index_contig);
+    }
+
     auto selfSlice = self.select(dim, 0);
     auto resultSlice = result.select(dim, 0);
     auto selfSlice_data = selfSlice.data_ptr();
@@ -1642,16 +1726,6 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   std::tie(_mask, _self) = expand_outplace(mask, self);
 
   auto shape = _self->sizes();
-  int64_t numel = _mask->sum().item().toLong();
-  at::native::resize_output(result, {numel});
-  if (numel == 0) {
-    return result;
-  }
-
-  // Create strided view of result before feeding into TensorIterator
-  auto strides = DimVector(shape.size(), 0);
-  auto orig_stride = result.strides()[0];
-  auto result_strided = result.as_strided(shape, strides);
 
   // serial kernel
   // serial kernel requires that src is traversed in its logical order. However, TensorIterator might
@@ -1661,6 +1735,17 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   bool use_serial_kernel = (self.numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ) &&
   _self->is_contiguous() && _mask->is_contiguous();
   if (use_serial_kernel) {
+    int64_t numel = _mask->sum().item().toLong();
+    at::native::resize_output(result, {numel});
+    if (numel == 0) {
+      return result;
+    }
+
+    // Create strided view of result before feeding into TensorIterator
+    auto strides = DimVector(shape.size(), 0);
+    auto orig_stride = result.strides()[0];
+    auto result_strided = result.as_strided(shape, strides);
+
     auto iter = TensorIteratorConfig()
       .set_check_mem_overlap(false)  // result is intenionally zero-strided above
       .check_all_same_dtype(false)
@@ -1675,15 +1760,87 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   }
 
   // Use a prefix sum to record the output locations of the masked elements,
-  // so as to parallel with TensorIterator.
-  auto mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
+  // so as to parallel with TensorIterator. The prefix sum is built with a
+  // parallel two-pass count-then-fill over fixed chunks: pass 1 counts the
+  // set elements of each chunk (a trivially vectorized loop), the chunk
+  // counts are scanned to get per-chunk output offsets (this also yields the
+  // output length, replacing the separate mask.sum() reduction), and pass 2
+  // writes each chunk's local inclusive prefix sum shifted by its offset.
+  const int64_t mask_numel = _mask->numel();
+  // A contiguous bool mask is counted in place; anything else (byte masks,
+  // broadcast or permuted masks) is first normalized into a contiguous long
+  // tensor so both passes can walk it linearly in logical order.
+  const bool* mask_bool_data =
+      (_mask->is_contiguous() && _mask->scalar_type() == ScalarType::Bool)
+      ? _mask->data_ptr<bool>()
+      : nullptr;
+  Tensor mask_long;
+  const int64_t* mask_long_data = nullptr;
+  if (!mask_bool_data) {
+    mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
+    mask_long_data = mask_long.data_ptr<int64_t>();
+  }
+
+  const int64_t chunk_size = at::internal::GRAIN_SIZE;
+  const int64_t num_chunks = (mask_numel + chunk_size - 1) / chunk_size;
+  std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+
+  // Pass 1: count set elements per chunk
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    for (const auto chunk : c10::irange(chunk_begin, chunk_end)) {
+      const int64_t begin = chunk * chunk_size;
+      const int64_t end = std::min(begin + chunk_size, mask_numel);
+      int64_t count = 0;
+      if (mask_bool_data) {
+        for (const auto i : c10::irange(begin, end)) {
+          count += mask_bool_data[i] ? 1 : 0;
+        }
+      } else {
+        for (const auto i : c10::irange(begin, end)) {
+          count += mask_long_data[i] != 0 ? 1 : 0;
+        }
+      }
+      chunk_offsets[chunk + 1] = count;
+    }
+  });
+
+  // Scan chunk counts into chunk output offsets
+  for (const auto chunk : c10::irange(1, num_chunks + 1)) {
+    chunk_offsets[chunk] += chunk_offsets[chunk - 1];
+  }
+
+  const int64_t numel = chunk_offsets[num_chunks];
+  at::native::resize_output(result, {numel});
+  if (numel == 0) {
+    return result;
+  }
+
+  // Create strided view of result before feeding into TensorIterator
+  auto strides = DimVector(shape.size(), 0);
+  auto orig_stride = result.strides()[0];
+  auto result_strided = result.as_strided(shape, strides);
+
+  // Pass 2: fill the inclusive prefix sum chunk by chunk
   auto mask_prefix_sum = at::empty(shape, self.options().dtype(at::kLong));
-  auto mask_long_data = mask_long.data_ptr<int64_t>();
   auto mask_prefix_sum_data = mask_prefix_sum.data_ptr<int64_t>();
-  // TODO: Here can only use std::partial_sum for C++14,
-  // use std::exclusive_scan when PyTorch upgrades to C++17, which have better peformance.
-  // std::exclusive_scan(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data, 0);
-  std::partial_sum(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    for (const auto chunk : c10::irange(chunk_begin, chunk_end)) {
+      const int64_t begin = chunk * chunk_size;
+      const int64_t end = std::min(begin + chunk_size, mask_numel);
+      int64_t running = chunk_offsets[chunk];
+      if (mask_bool_data) {
+        for (const auto i : c10::irange(begin, end)) {
+          running += mask_bool_data[i] ? 1 : 0;
+          mask_prefix_sum_data[i] = running;
+        }
+      } else {
+        for (const auto i : c10::irange(begin, end)) {
+          running += mask_long_data[i] != 0 ? 1 : 0;
+          mask_prefix_sum_data[i] = running;
+        }
+      }
+    }
+  });
 
   auto iter = TensorIteratorConfig()
     .set_check_mem_overlap(false)  // result is intenionally zero-strided above
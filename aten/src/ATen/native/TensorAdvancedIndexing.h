@@ -26,6 +26,8 @@ using scatter_scalar_reduce_fn = void(*)(const Tensor& self, const int64_t dim,
                                          const Scalar& value, const SCATTER_GATHER_OP& reduce);
 using scatter_reduce_two_fn = void(*)(const Tensor& self, const int64_t dim, const Tensor& index,
                                       const Tensor& src, const SCATTER_GATHER_OP& reduce);
+using index_add_parallel_fn = void(*)(const Tensor& result, const Tensor& index,
+                                      const Tensor& source, const Scalar& alpha);
 
 DECLARE_DISPATCH(index_put_with_sort_fn, index_put_with_sort_stub);
 
@@ -36,6 +38,7 @@ DECLARE_DISPATCH(scatter_add_fn, scatter_add_stub);
 DECLARE_DISPATCH(scatter_reduce_fn, scatter_reduce_stub);
 DECLARE_DISPATCH(scatter_scalar_reduce_fn, scatter_scalar_reduce_stub);
 DECLARE_DISPATCH(scatter_reduce_two_fn, scatter_reduce_two_stub);
+DECLARE_DISPATCH(index_add_parallel_fn, index_add_parallel_stub);
 
 TORCH_API Tensor& index_out(Tensor& result, const Tensor & self, const c10::List<c10::optional<at::Tensor>>& indices);
 
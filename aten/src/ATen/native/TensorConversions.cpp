@@ -213,6 +213,10 @@ Tensor _autocast_to_reduced_precision(const Tensor& self, bool cuda_enabled, boo
 
     TORCH_INTERNAL_ASSERT(target != at::ScalarType::Undefined, "_autocast_to_reduced_precision requires legit ScalarType argument for given device");
 
+    // Do not go through the eager autocast cache here: scripted code never
+    // reaches the cache clear point in autocast.__exit__ (it is a no-op under
+    // scripting), so a cached copy would both leak and go stale once the
+    // optimizer updates the parameter in place.
     return to_impl(
         self, target, c10::nullopt, c10::nullopt, c10::nullopt, false, false, c10::nullopt);
   } else {
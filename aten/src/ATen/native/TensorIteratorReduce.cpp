@@ -21,7 +21,7 @@ static void parallel_dim_reduction(TensorIteratorBase& iter, loop2d_t loop);
 void TensorIteratorBase::parallel_reduce(loop2d_t loop) {
   TORCH_CHECK(ntensors() == 2, "parallel_reduce only supports one input and one output");
   int64_t numel = this->numel();
-  if (numel < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ||
+  if (numel < suggested_grain_size() || at::get_num_threads() == 1 ||
       at::in_parallel_region()) {
     serial_for_each(loop, {0, numel});
   } else if (use_two_pass_reduction(*this)) {
@@ -51,7 +51,7 @@ static void two_pass_reduction(TensorIteratorBase& iter, loop2d_t loop) {
   auto first_reduce = TensorIterator::reduce_op(buffer_0, iter.input(0));
   TORCH_INTERNAL_ASSERT(first_reduce.output(0).is_alias_of(buffer_0));
 
-  at::parallel_for(0, iter.numel(), internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+  at::parallel_for(0, iter.numel(), iter.suggested_grain_size(), [&](int64_t begin, int64_t end) {
     const auto thread_num = at::get_thread_num();
     auto shape = first_reduce.shape();
     auto strides = first_reduce.get_strides();
@@ -132,7 +132,7 @@ void TensorIteratorBase::foreach_reduced_elt(loop_subiter_t loop, bool paralleli
   if (output(0).numel() == 1) {
     loop(*this);
   }
-  else if (numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ||
+  else if (numel() < suggested_grain_size() || at::get_num_threads() == 1 ||
       at::in_parallel_region() || !parallelize) {
     auto reduce_dims = num_reduce_dims();
 
@@ -1,6 +1,11 @@
 #pragma once
 #include <ATen/core/TensorAccessor.h>
 #include <ATen/NumericUtils.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/cpu/vec/functional.h>
+#include <c10/util/Exception.h>
+#include <array>
+#include <limits>
 
 namespace at {
 namespace native {
@@ -11,6 +16,119 @@ inline namespace CPU_CAPABILITY {
 inline namespace DEFAULT {
 #endif
 
+// Largest k for which the register-resident selection path below is used.
+// The selection buffer is shifted on every accepted candidate, so the cost
+// per hit is O(k); past ~32 the partial_sort path wins.
+constexpr int64_t kSmallTopKMaxK = 32;
+
+// Selects the top k of a contiguous row in one streaming pass. The k current
+// winners live in a small sorted buffer (best first, so buffer[k - 1] is the
+// selection threshold); each vector lane block is reduced to its extremum and
+// compared against the threshold, so blocks with no candidate - the common
+// case once the buffer warms up - cost one load and a horizontal reduce.
+// Indices are tracked as int32 to halve the buffer footprint and widened on
+// writeback (callers guarantee dim_size fits). NaN ordering follows the
+// comparators in topk_impl_loop.
+template <typename scalar_t,
+          typename std::enable_if<std::is_floating_point<scalar_t>::value, int>::type = 0>
+void topk_small_k_row(
+    const scalar_t* row,
+    const int64_t dim_size,
+    const int64_t k,
+    const bool largest,
+    scalar_t* out_values,
+    int32_t* out_indices) {
+  using Vec = vec::Vectorized<scalar_t>;
+  auto better = [largest](scalar_t x, scalar_t y) -> bool {
+    if (largest) {
+      return (_isnan<scalar_t>(x) && !_isnan<scalar_t>(y)) || x > y;
+    }
+    return (!_isnan<scalar_t>(x) && _isnan<scalar_t>(y)) || x < y;
+  };
+  auto insert = [&](scalar_t val, int64_t idx, int64_t bound) {
+    int64_t pos = bound;
+    while (pos > 0 && better(val, out_values[pos - 1])) {
+      out_values[pos] = out_values[pos - 1];
+      out_indices[pos] = out_indices[pos - 1];
+      --pos;
+    }
+    out_values[pos] = val;
+    out_indices[pos] = static_cast<int32_t>(idx);
+  };
+
+  // Warm up the buffer with the first k elements.
+  for (const auto j : c10::irange(k)) {
+    insert(row[j], j, j);
+  }
+
+  scalar_t thresh = out_values[k - 1];
+  int64_t j = k;
+  for (; j + Vec::size() <= dim_size; j += Vec::size()) {
+    Vec block = Vec::loadu(row + j);
+    scalar_t extremum;
+    bool scan;
+    if (largest) {
+      extremum = vec::vec_reduce_all<scalar_t>(
+          [](Vec& x, Vec& y) { return vec::maximum(x, y); }, block, Vec::size());
+      // maximum() propagates NaN, and NaN sorts above everything here, so
+      // better() alone covers both the value and the NaN case.
+      scan = better(extremum, thresh);
+    } else {
+      extremum = vec::vec_reduce_all<scalar_t>(
+          [](Vec& x, Vec& y) { return vec::minimum(x, y); }, block, Vec::size());
+      // A propagated NaN hides any small lanes next to it, so scan those
+      // blocks too; the scalar comparator sorts it out.
+      scan = better(extremum, thresh) || _isnan<scalar_t>(extremum);
+    }
+    if (C10_LIKELY(!scan)) {
+      continue;
+    }
+    for (const auto lane : c10::irange(Vec::size())) {
+      scalar_t val = row[j + lane];
+      if (better(val, thresh)) {
+        insert(val, j + lane, k - 1);
+        thresh = out_values[k - 1];
+      }
+    }
+  }
+  for (; j < dim_size; ++j) {
+    scalar_t val = row[j];
+    if (better(val, thresh)) {
+      insert(val, j, k - 1);
+      thresh = out_values[k - 1];
+    }
+  }
+}
+
+// Non-floating-point instantiation so the call site below compiles for every
+// dispatched dtype; never taken because topk_small_k_viable() is false.
+template <typename scalar_t,
+          typename std::enable_if<!std::is_floating_point<scalar_t>::value, int>::type = 0>
+void topk_small_k_row(
+    const scalar_t* /*row*/,
+    const int64_t /*dim_size*/,
+    const int64_t /*k*/,
+    const bool /*largest*/,
+    scalar_t* /*out_values*/,
+    int32_t* /*out_indices*/) {
+  TORCH_INTERNAL_ASSERT(false, "topk_small_k_row called for non-float dtype");
+}
+
+template <typename scalar_t, typename accscalar_t>
+inline bool topk_small_k_viable(
+    const int64_t k,
+    const int64_t dim_size,
+    const int64_t tmp_values_stride) {
+  // Restricted to dtypes with usable Vectorized compares and no conversion
+  // on load (BFloat16 accumulates in float and takes the generic path).
+  return std::is_floating_point<scalar_t>::value &&
+      std::is_same<scalar_t, accscalar_t>::value &&
+      k > 0 && k <= kSmallTopKMaxK &&
+      tmp_values_stride == 1 &&
+      dim_size >= 4 * k &&
+      dim_size <= std::numeric_limits<int32_t>::max();
+}
+
 // Core topk loop, shared between CPU and QuantizedCPU
 template <typename scalar_t, typename accscalar_t>
 void topk_impl_loop(
@@ -23,6 +141,29 @@ void topk_impl_loop(
     const bool sorted,
     char** data, const int64_t* strides, const int64_t n) {
 
+  if (topk_small_k_viable<scalar_t, accscalar_t>(k, dim_size, tmp_values_stride)) {
+    // The buffer comes out sorted by construction, so `sorted` is satisfied
+    // either way.
+    std::array<scalar_t, kSmallTopKMaxK> vals_buf;
+    std::array<int32_t, kSmallTopKMaxK> idx_buf;
+    for (const auto i : c10::irange(n)) {
+      TensorAccessor<scalar_t, 1> mode_values(
+          reinterpret_cast<scalar_t*>(data[0] + i * strides[0]),
+          &k, &mode_values_stride);
+      TensorAccessor<int64_t, 1> mode_indices(
+          reinterpret_cast<int64_t*>(data[1] + i * strides[1]),
+          &k, &mode_indices_stride);
+      topk_small_k_row(
+          reinterpret_cast<const scalar_t*>(data[2] + i * strides[2]),
+          dim_size, k, largest, vals_buf.data(), idx_buf.data());
+      for (const auto j : c10::irange(k)) {
+        mode_values[j] = vals_buf[j];
+        mode_indices[j] = idx_buf[j];
+      }
+    }
+    return;
+  }
+
   using elem_t = std::pair<accscalar_t, int64_t>;
   std::vector<elem_t> queue(dim_size);
   for (const auto i : c10::irange(n)) {
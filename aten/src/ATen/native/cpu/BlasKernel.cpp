@@ -3,6 +3,14 @@
 #include <ATen/native/CPUBlas.h>
 #include <c10/util/irange.h>
 
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#if defined(CPU_CAPABILITY_AVX512VNNI)
+#include <immintrin.h>
+#endif
+
 namespace at {
 namespace native {
 namespace cpublas {
@@ -60,6 +68,158 @@ void gemm_notrans_(
   }
 }
 
+// Small-M path. For the skinny products attention projections generate
+// (m <= 8, large n and k), register blocking choice dominates: holding an
+// M x NR tile of c in registers reuses each loaded a-column NR times. The
+// best NR depends on the CPU (register file, FMA latency), so it is
+// autotuned once per (type, M) at first use and cached.
+constexpr int64_t kSmallMThreshold = 8;
+
+// Accumulates alpha * (a @ b) into c for compile-time M, walking NR
+// columns of c at a time. Scaling of c by beta happens in the caller.
+template <typename scalar_t, int M, int NR>
+void gemm_notrans_small_m_kernel(
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    scalar_t *c, int64_t ldc) {
+  int64_t j = 0;
+  for (; j + NR <= n; j += NR) {
+    scalar_t acc[NR][M] = {};
+    for (const auto l : c10::irange(k)) {
+      scalar_t a_col[M];
+      for (int i = 0; i < M; i++) {
+        a_col[i] = a[i + l * lda];
+      }
+      for (int jj = 0; jj < NR; jj++) {
+        const scalar_t val = b[l + (j + jj) * ldb] * alpha;
+        for (int i = 0; i < M; i++) {
+          acc[jj][i] += a_col[i] * val;
+        }
+      }
+    }
+    for (int jj = 0; jj < NR; jj++) {
+      for (int i = 0; i < M; i++) {
+        c[(j + jj) * ldc + i] += acc[jj][i];
+      }
+    }
+  }
+  for (; j < n; j++) {
+    scalar_t acc[M] = {};
+    for (const auto l : c10::irange(k)) {
+      const scalar_t val = b[l + j * ldb] * alpha;
+      for (int i = 0; i < M; i++) {
+        acc[i] += a[i + l * lda] * val;
+      }
+    }
+    for (int i = 0; i < M; i++) {
+      c[j * ldc + i] += acc[i];
+    }
+  }
+}
+
+template <typename scalar_t>
+using small_m_kernel_fn = void (*)(
+    int64_t, int64_t, scalar_t, const scalar_t*, int64_t,
+    const scalar_t*, int64_t, scalar_t*, int64_t);
+
+// Times each NR candidate on a synthetic skinny problem and returns the
+// fastest. Runs once per (type, M); a few microseconds of tuning against
+// every subsequent small-M gemm in the process.
+template <typename scalar_t, int M>
+small_m_kernel_fn<scalar_t> tune_small_m_kernel() {
+  constexpr small_m_kernel_fn<scalar_t> candidates[] = {
+      gemm_notrans_small_m_kernel<scalar_t, M, 1>,
+      gemm_notrans_small_m_kernel<scalar_t, M, 2>,
+      gemm_notrans_small_m_kernel<scalar_t, M, 4>,
+      gemm_notrans_small_m_kernel<scalar_t, M, 8>,
+  };
+  constexpr int64_t n = 48;
+  constexpr int64_t k = 64;
+  std::vector<scalar_t> a(M * k, scalar_t(1));
+  std::vector<scalar_t> b(k * n, scalar_t(1));
+  std::vector<scalar_t> c(M * n, scalar_t(0));
+
+  small_m_kernel_fn<scalar_t> best = candidates[0];
+  auto best_time = std::chrono::steady_clock::duration::max();
+  for (auto candidate : candidates) {
+    // warm up icache and branch predictors before the timed runs
+    candidate(n, k, scalar_t(1), a.data(), M, b.data(), k, c.data(), M);
+    auto candidate_time = std::chrono::steady_clock::duration::max();
+    for (const auto rep : c10::irange(3)) {
+      (void)rep;
+      const auto start = std::chrono::steady_clock::now();
+      candidate(n, k, scalar_t(1), a.data(), M, b.data(), k, c.data(), M);
+      candidate_time =
+          std::min(candidate_time, std::chrono::steady_clock::now() - start);
+    }
+    if (candidate_time < best_time) {
+      best_time = candidate_time;
+      best = candidate;
+    }
+  }
+  return best;
+}
+
+template <typename scalar_t, int M>
+void gemm_notrans_small_m_fixed_(
+    int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    scalar_t beta,
+    scalar_t *c, int64_t ldc) {
+  static std::atomic<small_m_kernel_fn<scalar_t>> cached{nullptr};
+  auto kernel = cached.load(std::memory_order_relaxed);
+  if (kernel == nullptr) {
+    // racing threads tune redundantly but agree on a deterministic-enough
+    // winner; last store wins and all candidates are correct
+    kernel = tune_small_m_kernel<scalar_t, M>();
+    cached.store(kernel, std::memory_order_relaxed);
+  }
+  scale_(M, n, beta, c, ldc);
+  kernel(n, k, alpha, a, lda, b, ldb, c, ldc);
+}
+
+template <typename scalar_t>
+void gemm_notrans_small_m_(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t alpha,
+    const scalar_t *a, int64_t lda,
+    const scalar_t *b, int64_t ldb,
+    scalar_t beta,
+    scalar_t *c, int64_t ldc) {
+  switch (m) {
+    case 1:
+      return gemm_notrans_small_m_fixed_<scalar_t, 1>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 2:
+      return gemm_notrans_small_m_fixed_<scalar_t, 2>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 3:
+      return gemm_notrans_small_m_fixed_<scalar_t, 3>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 4:
+      return gemm_notrans_small_m_fixed_<scalar_t, 4>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 5:
+      return gemm_notrans_small_m_fixed_<scalar_t, 5>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 6:
+      return gemm_notrans_small_m_fixed_<scalar_t, 6>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 7:
+      return gemm_notrans_small_m_fixed_<scalar_t, 7>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    case 8:
+      return gemm_notrans_small_m_fixed_<scalar_t, 8>(
+          n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    default:
+      TORCH_INTERNAL_ASSERT(false, "unexpected m for small-M gemm: ", m);
+  }
+}
+
 template <typename scalar_t>
 void gemm_transa_(
     int64_t m, int64_t n, int64_t k,
@@ -87,6 +247,62 @@ void gemm_transa_(
   }
 }
 
+#if defined(CPU_CAPABILITY_AVX512VNNI)
+// int8 overload of gemm_transa_: the dot products map directly onto
+// vpdpbusd, which accumulates four u8*s8 products per lane into int32.
+// The instruction wants an unsigned left operand, so a is biased by 128
+// (a ^ 0x80) and the bias compensated by subtracting 128 * sum(b) from
+// each dot product. Everything downstream of the products wraps modulo
+// 2^32 and the final store truncates to int8, which is congruent to the
+// scalar path's per-step int8 wraparound, so results are bit-identical.
+void gemm_transa_(
+    int64_t m, int64_t n, int64_t k,
+    int8_t alpha,
+    const int8_t *a, int64_t lda,
+    const int8_t *b, int64_t ldb,
+    int8_t beta,
+    int8_t *c, int64_t ldc) {
+  // c = alpha * (a.T @ b) + beta * c
+  const __m512i bias = _mm512_set1_epi8(static_cast<char>(0x80));
+  for (const auto j : c10::irange(n)) {
+    const int8_t *b_ = b + j * ldb;
+    uint32_t sum_b = 0;
+    for (const auto l : c10::irange(k)) {
+      sum_b += static_cast<uint32_t>(static_cast<int32_t>(b_[l]));
+    }
+    const uint32_t comp = 128u * sum_b;
+    for (const auto i : c10::irange(m)) {
+      const int8_t *a_ = a + i * lda;
+      __m512i acc = _mm512_setzero_si512();
+      int64_t l = 0;
+      for (; l + 64 <= k; l += 64) {
+        const __m512i va = _mm512_xor_si512(
+            _mm512_loadu_si512(reinterpret_cast<const void*>(a_ + l)), bias);
+        const __m512i vb =
+            _mm512_loadu_si512(reinterpret_cast<const void*>(b_ + l));
+        acc = _mm512_dpbusd_epi32(acc, va, vb);
+      }
+      uint32_t sum = static_cast<uint32_t>(_mm512_reduce_add_epi32(acc));
+      for (; l < k; l++) {
+        sum += static_cast<uint32_t>(static_cast<uint8_t>(a_[l] ^ 0x80)) *
+            static_cast<uint32_t>(static_cast<int32_t>(b_[l]));
+      }
+      sum -= comp;
+      const uint32_t scaled =
+          static_cast<uint32_t>(static_cast<int32_t>(alpha)) * sum;
+      if (beta == int8_t(0)) {
+        c[j * ldc + i] = static_cast<int8_t>(scaled);
+      } else {
+        c[j * ldc + i] = static_cast<int8_t>(
+            static_cast<uint32_t>(static_cast<int32_t>(beta)) *
+                static_cast<uint32_t>(static_cast<int32_t>(c[j * ldc + i])) +
+            scaled);
+      }
+    }
+  }
+}
+#endif // CPU_CAPABILITY_AVX512VNNI
+
 template <typename scalar_t>
 void gemm_transb_(
     int64_t m, int64_t n, int64_t k,
@@ -158,6 +374,9 @@ void gemm_core_(
     scalar_t beta,
     scalar_t *c, int64_t ldc) {
   if(transa == TransposeType::NoTranspose && transb == TransposeType::NoTranspose) {
+    if (m >= 1 && m <= kSmallMThreshold) {
+      return gemm_notrans_small_m_(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
     return gemm_notrans_(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
   } else if(transa == TransposeType::Transpose && transb != TransposeType::Transpose) {
     gemm_transa_(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
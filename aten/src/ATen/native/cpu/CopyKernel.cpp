@@ -1,5 +1,6 @@
 #define TORCH_ASSERT_NO_OPERATORS
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
@@ -72,6 +73,157 @@ void copy_same_dtype(TensorIteratorBase &iter, bool requires_conj, bool requires
   }
 }
 
+// Stamped conversion kernels for the hot dtype pairs of copy_ / to():
+// contiguous float<->bfloat16 and float<->half. These bypass the generic
+// TensorIterator loop machinery (dimension bookkeeping, stride dispatch)
+// and run a flat parallel_for over raw pointers instead. On AVX2/AVX512
+// builds the bfloat16 pairs additionally use the Vectorized conversion
+// helpers, and large copies use non-temporal stores so a one-shot dtype
+// conversion does not evict the working set from cache.
+#if (defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)) && \
+    !defined(_MSC_VER)
+#define COPY_KERNEL_STREAM_STORES
+#endif
+
+#ifdef COPY_KERNEL_STREAM_STORES
+// Streaming stores only pay off once the destination clearly exceeds the
+// last-level cache; below that the regular (cached) path wins.
+constexpr int64_t kStreamStoreThresholdBytes = 4 * 1024 * 1024;
+
+#if defined(CPU_CAPABILITY_AVX512)
+constexpr int64_t kStreamAlignment = 64;
+
+inline void stream_store(float* dst, const Vectorized<float>& value) {
+  _mm512_stream_ps(dst, value);
+}
+
+inline void stream_store(BFloat16* dst, const Vectorized<BFloat16>& value) {
+  _mm512_stream_si512(reinterpret_cast<__m512i*>(dst), value);
+}
+#else
+constexpr int64_t kStreamAlignment = 32;
+
+inline void stream_store(float* dst, const Vectorized<float>& value) {
+  _mm256_stream_ps(dst, value);
+}
+
+inline void stream_store(BFloat16* dst, const Vectorized<BFloat16>& value) {
+  _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), value);
+}
+#endif
+#endif // COPY_KERNEL_STREAM_STORES
+
+void convert_copy_chunk(float* dst, const BFloat16* src, int64_t n, bool stream) {
+  using bVec = Vectorized<BFloat16>;
+  using fVec = Vectorized<float>;
+  int64_t i = 0;
+#ifdef COPY_KERNEL_STREAM_STORES
+  if (stream) {
+    // Scalar prologue until the destination is aligned for streaming stores.
+    for (; i < n && (reinterpret_cast<uintptr_t>(dst + i) % kStreamAlignment) != 0; i++) {
+      dst[i] = static_cast<float>(src[i]);
+    }
+    for (; i <= n - bVec::size(); i += bVec::size()) {
+      bVec b = bVec::loadu(src + i);
+      fVec f0, f1;
+      std::tie(f0, f1) = convert_bfloat16_float(b);
+      stream_store(dst + i, f0);
+      stream_store(dst + i + fVec::size(), f1);
+    }
+    _mm_sfence();
+  } else
+#else
+  (void)stream;
+#endif
+  {
+    for (; i <= n - bVec::size(); i += bVec::size()) {
+      bVec b = bVec::loadu(src + i);
+      fVec f0, f1;
+      std::tie(f0, f1) = convert_bfloat16_float(b);
+      f0.store(dst + i);
+      f1.store(dst + i + fVec::size());
+    }
+  }
+  for (; i < n; i++) {
+    dst[i] = static_cast<float>(src[i]);
+  }
+}
+
+void convert_copy_chunk(BFloat16* dst, const float* src, int64_t n, bool stream) {
+  using bVec = Vectorized<BFloat16>;
+  using fVec = Vectorized<float>;
+  int64_t i = 0;
+#ifdef COPY_KERNEL_STREAM_STORES
+  if (stream) {
+    for (; i < n && (reinterpret_cast<uintptr_t>(dst + i) % kStreamAlignment) != 0; i++) {
+      dst[i] = static_cast<BFloat16>(src[i]);
+    }
+    for (; i <= n - bVec::size(); i += bVec::size()) {
+      fVec f0 = fVec::loadu(src + i);
+      fVec f1 = fVec::loadu(src + i + fVec::size());
+      stream_store(dst + i, convert_float_bfloat16(f0, f1));
+    }
+    _mm_sfence();
+  } else
+#else
+  (void)stream;
+#endif
+  {
+    for (; i <= n - bVec::size(); i += bVec::size()) {
+      fVec f0 = fVec::loadu(src + i);
+      fVec f1 = fVec::loadu(src + i + fVec::size());
+      convert_float_bfloat16(f0, f1).store(dst + i);
+    }
+  }
+  for (; i < n; i++) {
+    dst[i] = static_cast<BFloat16>(src[i]);
+  }
+}
+
+// Half has no Vectorized counterpart here (the build does not enable F16C),
+// so the half pairs get a plain stamped scalar loop. It still avoids the
+// TensorIterator overhead and auto-vectorizes reasonably well.
+template <typename dest_t, typename src_t>
+void convert_copy_chunk(dest_t* dst, const src_t* src, int64_t n, bool /*stream*/) {
+  for (int64_t i = 0; i < n; i++) {
+    dst[i] = c10::static_cast_with_inter_type<dest_t, src_t>::apply(src[i]);
+  }
+}
+
+template <typename dest_t, typename src_t>
+void convert_copy_contiguous(TensorIterator& iter) {
+  dest_t* dst = static_cast<dest_t*>(iter.data_ptr(0));
+  const src_t* src = static_cast<const src_t*>(iter.data_ptr(1));
+  const int64_t numel = iter.numel();
+  bool stream = false;
+#ifdef COPY_KERNEL_STREAM_STORES
+  stream = numel * static_cast<int64_t>(sizeof(dest_t)) >= kStreamStoreThresholdBytes;
+#endif
+  at::parallel_for(0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    convert_copy_chunk(dst + begin, src + begin, end - begin, stream);
+  });
+}
+
+bool stamped_convert_copy(TensorIterator& iter) {
+  if (iter.ntensors() != 2 || !iter.is_contiguous() || iter.numel() == 0) {
+    return false;
+  }
+  const ScalarType dst_dtype = iter.dtype(0);
+  const ScalarType src_dtype = iter.dtype(1);
+  if (dst_dtype == kFloat && src_dtype == kBFloat16) {
+    convert_copy_contiguous<float, BFloat16>(iter);
+  } else if (dst_dtype == kBFloat16 && src_dtype == kFloat) {
+    convert_copy_contiguous<BFloat16, float>(iter);
+  } else if (dst_dtype == kFloat && src_dtype == kHalf) {
+    convert_copy_contiguous<float, Half>(iter);
+  } else if (dst_dtype == kHalf && src_dtype == kFloat) {
+    convert_copy_contiguous<Half, float>(iter);
+  } else {
+    return false;
+  }
+  return true;
+}
+
 void copy_kernel(TensorIterator& iter, bool /*non_blocking*/) {
   ScalarType dtype = iter.dtype(0);
   const bool requires_conj = (
@@ -81,6 +233,9 @@ void copy_kernel(TensorIterator& iter, bool /*non_blocking*/) {
   if (dtype == iter.dtype(1)) {
     copy_same_dtype(iter, requires_conj, requires_neg);
   } else {
+    if (!requires_conj && !requires_neg && stamped_convert_copy(iter)) {
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(ScalarType::ComplexHalf, ScalarType::Half, ScalarType::Bool, ScalarType::BFloat16, dtype, "copy_", [&] {
       using dest_t = scalar_t;
       AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(ScalarType::ComplexHalf, ScalarType::Half, ScalarType::Bool, ScalarType::BFloat16, iter.dtype(1), "copy_", [&] {
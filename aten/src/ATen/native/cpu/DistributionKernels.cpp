@@ -2,12 +2,17 @@
 #include <ATen/CPUGeneratorImpl.h>
 #include <ATen/Dispatch.h>
 #include <ATen/Generator.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/Distributions.h>
 #include <ATen/native/cpu/DistributionTemplates.h>
 
 #include <ATen/native/UnaryOps.h>
 
+#include <c10/util/MathConstants.h>
+#include <c10/util/env.h>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -26,6 +31,122 @@
 namespace at { namespace native {
 namespace {
 
+// Counter-based parallel RNG path.
+//
+// CPUGeneratorImpl's MT19937 state is sequential, so the default kernels
+// fill tensors on a single core. With TORCH_CPU_PHILOX_RNG=1 large
+// contiguous fills instead derive a Philox4_32_10 stream per element from
+// (seed, element index) — see Note [Philox Engine implementation] — which
+// makes the fill embarrassingly parallel while keeping results a pure
+// function of the generator state, identical for any thread count. The
+// values differ from the MT19937 path (like the MKL bernoulli fast path
+// below differs from the default one), which is why this is opt-in.
+
+constexpr int64_t kPhiloxMinNumel = 4096;
+
+bool philox_cpu_enabled() {
+  static bool enabled =
+      c10::utils::check_env("TORCH_CPU_PHILOX_RNG") == true;
+  return enabled;
+}
+
+uint64_t philox_next_seed(CPUGeneratorImpl* generator) {
+  // Advancing the generator here keeps back-to-back fills independent and
+  // the whole call deterministic given the generator state.
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(generator->mutex_);
+  return generator->random64();
+}
+
+template <typename scalar_t>
+inline dist_acctype<scalar_t> philox_uniform(
+    Philox4_32_10& engine,
+    scalar_t from,
+    scalar_t to) {
+  if (std::is_same<scalar_t, double>::value) {
+    uint64_t lo = engine();
+    uint64_t hi = engine();
+    return transformation::uniform_real<scalar_t>((hi << 32) | lo, from, to);
+  }
+  return transformation::uniform_real<scalar_t>(engine(), from, to);
+}
+
+template <typename scalar_t>
+inline scalar_t philox_normal(
+    Philox4_32_10& engine,
+    scalar_t mean,
+    scalar_t std) {
+  using acc_t = dist_acctype<scalar_t>;
+  // Box-Muller; both uniforms come from the element's private subsequence.
+  // 1 - u1 maps [0, 1) to (0, 1] so the log argument never hits zero.
+  acc_t u1 = philox_uniform<scalar_t>(engine, 0, 1);
+  acc_t u2 = philox_uniform<scalar_t>(engine, 0, 1);
+  acc_t r = std::sqrt(acc_t(-2.0) * std::log(acc_t(1.0) - u1));
+  acc_t theta = acc_t(2.0 * c10::pi<double>) * u2;
+  return static_cast<scalar_t>(r * std::cos(theta) * std + mean);
+}
+
+template <typename scalar_t>
+void philox_uniform_fill(
+    scalar_t* data,
+    int64_t numel,
+    uint64_t seed,
+    scalar_t from,
+    scalar_t to) {
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          Philox4_32_10 engine(seed, static_cast<uint64_t>(i), 0);
+          data[i] = philox_uniform<scalar_t>(engine, from, to);
+        }
+      });
+}
+
+template <typename scalar_t>
+void philox_normal_fill(
+    scalar_t* data,
+    int64_t numel,
+    uint64_t seed,
+    scalar_t mean,
+    scalar_t std) {
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          Philox4_32_10 engine(seed, static_cast<uint64_t>(i), 0);
+          data[i] = philox_normal<scalar_t>(engine, mean, std);
+        }
+      });
+}
+
+template <typename scalar_t>
+void philox_bernoulli_fill(
+    scalar_t* data,
+    int64_t numel,
+    uint64_t seed,
+    double p) {
+  const float p_f = static_cast<float>(p);
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          Philox4_32_10 engine(seed, static_cast<uint64_t>(i), 0);
+          data[i] = static_cast<scalar_t>(
+              philox_uniform<float>(engine, 0.0f, 1.0f) < p_f);
+        }
+      });
+}
+
+bool philox_float_fill_applies(const TensorBase& self) {
+  return philox_cpu_enabled() && self.is_contiguous() &&
+      self.numel() >= kPhiloxMinNumel &&
+      (self.scalar_type() == kFloat || self.scalar_type() == kDouble);
+}
+
+bool philox_bernoulli_fill_applies(const TensorBase& self) {
+  return philox_cpu_enabled() && self.is_contiguous() &&
+      self.numel() >= kPhiloxMinNumel &&
+      self.scalar_type() != ScalarType::Half;
+}
+
 static void cauchy_kernel(TensorIteratorBase& iter, double median, double sigma, c10::optional<Generator> gen) {
   CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
   templates::cpu::cauchy_kernel(iter, median, sigma, generator);
@@ -38,6 +159,14 @@ void bernoulli_tensor_kernel(const TensorBase &self, const TensorBase &p_, c10::
 
 void bernoulli_scalar_kernel_default(const TensorBase &self, double p, c10::optional<Generator> gen) {
   CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  if (philox_bernoulli_fill_applies(self)) {
+    uint64_t seed = philox_next_seed(generator);
+    AT_DISPATCH_ALL_TYPES_AND2(at::ScalarType::Bool, at::ScalarType::BFloat16, self.scalar_type(), "bernoulli_philox_cpu", [&] {
+      philox_bernoulli_fill<scalar_t>(
+          self.data_ptr<scalar_t>(), self.numel(), seed, p);
+    });
+    return;
+  }
   templates::cpu::bernoulli_kernel(self, p, generator);
 }
 
@@ -47,6 +176,12 @@ void bernoulli_scalar_kernel(const TensorBase &self, double p, c10::optional<Gen
 }
 #else
 void bernoulli_scalar_kernel(const TensorBase &self, double p, c10::optional<Generator> gen) {
+  if (philox_bernoulli_fill_applies(self)) {
+    // The Philox path parallelizes as well as the MKL one and keeps
+    // results independent of the thread count.
+    bernoulli_scalar_kernel_default(self, p, gen);
+    return;
+  }
   if (cpuinfo_initialize() && cpuinfo_vendor_intel == cpuinfo_get_processor(0)->core->vendor) {
     CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
     int64_t seed;
@@ -120,11 +255,37 @@ static void log_normal_kernel(TensorIteratorBase& iter, double mean, double std,
 
 void uniform_kernel(TensorIteratorBase& iter, double from, double to, c10::optional<Generator> gen) {
   CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  if (philox_cpu_enabled() && iter.is_contiguous() &&
+      iter.numel() >= kPhiloxMinNumel &&
+      (iter.dtype() == kFloat || iter.dtype() == kDouble)) {
+    uint64_t seed = philox_next_seed(generator);
+    AT_DISPATCH_FLOATING_TYPES(iter.dtype(), "uniform_philox_cpu", [&] {
+      philox_uniform_fill<scalar_t>(
+          static_cast<scalar_t*>(iter.data_ptr(0)),
+          iter.numel(),
+          seed,
+          static_cast<scalar_t>(from),
+          static_cast<scalar_t>(to));
+    });
+    return;
+  }
   templates::cpu::uniform_kernel(iter, from, to, generator);
 }
 
 void normal_kernel(const TensorBase &self, double mean, double std, c10::optional<Generator> gen) {
   CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  if (philox_float_fill_applies(self)) {
+    uint64_t seed = philox_next_seed(generator);
+    AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "normal_philox_cpu", [&] {
+      philox_normal_fill<scalar_t>(
+          self.data_ptr<scalar_t>(),
+          self.numel(),
+          seed,
+          static_cast<scalar_t>(mean),
+          static_cast<scalar_t>(std));
+    });
+    return;
+  }
   templates::cpu::normal_kernel(self, mean, std, generator);
 }
 
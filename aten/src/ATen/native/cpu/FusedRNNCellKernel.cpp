@@ -0,0 +1,131 @@
+#include <ATen/native/RNN.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
+
+namespace at { namespace native {
+
+namespace {
+
+// Fused pointwise gate math for the CPU RNN cell inference fast path. The
+// decomposed cell in RNN.cpp materializes every gate as its own tensor and
+// walks the batch once per activation; here each row of gates is consumed in
+// a single pass with the activations evaluated in registers, so the working
+// set per step is just the gate buffer and the hidden state.
+
+template <typename scalar_t>
+inline scalar_t sigmoid_scalar(scalar_t x) {
+  return scalar_t(1) / (scalar_t(1) + std::exp(-x));
+}
+
+template <typename scalar_t>
+inline vec::Vectorized<scalar_t> sigmoid_vec(vec::Vectorized<scalar_t> x) {
+  const vec::Vectorized<scalar_t> one(scalar_t(1));
+  return one / (one + x.neg().exp());
+}
+
+// gates is the contiguous [batch, 4 * hidden] sum of the input and recurrent
+// gemms, with the usual (input, forget, cell, output) chunk order.
+void fused_lstm_cell_inference_kernel(
+    Tensor& hy,
+    Tensor& cy,
+    const Tensor& gates,
+    const Tensor& cx) {
+  const int64_t batch = cx.size(0);
+  const int64_t hidden = cx.size(1);
+  AT_DISPATCH_FLOATING_TYPES(
+      gates.scalar_type(), "fused_lstm_cell_cpu", [&] {
+        using Vec = vec::Vectorized<scalar_t>;
+        const scalar_t* gates_data = gates.data_ptr<scalar_t>();
+        const scalar_t* cx_data = cx.data_ptr<scalar_t>();
+        scalar_t* hy_data = hy.data_ptr<scalar_t>();
+        scalar_t* cy_data = cy.data_ptr<scalar_t>();
+        at::parallel_for(0, batch, 1, [&](int64_t begin, int64_t end) {
+          for (const auto b : c10::irange(begin, end)) {
+            const scalar_t* in_gate = gates_data + b * 4 * hidden;
+            const scalar_t* forget_gate = in_gate + hidden;
+            const scalar_t* cell_gate = in_gate + 2 * hidden;
+            const scalar_t* out_gate = in_gate + 3 * hidden;
+            const scalar_t* cx_row = cx_data + b * hidden;
+            scalar_t* hy_row = hy_data + b * hidden;
+            scalar_t* cy_row = cy_data + b * hidden;
+            int64_t d = 0;
+            for (; d <= hidden - Vec::size(); d += Vec::size()) {
+              const Vec ig = sigmoid_vec(Vec::loadu(in_gate + d));
+              const Vec fg = sigmoid_vec(Vec::loadu(forget_gate + d));
+              const Vec cg = Vec::loadu(cell_gate + d).tanh();
+              const Vec og = sigmoid_vec(Vec::loadu(out_gate + d));
+              const Vec c = fg * Vec::loadu(cx_row + d) + ig * cg;
+              c.store(cy_row + d);
+              (og * c.tanh()).store(hy_row + d);
+            }
+            for (; d < hidden; d++) {
+              const scalar_t ig = sigmoid_scalar(in_gate[d]);
+              const scalar_t fg = sigmoid_scalar(forget_gate[d]);
+              const scalar_t cg = std::tanh(cell_gate[d]);
+              const scalar_t og = sigmoid_scalar(out_gate[d]);
+              const scalar_t c = fg * cx_row[d] + ig * cg;
+              cy_row[d] = c;
+              hy_row[d] = og * std::tanh(c);
+            }
+          }
+        });
+      });
+}
+
+// igates/hgates are the contiguous [batch, 3 * hidden] input and recurrent
+// gemm outputs, with (reset, input, new) chunk order. They must stay separate
+// because the new gate applies the reset gate to the recurrent half only.
+void fused_gru_cell_inference_kernel(
+    Tensor& hy,
+    const Tensor& igates,
+    const Tensor& hgates,
+    const Tensor& hx) {
+  const int64_t batch = hx.size(0);
+  const int64_t hidden = hx.size(1);
+  AT_DISPATCH_FLOATING_TYPES(
+      igates.scalar_type(), "fused_gru_cell_cpu", [&] {
+        using Vec = vec::Vectorized<scalar_t>;
+        const scalar_t* igates_data = igates.data_ptr<scalar_t>();
+        const scalar_t* hgates_data = hgates.data_ptr<scalar_t>();
+        const scalar_t* hx_data = hx.data_ptr<scalar_t>();
+        scalar_t* hy_data = hy.data_ptr<scalar_t>();
+        at::parallel_for(0, batch, 1, [&](int64_t begin, int64_t end) {
+          for (const auto b : c10::irange(begin, end)) {
+            const scalar_t* ir = igates_data + b * 3 * hidden;
+            const scalar_t* ii = ir + hidden;
+            const scalar_t* in = ir + 2 * hidden;
+            const scalar_t* hr = hgates_data + b * 3 * hidden;
+            const scalar_t* hi = hr + hidden;
+            const scalar_t* hn = hr + 2 * hidden;
+            const scalar_t* hx_row = hx_data + b * hidden;
+            scalar_t* hy_row = hy_data + b * hidden;
+            int64_t d = 0;
+            for (; d <= hidden - Vec::size(); d += Vec::size()) {
+              const Vec reset_gate =
+                  sigmoid_vec(Vec::loadu(ir + d) + Vec::loadu(hr + d));
+              const Vec input_gate =
+                  sigmoid_vec(Vec::loadu(ii + d) + Vec::loadu(hi + d));
+              const Vec new_gate =
+                  (Vec::loadu(in + d) + reset_gate * Vec::loadu(hn + d)).tanh();
+              const Vec h = Vec::loadu(hx_row + d);
+              ((h - new_gate) * input_gate + new_gate).store(hy_row + d);
+            }
+            for (; d < hidden; d++) {
+              const scalar_t reset_gate = sigmoid_scalar(ir[d] + hr[d]);
+              const scalar_t input_gate = sigmoid_scalar(ii[d] + hi[d]);
+              const scalar_t new_gate = std::tanh(in[d] + reset_gate * hn[d]);
+              hy_row[d] = (hx_row[d] - new_gate) * input_gate + new_gate;
+            }
+          }
+        });
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(fused_lstm_cell_inference_stub, &fused_lstm_cell_inference_kernel);
+REGISTER_DISPATCH(fused_gru_cell_inference_stub, &fused_gru_cell_inference_kernel);
+
+}} // namespace at::native
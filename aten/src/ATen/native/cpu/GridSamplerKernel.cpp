@@ -567,6 +567,31 @@ struct ApplyGridSample<scalar_t, 2, GridSamplerInterpolation::Bilinear,
     auto i_sw_offset = i_nw_offset + iVec(inp_sH);
     auto i_se_offset = i_sw_offset + iVec(inp_sW);
 
+    // Fast path: when all four corners of every lane are in bounds, use
+    // plain gathers and skip the per-channel mask copies. nw_mask covers the
+    // lower bounds of both coordinates and se_mask the upper bounds, so
+    // together they cover all four corners. Out-of-range tail lanes hold
+    // zero grid values (see grid_sample_2d_grid_slice_iterator), which map
+    // in bounds, so they cannot sneak an out-of-bounds offset past this
+    // check.
+    if ((nw_mask & se_mask).zero_mask() == 0) {
+      #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
+      # pragma unroll
+      #endif
+      for (const auto c : c10::irange(C)) {
+        auto inp_slice_C_ptr = inp_slice[c].data();
+
+        auto nw_val = gather<sizeof(scalar_t)>(inp_slice_C_ptr, i_nw_offset);
+        auto ne_val = gather<sizeof(scalar_t)>(inp_slice_C_ptr, i_ne_offset);
+        auto sw_val = gather<sizeof(scalar_t)>(inp_slice_C_ptr, i_sw_offset);
+        auto se_val = gather<sizeof(scalar_t)>(inp_slice_C_ptr, i_se_offset);
+
+        auto interpolated = (nw_val * nw) + (ne_val * ne) + (sw_val * sw) + (se_val * se);
+        interpolated.store(out_slice[c].data() + offset, len);
+      }
+      return;
+    }
+
     #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
     # pragma unroll
     #endif
@@ -755,6 +780,24 @@ struct ApplyGridSample<scalar_t, 2, GridSamplerInterpolation::Nearest,
     auto out_ptr = out_slice.data() + offset;
     auto out_sC = out_slice.stride(0);
     auto inp_slice_ptr = inp_slice.data();
+
+    // Fast path: with border or reflection padding the mask is statically
+    // all ones; with zeros padding check it dynamically. Either way, when
+    // every lane is in bounds the masked gather (and the per-channel mask
+    // copy it requires) can be replaced by a plain gather. Out-of-range
+    // tail lanes hold zero grid values (see
+    // grid_sample_2d_grid_slice_iterator), which map in bounds.
+    if (must_in_bound || mask.zero_mask() == 0) {
+      #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
+      # pragma unroll
+      #endif
+      for (int64_t c = 0; c < C; ++c, out_ptr += out_sC, inp_slice_ptr += inp_sC) {
+        auto inp_val = gather<sizeof(scalar_t)>(inp_slice_ptr, i_offset);
+        inp_val.store(static_cast<void*>(out_ptr), len);
+      }
+      return;
+    }
+
     #if !defined(_MSC_VER) && !defined(COMPILING_FOR_MIN_SIZE)
     # pragma unroll
     #endif
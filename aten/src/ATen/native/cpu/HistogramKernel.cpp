@@ -75,6 +75,68 @@ enum BIN_SELECTION_ALGORITHM {
     LINEAR_INTERPOLATION_WITH_LOCAL_SEARCH,
     BINARY_SEARCH,
 };
+
+/* Fast path for one-dimensional, unweighted, uniformly-binned histograms
+ * (the torch.histc case). The general algorithm below walks each element
+ * through a D-dimensional accessor and accumulates directly into floating
+ * point bins. Here the bin selection is a pure elementwise map, so it is
+ * computed into a small index buffer first, keeping that loop free of the
+ * (inherently scalar) scatter into the bins so the compiler can vectorize
+ * it. Since all weights are 1, the per-thread histograms hold integer
+ * counts, which are only converted to the output dtype when merged.
+ */
+template<typename input_t>
+void histogramdd_linear_1d_contiguous(Tensor& hist, const Tensor& bin_edges,
+        const Tensor& input) {
+    const int64_t N = input.numel();
+    const input_t* self_data = input.data_ptr<input_t>();
+
+    const int64_t bin_ct = hist.numel();
+    const input_t* edges_data = bin_edges.data_ptr<input_t>();
+    const input_t leftmost_edge = edges_data[0];
+    const input_t rightmost_edge = edges_data[bin_edges.numel() - 1];
+
+    const auto num_threads = at::get_num_threads();
+    Tensor thread_histograms = at::zeros({num_threads, bin_ct}, kLong);
+    TORCH_INTERNAL_ASSERT(thread_histograms.is_contiguous());
+
+    at::parallel_for(0, N, HISTOGRAM_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+        int64_t* hist_local_data = thread_histograms.data_ptr<int64_t>()
+                + bin_ct * at::get_thread_num();
+
+        constexpr int64_t BLOCK_SIZE = 128;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+        int64_t bin_index[BLOCK_SIZE];
+
+        for (int64_t block = start; block < end; block += BLOCK_SIZE) {
+            const int64_t block_end = std::min(end, block + BLOCK_SIZE);
+            for (const auto i : c10::irange(block, block_end)) {
+                const input_t elt = self_data[i];
+                /* Keeps the exact expression used by LINEAR_INTERPOLATION below
+                 * so that both paths classify edge-adjacent elements identically.
+                 */
+                int64_t pos = static_cast<int64_t>((elt - leftmost_edge)
+                        / (rightmost_edge - leftmost_edge)
+                        * bin_ct);
+                // Unlike other bins, the rightmost bin includes its right boundary
+                pos = std::min(pos, bin_ct - 1);
+                // Flags elements which fall outside the specified bins
+                if (elt < leftmost_edge || rightmost_edge < elt) {
+                    pos = -1;
+                }
+                bin_index[i - block] = pos;
+            }
+            for (const auto i : c10::irange(block_end - block)) {
+                if (bin_index[i] >= 0) {
+                    hist_local_data[bin_index[i]]++;
+                }
+            }
+        }
+    });
+
+    at::sum_out(hist, thread_histograms, /*dim=*/{0});
+}
+
 template<typename input_t, BIN_SELECTION_ALGORITHM algorithm>
 void histogramdd_cpu_contiguous(Tensor& hist, const TensorList& bin_edges,
         const Tensor& input, const c10::optional<Tensor>& weight) {
@@ -97,6 +159,12 @@ void histogramdd_cpu_contiguous(Tensor& hist, const TensorList& bin_edges,
         return;
     }
 
+    if (algorithm == LINEAR_INTERPOLATION && D == 1 && !weight.has_value()
+            && input.is_contiguous()) {
+        histogramdd_linear_1d_contiguous<input_t>(hist, bin_edges[0], input);
+        return;
+    }
+
     TensorAccessor<input_t, 2> accessor_in = input.accessor<input_t, 2>();
 
     /* Constructs a c10::optional<TensorAccessor> containing an accessor iff
@@ -359,6 +359,46 @@ void cpu_kernel_vec(TensorIteratorBase& iter, func_t&& op, vec_func_t&& vop, int
   iter.cast_outputs();
 }
 
+// Fast path for the common case where every operand is a contiguous CPU
+// tensor of the same dtype and shape: skips the full TensorIterator build
+// (broadcasting, type promotion, stride reordering, dimension coalescing)
+// and runs the vectorized loop over the flat data directly. Returns false
+// without touching the tensors when the operands do not qualify; the caller
+// then falls back to the regular TensorIterator path. The output must
+// already be allocated with the expected shape and dtype.
+template <typename func_t, typename vec_func_t>
+bool try_flat_cpu_kernel_vec(
+    TensorBase& out,
+    const TensorBase& a,
+    func_t&& op,
+    vec_func_t&& vop,
+    int64_t grain_size = at::internal::GRAIN_SIZE) {
+  if (!TensorIterator::can_use_flat_op(out, {&a})) {
+    return false;
+  }
+  auto iter = TensorIterator::flat_unary_op(out, a);
+  cpu_kernel_vec(
+      iter, std::forward<func_t>(op), std::forward<vec_func_t>(vop), grain_size);
+  return true;
+}
+
+template <typename func_t, typename vec_func_t>
+bool try_flat_cpu_kernel_vec(
+    TensorBase& out,
+    const TensorBase& a,
+    const TensorBase& b,
+    func_t&& op,
+    vec_func_t&& vop,
+    int64_t grain_size = at::internal::GRAIN_SIZE) {
+  if (!TensorIterator::can_use_flat_op(out, {&a, &b})) {
+    return false;
+  }
+  auto iter = TensorIterator::flat_binary_op(out, a, b);
+  cpu_kernel_vec(
+      iter, std::forward<func_t>(op), std::forward<vec_func_t>(vop), grain_size);
+  return true;
+}
+
 template <typename func_t>
 void cpu_serial_kernel(TensorIteratorBase& iter, func_t&& op, const Range& range) {
   using traits = function_traits<func_t>;
@@ -15,10 +15,240 @@
 #include <ATen/ops/empty.h>
 #endif
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace at {
 namespace native {
 namespace {
 
+// Fast path for large categorical distributions: Walker/Vose alias tables.
+//
+// Building the table costs O(n_categories), the same as the cumulative
+// distribution the binary-search path below builds, but every subsequent
+// draw is O(1) instead of O(log n_categories). Rollout-style workloads
+// repeatedly sample from the same probability tensor, so the table is
+// cached keyed on the live tensor's identity and version counter; repeated
+// multinomial calls on an unmodified tensor skip the build entirely.
+
+constexpr int64_t kAliasMinCategories = 512;
+constexpr int64_t kAliasMinSamples = 64;
+constexpr size_t kAliasCacheCapacity = 8;
+
+struct AliasTable {
+  // One slot per (distribution, category): draw k ~ U{0..n_categories-1},
+  // accept k with probability prob[k], otherwise emit alias[k].
+  std::vector<double> prob;
+  std::vector<int64_t> alias;
+};
+
+struct AliasCacheEntry {
+  // Weak so the cache never extends the probability tensor's lifetime; a
+  // lookup only counts as a hit while this still locks to the impl being
+  // sampled from. Raw addresses would not do: both the TensorImpl and its
+  // data can be freed and reallocated at the same addresses for a fresh
+  // tensor, which also restarts at version 0.
+  c10::weak_intrusive_ptr<c10::TensorImpl, c10::UndefinedTensorImpl> impl;
+  const void* data;
+  uint32_t version;
+  uintptr_t counter_id;
+  ScalarType dtype;
+  int64_t n_dist;
+  int64_t n_categories;
+  std::shared_ptr<AliasTable> table;
+};
+
+std::mutex alias_cache_mutex;
+// Small FIFO cache; a handful of live distributions covers the workloads
+// that benefit (the common case is a single reused probability tensor).
+std::vector<AliasCacheEntry> alias_cache;
+
+bool alias_cache_key_matches(const AliasCacheEntry& entry, const Tensor& self) {
+  // An expired weak reference locks to the undefined singleton, which never
+  // compares equal to a live impl, so staleness and identity are one check.
+  if (entry.impl.lock().get() != self.unsafeGetTensorImpl()) {
+    return false;
+  }
+  const auto& version_counter = self.unsafeGetTensorImpl()->version_counter();
+  return entry.data == self.data_ptr() &&
+      entry.version == version_counter.current_version() &&
+      entry.counter_id == version_counter.counter_id() &&
+      entry.dtype == self.scalar_type() &&
+      entry.n_categories == self.size(-1) &&
+      entry.n_dist == (self.dim() > 1 ? self.size(-2) : 1);
+}
+
+std::shared_ptr<AliasTable> lookup_cached_alias_table(const Tensor& self) {
+  // Inference tensors have no version counter, so modifications could not
+  // be detected; never cache them.
+  if (!self.unsafeGetTensorImpl()->version_counter().enabled()) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(alias_cache_mutex);
+  for (const auto& entry : alias_cache) {
+    if (alias_cache_key_matches(entry, self)) {
+      return entry.table;
+    }
+  }
+  return nullptr;
+}
+
+void store_cached_alias_table(
+    const Tensor& self,
+    std::shared_ptr<AliasTable> table) {
+  if (!self.unsafeGetTensorImpl()->version_counter().enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(alias_cache_mutex);
+  if (alias_cache.size() >= kAliasCacheCapacity) {
+    alias_cache.erase(alias_cache.begin());
+  }
+  const auto& version_counter = self.unsafeGetTensorImpl()->version_counter();
+  alias_cache.push_back(AliasCacheEntry{
+      c10::weak_intrusive_ptr<c10::TensorImpl, c10::UndefinedTensorImpl>(
+          self.getIntrusivePtr()),
+      self.data_ptr(),
+      version_counter.current_version(),
+      version_counter.counter_id(),
+      self.scalar_type(),
+      self.dim() > 1 ? self.size(-2) : 1,
+      self.size(-1),
+      std::move(table)});
+}
+
+template <typename scalar_t>
+std::shared_ptr<AliasTable> build_alias_table(const Tensor& self) {
+  int64_t n_categories = self.size(-1);
+  int64_t n_dist = self.dim() > 1 ? self.size(-2) : 1;
+
+  const scalar_t* const self_ptr = self.data_ptr<scalar_t>();
+  auto self_stride_0 = self.dim() > 1 ? self.stride(-2) : 0;
+  auto self_stride_1 = self.stride(-1);
+
+  auto table = std::make_shared<AliasTable>();
+  table->prob.resize(n_dist * n_categories);
+  table->alias.resize(n_dist * n_categories);
+
+  std::vector<double> scaled(n_categories);
+  std::vector<int64_t> small(n_categories);
+  std::vector<int64_t> large(n_categories);
+
+  for (const auto i : c10::irange(n_dist)) {
+    double sum = 0;
+    for (const auto j : c10::irange(n_categories)) {
+      double val = static_cast<double>(self_ptr[i * self_stride_0 + j * self_stride_1]);
+      TORCH_CHECK(
+          val >= 0,
+          "invalid multinomial distribution (encountering probability entry < 0)");
+      TORCH_CHECK(
+          std::isfinite(val),
+          "invalid multinomial distribution (encountering probability entry = infinity or NaN)");
+      sum += val;
+      scaled[j] = val;
+    }
+    TORCH_CHECK(
+        sum > 0,
+        "invalid multinomial distribution (sum of probabilities <= 0)");
+
+    /* Vose's algorithm: split the normalized weights (scaled to a mean of
+    one) into under- and over-full categories and pair them up so each slot
+    holds at most two outcomes */
+    int64_t n_small = 0;
+    int64_t n_large = 0;
+    const double scale = n_categories / sum;
+    for (const auto j : c10::irange(n_categories)) {
+      scaled[j] *= scale;
+      if (scaled[j] < 1) {
+        small[n_small++] = j;
+      } else {
+        large[n_large++] = j;
+      }
+    }
+
+    double* const prob_row = table->prob.data() + i * n_categories;
+    int64_t* const alias_row = table->alias.data() + i * n_categories;
+    while (n_small > 0 && n_large > 0) {
+      int64_t s = small[--n_small];
+      int64_t l = large[--n_large];
+      prob_row[s] = scaled[s];
+      alias_row[s] = l;
+      /* Donate the leftover mass of the large slot; it may become
+      under-full itself */
+      scaled[l] = (scaled[l] + scaled[s]) - 1;
+      if (scaled[l] < 1) {
+        small[n_small++] = l;
+      } else {
+        large[n_large++] = l;
+      }
+    }
+    /* Whatever remains has weight one up to rounding error */
+    while (n_large > 0) {
+      int64_t l = large[--n_large];
+      prob_row[l] = 1;
+      alias_row[l] = l;
+    }
+    while (n_small > 0) {
+      int64_t s = small[--n_small];
+      prob_row[s] = 1;
+      alias_row[s] = s;
+    }
+  }
+  return table;
+}
+
+template <typename scalar_t>
+bool multinomial_alias_apply(
+    Tensor& result,
+    const Tensor& self,
+    const int64_t n_sample,
+    c10::optional<Generator> generator) {
+  int64_t n_categories = self.size(-1);
+  int64_t n_dist = self.dim() > 1 ? self.size(-2) : 1;
+  if (n_categories < kAliasMinCategories) {
+    return false;
+  }
+
+  auto table = lookup_cached_alias_table(self);
+  if (!table) {
+    /* Without a cached table the build has to be amortized over this call's
+    samples; small draws stay on the binary-search path */
+    if (n_sample < kAliasMinSamples) {
+      return false;
+    }
+    table = build_alias_table<scalar_t>(self);
+    store_cached_alias_table(self, table);
+  }
+
+  auto gen = get_generator_or_default<CPUGeneratorImpl>(
+      generator, detail::getDefaultCPUGenerator());
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(gen->mutex_);
+
+  int64_t* const result_ptr = result.data_ptr<int64_t>();
+  auto result_dist_stride_0 = result.dim() > 1 ? result.stride(-2) : 0;
+  auto result_dist_stride_1 = result.stride(-1);
+
+  for (const auto i : c10::irange(n_dist)) {
+    const double* const prob_row = table->prob.data() + i * n_categories;
+    const int64_t* const alias_row = table->alias.data() + i * n_categories;
+    for (const auto j : c10::irange(n_sample)) {
+      /* A single uniform draw picks both the slot (integer part) and the
+      accept/alias coin flip (fractional part) */
+      at::uniform_real_distribution<double> uniform(0, 1);
+      double scaled_sample = uniform(gen) * n_categories;
+      int64_t k = std::min(
+          static_cast<int64_t>(scaled_sample), n_categories - 1);
+      int64_t sample_idx =
+          (scaled_sample - k) < prob_row[k] ? k : alias_row[k];
+      result_ptr[i * result_dist_stride_0 + j * result_dist_stride_1] =
+          sample_idx;
+    }
+  }
+  return true;
+}
+
 template <typename scalar_t>
 void multinomial_with_replacement_apply(
     Tensor& result,
@@ -232,8 +462,10 @@ static void multinomial_with_replacement_kernel_impl(
     c10::optional<Generator> gen) {
   AT_DISPATCH_FLOATING_TYPES_AND2(
       kHalf, kBFloat16, self.scalar_type(), "multinomial", [&] {
-        multinomial_with_replacement_apply<scalar_t>(
-            result, self, n_sample, gen);
+        if (!multinomial_alias_apply<scalar_t>(result, self, n_sample, gen)) {
+          multinomial_with_replacement_apply<scalar_t>(
+              result, self, n_sample, gen);
+        }
       });
 }
 } // namespace
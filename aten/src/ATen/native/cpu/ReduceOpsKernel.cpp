@@ -3,6 +3,7 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/cpu/vec/vec.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/native/ReduceOps.h>
@@ -11,6 +12,7 @@
 #include <ATen/native/SharedReduceOps.h>
 #include <ATen/native/ReduceOpsUtils.h>
 #include <ATen/native/cpu/Reduce.h>
+#include <ATen/native/cpu/moments_utils.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -75,11 +77,101 @@ static inline void cpu_cum_base_kernel(const Tensor& result,
   iter.for_each(loop);
 }
 
+// The generic cumulative kernel above parallelizes over rows, so a scan along
+// the only dimension of a long 1-d tensor runs on a single thread. The chunked
+// scan below covers that case: every chunk is scanned locally in parallel, the
+// chunk totals are combined with a serial exclusive scan (their count is
+// tiny), and a second parallel pass folds each chunk's carry-in into its
+// elements. Chunk boundaries depend only on kScanChunkSize, never on the
+// thread count, so the result is bitwise identical no matter how many threads
+// execute the passes (including one).
+constexpr int64_t kScanChunkSize = 65536;
+// Below this the two extra passes cost more than the parallelism buys.
+constexpr int64_t kParallelScanMinSize = 4 * kScanChunkSize;
+
+template <typename scalar_t, typename combine_t>
+static inline void cpu_chunked_scan_kernel(
+    scalar_t* result_data,
+    const scalar_t* self_data,
+    int64_t size,
+    const combine_t& combine,
+    scalar_t init_val) {
+  using acc_t = at::acc_type<scalar_t, false>;
+  const int64_t num_chunks = divup(size, kScanChunkSize);
+  std::vector<acc_t> chunk_carry(num_chunks);
+
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto chunk : c10::irange(begin, end)) {
+      const int64_t chunk_begin = chunk * kScanChunkSize;
+      const int64_t chunk_end = std::min(chunk_begin + kScanChunkSize, size);
+      auto cum_number = (acc_t)init_val;
+      for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+        cum_number = combine(cum_number, (acc_t)self_data[i]);
+        result_data[i] = (scalar_t)cum_number;
+      }
+      chunk_carry[chunk] = cum_number;
+    }
+  });
+
+  acc_t carry = (acc_t)init_val;
+  for (const auto chunk : c10::irange(num_chunks)) {
+    const acc_t total = chunk_carry[chunk];
+    chunk_carry[chunk] = carry;
+    carry = combine(carry, total);
+  }
+
+  // Chunk 0's carry-in is the identity, so it is already done.
+  at::parallel_for(1, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto chunk : c10::irange(begin, end)) {
+      const int64_t chunk_begin = chunk * kScanChunkSize;
+      const int64_t chunk_end = std::min(chunk_begin + kScanChunkSize, size);
+      const acc_t carry_in = chunk_carry[chunk];
+      for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+        result_data[i] = (scalar_t)combine(carry_in, (acc_t)result_data[i]);
+      }
+    }
+  });
+}
+
+template <typename scalar_t, typename combine_t>
+static inline bool try_chunked_scan_kernel(
+    const Tensor& result,
+    const Tensor& self,
+    const combine_t& combine,
+    scalar_t init_val) {
+  if (self.dim() != 1 || self.numel() < kParallelScanMinSize ||
+      !self.is_contiguous() || self.is_conj() || self.is_neg() ||
+      result.scalar_type() != self.scalar_type()) {
+    return false;
+  }
+  if (result.sizes() != self.sizes()) {
+    at::native::resize_output(result, self.sizes());
+  }
+  if (!result.is_contiguous() || result.is_conj() || result.is_neg()) {
+    return false;
+  }
+  cpu_chunked_scan_kernel(
+      result.data_ptr<scalar_t>(),
+      self.data_ptr<scalar_t>(),
+      self.numel(),
+      combine,
+      init_val);
+  return true;
+}
+
 static void cumsum_cpu_kernel(const Tensor& result, const Tensor& self, int64_t dim) {
   auto wrap_dim = maybe_wrap_dim(dim, self.dim());
   int64_t self_dim_size = ensure_nonempty_size(self, wrap_dim);
 
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND(kBFloat16, self.scalar_type(), "cumsum_out_cpu", [&] {
+    using acc_t = at::acc_type<scalar_t, false>;
+    if (try_chunked_scan_kernel<scalar_t>(
+            result,
+            self,
+            [](acc_t a, acc_t b) { return a + b; },
+            /*init_val=*/0)) {
+      return;
+    }
     cpu_cum_base_kernel<scalar_t>(result, self, wrap_dim, [&] (
       scalar_t* result_data, auto result_dim_stride,
       const scalar_t* self_data, auto self_dim_stride, scalar_t init_val) {
@@ -99,6 +191,14 @@ static void cumprod_cpu_kernel(const Tensor& result, const Tensor& self, int64_t
   int64_t self_dim_size = ensure_nonempty_size(self, wrap_dim);
 
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND(kBFloat16, self.scalar_type(), "cumprod_out_cpu", [&] {
+    using acc_t = at::acc_type<scalar_t, false>;
+    if (try_chunked_scan_kernel<scalar_t>(
+            result,
+            self,
+            [](acc_t a, acc_t b) { return a * b; },
+            /*init_val=*/1)) {
+      return;
+    }
     cpu_cum_base_kernel<scalar_t>(result, self, wrap_dim, [&] (
       scalar_t* result_data, auto result_dim_stride,
       const scalar_t* self_data, auto self_dim_stride, scalar_t init_val) {
@@ -158,16 +258,43 @@ static void mean_kernel_impl(TensorIterator& iter) {
 }
 
 static void std_var_kernel_impl(TensorIterator& iter, int64_t correction, bool take_sqrt) {
+  if (iter.noutputs() == 1 && is_reduce_lastdim(iter)
+      && iter.dtype(0) == iter.input_dtype()
+      && (iter.input_dtype() == kFloat || iter.input_dtype() == kDouble)
+      && iter.shape()[0] > correction) {
+    // Reduction along the contiguous innermost dim: use the vectorized
+    // Welford + cascade sum from moments_utils.h instead of the generic
+    // scalar path, which accumulates one element at a time in double.
+    AT_DISPATCH_FLOATING_TYPES(iter.input_dtype(), "std_cpu", [&] {
+      binary_kernel_reduce_lastdim(iter, [correction, take_sqrt](
+          char* result_data_bytes, char* self_data_bytes, int64_t size) {
+        scalar_t* result_data = (scalar_t*)result_data_bytes;
+        const scalar_t* self_data = (const scalar_t*)self_data_bytes;
+
+        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+        scalar_t var;
+        std::tie(std::ignore, var) =
+            utils::RowwiseMoments(self_data, size, /*ddof=*/correction);
+        result_data[0] = take_sqrt ? std::sqrt(var) : var;
+      });
+    });
+    return;
+  }
   AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, iter.dtype(), "std_cpu", [&] {
+    // Half and BFloat16 inputs carry few enough mantissa bits that the
+    // (numerically stable) Welford updates don't need a double accumulator;
+    // accumulating in float avoids the double-precision arithmetic on the
+    // hot path. Float and double keep their double accumulator.
+    using acc_t = at::acc_type<scalar_t, /*is_cuda=*/false>;
     binary_kernel_reduce(
         iter,
         WelfordOps<
             scalar_t,
-            double,
+            acc_t,
             int64_t,
-            double,
+            acc_t,
             std::tuple<scalar_t, scalar_t>>{correction, take_sqrt},
-        WelfordData<double, int64_t, double>());
+        WelfordData<acc_t, int64_t, acc_t>());
   });
 }
 
@@ -211,6 +338,19 @@ inline void norm_two_reduce_step(Vectorized<float>& acc_fvec, Vectorized<BFloat1
   acc_fvec += data_fvec1 * data_fvec1;
 }
 
+template <typename scalar_t, typename acc_t>
+inline void norm_one_reduce_step(Vectorized<acc_t>& acc_vec, Vectorized<scalar_t>& data_vec) {
+  acc_vec += data_vec.abs();
+}
+
+template <>
+inline void norm_one_reduce_step(Vectorized<float>& acc_fvec, Vectorized<BFloat16>& data_bvec) {
+  Vectorized<float> data_fvec0, data_fvec1;
+  std::tie(data_fvec0, data_fvec1) = convert_bfloat16_float(data_bvec);
+  acc_fvec += data_fvec0.abs();
+  acc_fvec += data_fvec1.abs();
+}
+
 static void norm_kernel_tensor_iterator_impl(
     TensorIterator& iter,
     const Scalar& p) {
@@ -245,6 +385,35 @@ static void norm_kernel_tensor_iterator_impl(
       );
     });
   } else if (val == 1) {
+    if (use_fast_path) {
+      AT_DISPATCH_FLOATING_TYPES_AND(kBFloat16, iter.input_dtype(), "norm_cpu", [&] {
+        // use float as accumulate type for BFloat16
+        using acc_t = vec_scalar_t<scalar_t>;
+        binary_kernel_reduce_lastdim(iter, [](char* result_data_bytes, char* self_data_bytes, int64_t size) {
+          scalar_t* result_data = (scalar_t*)result_data_bytes;
+          scalar_t* self_data = (scalar_t*)self_data_bytes;
+
+          using Vec = Vectorized<scalar_t>;
+          using fVec = Vectorized<acc_t>;
+          fVec acc_vec{acc_t(0)};
+          acc_t buffer[fVec::size()];
+          int64_t d = 0;
+          for (; d < size - (size % Vec::size()); d += Vec::size()) {
+            Vec data_vec = Vec::loadu(self_data + d);
+            norm_one_reduce_step(acc_vec, data_vec);
+          }
+          acc_vec.store(buffer);
+          for (int j = 1; j < fVec::size(); j++) {
+            buffer[0] = buffer[0] + buffer[j];
+          }
+          for (; d < size; d++) {
+            buffer[0] += std::abs(acc_t(self_data[d]));
+          }
+          result_data[0] = scalar_t(buffer[0]);
+        });
+      });
+      return;
+    }
     AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND2(kHalf, kBFloat16, iter.input_dtype(), "norm_cpu", [&] {
       using acc_t = typename scalar_value_type<scalar_t>::type;
       binary_kernel_reduce(
@@ -451,20 +620,72 @@ static void max_values_kernel_impl(TensorIterator& iter) {
   });
 }
 
+// Per-row helpers for the last-dim arg reductions below. The generic path
+// carries a (value, index) pair through every comparison; these find the
+// extreme value first with a plain vectorized reduction and recover the index
+// by scanning for its first occurrence, which is the index GreaterOrNan /
+// LessOrNan would keep. Both comparators order NaN as the extreme, so a NaN
+// result means the answer is the first NaN in the row.
+template <typename scalar_t>
+static inline scalar_t row_max(const scalar_t* data, int64_t size) {
+  return vec::reduce_all<scalar_t>(
+      [](auto& x, auto& y) { return maximum(x, y); }, data, size);
+}
+
+template <typename scalar_t>
+static inline scalar_t row_min(const scalar_t* data, int64_t size) {
+  return vec::reduce_all<scalar_t>(
+      [](auto& x, auto& y) { return minimum(x, y); }, data, size);
+}
+
+// Half has no vector lanes on CPU; accumulate through float, the same type
+// the pair-based comparator promotes to. The result converts back exactly
+// since it is one of the row's values.
+static inline c10::Half row_max(const c10::Half* data, int64_t size) {
+  float best = static_cast<float>(data[0]);
+  for (int64_t i = 1; i < size; i++) {
+    best = max_impl(best, static_cast<float>(data[i]));
+  }
+  return static_cast<c10::Half>(best);
+}
+
+static inline c10::Half row_min(const c10::Half* data, int64_t size) {
+  float best = static_cast<float>(data[0]);
+  for (int64_t i = 1; i < size; i++) {
+    best = min_impl(best, static_cast<float>(data[i]));
+  }
+  return static_cast<c10::Half>(best);
+}
+
+template <typename scalar_t>
+static inline int64_t row_first_occurrence(
+    const scalar_t* data,
+    int64_t size,
+    scalar_t target) {
+  if (at::_isnan(target)) {
+    for (int64_t i = 0; i < size; i++) {
+      if (at::_isnan(data[i])) {
+        return i;
+      }
+    }
+  }
+  for (int64_t i = 0; i < size; i++) {
+    if (data[i] == target) {
+      return i;
+    }
+  }
+  return 0;
+}
+
 static void argmax_kernel_impl(TensorIterator &iter) {
   AT_DISPATCH_ALL_TYPES_AND2(kHalf, kBFloat16, iter.dtype(1), "argmax_cpu", [&] {
     if (is_reduce_lastdim(iter)) {
-      using arg_t = std::pair<scalar_t, int64_t>;
-      auto op = ArgMaxOps<scalar_t>{};
-      binary_kernel_reduce_lastdim(iter, [&](char* result_data_bytes, char* self_data_bytes, int64_t size) {
+      binary_kernel_reduce_lastdim(iter, [](char* result_data_bytes, char* self_data_bytes, int64_t size) {
         int64_t* result_data = (int64_t*)result_data_bytes;
-        scalar_t* self_data = (scalar_t*)self_data_bytes;
+        const scalar_t* self_data = (const scalar_t*)self_data_bytes;
 
-        arg_t acc = arg_t(lower_bound<scalar_t>(), 0);
-        for (int64_t i = 0; i < size; i++) {
-          acc = op.reduce(acc, self_data[i], i);
-        }
-        result_data[0] = acc.second;
+        const scalar_t max_val = row_max(self_data, size);
+        result_data[0] = row_first_occurrence(self_data, size, max_val);
       });
       return;
     }
@@ -478,17 +699,12 @@ static void argmax_kernel_impl(TensorIterator &iter) {
 static void argmin_kernel_impl(TensorIterator &iter) {
   AT_DISPATCH_ALL_TYPES_AND2(kHalf, kBFloat16, iter.dtype(1), "argmin_cpu", [&] {
     if (is_reduce_lastdim(iter)) {
-      using arg_t = std::pair<scalar_t, int64_t>;
-      auto op = ArgMinOps<scalar_t>{};
-      binary_kernel_reduce_lastdim(iter, [&](char* result_data_bytes, char* self_data_bytes, int64_t size) {
+      binary_kernel_reduce_lastdim(iter, [](char* result_data_bytes, char* self_data_bytes, int64_t size) {
         int64_t* result_data = (int64_t*)result_data_bytes;
-        scalar_t* self_data = (scalar_t*)self_data_bytes;
+        const scalar_t* self_data = (const scalar_t*)self_data_bytes;
 
-        arg_t acc = arg_t(upper_bound<scalar_t>(), 0);
-        for (int64_t i = 0; i < size; i++) {
-          acc = op.reduce(acc, self_data[i], i);
-        }
-        result_data[0] = acc.second;
+        const scalar_t min_val = row_min(self_data, size);
+        result_data[0] = row_first_occurrence(self_data, size, min_val);
       });
       return;
     }
@@ -7,8 +7,11 @@
 #include <ATen/Dispatch.h>
 #include <ATen/NumericUtils.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <cstring>
+
 namespace at { namespace native {
 
 namespace {
@@ -580,7 +583,219 @@ struct cpu_scatter_gather_base_kernel {
   }
 };
 
+// The fast paths below bypass the TensorIterator-based base kernel for the
+// access patterns dominating graph workloads, where gather/scatter moves
+// whole rows of a 2d (or row-major collapsible) tensor.
+//
+// `values` is `src` for scatter and `result` for gather.  The row pattern
+// requires dim == 0, contiguous self/values, and an index that is broadcast
+// (stride 0) over every dimension but the first, as produced by
+// index.view(-1, 1).expand(-1, row_size); then each index entry selects a
+// whole row and the kernel degenerates to row copies/accumulations.
+bool can_use_row_fast_path(
+    const Tensor& self, int64_t dim,
+    const Tensor& index, const Tensor& values) {
+  if (dim != 0 || self.dim() <= 1 || index.dim() != self.dim()) {
+    return false;
+  }
+  if (self.numel() == 0 || index.numel() == 0) {
+    return false;
+  }
+  if (!self.is_contiguous() || !values.is_contiguous()) {
+    return false;
+  }
+  if (index.size(0) != values.size(0) || index.stride(0) != 1) {
+    return false;
+  }
+  for (const auto d : c10::irange(1, index.dim())) {
+    if (index.stride(d) != 0) {
+      return false;
+    }
+    if (index.size(d) != values.size(d) || self.size(d) != values.size(d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename scalar_t>
+void gather_row_fast_path_kernel(
+    const Tensor& result, const Tensor& self, const Tensor& index) {
+  auto* result_data = result.data_ptr<scalar_t>();
+  auto* self_data = self.data_ptr<scalar_t>();
+  auto* index_data = index.data_ptr<int64_t>();
+
+  int64_t num_rows = index.size(0);
+  int64_t row_size = self.numel() / self.size(0);
+  int64_t index_upper_bound = self.size(0);
+
+  int64_t grain_size = std::max((int64_t) 1, at::internal::GRAIN_SIZE / row_size);
+  at::parallel_for(0, num_rows, grain_size, [&](int64_t begin, int64_t end) {
+    int64_t i = begin;
+    while (i < end) {
+      int64_t idx_dim = index_data[i];
+      // merge runs of consecutive indices (sorted neighbourhoods) into a
+      // single span so they turn into one large memcpy
+      int64_t run = 1;
+      while (i + run < end && index_data[i + run] == idx_dim + run) {
+        run++;
+      }
+      TORCH_CHECK(idx_dim >= 0 && idx_dim + run <= index_upper_bound,
+        "index ", (idx_dim >= 0 ? idx_dim + run - 1 : idx_dim),
+        " is out of bounds for dimension ", 0,
+        " with size ", index_upper_bound
+      );
+      std::memcpy(
+        result_data + i * row_size,
+        self_data + idx_dim * row_size,
+        run * row_size * sizeof(scalar_t));
+      i += run;
+    }
+  });
+}
+
+template <typename scalar_t>
+void scatter_add_row_fast_path_kernel(
+    const Tensor& self, const Tensor& index, const Tensor& src) {
+  using Vec = vec::Vectorized<scalar_t>;
+
+  auto* self_data = self.data_ptr<scalar_t>();
+  auto* index_data = index.data_ptr<int64_t>();
+  auto* src_data = src.data_ptr<scalar_t>();
+
+  int64_t num_src_rows = index.size(0);
+  int64_t num_self_rows = self.size(0);
+  int64_t row_size = self.numel() / self.size(0);
+
+  // validate all indices up front, so the parallel region below is free of
+  // error handling
+  for (const auto i : c10::irange(num_src_rows)) {
+    int64_t idx_dim = index_data[i];
+    TORCH_CHECK(idx_dim >= 0 && idx_dim < num_self_rows,
+      "index ", index_data[i],
+      " is out of bounds for dimension ", 0,
+      " with size ", num_self_rows
+    );
+  }
+
+  // Partition the destination index range across threads: every thread owns
+  // a contiguous range of self rows and scans the whole index array,
+  // accumulating only the sources that land in its range.  Threads never
+  // write the same destination row, so no atomics or locks are needed even
+  // when the index contains duplicates.
+  int64_t avg_row_work = std::max((int64_t) 1, num_src_rows * row_size / num_self_rows);
+  int64_t grain_size = std::max((int64_t) 1, at::internal::GRAIN_SIZE / avg_row_work);
+  at::parallel_for(0, num_self_rows, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(num_src_rows)) {
+      int64_t idx_dim = index_data[i];
+      if (idx_dim < begin || idx_dim >= end) {
+        continue;
+      }
+      auto* self_row = self_data + idx_dim * row_size;
+      auto* src_row = src_data + i * row_size;
+      int64_t d = 0;
+      for (; d < row_size - (row_size % Vec::size()); d += Vec::size()) {
+        auto acc = Vec::loadu(self_row + d) + Vec::loadu(src_row + d);
+        acc.store(self_row + d);
+      }
+      for (; d < row_size; d++) {
+        self_row[d] += src_row[d];
+      }
+    }
+  });
+}
+
+// The general trailing-dimension gather, result[...][i] = self[...][index[...][i]],
+// vectorizes through at::vec::gather, which lowers to hardware gather
+// instructions for the 4/8-byte floating types on AVX2/AVX512.  All three
+// tensors must be contiguous with matching outer dimensions so that their
+// rows line up.
+bool can_use_trailing_dim_gather(
+    const Tensor& result, const Tensor& self, int64_t dim, const Tensor& index) {
+  if (self.dim() < 1 || dim != self.dim() - 1 || index.dim() != self.dim()) {
+    return false;
+  }
+  if (self.numel() == 0 || index.numel() == 0) {
+    return false;
+  }
+  if (self.scalar_type() != ScalarType::Float && self.scalar_type() != ScalarType::Double) {
+    return false;
+  }
+  if (!result.is_contiguous() || !self.is_contiguous() || !index.is_contiguous()) {
+    return false;
+  }
+  for (const auto d : c10::irange(self.dim() - 1)) {
+    if (index.size(d) != self.size(d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename scalar_t>
+void gather_trailing_dim_kernel(
+    const Tensor& result, const Tensor& self, const Tensor& index) {
+  using Vec = vec::Vectorized<scalar_t>;
+  using index_t = vec::int_same_size_t<scalar_t>;
+
+  auto* result_data = result.data_ptr<scalar_t>();
+  auto* self_data = self.data_ptr<scalar_t>();
+  auto* index_data = index.data_ptr<int64_t>();
+
+  int64_t index_dim_size = index.size(index.dim() - 1);
+  int64_t self_dim_size = self.size(self.dim() - 1);
+  int64_t num_rows = index.numel() / index_dim_size;
+
+  int64_t grain_size = std::max((int64_t) 1, at::internal::GRAIN_SIZE / index_dim_size);
+  at::parallel_for(0, num_rows, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto row : c10::irange(begin, end)) {
+      auto* idx = index_data + row * index_dim_size;
+      auto* src = self_data + row * self_dim_size;
+      auto* dst = result_data + row * index_dim_size;
+      int64_t i = 0;
+      for (; i < index_dim_size - (index_dim_size % Vec::size()); i += Vec::size()) {
+        // the bounds check doubles as the int64 -> int_same_size_t narrowing
+        // the vectorized gather needs
+        index_t buffer[Vec::size()];
+        for (const auto j : c10::irange(Vec::size())) {
+          int64_t idx_dim = idx[i + j];
+          TORCH_CHECK(idx_dim >= 0 && idx_dim < self_dim_size,
+                      "index ", idx[i + j],
+                      " is out of bounds for dimension ", index.dim() - 1,
+                      " with size ", self_dim_size);
+          buffer[j] = static_cast<index_t>(idx_dim);
+        }
+        auto vindex = vec::Vectorized<index_t>::loadu(buffer);
+        vec::gather<sizeof(scalar_t)>(src, vindex).store(dst + i);
+      }
+      for (; i < index_dim_size; i++) {
+        int64_t idx_dim = idx[i];
+        TORCH_CHECK(idx_dim >= 0 && idx_dim < self_dim_size,
+                    "index ", idx[i],
+                    " is out of bounds for dimension ", index.dim() - 1,
+                    " with size ", self_dim_size);
+        dst[i] = src[idx_dim];
+      }
+    }
+  });
+}
+
 void gather_cpu_kernel(const Tensor& result, const Tensor& self, int64_t dim, const Tensor& index) {
+  if (can_use_row_fast_path(self, dim, index, result)) {
+    AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
+      ScalarType::Bool, ScalarType::Half, ScalarType::BFloat16, self.scalar_type(),
+      "gather_row_cpu", [&] {
+        gather_row_fast_path_kernel<scalar_t>(result, self, index);
+      }
+    );
+    return;
+  }
+  if (can_use_trailing_dim_gather(result, self, dim, index)) {
+    AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "gather_vec_cpu", [&] {
+      gather_trailing_dim_kernel<scalar_t>(result, self, index);
+    });
+    return;
+  }
   cpu_scatter_gather_base_kernel</*is_scatter_like=*/false>()(
     result, dim, index, self,
     "gather_out_cpu", tensor_assign);
@@ -597,6 +812,16 @@ void scatter_fill_cpu_kernel(const Tensor& self, int64_t dim, const Tensor& inde
 }
 
 void scatter_add_cpu_kernel(const Tensor& self, int64_t dim, const Tensor& index, const Tensor& src) {
+  if (self.scalar_type() != ScalarType::Bool &&
+      can_use_row_fast_path(self, dim, index, src)) {
+    AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(
+      ScalarType::Half, ScalarType::BFloat16, self.scalar_type(),
+      "scatter_add_row_cpu", [&] {
+        scatter_add_row_fast_path_kernel<scalar_t>(self, index, src);
+      }
+    );
+    return;
+  }
   cpu_scatter_gather_base_kernel<>()(
     self, dim, index, src,
     "scatter_add_", reduce_add);
@@ -661,8 +886,90 @@ void scatter_scalar_reduce_cpu_kernel(const Tensor& self, const int64_t dim, con
   }
 }
 
+// Parallel deterministic index_add for dim == 0 over contiguous result and
+// source (the embedding-gradient layout). Two phases: a histogram of the
+// destination rows splits them into per-thread ranges of roughly equal work,
+// then each thread scans the index array once and applies the updates that
+// land in its range, in source order. Each destination row is owned by
+// exactly one thread and receives its updates in the same order as the
+// serial loop, so the result is bitwise identical to the serial path (the
+// per-slice add uses the same fmadd/scalar-tail split as the add kernel)
+// while distinct rows proceed in parallel.
+void index_add_parallel_cpu_kernel(
+    const Tensor& result,
+    const Tensor& index,
+    const Tensor& source,
+    const Scalar& alpha) {
+  const int64_t num_rows = ensure_nonempty_size(result, 0);
+  const int64_t slice_size = result.numel() / num_rows;
+  const int64_t numel = index.numel();
+  AT_DISPATCH_FLOATING_TYPES(
+    result.scalar_type(), "index_add_parallel_cpu", [&] {
+    const auto alpha_value = alpha.to<scalar_t>();
+    auto* result_ptr = result.data_ptr<scalar_t>();
+    const auto* source_ptr = source.data_ptr<scalar_t>();
+    AT_DISPATCH_INDEX_TYPES(
+      index.scalar_type(), "index_add_parallel_cpu", [&] {
+      const auto* index_data = index.data_ptr<index_t>();
+      // Phase 1: bounds-check the indices and histogram the destination
+      // rows so the ranges below carry roughly equal numbers of updates.
+      std::vector<int64_t> counts(num_rows, 0);
+      for (const auto i : c10::irange(numel)) {
+        const auto self_i = index_data[i];
+        TORCH_CHECK_INDEX(
+            (self_i >= 0) && (self_i < num_rows), "index out of range in self");
+        counts[self_i]++;
+      }
+      const int64_t num_threads = at::get_num_threads();
+      std::vector<int64_t> range_begin(num_threads + 1, num_rows);
+      range_begin[0] = 0;
+      int64_t assigned = 0;
+      int64_t row = 0;
+      for (const auto t : c10::irange(num_threads)) {
+        const int64_t target = (numel * (t + 1)) / num_threads;
+        while (row < num_rows && assigned < target) {
+          assigned += counts[row];
+          ++row;
+        }
+        range_begin[t + 1] = row;
+      }
+      range_begin[num_threads] = num_rows;
+      using Vec = vec::Vectorized<scalar_t>;
+      const Vec alpha_vec(alpha_value);
+      // Phase 2: ordered writes, one row range per task.
+      at::parallel_for(0, num_threads, 1, [&](int64_t begin, int64_t end) {
+        for (const auto t : c10::irange(begin, end)) {
+          const int64_t row_begin = range_begin[t];
+          const int64_t row_end = range_begin[t + 1];
+          if (row_begin == row_end) {
+            continue;
+          }
+          for (const auto i : c10::irange(numel)) {
+            const int64_t self_i = index_data[i];
+            if (self_i < row_begin || self_i >= row_end) {
+              continue;
+            }
+            scalar_t* dst = result_ptr + self_i * slice_size;
+            const scalar_t* src = source_ptr + i * slice_size;
+            int64_t d = 0;
+            for (; d + Vec::size() <= slice_size; d += Vec::size()) {
+              const auto a = Vec::loadu(dst + d);
+              const auto b = Vec::loadu(src + d);
+              vec::fmadd(b, alpha_vec, a).store(dst + d);
+            }
+            for (; d < slice_size; d++) {
+              dst[d] += alpha_value * src[d];
+            }
+          }
+        }
+      });
+    });
+  });
+}
+
 } // anonymous namespace
 
+REGISTER_DISPATCH(index_add_parallel_stub, &index_add_parallel_cpu_kernel);
 REGISTER_DISPATCH(gather_stub, &gather_cpu_kernel);
 REGISTER_DISPATCH(scatter_stub, &scatter_cpu_kernel);
 REGISTER_DISPATCH(scatter_fill_stub, &scatter_fill_cpu_kernel);
@@ -2,6 +2,7 @@
 #include <ATen/native/cpu/SoftmaxKernel.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <numeric>
 
@@ -98,6 +99,64 @@ inline void _vec_log_softmax_lastdim(
       });
 }
 
+// Online softmax (running max and running denominator, see Milakov and
+// Gimelshein, "Online normalizer calculation for softmax"): the max and the
+// exp-sum are computed in a single read-only sweep over the input, rescaling
+// the partial denominator whenever the running max grows, followed by one
+// sweep that writes the normalized output. Compared to the classic
+// max / exp / sum / scale sequence below this halves the memory traffic at
+// the cost of one extra exp per vector step, so it is only worth it for rows
+// that spill out of cache (see _vec_softmax_lastdim).
+template <typename scalar_t>
+inline void _vec_online_softmax_lastdim(
+    scalar_t* input_data_base,
+    scalar_t* output_data_base,
+    int64_t outer_size,
+    int64_t dim_size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t grain_size = std::max(internal::GRAIN_SIZE / (16 * dim_size), (int64_t)1);
+  parallel_for(0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto i : c10::irange(begin, end)) {
+      scalar_t* input_data = input_data_base + i * dim_size;
+      scalar_t* output_data = output_data_base + i * dim_size;
+      // Each lane tracks its own running max and denominator.
+      Vec max_vec = Vec(-std::numeric_limits<scalar_t>::infinity());
+      Vec sum_vec = Vec(scalar_t(0));
+      int64_t d = 0;
+      for (; d < dim_size - (dim_size % Vec::size()); d += Vec::size()) {
+        Vec data_vec = Vec::loadu(input_data + d);
+        Vec new_max_vec = vec::maximum(max_vec, data_vec);
+        sum_vec = sum_vec * (max_vec - new_max_vec).exp() +
+            (data_vec - new_max_vec).exp();
+        max_vec = new_max_vec;
+      }
+      scalar_t max_input = vec::vec_reduce_all<scalar_t>(
+          [](Vec& x, Vec& y) { return vec::maximum(x, y); }, max_vec);
+      // Rescale the per-lane denominators to the global max before summing.
+      sum_vec = sum_vec * (max_vec - Vec(max_input)).exp();
+      scalar_t tmp_sum = vec::vec_reduce_all<scalar_t>(
+          [](Vec& x, Vec& y) { return x + y; }, sum_vec);
+      for (; d < dim_size; d++) {
+        scalar_t data_val = input_data[d];
+        if (data_val > max_input) {
+          tmp_sum = tmp_sum * std::exp(max_input - data_val) + scalar_t(1);
+          max_input = data_val;
+        } else {
+          tmp_sum += std::exp(data_val - max_input);
+        }
+      }
+      tmp_sum = 1 / tmp_sum;
+      vec::map(
+          [max_input, tmp_sum](Vec x) {
+            return (x - Vec(max_input)).exp() * Vec(tmp_sum);
+          },
+          output_data,
+          input_data,
+          dim_size);
+    }
+  });
+}
+
 template <typename scalar_t>
 inline void _vec_softmax_lastdim(
     scalar_t* input_data_base,
@@ -105,6 +164,16 @@ inline void _vec_softmax_lastdim(
     int64_t outer_size,
     int64_t dim_size) {
   using Vec = vec::Vectorized<scalar_t>;
+  // Rows that do not fit in the L2 cache pay a full memory sweep for each of
+  // the max / exp / sum / scale passes below; the online variant touches the
+  // row only twice. For cache-resident rows the extra exp of the online
+  // rescaling costs more than the cached passes save.
+  constexpr int64_t L2_CACHE_BYTES = 256 * 1024;
+  if (dim_size * static_cast<int64_t>(sizeof(scalar_t)) > L2_CACHE_BYTES) {
+    _vec_online_softmax_lastdim(
+        input_data_base, output_data_base, outer_size, dim_size);
+    return;
+  }
   int64_t grain_size = std::max(internal::GRAIN_SIZE / (16 * dim_size), (int64_t)1);
   parallel_for(0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
     for (const auto i : c10::irange(begin, end)) {
@@ -771,6 +840,60 @@ static void log_softmax_kernel_impl(const Tensor& result, const Tensor& self, in
     [&] { vec_softmax<scalar_t, true>::apply(result, self, dim); });
 }
 
+// Padding-aware attention softmax: seq_lens gives the valid prefix length of
+// every row belonging to one batch element, so only the prefix is reduced and
+// exponentiated and the masked tail is zero-filled in one shot. With padding
+// masks this does strictly less work than the boolean-mask path, proportional
+// to the padding ratio.
+static void padded_softmax_lastdim_kernel_impl(
+    const Tensor& result,
+    const Tensor& self,
+    const Tensor& seq_lens) {
+  const int64_t dim_size = self.size(self.dim() - 1);
+  const int64_t outer_size = self.numel() / dim_size;
+  const int64_t rows_per_batch = outer_size / seq_lens.numel();
+  const int64_t* lens = seq_lens.data_ptr<int64_t>();
+  AT_DISPATCH_FLOATING_TYPES(
+      self.scalar_type(), "padded_softmax_lastdim_kernel_impl", [&] {
+        using Vec = vec::Vectorized<scalar_t>;
+        const scalar_t* input_data_base = self.data_ptr<scalar_t>();
+        scalar_t* output_data_base = result.data_ptr<scalar_t>();
+        int64_t grain_size =
+            std::max(internal::GRAIN_SIZE / (16 * dim_size), (int64_t)1);
+        at::parallel_for(
+            0, outer_size, grain_size, [&](int64_t begin, int64_t end) {
+              for (const auto i : c10::irange(begin, end)) {
+                const scalar_t* input_data = input_data_base + i * dim_size;
+                scalar_t* output_data = output_data_base + i * dim_size;
+                const int64_t len = std::min(
+                    std::max(lens[i / rows_per_batch], (int64_t)0), dim_size);
+                if (len > 0) {
+                  const scalar_t max = vec::reduce_all<scalar_t>(
+                      [](Vec& x, Vec& y) { return vec::maximum(x, y); },
+                      input_data,
+                      len);
+                  vec::map(
+                      [max](Vec x) { return (x - Vec(max)).exp(); },
+                      output_data,
+                      input_data,
+                      len);
+                  const scalar_t sum = vec::reduce_all<scalar_t>(
+                      [](Vec& x, Vec& y) { return x + y; }, output_data, len);
+                  const scalar_t inv_sum = scalar_t(1) / sum;
+                  vec::map(
+                      [inv_sum](Vec x) { return x * Vec(inv_sum); },
+                      output_data,
+                      output_data,
+                      len);
+                }
+                // Zero bit pattern is 0.0 for all dispatched types.
+                std::memset(
+                    output_data + len, 0, (dim_size - len) * sizeof(scalar_t));
+              }
+            });
+      });
+}
+
 static void softmax_backward_lastdim_kernel_impl(
     const Tensor& grad_input,
     const Tensor& grad,
@@ -808,5 +931,8 @@ REGISTER_DISPATCH(
 
 REGISTER_DISPATCH(softmax_kernel, &softmax_kernel_impl);
 REGISTER_DISPATCH(log_softmax_kernel, &log_softmax_kernel_impl);
+REGISTER_DISPATCH(
+    padded_softmax_lastdim_kernel,
+    &padded_softmax_lastdim_kernel_impl);
 
 }} // namespace at::native
@@ -20,5 +20,10 @@ using forward_fn_with_dim = void(*)(const Tensor &, const Tensor &, const int64_
 DECLARE_DISPATCH(forward_fn_with_dim, softmax_kernel);
 DECLARE_DISPATCH(forward_fn_with_dim, log_softmax_kernel);
 
+// (output, input, seq_lens): lastdim softmax restricted to the per-batch
+// valid prefix; the padded tail of each output row is zero-filled.
+using padded_forward_fn = void (*)(const Tensor&, const Tensor&, const Tensor&);
+DECLARE_DISPATCH(padded_forward_fn, padded_softmax_lastdim_kernel);
+
 }
 }
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at { namespace native {
+
+// Computes r += alpha * sparse * dense for a coalesced 2d COO sparse tensor
+// (given by its contiguous indices/values) and row-major contiguous dense
+// and r. Scaling r by beta is the caller's responsibility.
+using sparse_addmm_dense_fn = void(*)(
+    Tensor& r,
+    const Tensor& indices,
+    const Tensor& values,
+    const Tensor& dense,
+    const Scalar& alpha);
+DECLARE_DISPATCH(sparse_addmm_dense_fn, sparse_addmm_dense_stub);
+
+}} // at::native
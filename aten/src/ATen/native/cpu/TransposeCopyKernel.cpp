@@ -0,0 +1,193 @@
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/intrinsics.h>
+#include <ATen/native/Copy.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+
+namespace at {
+namespace native {
+inline namespace CPU_CAPABILITY {
+namespace {
+
+// Leaf size of the cache-oblivious recursion. A kTileSize x kTileSize tile
+// of any supported dtype fits comfortably in L1 alongside its destination.
+constexpr int64_t kTileSize = 16;
+
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+// In-register 8x8 transpose of 32-bit lanes. src holds 8 columns of 8
+// elements each (column c at src + c * src_stride); the transposed rows are
+// stored to dst + r * dst_stride.
+inline void transpose_tile_8x8_32bit(
+    const float* src,
+    int64_t src_stride,
+    float* dst,
+    int64_t dst_stride) {
+  __m256 c0 = _mm256_loadu_ps(src + 0 * src_stride);
+  __m256 c1 = _mm256_loadu_ps(src + 1 * src_stride);
+  __m256 c2 = _mm256_loadu_ps(src + 2 * src_stride);
+  __m256 c3 = _mm256_loadu_ps(src + 3 * src_stride);
+  __m256 c4 = _mm256_loadu_ps(src + 4 * src_stride);
+  __m256 c5 = _mm256_loadu_ps(src + 5 * src_stride);
+  __m256 c6 = _mm256_loadu_ps(src + 6 * src_stride);
+  __m256 c7 = _mm256_loadu_ps(src + 7 * src_stride);
+
+  __m256 t0 = _mm256_unpacklo_ps(c0, c1);
+  __m256 t1 = _mm256_unpackhi_ps(c0, c1);
+  __m256 t2 = _mm256_unpacklo_ps(c2, c3);
+  __m256 t3 = _mm256_unpackhi_ps(c2, c3);
+  __m256 t4 = _mm256_unpacklo_ps(c4, c5);
+  __m256 t5 = _mm256_unpackhi_ps(c4, c5);
+  __m256 t6 = _mm256_unpacklo_ps(c6, c7);
+  __m256 t7 = _mm256_unpackhi_ps(c6, c7);
+
+  __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+  _mm256_storeu_ps(dst + 0 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x20));
+  _mm256_storeu_ps(dst + 1 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x20));
+  _mm256_storeu_ps(dst + 2 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x20));
+  _mm256_storeu_ps(dst + 3 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x20));
+  _mm256_storeu_ps(dst + 4 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x31));
+  _mm256_storeu_ps(dst + 5 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x31));
+  _mm256_storeu_ps(dst + 6 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x31));
+  _mm256_storeu_ps(dst + 7 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+#endif
+
+// Transposes an nr x nc tile with src element (r, c) at src[r + c *
+// src_stride] and dst element (r, c) at dst[r * dst_stride + c]. 32-bit
+// dtypes are pure data movement, so they share the SIMD 8x8 kernel above
+// regardless of their actual type; everything else (and the edge remainder)
+// goes element by element within the cache-resident tile.
+template <typename scalar_t>
+inline void transpose_tile(
+    const scalar_t* src,
+    int64_t src_stride,
+    scalar_t* dst,
+    int64_t dst_stride,
+    int64_t nr,
+    int64_t nc) {
+  int64_t r_start = 0;
+  int64_t c_start = 0;
+#if defined(CPU_CAPABILITY_AVX2) || defined(CPU_CAPABILITY_AVX512)
+  if (sizeof(scalar_t) == 4 && std::is_trivially_copyable<scalar_t>::value) {
+    const int64_t nr8 = nr & ~7;
+    const int64_t nc8 = nc & ~7;
+    for (int64_t c = 0; c < nc8; c += 8) {
+      for (int64_t r = 0; r < nr8; r += 8) {
+        transpose_tile_8x8_32bit(
+            reinterpret_cast<const float*>(src + r + c * src_stride),
+            src_stride,
+            reinterpret_cast<float*>(dst + r * dst_stride + c),
+            dst_stride);
+      }
+    }
+    // the two remainder strips are handled by the scalar loops below
+    for (int64_t r = nr8; r < nr; ++r) {
+      for (const auto c : c10::irange(nc8)) {
+        dst[r * dst_stride + c] = src[r + c * src_stride];
+      }
+    }
+    r_start = 0;
+    c_start = nc8;
+  }
+#endif
+  for (int64_t r = r_start; r < nr; ++r) {
+    for (int64_t c = c_start; c < nc; ++c) {
+      dst[r * dst_stride + c] = src[r + c * src_stride];
+    }
+  }
+}
+
+// Cache-oblivious decomposition: recursively halve the larger extent (at
+// tile granularity, so the leaves stay full SIMD tiles) until the block is a
+// single tile. Both the source and destination footprints shrink together,
+// so some level of the recursion fits each level of the cache hierarchy
+// without tuning block sizes per CPU.
+template <typename scalar_t>
+void transpose_copy_block(
+    const scalar_t* src,
+    int64_t src_stride,
+    scalar_t* dst,
+    int64_t dst_stride,
+    int64_t nr,
+    int64_t nc) {
+  if (nr <= kTileSize && nc <= kTileSize) {
+    transpose_tile(src, src_stride, dst, dst_stride, nr, nc);
+    return;
+  }
+  if (nr >= nc) {
+    const int64_t half = std::max(kTileSize, (nr / 2 / kTileSize) * kTileSize);
+    transpose_copy_block(src, src_stride, dst, dst_stride, half, nc);
+    transpose_copy_block(
+        src + half,
+        src_stride,
+        dst + half * dst_stride,
+        dst_stride,
+        nr - half,
+        nc);
+  } else {
+    const int64_t half = std::max(kTileSize, (nc / 2 / kTileSize) * kTileSize);
+    transpose_copy_block(src, src_stride, dst, dst_stride, nr, half);
+    transpose_copy_block(
+        src + half * src_stride,
+        src_stride,
+        dst + half,
+        dst_stride,
+        nr,
+        nc - half);
+  }
+}
+
+void transpose_copy_kernel(
+    Tensor& self,
+    const Tensor& src,
+    int64_t batch,
+    int64_t rows,
+    int64_t cols) {
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND4(
+      kHalf, kBool, kBFloat16, kComplexHalf, self.scalar_type(), "transpose_copy_kernel", [&] {
+        const scalar_t* sp = src.data_ptr<scalar_t>();
+        scalar_t* rp = self.data_ptr<scalar_t>();
+        const int64_t matrix_numel = rows * cols;
+        // Parallelize across (batch, row) ranges; each task gets a large
+        // contiguous row block and runs the full 2-D recursion on it.
+        at::parallel_for(
+            0,
+            batch * rows,
+            std::max<int64_t>(
+                kTileSize, internal::GRAIN_SIZE / std::max<int64_t>(1, cols)),
+            [&](int64_t begin, int64_t end) {
+              while (begin < end) {
+                const int64_t b = begin / rows;
+                const int64_t r = begin % rows;
+                const int64_t nr = std::min(end - begin, rows - r);
+                transpose_copy_block(
+                    sp + b * matrix_numel + r,
+                    rows,
+                    rp + b * matrix_numel + r * cols,
+                    cols,
+                    nr,
+                    cols);
+                begin += nr;
+              }
+            });
+      });
+}
+
+} // anonymous namespace
+} // namespace CPU_CAPABILITY
+
+REGISTER_DISPATCH(transpose_copy_stub, &transpose_copy_kernel);
+
+} // namespace native
+} // namespace at
@@ -365,6 +365,29 @@ void cpu_upsample_nearest_channels_last(
 
   TORCH_CHECK(channels > 0, "expected input and output channels greater than 0 but got ", channels);
 
+  // Precompute the input offset for every output position along each
+  // interpolated dimension, as in compute_indices_weights for the generic
+  // kernel. This keeps the float source-index computation out of the
+  // per-pixel loop, which otherwise dominates for small channel counts.
+  std::vector<int64_t> iw_offsets(output_width);
+  for (const auto ow : c10::irange(output_width)) {
+    iw_offsets[ow] =
+        nearest_idx_fn(ow, input_width, output_width, scales[ndim - 3]) * channels;
+  }
+  std::vector<int64_t> ih_offsets(output_height);
+  for (const auto oh : c10::irange(output_height)) {
+    ih_offsets[oh] =
+        nearest_idx_fn(oh, input_height, output_height, scales[ndim - 4]) *
+        input_width * channels;
+  }
+  std::vector<int64_t> id_offsets(output_depth);
+  for (const auto od : c10::irange(output_depth)) {
+    id_offsets[od] = (ndim == 5)
+        ? nearest_idx_fn(od, input_depth, output_depth, scales[0]) *
+            input_height * input_width * channels
+        : 0;
+  }
+
   using Vec = vec::Vectorized<scalar_t>;
   auto copy = [](scalar_t* out, scalar_t* in, int64_t size) {
     int64_t d = 0;
@@ -384,11 +407,9 @@ void cpu_upsample_nearest_channels_last(
     data_index_init(begin, n, num_batches, oh, output_height, ow, output_width);
 
     for (const auto i : c10::irange(begin, end)) {
-      int64_t ih = nearest_idx_fn(oh, input_height, output_height, scales[0]);
-      int64_t iw = nearest_idx_fn(ow, input_width, output_width, scales[1]);
       scalar_t* output_ptr = output_data + i * channels;
       scalar_t* input_ptr = input_data + n * input_height * input_width * channels +
-          ih * input_width * channels + iw * channels;
+          ih_offsets[oh] + iw_offsets[ow];
       copy(output_ptr, input_ptr, channels);
       data_index_step(n, num_batches, oh, output_height, ow, output_width);
     }
@@ -402,21 +423,41 @@ void cpu_upsample_nearest_channels_last(
     data_index_init(begin, n, num_batches, od, output_depth, oh, output_height, ow, output_width);
 
     for (const auto i : c10::irange(begin, end)) {
-      int64_t id = nearest_idx_fn(od, input_depth, output_depth, scales[0]);
-      int64_t ih = nearest_idx_fn(oh, input_height, output_height, scales[1]);
-      int64_t iw = nearest_idx_fn(ow, input_width, output_width, scales[2]);
       scalar_t* output_ptr = output_data + i * channels;
       scalar_t* input_ptr = input_data + n * input_depth * input_height * input_width * channels +
-          id * input_height * input_width * channels +
-          ih * input_width * channels + iw * channels;
+          id_offsets[od] + ih_offsets[oh] + iw_offsets[ow];
       copy(output_ptr, input_ptr, channels);
       data_index_step(n, num_batches, od, output_depth, oh, output_height, ow, output_width);
     }
   };
 
+  // When the width mapping is the identity (e.g. height-only resize), every
+  // output row is a contiguous copy of its source row, so copy whole rows
+  // instead of pixel by pixel.
+  bool width_is_identity = input_width == output_width;
+  for (const auto ow : c10::irange(output_width)) {
+    width_is_identity &= (iw_offsets[ow] == ow * channels);
+  }
+
+  auto loop2d_rows = [&](int64_t begin, int64_t end) {
+    for (const auto r : c10::irange(begin, end)) {
+      int64_t n = r / output_height;
+      int64_t oh = r - n * output_height;
+      scalar_t* output_ptr = output_data + r * output_width * channels;
+      scalar_t* input_ptr = input_data + n * input_height * input_width * channels +
+          ih_offsets[oh];
+      copy(output_ptr, input_ptr, output_width * channels);
+    }
+  };
+
   if (ndim == 4) {
     // upsample nearest 2d
-    at::parallel_for(0, numel / channels, at::internal::GRAIN_SIZE / channels, loop2d);
+    if (width_is_identity) {
+      at::parallel_for(0, num_batches * output_height,
+          at::internal::GRAIN_SIZE / (channels * output_width), loop2d_rows);
+    } else {
+      at::parallel_for(0, numel / channels, at::internal::GRAIN_SIZE / channels, loop2d);
+    }
   } else {
     // upsample nearest 3d
     TORCH_INTERNAL_ASSERT(ndim == 5);
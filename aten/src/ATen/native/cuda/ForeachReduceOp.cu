@@ -13,6 +13,8 @@
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/_foreach_norm_native.h>
+#include <ATen/ops/_fused_clip_grad_scale_native.h>
+#include <ATen/ops/_fused_clip_grad_sq_norm_native.h>
 
 #include <ATen/ops/zeros.h>
 #include <ATen/ops/empty.h>
@@ -186,5 +188,185 @@ std::vector<Tensor> foreach_tensor_norm_cuda(TensorList tensors, const Scalar& o
   return result;
 }
 
+// Fused gradient clipping (see FusedClipGradNorm.cpp for the overall design).
+// The reduction pass reuses LpNormFunctor but collapses the per-chunk
+// partials into a single scalar instead of one value per tensor, and the
+// scale pass reads that scalar straight from global memory so the clip
+// coefficient never has to travel through the host.
+
+namespace {
+
+void check_fused_clip_grad_inputs_cuda(TensorList grads, double norm_type) {
+  check_foreach_api_restrictions(grads);
+  TORCH_CHECK(
+      norm_type == 1.0 || norm_type == 2.0,
+      "_fused_clip_grad_norm_ supports only L1 and L2 norm, got norm_type=",
+      norm_type);
+  for (const auto i : c10::irange(grads.size())) {
+    TORCH_CHECK(
+        grads[i].is_contiguous(),
+        "_fused_clip_grad_norm_ requires contiguous gradient tensors");
+    TORCH_CHECK(
+        at::isFloatingType(grads[i].scalar_type()),
+        "_fused_clip_grad_norm_ requires floating point gradients, got ",
+        grads[i].scalar_type());
+    TORCH_CHECK(
+        grads[i].scalar_type() == grads[0].scalar_type(),
+        "_fused_clip_grad_norm_ requires all gradients to have the same dtype, got ",
+        grads[i].scalar_type(), " and ", grads[0].scalar_type());
+  }
+}
+
+} // namespace
+
+// Unused slots of output_per_tensor are zero-initialized, so the flat array
+// can be summed without knowing each tensor's chunk count.
+template<typename opmath_t>
+__global__ void fused_sq_norm_cleanup(
+    const opmath_t* output_per_tensor,
+    opmath_t* ret,
+    int total_chunks) {
+  __shared__ opmath_t vals[512];
+  opmath_t val = 0;
+  for (int i = threadIdx.x; i < total_chunks; i += blockDim.x) {
+    val += output_per_tensor[i];
+  }
+  opmath_t final = at::native::cuda_utils::BlockReduceSum<opmath_t>(val, vals);
+  if (threadIdx.x == 0) {
+    *ret = final;
+  }
+}
+
+Tensor fused_clip_grad_sq_norm_cuda(TensorList grads, double norm_type) {
+  check_fused_clip_grad_inputs_cuda(grads, norm_type);
+
+  const int ntensors = grads.size();
+  int max_chunks_per_tensor = -1;
+  for (int t = 0; t < ntensors; t++) {
+    int max_chunks_this_tensor = (grads[t].numel() + kChunkSize - 1) / kChunkSize;
+    if (max_chunks_this_tensor > max_chunks_per_tensor) {
+      max_chunks_per_tensor = max_chunks_this_tensor;
+    }
+  }
+  const auto opmath_options =
+      grads[0].options().dtype(toOpMathType(grads[0].scalar_type()));
+  auto output_per_tensor = at::zeros({ntensors*max_chunks_per_tensor}, opmath_options);
+  auto ret = at::empty({}, opmath_options);
+
+  auto tensor_lists = std::vector<std::vector<Tensor>>{grads.vec()};
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+    kHalf, kBFloat16, tensor_lists[0][0].scalar_type(), "fused_clip_grad_sq_norm_cuda", [&]() {
+      using opmath_t = typename at::opmath_type<scalar_t>;
+      if (norm_type == 1.0) {
+        multi_tensor_apply<1>(
+          tensor_lists,
+          LpNormFunctor<scalar_t, 1>(),
+          output_per_tensor.data_ptr<opmath_t>(),
+          max_chunks_per_tensor);
+      } else {
+        multi_tensor_apply<1>(
+          tensor_lists,
+          LpNormFunctor<scalar_t, 2>(),
+          output_per_tensor.data_ptr<opmath_t>(),
+          max_chunks_per_tensor);
+      }
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+      const at::cuda::OptionalCUDAGuard device_guard(device_of(output_per_tensor));
+      auto stream = at::cuda::getCurrentCUDAStream();
+      fused_sq_norm_cleanup<opmath_t><<<1, 512, 0, stream>>>(
+        output_per_tensor.data_ptr<opmath_t>(),
+        ret.data_ptr<opmath_t>(),
+        ntensors*max_chunks_per_tensor);
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+  return ret;
+}
+
+template<typename T, int NormType, int depth=1, int r_args_depth=1, int res_arg_index=0>
+struct ClipGradScaleFunctor {
+  static_assert(NormType == 1 || NormType == 2, "fused_clip_grad supports only L1 and L2 norm");
+  using opmath_t = typename at::opmath_type<T>;
+  __device__ __forceinline__ void operator() (
+      int chunk_size,
+      TensorListMetadata<depth>& tl,
+      const opmath_t* total_pow_norm,
+      opmath_t max_norm
+  ) {
+    int tensor_loc = tl.block_to_tensor[blockIdx.x];
+    int chunk_idx = tl.block_to_chunk[blockIdx.x];
+    int n = tl.numel_for_tensor[tensor_loc];
+
+    T* x = (T*)tl.addresses[0][tensor_loc];
+    x += chunk_idx * chunk_size;
+    n -= chunk_idx * chunk_size;
+
+    // The total norm only materializes on-device (possibly after an
+    // allreduce), so derive the clip coefficient here instead of on the host
+    // and avoid a stream synchronization between the two passes.
+    const opmath_t total_norm =
+        NormType == 1 ? *total_pow_norm : ::sqrt(*total_pow_norm);
+    const opmath_t clip_coef =
+        ::min(max_norm / (total_norm + opmath_t(1e-6)), opmath_t(1));
+
+    T r_x[kILP];
+    if (n % kILP == 0 && (chunk_size & kILP) == 0 && is_aligned(x)) {
+      for (int i_start = threadIdx.x; i_start * kILP < n && i_start * kILP < chunk_size; i_start += blockDim.x) {
+        load_store(r_x, x, 0, i_start);
+#pragma unroll
+        for (int ii = 0; ii < kILP; ii++) {
+          r_x[ii] = static_cast<opmath_t>(r_x[ii]) * clip_coef;
+        }
+        load_store(x, r_x, i_start, 0);
+      }
+    } else {
+      for (int i_start = 0; i_start < n && i_start < chunk_size; i_start += blockDim.x * kILP) {
+#pragma unroll
+        for (int ii = 0; ii < kILP; ii++) {
+          int i = i_start + threadIdx.x + ii * blockDim.x;
+          if (i < n && i < chunk_size) {
+            x[i] = static_cast<opmath_t>(x[i]) * clip_coef;
+          }
+        }
+      }
+    }
+  }
+};
+
+void fused_clip_grad_scale_cuda_(
+    TensorList grads,
+    const Tensor& total_sq_norm,
+    double max_norm,
+    double norm_type) {
+  check_fused_clip_grad_inputs_cuda(grads, norm_type);
+  TORCH_CHECK(
+      total_sq_norm.numel() == 1,
+      "_fused_clip_grad_scale_ expects total_sq_norm to be a scalar tensor, got ",
+      total_sq_norm.numel(), " elements");
+  TORCH_CHECK(
+      total_sq_norm.scalar_type() == toOpMathType(grads[0].scalar_type()),
+      "_fused_clip_grad_scale_ expects total_sq_norm in opmath precision (",
+      toOpMathType(grads[0].scalar_type()), "), got ", total_sq_norm.scalar_type());
+
+  auto tensor_lists = std::vector<std::vector<Tensor>>{grads.vec()};
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+    kHalf, kBFloat16, tensor_lists[0][0].scalar_type(), "fused_clip_grad_scale_cuda", [&]() {
+      using opmath_t = typename at::opmath_type<scalar_t>;
+      if (norm_type == 1.0) {
+        multi_tensor_apply<1>(
+          tensor_lists,
+          ClipGradScaleFunctor<scalar_t, 1>(),
+          total_sq_norm.data_ptr<opmath_t>(),
+          static_cast<opmath_t>(max_norm));
+      } else {
+        multi_tensor_apply<1>(
+          tensor_lists,
+          ClipGradScaleFunctor<scalar_t, 2>(),
+          total_sq_norm.data_ptr<opmath_t>(),
+          static_cast<opmath_t>(max_norm));
+      }
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+}
+
 } // namespace native
 } // namespace at
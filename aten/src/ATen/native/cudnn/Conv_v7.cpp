@@ -20,6 +20,8 @@
 #include <ATen/native/utils/ParamsHash.h>
 
 #include <ATen/TensorUtils.h>
+#include <c10/core/MemoryPressureBroker.h>
+#include <c10/cuda/CUDAStream.h>
 #include <c10/util/irange.h>
 
 #include <functional>
@@ -118,6 +120,20 @@ struct BenchmarkCache {
     std::lock_guard<std::mutex> guard(mutex);
     map[params] = results;
   }
+
+  // Rough host-side footprint, for the memory-pressure broker.
+  size_t approximateBytes() {
+    std::lock_guard<std::mutex> guard(mutex);
+    return map.size() * (sizeof(ConvolutionParams) + sizeof(T));
+  }
+
+  // Drops all cached algorithm choices; returns the approximate bytes freed.
+  size_t clear() {
+    std::lock_guard<std::mutex> guard(mutex);
+    const size_t bytes = map.size() * (sizeof(ConvolutionParams) + sizeof(T));
+    map.clear();
+    return bytes;
+  }
 };
 
 BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos;
@@ -526,12 +542,128 @@ public:
   }
 };
 
-inline Tensor allocate_workspace(size_t size, const Tensor &other) {
-  // Sometimes cuDNN returns a workspace size > 2^63, this could makes the allocation of
-  // workspace fail with some 64bit indexing error instead of an OOM error. In such case,
-  // we manually fail with OOM.
-  TORCH_CHECK_WITH(CUDAOutOfMemoryError, size < 1_TiB, "Not enough memory for workspace!");
-  return at::empty({static_cast<int64_t>(size)}, other.options().dtype(kByte));
+// Convolution workspaces are the dominant source of large-block churn in
+// the caching allocator: every conv call allocates and frees one. Work
+// submitted to a stream executes in order, so a single buffer per stream
+// can back every conv on that stream. The buffer grows to the high-water
+// requirement discovered as the model warms up and is then handed to
+// cuDNN directly with no further allocator traffic; on memory pressure
+// the caching allocator reclaims it through the registered callback.
+class WorkspaceArena {
+ public:
+  static WorkspaceArena& instance() {
+    static WorkspaceArena arena;
+    return arena;
+  }
+
+  void* get(size_t size) {
+    // Sometimes cuDNN returns a workspace size > 2^63, this could makes the
+    // allocation of workspace fail with some 64bit indexing error instead of
+    // an OOM error. In such case, we manually fail with OOM.
+    TORCH_CHECK_WITH(CUDAOutOfMemoryError, size < 1_TiB, "Not enough memory for workspace!");
+    if (size == 0) {
+      return nullptr;
+    }
+    auto stream = c10::cuda::getCurrentCUDAStream();
+    const uint64_t key = (static_cast<uint64_t>(stream.device_index()) << 48) ^
+        static_cast<uint64_t>(stream.id());
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& buffer = buffers_[key];
+    if (buffer.size < size) {
+      if (buffer.data != nullptr) {
+        // Stream-ordered: in-flight convs on this stream may still be
+        // using the old buffer, but the allocator only hands it back to
+        // allocations on the same stream.
+        c10::cuda::CUDACachingAllocator::raw_delete(buffer.data);
+        buffer = Buffer{};
+      }
+      buffer.data = c10::cuda::CUDACachingAllocator::raw_alloc(size);
+      buffer.size = size;
+    }
+    return buffer.data;
+  }
+
+  // Memory-pressure hook; returns the bytes handed back to the allocator.
+  size_t releaseAll() {
+    // try_lock: an OOM inside get()'s raw_alloc re-enters here on the
+    // same thread via the allocator's free-memory callbacks.
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      return 0;
+    }
+    size_t released = 0;
+    for (auto& entry : buffers_) {
+      if (entry.second.data != nullptr) {
+        c10::cuda::CUDACachingAllocator::raw_delete(entry.second.data);
+        released += entry.second.size;
+      }
+    }
+    buffers_.clear();
+    return released;
+  }
+
+  size_t bytesHeld() {
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      return 0;
+    }
+    size_t held = 0;
+    for (const auto& entry : buffers_) {
+      held += entry.second.size;
+    }
+    return held;
+  }
+
+ private:
+  struct Buffer {
+    void* data = nullptr;
+    size_t size = 0;
+  };
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, Buffer> buffers_;
+};
+
+struct WorkspaceArenaCleanup : public c10::FreeMemoryCallback {
+  bool Execute() override {
+    return WorkspaceArena::instance().releaseAll() > 0;
+  }
+};
+
+REGISTER_FREE_MEMORY_CALLBACK("cudnn_conv_workspace_arena", WorkspaceArenaCleanup);
+
+// Plug the cuDNN conv caches into the process-wide memory-pressure broker.
+// The workspace arena is pure allocator capacity and trivially rebuilt, so it
+// goes first under pressure; the benchmark caches are small but take a full
+// re-benchmark pass to refill, so they are priced accordingly.
+struct ConvCacheBrokerRegistration {
+  ConvCacheBrokerRegistration() {
+    auto& broker = c10::MemoryPressureBroker::singleton();
+    broker.registerCache(
+        "cudnn_conv_workspace_arena",
+        /*rebuild_cost=*/1.0,
+        []() { return WorkspaceArena::instance().bytesHeld(); },
+        [](size_t /*bytes_requested*/) {
+          return WorkspaceArena::instance().releaseAll();
+        });
+    broker.registerCache(
+        "cudnn_conv_benchmark_cache",
+        /*rebuild_cost=*/1000.0,
+        []() {
+          return fwd_algos.approximateBytes() +
+              bwd_data_algos.approximateBytes() +
+              bwd_filter_algos.approximateBytes();
+        },
+        [](size_t /*bytes_requested*/) {
+          return fwd_algos.clear() + bwd_data_algos.clear() +
+              bwd_filter_algos.clear();
+        });
+  }
+};
+
+ConvCacheBrokerRegistration conv_cache_broker_registration;
+
+inline void* allocate_workspace(size_t size) {
+  return WorkspaceArena::instance().get(size);
 }
 
 // NOTE [ raw_cudnn_convolution_forward_out ]
@@ -642,7 +774,7 @@ void raw_cudnn_convolution_forward_out_32bit(
   // matter.  (This applies to raw_cudnn_convolution_backward_input as well.)
   AlgoIterator<cudnnConvolutionFwdAlgoPerf_t>(args, benchmark).try_all(
     [&](const cudnnConvolutionFwdAlgoPerf_t &fwdAlgPerf){
-      Tensor workspace = allocate_workspace(fwdAlgPerf.memory, input);
+      void* workspace = allocate_workspace(fwdAlgPerf.memory);
 
       // update convDesc mathType since cudnn 7.4+ now requires both algo + mathType to figure out
       // whether to use Tensor core kernels or not
@@ -657,7 +789,7 @@ void raw_cudnn_convolution_forward_out_32bit(
           args.handle,
           &one, args.idesc.desc(), input.data_ptr(),
           args.wdesc.desc(), weight.data_ptr(),
-          args.cdesc.desc(), fwdAlgPerf.algo, workspace.data_ptr(), fwdAlgPerf.memory,
+          args.cdesc.desc(), fwdAlgPerf.algo, workspace, fwdAlgPerf.memory,
           &zero, args.odesc.desc(), output.data_ptr()),
         args, "Forward algorithm: ", static_cast<int>(fwdAlgPerf.algo), "\n");
       }
@@ -701,7 +833,7 @@ void raw_cudnn_convolution_backward_input_out_32bit(
 
   AlgoIterator<cudnnConvolutionBwdDataAlgoPerf_t>(args, benchmark).try_all(
     [&](const cudnnConvolutionBwdDataAlgoPerf_t &bwdDataAlgPerf){
-      Tensor workspace = allocate_workspace(bwdDataAlgPerf.memory, grad_output);
+      void* workspace = allocate_workspace(bwdDataAlgPerf.memory);
 
       // update convDesc mathType since cudnn 7.4+ now requires both algo + mathType to figure out
       // whether to use Tensor core kernels or not
@@ -716,7 +848,7 @@ void raw_cudnn_convolution_backward_input_out_32bit(
           args.handle,
           &one, args.wdesc.desc(), weight.data_ptr(),
           args.odesc.desc(), grad_output.data_ptr(),
-          args.cdesc.desc(), bwdDataAlgPerf.algo, workspace.data_ptr(), bwdDataAlgPerf.memory,
+          args.cdesc.desc(), bwdDataAlgPerf.algo, workspace, bwdDataAlgPerf.memory,
           &zero, args.idesc.desc(), grad_input.data_ptr()),
         args,
         "Additional pointer addresses: \n",
@@ -764,7 +896,7 @@ void raw_cudnn_convolution_backward_weight_out_32bit(
 
   AlgoIterator<cudnnConvolutionBwdFilterAlgoPerf_t>(args, benchmark).try_all(
     [&](const cudnnConvolutionBwdFilterAlgoPerf_t &bwdFilterAlgPerf){
-      Tensor workspace = allocate_workspace(bwdFilterAlgPerf.memory, input);
+      void* workspace = allocate_workspace(bwdFilterAlgPerf.memory);
 
       // update convDesc mathType since cudnn 7.4+ now requires both algo + mathType to figure out
       // whether to use Tensor core kernels or not
@@ -779,7 +911,7 @@ void raw_cudnn_convolution_backward_weight_out_32bit(
           args.handle,
           &one, args.idesc.desc(), input.data_ptr(),
           args.odesc.desc(), grad_output.data_ptr(),
-          args.cdesc.desc(), bwdFilterAlgPerf.algo, workspace.data_ptr(), bwdFilterAlgPerf.memory,
+          args.cdesc.desc(), bwdFilterAlgPerf.algo, workspace, bwdFilterAlgPerf.memory,
           &zero, args.wdesc.desc(), grad_weight.data_ptr()),
         args,
         "Additional pointer addresses: \n",
@@ -902,7 +1034,7 @@ void raw_cudnn_convolution_add_relu_out_v7(
 
   AlgoIterator<cudnnConvolutionFwdAlgoPerf_t>(args, benchmark)
       .try_all([&](const cudnnConvolutionFwdAlgoPerf_t& fwdAlgPerf) {
-        Tensor workspace = allocate_workspace(fwdAlgPerf.memory, input);
+        void* workspace = allocate_workspace(fwdAlgPerf.memory);
 
         // update convDesc mathType since cudnn 7.4+ now requires both algo +
         // mathType to figure out whether to use Tensor core kernels or not See
@@ -926,7 +1058,7 @@ void raw_cudnn_convolution_add_relu_out_v7(
                 weight.data_ptr(),
                 args.cdesc.desc(),
                 fwdAlgPerf.algo,
-                workspace.data_ptr(),
+                workspace,
                 fwdAlgPerf.memory,
                 &alpha_,
                 zdesc.desc(),
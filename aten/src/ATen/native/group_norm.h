@@ -8,7 +8,7 @@ class Tensor;
 
 namespace native {
 
-using forward_fn = void (*)(
+using group_norm_fn = void (*)(
     const Tensor& /* X */,
     const Tensor& /* gamma */,
     const Tensor& /* beta */,
@@ -21,7 +21,7 @@ using forward_fn = void (*)(
     Tensor& /* mean */,
     Tensor& /* rstd */);
 
-using backward_fn = void (*)(
+using group_norm_backward_fn = void (*)(
     const Tensor& /* dY */,
     const Tensor& /* X */,
     const Tensor& /* mean */,
@@ -35,8 +35,8 @@ using backward_fn = void (*)(
     Tensor& /* dgamma */,
     Tensor& /* dbeta */);
 
-DECLARE_DISPATCH(forward_fn, GroupNormKernel);
-DECLARE_DISPATCH(backward_fn, GroupNormBackwardKernel);
+DECLARE_DISPATCH(group_norm_fn, GroupNormKernel);
+DECLARE_DISPATCH(group_norm_backward_fn, GroupNormBackwardKernel);
 
 } // namespace native
 } // namespace at
@@ -241,5 +241,97 @@ std::tuple<Tensor, Tensor, Tensor> math_native_layer_norm(
   rstd = rstd.view(stat_shape);
   return std::make_tuple(out, mean, rstd);
 }
+
+// Fused dropout + residual add + layer_norm for the transformer residual
+// path. Running the three ops behind one dispatch folds the dropout scaling
+// and the residual add into a single addcmul pass over the activations, and
+// keeps the pre-norm activation a temporary: the backward recomputes it from
+// the saved mask instead of autograd saving it, so the residual path keeps
+// one fewer full-size activation alive during training.
+std::tuple<Tensor, Tensor, Tensor, Tensor> _fused_dropout_add_layer_norm(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    double eps) {
+  TORCH_CHECK(
+      p >= 0 && p < 1,
+      "_fused_dropout_add_layer_norm: dropout probability has to be in [0, 1), but got ",
+      p);
+  TORCH_CHECK(
+      input.sizes() == residual.sizes(),
+      "_fused_dropout_add_layer_norm: expected input and residual to have the same shape, but got ",
+      input.sizes(),
+      " and ",
+      residual.sizes());
+
+  Tensor mask;
+  Tensor x;
+  if (train && p > 0) {
+    const double scale = 1.0 / (1.0 - p);
+    mask = at::empty_like(input).bernoulli_(1.0 - p);
+    // Single pass: x = residual + mask * input * scale.
+    x = at::addcmul(residual, input, mask, scale);
+  } else {
+    // Dropout is a no-op; an empty mask marks this for the backward.
+    mask = at::empty({0}, input.options());
+    x = input + residual;
+  }
+  auto outs =
+      at::native_layer_norm(x, normalized_shape, weight_opt, bias_opt, eps);
+  return std::make_tuple(
+      std::move(std::get<0>(outs)),
+      std::move(mask),
+      std::move(std::get<1>(outs)),
+      std::move(std::get<2>(outs)));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor>
+_fused_dropout_add_layer_norm_backward(
+    const Tensor& grad_out,
+    const Tensor& input,
+    const Tensor& residual,
+    const Tensor& mask,
+    const Tensor& mean,
+    const Tensor& rstd,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    std::array<bool, 4> output_mask) {
+  const bool dropout_active = train && p > 0 && mask.numel() > 0;
+  const double scale = dropout_active ? 1.0 / (1.0 - p) : 1.0;
+  // Recompute the pre-norm activation from the mask rather than saving it in
+  // the forward; this is where the fused op's memory saving comes from.
+  Tensor x = dropout_active ? at::addcmul(residual, input, mask, scale)
+                            : input + residual;
+  auto grads = at::native_layer_norm_backward(
+      grad_out,
+      x,
+      normalized_shape,
+      mean,
+      rstd,
+      weight_opt,
+      bias_opt,
+      {output_mask[0] || output_mask[1], output_mask[2], output_mask[3]});
+  Tensor dx = std::get<0>(grads);
+  Tensor d_input;
+  Tensor d_residual;
+  if (output_mask[1]) {
+    d_residual = dx;
+  }
+  if (output_mask[0]) {
+    d_input = dropout_active ? at::mul(dx, mask).mul_(scale) : dx;
+  }
+  return std::make_tuple(
+      std::move(d_input),
+      std::move(d_residual),
+      std::move(std::get<1>(grads)),
+      std::move(std::get<2>(grads)));
+}
 } // namespace native
 } // namespace at
@@ -37,9 +37,14 @@ REGISTER_NO_CPU_DISPATCH(mkldnn_convolution_backward_stub);
 
 #else // AT_MKLDNN_ENABLED
 
+#include <ATen/Parallel.h>
 #include <ATen/native/mkldnn/MKLDNNCommon.h>
 #include <ATen/native/mkldnn/Utils.h>
 #include <ATen/native/ConvUtils.h>
+#include <c10/core/GradMode.h>
+#include <c10/util/hash.h>
+
+#include <list>
 
 namespace at { namespace native {
 
@@ -68,6 +73,9 @@ namespace at { namespace native {
 //  weight reorder: OHWI(user) -> Blocked(internal)
 //  output view:    NHWC(internal) -> NHWC(user)
 //
+//  3d convolution on channels last (3d) tensors follows the same pattern
+//  with NDHWC/ODHWI layouts.
+//
 // 3. Blocked (MKLDNN tensor):
 //  By explicitly converting a tensor to mkldnn, e.g. `x.to_mkldnn()`,
 //  blocked format will propagate between layers. Input, output will be in blocked format.
@@ -80,6 +88,194 @@ namespace at { namespace native {
 //  but weight/bias and grad_weight/grad_bias are always CPU tensor.
 //
 
+namespace {
+
+// Transparent cache of conv weights prepacked into the blocked layout oneDNN
+// selects, so that repeated inference calls with a plain dense weight don't
+// pay the OIHW -> Blocked reorder on every call (see Note [MKLDNN Convolution
+// Memory Formats]: that reorder is ~20% of CNN inference when the model has
+// not been converted with to_mkldnn()).
+//
+// The key covers everything the layout decision depends on -- weight
+// geometry, the conv parameters and the intra-op thread count -- plus the
+// weight's data pointer and version. Neither the pointer nor the version
+// value proves identity on its own (the allocator recycles addresses and a
+// fresh tensor starts over at version 0), so each entry also holds a weak
+// reference to the weight's StorageImpl and the key records which version
+// counter produced the version; a hit must lock that weak reference to the
+// storage currently behind the weight, otherwise the entry is known stale
+// and dropped. Weights that are reallocated or updated in place thus miss
+// the cache and their stale entries age out. Eviction is LRU by bytes; the
+// budget comes from PYTORCH_MKLDNN_CONV_PREPACK_CACHE_MB (0 disables the
+// cache).
+struct ConvPrepackedWeightCache {
+  struct Key {
+    const void* data;
+    uint32_t version;
+    uintptr_t counter_id;
+    std::vector<int64_t> weight_sizes;
+    std::vector<int64_t> stride;
+    std::vector<int64_t> dilation;
+    std::vector<int64_t> padding;
+    int64_t groups;
+    ScalarType dtype;
+    int num_threads;
+
+    bool operator==(const Key& other) const {
+      return data == other.data && version == other.version &&
+          counter_id == other.counter_id &&
+          weight_sizes == other.weight_sizes && stride == other.stride &&
+          dilation == other.dilation && padding == other.padding &&
+          groups == other.groups && dtype == other.dtype &&
+          num_threads == other.num_threads;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return c10::get_hash(
+          key.data,
+          key.version,
+          key.counter_id,
+          key.weight_sizes,
+          key.stride,
+          key.dilation,
+          key.padding,
+          key.groups,
+          key.dtype,
+          key.num_threads);
+    }
+  };
+
+  static size_t max_bytes() {
+    static size_t max_bytes_ = []() -> size_t {
+      auto* env = std::getenv("PYTORCH_MKLDNN_CONV_PREPACK_CACHE_MB");
+      // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+      size_t mb = env ? std::strtoul(env, nullptr, 10) : 256;
+      return mb * 1024 * 1024;
+    }();
+    return max_bytes_;
+  }
+
+  // Returns the prepacked copy of `w`, reordering and caching it on the
+  // first call. `storage` identifies the aten weight backing `w`; a matching
+  // key only counts as a hit while that storage is still alive. `w` is
+  // returned unchanged when the blocked layout would not fit in the cache at
+  // all.
+  ideep::tensor get(const Key& key, const Storage& storage, const ideep::tensor& w) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = map_.find(key);
+      if (it != map_.end()) {
+        // The key alone cannot distinguish the original weight from a new
+        // tensor that inherited its recycled address: require the entry's
+        // weak reference to resolve to the storage we were handed.
+        auto held = it->second->storage.lock();
+        if (held && held.get() == storage.unsafeGetStorageImpl()) {
+          // move to the front of the LRU list
+          lru_.splice(lru_.begin(), lru_, it->second);
+          return it->second->weight;
+        }
+        // stale entry for a dead weight; drop it and repack below
+        bytes_ -= it->second->bytes;
+        lru_.erase(it->second);
+        map_.erase(it);
+      }
+    }
+
+    // prepack outside the lock; on a race the last thread's copy wins
+    auto desc =
+        ideep::convolution_forward::expected_weights_desc(
+            w.get_dims(),
+            w.get_data_type(),
+            {key.stride.begin(), key.stride.end()},
+            {key.padding.begin(), key.padding.end()},
+            {key.padding.begin(), key.padding.end()},
+            {key.dilation.begin(), key.dilation.end()},
+            key.groups,
+            ideep::algorithm::convolution_direct);
+    size_t bytes = desc.get_size();
+    if (bytes > max_bytes()) {
+      return w;
+    }
+    ideep::tensor packed;
+    packed.init(desc);
+    packed.feed_from(w);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it != map_.end()) {
+      bytes_ -= it->second->bytes;
+      lru_.erase(it->second);
+      map_.erase(it);
+    }
+    while (bytes_ + bytes > max_bytes() && !lru_.empty()) {
+      bytes_ -= lru_.back().bytes;
+      map_.erase(lru_.back().key);
+      lru_.pop_back();
+    }
+    lru_.push_front(Entry{key, packed, bytes, storage.getWeakStorageImpl()});
+    map_.emplace(key, lru_.begin());
+    bytes_ += bytes;
+    return packed;
+  }
+
+ private:
+  struct Entry {
+    Key key;
+    ideep::tensor weight;
+    size_t bytes;
+    // Keeps the entry tied to the weight it was packed from without keeping
+    // the weight alive; expires when the weight's storage is freed.
+    c10::weak_intrusive_ptr<c10::StorageImpl> storage;
+  };
+
+  std::list<Entry> lru_; // front is most recently used
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> map_;
+  size_t bytes_ = 0;
+  std::mutex mutex_;
+};
+
+ConvPrepackedWeightCache& conv_prepacked_weight_cache() {
+  static ConvPrepackedWeightCache cache;
+  return cache;
+}
+
+// Prepacking is transparent only when the weight's values cannot change
+// under us within one cache generation: dense weights are snapshotted by
+// (data pointer, version, counter identity) and pinned to their live
+// storage, but a weight that still needs its original
+// layout for autograd is left alone, as are mkldnn weights the user has
+// already prepacked explicitly.
+bool can_use_prepacked_weight_cache(const Tensor& weight) {
+  return ConvPrepackedWeightCache::max_bytes() > 0 && !weight.is_mkldnn() &&
+      !(c10::GradMode::is_enabled() && weight.requires_grad());
+}
+
+ideep::tensor get_prepacked_weight(
+    const Tensor& weight,
+    const ideep::tensor& w,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups) {
+  const auto& version_counter = weight.unsafeGetTensorImpl()->version_counter();
+  ConvPrepackedWeightCache::Key key{
+      weight.data_ptr(),
+      version_counter.current_version(),
+      version_counter.counter_id(),
+      weight.sizes().vec(),
+      stride.vec(),
+      dilation.vec(),
+      padding.vec(),
+      groups,
+      weight.scalar_type(),
+      at::get_num_threads()};
+  return conv_prepacked_weight_cache().get(key, weight.storage(), w);
+}
+
+} // namespace
+
 Tensor mkldnn_convolution(
     const Tensor& input,
     const Tensor& weight, const c10::optional<Tensor>& bias_opt,
@@ -96,13 +292,18 @@ Tensor mkldnn_convolution(
         "mkldnn_convolution: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
   }
 
-  bool is_channels_last = input.suggest_memory_format() == at::MemoryFormat::ChannelsLast;
+  auto memory_format = input.suggest_memory_format();
+  bool is_channels_last = memory_format == at::MemoryFormat::ChannelsLast ||
+      memory_format == at::MemoryFormat::ChannelsLast3d;
 
   auto output_sizes = conv_output_size(input.sizes(), weight.sizes(), padding, stride, dilation);
   auto output = at::empty({0}, input.options());
 
   const ideep::tensor x = itensor_from_tensor(input);
-  const ideep::tensor w = itensor_from_tensor(weight);
+  ideep::tensor w = itensor_from_tensor(weight);
+  if (can_use_prepacked_weight_cache(weight)) {
+    w = get_prepacked_weight(weight, w, padding, stride, dilation, groups);
+  }
 
   ideep::tensor y;
   if (is_channels_last) {
@@ -140,7 +341,7 @@ Tensor mkldnn_convolution(
   } else if (!is_channels_last) {
     return mkldnn_to_dense(MKLDNNTensor(y, input.options()));
   } else {
-    TORCH_INTERNAL_ASSERT(y.get_desc().is_nhwc());
+    TORCH_INTERNAL_ASSERT(y.get_desc().is_nhwc() || y.get_desc().is_ndhwc());
     return output;
   }
 }
@@ -149,7 +350,9 @@ Tensor mkldnn_convolution_backward_input(
     IntArrayRef input_size, const Tensor& grad_output, const Tensor& weight,
     IntArrayRef padding, IntArrayRef stride, IntArrayRef dilation, int64_t groups, bool bias_defined)
 {
-  bool is_channels_last = grad_output.suggest_memory_format() == at::MemoryFormat::ChannelsLast;
+  auto memory_format = grad_output.suggest_memory_format();
+  bool is_channels_last = memory_format == at::MemoryFormat::ChannelsLast ||
+      memory_format == at::MemoryFormat::ChannelsLast3d;
   auto grad_input = at::empty({0}, grad_output.options());
 
   auto grad_y = itensor_from_tensor(grad_output);
@@ -176,7 +379,8 @@ Tensor mkldnn_convolution_backward_input(
   } else if (!is_channels_last){
     return mkldnn_to_dense(MKLDNNTensor(grad_x, grad_output.options()));
   } else {
-    TORCH_INTERNAL_ASSERT(grad_x.get_desc().is_nhwc());
+    TORCH_INTERNAL_ASSERT(
+        grad_x.get_desc().is_nhwc() || grad_x.get_desc().is_ndhwc());
     return grad_input;
   }
 }
@@ -185,7 +389,9 @@ std::tuple<Tensor, Tensor> mkldnn_convolution_backward_weights(
     IntArrayRef weight_size, const Tensor& grad_output, const Tensor& input,
     IntArrayRef padding, IntArrayRef stride, IntArrayRef dilation, int64_t groups, bool bias_defined)
 {
-  bool is_channels_last = grad_output.suggest_memory_format() == at::MemoryFormat::ChannelsLast;
+  auto memory_format = grad_output.suggest_memory_format();
+  bool is_channels_last = memory_format == at::MemoryFormat::ChannelsLast ||
+      memory_format == at::MemoryFormat::ChannelsLast3d;
 
   const ideep::tensor grad_y = itensor_from_tensor(grad_output);
   const ideep::tensor x = itensor_from_tensor(input);
@@ -222,7 +428,7 @@ std::tuple<Tensor, Tensor> mkldnn_convolution_backward_weights(
         bias_defined ? mkldnn_to_dense(MKLDNNTensor(grad_b, grad_output.options())) : Tensor());
   } else {
     return std::make_tuple(
-        mkldnn_to_dense(MKLDNNTensor(grad_w, grad_output.options())).to(at::MemoryFormat::ChannelsLast),
+        mkldnn_to_dense(MKLDNNTensor(grad_w, grad_output.options())).to(memory_format),
         bias_defined ? mkldnn_to_dense(MKLDNNTensor(grad_b, grad_output.options())) : Tensor());
   }
 }
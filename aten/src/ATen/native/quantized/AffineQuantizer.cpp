@@ -142,7 +142,8 @@ Tensor& quantize_tensor_per_channel_affine(
   checkSameDevice(fn_name, rtensor, qtensor);
   checkSameSize(fn_name, qtensor, rtensor);
 
-  AT_DISPATCH_QINT_TYPES(qtensor.scalar_type(), fn_name, [&]() {
+  // NOLINTNEXTLINE(clang-diagnostic-unused-variable)
+  AT_DISPATCH_QINT_AND_SUB_BYTE_TYPES(qtensor.scalar_type(), fn_name, [&]() {
     checkQuantizedTensor<scalar_t>(fn_name, qtensor);
     if(qtensor.device().type() != c10::DeviceType::CUDA){
       checkZeroPoints<underlying_t>(fn_name, zero_points);
@@ -246,7 +247,8 @@ Tensor& dequantize_tensor_per_channel_affine(
   checkSameDevice(fn_name, rtensor, qtensor);
   checkSameSize(fn_name, qtensor, rtensor);
 
-  AT_DISPATCH_QINT_TYPES(qtensor.scalar_type(), fn_name, [&]() {
+  // NOLINTNEXTLINE(clang-diagnostic-unused-variable)
+  AT_DISPATCH_QINT_AND_SUB_BYTE_TYPES(qtensor.scalar_type(), fn_name, [&]() {
     checkQuantizedTensor<scalar_t>(fn_name, qtensor);
     if(qtensor.device().type() != c10::DeviceType::CUDA){
       checkZeroPoints<underlying_t>(fn_name, zero_points);
@@ -3380,6 +3380,81 @@ void quantize_tensor_per_channel_affine_cpu(
       rtensor.is_contiguous() || (axis <= 1),
       "If tensor is channels_last contig then per channel quantization "
       "is supported only for axis = 0 or 1.");
+
+  // Sub-byte dtypes pack several values per byte, which the vectorized 8-bit
+  // implementations cannot produce; quantize and pack in one scalar pass
+  // instead, mirroring quantize_tensor_per_channel_float_qparams_cpu.
+  if (qtensor.scalar_type() == at::ScalarType::QUInt4x2 ||
+      qtensor.scalar_type() == at::ScalarType::QUInt2x4) {
+    AT_DISPATCH_QINT_AND_SUB_BYTE_TYPES(
+        qtensor.scalar_type(),
+        "quantize_tensor_per_channel_affine_cpu",
+        [&]() {
+          check_tensor_memory_format(rtensor, qtensor);
+          int64_t batches = size_to_dim_(axis, rtensor.sizes());
+          int64_t elements_per_channel =
+              size_from_dim_(axis + 1, rtensor.sizes());
+          int64_t channels = rtensor.size(axis);
+          auto scales_data = scales.data_ptr<double>();
+          auto zero_points_data = zero_points.data_ptr<int64_t>();
+          const float* rdata = rtensor.data_ptr<float>();
+          auto qdata =
+              reinterpret_cast<underlying_t*>(qtensor.data_ptr<scalar_t>());
+          const auto elem_per_byte = CHAR_BIT / bit_width;
+          int qvalue = 0;
+          if (axis == 1 &&
+              (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
+               rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
+            for (const auto b : c10::irange(batches)) {
+              for (const auto e : c10::irange(elements_per_channel)) {
+                for (const auto c : c10::irange(channels)) {
+                  auto i =
+                      b * channels * elements_per_channel + e * channels + c;
+                  qvalue = quantize_val_float_qparams(
+                      scales_data[c],
+                      zero_points_data[c],
+                      rdata[i],
+                      quant_min,
+                      quant_max);
+                  // NOLINTNEXTLINE(clang-analyzer-core.DivideZero)
+                  if (i % elem_per_byte == 0) {
+                    qdata[i / elem_per_byte] =
+                        static_cast<underlying_t>(qvalue);
+                  } else {
+                    qdata[i / elem_per_byte] |= static_cast<underlying_t>(
+                        qvalue << ((i % elem_per_byte) * bit_width));
+                  }
+                }
+              }
+            }
+          } else {
+            for (const auto b : c10::irange(batches)) {
+              for (const auto c : c10::irange(channels)) {
+                for (const auto e : c10::irange(elements_per_channel)) {
+                  auto i = b * channels * elements_per_channel +
+                      c * elements_per_channel + e;
+                  qvalue = quantize_val_float_qparams(
+                      scales_data[c],
+                      zero_points_data[c],
+                      rdata[i],
+                      quant_min,
+                      quant_max);
+                  // NOLINTNEXTLINE(clang-analyzer-core.DivideZero)
+                  if (i % elem_per_byte == 0) {
+                    qdata[i / elem_per_byte] =
+                        static_cast<underlying_t>(qvalue);
+                  } else {
+                    qdata[i / elem_per_byte] |= static_cast<underlying_t>(
+                        qvalue << ((i % elem_per_byte) * bit_width));
+                  }
+                }
+              }
+            }
+          }
+        });
+    return;
+  }
+
   AT_DISPATCH_QINT_TYPES(
       qtensor.scalar_type(), "quantize_tensor_per_channel_affine_cpu", [&]() {
         check_tensor_memory_format(rtensor, qtensor);
@@ -3460,9 +3535,10 @@ void dequantize_tensor_per_channel_affine_cpu(
     const Tensor& scales,
     const Tensor& zero_points,
     int64_t axis) {
-  AT_DISPATCH_QINT_TYPES(
+  // NOLINTNEXTLINE(clang-diagnostic-unused-variable)
+  AT_DISPATCH_QINT_AND_SUB_BYTE_TYPES(
       qtensor.scalar_type(), "dequantize_tensor_per_channel_affine_cpu", [&]() {
-        dequantize_per_channel_affine_kernel<double, int64_t, scalar_t>(qtensor, rtensor, scales, zero_points, axis);
+        dequantize_per_channel_affine_kernel<double, int64_t, scalar_t>(qtensor, rtensor, scales, zero_points, axis, bit_width);
       });
 }
 
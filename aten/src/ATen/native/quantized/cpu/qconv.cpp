@@ -1,10 +1,12 @@
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <vector>
 
 #include <ATen/ATen.h>
 #include <ATen/Parallel.h>
 #include <ATen/SmallVector.h>
+#include <ATen/native/quantized/AffineQuantizer.h>
 #include <ATen/native/quantized/PackedParams.h>
 #include <ATen/native/quantized/cpu/fbgemm_utils.h>
 #include <ATen/native/quantized/cpu/QnnpackUtils.h>
@@ -1391,6 +1393,172 @@ class QConv1dInt8 final {
   }
 };
 
+// Fused post-op chain ("epilogue") applied to the requantized conv output in
+// a single pass. The convolution runs through the regular backend
+// (fbgemm/qnnpack/onednn) and requantizes to the final scale/zero point; the
+// epilogue then transforms the quantized output in place. A chain without a
+// residual add collapses into a 256-entry lookup table, so an arbitrarily
+// long hardswish/clamp/leaky_relu sequence costs one pass over the output
+// instead of a dequantize/requantize round trip per op.
+struct QConvEpilogueOp {
+  enum class Kind { Add, Clamp, Hardswish, LeakyRelu };
+  Kind kind;
+  float alpha = 0.f;
+  float beta = 0.f;
+};
+
+std::vector<QConvEpilogueOp> parse_conv_epilogue(
+    const torch::List<std::string>& ops,
+    const torch::List<double>& args,
+    bool has_accum) {
+  std::vector<QConvEpilogueOp> chain;
+  size_t arg_idx = 0;
+  const auto next_arg = [&](const std::string& op) {
+    TORCH_CHECK(
+        arg_idx < args.size(),
+        "quantized::conv2d_epilogue: missing argument for epilogue op '",
+        op,
+        "'");
+    return static_cast<float>(args.get(arg_idx++));
+  };
+  for (const auto i : c10::irange(ops.size())) {
+    const std::string op = ops.get(i);
+    if (op == "add") {
+      TORCH_CHECK(
+          i == 0,
+          "quantized::conv2d_epilogue: the residual 'add' must be the first "
+          "epilogue op");
+      TORCH_CHECK(
+          has_accum,
+          "quantized::conv2d_epilogue: 'add' requires the accum tensor");
+      chain.push_back({QConvEpilogueOp::Kind::Add});
+    } else if (op == "clamp") {
+      const auto lo = next_arg(op);
+      const auto hi = next_arg(op);
+      chain.push_back({QConvEpilogueOp::Kind::Clamp, lo, hi});
+    } else if (op == "hardswish") {
+      chain.push_back({QConvEpilogueOp::Kind::Hardswish});
+    } else if (op == "leaky_relu") {
+      chain.push_back({QConvEpilogueOp::Kind::LeakyRelu, next_arg(op)});
+    } else {
+      TORCH_CHECK(
+          false,
+          "quantized::conv2d_epilogue: unsupported epilogue op '",
+          op,
+          "'");
+    }
+  }
+  TORCH_CHECK(
+      arg_idx == args.size(),
+      "quantized::conv2d_epilogue: got ",
+      args.size(),
+      " epilogue arguments but the epilogue ops only consume ",
+      arg_idx);
+  TORCH_CHECK(
+      !has_accum || (!chain.empty() && chain[0].kind == QConvEpilogueOp::Kind::Add),
+      "quantized::conv2d_epilogue: accum tensor provided but the epilogue "
+      "has no 'add'");
+  return chain;
+}
+
+inline float apply_conv_epilogue_unary(
+    float x,
+    const std::vector<QConvEpilogueOp>& chain,
+    size_t start) {
+  for (size_t i = start; i < chain.size(); ++i) {
+    const auto& op = chain[i];
+    switch (op.kind) {
+      case QConvEpilogueOp::Kind::Clamp:
+        x = std::min(std::max(x, op.alpha), op.beta);
+        break;
+      case QConvEpilogueOp::Kind::Hardswish:
+        x = x * std::min(std::max(x + 3.f, 0.f), 6.f) / 6.f;
+        break;
+      case QConvEpilogueOp::Kind::LeakyRelu:
+        x = x >= 0.f ? x : op.alpha * x;
+        break;
+      case QConvEpilogueOp::Kind::Add:
+        TORCH_INTERNAL_ASSERT(false, "residual add is handled by the caller");
+    }
+  }
+  return x;
+}
+
+template <int kSpatialDim>
+class QConvEpilogueInt8 final {
+ public:
+  static Tensor run(
+      Tensor act,
+      c10::optional<Tensor> accum,
+      const c10::intrusive_ptr<ConvPackedParamsBase<kSpatialDim>>& packed_weight,
+      torch::List<std::string> epilogue_ops,
+      torch::List<double> epilogue_args,
+      double output_scale,
+      int64_t output_zero_point) {
+    const bool has_accum = accum.has_value() && accum->defined();
+    const auto chain =
+        parse_conv_epilogue(epilogue_ops, epilogue_args, has_accum);
+    at::Tensor out = packed_weight->apply(act, output_scale, output_zero_point);
+    if (chain.empty()) {
+      return out;
+    }
+    TORCH_CHECK(
+        out.scalar_type() == c10::kQUInt8,
+        "quantized::conv2d_epilogue: expected quint8 conv output, got ",
+        out.scalar_type());
+
+    const float scale = static_cast<float>(output_scale);
+    const auto zero_point = static_cast<int32_t>(output_zero_point);
+    auto* out_data = reinterpret_cast<uint8_t*>(out.data_ptr<c10::quint8>());
+    const int64_t numel = out.numel();
+
+    if (chain[0].kind == QConvEpilogueOp::Kind::Add) {
+      at::Tensor accum_contig = accum->contiguous(out.suggest_memory_format());
+      TORCH_CHECK(
+          accum_contig.sizes() == out.sizes(),
+          "quantized::conv2d_epilogue: accum shape ",
+          accum_contig.sizes(),
+          " must match the conv output shape ",
+          out.sizes());
+      TORCH_CHECK(
+          accum_contig.scalar_type() == c10::kQUInt8,
+          "quantized::conv2d_epilogue: expected quint8 accum, got ",
+          accum_contig.scalar_type());
+      const float accum_scale = static_cast<float>(accum_contig.q_scale());
+      const auto accum_zero_point =
+          static_cast<int32_t>(accum_contig.q_zero_point());
+      const auto* accum_data =
+          reinterpret_cast<const uint8_t*>(accum_contig.data_ptr<c10::quint8>());
+      at::parallel_for(0, numel, 4096, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          float x = (static_cast<int32_t>(out_data[i]) - zero_point) * scale +
+              (static_cast<int32_t>(accum_data[i]) - accum_zero_point) *
+                  accum_scale;
+          x = apply_conv_epilogue_unary(x, chain, /*start=*/1);
+          out_data[i] =
+              at::native::quantize_val<c10::quint8>(scale, zero_point, x).val_;
+        }
+      });
+    } else {
+      // Purely unary chain: precompute the quantized output for each of the
+      // 256 possible conv output values and apply the table in place.
+      std::array<uint8_t, 256> lut;
+      for (const auto q : c10::irange(256)) {
+        float x = (static_cast<int32_t>(q) - zero_point) * scale;
+        x = apply_conv_epilogue_unary(x, chain, /*start=*/0);
+        lut[q] =
+            at::native::quantize_val<c10::quint8>(scale, zero_point, x).val_;
+      }
+      at::parallel_for(0, numel, 8192, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          out_data[i] = lut[out_data[i]];
+        }
+      });
+    }
+    return out;
+  }
+};
+
 // kernel for maintaining backward compatibility
 template <int kSpatialDim, bool kReluFused>
 class QConvInt8ForBC final {
@@ -1425,6 +1593,7 @@ TORCH_LIBRARY_IMPL(quantized, QuantizedCPU, m) {
   m.impl(TORCH_SELECTIVE_NAME("quantized::conv1d_relu"),     QConv1dInt8<true>::run);
   m.impl(TORCH_SELECTIVE_NAME("quantized::conv2d.new"),      QConvInt8<2, false>::run);
   m.impl(TORCH_SELECTIVE_NAME("quantized::conv2d_relu.new"), QConvInt8<2, true>::run);
+  m.impl(TORCH_SELECTIVE_NAME("quantized::conv2d_epilogue"), QConvEpilogueInt8<2>::run);
   m.impl(TORCH_SELECTIVE_NAME("quantized::conv3d.new"),      QConvInt8<3, false>::run);
   m.impl(TORCH_SELECTIVE_NAME("quantized::conv3d_relu.new"), QConvInt8<3, true>::run);
   // for backward compatibility
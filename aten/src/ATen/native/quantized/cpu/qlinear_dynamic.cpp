@@ -242,9 +242,6 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
   // C(output) = A(input) x B(weight), where C, A, B are M x N, M x K, K x N
   // matrices, respectively.
 
-  // Weight packing is not thread safe
-  std::lock_guard<std::mutex> lock(qnnp_mutex_);
-  auto packB = w.get();
   size_t rows_w = bias_.size(0);
   size_t cols_w = input_contig.size(input_contig.dim() - 1);
 
@@ -256,14 +253,17 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
   const float* bias_ptr = bias_contig.data_ptr<float>();
 
   // Calculate statistics for quantization of input Tensor
-  // TODO: optimized kernel
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_min;
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   float x_max;
   if (input.numel() > 0) {
-    x_min = input_contig.min().item<float>();
-    x_max = input_contig.max().item<float>();
+    Tensor input_min, input_max;
+    // Single fused pass over the input instead of separate min and max
+    // reductions.
+    std::tie(input_min, input_max) = at::aminmax(input_contig);
+    x_min = input_min.item<float>();
+    x_max = input_max.item<float>();
   } else {
     // On empty input, no output data will be generated,
     // so use arbitrary qparams.
@@ -276,56 +276,67 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
       /*max=*/x_max,
       /*qmin=*/0,
       /*qmax=*/255);
-  float* weight_scales_data = w_scales.data_ptr<float>();
 
-  if (!input_scale.has_value() || input_scale.value() != q_params.scale) {
-    generate_requantization_scales(
-        // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
-        w_scales,
-        q_params.scale,
-        1.f,
-        requantization_scales);
-  }
+  {
+    // Weight packing is not thread safe, but it only happens on the first
+    // call: hold the lock just for the lazy repack so concurrent callers
+    // sharing this packed weight (e.g. serving threads) do not serialize on
+    // the GEMM below.
+    std::lock_guard<std::mutex> lock(qnnp_mutex_);
+    if (!input_scale.has_value()) {
+      float* weight_scales_data = w_scales.data_ptr<float>();
+      generate_requantization_scales(
+          // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+          w_scales,
+          q_params.scale,
+          1.f,
+          requantization_scales);
+
+      // Get the original weight and adjust it to uint8 from int8
+      auto weight_contig = orig_weight;
+
+      // TODO(kimishpatel), we are allocating affine_quantized regardless of per
+      // channel or not. This allocation is actually used only for packing weight
+      // and thus will be freed. Still we should be consistent. Fix this.
+      Tensor qnnp_weight = at::_empty_affine_quantized(
+          weight_contig.sizes(),
+          at::device(c10::kCPU).dtype(c10::kQUInt8),
+          weight_scales_data[0],
+          w_zero_points[0]);
+      auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
+      int8_t* w_data = (int8_t*)weight_contig.data_ptr<c10::qint8>();
+      auto wt_numel = weight_contig.numel();
+      for (const auto i : c10::irange(wt_numel)) {
+        qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
+      }
 
-  if (!input_scale.has_value()) {
-    // Get the original weight and adjust it to uint8 from int8
-    auto weight_contig = orig_weight;
-
-    // TODO(kimishpatel), we are allocating affine_quantized regardless of per
-    // channel or not. This allocation is actually used only for packing weight
-    // and thus will be freed. Still we should be consistent. Fix this.
-    Tensor qnnp_weight = at::_empty_affine_quantized(
-        weight_contig.sizes(),
-        at::device(c10::kCPU).dtype(c10::kQUInt8),
-        weight_scales_data[0],
-        w_zero_points[0]);
-    auto* qnnp_w_data = qnnp_weight.data_ptr<c10::quint8>();
-    int8_t* w_data = (int8_t*)weight_contig.data_ptr<c10::qint8>();
-    auto wt_numel = weight_contig.numel();
-    for (const auto i : c10::irange(wt_numel)) {
-      qnnp_w_data[i] = static_cast<c10::quint8>(w_data[i] + 128);
-    }
+      // Pass in nullptr for bias, as we pass FP32 bias to run function.
+      w.reset();
+      w = std::make_unique<qnnpack::PackBMatrix>(
+          cols_w /* input_channels */,
+          rows_w /* output_channels */,
+          w_zero_points.data(),
+          requantization_scales.data(),
+          (uint8_t*)qnnp_w_data,
+          nullptr);
+      if (at::globalContext().releaseWeightsWhenPrepacking()) {
+        // On mobile, we release the original weight by resetting the
+        // intrusive_ptr. Calling unpack after this will throw an assertion.
+        orig_weight.reset();
+      }
 
-    // Pass in nullptr for bias, as we pass FP32 bias to run function.
-    w.reset();
-    w = std::make_unique<qnnpack::PackBMatrix>(
-        cols_w /* input_channels */,
-        rows_w /* output_channels */,
-        w_zero_points.data(),
-        requantization_scales.data(),
-        (uint8_t*)qnnp_w_data,
-        nullptr);
-    packB = w.get();
-    if (at::globalContext().releaseWeightsWhenPrepacking()) {
-      // On mobile, we release the original weight by resetting the
-      // intrusive_ptr. Calling unpack after this will throw an assertion.
-      orig_weight.reset();
+      // Mark the weight as packed so it is not packed again.
+      input_scale = q_params.scale;
     }
   }
+  auto packB = w.get();
 
-  // Update the input scale to not pack weights again.
-  // as well as to avoid repopulating requant scale if scale has not changed.
-  input_scale = q_params.scale;
+  // The dequantization scale depends on this call's input scale, so compute
+  // it into a per-call buffer rather than into the cached member: after the
+  // one-time packing above, concurrent callers only read the shared state.
+  std::vector<float> dequantization_scales;
+  generate_requantization_scales(
+      w_scales, q_params.scale, 1.f, dequantization_scales);
 
   // Quantize input
   Tensor q_input = at::quantize_per_tensor(
@@ -352,7 +363,7 @@ at::Tensor PackedLinearWeightsQnnp::apply_dynamic_impl(
       q_input.q_zero_point(),
       w_zero_points.data(),
       /* for dynamic should really be called dequant scale */
-      requantization_scales.data(),
+      dequantization_scales.data(),
       (uint8_t*)q_input.data_ptr<c10::quint8>(),
       cols_input /* input_stride */,
       packB->getPackedWeights(),
@@ -77,8 +77,30 @@ c10::intrusive_ptr<LinearPackedParamsBase> PackedLinearWeight::prepack(
     }
   }
 
-  int8_t* weight_ptr_int8 =
-      reinterpret_cast<int8_t*>(weight_contig.data_ptr<c10::qint8>());
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int8_t* weight_ptr_int8;
+  std::vector<int8_t> weight_unpacked_int4;
+  if (weight_contig.scalar_type() == c10::kQUInt4x2) {
+    // 4-bit weights are stored two per byte, lower nibble first (see
+    // quantize_tensor_per_tensor_affine_sub_byte_cpu). Unpack them into an
+    // int8 buffer so the regular int8 GEMM consumes them unchanged: the
+    // quantized values are in [0, 15] so they fit in int8, and the column
+    // offsets below compensate for the (unsigned) zero points exactly as
+    // they do for qint8 weights. The packed qtensor is only needed for this
+    // one-time unpack, so 4-bit weights halve the at-rest weight memory.
+    weight_unpacked_int4.resize(N * K);
+    const uint8_t* weight_ptr_int4 = reinterpret_cast<const uint8_t*>(
+        weight_contig.data_ptr<c10::quint4x2>());
+    for (const auto i : c10::irange(N * K)) {
+      const uint8_t packed = weight_ptr_int4[i / 2];
+      weight_unpacked_int4[i] = static_cast<int8_t>(
+          i % 2 == 0 ? (packed & 0xF) : (packed >> 4));
+    }
+    weight_ptr_int8 = weight_unpacked_int4.data();
+  } else {
+    weight_ptr_int8 =
+        reinterpret_cast<int8_t*>(weight_contig.data_ptr<c10::qint8>());
+  }
 
   std::vector<int32_t> col_offsets(N);
   calc_col_offsets_transpose(
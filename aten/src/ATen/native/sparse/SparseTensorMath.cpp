@@ -15,6 +15,7 @@
 #include <ATen/native/BinaryOps.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/CPUBlas.h>
+#include <ATen/native/cpu/SparseAddmmKernel.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
@@ -71,6 +72,8 @@
 namespace at { namespace native {
 
 using namespace at::sparse;
+
+DEFINE_DISPATCH(sparse_addmm_dense_stub);
 // --------------------------------------------------------------------
 // Utility functions
 // --------------------------------------------------------------------
@@ -949,6 +952,33 @@ Tensor& s_addmm_out_sparse_dense_cpu(
   Tensor indices = sparse_._indices();
   Tensor values      = sparse_._values();
 
+  // Vectorized row-blocked kernel for the common serving layout: coalesced
+  // sparse matrix (rows sorted, so a CSR view can be built cheaply) against
+  // row-major contiguous operands. Other layouts and dtypes fall back to
+  // the per-nonzero axpy loop below.
+  if (sparse_.is_coalesced() && r.is_contiguous() && dense.is_contiguous() &&
+      indices.is_contiguous() && values.is_contiguous() &&
+      r.scalar_type() == values.scalar_type() &&
+      dense.scalar_type() == values.scalar_type() &&
+      (values.scalar_type() == ScalarType::Float ||
+       values.scalar_type() == ScalarType::Double)) {
+    AT_DISPATCH_FLOATING_TYPES(
+        values.scalar_type(), "addmm_sparse_dense", [&] {
+          scalar_t cast_beta = beta.to<scalar_t>();
+          if (cast_beta == static_cast<scalar_t>(0)) {
+            r.zero_();
+          } else if (cast_beta == static_cast<scalar_t>(1)) {
+            if (!is_same_tensor(r, t)) {
+              r.copy_(t);
+            }
+          } else {
+            at::mul_out(r, t, scalar_to_tensor(beta));
+          }
+        });
+    sparse_addmm_dense_stub(kCPU, r, indices, values, dense, alpha);
+    return r;
+  }
+
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX(
       values.scalar_type(), "addmm_sparse_dense", [&] {
         s_addmm_out_sparse_dense_worker<scalar_t>(nnz, dim_i, dim_j, dim_k, r, beta, t, alpha, indices, values, dense);
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <type_traits>
 
 #include <ATen/ATen.h>
@@ -12,6 +13,8 @@
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/cat.h>
+#include <ATen/ops/matmul.h>
+#include <ATen/ops/softmax.h>
 #endif
 
 #include <ATen/native/nested/NestedTensorTransformerFunctions.h>
@@ -478,5 +481,57 @@ std::tuple<Tensor, Tensor> native_multi_head_attention(
   return std::make_tuple(std::move(proj), std::move(qkt));
 }
 
+Tensor& kv_cache_append_(
+    Tensor& self,
+    const Tensor& src,
+    int64_t length,
+    int64_t dim) {
+  dim = maybe_wrap_dim(dim, self.dim());
+  TORCH_CHECK(
+      src.dim() == self.dim(),
+      "_kv_cache_append_: src must have the same number of dimensions as the cache, got ",
+      src.dim(),
+      " and ",
+      self.dim());
+  const auto new_rows = src.size(dim);
+  TORCH_CHECK(
+      length >= 0 && length + new_rows <= self.size(dim),
+      "_kv_cache_append_: cache capacity exceeded; cannot write ",
+      new_rows,
+      " rows at position ",
+      length,
+      " into a cache of size ",
+      self.size(dim),
+      " along dim ",
+      dim);
+  self.narrow(dim, length, new_rows).copy_(src);
+  return self;
+}
+
+Tensor _kv_cache_attention(
+    const Tensor& query,
+    const Tensor& key_cache,
+    const Tensor& value_cache,
+    int64_t length,
+    c10::optional<double> scale) {
+  TORCH_CHECK(
+      length >= 0 && length <= key_cache.size(-2) &&
+          length <= value_cache.size(-2),
+      "_kv_cache_attention: length ",
+      length,
+      " exceeds cache capacity");
+  // Only the first `length` rows of the caches are valid; narrowing here is
+  // what keeps per-token cost proportional to the populated prefix rather
+  // than the preallocated capacity.
+  auto key = key_cache.narrow(-2, 0, length);
+  auto value = value_cache.narrow(-2, 0, length);
+  const auto softmax_scale = scale.has_value()
+      ? *scale
+      : 1.0 / std::sqrt(static_cast<double>(query.size(-1)));
+  auto scores = at::matmul(query, key.transpose(-2, -1)) * softmax_scale;
+  auto attn = at::softmax(scores, -1);
+  return at::matmul(attn, value);
+}
+
 } // namespace native
 } // namespace at
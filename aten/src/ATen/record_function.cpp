@@ -536,6 +536,9 @@ RecordFunction::RecordFunction(StepCallbacks&& step_callbacks)
 }
 
 void RecordFunction::runStartCallbacks() {
+  if (C10_UNLIKELY(c10::AllocationDomainTracker::singleton().enabled())) {
+    allocation_op_guard_.emplace(name());
+  }
   for (const auto i : c10::irange(step_callbacks_.callbacks_.size())) {
     tryRunCallback</*is_start=*/true>(
         step_callbacks_.callbacks_[i], *this, ctx_[i]);
@@ -551,6 +554,7 @@ void RecordFunction::end() {
     }
     step_callbacks_.callbacks_.clear();
   }
+  allocation_op_guard_.reset();
 }
 
 const char* RecordFunction::name() const {
@@ -2,6 +2,7 @@
 
 #include <ATen/core/ivalue.h>
 #include <ATen/core/operator_name.h>
+#include <c10/core/AllocationDomain.h>
 #include <c10/macros/Export.h>
 #include <c10/util/Optional.h>
 #include <c10/util/SmallVector.h>
@@ -39,6 +40,9 @@ enum class C10_API_ENUM RecordScope : uint8_t {
   // Scopes for static runtime, a specialized TorchScript interpreter
   STATIC_RUNTIME_OP,
   STATIC_RUNTIME_MODEL,
+  // TensorIterator setup (shape, dtype and overlap computation); lets
+  // profilers attribute framework overhead separately from kernel time
+  TENSOR_ITERATOR,
   NUM_SCOPES, // must be the last in the list
 };
 
@@ -456,6 +460,12 @@ struct TORCH_API RecordFunction {
   // Stores various ObserverContext objects with event metadata for callbacks.
   ObserverContextList ctx_;
 
+  // Names this op as the allocation context while allocation-domain tracking
+  // is on, so memory dumps can report the allocating op (see
+  // c10/core/AllocationDomain.h). Engaged between the start callbacks and
+  // end().
+  c10::optional<c10::AllocationOpContextGuard> allocation_op_guard_;
+
   c10::variant<std::string, schema_ref_t> fn_;
 
   int64_t sequence_nr_ = -1;
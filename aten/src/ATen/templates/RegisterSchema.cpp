@@ -1,7 +1,24 @@
 // ${generated_comment}
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Reduction.h>
 #include <torch/library.h>
 
+namespace {
+// Builds the AliasInfo for an '(a)' or '(a!)' annotation on an argument or
+// return of a pre-parsed schema registration below.  Mirrors
+// SchemaTypeParser::parseAliasAnnotation for the subset of annotations the
+// code generator emits in pre-parsed form; in particular the after set
+// always equals the before set, because none of these annotations use '->'.
+C10_UNUSED c10::AliasInfo makeAliasInfo(const char* set, bool is_write) {
+  c10::AliasInfo alias_info;
+  alias_info.setIsWrite(is_write);
+  const auto symbol = c10::Symbol::fromQualString(std::string("alias::") + set);
+  alias_info.addBeforeSet(symbol);
+  alias_info.addAfterSet(symbol);
+  return alias_info;
+}
+} // namespace
+
 namespace at {
 TORCH_LIBRARY(aten, m) {
   ${schema_registrations};
@@ -504,6 +504,36 @@ TEST(DictTest, dictTensorAsKey) {
   EXPECT_EQ(dict.end(), found_nokey2);
 }
 
+TEST(DictTest, unboxedKeyProbes) {
+  // find()/at()/contains() on statically typed dicts probe with the raw key
+  // (no IValue boxing); check they agree with the boxed representation.
+  Dict<string, double> str_dict;
+  str_dict.insert("feature_a", 1.5);
+  str_dict.insert("feature_b", 2.5);
+  EXPECT_EQ(2.5, str_dict.at("feature_b"));
+  EXPECT_TRUE(str_dict.contains("feature_a"));
+  EXPECT_FALSE(str_dict.contains("feature_c"));
+  EXPECT_EQ(str_dict.end(), str_dict.find("feature_c"));
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(str_dict.at("feature_c"), std::out_of_range);
+
+  Dict<int64_t, string> int_dict;
+  int_dict.insert(3, "three");
+  int_dict.insert(4, "four");
+  EXPECT_EQ("three", int_dict.at(3));
+  EXPECT_FALSE(int_dict.contains(5));
+
+  Dict<double, int64_t> double_dict;
+  double_dict.insert(1.5, 1);
+  EXPECT_EQ(1, double_dict.at(1.5));
+  EXPECT_FALSE(double_dict.contains(2.5));
+
+  Dict<bool, int64_t> bool_dict;
+  bool_dict.insert(true, 1);
+  EXPECT_TRUE(bool_dict.contains(true));
+  EXPECT_FALSE(bool_dict.contains(false));
+}
+
 TEST(DictTest, dictEquality) {
   Dict<string, int64_t> dict;
   dict.insert("one", 1);
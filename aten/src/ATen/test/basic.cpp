@@ -471,3 +471,24 @@ TEST(BasicTest, FactoryMethodsTest) {
     ASSERT_FALSE(tensor0.is_pinned());
   }
 }
+
+TEST(BasicTest, MetaShapeChecksDisabledGuard) {
+  ASSERT_TRUE(at::impl::meta_shape_checks_enabled());
+  {
+    at::impl::MetaShapeChecksDisabledGuard guard;
+    ASSERT_FALSE(at::impl::meta_shape_checks_enabled());
+    // Structured ops with valid shapes behave identically with checks
+    // elided; only the validation work is skipped.
+    at::Tensor a = at::rand({3, 4});
+    at::Tensor b = at::rand({4, 5});
+    ASSERT_TRUE(at::mm(a, b).allclose(at::matmul(a, b)));
+    {
+      at::impl::MetaShapeChecksDisabledGuard nested;
+      ASSERT_FALSE(at::impl::meta_shape_checks_enabled());
+    }
+    ASSERT_FALSE(at::impl::meta_shape_checks_enabled());
+  }
+  ASSERT_TRUE(at::impl::meta_shape_checks_enabled());
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_ANY_THROW(at::mm(at::rand({3, 4}), at::rand({5, 6})));
+}
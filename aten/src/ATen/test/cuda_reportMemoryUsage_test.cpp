@@ -20,6 +20,10 @@ TEST(DeviceCachingAllocator, check_reporter) {
   EXPECT_LE(_200kb, r.total_allocated);
   EXPECT_LE(_200kb, r.total_reserved);
   EXPECT_TRUE(r.device.is_cuda());
+  // the caching allocator carves blocks out of cudaMalloc'd segments and
+  // reports the segment extent alongside the block
+  EXPECT_NE(nullptr, r.segment_ptr);
+  EXPECT_LE(r.alloc_size, r.segment_size);
 
   auto alloc1_true_ptr = r.ptr;
   auto alloc1_true_alloc_size = r.alloc_size;
@@ -190,6 +190,42 @@ TEST(TestStream, StreamPoolTest) {
   ASSERT_TRUE(hasDuplicates);
 }
 
+TEST(TestStream, StreamClassTest) {
+  if (!at::cuda::is_available()) return;
+  const auto class_id = c10::cuda::registerStreamClass(
+      "stream_class_test", /*priority=*/-1, /*pool_size=*/2);
+  ASSERT_EQ_CUDA(class_id, c10::cuda::getStreamClassId("stream_class_test"));
+
+  // round-robin wraps at the configured pool size
+  auto s0 = c10::cuda::getStreamFromClass(class_id);
+  auto s1 = c10::cuda::getStreamFromClass(class_id);
+  auto s2 = c10::cuda::getStreamFromClass(class_id);
+  ASSERT_NE_CUDA(s0, s1);
+  ASSERT_EQ_CUDA(s0, s2);
+  ASSERT_EQ_CUDA(s0.priority(), -1);
+
+  ASSERT_EQ_CUDA(c10::cuda::currentStreamClass(), -1);
+  auto before_guard = at::cuda::getCurrentCUDAStream();
+  {
+    c10::cuda::CUDAStreamClassGuard guard("stream_class_test");
+    ASSERT_EQ_CUDA(c10::cuda::currentStreamClass(), class_id);
+
+    // ops launched under the guard see a class stream as current
+    auto current = at::cuda::getCurrentCUDAStream();
+    ASSERT_TRUE(current == s0 || current == s1);
+
+    // anonymous pool requests are captured by the class too
+    auto pooled = at::cuda::getStreamFromPool();
+    ASSERT_TRUE(pooled == s0 || pooled == s1);
+
+    // but explicit high priority requests keep their meaning
+    auto high = at::cuda::getStreamFromPool(/*isHighPriority=*/true);
+    ASSERT_TRUE(high != s0 && high != s1);
+  }
+  ASSERT_EQ_CUDA(c10::cuda::currentStreamClass(), -1);
+  ASSERT_EQ_CUDA(at::cuda::getCurrentCUDAStream(), before_guard);
+}
+
 // Multi-GPU
 TEST(TestStream, MultiGPUTest) {
   if (!at::cuda::is_available()) return;
@@ -875,6 +875,18 @@ std::array<std::vector<IValue>, 3> expectedContents = {
 
 }
 
+TEST(TupleElementsTest, CreateNamedWithErasedType) {
+  // The TypePtr overload of createNamed takes the inline representation
+  // directly, without going through std::vector.
+  auto type = TupleType::create({IntType::get(), IntType::get()});
+  auto tuple = ivalue::Tuple::createNamed(
+      TupleElements(1, 2), c10::TypePtr(type));
+  EXPECT_EQ(tuple->size(), 2);
+  EXPECT_IVALUE_EQ(tuple->elements()[0], IValue(1));
+  EXPECT_IVALUE_EQ(tuple->elements()[1], IValue(2));
+  EXPECT_EQ(tuple->type(), type);
+}
+
 TEST(TupleElementsTest, Resize) {
   std::array<std::vector<IValue>, 3> newContents = {std::vector<IValue>(), std::vector<IValue>({4, 5, 6}), std::vector<IValue>({7, 8, 9, "hello"})};
 
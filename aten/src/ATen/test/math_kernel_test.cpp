@@ -135,3 +135,269 @@ TEST(MathKernelTest, Bmm)  {
   test_bmm(5);
   test_bmm(1000);
 }
+
+TEST(MathKernelTest, FusedAdam) {
+  for (bool amsgrad : {false, true}) {
+    for (bool maximize : {false, true}) {
+      const double lr = 1e-3, beta1 = 0.9, beta2 = 0.999;
+      const double weight_decay = 1e-2, eps = 1e-8;
+
+      // A mix of small and large tensors so several go through the same
+      // chunked parallel loop.
+      std::vector<Tensor> params, grads, exp_avgs, exp_avg_sqs,
+          max_exp_avg_sqs, state_steps;
+      std::vector<Tensor> ref_params, ref_exp_avgs, ref_exp_avg_sqs,
+          ref_max_exp_avg_sqs;
+      for (const auto numel : {3, 17, 100000}) {
+        params.push_back(randn({numel}));
+        grads.push_back(randn({numel}));
+        exp_avgs.push_back(rand({numel}));
+        exp_avg_sqs.push_back(rand({numel}));
+        max_exp_avg_sqs.push_back(rand({numel}));
+        state_steps.push_back(at::tensor(3.0));
+        ref_params.push_back(params.back().clone());
+        ref_exp_avgs.push_back(exp_avgs.back().clone());
+        ref_exp_avg_sqs.push_back(exp_avg_sqs.back().clone());
+        ref_max_exp_avg_sqs.push_back(max_exp_avg_sqs.back().clone());
+      }
+
+      at::_fused_adam_(params, grads, exp_avgs, exp_avg_sqs, max_exp_avg_sqs,
+                       state_steps, lr, beta1, beta2, weight_decay, eps,
+                       amsgrad, maximize);
+
+      // Unfused reference of the same update.
+      for (const auto i : c10::irange(params.size())) {
+        const double step = 4.0;  // _fused_adam_ advances the step itself
+        auto grad = maximize ? -grads[i] : grads[i];
+        grad = grad + ref_params[i] * weight_decay;
+        ref_exp_avgs[i].mul_(beta1).add_(grad, 1 - beta1);
+        ref_exp_avg_sqs[i].mul_(beta2).addcmul_(grad, grad, 1 - beta2);
+        const double bias_correction1 = 1 - std::pow(beta1, step);
+        const double bias_correction2 = 1 - std::pow(beta2, step);
+        auto denom_sq = ref_exp_avg_sqs[i];
+        if (amsgrad) {
+          ref_max_exp_avg_sqs[i] = at::maximum(ref_max_exp_avg_sqs[i], ref_exp_avg_sqs[i]);
+          denom_sq = ref_max_exp_avg_sqs[i];
+        }
+        auto denom = denom_sq.sqrt() / std::sqrt(bias_correction2) + eps;
+        ref_params[i].addcdiv_(ref_exp_avgs[i], denom, -lr / bias_correction1);
+
+        ASSERT_EQ(state_steps[i].item<double>(), step);
+        ASSERT_ALLCLOSE_TOLERANCES(params[i], ref_params[i], 1e-6, 1e-8);
+        ASSERT_ALLCLOSE_TOLERANCES(exp_avgs[i], ref_exp_avgs[i], 1e-6, 1e-8);
+        ASSERT_ALLCLOSE_TOLERANCES(exp_avg_sqs[i], ref_exp_avg_sqs[i], 1e-6, 1e-8);
+        if (amsgrad) {
+          ASSERT_ALLCLOSE_TOLERANCES(max_exp_avg_sqs[i], ref_max_exp_avg_sqs[i], 1e-6, 1e-8);
+        }
+      }
+    }
+  }
+}
+
+TEST(MathKernelTest, GroupedMM) {
+  // uniform shapes take the batched gemm fast path
+  std::vector<Tensor> lhs, rhs;
+  for (const auto i : c10::irange(4)) {
+    (void)i;
+    lhs.push_back(rand({32, 32}));
+    rhs.push_back(rand({32, 32}));
+  }
+  auto outs = at::_grouped_mm(lhs, rhs);
+  ASSERT_EQ(outs.size(), 4);
+  for (const auto i : c10::irange(4)) {
+    ASSERT_ALLCLOSE_TOLERANCES(outs[i], lhs[i].mm(rhs[i]), 1e-5, 1e-7);
+  }
+
+  // mixed shapes and transposed inputs fall back to per-pair mm
+  lhs = {rand({3, 5}), rand({8, 2}).t(), rand({0, 7})};
+  rhs = {rand({5, 4}), rand({8, 6}), rand({7, 7})};
+  outs = at::_grouped_mm(lhs, rhs);
+  ASSERT_EQ(outs.size(), 3);
+  for (const auto i : c10::irange(3)) {
+    ASSERT_ALLCLOSE_TOLERANCES(outs[i], lhs[i].mm(rhs[i]), 1e-5, 1e-7);
+  }
+
+  // mismatched inner dimensions are rejected
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_ANY_THROW(at::_grouped_mm({rand({2, 3})}, {rand({4, 5})}));
+}
+
+TEST(MathKernelTest, KVCacheAttention) {
+  const int64_t num_head = 2;
+  const int64_t capacity = 16;
+  const int64_t dim_per_head = 8;
+  auto key_cache = at::zeros({num_head, capacity, dim_per_head});
+  auto value_cache = at::zeros({num_head, capacity, dim_per_head});
+
+  // Decode token by token, appending at the watermark each step, and check
+  // against attention computed over the full prefix from scratch.
+  std::vector<Tensor> keys, values;
+  int64_t length = 0;
+  for (const auto step : c10::irange(5)) {
+    (void)step;
+    auto k = rand({num_head, 1, dim_per_head});
+    auto v = rand({num_head, 1, dim_per_head});
+    keys.push_back(k);
+    values.push_back(v);
+    at::_kv_cache_append_(key_cache, k, length);
+    at::_kv_cache_append_(value_cache, v, length);
+    length += 1;
+
+    auto query = rand({num_head, 1, dim_per_head});
+    auto out = at::_kv_cache_attention(query, key_cache, value_cache, length);
+
+    auto all_k = at::cat(keys, 1);
+    auto all_v = at::cat(values, 1);
+    auto scores = query.matmul(all_k.transpose(-2, -1)) /
+        std::sqrt(static_cast<double>(dim_per_head));
+    auto ref = scores.softmax(-1).matmul(all_v);
+    ASSERT_ALLCLOSE_TOLERANCES(out, ref, 1e-5, 1e-7);
+  }
+
+  // rows past the watermark must be untouched
+  ASSERT_TRUE(key_cache.narrow(1, length, capacity - length).eq(0).all().item<bool>());
+
+  // appending past capacity is rejected
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  EXPECT_ANY_THROW(at::_kv_cache_append_(
+      key_cache, rand({num_head, 1, dim_per_head}), capacity));
+}
+
+TEST(MathKernelTest, FusedDropoutAddLayerNorm) {
+  const auto input = rand({4, 16, 32});
+  const auto residual = rand({4, 16, 32});
+  std::vector<int64_t> normalized_shape = {32};
+  const auto weight = rand(normalized_shape);
+  const auto bias = rand(normalized_shape);
+  double eps = 1e-05;
+
+  // With dropout inactive the fused op must match the unfused chain exactly.
+  for (const auto& inactive : {std::make_pair(0.0, true),
+                               std::make_pair(0.5, false)}) {
+    auto fused = at::_fused_dropout_add_layer_norm(
+        input, residual, normalized_shape, weight, bias,
+        /*p=*/inactive.first, /*train=*/inactive.second, eps);
+    auto ref = at::layer_norm(
+        input + residual, normalized_shape, weight, bias, eps,
+        /*cudnn_enable=*/false);
+    ASSERT_ALLCLOSE_TOLERANCES(std::get<0>(fused), ref, 1e-5, 1e-7);
+    // No mask is produced when dropout is a no-op.
+    ASSERT_EQ(std::get<1>(fused).numel(), 0);
+  }
+
+  // With dropout active, the output must equal layer_norm applied to the
+  // rescaled-and-masked input plus the residual, using the returned mask.
+  double p = 0.5;
+  auto fused = at::_fused_dropout_add_layer_norm(
+      input, residual, normalized_shape, weight, bias, p, /*train=*/true, eps);
+  const auto& mask = std::get<1>(fused);
+  ASSERT_TRUE(mask.is_same_size(input));
+  auto x = at::addcmul(residual, input, mask, 1.0 / (1.0 - p));
+  auto ref = at::layer_norm(
+      x, normalized_shape, weight, bias, eps, /*cudnn_enable=*/false);
+  ASSERT_ALLCLOSE_TOLERANCES(std::get<0>(fused), ref, 1e-5, 1e-7);
+
+  // Fused backward with inactive dropout: the input and residual grads both
+  // equal the layer_norm input grad.
+  auto grad_out = rand({4, 16, 32});
+  auto no_mask = at::empty({0}, input.options());
+  auto stats = at::native_layer_norm(
+      input + residual, normalized_shape, weight, bias, eps);
+  auto fused_grads = at::_fused_dropout_add_layer_norm_backward(
+      grad_out, input, residual, no_mask, std::get<1>(stats),
+      std::get<2>(stats), normalized_shape, weight, bias, /*p=*/0.0,
+      /*train=*/true, {true, true, true, true});
+  auto ref_grads = at::native_layer_norm_backward(
+      grad_out, input + residual, normalized_shape, std::get<1>(stats),
+      std::get<2>(stats), weight, bias, {true, true, true});
+  ASSERT_ALLCLOSE_TOLERANCES(std::get<0>(fused_grads), std::get<0>(ref_grads), 1e-5, 1e-7);
+  ASSERT_ALLCLOSE_TOLERANCES(std::get<1>(fused_grads), std::get<0>(ref_grads), 1e-5, 1e-7);
+  ASSERT_ALLCLOSE_TOLERANCES(std::get<2>(fused_grads), std::get<1>(ref_grads), 1e-5, 1e-7);
+  ASSERT_ALLCLOSE_TOLERANCES(std::get<3>(fused_grads), std::get<2>(ref_grads), 1e-5, 1e-7);
+}
+
+TEST(MathKernelTest, MaskedSelectParallel) {
+  // Large enough to take the parallel two-pass path when multiple threads
+  // are available.
+  auto self = rand({512, 256});
+  auto mask = self.gt(0.5);
+
+  // Reference built with a plain serial scan.
+  auto self_acc = self.accessor<float, 2>();
+  auto mask_acc = mask.accessor<bool, 2>();
+  std::vector<float> expected_vals;
+  for (const auto i : c10::irange(self.size(0))) {
+    for (const auto j : c10::irange(self.size(1))) {
+      if (mask_acc[i][j]) {
+        expected_vals.push_back(self_acc[i][j]);
+      }
+    }
+  }
+  auto expected = at::tensor(expected_vals, self.options());
+
+  ASSERT_ALLCLOSE_TOLERANCES(at::masked_select(self, mask), expected, 0, 0);
+
+  // Out-variant into a preallocated buffer of the right capacity.
+  auto out = at::empty({self.numel()}, self.options());
+  at::masked_select_outf(self, mask, out);
+  ASSERT_ALLCLOSE_TOLERANCES(out, expected, 0, 0);
+
+  // Non-contiguous input and mask exercise the normalization through the
+  // long mask copy.
+  auto expected_t = at::masked_select(self.t().contiguous(), mask.t().contiguous());
+  ASSERT_ALLCLOSE_TOLERANCES(at::masked_select(self.t(), mask.t()), expected_t, 0, 0);
+
+  // All-false and all-true masks hit the resize edge cases.
+  ASSERT_EQ(at::masked_select(self, self.gt(2.0)).numel(), 0);
+  ASSERT_ALLCLOSE_TOLERANCES(
+      at::masked_select(self, self.le(2.0)), self.reshape(-1), 0, 0);
+}
+
+TEST(MathKernelTest, ConvertCopyContiguous) {
+  // Exercises the stamped contiguous conversion path of copy_, including
+  // the streaming-store branch for destinations past the size threshold.
+  for (int64_t numel : {7, 4096, 2 * 1024 * 1024}) {
+    auto src = rand({numel});
+    for (auto dtype : {kBFloat16, kHalf}) {
+      auto narrowed = src.to(dtype);
+      // Reference via an explicitly strided (non-stamped) round trip.
+      auto expected = narrowed.as_strided({numel}, {1}).to(kFloat);
+      ASSERT_ALLCLOSE_TOLERANCES(narrowed.to(kFloat), expected, 0, 0);
+
+      // Out-variant into preallocated, contiguous destinations.
+      auto out_narrow = at::empty({numel}, src.options().dtype(dtype));
+      out_narrow.copy_(src);
+      ASSERT_ALLCLOSE_TOLERANCES(out_narrow.to(kFloat), expected, 0, 0);
+      auto out_wide = at::empty({numel}, src.options());
+      out_wide.copy_(narrowed);
+      ASSERT_ALLCLOSE_TOLERANCES(out_wide, expected, 0, 0);
+    }
+  }
+}
+
+TEST(MathKernelTest, IndexSelectEmbeddingRows) {
+  // Exercises the dim-0 row-gather fast path on a 2D float table with both
+  // index dtypes, including enough rows to take the parallel path.
+  auto table = rand({1024, 33});
+  auto index64 = at::randint(0, table.size(0), {4096}, at::kLong);
+  auto index32 = index64.to(at::kInt);
+
+  auto expected = at::empty({index64.size(0), table.size(1)}, table.options());
+  auto table_acc = table.accessor<float, 2>();
+  auto index_acc = index64.accessor<int64_t, 1>();
+  auto expected_acc = expected.accessor<float, 2>();
+  for (const auto i : c10::irange(index64.size(0))) {
+    for (const auto j : c10::irange(table.size(1))) {
+      expected_acc[i][j] = table_acc[index_acc[i]][j];
+    }
+  }
+
+  ASSERT_ALLCLOSE_TOLERANCES(at::index_select(table, 0, index64), expected, 0, 0);
+  ASSERT_ALLCLOSE_TOLERANCES(at::index_select(table, 0, index32), expected, 0, 0);
+
+  // Out-of-range indices must still be diagnosed on the fast path.
+  auto bad_index =
+      at::tensor(c10::ArrayRef<int64_t>({0, table.size(0)}), at::kLong);
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto,hicpp-avoid-goto)
+  ASSERT_ANY_THROW(at::index_select(table, 0, bad_index));
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// The CPU multinomial kernel switches to a cached alias table for large
+// distributions (see MultinomialKernel.cpp). Point-mass distributions make
+// the sampled indices fully deterministic, so these tests cover the alias
+// build, the cache hit on a repeated call, and cache invalidation after an
+// in-place modification without depending on the RNG stream.
+
+namespace {
+
+constexpr int64_t kAliasCategories = 2048;
+constexpr int64_t kAliasSamples = 256;
+
+} // namespace
+
+TEST(MultinomialTest, AliasPathPointMass) {
+  auto probs = at::zeros({kAliasCategories});
+  probs[7] = 1.0;
+
+  auto samples = at::multinomial(probs, kAliasSamples, /*replacement=*/true);
+  ASSERT_TRUE(at::equal(
+      samples, at::full({kAliasSamples}, 7, at::TensorOptions(at::kLong))));
+
+  // Second call on the unmodified tensor hits the cached table.
+  samples = at::multinomial(probs, kAliasSamples, /*replacement=*/true);
+  ASSERT_TRUE(at::equal(
+      samples, at::full({kAliasSamples}, 7, at::TensorOptions(at::kLong))));
+}
+
+TEST(MultinomialTest, AliasCacheInvalidatedByInPlaceWrite) {
+  auto probs = at::zeros({kAliasCategories});
+  probs[7] = 1.0;
+  auto samples = at::multinomial(probs, kAliasSamples, /*replacement=*/true);
+  ASSERT_EQ(samples[0].item<int64_t>(), 7);
+
+  // Moving the mass in place bumps the version counter; a stale table
+  // would keep emitting the old index.
+  probs[7] = 0.0;
+  probs[42] = 1.0;
+  samples = at::multinomial(probs, kAliasSamples, /*replacement=*/true);
+  ASSERT_TRUE(at::equal(
+      samples, at::full({kAliasSamples}, 42, at::TensorOptions(at::kLong))));
+}
+
+TEST(MultinomialTest, AliasPathValidatesInput) {
+  auto probs = at::zeros({kAliasCategories});
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+  probs[3] = -1.0;
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      at::multinomial(probs, kAliasSamples, /*replacement=*/true), c10::Error);
+}
@@ -13,6 +13,8 @@ class TestMemoryReportingInfo : public c10::MemoryReportingInfoBase {
     int64_t total_allocated;
     int64_t total_reserved;
     c10::Device device;
+    void* segment_ptr;
+    int64_t segment_size;
   };
 
   std::vector<Record> records;
@@ -25,9 +27,17 @@ class TestMemoryReportingInfo : public c10::MemoryReportingInfoBase {
       int64_t alloc_size,
       int64_t total_allocated,
       int64_t total_reserved,
-      c10::Device device) override {
-    records.emplace_back(
-        Record{ptr, alloc_size, total_allocated, total_reserved, device});
+      c10::Device device,
+      void* segment_ptr,
+      int64_t segment_size) override {
+    records.emplace_back(Record{
+        ptr,
+        alloc_size,
+        total_allocated,
+        total_reserved,
+        device,
+        segment_ptr,
+        segment_size});
   }
 
   bool memoryProfilingEnabled() const override {
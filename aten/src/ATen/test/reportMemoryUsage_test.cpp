@@ -17,6 +17,9 @@ TEST(DefaultCPUAllocator, check_reporter) {
   EXPECT_EQ(42, r.total_allocated);
   EXPECT_EQ(0, r.total_reserved);
   EXPECT_TRUE(r.device.is_cpu());
+  // the plain CPU allocator has no segments to report
+  EXPECT_EQ(nullptr, r.segment_ptr);
+  EXPECT_EQ(0, r.segment_size);
 
   auto alloc2 = allocator->allocate(1038);
   r = reporter->getLatestRecord();
@@ -158,6 +158,32 @@ AT_FORALL_SCALAR_TYPES(NO_OUTPUT_BINARY_TEST_ITER_FOR_TYPE)
 AT_FORALL_SCALAR_TYPES(NO_OUTPUT_POINTWISE_TEST_ITER_FOR_TYPE)
 AT_FORALL_SCALAR_TYPES_AND(Bool, COMPARISON_TEST_ITER_FOR_TYPE)
 
+TEST(TensorIteratorTest, FlatBinaryOp) {
+  auto a = at::randn({5, 5});
+  auto b = at::randn({5, 5});
+  auto out = at::empty({5, 5});
+  ASSERT_TRUE(TensorIterator::can_use_flat_op(out, {&a, &b}));
+  auto iter = TensorIterator::flat_binary_op(out, a, b);
+  EXPECT_EQ(iter.ndim(), 1);
+  EXPECT_EQ(iter.numel(), 25);
+  at::native::cpu_serial_kernel(iter, [](float x, float y) -> float { return x + y; });
+  EXPECT_TRUE(out.allclose(a + b));
+}
+
+TEST(TensorIteratorTest, FlatOpNotApplicable) {
+  auto out = at::empty({5, 5});
+  // Broadcasting
+  auto a = at::randn({5, 5});
+  auto b = at::randn({5});
+  EXPECT_FALSE(TensorIterator::can_use_flat_op(out, {&a, &b}));
+  // Mixed dtypes
+  auto c = at::randn({5, 5}, kDouble);
+  EXPECT_FALSE(TensorIterator::can_use_flat_op(out, {&a, &c}));
+  // Non-contiguous input
+  auto d = at::randn({5, 5}).t();
+  EXPECT_FALSE(TensorIterator::can_use_flat_op(out, {&a, &d}));
+}
+
 TEST(TensorIteratorTest, SerialLoopSingleThread) {
   std::thread::id thread_id = std::this_thread::get_id();
   Tensor out;
@@ -217,6 +243,36 @@ TEST(TensorIteratorTest, FailNonPromotingBinaryOp) {
   ASSERT_ANY_THROW(config.build());
 }
 
+TEST(TensorIteratorTest, SuggestedGrainSize) {
+  Tensor out;
+  auto a = at::randn({64, 128});
+  auto b = at::randn({64, 128});
+  auto contiguous_grain =
+      TensorIterator::binary_op(out, a, b).suggested_grain_size();
+  EXPECT_LE(contiguous_grain, at::internal::GRAIN_SIZE);
+
+  // Narrower dtypes move fewer bytes per element and warrant a larger grain.
+  Tensor byte_out;
+  auto byte_grain = TensorIterator::binary_op(
+                        byte_out,
+                        at::ones({64, 128}, at::kByte),
+                        at::ones({64, 128}, at::kByte))
+                        .suggested_grain_size();
+  EXPECT_GT(byte_grain, contiguous_grain);
+
+  // Inputs strided along the inner dimension pull in a cache line per
+  // element and warrant a smaller grain, bounded below so chunks never get
+  // pathologically small.
+  Tensor strided_out;
+  auto strided_grain = TensorIterator::binary_op(
+                           strided_out,
+                           a.slice(1, 0, 128, 2),
+                           b.slice(1, 0, 128, 2))
+                           .suggested_grain_size();
+  EXPECT_LT(strided_grain, contiguous_grain);
+  EXPECT_GE(strided_grain, at::internal::GRAIN_SIZE / 16);
+}
+
 #define MULTIPLE_OUTPUTS_TEST_ITER_FOR_TYPE(ctype,name)                                             \
 TEST(TensorIteratorTest, CpuKernelMultipleOutputs_##name) {                                         \
   auto in1 = random_tensor_for_type(k##name);                                                       \
@@ -5,6 +5,7 @@
 #include <ATen/Parallel.h>
 #include <ATen/ParallelFuture.h>
 
+#include <atomic>
 #include <iostream>
 // NOLINTNEXTLINE(modernize-deprecated-headers)
 #include <string.h>
@@ -89,6 +90,112 @@ TEST(TestParallel, NestedParallelThreadId) {
   });
 }
 
+TEST(TestParallel, ParallelTuning) {
+  if (at::get_num_threads() == 1) {
+    // Single-task regions bypass the tuning table.
+    return;
+  }
+  at::set_parallel_tuning_enabled(true);
+  for (int iter = 0; iter < 64; ++iter) {
+    std::atomic<int64_t> sum{0};
+    at::parallel_for(0, 4096, 16, [&](int64_t begin, int64_t end) {
+      int64_t local = 0;
+      for (int64_t i = begin; i < end; ++i) {
+        local += i;
+      }
+      sum += local;
+    });
+    // Results stay correct whichever task count is being tried.
+    ASSERT_EQ(sum.load(), 4096 * 4095 / 2);
+  }
+  at::set_parallel_tuning_enabled(false);
+
+  auto table = at::dump_parallel_tuning_table();
+  // After enough trials the bucket for this region (grain size 16,
+  // log2(4096) == 12) is decided and shows up in the dump.
+  ASSERT_NE(table.find("16 12 "), std::string::npos);
+
+  // A dumped table round-trips through load.
+  at::load_parallel_tuning_table(table);
+  ASSERT_EQ(table, at::dump_parallel_tuning_table());
+}
+
+TEST(TestParallel, HeterogeneousScheduling) {
+  if (at::get_num_threads() == 1) {
+    // Single-task regions bypass heterogeneous scheduling.
+    return;
+  }
+  at::set_heterogeneous_scheduling_enabled(true);
+  // Weighted static partitions: the first region runs with even chunks and
+  // seeds the throughput estimates; later regions are split by them.
+  // Results stay correct either way.
+  for (int iter = 0; iter < 8; ++iter) {
+    std::atomic<int64_t> sum{0};
+    at::parallel_for(0, 4096, 16, [&](int64_t begin, int64_t end) {
+      int64_t local = 0;
+      for (int64_t i = begin; i < end; ++i) {
+        local += i;
+      }
+      sum += local;
+    });
+    ASSERT_EQ(sum.load(), 4096 * 4095 / 2);
+  }
+
+  // Dynamic chunk self-scheduling covers every element exactly once.
+  at::set_dynamic_chunk_scheduling(true);
+  std::atomic<int64_t> count{0};
+  std::atomic<int64_t> sum{0};
+  at::parallel_for(0, 4096, 16, [&](int64_t begin, int64_t end) {
+    count += end - begin;
+    int64_t local = 0;
+    for (int64_t i = begin; i < end; ++i) {
+      local += i;
+    }
+    sum += local;
+  });
+  ASSERT_EQ(count.load(), 4096);
+  ASSERT_EQ(sum.load(), 4096 * 4095 / 2);
+  at::set_dynamic_chunk_scheduling(false);
+  at::set_heterogeneous_scheduling_enabled(false);
+}
+
+TEST(TestParallel, CooperativePreemption) {
+  at::set_cooperative_preemption_enabled(true);
+  ASSERT_TRUE(at::get_cooperative_preemption_enabled());
+
+  // Preemptible regions self-schedule in chunks; every element is covered
+  // exactly once whether or not any worker yields.
+  std::atomic<int64_t> count{0};
+  std::atomic<int64_t> sum{0};
+  at::parallel_for(0, 4096, 16, [&](int64_t begin, int64_t end) {
+    count += end - begin;
+    int64_t local = 0;
+    for (int64_t i = begin; i < end; ++i) {
+      local += i;
+    }
+    sum += local;
+  });
+  ASSERT_EQ(count.load(), 4096);
+  ASSERT_EQ(sum.load(), 4096 * 4095 / 2);
+
+  {
+    at::ParallelPriorityGuard guard(/*high_priority=*/true);
+    ASSERT_TRUE(at::get_parallel_priority());
+    // High-priority regions skip the checkpointed path entirely.
+    std::atomic<int64_t> hp_sum{0};
+    at::parallel_for(0, 1024, 16, [&](int64_t begin, int64_t end) {
+      int64_t local = 0;
+      for (int64_t i = begin; i < end; ++i) {
+        local += i;
+      }
+      hp_sum += local;
+    });
+    ASSERT_EQ(hp_sum.load(), 1024 * 1023 / 2);
+  }
+  ASSERT_FALSE(at::get_parallel_priority());
+  at::set_cooperative_preemption_enabled(false);
+}
+
 TEST(TestParallel, Exceptions) {
   // parallel case
   // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+
+// Exercises the blocked transpose fast path taken by copy_ when the source
+// collapses to a (batch of) transposed matrices (see copy_transpose_valid).
+// The references below compare against the strided tensors directly, which
+// goes through TensorIterator rather than the fast path.
+
+namespace {
+
+void checkContiguousMatchesStrided(const at::Tensor& strided) {
+  auto contiguous = strided.contiguous();
+  ASSERT_TRUE(contiguous.is_contiguous());
+  ASSERT_TRUE(contiguous.equal(strided));
+}
+
+} // namespace
+
+TEST(TransposeCopyTest, Transpose2d) {
+  // above the fast-path size threshold, across tile-aligned and ragged shapes
+  for (const auto& sizes : {std::vector<int64_t>{64, 64},
+                            std::vector<int64_t>{128, 96},
+                            std::vector<int64_t>{131, 67},
+                            std::vector<int64_t>{61, 1021}}) {
+    auto x = at::rand(sizes);
+    checkContiguousMatchesStrided(x.t());
+  }
+}
+
+TEST(TransposeCopyTest, Transpose2dDtypes) {
+  auto x = at::rand({130, 70});
+  checkContiguousMatchesStrided(x.t());
+  checkContiguousMatchesStrided(x.to(at::kDouble).t());
+  checkContiguousMatchesStrided(
+      x.mul(100).to(at::kInt).t());
+  checkContiguousMatchesStrided(
+      x.mul(100).to(at::kLong).t());
+  checkContiguousMatchesStrided(
+      x.mul(100).to(at::kByte).t());
+  checkContiguousMatchesStrided(x.to(at::kHalf).t());
+}
+
+TEST(TransposeCopyTest, BatchedTranspose) {
+  auto x = at::rand({3, 80, 50});
+  checkContiguousMatchesStrided(x.transpose(1, 2));
+}
+
+TEST(TransposeCopyTest, ChannelsLastPermutes) {
+  // NCHW -> NHWC and back; these collapse to batched transposed matrices
+  auto nchw = at::rand({2, 3, 64, 48});
+  checkContiguousMatchesStrided(nchw.permute({0, 2, 3, 1}));
+  auto nhwc = at::rand({2, 64, 48, 3});
+  checkContiguousMatchesStrided(nhwc.permute({0, 3, 1, 2}));
+}
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <torch/csrc/autograd/engine.h>
+#include <torch/csrc/autograd/functions/basic_ops.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Measures push/pop throughput of the autograd ReadyQueue implementations
+// under producer/consumer contention, which bounds backward() scaling for
+// graphs dominated by many small nodes. Run with increasing thread counts to
+// see where the mutex + priority_queue baseline stops scaling and what the
+// lock-free ring buys back, e.g.:
+//
+//   ready_queue_bench --benchmark_filter=ReadyQueue --benchmark_min_time=2
+
+using namespace torch::autograd;
+
+namespace {
+
+constexpr int kTasksPerThread = 1 << 12;
+
+void run_queue_contention(
+    benchmark::State& state,
+    const std::shared_ptr<ReadyQueue>& queue) {
+  const int num_pairs = state.range(0);
+  auto graph_task = std::make_shared<GraphTask>(
+      /*keep_graph=*/false,
+      /*grad_mode=*/false,
+      /*reentrant_depth=*/0,
+      queue);
+  auto node = std::make_shared<GraphRoot>(edge_list(), variable_list());
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    threads.reserve(2 * num_pairs);
+    for (int p = 0; p < num_pairs; ++p) {
+      threads.emplace_back([&] {
+        for (int i = 0; i < kTasksPerThread; ++i) {
+          queue->push(
+              NodeTask(graph_task, node, InputBuffer(0)),
+              /*incrementOutstandingTasks=*/false);
+        }
+      });
+      threads.emplace_back([&] {
+        for (int i = 0; i < kTasksPerThread; ++i) {
+          NodeTask task = queue->pop();
+          benchmark::DoNotOptimize(task.fn_);
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(num_pairs) * kTasksPerThread);
+}
+
+void BM_ReadyQueueMutex(benchmark::State& state) {
+  run_queue_contention(state, std::make_shared<ReadyQueue>());
+}
+
+void BM_ReadyQueueLockFree(benchmark::State& state) {
+  run_queue_contention(state, std::make_shared<LockFreeReadyQueue>());
+}
+
+} // namespace
+
+BENCHMARK(BM_ReadyQueueMutex)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_ReadyQueueLockFree)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""Compares two google-benchmark JSON outputs and fails on regressions.
+
+Typical CI usage:
+
+    framework_overhead_bench --benchmark_format=json > current.json
+    python check_regression.py baseline.json current.json --threshold 5
+
+Exits nonzero if any benchmark got slower than the baseline by more than
+the threshold (percent), printing a per-benchmark table either way.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_benchmarks(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {
+        b["name"]: b["real_time"]
+        for b in data["benchmarks"]
+        # skip aggregate rows (mean/median/stddev) if repetitions were used
+        if b.get("run_type", "iteration") == "iteration"
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="baseline JSON output")
+    parser.add_argument("current", help="current JSON output")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=5.0,
+        help="max allowed slowdown in percent (default: 5)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_benchmarks(args.baseline)
+    current = load_benchmarks(args.current)
+
+    regressions = []
+    for name, base_time in sorted(baseline.items()):
+        if name not in current:
+            print(f"{name}: missing from current run")
+            regressions.append(name)
+            continue
+        cur_time = current[name]
+        delta_pct = (cur_time - base_time) / base_time * 100.0
+        status = "OK"
+        if delta_pct > args.threshold:
+            status = "REGRESSION"
+            regressions.append(name)
+        print(
+            f"{name}: {base_time:.1f} -> {cur_time:.1f} ns "
+            f"({delta_pct:+.1f}%) {status}"
+        )
+
+    if regressions:
+        print(
+            f"\n{len(regressions)} benchmark(s) regressed more than "
+            f"{args.threshold}% over baseline"
+        )
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,124 @@
+// End-to-end framework overhead benchmarks: dispatch, eager/scripted/static
+// runtime execution of a trivial op, autograd backward, and IValue stack
+// churn. Payloads are deliberately tiny (1-element tensors, no-op kernels)
+// so the numbers track the framework, not the kernels.
+//
+// Run with --benchmark_format=json and feed consecutive outputs to
+// check_regression.py to gate commits on overhead regressions.
+
+#include <benchmark/benchmark.h>
+
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/runtime/static/impl.h>
+#include <torch/jit.h>
+#include <torch/library.h>
+#include <torch/torch.h>
+
+namespace {
+
+// A kernel that does nothing: any time measured calling it is pure
+// dispatcher overhead.
+at::Tensor nop_kernel(const at::Tensor& self) {
+  return self;
+}
+
+TORCH_LIBRARY(framework_overhead_bench, m) {
+  m.def("nop(Tensor self) -> Tensor");
+}
+
+TORCH_LIBRARY_IMPL(framework_overhead_bench, CompositeExplicitAutograd, m) {
+  m.impl("nop", nop_kernel);
+}
+
+void BM_EmptyOpDispatch(benchmark::State& state) {
+  auto op = c10::Dispatcher::singleton()
+                .findSchemaOrThrow("framework_overhead_bench::nop", "")
+                .typed<at::Tensor(const at::Tensor&)>();
+  auto tensor = torch::ones({1});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(op.call(tensor));
+  }
+}
+BENCHMARK(BM_EmptyOpDispatch);
+
+void BM_AddEager(benchmark::State& state) {
+  auto a = torch::ones({1});
+  auto b = torch::ones({1});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a + b);
+  }
+}
+BENCHMARK(BM_AddEager);
+
+void BM_AddScripted(benchmark::State& state) {
+  auto cu = torch::jit::compile(R"JIT(
+    def add(a, b):
+        return a + b
+  )JIT");
+  auto a = torch::ones({1});
+  auto b = torch::ones({1});
+  // warmup: let the profiling executor settle on a plan
+  for (const auto i : c10::irange(10)) {
+    (void)i;
+    cu->run_method("add", a, b);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cu->run_method("add", a, b));
+  }
+}
+BENCHMARK(BM_AddScripted);
+
+void BM_AddStaticRuntime(benchmark::State& state) {
+  const auto src = R"IR(
+    graph(%a : Tensor, %b : Tensor):
+      %1 : int = prim::Constant[value=1]()
+      %out : Tensor = aten::add(%a, %b, %1)
+      return (%out)
+  )IR";
+  auto graph = std::make_shared<torch::jit::Graph>();
+  torch::jit::parseIR(src, graph.get());
+  torch::jit::StaticModule smod(graph);
+  const std::vector<c10::IValue> args{torch::ones({1}), torch::ones({1})};
+  smod(args);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(smod(args));
+  }
+}
+BENCHMARK(BM_AddStaticRuntime);
+
+void BM_BackwardChain100(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto x = torch::ones({1}, torch::requires_grad());
+    auto y = x + 0;
+    for (const auto i : c10::irange(99)) {
+      (void)i;
+      y = y + 1;
+    }
+    state.ResumeTiming();
+    y.backward();
+  }
+}
+BENCHMARK(BM_BackwardChain100);
+
+void BM_IValueStackChurn(benchmark::State& state) {
+  auto tensor = torch::ones({1});
+  std::vector<c10::IValue> stack;
+  stack.reserve(8);
+  for (auto _ : state) {
+    // the push/pop pattern of one boxed call: tensor, scalar, int args in,
+    // tensor out
+    torch::jit::push(stack, tensor);
+    torch::jit::push(stack, 1.0);
+    torch::jit::push(stack, static_cast<int64_t>(42));
+    benchmark::DoNotOptimize(torch::jit::pop(stack).toInt());
+    benchmark::DoNotOptimize(torch::jit::pop(stack).toDouble());
+    benchmark::DoNotOptimize(torch::jit::pop(stack).toTensor());
+  }
+}
+BENCHMARK(BM_IValueStackChurn);
+
+} // namespace
+
+BENCHMARK_MAIN();
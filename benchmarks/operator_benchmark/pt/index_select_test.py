@@ -53,5 +53,35 @@ op_bench.generate_pt_test(index_select_configs_short + index_select_configs_long
                           IndexSelectBenchmark)
 
 
+# Embedding-style row gathers on 2D float tables, from L2-resident
+# (1K x 64 = 256KB) through LLC-resident to DRAM-resident (1M x 256 = 1GB),
+# with both int32 and int64 indices.
+embedding_row_configs = op_bench.cross_product_configs(
+    num_embeddings=[1000, 100000, 1000000],
+    embedding_dim=[64, 256],
+    num_indices=[1000, 100000],
+    index_dtype=[torch.int32, torch.int64],
+    tags=["embedding_rows"]
+)
+
+
+class IndexSelectRowsBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, num_embeddings, embedding_dim, num_indices, index_dtype):
+        numpy.random.seed((1 << 32) - 1)
+        self.inputs = {
+            "table": torch.rand(num_embeddings, embedding_dim),
+            "index": torch.tensor(
+                numpy.random.randint(0, num_embeddings, num_indices),
+                dtype=index_dtype),
+        }
+        self.set_module_name("index_select")
+
+    def forward(self, table, index):
+        return torch.index_select(table, 0, index)
+
+
+op_bench.generate_pt_test(embedding_row_configs, IndexSelectRowsBenchmark)
+
+
 if __name__ == "__main__":
     op_bench.benchmark_runner.main()
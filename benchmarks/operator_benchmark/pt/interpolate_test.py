@@ -92,6 +92,41 @@ config_long = op_bench.config_list(
 )
 
 
+# Image-size sweep over common preprocessing resolutions (downscale by 2x
+# for video decode pipelines, upscale by 2x for model input resizing).
+config_size_sweep = op_bench.config_list(
+    attr_names=["input_size", "output_size"],
+    attrs=[
+        [(1, 3, 64, 64), (128, 128)],
+        [(1, 3, 224, 224), (448, 448)],
+        [(1, 3, 270, 480), (540, 960)],
+        [(1, 3, 480, 640), (240, 320)],
+        [(1, 3, 720, 1280), (360, 640)],
+        [(1, 3, 1080, 1920), (540, 960)],
+    ],
+    cross_product_configs={
+        'channels_last': [True, False],
+        'mode': ["nearest", ],
+        'dtype': [torch.float, torch.uint8],
+    },
+    tags=["long"],
+)
+
+config_size_sweep += op_bench.config_list(
+    attr_names=["input_size", "output_size"],
+    attrs=[
+        [(1, 3, 270, 480), (540, 960)],
+        [(1, 3, 480, 640), (240, 320)],
+        [(1, 3, 1080, 1920), (540, 960)],
+    ],
+    cross_product_configs={
+        'channels_last': [True, False],
+        'mode': ["linear", ],
+    },
+    tags=["long"],
+)
+
+
 config_3d = op_bench.config_list(
     # no channels_last for 3D tensors
     attr_names=["input_size", "output_size"],
@@ -124,7 +159,7 @@ config_5d = op_bench.config_list(
 )
 
 
-for config in (config_short, config_long, config_3d, config_5d):
+for config in (config_short, config_long, config_size_sweep, config_3d, config_5d):
     op_bench.generate_pt_test(config, InterpolateBenchmark)
 
 
@@ -0,0 +1,44 @@
+import operator_benchmark as op_bench
+import torch
+
+
+"""Microbenchmarks for multinomial operator"""
+
+
+# Configs for PT multinomial operator. Large category counts with many
+# samples exercise the cached alias-table path in the CPU kernel; the
+# small configs stay on the binary-search path.
+multinomial_configs = op_bench.config_list(
+    attr_names=['N_CATEGORIES', 'N_SAMPLES'],
+    attrs=[
+        [100, 16],
+        [100, 1024],
+        [1000, 1024],
+        [10000, 1024],
+        [50000, 1024],
+        [50000, 16384],
+    ],
+    cross_product_configs={
+        'device': ['cpu', 'cuda'],
+    },
+    tags=['short'],
+)
+
+
+class MultinomialBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, N_CATEGORIES, N_SAMPLES, device):
+        self.inputs = {
+            "probs": torch.rand(N_CATEGORIES, device=device),
+            "n_samples": N_SAMPLES,
+        }
+        self.set_module_name('multinomial')
+
+    def forward(self, probs, n_samples: int):
+        return torch.multinomial(probs, n_samples, replacement=True)
+
+
+op_bench.generate_pt_test(multinomial_configs, MultinomialBenchmark)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
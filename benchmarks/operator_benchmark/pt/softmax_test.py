@@ -61,5 +61,29 @@ op_bench.generate_pt_tests_from_op_list(softmax_ops_list,
                                         SoftmaxBenchmark)
 
 
+# Last-dim softmax over 2d inputs, at representative transformer hidden and
+# vocabulary sizes. The largest rows exercise the online-softmax variant of
+# the CPU kernel, which kicks in when a row no longer fits in L2.
+softmax_lastdim_configs = op_bench.cross_product_configs(
+    M=[16, 128],
+    N=[1024, 4096, 32768, 131072],
+    device=['cpu'],
+    tags=['long']
+)
+
+
+class SoftmaxLastDimBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, M, N, device):
+        self.inputs = {
+            "input": torch.rand(M, N, device=device)
+        }
+
+    def forward(self, input):
+        return torch.nn.functional.softmax(input, dim=-1)
+
+
+op_bench.generate_pt_test(softmax_lastdim_configs, SoftmaxLastDimBenchmark)
+
+
 if __name__ == "__main__":
     op_bench.benchmark_runner.main()
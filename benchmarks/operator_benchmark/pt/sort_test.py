@@ -0,0 +1,47 @@
+import operator_benchmark as op_bench
+import torch
+
+
+"""Microbenchmarks for sort operator"""
+
+
+# Configs for PT sort operator. Short rows with presorted/reverse-sorted
+# inputs cover the adaptive fast paths in the CPU sort kernel.
+sort_configs_short = op_bench.config_list(
+    attr_names=['M', 'N', 'order'],
+    attrs=[
+        [64, 64, 'random'],
+        [1024, 64, 'sorted'],
+        [1024, 64, 'reverse'],
+        [1024, 64, 'random'],
+        [1024, 256, 'sorted'],
+        [1024, 256, 'random'],
+    ],
+    cross_product_configs={
+        'device': ['cpu', 'cuda'],
+    },
+    tags=['short'],
+)
+
+
+class SortBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, M, N, order, device):
+        input_tensor = torch.rand(M, N, device=device)
+        if order == 'sorted':
+            input_tensor, _ = input_tensor.sort(dim=-1)
+        elif order == 'reverse':
+            input_tensor, _ = input_tensor.sort(dim=-1, descending=True)
+        self.inputs = {
+            "input": input_tensor,
+        }
+        self.set_module_name('sort')
+
+    def forward(self, input):
+        return torch.sort(input, dim=-1)
+
+
+op_bench.generate_pt_test(sort_configs_short, SortBenchmark)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
@@ -0,0 +1,58 @@
+import operator_benchmark as op_bench
+import torch
+
+
+"""Microbenchmarks for topk operator"""
+
+
+# Configs for PT topk operator. The row-length/k sweep covers the small-k
+# streaming selection path in the CPU kernel (k <= 32) on both sides of its
+# cutover, plus larger k for the partial_sort path.
+topk_configs_short = op_bench.config_list(
+    attr_names=['M', 'N', 'k'],
+    attrs=[
+        [256, 1024, 1],
+        [256, 1024, 8],
+        [256, 1024, 32],
+        [256, 1024, 64],
+        [64, 10000, 1],
+        [64, 10000, 8],
+        [64, 10000, 32],
+        [64, 10000, 64],
+        [8, 100000, 32],
+    ],
+    cross_product_configs={
+        'device': ['cpu', 'cuda'],
+        'largest': [True],
+    },
+    tags=['short'],
+)
+
+topk_configs_long = op_bench.cross_product_configs(
+    M=[64],
+    N=[1024, 10000, 100000],
+    k=[1, 4, 16, 32, 64, 128],
+    device=['cpu', 'cuda'],
+    largest=[True, False],
+    tags=['long'],
+)
+
+
+class TopKBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, M, N, k, device, largest):
+        self.inputs = {
+            "input": torch.rand(M, N, device=device),
+            "k": k,
+            "largest": largest,
+        }
+        self.set_module_name('topk')
+
+    def forward(self, input, k: int, largest: bool):
+        return torch.topk(input, k, dim=-1, largest=largest)
+
+
+op_bench.generate_pt_test(topk_configs_short + topk_configs_long, TopKBenchmark)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
@@ -0,0 +1,73 @@
+import operator_benchmark as op_bench
+import torch
+
+
+"""Microbenchmarks for the transpose/permute copy path (x.permute(...).contiguous())."""
+
+
+# 2-D transposes, square and skewed, tile-aligned and ragged
+transpose_copy_short_configs = op_bench.config_list(
+    attr_names=["M", "N"],
+    attrs=[
+        [64, 64],
+        [256, 256],
+        [1024, 1024],
+        [4096, 4096],
+        [131, 4099],
+        [4099, 131],
+    ],
+    cross_product_configs={
+        "dtype": [torch.float, torch.uint8],
+    },
+    tags=["short"],
+)
+
+
+class TransposeCopyBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, M, N, dtype):
+        self.inputs = {
+            "input_data": torch.rand(M, N).to(dtype=dtype),
+        }
+        self.set_module_name("transpose_copy")
+
+    def forward(self, input_data):
+        return input_data.t().contiguous()
+
+
+op_bench.generate_pt_test(transpose_copy_short_configs, TransposeCopyBenchmark)
+
+
+# NCHW <-> NHWC layout conversion on frame-like shapes
+permute_copy_configs = op_bench.cross_product_configs(
+    batch_size=[1, 4],
+    channels=[3, 32],
+    height=[270, 1080],
+    width=[480, 1920],
+    to_channels_last=[True, False],
+    tags=["long"],
+)
+
+
+class PermuteCopyBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, batch_size, channels, height, width, to_channels_last):
+        if to_channels_last:
+            input_data = torch.rand(batch_size, channels, height, width)
+        else:
+            input_data = torch.rand(batch_size, height, width, channels)
+        self.inputs = {
+            "input_data": input_data,
+            "to_channels_last": to_channels_last,
+        }
+        self.set_module_name("permute_copy")
+
+    def forward(self, input_data, to_channels_last: bool):
+        if to_channels_last:
+            return input_data.permute(0, 2, 3, 1).contiguous()
+        return input_data.permute(0, 3, 1, 2).contiguous()
+
+
+op_bench.generate_pt_test(permute_copy_configs, PermuteCopyBenchmark)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
@@ -0,0 +1,58 @@
+import argparse
+import sys
+import torch
+from utils import gen_sparse_coo, Event
+
+
+def test_sparse_addmm(m, n, k, nnz, test_count, dtype):
+    start_timer = Event(enable_timing=True)
+    stop_timer = Event(enable_timing=True)
+
+    coo = gen_sparse_coo((m, k), nnz).to(dtype).coalesce()
+    mat = torch.randn(k, n, dtype=dtype)
+    bias = torch.randn(m, n, dtype=dtype)
+
+    # warmup
+    torch.sparse.addmm(bias, coo, mat)
+
+    times = []
+    for _ in range(test_count):
+        start_timer.record()
+        torch.sparse.addmm(bias, coo, mat)
+        stop_timer.record()
+        times.append(start_timer.elapsed_time(stop_timer))
+
+    return sum(times) / len(times)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Sparsity sweep for sparse-dense addmm")
+
+    parser.add_argument("--m", default='1000', type=int)
+    parser.add_argument("--n", default='1000', type=int)
+    parser.add_argument("--k", default='1000', type=int)
+    parser.add_argument("--sparsity", default='0.9,0.95,0.99,0.999', type=str,
+                        help="comma-separated sparsity levels to sweep")
+    parser.add_argument("--dtype", default='float', type=str,
+                        choices=['float', 'double'])
+    parser.add_argument("--outfile", default='stdout', type=str)
+    parser.add_argument("--test_count", default='10', type=int)
+
+    args = parser.parse_args()
+
+    if args.outfile == 'stdout':
+        outfile = sys.stdout
+    elif args.outfile == 'stderr':
+        outfile = sys.stderr
+    else:
+        outfile = open(args.outfile, "a")
+
+    dtype = torch.float if args.dtype == 'float' else torch.double
+
+    for sparsity in map(float, args.sparsity.split(',')):
+        nnz = max(1, int(args.m * args.k * (1.0 - sparsity)))
+        time = test_sparse_addmm(
+            args.m, args.n, args.k, nnz, args.test_count, dtype)
+        print("addmm", args.m, args.n, args.k, args.dtype, sparsity, nnz,
+              time, sep="\t", file=outfile)
@@ -2,12 +2,17 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/irparser.h>
 #include <torch/csrc/jit/runtime/static/ProcessedNodeInputs.h>
+#include <torch/csrc/jit/runtime/static/admission_controller.h>
 #include <torch/csrc/jit/runtime/static/fusion.h>
 #include <torch/csrc/jit/runtime/static/impl.h>
 #include <torch/csrc/jit/runtime/static/memory_planner.h>
+#include <torch/csrc/jit/runtime/static/micro_batch_executor.h>
 #include <torch/csrc/jit/runtime/static/ops.h>
 #include <torch/csrc/jit/runtime/static/passes.h>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 #include "deep_wide_pt.h"
 #include "test_utils.h"
@@ -211,6 +216,61 @@ TEST(StaticModule, RValueInputs) {
   EXPECT_TRUE(expected.toTensor().equal(actual.toTensor()));
 }
 
+TEST(StaticModule, SwapConstant) {
+  Module m("module");
+  m.register_parameter("w", at::ones({2, 2}), /*is_buffer=*/false);
+  m.define(R"JIT(
+    def forward(self, x):
+        return (x + self.w).clone()
+  )JIT");
+  StaticModule sm(m);
+
+  // Freezing turned the parameter into the only 2x2 tensor constant.
+  c10::optional<size_t> w_idx;
+  for (const auto i : c10::irange(sm.num_constants())) {
+    const auto& constant = sm.constants()[i];
+    if (constant.isTensor() &&
+        constant.toTensor().sizes() == at::IntArrayRef({2, 2})) {
+      w_idx = i;
+      break;
+    }
+  }
+  ASSERT_TRUE(w_idx.has_value());
+
+  std::vector<IValue> input{at::ones({2, 2})};
+  auto out = sm(input, {});
+  EXPECT_TRUE(out.toTensor().equal(at::ones({2, 2}) * 2));
+
+  // The swap patches the cached runtime, so the next run sees the new
+  // weight without any replanning.
+  sm.swap_constant(*w_idx, at::zeros({2, 2}));
+  out = sm(input, {});
+  EXPECT_TRUE(out.toTensor().equal(at::ones({2, 2})));
+
+  // Layout-incompatible replacements are rejected.
+  EXPECT_THROW(sm.swap_constant(*w_idx, at::zeros({3, 3})), c10::Error);
+  EXPECT_THROW(
+      sm.swap_constant(*w_idx, at::zeros({2, 2}, at::kInt)), c10::Error);
+}
+
+TEST(StaticModule, FallbackOpCounts) {
+  // aten::argsort has neither an out variant nor a native functor, so it
+  // must be counted as an interpreter fallback; aten::relu and aten::clone
+  // are both covered and must not show up.
+  const std::string src = R"JIT(
+    def forward(self, x):
+        y = torch.argsort(torch.relu(x))
+        return y.clone()
+  )JIT";
+  auto sm = makeStaticModuleFromScript(src);
+
+  const auto& fallback_counts = sm.fallbackOpCounts();
+  EXPECT_EQ(fallback_counts.size(), 1);
+  auto it = fallback_counts.find("aten::argsort");
+  ASSERT_TRUE(it != fallback_counts.end());
+  EXPECT_EQ(it->second, 1);
+}
+
 TEST(StaticRuntime, ModuleHasOp) {
   EXPECT_TRUE(testModuleHasOp(reshape_inplace_script, "aten::sigmoid_"));
   EXPECT_TRUE(testModuleHasOp(reshape_inplace_script_1, "aten::reshape"));
@@ -1764,3 +1824,202 @@ TEST(FuseClampNaNToNum, NoFusion) {
   checkScript(src4);
 }
 #endif
+
+TEST(MemoryPlanner, ReusePlanBuffer) {
+  const auto src = R"JIT(
+    def forward(self, inp):
+        a = inp + inp
+        b = a * a
+        return b.clone()
+  )JIT";
+  torch::jit::Module mod("m");
+  mod.define(src);
+  torch::jit::StaticModuleOptions opts{
+      /*enable_out_variant=*/true,
+      /*optimize_memory=*/true,
+      /*manage_output_tensors=*/false,
+      /*reuse_plan_buffer=*/true};
+  torch::jit::StaticModule smod(mod, false, opts);
+  torch::jit::StaticRuntime runtime(smod);
+
+  auto big = at::randn({32, 16});
+  auto small = at::randn({4, 16});
+
+  // Warm-up run at the maximum batch size establishes the plan.
+  auto expect_big = runtime({big}, {}).toTensor();
+  EXPECT_TRUE(at::allclose(expect_big, (big + big) * (big + big)));
+  const auto* planner = runtime.get_memory_planner();
+  ASSERT_NE(planner, nullptr);
+  const auto planned_bytes = planner->total_managed();
+
+  // Smaller batches run out of a prefix of the same plan; the plan must not
+  // shrink, and outputs must stay correct.
+  auto out_small = runtime({small}, {}).toTensor();
+  EXPECT_TRUE(at::allclose(out_small, (small + small) * (small + small)));
+  EXPECT_EQ(runtime.get_memory_planner()->total_managed(), planned_bytes);
+
+  // Back to the maximum batch size without replanning.
+  auto out_big = runtime({big}, {}).toTensor();
+  EXPECT_TRUE(at::allclose(out_big, expect_big));
+  EXPECT_EQ(runtime.get_memory_planner()->total_managed(), planned_bytes);
+  runtime.check_for_memory_leak();
+}
+
+TEST(StaticModule, PeakMemoryEstimate) {
+  const auto src = R"JIT(
+    def forward(self, inp):
+        a = inp + inp
+        b = a * a
+        return b.clone()
+  )JIT";
+  torch::jit::Module mod("m");
+  mod.define(src);
+  torch::jit::StaticModule smod(mod);
+
+  // No runs yet, so there is nothing to base an estimate on.
+  EXPECT_FALSE(smod.peak_memory_estimate(8).has_value());
+
+  std::vector<c10::IValue> input{at::randn({8, 16})};
+  smod(input, {});
+  const auto* planner = smod.runtime().get_memory_planner();
+  ASSERT_NE(planner, nullptr);
+  ASSERT_GT(planner->total_managed(), 0);
+
+  // An observed batch size reports the exact managed bytes; unobserved
+  // batch sizes scale linearly from the nearest sample.
+  const auto est8 = smod.peak_memory_estimate(8);
+  ASSERT_TRUE(est8.has_value());
+  EXPECT_EQ(*est8, planner->total_managed());
+  const auto est16 = smod.peak_memory_estimate(16);
+  ASSERT_TRUE(est16.has_value());
+  EXPECT_EQ(*est16, 2 * *est8);
+  EXPECT_FALSE(smod.peak_memory_estimate(0).has_value());
+}
+
+TEST(MemoryAdmissionController, AdmitsQueuesAndReleases) {
+  auto& controller = MemoryAdmissionController::singleton();
+  controller.set_budget_bytes(1000);
+
+  auto first = controller.try_admit(600);
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(first->reserved_bytes(), 600);
+  EXPECT_EQ(controller.admitted_bytes(), 600);
+
+  // Over budget: non-blocking admission fails immediately...
+  EXPECT_FALSE(controller.try_admit(600).has_value());
+
+  // ...while blocking admission queues until capacity is released.
+  std::atomic<bool> admitted{false};
+  std::thread waiter([&controller, &admitted] {
+    auto ticket = controller.admit(600);
+    admitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(admitted);
+  first = c10::nullopt;
+  waiter.join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(controller.admitted_bytes(), 0);
+
+  controller.set_budget_bytes(0);
+}
+
+TEST(MemoryAdmissionController, OversizedRequestRunsAlone) {
+  auto& controller = MemoryAdmissionController::singleton();
+  controller.set_budget_bytes(100);
+  {
+    // Nothing in flight, so a request larger than the whole budget is
+    // admitted rather than deadlocking...
+    auto big = controller.admit(500);
+    EXPECT_EQ(big.reserved_bytes(), 500);
+    // ...but it keeps everything else queued until it finishes.
+    EXPECT_FALSE(controller.try_admit(50).has_value());
+  }
+  EXPECT_EQ(controller.admitted_bytes(), 0);
+  EXPECT_TRUE(controller.try_admit(50).has_value());
+  controller.set_budget_bytes(0);
+}
+
+namespace {
+
+torch::jit::Module getMicroBatchTestModel() {
+  const auto src = R"JIT(
+    def forward(self, a, b, c):
+        return (a + b * c).clone()
+  )JIT";
+  torch::jit::Module module("m");
+  module.define(src);
+  return module;
+}
+
+} // namespace
+
+TEST(MicroBatchExecutor, ScattersBatchedResults) {
+  torch::jit::Module mod = getMicroBatchTestModel();
+  auto smod = std::make_shared<torch::jit::StaticModule>(mod);
+
+  MicroBatchExecutor::Options options;
+  options.max_batch_size = 4;
+  options.max_latency = std::chrono::milliseconds(100);
+  MicroBatchExecutor executor(smod, options);
+
+  std::vector<c10::intrusive_ptr<c10::ivalue::Future>> futures;
+  std::vector<at::Tensor> expected;
+  for (int64_t rows : {1, 2, 3, 1}) {
+    auto a = torch::randn({rows, 4});
+    auto b = torch::randn({rows, 4});
+    auto c = torch::randn({rows, 4});
+    expected.push_back(mod.forward({a, b, c}).toTensor());
+    futures.push_back(executor({a, b, c}));
+  }
+
+  for (size_t i = 0; i < futures.size(); ++i) {
+    futures[i]->wait();
+    EXPECT_TRUE(
+        torch::allclose(futures[i]->value().toTensor(), expected[i]));
+  }
+}
+
+TEST(MicroBatchExecutor, DeadlineFlushesPartialBatch) {
+  torch::jit::Module mod = getMicroBatchTestModel();
+  auto smod = std::make_shared<torch::jit::StaticModule>(mod);
+
+  MicroBatchExecutor::Options options;
+  // The batch never fills up; the request must be flushed by the deadline.
+  options.max_batch_size = 64;
+  options.max_latency = std::chrono::milliseconds(1);
+  MicroBatchExecutor executor(smod, options);
+
+  auto a = torch::randn({2, 4});
+  auto b = torch::randn({2, 4});
+  auto c = torch::randn({2, 4});
+  auto expected = mod.forward({a, b, c}).toTensor();
+
+  auto future = executor({a, b, c});
+  future->wait();
+  EXPECT_TRUE(torch::allclose(future->value().toTensor(), expected));
+}
+
+TEST(MicroBatchExecutor, FailedBatchPropagatesError) {
+  torch::jit::Module mod = getMicroBatchTestModel();
+  auto smod = std::make_shared<torch::jit::StaticModule>(mod);
+
+  MicroBatchExecutor::Options options;
+  options.max_batch_size = 1;
+  MicroBatchExecutor executor(smod, options);
+
+  // Wrong arity: the runtime rejects the batch, and the error must surface
+  // through the future rather than tearing down the worker.
+  auto future = executor({torch::randn({1, 4})});
+  future->wait();
+  EXPECT_TRUE(future->hasError());
+
+  // The executor keeps serving requests afterwards.
+  auto a = torch::randn({1, 4});
+  auto b = torch::randn({1, 4});
+  auto c = torch::randn({1, 4});
+  auto ok = executor({a, b, c});
+  ok->wait();
+  EXPECT_TRUE(torch::allclose(
+      ok->value().toTensor(), mod.forward({a, b, c}).toTensor()));
+}
@@ -678,6 +678,61 @@ TEST(StaticRuntime, LayerNorm) {
   }
 }
 
+TEST(StaticRuntime, GroupNorm) {
+  const std::string group_norm_with_weights = R"JIT(
+    def forward(self, input: Tensor, num_groups: int, weight: Tensor, bias: Tensor):
+        return torch.group_norm(input, num_groups, weight, bias, 1e-05, False).clone()
+  )JIT";
+
+  const std::string group_norm_without_weights = R"JIT(
+    def forward(self, input: Tensor, num_groups: int):
+        return torch.group_norm(input, num_groups, None, None, 1e-05, False).clone()
+  )JIT";
+
+  const auto a = torch::rand({1, 8, 4, 4});
+  const auto b = torch::rand({3, 8, 2, 2});
+  const auto weight = torch::rand({8});
+  const auto bias = torch::rand({8});
+
+  std::vector<IValue> args{a, 2, weight, bias};
+  std::vector<IValue> args1{b, 4, weight, bias};
+  testStaticRuntime(group_norm_with_weights, args);
+  testStaticRuntime(group_norm_with_weights, args, args1);
+
+  args = {a, 2};
+  testStaticRuntime(group_norm_without_weights, args);
+  testStaticRuntime(group_norm_without_weights, args, {b, 4});
+}
+
+TEST(StaticRuntime, Relu6) {
+  const auto relu6_script = R"JIT(
+    def forward(self, input: Tensor):
+        return torch.relu6(input).clone()
+  )JIT";
+
+  auto a = at::randn({2, 3}) * 10;
+  auto b = at::randn({4, 3, 2}) * 10;
+
+  std::vector<IValue> args{a};
+  testStaticRuntime(relu6_script, args);
+  testStaticRuntime(relu6_script, args, {b});
+}
+
+TEST(StaticRuntime, FrobeniusNorm) {
+  const auto frobenius_norm_script = R"JIT(
+    def forward(self, input: Tensor, dim: List[int], keepdim: bool):
+        return torch.frobenius_norm(input, dim, keepdim).clone()
+  )JIT";
+
+  auto a = at::randn({2, 3});
+  auto b = at::randn({4, 3, 5});
+
+  std::vector<IValue> args{a, std::vector<int64_t>{1}, false};
+  std::vector<IValue> args1{b, std::vector<int64_t>{1, 2}, true};
+  testStaticRuntime(frobenius_norm_script, args);
+  testStaticRuntime(frobenius_norm_script, args, args1);
+}
+
 TEST(StaticRuntime, Bmm) {
   const auto bmm_script = R"JIT(
     def forward(self, inp: Tensor, mat2: Tensor):
@@ -0,0 +1,108 @@
+#include <c10/core/AllocationDomain.h>
+
+namespace c10 {
+
+namespace {
+
+thread_local std::string current_domain = kDefaultAllocationDomain;
+thread_local std::string current_op;
+
+} // namespace
+
+AllocationDomainTracker& AllocationDomainTracker::singleton() {
+  static AllocationDomainTracker tracker;
+  return tracker;
+}
+
+void AllocationDomainTracker::setEnabled(bool enabled) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  enabled_.store(enabled, std::memory_order_relaxed);
+  if (!enabled) {
+    live_.clear();
+    live_bytes_.clear();
+  }
+}
+
+void AllocationDomainTracker::recordAlloc(
+    void* ptr,
+    int64_t size,
+    Device device) {
+  if (!enabled() || ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (!enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  live_bytes_[current_domain] += size;
+  live_[ptr] = LiveAllocation{current_domain, current_op, size, device};
+}
+
+void AllocationDomainTracker::recordFree(void* ptr) {
+  if (!enabled() || ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = live_.find(ptr);
+  if (it == live_.end()) {
+    // Allocated before tracking was enabled (or by an untracked allocator).
+    return;
+  }
+  live_bytes_[it->second.domain] -= it->second.size;
+  live_.erase(it);
+}
+
+int64_t AllocationDomainTracker::liveBytes(const std::string& domain) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto it = live_bytes_.find(domain);
+  return it != live_bytes_.end() ? it->second : 0;
+}
+
+std::unordered_map<std::string, int64_t> AllocationDomainTracker::
+    liveBytesPerDomain() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return live_bytes_;
+}
+
+std::unordered_map<std::string, std::vector<AllocationDomainEntry>>
+AllocationDomainTracker::dumpLiveAllocations() const {
+  std::unordered_map<std::string, std::vector<AllocationDomainEntry>> dump;
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (const auto& kv : live_) {
+    AllocationDomainEntry entry;
+    entry.ptr = kv.first;
+    entry.size = kv.second.size;
+    entry.device = kv.second.device;
+    entry.op = kv.second.op;
+    dump[kv.second.domain].push_back(std::move(entry));
+  }
+  return dump;
+}
+
+const std::string& currentAllocationDomain() {
+  return current_domain;
+}
+
+AllocationDomainGuard::AllocationDomainGuard(std::string domain)
+    : prev_(std::move(current_domain)) {
+  current_domain = std::move(domain);
+}
+
+AllocationDomainGuard::~AllocationDomainGuard() {
+  current_domain = std::move(prev_);
+}
+
+const std::string& currentAllocationOp() {
+  return current_op;
+}
+
+AllocationOpContextGuard::AllocationOpContextGuard(std::string op)
+    : prev_(std::move(current_op)) {
+  current_op = std::move(op);
+}
+
+AllocationOpContextGuard::~AllocationOpContextGuard() {
+  current_op = std::move(prev_);
+}
+
+} // namespace c10
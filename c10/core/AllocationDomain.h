@@ -0,0 +1,127 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/macros/Export.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Scoped allocation domains:
+ *
+ * In a serving process many requests share one allocator, so when live memory
+ * grows there is no way to tell which request is holding it. An
+ * AllocationDomainGuard tags every allocation made by the current thread with
+ * a caller-chosen domain name (typically a request id); the process-wide
+ * tracker keeps a live-bytes counter per domain that can be polled cheaply,
+ * and can dump the allocations that are still alive in each domain together
+ * with the op that made them.
+ *
+ * Tracking is off by default. While it is off the hooks on the allocation
+ * path reduce to a single relaxed atomic load, so the guards can stay in
+ * serving code permanently and tracking can be flipped on when a leak is
+ * being chased. Attribution is by allocating thread: work handed to another
+ * thread (interop tasks, DataLoader workers) is only attributed if that
+ * thread enters a guard as well.
+ *
+ * The allocating op is taken from a thread-local op context that
+ * at::RecordFunction maintains while any callbacks are active (and that can
+ * also be set directly with AllocationOpContextGuard); allocations made
+ * outside any op scope are dumped with an empty op name.
+ */
+
+namespace c10 {
+
+// One surviving allocation, as returned by dumpLiveAllocations().
+struct C10_API AllocationDomainEntry {
+  void* ptr{nullptr};
+  int64_t size{0};
+  Device device{DeviceType::CPU};
+  // Op context captured when the allocation was made; may be empty.
+  std::string op;
+};
+
+class C10_API AllocationDomainTracker {
+ public:
+  static AllocationDomainTracker& singleton();
+
+  // Enabling starts tracking from this point on: allocations made before are
+  // never seen, and their frees are ignored. Disabling clears all state.
+  void setEnabled(bool enabled);
+  bool enabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  // Called from the allocator hooks; cheap no-ops while tracking is off.
+  void recordAlloc(void* ptr, int64_t size, Device device);
+  void recordFree(void* ptr);
+
+  // Live bytes currently attributed to `domain` (0 for unknown domains).
+  int64_t liveBytes(const std::string& domain) const;
+  // Snapshot of live bytes for every domain seen since tracking was enabled.
+  std::unordered_map<std::string, int64_t> liveBytesPerDomain() const;
+
+  // Surviving allocations grouped by domain. This copies under the tracker
+  // lock and is meant for debugging, not for the serving hot path.
+  std::unordered_map<std::string, std::vector<AllocationDomainEntry>>
+  dumpLiveAllocations() const;
+
+ private:
+  struct LiveAllocation {
+    std::string domain;
+    std::string op;
+    int64_t size{0};
+    Device device{DeviceType::CPU};
+  };
+
+  std::atomic<bool> enabled_{false};
+  mutable std::mutex mutex_;
+  std::unordered_map<void*, LiveAllocation> live_;
+  // Kept incrementally so liveBytes() does not walk live_.
+  std::unordered_map<std::string, int64_t> live_bytes_;
+};
+
+// Domain allocations fall into while no guard is in scope.
+constexpr const char* kDefaultAllocationDomain = "unscoped";
+
+C10_API const std::string& currentAllocationDomain();
+
+// Attributes allocations made by the current thread to `domain` for the
+// guard's lifetime. Nests: the previous domain is restored on destruction.
+struct C10_API AllocationDomainGuard {
+  explicit AllocationDomainGuard(std::string domain);
+  ~AllocationDomainGuard();
+
+  AllocationDomainGuard(const AllocationDomainGuard&) = delete;
+  AllocationDomainGuard(AllocationDomainGuard&&) = delete;
+  AllocationDomainGuard& operator=(const AllocationDomainGuard&) = delete;
+  AllocationDomainGuard& operator=(AllocationDomainGuard&&) = delete;
+
+ private:
+  std::string prev_;
+};
+
+C10_API const std::string& currentAllocationOp();
+
+// Names the op allocations are attributed to in dumps. RecordFunction sets
+// this automatically around op execution when callbacks are active; code
+// without record functions can use the guard directly.
+struct C10_API AllocationOpContextGuard {
+  explicit AllocationOpContextGuard(std::string op);
+  ~AllocationOpContextGuard();
+
+  AllocationOpContextGuard(const AllocationOpContextGuard&) = delete;
+  AllocationOpContextGuard(AllocationOpContextGuard&&) = delete;
+  AllocationOpContextGuard& operator=(const AllocationOpContextGuard&) =
+      delete;
+  AllocationOpContextGuard& operator=(AllocationOpContextGuard&&) = delete;
+
+ private:
+  std::string prev_;
+};
+
+} // namespace c10
@@ -49,11 +49,35 @@ void reportMemoryUsageToProfiler(
     int64_t total_allocated,
     int64_t total_reserved,
     Device device) {
+  reportMemoryUsageToProfiler(
+      ptr,
+      alloc_size,
+      total_allocated,
+      total_reserved,
+      device,
+      /*segment_ptr=*/nullptr,
+      /*segment_size=*/0);
+}
+
+void reportMemoryUsageToProfiler(
+    void* ptr,
+    int64_t alloc_size,
+    int64_t total_allocated,
+    int64_t total_reserved,
+    Device device,
+    void* segment_ptr,
+    int64_t segment_size) {
   auto* reporter_ptr = static_cast<MemoryReportingInfoBase*>(
       ThreadLocalDebugInfo::get(DebugInfoKind::PROFILER_STATE));
   if (reporter_ptr) {
     reporter_ptr->reportMemoryUsage(
-        ptr, alloc_size, total_allocated, total_reserved, device);
+        ptr,
+        alloc_size,
+        total_allocated,
+        total_reserved,
+        device,
+        segment_ptr,
+        segment_size);
   }
 }
 
@@ -235,13 +235,20 @@ struct C10_API MemoryReportingInfoBase : public c10::DebugInfoBase {
    *
    * total_reserved corresponds to total size of memory pool, both used and
    * unused, if applicable.
+   *
+   * Caching allocators additionally report the segment (the contiguous
+   * region obtained from the system allocator) that ptr was carved out of,
+   * which lets profilers attribute fragmentation to individual segments.
+   * Allocators without segments pass nullptr / 0.
    */
   virtual void reportMemoryUsage(
       void* ptr,
       int64_t alloc_size,
       int64_t total_allocated,
       int64_t total_reserved,
-      Device device) = 0;
+      Device device,
+      void* segment_ptr,
+      int64_t segment_size) = 0;
 
   virtual bool memoryProfilingEnabled() const = 0;
 };
@@ -253,5 +260,13 @@ C10_API void reportMemoryUsageToProfiler(
     int64_t total_allocated,
     int64_t total_reserved,
     Device device);
+C10_API void reportMemoryUsageToProfiler(
+    void* ptr,
+    int64_t alloc_size,
+    int64_t total_allocated,
+    int64_t total_reserved,
+    Device device,
+    void* segment_ptr,
+    int64_t segment_size);
 
 } // namespace c10
@@ -1,3 +1,4 @@
+#include <c10/core/AllocationDomain.h>
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/DeviceType.h>
 #include <c10/core/alignment.h>
@@ -182,6 +183,8 @@ void ProfiledCPUMemoryReporter::New(void* ptr, size_t nbytes) {
   if (nbytes == 0) {
     return;
   }
+  AllocationDomainTracker::singleton().recordAlloc(
+      ptr, nbytes, c10::Device(c10::DeviceType::CPU));
   auto profile_memory = memoryProfilingEnabled();
   size_t allocated = 0;
   if (FLAGS_caffe2_report_cpu_memory_usage || profile_memory) {
@@ -201,6 +204,7 @@ void ProfiledCPUMemoryReporter::New(void* ptr, size_t nbytes) {
 }
 
 void ProfiledCPUMemoryReporter::Delete(void* ptr) {
+  AllocationDomainTracker::singleton().recordFree(ptr);
   size_t nbytes = 0;
   auto profile_memory = memoryProfilingEnabled();
   size_t allocated = 0;
@@ -0,0 +1,56 @@
+#include <c10/core/DeferredVersionBump.h>
+
+#include <unordered_map>
+#include <utility>
+
+namespace c10 {
+
+namespace impl {
+
+namespace {
+
+thread_local bool deferral_enabled = false;
+
+// Pending bumps keyed by counter address, so a counter shared between views
+// is bumped once no matter how many of them were mutated. The mapped
+// intrusive_ptr keeps the counter alive until the flush.
+thread_local std::unordered_map<
+    std::atomic<uint32_t>*,
+    c10::intrusive_ptr<c10::intrusive_ptr_target>>
+    deferred_bumps;
+
+void flush_deferred_bumps() {
+  for (auto& kv : deferred_bumps) {
+    ++(*kv.first);
+  }
+  deferred_bumps.clear();
+}
+
+} // namespace
+
+bool version_bump_deferral_enabled() {
+  return deferral_enabled;
+}
+
+void defer_version_bump(
+    c10::intrusive_ptr<c10::intrusive_ptr_target> keepalive,
+    std::atomic<uint32_t>* version) {
+  deferred_bumps.emplace(version, std::move(keepalive));
+}
+
+} // namespace impl
+
+DeferredVersionBumpGuard::DeferredVersionBumpGuard()
+    : prev_enabled_(impl::deferral_enabled) {
+  impl::deferral_enabled = true;
+}
+
+DeferredVersionBumpGuard::~DeferredVersionBumpGuard() {
+  impl::deferral_enabled = prev_enabled_;
+  if (!prev_enabled_) {
+    // Outermost guard: publish one bump per recorded counter.
+    impl::flush_deferred_bumps();
+  }
+}
+
+} // namespace c10
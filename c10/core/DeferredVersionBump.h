@@ -0,0 +1,54 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+#include <c10/util/intrusive_ptr.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace c10 {
+
+namespace impl {
+
+// Returns true while a DeferredVersionBumpGuard is active on this thread.
+// Checked by VariableVersion::bump(); kept out-of-line so TensorImpl.h does
+// not need to see the thread-local state.
+C10_API bool version_bump_deferral_enabled();
+
+// Records one pending bump for the given version counter. `keepalive` holds
+// the counter's refcount so the counter outlives the region even if every
+// tensor sharing it dies inside; `version` is the counter's atomic, bumped
+// exactly once per distinct counter when the outermost guard exits.
+C10_API void defer_version_bump(
+    c10::intrusive_ptr<c10::intrusive_ptr_target> keepalive,
+    std::atomic<uint32_t>* version);
+
+} // namespace impl
+
+// A RAII, thread local (!) guard that defers version counter bumps: while it
+// is active, in-place mutations record their tensor's version counter instead
+// of incrementing it, and each distinct counter is incremented exactly once
+// when the outermost guard exits. This removes the contended atomic increment
+// from every mutation inside inference-only regions that operate on normal
+// (non-inference) tensors, which InferenceMode cannot help with.
+//
+// Because versions are published only at region exit, anything that reads
+// them mid-region — unpacking a saved variable, serialization relying on
+// _version — observes the pre-region values. Only use it around regions that
+// neither run backward nor inspect versions, and note that N mutations of the
+// same tensor inside one region collapse into a single bump.
+struct C10_API DeferredVersionBumpGuard {
+  DeferredVersionBumpGuard();
+  ~DeferredVersionBumpGuard();
+
+  DeferredVersionBumpGuard(const DeferredVersionBumpGuard&) = delete;
+  DeferredVersionBumpGuard& operator=(const DeferredVersionBumpGuard&) =
+      delete;
+  DeferredVersionBumpGuard(DeferredVersionBumpGuard&&) = delete;
+  DeferredVersionBumpGuard& operator=(DeferredVersionBumpGuard&&) = delete;
+
+ private:
+  bool prev_enabled_;
+};
+
+} // namespace c10
@@ -226,6 +226,9 @@ const char* toString(DispatchKey t) {
     case DispatchKey::DeferredInit:
       return "DeferredInit";
 
+    case DispatchKey::Memoize:
+      return "Memoize";
+
     case DispatchKey::Dense:
       return "Dense";
     case DispatchKey::Quantized:
@@ -298,6 +301,7 @@ c10::DispatchKey parseDispatchKey(const std::string& k) {
       {"Batched", c10::DispatchKey::Batched},
       {"VmapMode", c10::DispatchKey::VmapMode},
       {"DeferredInit", c10::DispatchKey::DeferredInit},
+      {"Memoize", c10::DispatchKey::Memoize},
       {"FuncTorchGradWrapper", c10::DispatchKey::FuncTorchGradWrapper},
       {"FuncTorchDynamicLayerFrontMode",
        c10::DispatchKey::FuncTorchDynamicLayerFrontMode},
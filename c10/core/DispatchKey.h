@@ -363,6 +363,12 @@ enum class DispatchKey : uint16_t {
   // See https://pytorch.org/torchdistx/latest/deferred_init.html
   DeferredInit,
 
+  // Opt-in memoization of pure functional ops: when this key is included
+  // in the thread-local set, a boxed fallback content-hashes the inputs of
+  // allowlisted ops and serves cached outputs. See
+  // aten/src/ATen/MemoizeFallback.cpp.
+  Memoize,
+
   // Used by Python key logic to know the set of tls on entry to the dispatcher
   // This kernel assumes it is the top-most non-functorch-related DispatchKey.
   // If you add a key above, make sure to update the fallback implementation for
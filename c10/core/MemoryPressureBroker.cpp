@@ -0,0 +1,130 @@
+#include <c10/core/MemoryPressureBroker.h>
+
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+
+namespace c10 {
+
+namespace {
+// Guards against an eviction callback re-entering evict() on the same thread,
+// e.g. when a cache frees memory through an allocator whose failure path
+// consults the broker.
+thread_local bool in_evict = false;
+} // namespace
+
+MemoryPressureBroker& MemoryPressureBroker::singleton() {
+  // Leaky singleton: caches may evict during static destruction.
+  static MemoryPressureBroker* broker = new MemoryPressureBroker();
+  return *broker;
+}
+
+MemoryPressureBroker::CacheHandle MemoryPressureBroker::registerCache(
+    std::string name,
+    double rebuild_cost,
+    BytesHeldFn bytes_held,
+    EvictFn evict) {
+  TORCH_CHECK(
+      rebuild_cost > 0, "rebuild_cost must be positive, got ", rebuild_cost);
+  TORCH_CHECK(bytes_held && evict, "cache callbacks must not be empty");
+  std::lock_guard<std::mutex> guard(mutex_);
+  CacheEntry entry;
+  entry.handle = next_handle_++;
+  entry.name = std::move(name);
+  entry.rebuild_cost = rebuild_cost;
+  entry.bytes_held = std::move(bytes_held);
+  entry.evict = std::move(evict);
+  caches_.push_back(std::move(entry));
+  return caches_.back().handle;
+}
+
+void MemoryPressureBroker::unregisterCache(CacheHandle handle) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  caches_.erase(
+      std::remove_if(
+          caches_.begin(),
+          caches_.end(),
+          [handle](const CacheEntry& e) { return e.handle == handle; }),
+      caches_.end());
+}
+
+size_t MemoryPressureBroker::evict(size_t bytes_needed) {
+  if (bytes_needed == 0 || in_evict) {
+    return 0;
+  }
+  in_evict = true;
+
+  // Snapshot the candidates so the callbacks run without the lock held; a
+  // callback may legitimately take its own locks or unregister other caches.
+  struct Candidate {
+    CacheHandle handle;
+    size_t bytes_held;
+    double score;
+    EvictFn evict;
+  };
+  std::vector<Candidate> candidates;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    candidates.reserve(caches_.size());
+    for (const auto& entry : caches_) {
+      const size_t held = entry.bytes_held();
+      if (held == 0) {
+        continue;
+      }
+      candidates.push_back(
+          {entry.handle,
+           held,
+           static_cast<double>(held) / entry.rebuild_cost,
+           entry.evict});
+    }
+  }
+  std::stable_sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const Candidate& a, const Candidate& b) { return a.score > b.score; });
+
+  size_t total_freed = 0;
+  for (const auto& candidate : candidates) {
+    if (total_freed >= bytes_needed) {
+      break;
+    }
+    const size_t freed = candidate.evict(bytes_needed - total_freed);
+    total_freed += freed;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      for (auto& entry : caches_) {
+        if (entry.handle == candidate.handle) {
+          entry.eviction_requests += 1;
+          entry.bytes_evicted += freed;
+          break;
+        }
+      }
+    }
+  }
+
+  in_evict = false;
+  return total_freed;
+}
+
+std::vector<CacheEvictionStats> MemoryPressureBroker::getStats() const {
+  // Copy the entries so the bytes_held callbacks run without the lock held.
+  std::vector<CacheEntry> entries;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    entries = caches_;
+  }
+  std::vector<CacheEvictionStats> stats;
+  stats.reserve(entries.size());
+  for (const auto& entry : entries) {
+    CacheEvictionStats s;
+    s.name = entry.name;
+    s.bytes_held = entry.bytes_held();
+    s.rebuild_cost = entry.rebuild_cost;
+    s.eviction_requests = entry.eviction_requests;
+    s.bytes_evicted = entry.bytes_evicted;
+    stats.push_back(std::move(s));
+  }
+  return stats;
+}
+
+} // namespace c10
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * MemoryPressureBroker:
+ *
+ * Several subsystems hold memory in long-lived caches (cuDNN conv workspaces
+ * and algorithm choices, prepacked weights, compiled kernels, ...) with no
+ * coordination between them: under memory pressure an allocation can fail
+ * while unrelated caches sit full. The broker is a process-wide registry
+ * those caches plug into so that pressure can be relieved in one place.
+ *
+ * A cache registers an eviction callback together with two hints: a
+ * callback reporting the bytes it currently holds, and a relative, unitless
+ * rebuild cost saying how expensive it is to refill after eviction. When a
+ * caller (typically an allocator's out-of-memory path, or a user via the
+ * explicit evict() API) asks for bytes, the broker visits caches in
+ * descending benefit/cost order -- bytes held divided by rebuild cost -- and
+ * stops as soon as the reported freed bytes cover the request.
+ *
+ * Byte reports are advisory: the broker does not verify that freed memory is
+ * on any particular device, so callbacks should report only memory that is
+ * actually returned to the allocator the caller is likely to retry against.
+ * Eviction callbacks are invoked without the broker's lock held and must be
+ * safe to call from an allocator failure path (in particular, they should
+ * not allocate).
+ */
+
+namespace c10 {
+
+// Point-in-time view of one registered cache, for diagnostics.
+struct C10_API CacheEvictionStats {
+  std::string name;
+  // Bytes the cache reported holding when the stats were taken.
+  size_t bytes_held{0};
+  // Rebuild cost hint supplied at registration.
+  double rebuild_cost{0};
+  // Number of times the broker asked this cache to evict.
+  uint64_t eviction_requests{0};
+  // Total bytes the cache reported freeing across all requests.
+  uint64_t bytes_evicted{0};
+};
+
+class C10_API MemoryPressureBroker {
+ public:
+  using CacheHandle = uint64_t;
+  // Reports an estimate of the bytes the cache currently holds.
+  using BytesHeldFn = std::function<size_t()>;
+  // Asked to release roughly `bytes_requested` bytes; returns the number of
+  // bytes actually freed. A cache is free to release more (e.g. all-or-
+  // nothing caches) or less than requested.
+  using EvictFn = std::function<size_t(size_t bytes_requested)>;
+
+  static constexpr CacheHandle kInvalidCacheHandle = 0;
+
+  static MemoryPressureBroker& singleton();
+
+  // Registers a cache; `rebuild_cost` must be positive. The returned handle
+  // stays valid until unregisterCache. Callbacks may be invoked from any
+  // thread until then.
+  CacheHandle registerCache(
+      std::string name,
+      double rebuild_cost,
+      BytesHeldFn bytes_held,
+      EvictFn evict);
+  void unregisterCache(CacheHandle handle);
+
+  // Asks registered caches, in descending benefit/cost order, to shed
+  // capacity until roughly `bytes_needed` bytes have been reported freed.
+  // Returns the total bytes reported freed. Reentrant calls (an eviction
+  // callback ending up back here on the same thread) are no-ops.
+  size_t evict(size_t bytes_needed);
+
+  std::vector<CacheEvictionStats> getStats() const;
+
+ private:
+  MemoryPressureBroker() = default;
+
+  struct CacheEntry {
+    CacheHandle handle{kInvalidCacheHandle};
+    std::string name;
+    double rebuild_cost{1.0};
+    BytesHeldFn bytes_held;
+    EvictFn evict;
+    uint64_t eviction_requests{0};
+    uint64_t bytes_evicted{0};
+  };
+
+  mutable std::mutex mutex_;
+  std::vector<CacheEntry> caches_;
+  CacheHandle next_handle_{1};
+};
+
+} // namespace c10
@@ -1 +1,50 @@
 #include <c10/core/StorageImpl.h>
+#include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/numa.h>
+
+#include <cstring>
+
+namespace c10 {
+
+bool StorageImpl::replicate_across_numa_nodes() {
+  if (numa_replicas_) {
+    return true;
+  }
+  if (!IsNUMAEnabled() || device_type() != DeviceType::CPU || resizable_ ||
+      size_bytes_ == 0 || data_ptr_.get() == nullptr) {
+    return false;
+  }
+  const int num_nodes = GetNumNUMANodes();
+  if (num_nodes <= 1) {
+    return false;
+  }
+  const int home_node = GetNUMANode(data_ptr_.get());
+  auto replicas = std::make_unique<NumaReplicas>();
+  replicas->per_node.resize(num_nodes);
+  for (int node = 0; node < num_nodes; ++node) {
+    if (node == home_node) {
+      continue;
+    }
+    void* copy = alloc_cpu_on_node(size_bytes_, node);
+    std::memcpy(copy, data_ptr_.get(), size_bytes_);
+    replicas->per_node[node] =
+        at::DataPtr(copy, copy, &free_cpu, Device(DeviceType::CPU));
+  }
+  numa_replicas_ = std::move(replicas);
+  return true;
+}
+
+void* StorageImpl::numa_local_data() const {
+  // Threads serving inference on multi-socket boxes are pinned to a socket
+  // for their lifetime, so the node lookup (a syscall) is cached per thread
+  // rather than paid on every data() call.
+  static thread_local int node = GetCurrentNUMANode();
+  const auto& per_node = numa_replicas_->per_node;
+  if (node >= 0 && static_cast<size_t>(node) < per_node.size() &&
+      per_node[node]) {
+    return per_node[node].get();
+  }
+  return data_ptr_.get();
+}
+
+} // namespace c10
@@ -3,8 +3,13 @@
 #include <c10/core/Allocator.h>
 #include <c10/core/ScalarType.h>
 
+#include <c10/util/Optional.h>
 #include <c10/util/intrusive_ptr.h>
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace c10 {
 
 // A storage represents the underlying backing data buffer for a
@@ -63,16 +68,35 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
             allocator,
             resizable) {}
 
-  StorageImpl& operator=(StorageImpl&& other) = default;
+  // Content-hash cache state is deliberately not transferred: the target's
+  // data just changed, so any cached fingerprint is stale.
+  StorageImpl& operator=(StorageImpl&& other) {
+    data_ptr_ = std::move(other.data_ptr_);
+    size_bytes_ = other.size_bytes_;
+    resizable_ = other.resizable_;
+    received_cuda_ = other.received_cuda_;
+    allocator_ = other.allocator_;
+    numa_replicas_ = std::move(other.numa_replicas_);
+    invalidate_content_hash();
+    return *this;
+  }
   StorageImpl& operator=(const StorageImpl&) = delete;
   StorageImpl() = delete;
-  StorageImpl(StorageImpl&& other) = default;
+  StorageImpl(StorageImpl&& other) noexcept
+      : data_ptr_(std::move(other.data_ptr_)),
+        size_bytes_(other.size_bytes_),
+        resizable_(other.resizable_),
+        received_cuda_(other.received_cuda_),
+        allocator_(other.allocator_),
+        numa_replicas_(std::move(other.numa_replicas_)) {}
   StorageImpl(const StorageImpl&) = delete;
   ~StorageImpl() override = default;
 
   void reset() {
     data_ptr_.clear();
+    numa_replicas_.reset();
     size_bytes_ = 0;
+    invalidate_content_hash();
   }
 
   template <typename T>
@@ -82,13 +106,14 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
 
   template <typename T>
   inline T* unsafe_data() const {
-    return static_cast<T*>(this->data_ptr_.get());
+    return static_cast<T*>(this->data());
   }
 
   // Destructor doesn't call release_resources because it's
   // unnecessary; don't forget to change that if needed!
   void release_resources() override {
     data_ptr_.clear();
+    numa_replicas_.reset();
   }
 
   size_t nbytes() const {
@@ -98,6 +123,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
   // TODO: remove later
   void set_nbytes(size_t size_bytes) {
     size_bytes_ = size_bytes;
+    invalidate_content_hash();
   }
 
   bool resizable() const {
@@ -116,19 +142,29 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
   at::DataPtr set_data_ptr(at::DataPtr&& data_ptr) {
     at::DataPtr old_data_ptr(std::move(data_ptr_));
     data_ptr_ = std::move(data_ptr);
+    numa_replicas_.reset();
+    invalidate_content_hash();
     return old_data_ptr;
   };
 
   void set_data_ptr_noswap(at::DataPtr&& data_ptr) {
     data_ptr_ = std::move(data_ptr);
+    numa_replicas_.reset();
+    invalidate_content_hash();
   }
 
   // TODO: Return const ptr eventually if possible
   void* data() {
+    if (C10_UNLIKELY(numa_replicas_ != nullptr)) {
+      return numa_local_data();
+    }
     return data_ptr_.get();
   }
 
   void* data() const {
+    if (C10_UNLIKELY(numa_replicas_ != nullptr)) {
+      return numa_local_data();
+    }
     return data_ptr_.get();
   }
 
@@ -185,6 +221,8 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     size_bytes_ = size_bytes;
     allocator_ = nullptr;
     resizable_ = false;
+    numa_replicas_.reset();
+    invalidate_content_hash();
   }
 
   // This method can be used only after storage construction and cannot be used
@@ -197,7 +235,95 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     return received_cuda_;
   }
 
+  // Lazily maintained content fingerprint (see at::native::_content_hash).
+  // The cache is keyed by the identity and value of the hashing tensor's
+  // version counter at hash time; in-place ops bump the counter, so a
+  // version mismatch acts as the dirty bit and the hash is recomputed on
+  // the next read. Version counters live on TensorImpls, not storages: a
+  // second whole-storage alias (e.g. via set_()) carries an independent
+  // counter whose values are unrelated, so a bare version match could be
+  // coincidental - hence the identity check, and hence observing a second
+  // distinct counter poisons the slot and disables caching for this
+  // storage, since bumps of one counter are invisible to entries keyed by
+  // the other. A state of 0 means "no valid hash"; otherwise state stores
+  // version + 1.
+  c10::optional<uint64_t> read_content_hash(
+      uintptr_t counter_id,
+      uint64_t version) const {
+    if (content_hash_counter_.load(std::memory_order_acquire) != counter_id) {
+      return c10::nullopt;
+    }
+    uint64_t state = content_hash_state_.load(std::memory_order_acquire);
+    if (state != version + 1) {
+      return c10::nullopt;
+    }
+    uint64_t hash = content_hash_.load(std::memory_order_relaxed);
+    if (content_hash_state_.load(std::memory_order_acquire) != state ||
+        content_hash_counter_.load(std::memory_order_acquire) != counter_id) {
+      return c10::nullopt;
+    }
+    return hash;
+  }
+
+  // Concurrent writers with different keys imply the caller is mutating the
+  // tensor while hashing it - already a data race - so this only guards
+  // against publishing a torn hash: the final compare-exchange leaves the
+  // cache invalid when another writer interleaved.
+  void cache_content_hash(
+      uintptr_t counter_id,
+      uint64_t version,
+      uint64_t hash) {
+    content_hash_state_.store(0, std::memory_order_release);
+    uintptr_t observed = content_hash_counter_.load(std::memory_order_relaxed);
+    if (observed == kContentHashPoisoned) {
+      return;
+    }
+    if (observed != counter_id) {
+      // The first counter to hash this storage claims the slot; a second
+      // distinct one proves the storage is reachable through more than one
+      // counter and no cached value can be trusted again.
+      content_hash_counter_.store(
+          observed == 0 ? counter_id : kContentHashPoisoned,
+          std::memory_order_release);
+      if (observed != 0) {
+        return;
+      }
+    }
+    content_hash_.store(hash, std::memory_order_relaxed);
+    uint64_t expected = 0;
+    content_hash_state_.compare_exchange_strong(
+        expected,
+        version + 1,
+        std::memory_order_release,
+        std::memory_order_relaxed);
+  }
+
+  void invalidate_content_hash() {
+    content_hash_state_.store(0, std::memory_order_release);
+  }
+
+  // Copies this storage's bytes onto every NUMA node so each socket reads
+  // from local memory; data() then resolves to the calling thread's node
+  // replica. Only meaningful for storages used read-only from then on:
+  // writes after replication reach a single replica and are not propagated.
+  // Returns true if replicas exist afterwards; false (and no change) on
+  // non-CPU or resizable storages, single-node systems and non-NUMA builds.
+  // Anything that swaps out the data pointer drops the replicas.
+  bool replicate_across_numa_nodes();
+
+  bool is_numa_replicated() const {
+    return numa_replicas_ != nullptr;
+  }
+
  private:
+  struct NumaReplicas {
+    // Indexed by NUMA node id; the node that already hosts the original
+    // allocation keeps a null entry and falls through to data_ptr_.
+    std::vector<at::DataPtr> per_node;
+  };
+
+  void* numa_local_data() const;
+
   DataPtr data_ptr_;
   size_t size_bytes_;
   bool resizable_;
@@ -205,5 +331,14 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
   // local to process cuda memory allocation
   bool received_cuda_;
   Allocator* allocator_;
+  // See read_content_hash() above. The counter slot holds 0 (never hashed),
+  // the identity of the single version counter observed so far, or
+  // kContentHashPoisoned once a second counter was seen.
+  static constexpr uintptr_t kContentHashPoisoned = ~uintptr_t(0);
+  std::atomic<uintptr_t> content_hash_counter_{0};
+  std::atomic<uint64_t> content_hash_state_{0};
+  std::atomic<uint64_t> content_hash_{0};
+  // Non-null only after replicate_across_numa_nodes() succeeded.
+  std::unique_ptr<NumaReplicas> numa_replicas_;
 };
 } // namespace c10
@@ -2,6 +2,7 @@
 
 #include <c10/core/Backend.h>
 #include <c10/core/CopyBytes.h>
+#include <c10/core/DeferredVersionBump.h>
 #include <c10/core/DispatchKeySet.h>
 #include <c10/core/InferenceMode.h>
 #include <c10/core/MemoryFormat.h>
@@ -335,6 +336,13 @@ struct C10_API VariableVersion {
         "You can make a clone to get a normal tensor before doing inplace update."
         "See https://github.com/pytorch/rfcs/pull/17 for more details.");
     if (version_counter_) {
+      if (C10_UNLIKELY(impl::version_bump_deferral_enabled())) {
+        // Inside a DeferredVersionBumpGuard region: record the counter for
+        // a single bump at region exit instead of incrementing it here.
+        impl::defer_version_bump(
+            version_counter_, &version_counter_->version_);
+        return;
+      }
       ++version_counter_->version_;
     }
   }
@@ -346,6 +354,14 @@ struct C10_API VariableVersion {
         version_counter_, "Inference tensors do not track version counter.");
     return version_counter_->version_;
   }
+
+  // Identity of the underlying counter object. Counters are per-TensorImpl,
+  // so caches keyed by version values must also compare identities: equal
+  // versions from distinct counters are unrelated (see
+  // StorageImpl::read_content_hash). Zero when disabled.
+  uintptr_t counter_id() const {
+    return reinterpret_cast<uintptr_t>(version_counter_.get());
+  }
 };
 
 // Forward declaration of TensorImpl needed for forward declaration of
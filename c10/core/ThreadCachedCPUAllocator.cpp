@@ -0,0 +1,304 @@
+#include <c10/core/ThreadCachedCPUAllocator.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/DeviceType.h>
+#include <c10/core/impl/alloc_cpu.h>
+#include <c10/util/Exception.h>
+#include <c10/util/SmallVector.h>
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace c10 {
+
+namespace {
+
+// Every cached block is preceded by a gAlignment-sized header that records
+// its size class, so the deleter can route the block back to the right free
+// list without a global pointer-to-size map. gAlignment padding keeps the
+// pointer handed to the user suitably aligned for SIMD kernels.
+constexpr size_t kHeaderBytes = gAlignment;
+
+// Smallest size class; also the block alignment granularity.
+constexpr size_t kMinClassBytes = gAlignment;
+// Largest allocation served from the cache. Bigger requests go to alloc_cpu.
+constexpr size_t kMaxCachedBytes = 1u << 20; // 1 MiB
+constexpr size_t kNumClasses =
+    llvm::countTrailingZeros(kMaxCachedBytes / kMinClassBytes) + 1;
+
+// Number of blocks moved between a thread cache and the shared pool at once.
+constexpr size_t kTransferBatch = 16;
+// A thread-local list longer than this spills half its blocks to the pool.
+constexpr size_t kMaxListLength = 64;
+// Slabs are carved in multiples of this many blocks (capped at 2 MiB).
+constexpr size_t kSlabBlocks = 32;
+
+inline size_t size_class_index(size_t nbytes) {
+  // Round up to the next power of two, then map to [0, kNumClasses).
+  const size_t rounded = std::max(kMinClassBytes, llvm::PowerOf2Ceil(nbytes));
+  return llvm::countTrailingZeros(rounded / kMinClassBytes);
+}
+
+inline size_t size_class_bytes(size_t index) {
+  return kMinClassBytes << index;
+}
+
+struct BlockHeader {
+  uint32_t size_class;
+  uint32_t cached; // nonzero iff the block came from the slab pool
+};
+
+inline BlockHeader* header_of(void* user_ptr) {
+  return reinterpret_cast<BlockHeader*>(
+      static_cast<uint8_t*>(user_ptr) - kHeaderBytes);
+}
+
+inline void* user_ptr_of(void* raw_ptr) {
+  return static_cast<uint8_t*>(raw_ptr) + kHeaderBytes;
+}
+
+struct Stats {
+  std::atomic<size_t> allocated_from_cache{0};
+  std::atomic<size_t> allocated_from_slab{0};
+  std::atomic<size_t> allocated_oversize{0};
+};
+
+Stats& stats() {
+  static Stats s;
+  return s;
+}
+
+// Process-wide pool of freed blocks plus the slabs backing them. Touched only
+// on thread-cache refill/spill, so the mutex is off the hot path.
+class SlabPool {
+ public:
+  static SlabPool& singleton() {
+    // Leaked deliberately: thread caches may spill during static destruction.
+    static SlabPool* pool = new SlabPool();
+    return *pool;
+  }
+
+  // Moves up to kTransferBatch blocks of `size_class` into `out`, carving a
+  // fresh slab when the free list is empty.
+  void refill(size_t size_class, SmallVectorImpl<void*>& out) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& list = free_lists_[size_class];
+    if (list.empty()) {
+      carve_slab(size_class, list);
+    }
+    const size_t take = std::min(list.size(), kTransferBatch);
+    out.append(list.end() - take, list.end());
+    list.resize(list.size() - take);
+    cached_bytes_ -= take * (size_class_bytes(size_class) + kHeaderBytes);
+  }
+
+  void spill(size_t size_class, SmallVectorImpl<void*>& blocks, size_t count) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto& list = free_lists_[size_class];
+    list.insert(list.end(), blocks.end() - count, blocks.end());
+    blocks.resize(blocks.size() - count);
+    cached_bytes_ += count * (size_class_bytes(size_class) + kHeaderBytes);
+  }
+
+  void empty_cache() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Slabs can only be returned wholesale: blocks still checked out to
+    // thread caches or live tensors pin their slab. To keep bookkeeping
+    // cheap we release only slabs whose blocks are all in the pool, which
+    // in steady-state quiescence is all of them.
+    ska::flat_hash_map<void*, size_t> pooled_per_slab;
+    for (const auto& list : free_lists_) {
+      for (void* block : list) {
+        pooled_per_slab[header_of(user_ptr_of(block))->cached
+                ? slab_of_[block]
+                : nullptr]++;
+      }
+    }
+    std::vector<void*> released;
+    for (auto& slab : slabs_) {
+      if (pooled_per_slab[slab.first] == slab.second.blocks) {
+        released.push_back(slab.first);
+      }
+    }
+    for (void* slab : released) {
+      for (auto& list : free_lists_) {
+        list.erase(
+            std::remove_if(
+                list.begin(),
+                list.end(),
+                [&](void* block) { return slab_of_[block] == slab; }),
+            list.end());
+      }
+      // Drop the per-block entries too, or the map grows by one slab's worth
+      // of tombstones on every release/carve cycle.
+      const SlabInfo info = slabs_[slab];
+      uint8_t* base = static_cast<uint8_t*>(slab);
+      for (size_t i = 0; i < info.blocks; ++i) {
+        slab_of_.erase(base + i * info.block_bytes);
+      }
+      slabs_.erase(slab);
+      free_cpu(slab);
+    }
+    cached_bytes_ = 0;
+    for (size_t c = 0; c < kNumClasses; ++c) {
+      cached_bytes_ +=
+          free_lists_[c].size() * (size_class_bytes(c) + kHeaderBytes);
+    }
+  }
+
+  size_t cached_bytes() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return cached_bytes_;
+  }
+
+ private:
+  SlabPool() = default;
+
+  void carve_slab(size_t size_class, std::vector<void*>& list) {
+    const size_t block_bytes = size_class_bytes(size_class) + kHeaderBytes;
+    const size_t blocks =
+        std::max<size_t>(1, std::min(kSlabBlocks, (2u << 20) / block_bytes));
+    uint8_t* slab = static_cast<uint8_t*>(alloc_cpu(blocks * block_bytes));
+    slabs_.emplace(slab, SlabInfo{blocks, block_bytes});
+    for (size_t i = 0; i < blocks; ++i) {
+      void* block = slab + i * block_bytes;
+      // Stamp the header right away: empty_cache reads it for every pooled
+      // block, including ones that were never handed out (raw_allocate
+      // re-stamps it on every hand-out anyway).
+      *reinterpret_cast<BlockHeader*>(block) = {
+          static_cast<uint32_t>(size_class), /*cached=*/1};
+      slab_of_[block] = slab;
+      list.push_back(block);
+    }
+    cached_bytes_ += blocks * block_bytes;
+    stats().allocated_from_slab += blocks * block_bytes;
+  }
+
+  struct SlabInfo {
+    size_t blocks;
+    size_t block_bytes;
+  };
+
+  std::mutex mutex_;
+  std::array<std::vector<void*>, kNumClasses> free_lists_;
+  // slab base -> carving geometry, for releasing and unmapping its blocks
+  ska::flat_hash_map<void*, SlabInfo> slabs_;
+  // block -> owning slab base
+  ska::flat_hash_map<void*, void*> slab_of_;
+  size_t cached_bytes_ = 0;
+};
+
+// Per-thread size-class free lists. On thread exit everything is spilled back
+// to the shared pool.
+class ThreadCache {
+ public:
+  static ThreadCache& current() {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  ~ThreadCache() {
+    for (size_t c = 0; c < kNumClasses; ++c) {
+      if (!lists_[c].empty()) {
+        SlabPool::singleton().spill(c, lists_[c], lists_[c].size());
+      }
+    }
+  }
+
+  void* allocate(size_t size_class) {
+    auto& list = lists_[size_class];
+    if (C10_UNLIKELY(list.empty())) {
+      SlabPool::singleton().refill(size_class, list);
+      TORCH_INTERNAL_ASSERT(!list.empty());
+    }
+    void* block = list.back();
+    list.pop_back();
+    return block;
+  }
+
+  void free(size_t size_class, void* block) {
+    auto& list = lists_[size_class];
+    list.push_back(block);
+    if (C10_UNLIKELY(list.size() > kMaxListLength)) {
+      SlabPool::singleton().spill(size_class, list, list.size() / 2);
+    }
+  }
+
+ private:
+  std::array<SmallVector<void*, kMaxListLength>, kNumClasses> lists_;
+};
+
+struct ThreadCachedCPUAllocator final : at::Allocator {
+  at::DataPtr allocate(size_t nbytes) const override {
+    void* data = raw_allocate(nbytes);
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {data, data, &ReportAndDelete, at::Device(at::DeviceType::CPU)};
+  }
+
+  static void* raw_allocate(size_t nbytes) {
+    if (C10_UNLIKELY(nbytes == 0)) {
+      return nullptr;
+    }
+    if (C10_UNLIKELY(nbytes > kMaxCachedBytes)) {
+      void* raw = alloc_cpu(nbytes + kHeaderBytes);
+      void* data = user_ptr_of(raw);
+      *header_of(data) = {0, /*cached=*/0};
+      stats().allocated_oversize += nbytes;
+      return data;
+    }
+    const size_t size_class = size_class_index(nbytes);
+    void* data = user_ptr_of(ThreadCache::current().allocate(size_class));
+    *header_of(data) = {static_cast<uint32_t>(size_class), /*cached=*/1};
+    stats().allocated_from_cache += size_class_bytes(size_class);
+    return data;
+  }
+
+  static void ReportAndDelete(void* ptr) {
+    if (!ptr) {
+      return;
+    }
+    profiledCPUMemoryReporter().Delete(ptr);
+    BlockHeader* header = header_of(ptr);
+    if (C10_UNLIKELY(!header->cached)) {
+      free_cpu(header);
+      return;
+    }
+    ThreadCache::current().free(
+        header->size_class, static_cast<uint8_t*>(ptr) - kHeaderBytes);
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &ReportAndDelete;
+  }
+};
+
+} // namespace
+
+at::Allocator* GetThreadCachedCPUAllocator() {
+  static ThreadCachedCPUAllocator allocator;
+  return &allocator;
+}
+
+namespace cpu_alloc {
+
+void emptyThreadCachedCPUAllocatorCache() {
+  SlabPool::singleton().empty_cache();
+}
+
+ThreadCachedAllocatorStats getThreadCachedCPUAllocatorStats() {
+  ThreadCachedAllocatorStats result;
+  result.allocated_from_cache = stats().allocated_from_cache.load();
+  result.allocated_from_slab = stats().allocated_from_slab.load();
+  result.allocated_oversize = stats().allocated_oversize.load();
+  result.cached_bytes = SlabPool::singleton().cached_bytes();
+  return result;
+}
+
+} // namespace cpu_alloc
+
+} // namespace c10
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <c10/core/Allocator.h>
+#include <c10/core/alignment.h>
+#include <c10/macros/Export.h>
+
+/*
+ * ThreadCachedCPUAllocator:
+ *
+ * A caching CPU allocator intended for high-QPS CPU inference where the
+ * per-allocation cost of malloc/free is measurable on the hot path. It is
+ * structured like a simplified tcmalloc front-end:
+ *
+ *  - Allocations up to kMaxCachedBytes are rounded up to a power-of-two size
+ *    class and served from a per-thread free list. The fast path performs no
+ *    atomic operations and takes no locks.
+ *  - When a thread-local free list is empty, a batch of blocks is pulled from
+ *    a process-wide slab pool under a mutex. When the pool is empty, a slab
+ *    is carved from alloc_cpu and split into blocks of the requested class.
+ *  - Frees push blocks back onto the freeing thread's list; lists that grow
+ *    past a watermark spill half of their blocks back to the shared pool so
+ *    producer/consumer thread patterns do not leak memory into idle caches.
+ *  - Allocations larger than kMaxCachedBytes go straight to
+ *    alloc_cpu/free_cpu, exactly as DefaultCPUAllocator would.
+ *
+ * Cached slabs are only returned to the system allocator via emptyCache(),
+ * mirroring the contract of c10::cuda::CUDACachingAllocator. Enable it
+ * process-wide with:
+ *
+ *   c10::SetCPUAllocator(c10::GetThreadCachedCPUAllocator(), /*priority=*/1);
+ */
+
+namespace c10 {
+
+// Returns the singleton thread-cached CPU allocator. The instance is created
+// on first use and lives for the duration of the process.
+C10_API at::Allocator* GetThreadCachedCPUAllocator();
+
+namespace cpu_alloc {
+
+// Releases all blocks held in the process-wide slab pool back to the system
+// allocator. Blocks sitting in per-thread caches are spilled to the pool when
+// their owning threads exit and are reclaimed by the next call.
+C10_API void emptyThreadCachedCPUAllocatorCache();
+
+// Aggregate statistics for the thread-cached allocator, in bytes.
+struct C10_API ThreadCachedAllocatorStats {
+  size_t allocated_from_cache = 0; // served from a free list
+  size_t allocated_from_slab = 0; // served by carving a new slab
+  size_t allocated_oversize = 0; // fell through to alloc_cpu
+  size_t cached_bytes = 0; // currently held in the shared pool
+};
+
+C10_API ThreadCachedAllocatorStats getThreadCachedCPUAllocatorStats();
+
+} // namespace cpu_alloc
+
+} // namespace c10
@@ -6,6 +6,14 @@
 #include <c10/util/irange.h>
 #include <c10/util/numa.h>
 
+#include <atomic>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#include <cstdio>
+#include <fstream>
+#endif
+
 // TODO: rename flags to C10
 C10_DEFINE_bool(
     caffe2_cpu_allocator_do_zero_fill,
@@ -17,6 +25,15 @@ C10_DEFINE_bool(
     false,
     "If set, fill memory with deterministic junk when allocating on CPU");
 
+C10_DEFINE_int64(
+    caffe2_cpu_allocator_hugepage_threshold,
+    0,
+    "If positive, CPU allocations of at least this many bytes are aligned "
+    "to the huge page size and advised to the kernel with MADV_HUGEPAGE, "
+    "so large tensors (e.g. embedding tables) can be backed by "
+    "transparent huge pages and put less pressure on the dTLB. "
+    "0 disables the hugepage path. Linux only.");
+
 namespace c10 {
 
 namespace {
@@ -41,6 +58,42 @@ void memset_junk(void* data, size_t num) {
   }
 }
 
+#if defined(__linux__) && !defined(__ANDROID__)
+#define C10_HAVE_HUGEPAGE_ALLOC 1
+#endif
+
+#ifdef C10_HAVE_HUGEPAGE_ALLOC
+// Size the kernel assembles transparent huge pages at on x86-64 and most
+// aarch64 configurations. Aligning the allocation to this makes every page
+// of it a THP candidate; a stray offset would leave the first and last
+// chunks on 4K pages.
+constexpr size_t gHugePageSize = 2 * 1024 * 1024;
+
+std::atomic<size_t> g_hugepage_eligible_allocations{0};
+std::atomic<size_t> g_hugepage_eligible_bytes{0};
+std::atomic<size_t> g_hugepage_advised_bytes{0};
+
+bool use_hugepages(size_t nbytes) {
+  const auto threshold = FLAGS_caffe2_cpu_allocator_hugepage_threshold;
+  return threshold > 0 && nbytes >= static_cast<size_t>(threshold);
+}
+
+// Current process-wide AnonHugePages, in bytes. Reads smaps_rollup, which
+// the kernel aggregates for us; this is only called from the stats getter,
+// never on the allocation path.
+size_t read_anon_huge_pages_bytes() {
+  std::ifstream rollup("/proc/self/smaps_rollup");
+  std::string line;
+  while (std::getline(rollup, line)) {
+    size_t kb = 0;
+    if (sscanf(line.c_str(), "AnonHugePages: %zu kB", &kb) == 1) {
+      return kb * 1024;
+    }
+  }
+  return 0;
+}
+#endif
+
 } // namespace
 
 void* alloc_cpu(size_t nbytes) {
@@ -71,7 +124,16 @@ void* alloc_cpu(size_t nbytes) {
       nbytes,
       " bytes.");
 #else
-  int err = posix_memalign(&data, gAlignment, nbytes);
+  size_t alignment = gAlignment;
+#ifdef C10_HAVE_HUGEPAGE_ALLOC
+  const bool hugepages = use_hugepages(nbytes);
+  if (hugepages) {
+    alignment = gHugePageSize;
+    g_hugepage_eligible_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_hugepage_eligible_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+  }
+#endif
+  int err = posix_memalign(&data, alignment, nbytes);
   CAFFE_ENFORCE(
       err == 0,
       "DefaultCPUAllocator: can't allocate memory: you tried to allocate ",
@@ -81,6 +143,14 @@ void* alloc_cpu(size_t nbytes) {
       " (",
       strerror(err),
       ")");
+#ifdef C10_HAVE_HUGEPAGE_ALLOC
+  // Best effort: THP may be disabled system-wide ("never" in
+  // /sys/kernel/mm/transparent_hugepage/enabled), in which case the advice
+  // is rejected and the allocation simply stays on 4K pages.
+  if (hugepages && madvise(data, nbytes, MADV_HUGEPAGE) == 0) {
+    g_hugepage_advised_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+  }
+#endif
 #endif
 
   // move data to a thread's NUMA node
@@ -98,6 +168,29 @@ void* alloc_cpu(size_t nbytes) {
   return data;
 }
 
+void* alloc_cpu_on_node(size_t nbytes, int numa_node_id) {
+  void* data = alloc_cpu(nbytes);
+  // alloc_cpu placed the allocation on the calling thread's node; rebind it
+  // to the requested node (NUMAMove migrates any pages the fill policy
+  // already faulted in).
+  NUMAMove(data, nbytes, numa_node_id);
+  return data;
+}
+
+CPUHugePagesStats cpu_huge_pages_stats() {
+  CPUHugePagesStats stats;
+#ifdef C10_HAVE_HUGEPAGE_ALLOC
+  stats.eligible_allocations =
+      g_hugepage_eligible_allocations.load(std::memory_order_relaxed);
+  stats.eligible_bytes =
+      g_hugepage_eligible_bytes.load(std::memory_order_relaxed);
+  stats.advised_bytes =
+      g_hugepage_advised_bytes.load(std::memory_order_relaxed);
+  stats.anon_huge_pages_bytes = read_anon_huge_pages_bytes();
+#endif
+  return stats;
+}
+
 void free_cpu(void* data) {
 #ifdef _MSC_VER
   _aligned_free(data);
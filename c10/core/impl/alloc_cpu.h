@@ -9,4 +9,23 @@ namespace c10 {
 C10_API void* alloc_cpu(size_t nbytes);
 C10_API void free_cpu(void* data);
 
+// Like alloc_cpu, but binds the allocation to the given NUMA node instead of
+// the calling thread's node. No-op placement on non-NUMA builds/systems.
+C10_API void* alloc_cpu_on_node(size_t nbytes, int numa_node_id);
+
+// Counters for the transparent-hugepage allocation path (see
+// FLAGS_caffe2_cpu_allocator_hugepage_threshold). `anon_huge_pages_bytes`
+// is the process-wide AnonHugePages figure from /proc/self/smaps_rollup,
+// sampled when the stats are read; comparing it against `advised_bytes`
+// shows how much of the advised memory the kernel actually backed with
+// huge pages. All fields are zero on platforms without hugepage support.
+struct C10_API CPUHugePagesStats {
+  size_t eligible_allocations = 0; // allocations at or above the threshold
+  size_t eligible_bytes = 0; // cumulative bytes of those allocations
+  size_t advised_bytes = 0; // bytes successfully advised with MADV_HUGEPAGE
+  size_t anon_huge_pages_bytes = 0; // current AnonHugePages for the process
+};
+
+C10_API CPUHugePagesStats cpu_huge_pages_stats();
+
 } // namespace c10
@@ -1,4 +1,5 @@
 #include <c10/core/thread_pool.h>
+#include <c10/util/Exception.h>
 
 namespace c10 {
 
@@ -7,11 +8,13 @@ ThreadPool::ThreadPool(
     int numa_node_id,
     std::function<void()> init_thread)
     : threads_(pool_size < 0 ? defaultNumThreads() : pool_size),
+      local_tasks_(threads_.size()),
       running_(true),
       complete_(true),
       available_(threads_.size()),
       total_(threads_.size()),
-      numa_node_id_(numa_node_id) {
+      numa_node_id_(numa_node_id),
+      steal_count_(0) {
   for (std::size_t i = 0; i < threads_.size(); ++i) {
     threads_[i] = std::thread([this, i, init_thread]() {
       if (init_thread) {
@@ -48,23 +51,29 @@ size_t ThreadPool::numAvailable() const {
 }
 
 bool ThreadPool::inThreadPool() const {
-  for (auto& thread : threads_) {
-    if (thread.get_id() == std::this_thread::get_id()) {
-      return true;
-    }
-  }
-  return false;
+  return currentThreadIndex().has_value();
+}
+
+std::uint64_t ThreadPool::stealCount() const {
+  return steal_count_.load();
 }
 
 void ThreadPool::run(std::function<void()> func) {
   if (threads_.size() == 0) {
     throw std::runtime_error("No threads to run a task");
   }
+  const auto index = currentThreadIndex();
   std::unique_lock<std::mutex> lock(mutex_);
 
   // Set task and signal condition variable so that a worker thread will
-  // wake up and use the task.
-  tasks_.emplace(std::move(func));
+  // wake up and use the task.  Tasks submitted by a pool thread go to
+  // that thread's own queue so it runs its children first (or an idle
+  // thread steals them); everything else goes to the shared queue.
+  if (index.has_value()) {
+    local_tasks_[*index].emplace_back(std::move(func));
+  } else {
+    tasks_.emplace(std::move(func));
+  }
   complete_ = false;
   condition_.notify_one();
 }
@@ -76,12 +85,64 @@ void ThreadPool::waitWorkComplete() {
   }
 }
 
+c10::optional<std::size_t> ThreadPool::currentThreadIndex() const {
+  for (std::size_t i = 0; i < threads_.size(); ++i) {
+    if (threads_[i].get_id() == std::this_thread::get_id()) {
+      return i;
+    }
+  }
+  return c10::nullopt;
+}
+
+bool ThreadPool::workAvailable() const {
+  if (!tasks_.empty()) {
+    return true;
+  }
+  for (const auto& local : local_tasks_) {
+    if (!local.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+ThreadPool::task_element_t ThreadPool::acquireTask(std::size_t index) {
+  // Prefer this thread's own queue, newest first: the task submitted
+  // most recently is the one whose inputs are most likely still in this
+  // core's cache.
+  auto& local = local_tasks_[index];
+  if (!local.empty()) {
+    task_element_t task = std::move(local.back());
+    local.pop_back();
+    return task;
+  }
+  // Then the oldest externally submitted task.
+  if (!tasks_.empty()) {
+    task_element_t task = std::move(tasks_.front());
+    tasks_.pop();
+    return task;
+  }
+  // Otherwise steal from another thread's queue, oldest first: the
+  // oldest task is the one its owner would get to last, and tends to
+  // root the largest remaining subtree of work.
+  for (std::size_t i = 1; i < local_tasks_.size(); ++i) {
+    auto& victim = local_tasks_[(index + i) % local_tasks_.size()];
+    if (!victim.empty()) {
+      task_element_t task = std::move(victim.front());
+      victim.pop_front();
+      ++steal_count_;
+      return task;
+    }
+  }
+  TORCH_INTERNAL_ASSERT(false, "acquireTask called with no pending tasks");
+}
+
 void ThreadPool::main_loop(std::size_t index) {
   std::unique_lock<std::mutex> lock(mutex_);
   while (running_) {
-    // Wait on condition variable while the task is empty and
+    // Wait on condition variable while there is no pending task and
     // the pool is still running.
-    while (tasks_.empty() && running_) {
+    while (!workAvailable() && running_) {
       condition_.wait(lock);
     }
     // If pool is no longer running, break out of loop.
@@ -95,8 +156,7 @@ void ThreadPool::main_loop(std::size_t index) {
     // useful in the event that the function contains
     // shared_ptr arguments bound via bind.
     {
-      task_element_t tasks = std::move(tasks_.front());
-      tasks_.pop();
+      task_element_t tasks = acquireTask(index);
       // Decrement count, indicating thread is no longer available.
       --available_;
 
@@ -128,7 +188,7 @@ void ThreadPool::main_loop(std::size_t index) {
 
     // Increment count, indicating thread is available.
     ++available_;
-    if (tasks_.empty() && available_ == total_) {
+    if (!workAvailable() && available_ == total_) {
       complete_ = true;
       completed_.notify_one();
     }
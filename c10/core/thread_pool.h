@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <queue>
@@ -60,8 +63,14 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
         : run_with_id(true), no_id(nullptr), with_id(std::move(f)) {}
   };
 
+  // Tasks submitted from outside the pool, oldest first.
   std::queue<task_element_t> tasks_;
   std::vector<std::thread> threads_;
+  // One queue per pool thread. Tasks a pool thread submits while running a
+  // task (e.g. continuations of forked subgraphs) go to its own queue and are
+  // picked back up newest first, while their inputs are still cache-hot; idle
+  // threads steal from these queues when they have nothing else to do.
+  std::vector<std::deque<task_element_t>> local_tasks_;
   mutable std::mutex mutex_;
   std::condition_variable condition_;
   std::condition_variable completed_;
@@ -70,6 +79,7 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   std::size_t available_;
   std::size_t total_;
   int numa_node_id_;
+  std::atomic<std::uint64_t> steal_count_;
 
  public:
   ThreadPool() = delete;
@@ -103,9 +113,26 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   /// @brief Wait for queue to be empty
   void waitWorkComplete();
 
+  /**
+   * The number of tasks idle threads have stolen from other threads'
+   * queues since the pool was created.
+   */
+  std::uint64_t stealCount() const;
+
  private:
   // @brief Entry point for pool threads.
   void main_loop(std::size_t index);
+
+  // @brief The index of the calling thread in threads_, if it is a pool
+  // thread.
+  c10::optional<std::size_t> currentThreadIndex() const;
+
+  // @brief Whether any queue holds a pending task. Caller must hold mutex_.
+  bool workAvailable() const;
+
+  // @brief Pop the next task for the thread at the given index. Caller must
+  // hold mutex_ and have checked workAvailable().
+  task_element_t acquireTask(std::size_t index);
 };
 
 class C10_API TaskThreadPool : public c10::ThreadPool {
@@ -1,6 +1,9 @@
 
 #include <c10/cuda/CUDACachingAllocator.h>
 
+#include <c10/core/AllocationDomain.h>
+#include <c10/core/MemoryPressureBroker.h>
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/cuda/CUDAGuard.h>
@@ -11,6 +14,7 @@
 
 #include <cuda_runtime_api.h>
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <deque>
 #include <iterator>
@@ -180,6 +184,10 @@ struct Block {
   int event_count; // number of outstanding CUDA events
   int gc_count; // counter for prioritizing older / less useful blocks for
                 // garbage collection
+  uint64_t seq; // device-wide change counter value at this block's last state
+                // change (see snapshotDelta)
+  bool managed; // segment came from the managed-memory spill tier (see
+                // alloc_spill_block); never split or cached
 
   Block(
       int device,
@@ -197,7 +205,9 @@ struct Block {
         prev(nullptr),
         next(nullptr),
         event_count(0),
-        gc_count(0) {}
+        gc_count(0),
+        seq(0),
+        managed(false) {}
 
   // constructor for search key
   Block(int device, cudaStream_t stream, size_t size)
@@ -211,13 +221,31 @@ struct Block {
         prev(nullptr),
         next(nullptr),
         event_count(0),
-        gc_count(0) {}
+        gc_count(0),
+        seq(0),
+        managed(false) {}
 
   bool is_split() const {
     return (prev != nullptr) || (next != nullptr);
   }
 };
 
+// Base address and total extent of the cudaMalloc'd segment a block was
+// split from, for profiler attribution. Callers must hold the device
+// allocator mutex so the split links are stable; the walk is bounded by the
+// number of splits in one segment.
+static std::pair<void*, int64_t> segment_extent(const Block* block) {
+  while (block->prev) {
+    block = block->prev;
+  }
+  void* base = block->ptr;
+  int64_t total = 0;
+  for (; block != nullptr; block = block->next) {
+    total += static_cast<int64_t>(block->size);
+  }
+  return {base, total};
+}
+
 static bool BlockComparator(const Block* a, const Block* b) {
   if (a->stream != b->stream) {
     return (uintptr_t)a->stream < (uintptr_t)b->stream;
@@ -279,60 +307,6 @@ struct AllocParams {
   cudaError_t err;
 };
 
-// Note: cudaEventCreate when concurrently invoked from multiple threads can be
-// very expensive (at least on certain device/driver combinations). Thus, we a)
-// serialize event creation at a per-device level, and b) pool the events to
-// avoid constantly calling cudaEventCreate/cudaEventDestroy. This results in
-// significant improvements in multithreaded workloads with high allocation
-// rates.
-class EventPool {
- public:
-  using Event = std::unique_ptr<cudaEvent_t, std::function<void(cudaEvent_t*)>>;
-  // TODO: Explicit device count
-  EventPool() : pools_(at::cuda::device_count()) {}
-
-  Event get(int device) {
-    TORCH_INTERNAL_ASSERT(0 <= device);
-    TORCH_INTERNAL_ASSERT(device < static_cast<int>(pools_.size()));
-    auto& pool = pools_[device];
-    auto destructor = [&pool](cudaEvent_t* event) {
-      std::lock_guard<std::mutex> g(pool.mutex_);
-      pool.event_pool_.push_back(std::unique_ptr<cudaEvent_t>(event));
-    };
-
-    // Try to acquire an event from the per-device pool.
-    {
-      std::lock_guard<std::mutex> g(pool.mutex_);
-      if (!pool.event_pool_.empty()) {
-        auto* event = pool.event_pool_.back().release();
-        pool.event_pool_.pop_back();
-        return Event(event, destructor);
-      }
-    }
-    // otherwise, allocate a new event that will be returned to the pool on
-    // destruction.
-    auto new_ptr = std::make_unique<cudaEvent_t>();
-    C10_CUDA_CHECK(
-        cudaEventCreateWithFlags(new_ptr.get(), cudaEventDisableTiming));
-
-    return Event(new_ptr.release(), destructor);
-  }
-
-  void empty_cache() {
-    for (auto& pool : pools_) {
-      std::lock_guard<std::mutex> g(pool.mutex_);
-      pool.event_pool_.clear();
-    }
-  }
-
- private:
-  struct PerDevicePool {
-    alignas(64) std::mutex mutex_;
-    std::vector<std::unique_ptr<cudaEvent_t>> event_pool_;
-  };
-  std::vector<PerDevicePool> pools_;
-};
-
 // CUDA graphs helper
 struct PrivatePool {
   PrivatePool()
@@ -392,6 +366,9 @@ class CachingAllocatorConfig {
   static double garbage_collection_threshold() {
     return instance().m_garbage_collection_threshold;
   }
+  static bool spill_to_host() {
+    return instance().m_spill_to_host;
+  }
 
   // This is used to round-up allocation size to nearest power of 2 divisions.
   // More description below in function roundup_power2_next_division
@@ -414,10 +391,12 @@ class CachingAllocatorConfig {
   CachingAllocatorConfig()
       : m_max_split_size(std::numeric_limits<size_t>::max()),
         m_roundup_power2_divisions(0),
-        m_garbage_collection_threshold(0) {}
+        m_garbage_collection_threshold(0),
+        m_spill_to_host(false) {}
   size_t m_max_split_size;
   size_t m_roundup_power2_divisions;
   double m_garbage_collection_threshold;
+  bool m_spill_to_host;
 
   void parseArgs() {
     const char* val = getenv("PYTORCH_CUDA_ALLOC_CONF");
@@ -473,6 +452,20 @@ class CachingAllocatorConfig {
                 "garbage_collect_threshold too big, set it 0.0~1.0",
                 "");
             m_garbage_collection_threshold = val2;
+          } else if (kv[0].compare("spill_to_host") == 0) {
+            /*
+             * When device memory is exhausted, serve the allocation from
+             * CUDA managed memory advised to prefer the device instead of
+             * raising an OOM. Under continued pressure the driver migrates
+             * cold pages to host and pages them back in on the next device
+             * access, so overcommit degrades throughput instead of dying.
+             */
+            TORCH_CHECK(
+                kv[1].compare("True") == 0 || kv[1].compare("False") == 0,
+                "Expected spill_to_host value to be True or False, got ",
+                kv[1],
+                "");
+            m_spill_to_host = (kv[1].compare("True") == 0);
           } else {
             TORCH_CHECK(false, "Unrecognized CachingAllocator option: ", kv[0]);
           }
@@ -490,6 +483,28 @@ class DeviceCachingAllocator {
   // device statistics
   DeviceStats stats;
 
+  // Lock-free mirror of `stats` backing getStatsFast(). Writers (which hold
+  // `mutex`, so there is at most one at a time) publish via a seqlock: bump
+  // stats_mirror_seq to an odd value, copy, bump to the next even value.
+  // Readers retry until they observe the same even value on both sides of
+  // their copy, which detects (and discards) torn reads.
+  DeviceStats stats_mirror;
+  std::atomic<uint64_t> stats_mirror_seq{0};
+
+  // Monotonic change counter backing snapshotDelta(). Bumped (under `mutex`)
+  // whenever a block changes state; each block records the value of its last
+  // change in Block::seq.
+  uint64_t change_counter = 0;
+
+  // Base addresses of recently released segments, paired with the
+  // change-counter value at release, so deltas can report segments that
+  // disappeared. Bounded; see record_released_segment.
+  std::deque<std::pair<uint64_t, int64_t>> released_segments;
+
+  // Change-counter value of the newest entry pruned from released_segments.
+  // A cursor at or below this can no longer be served incrementally.
+  uint64_t released_history_pruned = 0;
+
   // unallocated cached blocks larger than 1 MB
   BlockPool large_blocks;
 
@@ -519,6 +534,18 @@ class DeviceCachingAllocator {
 
   bool set_fraction = false;
 
+  // Cross-process shared pool (see importIpcMemPool in the header). When
+  // bound, all segments are carved out of
+  // [shared_pool_base, shared_pool_base + shared_pool_size) instead of being
+  // cudaMalloc'd. shared_pool_owner keeps the IPC mapping open.
+  std::shared_ptr<void> shared_pool_owner;
+  char* shared_pool_base = nullptr;
+  size_t shared_pool_size = 0;
+  // Free ranges of the shared pool, keyed by start address. Adjacent ranges
+  // are coalesced on release, so a fully quiescent allocator collapses back
+  // to one range spanning the pool.
+  std::map<char*, size_t> shared_pool_free_ranges;
+
   // Members specific to CUDA graphs
 
   // Private pools for CUDA graphs
@@ -592,7 +619,11 @@ class DeviceCachingAllocator {
               alloc_block(params, false))
           // Free all non-split cached blocks and retry alloc.
           || (C10_LIKELY(captures_underway == 0) && release_cached_blocks() &&
-              alloc_block(params, true));
+              alloc_block(params, true))
+          // Last resort before raising an OOM: opt-in managed-memory spill
+          // tier (PYTORCH_CUDA_ALLOC_CONF=spill_to_host:True).
+          || (C10_UNLIKELY(CachingAllocatorConfig::spill_to_host()) &&
+              alloc_spill_block(params));
     }
 
     if (!block_found) {
@@ -610,6 +641,7 @@ class DeviceCachingAllocator {
       }
 
       stats.num_ooms += 1;
+      publish_stats();
 
       // "total capacity": total global memory on GPU
       // "allowed": memory is allowed to use, which set by fraction.
@@ -675,6 +707,7 @@ class DeviceCachingAllocator {
       remaining->prev = block;
       remaining->ptr = static_cast<char*>(remaining->ptr) + size;
       remaining->size -= size;
+      touch_block(remaining);
       bool inserted = pool.blocks.insert(remaining).second;
       TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inserted);
 
@@ -699,6 +732,7 @@ class DeviceCachingAllocator {
     }
 
     block->allocated = true;
+    touch_block(block);
     bool inserted = active_blocks.insert(block).second;
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(inserted);
 
@@ -711,13 +745,26 @@ class DeviceCachingAllocator {
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, 1);
 
-    c10::reportMemoryUsageToProfiler(
+    c10::AllocationDomainTracker::singleton().recordAlloc(
         block->ptr,
         block->size,
-        stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)].current,
-        stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)].current,
         c10::Device(c10::DeviceType::CUDA, device));
 
+    if (C10_UNLIKELY(c10::memoryProfilingEnabled())) {
+      const auto segment = segment_extent(block);
+      c10::reportMemoryUsageToProfiler(
+          block->ptr,
+          block->size,
+          stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)]
+              .current,
+          stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)]
+              .current,
+          c10::Device(c10::DeviceType::CUDA, device),
+          segment.first,
+          segment.second);
+    }
+
+    publish_stats();
     return block;
   }
 
@@ -725,11 +772,19 @@ class DeviceCachingAllocator {
     std::lock_guard<std::recursive_mutex> lock(mutex);
 
     block->allocated = false;
+    touch_block(block);
+
+    c10::AllocationDomainTracker::singleton().recordFree(block->ptr);
 
     // following logic might modifying underlaying Block, causing the size
     // changed. We store ahead for reporting
     auto orig_block_ptr = block->ptr;
     auto orig_block_size = block->size;
+    // likewise: coalescing below rewrites the split links, but the segment
+    // the block belongs to keeps its base and extent
+    const bool report_to_profiler = c10::memoryProfilingEnabled();
+    const auto segment =
+        report_to_profiler ? segment_extent(block) : std::pair<void*, int64_t>();
 
     StatTypes stat_types = {false};
     stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
@@ -756,12 +811,20 @@ class DeviceCachingAllocator {
       free_block(block);
     }
 
-    c10::reportMemoryUsageToProfiler(
-        orig_block_ptr,
-        -orig_block_size,
-        stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)].current,
-        stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)].current,
-        c10::Device(c10::DeviceType::CUDA, block->device));
+    if (C10_UNLIKELY(report_to_profiler)) {
+      c10::reportMemoryUsageToProfiler(
+          orig_block_ptr,
+          -orig_block_size,
+          stats.allocated_bytes[static_cast<size_t>(StatType::AGGREGATE)]
+              .current,
+          stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)]
+              .current,
+          c10::Device(c10::DeviceType::CUDA, block->device),
+          segment.first,
+          segment.second);
+    }
+
+    publish_stats();
   }
 
   void* getBaseAllocation(Block* block, size_t* outSize) {
@@ -800,10 +863,29 @@ class DeviceCachingAllocator {
     set_fraction = true;
   }
 
+  /** binds all future segments to a shared cross-process pool **/
+  void setSharedPool(std::shared_ptr<void> owner, void* base, size_t size) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    TORCH_CHECK(
+        shared_pool_base == nullptr,
+        "a shared memory pool is already bound to this device");
+    // Segments that were already cudaMalloc'd cannot be handed back to the
+    // pool, so the bound must be installed before the first allocation.
+    TORCH_CHECK(
+        total_allocated_memory == 0,
+        "importIpcMemPool must be called before the first CUDA allocation ",
+        "on the device");
+    shared_pool_owner = std::move(owner);
+    shared_pool_base = static_cast<char*>(base);
+    shared_pool_size = size;
+    shared_pool_free_ranges.emplace(shared_pool_base, size);
+  }
+
   /** returns cached blocks to the system allocator **/
   void emptyCache() {
     std::lock_guard<std::recursive_mutex> lock(mutex);
     release_cached_blocks();
+    publish_stats();
   }
 
   /** Retrieves info (total size + largest block) of the memory cache **/
@@ -830,6 +912,26 @@ class DeviceCachingAllocator {
     return stats;
   }
 
+  /** Returns a copy of the stats from the lock-free mirror, without taking
+   * the allocator mutex; see getDeviceStatsFast in the header. **/
+  DeviceStats getStatsFast() const {
+    while (true) {
+      const uint64_t seq = stats_mirror_seq.load(std::memory_order_acquire);
+      if (seq % 2 == 0) {
+        DeviceStats result = stats_mirror;
+        // The fence keeps the copy above from being reordered past the
+        // re-check of the sequence number.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (stats_mirror_seq.load(std::memory_order_relaxed) == seq) {
+          return result;
+        }
+      }
+      // A publish was in flight or completed underneath us. Publishing is a
+      // fixed-size copy done at most once per allocator operation, so simply
+      // retrying is cheap.
+    }
+  }
+
   /** Resets the historical accumulation stats for the device **/
   void resetAccumulatedStats() {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -850,6 +952,9 @@ class DeviceCachingAllocator {
     stats.num_ooms = 0;
     reset_accumulated_stat(stats.oversize_allocations);
     reset_accumulated_stat(stats.oversize_segments);
+    reset_accumulated_stat(stats.spill_allocations);
+    reset_accumulated_stat(stats.spill_bytes);
+    publish_stats();
   }
 
   /** Resets the historical peak stats for the device **/
@@ -869,6 +974,9 @@ class DeviceCachingAllocator {
     }
     reset_peak_stat(stats.oversize_allocations);
     reset_peak_stat(stats.oversize_segments);
+    reset_peak_stat(stats.spill_allocations);
+    reset_peak_stat(stats.spill_bytes);
+    publish_stats();
   }
 
   /** Dump a complete snapshot of the memory held by the allocator. Potentially
@@ -884,31 +992,7 @@ class DeviceCachingAllocator {
         continue;
       }
       result.emplace_back();
-      SegmentInfo& segment_info = result.back();
-      segment_info.device = head_block->device;
-      segment_info.address = reinterpret_cast<int64_t>(head_block->ptr);
-      segment_info.is_large = (!head_block->pool->is_small);
-
-      const Block* block = head_block;
-      while (block != nullptr) {
-        segment_info.blocks.emplace_back();
-        BlockInfo& block_info = segment_info.blocks.back();
-
-        block_info.size = block->size;
-        block_info.allocated = block->allocated;
-        block_info.active = block->allocated || (block->event_count > 0) ||
-            !block->stream_uses.empty();
-
-        segment_info.total_size += block_info.size;
-        if (block_info.allocated) {
-          segment_info.allocated_size += block_info.size;
-        }
-        if (block_info.active) {
-          segment_info.active_size += block_info.size;
-        }
-
-        block = block->next;
-      }
+      fill_segment_info(head_block, result.back());
     }
 
     std::sort(
@@ -921,6 +1005,62 @@ class DeviceCachingAllocator {
     return result;
   }
 
+  /** Incremental snapshot: segments with at least one block changed since
+   * `cursor`, plus the addresses of segments released since then. Still takes
+   * the mutex, but per-block info is only materialized for changed segments,
+   * so a steady-state poll is a cheap scan rather than a full copy. **/
+  SnapshotDelta snapshotDelta(uint64_t cursor) const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    SnapshotDelta delta;
+    delta.cursor = change_counter;
+
+    if (cursor > 0 && cursor <= released_history_pruned) {
+      // The caller's cursor predates the retained release history, so we
+      // can't tell it which segments disappeared. Hand back a full snapshot
+      // and let it resync.
+      delta.is_full = true;
+      cursor = 0;
+    }
+
+    const auto all_blocks = get_all_blocks();
+    for (const Block* const head_block : all_blocks) {
+      if (head_block->prev != nullptr) {
+        continue;
+      }
+      bool changed = false;
+      for (const Block* block = head_block; block != nullptr;
+           block = block->next) {
+        if (block->seq > cursor) {
+          changed = true;
+          break;
+        }
+      }
+      if (!changed) {
+        continue;
+      }
+      delta.segments.emplace_back();
+      fill_segment_info(head_block, delta.segments.back());
+    }
+
+    if (!delta.is_full) {
+      for (const auto& released : released_segments) {
+        if (released.first > cursor) {
+          delta.released.push_back(released.second);
+        }
+      }
+    }
+
+    std::sort(
+        delta.segments.begin(),
+        delta.segments.end(),
+        [](const SegmentInfo& a, const SegmentInfo& b) {
+          return a.address < b.address;
+        });
+
+    return delta;
+  }
+
   // This function takes the size and number of divisions argument and rounds
   // up the size argument for the nearest power-of-2 division.
   // For example, if we need to round-up 1200 and number of divisions is 4,
@@ -1043,6 +1183,70 @@ class DeviceCachingAllocator {
     return blocks;
   }
 
+  /** stamps a block as changed, for snapshotDelta **/
+  void touch_block(Block* block) {
+    block->seq = ++change_counter;
+  }
+
+  /** remembers that a segment was returned to the system, for snapshotDelta
+   **/
+  void record_released_segment(Block* block) {
+    released_segments.emplace_back(
+        ++change_counter, reinterpret_cast<int64_t>(block->ptr));
+    // Keep the history bounded; a delta whose cursor predates what we pruned
+    // falls back to a full snapshot.
+    constexpr size_t kMaxReleasedHistory = 4096;
+    while (released_segments.size() > kMaxReleasedHistory) {
+      released_history_pruned = released_segments.front().first;
+      released_segments.pop_front();
+    }
+  }
+
+  /** publishes `stats` into the lock-free mirror read by getStatsFast().
+   * Called (with the mutex held) at the end of every public method that may
+   * have modified stats. **/
+  void publish_stats() {
+    const uint64_t seq =
+        stats_mirror_seq.load(std::memory_order_relaxed);
+    // Odd value tells concurrent readers a publish is in flight.
+    stats_mirror_seq.store(seq + 1, std::memory_order_release);
+    // The copy itself intentionally races with readers' copies; readers
+    // detect this through the sequence number and retry.
+    stats_mirror = stats;
+    stats_mirror_seq.store(seq + 2, std::memory_order_release);
+  }
+
+  /** copies the info of one segment (the chain starting at head_block) into
+   * segment_info; shared by snapshot() and snapshotDelta() **/
+  static void fill_segment_info(
+      const Block* head_block,
+      SegmentInfo& segment_info) {
+    segment_info.device = head_block->device;
+    segment_info.address = reinterpret_cast<int64_t>(head_block->ptr);
+    segment_info.is_large = (!head_block->pool->is_small);
+
+    const Block* block = head_block;
+    while (block != nullptr) {
+      segment_info.blocks.emplace_back();
+      BlockInfo& block_info = segment_info.blocks.back();
+
+      block_info.size = block->size;
+      block_info.allocated = block->allocated;
+      block_info.active = block->allocated || (block->event_count > 0) ||
+          !block->stream_uses.empty();
+
+      segment_info.total_size += block_info.size;
+      if (block_info.allocated) {
+        segment_info.allocated_size += block_info.size;
+      }
+      if (block_info.active) {
+        segment_info.active_size += block_info.size;
+      }
+
+      block = block->next;
+    }
+  }
+
   /** moves a block into a pool of cached free blocks */
   void free_block(Block* block) {
     TORCH_INTERNAL_ASSERT(
@@ -1088,6 +1292,16 @@ class DeviceCachingAllocator {
       update_stat(stats.active[stat_type], -1);
       update_stat(stats.active_bytes[stat_type], -original_block_size);
     });
+
+    touch_block(block);
+
+    // The spill tier is a degradation path, not a cache: hand the segment
+    // back to the driver as soon as its allocation dies so later traffic is
+    // served from ordinary device memory again.
+    if (C10_UNLIKELY(block->managed)) {
+      TORCH_INTERNAL_ASSERT(!block->is_split());
+      release_block(block);
+    }
   }
 
   /** combine previously split blocks. returns the size of the subsumed block,
@@ -1161,6 +1375,11 @@ class DeviceCachingAllocator {
   }
 
   bool should_split(const Block* block, size_t size) {
+    // Spill segments are sized to one allocation and returned to the driver
+    // when it dies; splitting them would keep paged memory alive longer.
+    if (C10_UNLIKELY(block->managed)) {
+      return false;
+    }
     size_t remaining = block->size - size;
     if (block->pool->is_small) {
       return remaining >= kMinBlockSize;
@@ -1214,6 +1433,10 @@ class DeviceCachingAllocator {
       freed_memory |=
           FreeCudaMemoryCallbacksRegistry()->Create(name)->Execute();
     }
+    // Also ask the process-wide broker to shed cache capacity in coordinated
+    // priority order; any bytes its caches hand back make a retry worthwhile.
+    freed_memory |=
+        MemoryPressureBroker::singleton().evict(p.alloc_size) > 0;
     return freed_memory;
   }
 
@@ -1273,6 +1496,46 @@ class DeviceCachingAllocator {
     }
   }
 
+  // First fit over the shared pool's free ranges. Segment-granularity
+  // requests are few and large, so a linear scan is cheap.
+  void* shared_pool_allocate(size_t size) {
+    for (auto it = shared_pool_free_ranges.begin();
+         it != shared_pool_free_ranges.end();
+         ++it) {
+      if (it->second >= size) {
+        char* ptr = it->first;
+        const size_t remaining = it->second - size;
+        shared_pool_free_ranges.erase(it);
+        if (remaining > 0) {
+          shared_pool_free_ranges.emplace(ptr + size, remaining);
+        }
+        return ptr;
+      }
+    }
+    return nullptr;
+  }
+
+  bool owned_by_shared_pool(const Block* block) const {
+    return shared_pool_base != nullptr && block->ptr >= shared_pool_base &&
+        block->ptr < shared_pool_base + shared_pool_size;
+  }
+
+  void shared_pool_release(char* ptr, size_t size) {
+    auto next = shared_pool_free_ranges.lower_bound(ptr);
+    if (next != shared_pool_free_ranges.end() && ptr + size == next->first) {
+      size += next->second;
+      next = shared_pool_free_ranges.erase(next);
+    }
+    if (next != shared_pool_free_ranges.begin()) {
+      auto prev = std::prev(next);
+      if (prev->first + prev->second == ptr) {
+        prev->second += size;
+        return;
+      }
+    }
+    shared_pool_free_ranges.emplace(ptr, size);
+  }
+
   bool alloc_block(AllocParams& p, bool isRetry) {
     // Defensively checks for preexisting CUDA error state.
     C10_CUDA_CHECK(cudaGetLastError());
@@ -1288,6 +1551,15 @@ class DeviceCachingAllocator {
         total_allocated_memory + size > allowed_memory_maximum) {
       p.err = cudaErrorMemoryAllocation;
       return false;
+    } else if (shared_pool_base != nullptr) {
+      // All segments come from the imported cross-process pool; exhausting
+      // the pool takes the same retry-then-OOM path as a failed cudaMalloc.
+      ptr = shared_pool_allocate(size);
+      if (ptr == nullptr) {
+        p.err = cudaErrorMemoryAllocation;
+        return false;
+      }
+      p.err = cudaSuccess;
     } else {
       p.err = cudaMallocMaybeCapturing(&ptr, size);
       if (p.err != cudaSuccess) {
@@ -1318,6 +1590,7 @@ class DeviceCachingAllocator {
 
     total_allocated_memory += size;
     p.block = new Block(p.device(), p.stream(), size, p.pool, (char*)ptr);
+    touch_block(p.block);
     for_each_selected_stat_type(p.stat_types, [&](size_t stat_type) {
       update_stat(stats.segment[stat_type], 1);
       update_stat(stats.reserved_bytes[stat_type], size);
@@ -1330,6 +1603,54 @@ class DeviceCachingAllocator {
     return true;
   }
 
+  /** Serves an allocation from the managed-memory spill tier after device
+   *  memory is exhausted. The segment is advised to prefer the device; under
+   *  continued pressure the driver migrates its cold pages to host and pages
+   *  them back in on the next device access, so an overcommitted burst runs
+   *  slower instead of raising an OOM. Spill segments are never split or
+   *  cached — they are returned to the driver as soon as the allocation
+   *  dies (see free_block) so steady-state traffic goes back to ordinary
+   *  device-resident segments. */
+  bool alloc_spill_block(AllocParams& p) {
+    if (captures_underway != 0) {
+      // cudaMallocManaged is illegal during CUDA graph capture.
+      return false;
+    }
+    if (shared_pool_base != nullptr) {
+      // Imported cross-process pools have a fixed extent; there is no
+      // driver-backed tier to spill into.
+      return false;
+    }
+    size_t size = p.alloc_size;
+    void* ptr = nullptr;
+    cudaError_t err = cudaMallocManaged(&ptr, size);
+    if (err != cudaSuccess) {
+      // Managed allocation exhausts host memory too; fall through to the
+      // regular OOM report.
+      cudaGetLastError();
+      return false;
+    }
+    // Keep pages device-resident while there is room; the advice makes the
+    // driver treat host placement as eviction rather than home.
+    C10_CUDA_CHECK(cudaMemAdvise(
+        ptr, size, cudaMemAdviseSetPreferredLocation, p.device()));
+
+    p.err = cudaSuccess;
+    total_allocated_memory += size;
+    p.block = new Block(p.device(), p.stream(), size, p.pool, (char*)ptr);
+    p.block->managed = true;
+    touch_block(p.block);
+    for_each_selected_stat_type(p.stat_types, [&](size_t stat_type) {
+      update_stat(stats.segment[stat_type], 1);
+      update_stat(stats.reserved_bytes[stat_type], size);
+    });
+    if (size >= CachingAllocatorConfig::max_split_size())
+      update_stat(stats.oversize_segments, 1);
+    update_stat(stats.spill_allocations, 1);
+    update_stat(stats.spill_bytes, size);
+    return true;
+  }
+
   /** Free one or more oversize blocks to the system allocator.  But only enough
    * **/
   /** to satisfy the target size **/
@@ -1400,7 +1721,11 @@ class DeviceCachingAllocator {
   }
 
   void release_block(Block* block) {
-    C10_CUDA_CHECK(cudaFree((void*)block->ptr));
+    if (owned_by_shared_pool(block)) {
+      shared_pool_release(static_cast<char*>(block->ptr), block->size);
+    } else {
+      C10_CUDA_CHECK(cudaFree((void*)block->ptr));
+    }
     total_allocated_memory -= block->size;
 
     auto* pool = block->pool;
@@ -1419,7 +1744,12 @@ class DeviceCachingAllocator {
     });
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_segments, -1);
+    if (C10_UNLIKELY(block->managed)) {
+      update_stat(stats.spill_allocations, -1);
+      update_stat(stats.spill_bytes, -block->size);
+    }
 
+    record_released_segment(block);
     pool->blocks.erase(block);
     delete block;
   }
@@ -1437,9 +1767,7 @@ class DeviceCachingAllocator {
   }
 
   EventPool::Event create_event_internal(int idx) {
-    // Leak the event pool to avoid shutdown issues.
-    static auto* event_pool = new EventPool();
-    return event_pool->get(idx);
+    return getEventPool()->get(idx);
   }
 
   void synchronize_and_free_events() {
@@ -1639,6 +1967,19 @@ class THCCachingAllocator {
     device_allocator[device]->setMemoryFraction(fraction);
   }
 
+  void setSharedMemPool(
+      int device,
+      std::shared_ptr<void> owner,
+      void* base,
+      size_t size) {
+    TORCH_INTERNAL_ASSERT(
+        0 <= device && static_cast<size_t>(device) < device_allocator.size(),
+        "Allocator not initialized for device ",
+        device,
+        ": did you call init?");
+    device_allocator[device]->setSharedPool(std::move(owner), base, size);
+  }
+
   void emptyCache() {
     for (auto& da : device_allocator)
       da->emptyCache();
@@ -1699,6 +2040,95 @@ static void uncached_delete(void* ptr) {
   C10_CUDA_CHECK(cudaFree(ptr));
 }
 
+// Request-scoped arenas (see CUDACachingAllocator.h).
+//
+// An arena owns one block obtained from the caching allocator and serves
+// allocations from a bump pointer inside it. The backing block is released
+// as a whole once the arena has been closed and its last outstanding
+// allocation has died, so interleaving large and small requests cannot
+// fragment the block pools.
+namespace {
+
+struct Arena {
+  Arena(int device, void* base, size_t capacity)
+      : device(device), base(base), capacity(capacity) {}
+
+  int device;
+  void* base;
+  size_t capacity;
+  size_t offset = 0;
+  // Outstanding allocations plus one for the open arena itself; the backing
+  // block is freed when this drops to zero (arena deleters may run on any
+  // thread, hence the atomic).
+  std::atomic<int64_t> refcount{1};
+};
+
+void arena_release(Arena* arena) {
+  if (arena->refcount.fetch_sub(1) == 1) {
+    caching_allocator.free(arena->base);
+    delete arena;
+  }
+}
+
+// Arena allocations are identified by pointer on free, matching how
+// THCCachingAllocator tracks its own outstanding blocks.
+std::mutex arena_mutex;
+ska::flat_hash_map<void*, Arena*> arena_allocations;
+
+// Innermost open arena of the calling thread; arenas nest LIFO.
+thread_local std::vector<Arena*> arena_stack;
+
+void* arena_try_allocate(size_t size, int device) {
+  if (arena_stack.empty()) {
+    return nullptr;
+  }
+  Arena* arena = arena_stack.back();
+  const size_t rounded = (size + kMinBlockSize - 1) & ~(kMinBlockSize - 1);
+  if (arena->device != device || rounded > arena->capacity - arena->offset) {
+    return nullptr;
+  }
+  void* r = static_cast<uint8_t*>(arena->base) + arena->offset;
+  arena->offset += rounded;
+  arena->refcount.fetch_add(1);
+  {
+    std::lock_guard<std::mutex> lock(arena_mutex);
+    arena_allocations[r] = arena;
+  }
+  return r;
+}
+
+void arena_delete(void* ptr) {
+  Arena* arena = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(arena_mutex);
+    auto it = arena_allocations.find(ptr);
+    TORCH_INTERNAL_ASSERT(
+        it != arena_allocations.end(), "invalid arena pointer: ", ptr);
+    arena = it->second;
+    arena_allocations.erase(it);
+  }
+  arena_release(arena);
+}
+
+} // namespace
+
+void beginArena(size_t capacity) {
+  TORCH_CHECK(capacity > 0, "beginArena: capacity must be positive");
+  int device;
+  C10_CUDA_CHECK(cudaGetDevice(&device));
+  void* base = nullptr;
+  caching_allocator.malloc(
+      &base, device, capacity, cuda::getCurrentCUDAStream(device));
+  arena_stack.push_back(new Arena(device, base, capacity));
+}
+
+void endArena() {
+  TORCH_CHECK(!arena_stack.empty(), "endArena called without beginArena");
+  Arena* arena = arena_stack.back();
+  arena_stack.pop_back();
+  arena_release(arena);
+}
+
 // NB: I decided not to fold this into THCCachingAllocator, because the latter
 // has a lot more methods and it wasn't altogether clear that they should
 // actually be publicly exposed
@@ -1719,6 +2149,9 @@ struct CudaCachingAllocator : public Allocator {
       return {r, r, &uncached_delete, Device(DeviceType::CUDA, device)};
     }
     if (size != 0) {
+      if (void* a = arena_try_allocate(size, device)) {
+        return {a, a, &arena_delete, Device(DeviceType::CUDA, device)};
+      }
       caching_allocator.malloc(
           &r, device, size, cuda::getCurrentCUDAStream(device));
     }
@@ -1782,6 +2215,11 @@ DeviceStats getDeviceStats(int device) {
   return caching_allocator.device_allocator[device]->getStats();
 }
 
+DeviceStats getDeviceStatsFast(int device) {
+  assertValidDevice(device);
+  return caching_allocator.device_allocator[device]->getStatsFast();
+}
+
 void resetAccumulatedStats(int device) {
   assertValidDevice(device);
   caching_allocator.device_allocator[device]->resetAccumulatedStats();
@@ -1796,6 +2234,11 @@ std::vector<SegmentInfo> snapshot() {
   return caching_allocator.snapshot();
 }
 
+SnapshotDelta snapshotDelta(int device, uint64_t cursor) {
+  assertValidDevice(device);
+  return caching_allocator.device_allocator[device]->snapshotDelta(cursor);
+}
+
 // CUDAGraph interactions
 void notifyCaptureBegin(
     int device,
@@ -1871,6 +2314,43 @@ std::shared_ptr<void> getIpcDevPtr(std::string handle) {
   return sp;
 }
 
+std::string exportIpcMemPool(int device, size_t size) {
+  assertValidDevice(device);
+  TORCH_CHECK(size > 0, "exportIpcMemPool: size must be positive");
+  cuda::CUDAGuard device_guard(device);
+  void* base = nullptr;
+  C10_CUDA_CHECK(cudaMalloc(&base, size));
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  cudaIpcMemHandle_t handle;
+  C10_CUDA_CHECK(cudaIpcGetMemHandle(&handle, base));
+  // The slab is deliberately never freed: the workers' imported mappings stay
+  // valid for the life of the coordinator process.
+  return std::string(
+      reinterpret_cast<const char*>(&handle), CUDA_IPC_HANDLE_SIZE);
+}
+
+void importIpcMemPool(
+    int device,
+    const std::string& handle,
+    size_t offset,
+    size_t size) {
+  assertValidDevice(device);
+  TORCH_CHECK(
+      handle.size() == CUDA_IPC_HANDLE_SIZE,
+      "importIpcMemPool: expected a ",
+      CUDA_IPC_HANDLE_SIZE,
+      "-byte IPC handle, got ",
+      handle.size(),
+      " bytes");
+  TORCH_CHECK(size > 0, "importIpcMemPool: size must be positive");
+  cuda::CUDAGuard device_guard(device);
+  // getIpcDevPtr caches the mapping; the shared_ptr handed to the device
+  // allocator keeps it open until the allocator itself goes away.
+  std::shared_ptr<void> base = getIpcDevPtr(handle);
+  caching_allocator.setSharedMemPool(
+      device, base, static_cast<char*>(base.get()) + offset, size);
+}
+
 void* raw_alloc(size_t nbytes) {
   if (nbytes == 0) {
     return nullptr;
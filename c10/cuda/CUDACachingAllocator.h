@@ -94,6 +94,13 @@ struct DeviceStats {
   // COUNT: total number of oversize blocks requiring malloc
   Stat oversize_segments;
 
+  // COUNT: allocations served from the managed-memory spill tier after
+  // device memory was exhausted (see the spill_to_host allocator option)
+  Stat spill_allocations;
+
+  // SUM: bytes held in managed-memory spill segments
+  Stat spill_bytes;
+
   // SIZE: maximum block size that is allowed to be split.
   int64_t max_split_size = 0;
 };
@@ -118,6 +125,23 @@ struct SegmentInfo {
   std::vector<BlockInfo> blocks;
 };
 
+// Result of snapshotDelta(): the segments of one device that changed since a
+// caller-supplied cursor. Apply `released` (segments that were cudaFree'd)
+// first, then upsert `segments` keyed by address; a reused address can appear
+// in both.
+struct SnapshotDelta {
+  // Pass this back to the next snapshotDelta() call to continue from here.
+  uint64_t cursor = 0;
+  // True if the supplied cursor predates the retained release history; in
+  // that case `segments` is a complete snapshot of the device and `released`
+  // is empty, so the caller should rebuild its view from scratch.
+  bool is_full = false;
+  // Segments containing at least one block that changed since the cursor.
+  std::vector<SegmentInfo> segments;
+  // Base addresses of segments released since the cursor.
+  std::vector<int64_t> released;
+};
+
 C10_CUDA_API void* raw_alloc(size_t nbytes);
 C10_CUDA_API void* raw_alloc_with_stream(size_t nbytes, cudaStream_t stream);
 C10_CUDA_API void raw_delete(void* ptr);
@@ -133,9 +157,22 @@ C10_CUDA_API void cacheInfo(
 C10_CUDA_API void* getBaseAllocation(void* ptr, size_t* size);
 C10_CUDA_API void recordStream(const DataPtr&, CUDAStream stream);
 C10_CUDA_API DeviceStats getDeviceStats(int device);
+// Like getDeviceStats, but reads a lock-free mirror of the stats instead of
+// taking the allocator mutex, so polling it never stalls allocation. The
+// mirror is published at the end of each allocator operation and may trail
+// the true stats by the operations currently in flight.
+C10_CUDA_API DeviceStats getDeviceStatsFast(int device);
 C10_CUDA_API void resetAccumulatedStats(int device);
 C10_CUDA_API void resetPeakStats(int device);
 C10_CUDA_API std::vector<SegmentInfo> snapshot();
+// Incremental variant of snapshot() for periodic pollers (e.g. a memory
+// dashboard): returns only the segments of `device` that changed since
+// `cursor`. Pass cursor == 0 on the first call to get everything, then pass
+// back the returned cursor. Unlike snapshot(), this only materializes (and
+// allocates) per-block info for segments that actually changed, so a
+// steady-state poll holds the allocator mutex for a cheap scan instead of a
+// full copy of every block.
+C10_CUDA_API SnapshotDelta snapshotDelta(int device, uint64_t cursor);
 
 // CUDAGraph interactions
 C10_CUDA_API void notifyCaptureBegin(
@@ -148,6 +185,57 @@ C10_CUDA_API void notifyCaptureDestroy(int device, MempoolId_t mempool_id);
 C10_CUDA_API std::mutex* getFreeMutex();
 
 C10_CUDA_API std::shared_ptr<void> getIpcDevPtr(std::string handle);
+
+// Cross-process shared memory pool
+//
+// For multi-process serving on one GPU, a coordinator process reserves a
+// single slab with exportIpcMemPool and hands the returned handle (an opaque
+// cudaIpcMemHandle_t payload) plus a disjoint [offset, offset + size) byte
+// range to each worker. A worker calls importIpcMemPool before its first CUDA
+// allocation on that device; from then on the device's caching allocator
+// carves all of its segments out of the imported range instead of calling
+// cudaMalloc, so total GPU memory across N workers is bounded by the slab
+// instead of N independent caches. Exhausting the range surfaces as the usual
+// CUDA out-of-memory error. The coordinator must keep running: the slab lives
+// for its process lifetime, and freeing it would invalidate the workers'
+// mappings. Callers are responsible for keeping worker ranges within the slab
+// and disjoint; the ranges are not visible to each other across processes.
+C10_CUDA_API std::string exportIpcMemPool(int device, size_t size);
+C10_CUDA_API void importIpcMemPool(
+    int device,
+    const std::string& handle,
+    size_t offset,
+    size_t size);
+
+// Request-scoped arena allocation
+//
+// beginArena carves one contiguous region of `capacity` bytes out of the
+// caching allocator and makes it the calling thread's active arena: until the
+// matching endArena, allocations on that thread (on the same device) that fit
+// are served from a bump pointer inside the region. The region is handed back
+// to the caching allocator as a single block at endArena (or, if some arena
+// tensors outlive the request, when the last of them dies), so steady-state
+// serving of heterogeneous request sizes causes no best-fit fragmentation and
+// never triggers cudaFree on the hot path.
+//
+// Arenas nest per thread (LIFO). Allocations that do not fit in the remaining
+// arena capacity fall through to the regular caching path; arena blocks are
+// only safe to use on the stream that was current at beginArena, as with any
+// other allocation. Prefer the RAII CUDAArenaGuard below over calling
+// beginArena/endArena directly.
+C10_CUDA_API void beginArena(size_t capacity);
+C10_CUDA_API void endArena();
+
+struct C10_CUDA_API CUDAArenaGuard {
+  explicit CUDAArenaGuard(size_t capacity) {
+    beginArena(capacity);
+  }
+  CUDAArenaGuard(const CUDAArenaGuard&) = delete;
+  CUDAArenaGuard& operator=(const CUDAArenaGuard&) = delete;
+  ~CUDAArenaGuard() {
+    endArena();
+  }
+};
 } // namespace CUDACachingAllocator
 
 } // namespace cuda
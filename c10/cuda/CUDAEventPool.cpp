@@ -0,0 +1,54 @@
+#include <c10/cuda/CUDAEventPool.h>
+
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/util/Exception.h>
+
+namespace c10 {
+namespace cuda {
+
+// TODO: Explicit device count
+EventPool::EventPool() : pools_(device_count()) {}
+
+EventPool::Event EventPool::get(int device) {
+  TORCH_INTERNAL_ASSERT(0 <= device);
+  TORCH_INTERNAL_ASSERT(device < static_cast<int>(pools_.size()));
+  auto& pool = pools_[device];
+  auto destructor = [&pool](cudaEvent_t* event) {
+    std::lock_guard<std::mutex> g(pool.mutex_);
+    pool.event_pool_.push_back(std::unique_ptr<cudaEvent_t>(event));
+  };
+
+  // Try to acquire an event from the per-device pool.
+  {
+    std::lock_guard<std::mutex> g(pool.mutex_);
+    if (!pool.event_pool_.empty()) {
+      auto* event = pool.event_pool_.back().release();
+      pool.event_pool_.pop_back();
+      return Event(event, destructor);
+    }
+  }
+  // otherwise, allocate a new event that will be returned to the pool on
+  // destruction.
+  auto new_ptr = std::make_unique<cudaEvent_t>();
+  C10_CUDA_CHECK(
+      cudaEventCreateWithFlags(new_ptr.get(), cudaEventDisableTiming));
+
+  return Event(new_ptr.release(), destructor);
+}
+
+void EventPool::empty_cache() {
+  for (auto& pool : pools_) {
+    std::lock_guard<std::mutex> g(pool.mutex_);
+    pool.event_pool_.clear();
+  }
+}
+
+EventPool* getEventPool() {
+  // Leak the event pool to avoid shutdown issues.
+  static auto* event_pool = new EventPool();
+  return event_pool;
+}
+
+} // namespace cuda
+} // namespace c10
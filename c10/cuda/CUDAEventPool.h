@@ -0,0 +1,49 @@
+#pragma once
+
+#include <c10/cuda/CUDAMacros.h>
+
+#include <cuda_runtime_api.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace c10 {
+namespace cuda {
+
+// Note: cudaEventCreate when concurrently invoked from multiple threads can be
+// very expensive (at least on certain device/driver combinations). Thus, we a)
+// serialize event creation at a per-device level, and b) pool the events to
+// avoid constantly calling cudaEventCreate/cudaEventDestroy. This results in
+// significant improvements in multithreaded workloads with high allocation
+// rates.
+//
+// Leased events are created with cudaEventDisableTiming and handed out as a
+// self-returning RAII handle: letting the handle die puts the event back on
+// its device's freelist instead of destroying it.
+class C10_CUDA_API EventPool {
+ public:
+  using Event = std::unique_ptr<cudaEvent_t, std::function<void(cudaEvent_t*)>>;
+
+  EventPool();
+
+  Event get(int device);
+
+  void empty_cache();
+
+ private:
+  struct PerDevicePool {
+    alignas(64) std::mutex mutex_;
+    std::vector<std::unique_ptr<cudaEvent_t>> event_pool_;
+  };
+  std::vector<PerDevicePool> pools_;
+};
+
+// The process-global pool shared by the caching allocator and
+// at::cuda::CUDAEvent. Intentionally leaked to avoid destruction-order
+// issues at shutdown.
+C10_CUDA_API EventPool* getEventPool();
+
+} // namespace cuda
+} // namespace c10
@@ -4,6 +4,7 @@
 #include <c10/core/impl/InlineDeviceGuard.h>
 #include <c10/core/impl/InlineStreamGuard.h>
 #include <c10/cuda/CUDAMacros.h>
+#include <c10/cuda/CUDAStream.h>
 #include <c10/cuda/impl/CUDAGuardImpl.h>
 
 #include <cstddef>
@@ -204,6 +205,41 @@ struct CUDAStreamGuard {
   c10::impl::InlineStreamGuard<impl::CUDAGuardImpl> guard_;
 };
 
+/// RAII guard that makes a registered stream class (see registerStreamClass
+/// in CUDAStream.h) the thread's default for its scope: the current stream
+/// of the current device is set to a stream from the class's pool, and
+/// anonymous getStreamFromPool requests are served from the class, so ops
+/// launched under the guard run on the class's streams without explicit
+/// stream plumbing.  Like CUDAStreamGuard, this only switches the current
+/// device's stream; it does not touch streams of other devices.
+struct CUDAStreamClassGuard {
+  /// No default constructor, see Note [Omitted default constructor from RAII]
+  explicit CUDAStreamClassGuard() = delete;
+
+  explicit CUDAStreamClassGuard(const std::string& name)
+      : CUDAStreamClassGuard(getStreamClassId(name)) {}
+
+  explicit CUDAStreamClassGuard(int class_id)
+      : prev_class_(exchangeCurrentStreamClass(class_id)),
+        stream_guard_(getStreamFromClass(class_id)) {}
+
+  /// Copy is disallowed
+  CUDAStreamClassGuard(const CUDAStreamClassGuard&) = delete;
+  CUDAStreamClassGuard& operator=(const CUDAStreamClassGuard&) = delete;
+
+  /// Move is disallowed, as with CUDAStreamGuard.
+  CUDAStreamClassGuard(CUDAStreamClassGuard&& other) = delete;
+  CUDAStreamClassGuard& operator=(CUDAStreamClassGuard&& other) = delete;
+
+  ~CUDAStreamClassGuard() {
+    exchangeCurrentStreamClass(prev_class_);
+  }
+
+ private:
+  int prev_class_;
+  CUDAStreamGuard stream_guard_;
+};
+
 /// A variant of OptionalStreamGuard that is specialized for CUDA.  See
 /// CUDAGuard for when you can use this.
 struct OptionalCUDAStreamGuard {
@@ -4,9 +4,12 @@
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 #include <iostream>
@@ -48,17 +51,41 @@ static cudaStream_t low_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
 static cudaStream_t high_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
                                          [kStreamsPerPool];
 
+// Registered stream classes (see registerStreamClass). Like the fixed pools,
+// the per-device streams are created lazily and leaked. A modest cap keeps
+// the class id encodable in the StreamId (see Note [StreamId assignment])
+// and lets readers scan the array lock free: slots are fully initialized
+// before num_stream_classes is bumped and are never reused.
+static constexpr int kMaxStreamClasses = 16;
+struct StreamClassPool {
+  std::string name;
+  int priority = 0;
+  int pool_size = kStreamsPerPool;
+  std::once_flag device_flags[C10_COMPILE_TIME_MAX_GPUS];
+  std::atomic<uint32_t> counters[C10_COMPILE_TIME_MAX_GPUS] = {};
+  cudaStream_t streams[C10_COMPILE_TIME_MAX_GPUS][kStreamsPerPool];
+};
+static std::mutex stream_class_mutex;
+static std::unique_ptr<StreamClassPool> stream_classes[kMaxStreamClasses];
+static std::atomic<int> num_stream_classes{0};
+
+// The thread's default stream class (see currentStreamClass); -1 when unset.
+static thread_local int current_stream_class = -1;
+
 // Note [StreamId assignment]
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~
 // How do we assign stream IDs?
 //
-// -- 57 bits --  -- 5 bits -----  -- 3 bits --
-// zeros          stream id index  StreamIdType
+// -- 49 bits --  -- 7 bits --  -- 5 bits -----  -- 3 bits --
+// zeros          class id      stream id index  StreamIdType
 //
 // Where StreamIdType:
 //  000 = default stream or externally allocated if id[63:3] != 0
 //  001 = low priority stream
 //  010 = high priority stream
+//  100 = stream class stream (class id holds which class)
+//
+// The class id bits are zero except for stream class streams.
 //
 // This is not really for efficiency; it's just easier to write the code
 // to extract the index if we do this with bitmasks :)
@@ -84,6 +111,7 @@ enum class StreamIdType : uint8_t {
   LOW = 0x1,
   HIGH = 0x2,
   EXT = 0x3,
+  CLASS = 0x4,
 };
 
 std::ostream& operator<<(std::ostream& stream, StreamIdType s) {
@@ -100,6 +128,9 @@ std::ostream& operator<<(std::ostream& stream, StreamIdType s) {
     case StreamIdType::EXT:
       stream << "EXT";
       break;
+    case StreamIdType::CLASS:
+      stream << "CLASS";
+      break;
     default:
       stream << static_cast<uint8_t>(s);
       break;
@@ -127,11 +158,21 @@ static inline size_t streamIdIndex(StreamId s) {
       (s >> kStreamTypeBits) & ((1 << kStreamsPerPoolBits) - 1));
 }
 
+static inline size_t streamIdClassId(StreamId s) {
+  return static_cast<size_t>(s >> (kStreamTypeBits + kStreamsPerPoolBits));
+}
+
 StreamId makeStreamId(StreamIdType st, size_t si) {
   return (static_cast<StreamId>(si) << kStreamTypeBits) |
       static_cast<StreamId>(st);
 }
 
+StreamId makeClassStreamId(size_t class_id, size_t si) {
+  return (static_cast<StreamId>(class_id)
+          << (kStreamTypeBits + kStreamsPerPoolBits)) |
+      makeStreamId(StreamIdType::CLASS, si);
+}
+
 // Thread-local current streams
 static thread_local std::unique_ptr<StreamId[]> current_streams = nullptr;
 
@@ -170,6 +211,29 @@ static void initDeviceStreamState(DeviceIndex device_index) {
   high_priority_counters[device_index] = 0;
 }
 
+// Creates a stream class's pool for the specified device
+// Warning: only call once per (class, device) pair!
+static void initStreamClassState(
+    StreamClassPool& stream_class,
+    DeviceIndex device_index) {
+  CUDAGuard device_guard{device_index};
+
+  // Clamp the requested priority to what the device actually supports
+  // (cudaStreamCreateWithPriority would clamp silently anyway; doing it
+  // here keeps the behavior explicit). Lower numbers are higher priority.
+  int least_priority = 0;
+  int greatest_priority = 0;
+  C10_CUDA_CHECK(
+      cudaDeviceGetStreamPriorityRange(&least_priority, &greatest_priority));
+  const int priority =
+      std::min(std::max(stream_class.priority, greatest_priority), least_priority);
+
+  for (const auto i : c10::irange(stream_class.pool_size)) {
+    C10_CUDA_CHECK(cudaStreamCreateWithPriority(
+        &stream_class.streams[device_index][i], kDefaultFlags, priority));
+  }
+}
+
 // Init front-end to ensure initialization only occurs once
 static void initCUDAStreamsOnce() {
   // Inits default streams (once, globally)
@@ -233,6 +297,17 @@ cudaStream_t CUDAStream::stream() const {
       return high_priority_streams[device_index][si];
     case StreamIdType::EXT:
       return reinterpret_cast<cudaStream_t>(stream_id);
+    case StreamIdType::CLASS: {
+      const auto class_id = streamIdClassId(stream_id);
+      TORCH_INTERNAL_ASSERT(
+          class_id < static_cast<size_t>(num_stream_classes.load()),
+          "Unrecognized stream ",
+          stream_,
+          " (the stream class id ",
+          class_id,
+          " has not been registered).");
+      return stream_classes[class_id]->streams[device_index][si];
+    }
     default:
       TORCH_INTERNAL_ASSERT(
           0,
@@ -255,6 +330,13 @@ CUDAStream getStreamFromPool(
     device_index = current_device();
   check_gpu(device_index);
 
+  // A thread-default stream class captures anonymous pool requests, so work
+  // scheduled under a CUDAStreamClassGuard stays on the class's streams.
+  // Explicit high priority requests keep their meaning.
+  if (!isHighPriority && current_stream_class >= 0) {
+    return getStreamFromClass(current_stream_class, device_index);
+  }
+
   // Initializes the stream pools (once)
   std::call_once(
       device_flags[device_index], initDeviceStreamState, device_index);
@@ -268,6 +350,89 @@ CUDAStream getStreamFromPool(
   return CUDAStreamForId(device_index, makeStreamId(StreamIdType::LOW, idx));
 }
 
+int registerStreamClass(const std::string& name, int priority, int pool_size) {
+  TORCH_CHECK(!name.empty(), "Stream class name must not be empty");
+  TORCH_CHECK(
+      pool_size >= 1 && pool_size <= kStreamsPerPool,
+      "Stream class pool size must be between 1 and ",
+      kStreamsPerPool,
+      ", got ",
+      pool_size);
+
+  std::lock_guard<std::mutex> guard(stream_class_mutex);
+  const int count = num_stream_classes.load();
+  for (const auto i : c10::irange(count)) {
+    TORCH_CHECK(
+        stream_classes[i]->name != name,
+        "Stream class '",
+        name,
+        "' is already registered");
+  }
+  TORCH_CHECK(
+      count < kMaxStreamClasses,
+      "At most ",
+      kMaxStreamClasses,
+      " stream classes are supported");
+
+  auto stream_class = std::make_unique<StreamClassPool>();
+  stream_class->name = name;
+  stream_class->priority = priority;
+  stream_class->pool_size = pool_size;
+  stream_classes[count] = std::move(stream_class);
+  num_stream_classes.store(count + 1);
+  return count;
+}
+
+int getStreamClassId(const std::string& name) {
+  const int count = num_stream_classes.load();
+  for (const auto i : c10::irange(count)) {
+    if (stream_classes[i]->name == name) {
+      return i;
+    }
+  }
+  TORCH_CHECK(false, "Unknown stream class '", name, "'");
+}
+
+CUDAStream getStreamFromClass(int class_id, DeviceIndex device_index) {
+  initCUDAStreamsOnce();
+  if (device_index == -1) {
+    device_index = current_device();
+  }
+  check_gpu(device_index);
+  TORCH_CHECK(
+      class_id >= 0 && class_id < num_stream_classes.load(),
+      "Invalid stream class id ",
+      class_id);
+  auto& stream_class = *stream_classes[class_id];
+
+  // Initializes the class's pool on this device (once)
+  std::call_once(
+      stream_class.device_flags[device_index],
+      initStreamClassState,
+      std::ref(stream_class),
+      device_index);
+
+  const auto idx =
+      stream_class.counters[device_index]++ % stream_class.pool_size;
+  return CUDAStreamForId(device_index, makeClassStreamId(class_id, idx));
+}
+
+CUDAStream getStreamFromClass(const std::string& name, DeviceIndex device_index) {
+  return getStreamFromClass(getStreamClassId(name), device_index);
+}
+
+int currentStreamClass() {
+  return current_stream_class;
+}
+
+int exchangeCurrentStreamClass(int class_id) {
+  TORCH_CHECK(
+      class_id >= -1 && class_id < num_stream_classes.load(),
+      "Invalid stream class id ",
+      class_id);
+  return std::exchange(current_stream_class, class_id);
+}
+
 CUDAStream getStreamFromExternal(
     cudaStream_t ext_stream,
     DeviceIndex device_index) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 
 #include <cuda_runtime_api.h>
@@ -36,6 +37,11 @@
  * The third pool is the "high priority" streams. The third pool acts like
  * the second pool except the streams are created with a higher priority.
  *
+ * Beyond the fixed pools, named "stream classes" can be registered (see
+ * registerStreamClass below). Each class is its own round-robin pool with a
+ * configurable CUDA priority and pool size, so e.g. latency-critical decode
+ * work can be kept off the streams that bulk prefill work rotates through.
+ *
  * These pools suggest that stream users should prefer many short-lived streams,
  * as the cost of acquiring and releasing streams is effectively zero. If
  * many longer-lived streams are required in performance critical scenarios
@@ -197,6 +203,48 @@ class C10_CUDA_API CUDAStream {
 TORCH_API CUDAStream
 getStreamFromPool(const bool isHighPriority = false, DeviceIndex device = -1);
 
+/**
+ * Register a named stream class: a dedicated round-robin pool whose streams
+ * are created with the given CUDA priority (lower numbers run first; the
+ * value is clamped to the range the device supports) and the given pool size
+ * (between 1 and 32 streams).
+ *
+ * Returns the id of the new class; registering a name twice errors. The
+ * per-device pools are created lazily on first use, so classes should be
+ * registered before work is scheduled on them. Like the fixed pools, class
+ * streams live for the remainder of the process.
+ */
+TORCH_API int
+registerStreamClass(const std::string& name, int priority, int pool_size);
+
+/**
+ * Get the id of a registered stream class. Errors if the name is unknown.
+ */
+TORCH_API int getStreamClassId(const std::string& name);
+
+/**
+ * Get a stream from the class's pool, round-robin like getStreamFromPool.
+ */
+TORCH_API CUDAStream
+getStreamFromClass(int class_id, DeviceIndex device_index = -1);
+TORCH_API CUDAStream
+getStreamFromClass(const std::string& name, DeviceIndex device_index = -1);
+
+/**
+ * The current thread's default stream class, or -1 when none is set. While
+ * set, getStreamFromPool requests that do not explicitly ask for a high
+ * priority stream are served from this class's pool, so code that hands out
+ * streams internally stays within the class without being plumbed through.
+ * Prefer CUDAStreamClassGuard (in CUDAGuard.h) over setting this directly.
+ */
+TORCH_API int currentStreamClass();
+
+/**
+ * Set the current thread's default stream class (-1 to unset) and return
+ * the previously set class.
+ */
+TORCH_API int exchangeCurrentStreamClass(int class_id);
+
 /**
  * Get a CUDAStream from a externally allocated one.
  *
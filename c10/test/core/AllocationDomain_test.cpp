@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/AllocationDomain.h>
+#include <c10/core/CPUAllocator.h>
+
+namespace {
+
+using c10::AllocationDomainGuard;
+using c10::AllocationDomainTracker;
+using c10::AllocationOpContextGuard;
+
+TEST(AllocationDomainTest, GuardNestsAndRestores) {
+  EXPECT_EQ(c10::currentAllocationDomain(), c10::kDefaultAllocationDomain);
+  {
+    AllocationDomainGuard outer("outer");
+    EXPECT_EQ(c10::currentAllocationDomain(), "outer");
+    {
+      AllocationDomainGuard inner("inner");
+      EXPECT_EQ(c10::currentAllocationDomain(), "inner");
+    }
+    EXPECT_EQ(c10::currentAllocationDomain(), "outer");
+  }
+  EXPECT_EQ(c10::currentAllocationDomain(), c10::kDefaultAllocationDomain);
+}
+
+TEST(AllocationDomainTest, TracksLiveBytesThroughCPUAllocator) {
+  auto& tracker = AllocationDomainTracker::singleton();
+  tracker.setEnabled(true);
+  {
+    AllocationDomainGuard guard("request-1");
+    auto data = c10::GetCPUAllocator()->allocate(1024);
+    EXPECT_EQ(tracker.liveBytes("request-1"), 1024);
+  }
+  // The DataPtr going out of scope frees the allocation.
+  EXPECT_EQ(tracker.liveBytes("request-1"), 0);
+  tracker.setEnabled(false);
+}
+
+TEST(AllocationDomainTest, DumpGroupsByDomainAndNamesOp) {
+  auto& tracker = AllocationDomainTracker::singleton();
+  tracker.setEnabled(true);
+
+  void* fake = reinterpret_cast<void*>(0x1234);
+  {
+    AllocationDomainGuard guard("request-2");
+    AllocationOpContextGuard op_guard("aten::mm");
+    tracker.recordAlloc(fake, 512, c10::Device(c10::DeviceType::CPU));
+  }
+
+  auto dump = tracker.dumpLiveAllocations();
+  ASSERT_EQ(dump.count("request-2"), 1u);
+  ASSERT_EQ(dump["request-2"].size(), 1u);
+  const auto& entry = dump["request-2"][0];
+  EXPECT_EQ(entry.ptr, fake);
+  EXPECT_EQ(entry.size, 512);
+  EXPECT_EQ(entry.op, "aten::mm");
+
+  auto per_domain = tracker.liveBytesPerDomain();
+  EXPECT_EQ(per_domain["request-2"], 512);
+
+  tracker.recordFree(fake);
+  EXPECT_EQ(tracker.liveBytes("request-2"), 0);
+  tracker.setEnabled(false);
+}
+
+TEST(AllocationDomainTest, UntrackedFreesAndUnknownDomainsAreBenign) {
+  auto& tracker = AllocationDomainTracker::singleton();
+  tracker.setEnabled(true);
+  // Allocated before tracking started: the free must not underflow anything.
+  tracker.recordFree(reinterpret_cast<void*>(0x5678));
+  EXPECT_EQ(tracker.liveBytes("never-seen"), 0);
+  tracker.setEnabled(false);
+}
+
+TEST(AllocationDomainTest, DisablingClearsState) {
+  auto& tracker = AllocationDomainTracker::singleton();
+  tracker.setEnabled(true);
+  {
+    AllocationDomainGuard guard("request-3");
+    tracker.recordAlloc(
+        reinterpret_cast<void*>(0x9abc), 256, c10::Device(c10::DeviceType::CPU));
+  }
+  EXPECT_EQ(tracker.liveBytes("request-3"), 256);
+  tracker.setEnabled(false);
+  tracker.setEnabled(true);
+  EXPECT_EQ(tracker.liveBytes("request-3"), 0);
+  EXPECT_TRUE(tracker.dumpLiveAllocations().empty());
+  tracker.setEnabled(false);
+}
+
+} // namespace
@@ -0,0 +1,54 @@
+#include <c10/core/DeferredVersionBump.h>
+#include <c10/core/TensorImpl.h>
+
+#include <gtest/gtest.h>
+
+using c10::DeferredVersionBumpGuard;
+using c10::VariableVersion;
+
+TEST(DeferredVersionBumpTest, BumpsOutsideGuardAreImmediate) {
+  VariableVersion v(/*version=*/0);
+  v.bump();
+  EXPECT_EQ(v.current_version(), 1);
+}
+
+TEST(DeferredVersionBumpTest, BumpsInsideGuardCollapseToOne) {
+  VariableVersion v(/*version=*/0);
+  {
+    DeferredVersionBumpGuard guard;
+    v.bump();
+    v.bump();
+    v.bump();
+    // Not published until the guard exits.
+    EXPECT_EQ(v.current_version(), 0);
+  }
+  EXPECT_EQ(v.current_version(), 1);
+}
+
+TEST(DeferredVersionBumpTest, NestedGuardsFlushAtOutermostExit) {
+  VariableVersion v(/*version=*/0);
+  {
+    DeferredVersionBumpGuard outer;
+    {
+      DeferredVersionBumpGuard inner;
+      v.bump();
+    }
+    // Inner exit must not publish while the outer guard is active.
+    EXPECT_EQ(v.current_version(), 0);
+    v.bump();
+  }
+  EXPECT_EQ(v.current_version(), 1);
+}
+
+TEST(DeferredVersionBumpTest, DistinctCountersEachGetOneBump) {
+  VariableVersion a(/*version=*/3);
+  VariableVersion b(/*version=*/7);
+  {
+    DeferredVersionBumpGuard guard;
+    a.bump();
+    b.bump();
+    a.bump();
+  }
+  EXPECT_EQ(a.current_version(), 4);
+  EXPECT_EQ(b.current_version(), 8);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/MemoryPressureBroker.h>
+
+#include <vector>
+
+namespace {
+
+using c10::MemoryPressureBroker;
+
+// Simple registered cache that hands out its full contents on eviction.
+struct FakeCache {
+  size_t bytes{0};
+  size_t eviction_calls{0};
+
+  MemoryPressureBroker::CacheHandle registerWith(
+      MemoryPressureBroker& broker,
+      const std::string& name,
+      double rebuild_cost) {
+    return broker.registerCache(
+        name,
+        rebuild_cost,
+        [this]() { return bytes; },
+        [this](size_t /*bytes_requested*/) {
+          eviction_calls += 1;
+          const size_t freed = bytes;
+          bytes = 0;
+          return freed;
+        });
+  }
+};
+
+TEST(MemoryPressureBrokerTest, EvictsCheapestRebuildFirst) {
+  auto& broker = MemoryPressureBroker::singleton();
+  FakeCache cheap, expensive;
+  cheap.bytes = 1000;
+  expensive.bytes = 1000;
+  auto h1 = cheap.registerWith(broker, "cheap", /*rebuild_cost=*/1.0);
+  auto h2 = expensive.registerWith(broker, "expensive", /*rebuild_cost=*/100.0);
+
+  // The cheap cache alone covers the request, so the expensive one survives.
+  EXPECT_EQ(broker.evict(500), 1000);
+  EXPECT_EQ(cheap.eviction_calls, 1);
+  EXPECT_EQ(expensive.eviction_calls, 0);
+  EXPECT_EQ(expensive.bytes, 1000);
+
+  // A request the (now empty) cheap cache cannot cover falls through.
+  EXPECT_EQ(broker.evict(500), 1000);
+  EXPECT_EQ(expensive.eviction_calls, 1);
+
+  broker.unregisterCache(h1);
+  broker.unregisterCache(h2);
+}
+
+TEST(MemoryPressureBrokerTest, PrefersLargerBytesAtEqualCost) {
+  auto& broker = MemoryPressureBroker::singleton();
+  FakeCache small, large;
+  small.bytes = 100;
+  large.bytes = 10000;
+  auto h1 = small.registerWith(broker, "small", /*rebuild_cost=*/1.0);
+  auto h2 = large.registerWith(broker, "large", /*rebuild_cost=*/1.0);
+
+  EXPECT_EQ(broker.evict(5000), 10000);
+  EXPECT_EQ(large.eviction_calls, 1);
+  EXPECT_EQ(small.eviction_calls, 0);
+
+  broker.unregisterCache(h1);
+  broker.unregisterCache(h2);
+}
+
+TEST(MemoryPressureBrokerTest, UnregisteredCacheIsNotAsked) {
+  auto& broker = MemoryPressureBroker::singleton();
+  FakeCache cache;
+  cache.bytes = 100;
+  auto handle = cache.registerWith(broker, "gone", /*rebuild_cost=*/1.0);
+  broker.unregisterCache(handle);
+
+  EXPECT_EQ(broker.evict(100), 0);
+  EXPECT_EQ(cache.eviction_calls, 0);
+}
+
+TEST(MemoryPressureBrokerTest, ReentrantEvictIsNoop) {
+  auto& broker = MemoryPressureBroker::singleton();
+  size_t inner_freed = 0;
+  auto handle = broker.registerCache(
+      "reentrant",
+      /*rebuild_cost=*/1.0,
+      []() { return size_t(100); },
+      [&](size_t /*bytes_requested*/) {
+        // An eviction that frees through an allocator can land back in the
+        // broker on the same thread; that inner request must not recurse.
+        inner_freed = broker.evict(100);
+        return size_t(100);
+      });
+
+  EXPECT_EQ(broker.evict(100), 100);
+  EXPECT_EQ(inner_freed, 0);
+  broker.unregisterCache(handle);
+}
+
+TEST(MemoryPressureBrokerTest, TracksStats) {
+  auto& broker = MemoryPressureBroker::singleton();
+  FakeCache cache;
+  cache.bytes = 4096;
+  auto handle = cache.registerWith(broker, "stats_cache", /*rebuild_cost=*/2.0);
+
+  broker.evict(1);
+  bool found = false;
+  for (const auto& s : broker.getStats()) {
+    if (s.name == "stats_cache") {
+      found = true;
+      EXPECT_EQ(s.bytes_held, 0);
+      EXPECT_EQ(s.rebuild_cost, 2.0);
+      EXPECT_EQ(s.eviction_requests, 1);
+      EXPECT_EQ(s.bytes_evicted, 4096);
+    }
+  }
+  EXPECT_TRUE(found);
+  broker.unregisterCache(handle);
+}
+
+} // namespace
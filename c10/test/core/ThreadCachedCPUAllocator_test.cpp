@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/ThreadCachedCPUAllocator.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(ThreadCachedCPUAllocatorTest, AllocFreeRoundTrip) {
+  auto* allocator = c10::GetThreadCachedCPUAllocator();
+  for (size_t nbytes : {1, 17, 64, 4096, 1 << 19}) {
+    auto ptr = allocator->allocate(nbytes);
+    ASSERT_NE(ptr.get(), nullptr);
+    // The block must be writable across its full extent.
+    std::memset(ptr.get(), 0xab, nbytes);
+  }
+}
+
+TEST(ThreadCachedCPUAllocatorTest, SameSizeClassReusesBlock) {
+  auto* allocator = c10::GetThreadCachedCPUAllocator();
+  // Warm the thread cache, free, and check the next same-class allocation is
+  // served without growing the slab pool.
+  void* first = nullptr;
+  {
+    auto ptr = allocator->allocate(1024);
+    first = ptr.get();
+  }
+  const auto before = c10::cpu_alloc::getThreadCachedCPUAllocatorStats();
+  auto ptr = allocator->allocate(1024);
+  const auto after = c10::cpu_alloc::getThreadCachedCPUAllocatorStats();
+  EXPECT_EQ(ptr.get(), first);
+  EXPECT_EQ(before.allocated_from_slab, after.allocated_from_slab);
+}
+
+TEST(ThreadCachedCPUAllocatorTest, OversizeFallsThrough) {
+  auto* allocator = c10::GetThreadCachedCPUAllocator();
+  const auto before = c10::cpu_alloc::getThreadCachedCPUAllocatorStats();
+  auto ptr = allocator->allocate(8u << 20);
+  const auto after = c10::cpu_alloc::getThreadCachedCPUAllocatorStats();
+  ASSERT_NE(ptr.get(), nullptr);
+  EXPECT_GT(after.allocated_oversize, before.allocated_oversize);
+}
+
+TEST(ThreadCachedCPUAllocatorTest, CrossThreadFreeIsSafe) {
+  auto* allocator = c10::GetThreadCachedCPUAllocator();
+  std::vector<at::DataPtr> ptrs;
+  for (int i = 0; i < 128; ++i) {
+    ptrs.push_back(allocator->allocate(256));
+  }
+  // Free on a different thread than the one that allocated.
+  std::thread t([&]() { ptrs.clear(); });
+  t.join();
+  auto ptr = allocator->allocate(256);
+  EXPECT_NE(ptr.get(), nullptr);
+}
+
+} // namespace
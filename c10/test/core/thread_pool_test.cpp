@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <c10/core/thread_pool.h>
+
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+TEST(ThreadPoolTest, RunsChildTasksNewestFirst) {
+  c10::TaskThreadPool pool(1);
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&](int id) {
+    std::lock_guard<std::mutex> guard(mutex);
+    order.push_back(id);
+  };
+
+  pool.run([&]() {
+    record(0);
+    // Children submitted from a pool thread are picked back up in LIFO
+    // order once the submitting task returns.
+    pool.run([&]() { record(1); });
+    pool.run([&]() { record(2); });
+  });
+  pool.waitWorkComplete();
+
+  ASSERT_EQ(order, (std::vector<int>{0, 2, 1}));
+  ASSERT_EQ(pool.stealCount(), 0);
+}
+
+TEST(ThreadPoolTest, IdleThreadStealsQueuedChildTask) {
+  c10::TaskThreadPool pool(2);
+  std::promise<void> child_ran;
+  auto child_done = child_ran.get_future();
+
+  pool.run([&]() {
+    // The child lands on this thread's queue, but this thread then blocks
+    // waiting for it, so the only way it can run is for the pool's other
+    // thread to steal it.
+    pool.run([&]() { child_ran.set_value(); });
+    child_done.wait();
+  });
+  pool.waitWorkComplete();
+
+  ASSERT_EQ(pool.stealCount(), 1);
+}
+
+} // namespace
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <c10/util/ThreadLocalDebugInfo.h>
+
+#include <memory>
+#include <thread>
+
+namespace {
+
+struct TestDebugInfo : public c10::DebugInfoBase {
+  explicit TestDebugInfo(int value) : value(value) {}
+  int value;
+};
+
+TEST(ThreadLocalDebugInfoTest, ArmedFlagFollowsGuards) {
+  EXPECT_FALSE(c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+  EXPECT_EQ(
+      c10::ThreadLocalDebugInfo::get(c10::DebugInfoKind::TEST_INFO), nullptr);
+
+  {
+    c10::DebugInfoGuard guard(
+        c10::DebugInfoKind::TEST_INFO, std::make_shared<TestDebugInfo>(1));
+    EXPECT_TRUE(
+        c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+    auto* info = static_cast<TestDebugInfo*>(
+        c10::ThreadLocalDebugInfo::get(c10::DebugInfoKind::TEST_INFO));
+    ASSERT_NE(info, nullptr);
+    EXPECT_EQ(info->value, 1);
+
+    // Nested guard of a different kind arms independently.
+    {
+      c10::DebugInfoGuard nested(
+          c10::DebugInfoKind::TEST_INFO_2, std::make_shared<TestDebugInfo>(2));
+      EXPECT_TRUE(
+          c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO_2));
+    }
+    EXPECT_FALSE(
+        c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO_2));
+    EXPECT_TRUE(
+        c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+  }
+  EXPECT_FALSE(c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+  EXPECT_EQ(
+      c10::ThreadLocalDebugInfo::get(c10::DebugInfoKind::TEST_INFO), nullptr);
+}
+
+TEST(ThreadLocalDebugInfoTest, ChainGuardAcrossThreads) {
+  std::shared_ptr<c10::ThreadLocalDebugInfo> state;
+  {
+    c10::DebugInfoGuard guard(
+        c10::DebugInfoKind::TEST_INFO, std::make_shared<TestDebugInfo>(42));
+    state = c10::ThreadLocalDebugInfo::current();
+  }
+  // The guard is gone; only installing the captured chain re-arms the kind.
+  EXPECT_FALSE(c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+
+  std::thread worker([state]() {
+    EXPECT_EQ(
+        c10::ThreadLocalDebugInfo::get(c10::DebugInfoKind::TEST_INFO), nullptr);
+    {
+      c10::DebugInfoGuard guard(state);
+      EXPECT_TRUE(
+          c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+      auto* info = static_cast<TestDebugInfo*>(
+          c10::ThreadLocalDebugInfo::get(c10::DebugInfoKind::TEST_INFO));
+      ASSERT_NE(info, nullptr);
+      EXPECT_EQ(info->value, 42);
+    }
+    EXPECT_FALSE(
+        c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+  });
+  worker.join();
+}
+
+TEST(ThreadLocalDebugInfoTest, PushPopArmsAndDisarms) {
+  c10::ThreadLocalDebugInfo::_push(
+      c10::DebugInfoKind::TEST_INFO, std::make_shared<TestDebugInfo>(7));
+  EXPECT_TRUE(c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+  auto popped = c10::ThreadLocalDebugInfo::_pop(c10::DebugInfoKind::TEST_INFO);
+  EXPECT_EQ(static_cast<TestDebugInfo*>(popped.get())->value, 7);
+  EXPECT_FALSE(c10::ThreadLocalDebugInfo::isArmed(c10::DebugInfoKind::TEST_INFO));
+}
+
+} // namespace
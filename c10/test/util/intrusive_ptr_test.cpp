@@ -1444,6 +1444,45 @@ TEST(IntrusivePtrTest, givenMoveConstructedPtr_thenOldIsNotUnique) {
   EXPECT_FALSE(obj.unique());
 }
 
+TEST(IntrusivePtrTest, givenNonAtomicRefcountGuard_thenRefcountingWorks) {
+  c10::NonAtomicRefcountGuard guard;
+  intrusive_ptr<SomeClass> obj = make_intrusive<SomeClass>();
+  EXPECT_EQ(1, obj.use_count());
+  intrusive_ptr<SomeClass> copy = obj;
+  EXPECT_EQ(2, obj.use_count());
+  copy.reset();
+  EXPECT_EQ(1, obj.use_count());
+  EXPECT_TRUE(obj.unique());
+}
+
+TEST(
+    IntrusivePtrTest,
+    givenNonAtomicRefcountGuard_whenLastRefDropped_thenDestructs) {
+  bool resourcesReleased = false;
+  bool wasDestructed = false;
+  {
+    c10::NonAtomicRefcountGuard guard;
+    auto obj =
+        make_intrusive<DestructableMock>(&resourcesReleased, &wasDestructed);
+  }
+  EXPECT_TRUE(resourcesReleased);
+  EXPECT_TRUE(wasDestructed);
+}
+
+TEST(IntrusivePtrTest, givenNonAtomicRefcountGuard_thenIsScopedAndNestable) {
+  EXPECT_FALSE(c10::detail::non_atomic_refcounts_enabled());
+  {
+    c10::NonAtomicRefcountGuard guard;
+    EXPECT_TRUE(c10::detail::non_atomic_refcounts_enabled());
+    {
+      c10::NonAtomicRefcountGuard nested;
+      EXPECT_TRUE(c10::detail::non_atomic_refcounts_enabled());
+    }
+    EXPECT_TRUE(c10::detail::non_atomic_refcounts_enabled());
+  }
+  EXPECT_FALSE(c10::detail::non_atomic_refcounts_enabled());
+}
+
 TEST(IntrusivePtrTest, givenMoveAssignedPtr_thenHasUseCount1) {
   intrusive_ptr<SomeClass> obj = make_intrusive<SomeClass>();
   intrusive_ptr<SomeClass> obj2 = make_intrusive<SomeClass>();
@@ -1,13 +1,75 @@
 #include <c10/util/ThreadLocal.h>
 #include <c10/util/ThreadLocalDebugInfo.h>
 
+#include <array>
+#include <mutex>
+
 namespace c10 {
 
 C10_DEFINE_TLS_static(std::shared_ptr<ThreadLocalDebugInfo>, tls_debug_info);
 #define debug_info (tls_debug_info.get())
 
+std::atomic<uint64_t> debug_info_armed_kinds_{0};
+
+namespace {
+// Guards the per-kind installation counts below; armed-kind bit flips only
+// happen under this mutex, so the bitmask read by isArmed() is exact.
+// Installing debug info is rare (it means some observer is being armed), so
+// the mutex is off the hot path.
+std::mutex debug_info_counts_mutex;
+std::array<int64_t, 64> debug_info_kind_counts{};
+} // namespace
+
+/* static */
+void ThreadLocalDebugInfo::_arm(DebugInfoKind kind) {
+  const auto idx = static_cast<size_t>(kind);
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(idx < debug_info_kind_counts.size());
+  std::lock_guard<std::mutex> lock(debug_info_counts_mutex);
+  if (debug_info_kind_counts[idx]++ == 0) {
+    debug_info_armed_kinds_.fetch_or(1ULL << idx, std::memory_order_relaxed);
+  }
+}
+
+/* static */
+void ThreadLocalDebugInfo::_disarm(DebugInfoKind kind) {
+  const auto idx = static_cast<size_t>(kind);
+  std::lock_guard<std::mutex> lock(debug_info_counts_mutex);
+  if (debug_info_kind_counts[idx] == 0) {
+    // Unbalanced install/uninstall interleavings (e.g. a chain guard whose
+    // scope popped part of a chain it shares with the saved state) err on
+    // the side of leaving the kind armed rather than underflowing; that only
+    // costs the fast path for this kind, never correctness.
+    return;
+  }
+  if (--debug_info_kind_counts[idx] == 0) {
+    debug_info_armed_kinds_.fetch_and(
+        ~(1ULL << idx), std::memory_order_relaxed);
+  }
+}
+
+/* static */
+void ThreadLocalDebugInfo::_armChain(const ThreadLocalDebugInfo* chain) {
+  for (; chain; chain = chain->parent_info_.get()) {
+    _arm(chain->kind_);
+  }
+}
+
+/* static */
+void ThreadLocalDebugInfo::_disarmChain(const ThreadLocalDebugInfo* chain) {
+  for (; chain; chain = chain->parent_info_.get()) {
+    _disarm(chain->kind_);
+  }
+}
+
 /* static */
 DebugInfoBase* ThreadLocalDebugInfo::get(DebugInfoKind kind) {
+  // A chain node of `kind` on this thread implies the armed bit for `kind`
+  // is set (installation on this thread set it), so bailing out here is
+  // safe. This keeps the common disarmed case down to one relaxed atomic
+  // load and a predictable branch.
+  if (C10_LIKELY(!isArmed(kind))) {
+    return nullptr;
+  }
   ThreadLocalDebugInfo* cur = debug_info.get();
   while (cur) {
     if (cur->kind_ == kind) {
@@ -26,6 +88,8 @@ std::shared_ptr<ThreadLocalDebugInfo> ThreadLocalDebugInfo::current() {
 /* static */
 void ThreadLocalDebugInfo::_forceCurrentDebugInfo(
     const std::shared_ptr<ThreadLocalDebugInfo>& info) {
+  _armChain(info.get());
+  _disarmChain(debug_info.get());
   debug_info = info;
 }
 
@@ -38,6 +102,7 @@ void ThreadLocalDebugInfo::_push(
   debug_info->parent_info_ = prev_info;
   debug_info->kind_ = kind;
   debug_info->info_ = info;
+  _arm(kind);
 }
 
 /* static */
@@ -48,6 +113,7 @@ std::shared_ptr<DebugInfoBase> ThreadLocalDebugInfo::_pop(DebugInfoKind kind) {
       (size_t)kind);
   auto res = debug_info;
   debug_info = debug_info->parent_info_;
+  _disarm(res->kind_);
   return res->info_;
 }
 
@@ -73,6 +139,15 @@ DebugInfoGuard::DebugInfoGuard(
 
 DebugInfoGuard::~DebugInfoGuard() {
   if (active_) {
+    // Disarm whatever of this guard's installation is still live: the nodes
+    // between the current top and the saved chain are exactly the ones about
+    // to be uninstalled by the restore below (a _pop inside the scope has
+    // already disarmed its node itself).
+    const ThreadLocalDebugInfo* cur = debug_info.get();
+    while (cur && cur != prev_info_.get()) {
+      ThreadLocalDebugInfo::_disarm(cur->kind_);
+      cur = cur->parent_info_.get();
+    }
     debug_info = prev_info_;
   }
 }
@@ -85,7 +160,8 @@ DebugInfoGuard::DebugInfoGuard(std::shared_ptr<ThreadLocalDebugInfo> info) {
     return;
   }
   prev_info_ = debug_info;
-  debug_info = info;
+  ThreadLocalDebugInfo::_armChain(info.get());
+  debug_info = std::move(info);
   active_ = true;
 }
 
@@ -3,12 +3,18 @@
 #include <c10/macros/Export.h>
 #include <c10/util/Exception.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
 namespace c10 {
 
+// Bitmask with bit i set iff debug info of DebugInfoKind i is currently
+// installed on at least one thread. Internal, maintained by
+// ThreadLocalDebugInfo; read it through ThreadLocalDebugInfo::isArmed.
+C10_API extern std::atomic<uint64_t> debug_info_armed_kinds_;
+
 enum class C10_API_ENUM DebugInfoKind : uint8_t {
   PRODUCER_INFO = 0,
   MOBILE_RUNTIME_INFO,
@@ -36,6 +42,17 @@ class C10_API ThreadLocalDebugInfo {
  public:
   static DebugInfoBase* get(DebugInfoKind kind);
 
+  // Cheap hot-path guard: a single relaxed atomic load and a (predictably
+  // not-taken) branch when no debug info of the given kind exists anywhere
+  // in the process. get() consults this before walking the thread-local
+  // shared_ptr chain, so observers that are disarmed most of the time —
+  // e.g. 1-in-N sampled fleet profiling — cost only this load on the
+  // non-sampled calls.
+  static bool isArmed(DebugInfoKind kind) {
+    return (debug_info_armed_kinds_.load(std::memory_order_relaxed) &
+            (1ULL << static_cast<uint8_t>(kind))) != 0;
+  }
+
   // Get current ThreadLocalDebugInfo
   static std::shared_ptr<ThreadLocalDebugInfo> current();
 
@@ -53,6 +70,13 @@ class C10_API ThreadLocalDebugInfo {
   static std::shared_ptr<DebugInfoBase> _peek(DebugInfoKind kind);
 
  private:
+  // Bookkeeping behind isArmed(): every installation of a chain node on a
+  // thread bumps a per-kind count; the counts back the armed-kinds bitmask.
+  static void _arm(DebugInfoKind kind);
+  static void _disarm(DebugInfoKind kind);
+  static void _armChain(const ThreadLocalDebugInfo* chain);
+  static void _disarmChain(const ThreadLocalDebugInfo* chain);
+
   std::shared_ptr<DebugInfoBase> info_;
   DebugInfoKind kind_;
   std::shared_ptr<ThreadLocalDebugInfo> parent_info_;
@@ -1 +1,23 @@
 #include <c10/util/intrusive_ptr.h>
+
+namespace c10 {
+namespace detail {
+
+#if defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+namespace {
+thread_local bool raw_non_atomic_refcounts_tls = false;
+} // namespace
+
+bool non_atomic_refcounts_enabled() {
+  return raw_non_atomic_refcounts_tls;
+}
+
+void _set_non_atomic_refcounts_enabled(bool enabled) {
+  raw_non_atomic_refcounts_tls = enabled;
+}
+#else // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+thread_local bool raw_non_atomic_refcounts_tls = false;
+#endif // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+
+} // namespace detail
+} // namespace c10
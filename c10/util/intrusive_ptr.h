@@ -215,8 +215,104 @@ inline size_t atomic_weakcount_decrement(std::atomic<size_t>& weakcount) {
   return weakcount.fetch_sub(1, std::memory_order_acq_rel) - 1;
 }
 
+// thread_local variables cannot be C10_API on Windows.
+#if defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+C10_API bool non_atomic_refcounts_enabled();
+C10_API void _set_non_atomic_refcounts_enabled(bool enabled);
+#else // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+extern C10_API thread_local bool raw_non_atomic_refcounts_tls;
+
+inline bool non_atomic_refcounts_enabled() {
+  return raw_non_atomic_refcounts_tls;
+}
+
+// Internal, use NonAtomicRefcountGuard.
+inline void _set_non_atomic_refcounts_enabled(bool enabled) {
+  raw_non_atomic_refcounts_tls = enabled;
+}
+#endif // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
+
+// The refcount operations below are what intrusive_ptr actually uses. They
+// normally forward to the atomic versions above, but while a
+// NonAtomicRefcountGuard is active on this thread they degrade to plain
+// load/store pairs: on x86_64 that replaces a lock-prefixed RMW with a plain
+// `mov`/`add`/`mov`, which matters when an interpreter copies IValues on
+// every stack push. Only sound under the guard's thread-confinement contract.
+
+inline size_t refcount_increment(std::atomic<size_t>& refcount) {
+  if (C10_UNLIKELY(non_atomic_refcounts_enabled())) {
+    size_t new_refcount = refcount.load(std::memory_order_relaxed) + 1;
+    refcount.store(new_refcount, std::memory_order_relaxed);
+    return new_refcount;
+  }
+  return atomic_refcount_increment(refcount);
+}
+
+inline size_t weakcount_increment(std::atomic<size_t>& weakcount) {
+  if (C10_UNLIKELY(non_atomic_refcounts_enabled())) {
+    size_t new_weakcount = weakcount.load(std::memory_order_relaxed) + 1;
+    weakcount.store(new_weakcount, std::memory_order_relaxed);
+    return new_weakcount;
+  }
+  return atomic_weakcount_increment(weakcount);
+}
+
+inline size_t refcount_decrement(std::atomic<size_t>& refcount) {
+  if (C10_UNLIKELY(non_atomic_refcounts_enabled())) {
+    size_t new_refcount = refcount.load(std::memory_order_relaxed) - 1;
+    refcount.store(new_refcount, std::memory_order_relaxed);
+    return new_refcount;
+  }
+  return atomic_refcount_decrement(refcount);
+}
+
+inline size_t weakcount_decrement(std::atomic<size_t>& weakcount) {
+  if (C10_UNLIKELY(non_atomic_refcounts_enabled())) {
+    size_t new_weakcount = weakcount.load(std::memory_order_relaxed) - 1;
+    weakcount.store(new_weakcount, std::memory_order_relaxed);
+    return new_weakcount;
+  }
+  return atomic_weakcount_decrement(weakcount);
+}
+
 } // namespace detail
 
+/**
+ * RAII guard that switches intrusive_ptr refcount updates on the current
+ * thread from atomic read-modify-writes to plain load/store pairs.
+ *
+ * Refcount bumps are a measurable cost in single-threaded interpreter
+ * workloads, where every IValue copied onto the stack pays a lock-prefixed
+ * increment for data that never leaves the thread. Inside the guard those
+ * bumps compile down to ordinary memory operations.
+ *
+ * Safety contract: while the guard is active, no object whose refcount this
+ * thread touches may be retained or released by any other thread. Other
+ * threads keep using atomic operations, so a concurrent atomic bump and a
+ * plain load/store pair on the same object lose updates. This is only
+ * appropriate for fully thread-confined work, e.g. a single-threaded
+ * inference worker operating on its own copy of a module; anything shared
+ * across workers (cached global tensors, constants in shared code objects)
+ * must not be refcounted under the guard.
+ */
+class NonAtomicRefcountGuard {
+ public:
+  NonAtomicRefcountGuard()
+      : prev_enabled_(detail::non_atomic_refcounts_enabled()) {
+    detail::_set_non_atomic_refcounts_enabled(true);
+  }
+  NonAtomicRefcountGuard(const NonAtomicRefcountGuard&) = delete;
+  NonAtomicRefcountGuard& operator=(const NonAtomicRefcountGuard&) = delete;
+  NonAtomicRefcountGuard(NonAtomicRefcountGuard&&) = delete;
+  NonAtomicRefcountGuard& operator=(NonAtomicRefcountGuard&&) = delete;
+  ~NonAtomicRefcountGuard() {
+    detail::_set_non_atomic_refcounts_enabled(prev_enabled_);
+  }
+
+ private:
+  bool prev_enabled_;
+};
+
 template <class TTarget, class NullType>
 class weak_intrusive_ptr;
 
@@ -266,8 +362,7 @@ class intrusive_ptr final {
 
   void retain_() {
     if (target_ != NullType::singleton()) {
-      size_t new_refcount =
-          detail::atomic_refcount_increment(target_->refcount_);
+      size_t new_refcount = detail::refcount_increment(target_->refcount_);
       TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
           new_refcount != 1,
           "intrusive_ptr: Cannot increase refcount after it reached zero.");
@@ -276,7 +371,7 @@ class intrusive_ptr final {
 
   void reset_() noexcept {
     if (target_ != NullType::singleton() &&
-        detail::atomic_refcount_decrement(target_->refcount_) == 0) {
+        detail::refcount_decrement(target_->refcount_) == 0) {
       // See comment above about weakcount. As long as refcount>0,
       // weakcount is one larger than the actual number of weak references.
       // So we need to decrement it here.
@@ -288,7 +383,7 @@ class intrusive_ptr final {
         // objects. NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
         const_cast<std::remove_const_t<TTarget>*>(target_)->release_resources();
         should_delete =
-            detail::atomic_weakcount_decrement(target_->weakcount_) == 0;
+            detail::weakcount_decrement(target_->weakcount_) == 0;
       }
       if (should_delete) {
         delete target_;
@@ -690,8 +785,7 @@ class weak_intrusive_ptr final {
 
   void retain_() {
     if (target_ != NullType::singleton()) {
-      size_t new_weakcount =
-          detail::atomic_weakcount_increment(target_->weakcount_);
+      size_t new_weakcount = detail::weakcount_increment(target_->weakcount_);
       TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
           new_weakcount != 1,
           "weak_intrusive_ptr: Cannot increase weakcount after it reached zero.");
@@ -700,7 +794,7 @@ class weak_intrusive_ptr final {
 
   void reset_() noexcept {
     if (target_ != NullType::singleton() &&
-        detail::atomic_weakcount_decrement(target_->weakcount_) == 0) {
+        detail::weakcount_decrement(target_->weakcount_) == 0) {
       // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
       delete target_;
     }
@@ -969,7 +1063,7 @@ namespace intrusive_ptr {
 // NullType::singleton to this function
 inline void incref(intrusive_ptr_target* self) {
   if (self) {
-    detail::atomic_refcount_increment(self->refcount_);
+    detail::refcount_increment(self->refcount_);
   }
 }
 
@@ -1003,7 +1097,7 @@ inline size_t use_count(intrusive_ptr_target* self) {
 namespace weak_intrusive_ptr {
 
 inline void incref(weak_intrusive_ptr_target* self) {
-  detail::atomic_weakcount_increment(self->weakcount_);
+  detail::weakcount_increment(self->weakcount_);
 }
 
 inline void decref(weak_intrusive_ptr_target* self) {
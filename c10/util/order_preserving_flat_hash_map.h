@@ -104,6 +104,16 @@ struct KeyOrValueHasher : functor_storage<uint64_t, hasher> {
   uint64_t operator()(const std::pair<F, S>& value) const {
     return static_cast<const hasher_storage&>(*this)(value.first);
   }
+  // Heterogeneous key types (see find_transparent) pass straight through to
+  // the hasher, which must provide a matching overload.
+  template <typename U>
+  uint64_t operator()(const U& key) {
+    return static_cast<hasher_storage&>(*this)(key);
+  }
+  template <typename U>
+  uint64_t operator()(const U& key) const {
+    return static_cast<const hasher_storage&>(*this)(key);
+  }
 };
 template <typename key_type, typename value_type, typename key_equal>
 struct KeyOrValueEquality : functor_storage<bool, key_equal> {
@@ -142,6 +152,16 @@ struct KeyOrValueEquality : functor_storage<bool, key_equal> {
   bool operator()(const std::pair<FL, SL>& lhs, const std::pair<FR, SR>& rhs) {
     return static_cast<equality_storage&>(*this)(lhs.first, rhs.first);
   }
+  // Heterogeneous key types (see find_transparent) pass straight through to
+  // the equality functor, which must provide a matching overload.
+  template <typename U>
+  bool operator()(const U& lhs, const value_type& rhs) {
+    return static_cast<equality_storage&>(*this)(lhs, rhs.first);
+  }
+  template <typename U>
+  bool operator()(const value_type& lhs, const U& rhs) {
+    return static_cast<equality_storage&>(*this)(lhs.first, rhs);
+  }
 };
 static constexpr int8_t min_lookups = 4;
 template <typename T>
@@ -536,6 +556,25 @@ class sherwood_v3_table : private EntryAlloc, private Hasher, private Equal {
   const_iterator find(const FindKey& key) const {
     return const_cast<sherwood_v3_table*>(this)->find(key);
   }
+  // Probes with a key of a different type than FindKey, without converting
+  // it. The Hasher and Equal functors must provide overloads for OtherKey
+  // that are consistent with how FindKey hashes and compares.
+  template <typename OtherKey>
+  iterator find_transparent(const OtherKey& key) {
+    uint64_t index =
+        hash_policy.index_for_hash(hash_object(key), num_slots_minus_one);
+    EntryPointer it = entries + ptrdiff_t(index);
+    for (int8_t distance = 0; it->distance_from_desired >= distance;
+         ++distance, ++it) {
+      if (compares_equal(key, it->value))
+        return {it};
+    }
+    return end();
+  }
+  template <typename OtherKey>
+  const_iterator find_transparent(const OtherKey& key) const {
+    return const_cast<sherwood_v3_table*>(this)->find_transparent(key);
+  }
   uint64_t count(const FindKey& key) const {
     return find(key) == end() ? 0 : 1;
   }
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <cerrno>
@@ -19,6 +20,7 @@
 #include "caffe2/serialize/file_adapter.h"
 #include "caffe2/serialize/inline_container.h"
 #include "caffe2/serialize/istream_adapter.h"
+#include "caffe2/serialize/mmap_adapter.h"
 #include "caffe2/serialize/read_adapter_interface.h"
 
 #include "miniz.h"
@@ -70,7 +72,8 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
     : ar_(std::make_unique<mz_zip_archive>()),
-      in_(std::make_unique<FileAdapter>(file_name)) {
+      in_(std::make_unique<FileAdapter>(file_name)),
+      file_name_(file_name) {
   init();
 }
 
@@ -85,6 +88,7 @@ PyTorchStreamReader::PyTorchStreamReader(std::istream* in)
 PyTorchStreamReader::PyTorchStreamReader(
     std::shared_ptr<ReadAdapterInterface> in)
     : ar_(std::make_unique<mz_zip_archive>()), in_(std::move(in)) {
+  mmap_in_ = dynamic_cast<MmapAdapter*>(in_.get());
   init();
 }
 
@@ -268,12 +272,34 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
 }
 
 // return dataptr, size
+namespace {
+void delete_mmap_keepalive(void* ctx) {
+  delete static_cast<std::shared_ptr<ReadAdapterInterface>*>(ctx);
+}
+} // namespace
+
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
   std::lock_guard<std::mutex> guard(reader_lock_);
   size_t key = getRecordID(name);
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+  if (mmap_in_ != nullptr && stat.m_method == MZ_NO_COMPRESSION) {
+    size_t offset = getRecordOffsetUnlocked(key);
+    // PyTorchStreamWriter aligns tensor payloads to kFieldAlignment, so in
+    // practice every tensor record takes this path; records written without
+    // alignment (or by older producers) fall through to the copying path so
+    // downstream SIMD kernels never see a misaligned tensor.
+    if (offset % detail::kFieldAlignment == 0) {
+      auto* keepalive = new std::shared_ptr<ReadAdapterInterface>(in_);
+      at::DataPtr retval(
+          mmap_in_->data() + offset,
+          keepalive,
+          &delete_mmap_keepalive,
+          c10::DeviceType::CPU);
+      return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+    }
+  }
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
@@ -281,15 +307,286 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   return std::make_tuple(std::move(retval), stat.m_uncomp_size);
 }
 
+std::vector<std::tuple<at::DataPtr, size_t>> PyTorchStreamReader::getRecords(
+    const std::vector<std::string>& names) {
+  std::vector<std::tuple<at::DataPtr, size_t>> result(names.size());
+  // Stored (uncompressed) payloads are located and allocated under the lock,
+  // but their reads only need a positional file access, so they are deferred
+  // and executed on worker threads below. Compressed records go through the
+  // shared miniz inflate state and are extracted while the lock is held.
+  struct RawRead {
+    size_t result_index;
+    size_t offset;
+    size_t size;
+    uint32_t crc32;
+  };
+  std::vector<RawRead> raw_reads;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    for (size_t i = 0; i < names.size(); ++i) {
+      size_t key = getRecordID(names[i]);
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), key, &stat);
+      valid("retrieving file meta-data for ", names[i].c_str());
+      if (stat.m_method == MZ_NO_COMPRESSION) {
+        size_t offset = getRecordOffsetUnlocked(key);
+        if (mmap_in_ != nullptr && offset % detail::kFieldAlignment == 0) {
+          // same zero-copy path as getRecord()
+          auto* keepalive = new std::shared_ptr<ReadAdapterInterface>(in_);
+          at::DataPtr retval(
+              mmap_in_->data() + offset,
+              keepalive,
+              &delete_mmap_keepalive,
+              c10::DeviceType::CPU);
+          result[i] = std::make_tuple(std::move(retval), stat.m_uncomp_size);
+          continue;
+        }
+        result[i] = std::make_tuple(
+            c10::GetCPUAllocator()->allocate(stat.m_uncomp_size),
+            stat.m_uncomp_size);
+        raw_reads.push_back(RawRead{
+            i,
+            offset,
+            stat.m_uncomp_size,
+            static_cast<uint32_t>(stat.m_crc32)});
+      } else {
+        at::DataPtr retval =
+            c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
+        mz_zip_reader_extract_to_mem(
+            ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
+        valid("reading file ", names[i].c_str());
+        result[i] = std::make_tuple(std::move(retval), stat.m_uncomp_size);
+      }
+    }
+  }
+  if (raw_reads.empty()) {
+    return result;
+  }
+
+  // Every worker needs its own file handle: the reader's adapter is only
+  // safe for concurrent access when it is a memory mapping, otherwise
+  // additional FileAdapters are opened, which requires a file name. Readers
+  // wrapping a bare istream fall back to reading on the calling thread.
+  size_t num_threads = 1;
+  if (mmap_in_ != nullptr || !file_name_.empty()) {
+    num_threads = std::min<size_t>(
+        raw_reads.size(),
+        std::max<size_t>(1, std::thread::hardware_concurrency()));
+  }
+
+  std::atomic<size_t> next_read(0);
+  std::mutex error_mutex;
+  std::exception_ptr first_error;
+  auto work = [&](ReadAdapterInterface* adapter) {
+    try {
+      while (true) {
+        size_t idx = next_read.fetch_add(1);
+        if (idx >= raw_reads.size()) {
+          break;
+        }
+        const RawRead& r = raw_reads[idx];
+        char* dest =
+            static_cast<char*>(std::get<0>(result[r.result_index]).get());
+        size_t got =
+            adapter->read(r.offset, dest, r.size, "reading record payload");
+        TORCH_CHECK(
+            got == r.size,
+            "PytorchStreamReader failed reading record ",
+            names[r.result_index],
+            ": expected ",
+            r.size,
+            " bytes, got ",
+            got);
+        auto actual_crc32 = static_cast<uint32_t>(mz_crc32(
+            MZ_CRC32_INIT, reinterpret_cast<const mz_uint8*>(dest), r.size));
+        TORCH_CHECK(
+            actual_crc32 == r.crc32,
+            "PytorchStreamReader failed reading record ",
+            names[r.result_index],
+            ": CRC32 mismatch");
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(error_mutex);
+      if (!first_error) {
+        first_error = std::current_exception();
+      }
+      // make the remaining workers wind down
+      next_read = raw_reads.size();
+    }
+  };
+
+  // open all extra handles up front so a failing open cannot leave already
+  // spawned workers unjoined
+  std::vector<std::unique_ptr<FileAdapter>> extra_adapters;
+  if (mmap_in_ == nullptr) {
+    for (size_t t = 1; t < num_threads; ++t) {
+      extra_adapters.push_back(std::make_unique<FileAdapter>(file_name_));
+    }
+  }
+  std::vector<std::thread> workers;
+  for (size_t t = 1; t < num_threads; ++t) {
+    ReadAdapterInterface* adapter =
+        mmap_in_ != nullptr ? in_.get() : extra_adapters[t - 1].get();
+    workers.emplace_back(work, adapter);
+  }
+  {
+    // the calling thread participates with the reader's own adapter; hold
+    // the lock so this does not race with concurrent getRecord() calls
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    work(in_.get());
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+  return result;
+}
+
+// See the doc comment in the header. The calling thread runs the visitor
+// while a prefetch thread stays up to `prefetch_window_bytes` of payload
+// ahead of it; both the read order (ascending local-header offset, i.e. the
+// writer's emission order) and the bounded window are what make this usable
+// on adapters backed by a forward-only transfer.
+void PyTorchStreamReader::visitRecords(
+    const std::function<
+        void(const std::string& name, at::DataPtr data, size_t size)>& visitor,
+    size_t prefetch_window_bytes) {
+  struct RecordInfo {
+    size_t key;
+    std::string name;
+    uint64_t header_offset;
+    size_t size;
+  };
+  std::vector<RecordInfo> records;
+  {
+    std::lock_guard<std::mutex> guard(reader_lock_);
+    mz_uint num_files = mz_zip_reader_get_num_files(ar_.get());
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    char buf[MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE];
+    for (size_t i = 0; i < num_files; i++) {
+      mz_zip_reader_get_filename(
+          ar_.get(), i, buf, MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE);
+      if (strncmp(
+              buf,
+              archive_name_plus_slash_.data(),
+              archive_name_plus_slash_.size()) != 0) {
+        CAFFE_THROW(
+            "file in archive is not in a subdirectory ",
+            archive_name_plus_slash_,
+            ": ",
+            buf);
+      }
+      mz_zip_archive_file_stat stat;
+      mz_zip_reader_file_stat(ar_.get(), i, &stat);
+      valid("retrieving file meta-data for ", buf);
+      records.push_back(RecordInfo{
+          i,
+          std::string(buf + archive_name_plus_slash_.size()),
+          stat.m_local_header_ofs,
+          static_cast<size_t>(stat.m_uncomp_size)});
+    }
+  }
+  std::sort(
+      records.begin(),
+      records.end(),
+      [](const RecordInfo& a, const RecordInfo& b) {
+        return a.header_offset < b.header_offset;
+      });
+
+  struct Prefetched {
+    std::string name;
+    at::DataPtr data;
+    size_t size;
+  };
+  std::mutex queue_mutex;
+  std::condition_variable queue_cv;
+  std::deque<Prefetched> queue;
+  size_t queued_bytes = 0;
+  bool producer_done = false;
+  bool consumer_stopped = false;
+  std::exception_ptr producer_error;
+
+  std::thread prefetcher([&] {
+    try {
+      for (const RecordInfo& r : records) {
+        {
+          std::unique_lock<std::mutex> lock(queue_mutex);
+          // An empty queue always admits the next record so a payload
+          // larger than the window cannot deadlock the pipeline.
+          queue_cv.wait(lock, [&] {
+            return consumer_stopped || queue.empty() ||
+                queued_bytes + r.size <= prefetch_window_bytes;
+          });
+          if (consumer_stopped) {
+            break;
+          }
+        }
+        at::DataPtr data = c10::GetCPUAllocator()->allocate(r.size);
+        {
+          std::lock_guard<std::mutex> guard(reader_lock_);
+          mz_zip_reader_extract_to_mem(
+              ar_.get(), r.key, data.get(), r.size, 0);
+          valid("reading file ", r.name.c_str());
+        }
+        {
+          std::lock_guard<std::mutex> lock(queue_mutex);
+          queued_bytes += r.size;
+          queue.push_back(Prefetched{r.name, std::move(data), r.size});
+        }
+        queue_cv.notify_all();
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      producer_error = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      producer_done = true;
+    }
+    queue_cv.notify_all();
+  });
+
+  try {
+    while (true) {
+      Prefetched item;
+      {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        queue_cv.wait(lock, [&] { return !queue.empty() || producer_done; });
+        if (queue.empty()) {
+          break;
+        }
+        item = std::move(queue.front());
+        queue.pop_front();
+        queued_bytes -= item.size;
+      }
+      queue_cv.notify_all();
+      visitor(item.name, std::move(item.data), item.size);
+    }
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex);
+      consumer_stopped = true;
+    }
+    queue_cv.notify_all();
+    prefetcher.join();
+    throw;
+  }
+  prefetcher.join();
+  if (producer_error) {
+    std::rethrow_exception(producer_error);
+  }
+}
+
 static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
+size_t PyTorchStreamReader::getRecordOffsetUnlocked(size_t record_id) {
   mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+  mz_zip_reader_file_stat(ar_.get(), record_id, &stat);
+  valid("retrieving file meta-data for record ");
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
@@ -302,6 +599,11 @@ size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
   return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
 }
 
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  return getRecordOffsetUnlocked(getRecordID(name));
+}
+
 
 PyTorchStreamReader::~PyTorchStreamReader() {
   mz_zip_clear_last_error(ar_.get());
@@ -377,15 +679,110 @@ void PyTorchStreamWriter::setMinVersion(const uint64_t version) {
   version_ = std::max(version, version_);
 }
 
+// Upper bound on the payload bytes buffered by asynchronous writes before
+// record submission blocks, to keep checkpointing from doubling peak memory.
+constexpr size_t kMaxPendingWriteBytes = 256 * 1024 * 1024;
+
+void PyTorchStreamWriter::setAsyncWrites(bool async_writes) {
+  AT_ASSERT(!finalized_);
+  if (async_writes && !write_thread_.joinable()) {
+    write_thread_ = std::thread([this]() { writeThreadLoop(); });
+  }
+  if (!async_writes) {
+    waitForAsyncWrites();
+  }
+  async_writes_ = async_writes;
+}
+
+void PyTorchStreamWriter::writeThreadLoop() {
+  std::unique_lock<std::mutex> lock(write_mutex_);
+  while (true) {
+    write_cv_.wait(lock, [this] {
+      return write_thread_stop_ || !pending_records_.empty();
+    });
+    if (pending_records_.empty()) {
+      return;
+    }
+    PendingRecord record = std::move(pending_records_.front());
+    pending_records_.pop_front();
+    write_in_flight_ = true;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      writeRecordImpl(
+          record.name, record.data.data(), record.data.size(), record.compress);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    write_in_flight_ = false;
+    pending_write_bytes_ -= record.data.size();
+    if (error) {
+      // Drop whatever is still queued; the error is rethrown to the
+      // submitting thread on its next call into the writer.
+      write_error_ = error;
+      for (const auto& pending : pending_records_) {
+        pending_write_bytes_ -= pending.data.size();
+      }
+      pending_records_.clear();
+    }
+    write_done_cv_.notify_all();
+  }
+}
+
+void PyTorchStreamWriter::waitForAsyncWrites() {
+  if (!write_thread_.joinable()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(write_mutex_);
+  write_done_cv_.wait(
+      lock, [this] { return pending_records_.empty() && !write_in_flight_; });
+  if (write_error_) {
+    auto error = write_error_;
+    write_error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
 void PyTorchStreamWriter::writeRecord(
     const std::string& name,
     const void* data,
     size_t size,
     bool compress) {
   AT_ASSERT(!finalized_);
-  AT_ASSERT(!archive_name_plus_slash_.empty());
   TORCH_INTERNAL_ASSERT(
       files_written_.count(name) == 0, "Tried to serialize file twice: ", name);
+  files_written_.insert(name);
+  if (async_writes_) {
+    std::unique_lock<std::mutex> lock(write_mutex_);
+    if (write_error_) {
+      auto error = write_error_;
+      write_error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+    // Bound the memory held by queued payload copies; a single record larger
+    // than the bound is admitted once the queue drains.
+    write_done_cv_.wait(lock, [&] {
+      return pending_records_.empty() ||
+          pending_write_bytes_ + size <= kMaxPendingWriteBytes;
+    });
+    pending_write_bytes_ += size;
+    pending_records_.push_back(PendingRecord{
+        name, std::string(static_cast<const char*>(data), size), compress});
+    write_cv_.notify_one();
+    return;
+  }
+  writeRecordImpl(name, data, size, compress);
+}
+
+void PyTorchStreamWriter::writeRecordImpl(
+    const std::string& name,
+    const void* data,
+    size_t size,
+    bool compress) {
+  AT_ASSERT(!archive_name_plus_slash_.empty());
   std::string full_name = archive_name_plus_slash_ + name;
   size_t padding_size =
       detail::getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
@@ -406,10 +803,14 @@ void PyTorchStreamWriter::writeRecord(
       nullptr,
       0);
   valid("writing file ", name.c_str());
-  files_written_.insert(name);
 }
 
 void PyTorchStreamWriter::writeEndOfFile() {
+  // Drain any outstanding asynchronous writes before the version record and
+  // the central directory are written; both go through the synchronous path.
+  waitForAsyncWrites();
+  async_writes_ = false;
+
   auto allRecords = getAllWrittenRecords();
   // If no ".data/version" or "version" record in the output model, rewrites version info
   if(allRecords.find(".data/version") == allRecords.end() && allRecords.find("version") == allRecords.end()) {
@@ -453,6 +854,14 @@ PyTorchStreamWriter::~PyTorchStreamWriter() {
   if (!finalized_) {
     writeEndOfFile();
   }
+  if (write_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(write_mutex_);
+      write_thread_stop_ = true;
+    }
+    write_cv_.notify_one();
+    write_thread_.join();
+  }
 }
 
 } // namespace serialize
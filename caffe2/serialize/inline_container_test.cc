@@ -1,10 +1,12 @@
 #include <cstdio>
 #include <string>
 #include <array>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "caffe2/serialize/inline_container.h"
+#include "caffe2/serialize/mmap_adapter.h"
 #include "c10/util/irange.h"
 
 namespace caffe2 {
@@ -74,6 +76,55 @@ TEST(PyTorchStreamWriterAndReader, SaveAndLoad) {
   ASSERT_EQ(memcmp(the_file.c_str() + off2, data2.data(), data2.size()), 0);
 }
 
+TEST(PyTorchStreamWriterAndReader, AsyncWritesSaveAndLoad) {
+  std::ostringstream oss;
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+  writer.setAsyncWrites(true);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,cppcoreguidelines-avoid-magic-numbers)
+  std::array<char, 127> data1;
+  for (auto i : c10::irange(data1.size())) {
+    data1[i] = data1.size() - i;
+  }
+  writer.writeRecord("key1", data1.data(), data1.size());
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,cppcoreguidelines-avoid-magic-numbers)
+  std::array<char, 64> data2;
+  for (auto i : c10::irange(data2.size())) {
+    data2[i] = data2.size() - i;
+  }
+  // compressed record mixed in with the uncompressed ones
+  writer.writeRecord("key2", data2.data(), data2.size(), /*compress=*/true);
+
+  const std::unordered_set<std::string>& written_records =
+      writer.getAllWrittenRecords();
+  ASSERT_EQ(written_records.size(), 2);
+  ASSERT_EQ(written_records.count("key1"), 1);
+  ASSERT_EQ(written_records.count("key2"), 1);
+
+  writer.writeEndOfFile();
+
+  std::string the_file = oss.str();
+  std::istringstream iss(the_file);
+
+  PyTorchStreamReader reader(&iss);
+  ASSERT_TRUE(reader.hasRecord("key1"));
+  ASSERT_TRUE(reader.hasRecord("key2"));
+  at::DataPtr data_ptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t size;
+  std::tie(data_ptr, size) = reader.getRecord("key1");
+  ASSERT_EQ(size, data1.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), data1.data(), data1.size()), 0);
+
+  std::tie(data_ptr, size) = reader.getRecord("key2");
+  ASSERT_EQ(size, data2.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), data2.data(), data2.size()), 0);
+}
+
 TEST(PytorchStreamWriterAndReader, GetNonexistentRecordThrows) {
   std::ostringstream oss;
   // write records through writers
@@ -120,6 +171,156 @@ TEST(PytorchStreamWriterAndReader, GetNonexistentRecordThrows) {
   EXPECT_TRUE(reader.hasRecord("key1"));
 }
 
+
+#ifndef _WIN32
+TEST(PyTorchStreamWriterAndReader, MmapAdapterZeroCopyRead) {
+  std::string file_name = std::tmpnam(nullptr);
+  PyTorchStreamWriter writer(file_name);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,cppcoreguidelines-avoid-magic-numbers)
+  std::array<char, 256> data;
+  for (auto i : c10::irange(data.size())) {
+    data[i] = static_cast<char>(i);
+  }
+  writer.writeRecord("tensor_payload", data.data(), data.size());
+  writer.writeEndOfFile();
+
+  auto adapter = std::make_shared<MmapAdapter>(file_name);
+  uint8_t* mapping_start = adapter->data();
+  uint8_t* mapping_end = mapping_start + adapter->size();
+  PyTorchStreamReader reader(adapter);
+
+  at::DataPtr data_ptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t size;
+  std::tie(data_ptr, size) = reader.getRecord("tensor_payload");
+  ASSERT_EQ(size, data.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), data.data(), data.size()), 0);
+  // The payload must alias the mapping (zero-copy), 64-byte aligned.
+  uint8_t* payload = static_cast<uint8_t*>(data_ptr.get());
+  EXPECT_GE(payload, mapping_start);
+  EXPECT_LT(payload, mapping_end);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(payload) % 64, 0);
+  // Copy-on-write: writing through the DataPtr must not corrupt the file.
+  payload[0] = 42;
+  auto adapter2 = std::make_shared<MmapAdapter>(file_name);
+  PyTorchStreamReader reader2(adapter2);
+  std::tie(data_ptr, size) = reader2.getRecord("tensor_payload");
+  EXPECT_EQ(static_cast<uint8_t*>(data_ptr.get())[0], 0);
+  remove(file_name.c_str());
+}
+#endif // _WIN32
+
+TEST(PyTorchStreamWriterAndReader, GetRecordsBatchedRead) {
+  std::string file_name = std::tmpnam(nullptr);
+  PyTorchStreamWriter writer(file_name);
+  constexpr size_t kNumRecords = 16;
+  std::vector<std::string> names;
+  std::vector<std::vector<char>> payloads;
+  for (const auto i : c10::irange(kNumRecords)) {
+    std::vector<char> payload(777 + 13 * i);
+    for (const auto j : c10::irange(payload.size())) {
+      payload[j] = static_cast<char>(i + j);
+    }
+    names.push_back("record" + c10::to_string(i));
+    // mix in a compressed record to exercise the locked extract path
+    writer.writeRecord(
+        names.back(), payload.data(), payload.size(), /*compress=*/i == 3);
+    payloads.push_back(std::move(payload));
+  }
+  writer.writeEndOfFile();
+
+  // file-backed reader: stored records are read on worker threads
+  PyTorchStreamReader reader(file_name);
+  auto records = reader.getRecords(names);
+  ASSERT_EQ(records.size(), kNumRecords);
+  for (const auto i : c10::irange(kNumRecords)) {
+    ASSERT_EQ(std::get<1>(records[i]), payloads[i].size());
+    ASSERT_EQ(
+        memcmp(
+            std::get<0>(records[i]).get(),
+            payloads[i].data(),
+            payloads[i].size()),
+        0);
+  }
+
+  // istream-backed reader: same results through the sequential fallback
+  std::ifstream in_file(file_name, std::ios::binary);
+  PyTorchStreamReader stream_reader(&in_file);
+  auto stream_records = stream_reader.getRecords(names);
+  ASSERT_EQ(stream_records.size(), kNumRecords);
+  for (const auto i : c10::irange(kNumRecords)) {
+    ASSERT_EQ(std::get<1>(stream_records[i]), payloads[i].size());
+    ASSERT_EQ(
+        memcmp(
+            std::get<0>(stream_records[i]).get(),
+            payloads[i].data(),
+            payloads[i].size()),
+        0);
+  }
+  in_file.close();
+  remove(file_name.c_str());
+}
+
+TEST(PyTorchStreamWriterAndReader, VisitRecordsStreamingRead) {
+  std::string file_name = std::tmpnam(nullptr);
+  PyTorchStreamWriter writer(file_name);
+  constexpr size_t kNumRecords = 8;
+  std::vector<std::string> names;
+  std::vector<std::vector<char>> payloads;
+  for (const auto i : c10::irange(kNumRecords)) {
+    std::vector<char> payload(501 + 7 * i);
+    for (const auto j : c10::irange(payload.size())) {
+      payload[j] = static_cast<char>(i * 3 + j);
+    }
+    names.push_back("record" + c10::to_string(i));
+    // mix in a compressed record; it is inflated on the prefetch thread
+    writer.writeRecord(
+        names.back(), payload.data(), payload.size(), /*compress=*/i == 5);
+    payloads.push_back(std::move(payload));
+  }
+  writer.writeEndOfFile();
+
+  PyTorchStreamReader reader(file_name);
+  std::vector<std::string> visited_names;
+  std::vector<std::vector<char>> visited_payloads;
+  // a tiny window forces the prefetcher and the visitor to hand off record
+  // by record instead of buffering the whole archive
+  reader.visitRecords(
+      [&](const std::string& name, at::DataPtr data, size_t size) {
+        visited_names.push_back(name);
+        const char* bytes = static_cast<const char*>(data.get());
+        visited_payloads.emplace_back(bytes, bytes + size);
+      },
+      /*prefetch_window_bytes=*/1);
+
+  // records arrive in write order, with the version record the writer
+  // appends at the end
+  ASSERT_EQ(visited_names.size(), kNumRecords + 1);
+  for (const auto i : c10::irange(kNumRecords)) {
+    ASSERT_EQ(visited_names[i], names[i]);
+    ASSERT_EQ(visited_payloads[i].size(), payloads[i].size());
+    ASSERT_EQ(
+        memcmp(
+            visited_payloads[i].data(),
+            payloads[i].data(),
+            payloads[i].size()),
+        0);
+  }
+
+  // a throwing visitor stops the iteration and surfaces on the caller
+  size_t visits_before_throw = 0;
+  ASSERT_THROW(
+      reader.visitRecords(
+          [&](const std::string&, at::DataPtr, size_t) {
+            ++visits_before_throw;
+            throw std::runtime_error("stop");
+          }),
+      std::runtime_error);
+  ASSERT_EQ(visits_before_throw, 1);
+
+  remove(file_name.c_str());
+}
+
 } // namespace
 } // namespace serialize
 } // namespace caffe2
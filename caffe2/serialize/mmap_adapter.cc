@@ -0,0 +1,91 @@
+#include "caffe2/serialize/mmap_adapter.h"
+
+#include <c10/util/Exception.h>
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace caffe2 {
+namespace serialize {
+
+#ifndef _WIN32
+
+MmapAdapter::MmapAdapter(const std::string& file_name) {
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  TORCH_CHECK(
+      fd != -1,
+      "open file failed because of errno ",
+      errno,
+      ": ",
+      strerror(errno),
+      ", file path: ",
+      file_name);
+  struct stat st {};
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    TORCH_CHECK(false, "fstat failed for file: ", file_name);
+  }
+  size_ = st.st_size;
+  // MAP_PRIVATE gives copy-on-write semantics: tensors loaded out of the
+  // mapping may be mutated in place without affecting the file, and pages
+  // stay shared with other processes until first write.
+  void* mapping =
+      mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  TORCH_CHECK(
+      mapping != MAP_FAILED,
+      "mmap failed because of errno ",
+      errno,
+      ": ",
+      strerror(errno),
+      ", file path: ",
+      file_name);
+  data_ = static_cast<uint8_t*>(mapping);
+}
+
+MmapAdapter::~MmapAdapter() {
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+}
+
+bool MmapAdapter::isSupported() {
+  return true;
+}
+
+#else // _WIN32
+
+MmapAdapter::MmapAdapter(const std::string& file_name) {
+  TORCH_CHECK(false, "mmap model loading is not supported on this platform");
+}
+
+MmapAdapter::~MmapAdapter() = default;
+
+bool MmapAdapter::isSupported() {
+  return false;
+}
+
+#endif // _WIN32
+
+size_t MmapAdapter::size() const {
+  return size_;
+}
+
+size_t MmapAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
+    const {
+  // Clamp like FileAdapter: reads past the end return the available bytes.
+  pos = std::min(pos, size_);
+  n = std::min(static_cast<size_t>(size_ - pos), n);
+  std::memcpy(buf, data_ + pos, n);
+  return n;
+}
+
+} // namespace serialize
+} // namespace caffe2
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <c10/macros/Macros.h>
+
+#include "caffe2/serialize/read_adapter_interface.h"
+
+namespace caffe2 {
+namespace serialize {
+
+// An adapter backed by a private, copy-on-write memory mapping of the model
+// file. In addition to the ReadAdapterInterface contract (reads are served by
+// memcpy from the mapping), it exposes the mapping itself so that
+// PyTorchStreamReader can hand out record payloads that alias the mapped
+// pages directly: uncompressed, suitably aligned tensor records then require
+// neither a read nor an allocation at load time, and clean pages are shared
+// through the page cache across worker processes. In-place writes to such
+// tensors fault in private copies of only the touched pages.
+//
+// Only available on POSIX platforms; the constructor throws elsewhere.
+class TORCH_API MmapAdapter final : public ReadAdapterInterface {
+ public:
+  C10_DISABLE_COPY_AND_ASSIGN(MmapAdapter);
+  explicit MmapAdapter(const std::string& file_name);
+  size_t size() const override;
+  size_t read(uint64_t pos, void* buf, size_t n, const char* what = "")
+      const override;
+  ~MmapAdapter() override;
+
+  // Base address of the file mapping; valid over [0, size()).
+  uint8_t* data() const {
+    return data_;
+  }
+
+  // True when mmap loading is supported on this platform.
+  static bool isSupported();
+
+ private:
+  uint8_t* data_ = nullptr;
+  uint64_t size_ = 0;
+};
+
+} // namespace serialize
+} // namespace caffe2
@@ -258,6 +258,16 @@ if(INTERN_BUILD_ATEN_OPS)
     endif(MSVC)
   endif(CXX_AVX512_FOUND)
 
+  if(CXX_AVX512VNNI_FOUND)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX512VNNI_CPU_DEFINITION")
+    list(APPEND CPU_CAPABILITY_NAMES "AVX512VNNI")
+    if(MSVC)
+      list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG}/arch:AVX512")
+    else(MSVC)
+      list(APPEND CPU_CAPABILITY_FLAGS "${OPT_FLAG} -mavx512f -mavx512bw -mavx512vl -mavx512dq -mavx512vnni -mfma")
+    endif(MSVC)
+  endif(CXX_AVX512VNNI_FOUND)
+
   if(CXX_AVX2_FOUND)
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -DHAVE_AVX2_CPU_DEFINITION")
 
@@ -320,6 +330,15 @@ if(INTERN_BUILD_ATEN_OPS)
       else(MSVC)
         set(EXTRA_FLAGS "-DCPU_CAPABILITY=${CPU_CAPABILITY} -DCPU_CAPABILITY_${CPU_CAPABILITY}")
       endif(MSVC)
+      if("${CPU_CAPABILITY}" STREQUAL "AVX512VNNI")
+        # The VNNI variant is AVX512 plus the dot-product instructions, so it
+        # compiles with the AVX512 code paths (Vectorized<>, etc.) enabled.
+        if(MSVC)
+          set(EXTRA_FLAGS "${EXTRA_FLAGS} /DCPU_CAPABILITY_AVX512")
+        else(MSVC)
+          set(EXTRA_FLAGS "${EXTRA_FLAGS} -DCPU_CAPABILITY_AVX512")
+        endif(MSVC)
+      endif()
       # Disable certain warnings for GCC-9.X
       if(CMAKE_COMPILER_IS_GNUCXX AND (CMAKE_CXX_COMPILER_VERSION VERSION_GREATER 9.0.0))
         if(("${NAME}" STREQUAL "native/cpu/GridSamplerKernel.cpp") AND ("${CPU_CAPABILITY}" STREQUAL "DEFAULT"))
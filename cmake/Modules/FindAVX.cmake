@@ -31,6 +31,19 @@ SET(AVX512_CODE "
   }
 ")
 
+SET(AVX512VNNI_CODE "
+  #include <immintrin.h>
+
+  int main()
+  {
+    __m512i a = _mm512_set1_epi8(1);
+    __m512i b = _mm512_set1_epi8(-1);
+    __m512i acc = _mm512_setzero_si512();
+    acc = _mm512_dpbusd_epi32(acc, a, b);
+    return _mm512_reduce_add_epi32(acc) == -64 ? 0 : 1;
+  }
+")
+
 SET(AVX2_CODE "
   #include <immintrin.h>
 
@@ -76,7 +89,9 @@ ENDMACRO()
 CHECK_SSE(C "AVX" " ;-mavx;/arch:AVX")
 CHECK_SSE(C "AVX2" " ;-mavx2 -mfma;/arch:AVX2")
 CHECK_SSE(C "AVX512" " ;-mavx512f -mavx512dq -mavx512vl -mavx512bw -mfma;/arch:AVX512")
+CHECK_SSE(C "AVX512VNNI" " ;-mavx512f -mavx512dq -mavx512vl -mavx512bw -mavx512vnni -mfma;/arch:AVX512")
 
 CHECK_SSE(CXX "AVX" " ;-mavx;/arch:AVX")
 CHECK_SSE(CXX "AVX2" " ;-mavx2 -mfma;/arch:AVX2")
 CHECK_SSE(CXX "AVX512" " ;-mavx512f -mavx512dq -mavx512vl -mavx512bw -mfma;/arch:AVX512")
+CHECK_SSE(CXX "AVX512VNNI" " ;-mavx512f -mavx512dq -mavx512vl -mavx512bw -mavx512vnni -mfma;/arch:AVX512")
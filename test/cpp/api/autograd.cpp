@@ -8,6 +8,8 @@
 
 #include <test/cpp/api/support.h>
 
+#include <thread>
+
 using namespace torch::autograd;
 using namespace torch::test;
 
@@ -237,6 +239,39 @@ TEST(AutogradAPITests, AnomalyMode) {
   }
 }
 
+TEST(AutogradAPITests, SavedVariableTrimming) {
+  // See Note [Trimmed saved variables]
+  {
+    torch::autograd::SavedVariableTrimmingGuard trim;
+    auto x = torch::tensor({5.0}, torch::requires_grad());
+    auto y = x * x;
+    auto z = y * y;
+    z.backward();
+    ASSERT_VARIABLE_EQ(x.grad(), x * x * x * 4);
+    // Double backward is still detected: it relies on the saved data being
+    // released, not on version counters.
+    ASSERT_THROWS_WITH(z.backward(), "second time");
+  }
+  {
+    // Trimmed saved variables skip the version check, so an in-place
+    // modification of a saved tensor goes undetected.
+    torch::autograd::SavedVariableTrimmingGuard trim;
+    auto x = torch::tensor({5.0}, torch::requires_grad());
+    auto y = x * x;
+    auto z = y * y;
+    y += 1;
+    z.backward();
+  }
+  {
+    // The guard is scoped: graphs built afterwards check versions again.
+    auto x = torch::tensor({5.0}, torch::requires_grad());
+    auto y = x * x;
+    auto z = y * y;
+    y += 1;
+    ASSERT_THROWS_WITH(z.backward(), "inplace");
+  }
+}
+
 TEST(CustomAutogradTest, CustomFunction) {
   struct MyFunction : public Function<MyFunction> {
     static Variable forward(AutogradContext *ctx, Variable var1, int mul, Variable var2) {
@@ -1209,6 +1244,25 @@ TEST(TestAutogradNotImplementedFallback, TensorlistOp) {
 
 #endif
 
+TEST(CustomAutogradTest, GraphAllocationAcrossThreads) {
+  // Autograd nodes are allocated on forward threads and freed by the
+  // engine's backward threads; hammer that pattern from several threads to
+  // exercise the cross-thread free path of the node allocation pool.
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 50; ++i) {
+        auto x = torch::randn({2, 2}, torch::requires_grad());
+        auto y = (x * 2 + x.exp()).sum();
+        y.backward();
+        ASSERT_TRUE(x.grad().defined());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
 
 // TODO add these tests if needed
 // test_once_differentiable
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <future>
 #include <iostream>
 #include <iterator>
@@ -454,6 +455,62 @@ TEST(DataTest, TensorDatasetConstructsFromInitializerListOfTensors) {
       torch::tensor({0, 0, 1, 0, 0}, torch::kFloat32).allclose(dataset.get(2)));
 }
 
+TEST(DataTest, CSVDatasetParsesFileIntoCollatedBatches) {
+  auto tempfile = c10::make_tempfile();
+  {
+    std::ofstream stream(tempfile.name);
+    stream << "feature_a,feature_b,label\n";
+    stream << "1,2,0\n";
+    stream << "3,4,1\r\n"; // CRLF line endings are accepted.
+    stream << "5.5,6.25,0\n";
+    stream << "7,8,1\n";
+  }
+  datasets::CSVDataset dataset(
+      tempfile.name,
+      datasets::CSVDatasetOptions()
+          .skip_header(true)
+          .target_column(2)
+          .target_dtype(torch::kLong));
+  ASSERT_EQ(dataset.size().value(), 4);
+
+  auto batch = dataset.get_batch({0, 2});
+  ASSERT_TRUE(
+      batch.data.allclose(torch::tensor({{1.f, 2.f}, {5.5f, 6.25f}})));
+  ASSERT_TRUE(batch.target.equal(torch::tensor({0, 1}, torch::kLong)));
+}
+
+TEST(DataTest, CSVDatasetSupportsCustomDelimiterAndNoTarget) {
+  auto tempfile = c10::make_tempfile();
+  {
+    std::ofstream stream(tempfile.name);
+    stream << "1;2;3\n";
+    stream << "4;5;6\n";
+  }
+  datasets::CSVDataset dataset(
+      tempfile.name, datasets::CSVDatasetOptions().delimiter(';'));
+  ASSERT_EQ(dataset.size().value(), 2);
+  ASSERT_FALSE(dataset.targets().defined());
+
+  auto batch = dataset.get_batch({1});
+  ASSERT_TRUE(batch.data.allclose(torch::tensor({{4.f, 5.f, 6.f}})));
+  ASSERT_FALSE(batch.target.defined());
+}
+
+TEST(DataTest, CSVDatasetThrowsOnMalformedRows) {
+  {
+    auto tempfile = c10::make_tempfile();
+    std::ofstream(tempfile.name) << "1,2\n3,oops\n";
+    ASSERT_THROWS_WITH(
+        datasets::CSVDataset{tempfile.name}, "Malformed numeric field");
+  }
+  {
+    auto tempfile = c10::make_tempfile();
+    std::ofstream(tempfile.name) << "1,2\n3,4,5\n";
+    ASSERT_THROWS_WITH(
+        datasets::CSVDataset{tempfile.name}, "Expected 2 columns in row 1");
+  }
+}
+
 TEST(DataTest, StackTransformWorksForExample) {
   struct D : public datasets::Dataset<D> {
     Example<> get(size_t index) override {
@@ -1036,6 +1093,21 @@ TEST(DataLoaderTest, DataLoaderOptionsDefaultAsExpected) {
   ASSERT_EQ(full_options.max_jobs, 0);
   ASSERT_FALSE(full_options.timeout.has_value());
   ASSERT_TRUE(full_options.enforce_ordering);
+  ASSERT_FALSE(full_options.pin_memory);
+}
+
+TEST(DataLoaderTest, PinMemoryProducesPinnedBatches_CUDA) {
+  auto dataset = datasets::TensorDataset(torch::eye(4));
+  auto data_loader = torch::data::make_data_loader(
+      dataset, DataLoaderOptions().batch_size(2).pin_memory(true));
+  size_t batch_count = 0;
+  for (auto& batch : *data_loader) {
+    for (auto& example : batch) {
+      ASSERT_TRUE(example.data.is_pinned());
+    }
+    ++batch_count;
+  }
+  ASSERT_EQ(batch_count, 2);
 }
 
 TEST(DataLoaderTest, DataLoaderOptionsCoalesceOptionalValues) {
@@ -1172,6 +1244,40 @@ TEST(DataLoaderTest, CanUseIteratorAlgorithms) {
   ASSERT_EQ(values, expected);
 }
 
+TEST(DataLoaderTest, DevicePrefetcherYieldsAllBatchesInOrder) {
+  DummyDataset dataset;
+  auto data_loader =
+      torch::data::make_data_loader<torch::data::samplers::SequentialSampler>(
+          dataset, 25);
+  auto prefetcher = torch::data::make_device_prefetcher(
+      *data_loader, torch::Device(torch::kCPU), /*depth=*/2);
+  std::vector<int> values;
+  for (auto& batch : *prefetcher) {
+    values.insert(values.end(), batch.begin(), batch.end());
+  }
+  std::vector<int> expected(dataset.size().value());
+  std::iota(expected.begin(), expected.end(), size_t(1));
+  ASSERT_EQ(values, expected);
+}
+
+TEST(DataLoaderTest, DevicePrefetcherPropagatesExceptions) {
+  struct T : datasets::Dataset<T, int> {
+    int get(size_t index) override {
+      throw std::invalid_argument("badness");
+    }
+    torch::optional<size_t> size() const override {
+      return 10;
+    }
+  };
+
+  T dataset;
+  auto data_loader = torch::data::make_data_loader(dataset, 5);
+  auto prefetcher = torch::data::make_device_prefetcher(
+      *data_loader, torch::Device(torch::kCPU));
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  ASSERT_THROW(*prefetcher->begin(), WorkerException);
+}
+
 TEST(DataLoaderTest, CallingBeginWhileOtherIteratorIsInFlightThrows) {
   DummyDataset dataset;
   auto data_loader =
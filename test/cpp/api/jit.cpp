@@ -125,3 +125,24 @@ TEST(TorchScriptTest, TestPickle) {
   double eps = 0.0001;
   ASSERT_TRUE(diff < eps && diff > -eps);
 }
+
+TEST(TorchScriptTest, TestCompileCacheSharesGraphs) {
+  const std::string source = R"JIT(
+      def cached_add(a, b):
+        return a + b
+    )JIT";
+  auto first = torch::jit::compile(source);
+  auto second = torch::jit::compile(source);
+
+  // Distinct units, so each caller optimizes and specializes privately.
+  ASSERT_NE(first, second);
+  // But the parsed graph is compiled once and shared copy-on-write.
+  ASSERT_EQ(
+      torch::jit::toGraphFunction(first->get_function("cached_add")).graph(),
+      torch::jit::toGraphFunction(second->get_function("cached_add")).graph());
+
+  auto a = torch::ones(1);
+  auto b = torch::ones(1);
+  ASSERT_EQ(2, first->run_method("cached_add", a, b).toTensor().item<int64_t>());
+  ASSERT_EQ(2, second->run_method("cached_add", a, b).toTensor().item<int64_t>());
+}
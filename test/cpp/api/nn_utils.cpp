@@ -361,6 +361,62 @@ TEST_F(NNUtilsTest, ConvertParameters) {
   }
 }
 
+TEST_F(NNUtilsTest, FlatGradView) {
+  std::vector<torch::Tensor> parameters{
+    torch::randn({3, 3}, torch::requires_grad()),
+    torch::randn({5}, torch::requires_grad()),
+    torch::randn({2, 2, 2}, torch::requires_grad())
+  };
+  // A pre-existing grad must be carried into the flat buffer.
+  parameters[0].mutable_grad() = torch::ones({3, 3});
+
+  utils::FlatGradView flat_view(parameters);
+
+  ASSERT_EQ(flat_view.flat_gradients().numel(), 22);
+  ASSERT_TRUE(parameters[0].grad().allclose(torch::ones({3, 3})));
+
+  // Every grad aliases the flat buffer, so backward writes land in it.
+  for (const auto& param : parameters) {
+    ASSERT_TRUE(param.grad().defined());
+    ASSERT_TRUE(param.grad().is_alias_of(flat_view.flat_gradients()));
+  }
+
+  flat_view.zero_();
+  auto loss = torch::stack({
+      parameters[0].sum(), parameters[1].sum(), parameters[2].sum()}).sum();
+  loss.backward();
+  for (const auto& param : parameters) {
+    ASSERT_TRUE(param.grad().allclose(torch::ones_like(param)));
+  }
+
+  // Norm over the flat buffer matches the per-parameter computation.
+  auto expected_norm = torch::stack({
+      parameters[0].grad().norm(2.0),
+      parameters[1].grad().norm(2.0),
+      parameters[2].grad().norm(2.0)}).norm(2.0);
+  ASSERT_TRUE(flat_view.norm(2.0).allclose(expected_norm));
+
+  // Unscaling multiplies in place and leaves found_inf untouched for finite
+  // gradients.
+  auto found_inf = torch::zeros({1});
+  auto inv_scale = torch::full({1}, 0.5);
+  flat_view.unscale_(found_inf, inv_scale);
+  ASSERT_EQ(found_inf.item<float>(), 0.f);
+  for (const auto& param : parameters) {
+    ASSERT_TRUE(param.grad().allclose(torch::ones_like(param) * 0.5));
+  }
+
+  // An inf anywhere must be reported through found_inf.
+  parameters[1].grad()[0] = std::numeric_limits<float>::infinity();
+  flat_view.unscale_(found_inf, inv_scale);
+  ASSERT_EQ(found_inf.item<float>(), 1.f);
+
+  flat_view.zero_();
+  for (const auto& param : parameters) {
+    ASSERT_EQ(param.grad().abs().sum().item<float>(), 0.f);
+  }
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-avoid-non-const-global-variables)
 int64_t PackedSequenceTest_batch_size = 5;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-avoid-non-const-global-variables)
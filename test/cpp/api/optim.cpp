@@ -508,3 +508,48 @@ TEST(OptimTest, CheckLRChange_StepLR_Adam) {
 
   check_lr_change(optimizer, step_lr_scheduler, expected_epoch_lrs);
 }
+
+TEST(OptimTest, OffloadOptimizerMatchesPlainOptimizer) {
+  torch::manual_seed(0);
+
+  std::vector<torch::Tensor> group1 = {torch::randn({4, 4})};
+  std::vector<torch::Tensor> group2 = {torch::randn({6})};
+  std::vector<torch::Tensor> reference = {
+      group1[0].clone(), group2[0].clone()};
+
+  OffloadOptimizer offloaded(
+      {OptimizerParamGroup(group1), OptimizerParamGroup(group2)},
+      [](OptimizerParamGroup group) {
+        return std::make_unique<Adam>(
+            std::vector<OptimizerParamGroup>{std::move(group)},
+            AdamOptions(0.1));
+      });
+  Adam plain(
+      {OptimizerParamGroup({reference[0]}),
+       OptimizerParamGroup({reference[1]})},
+      AdamOptions(0.1));
+
+  ASSERT_EQ(offloaded.num_groups(), 2);
+  for (int step = 0; step < 3; step++) {
+    group1[0].mutable_grad() = torch::ones_like(group1[0]) * (step + 1);
+    group2[0].mutable_grad() = torch::ones_like(group2[0]) * (step + 1);
+    reference[0].mutable_grad() = group1[0].grad().clone();
+    reference[1].mutable_grad() = group2[0].grad().clone();
+    offloaded.step();
+    plain.step();
+  }
+
+  ASSERT_TRUE(group1[0].allclose(reference[0]));
+  ASSERT_TRUE(group2[0].allclose(reference[1]));
+
+  // Without an accelerator the wrapper never copies, so the counters stay 0.
+  if (!torch::cuda::is_available()) {
+    ASSERT_EQ(offloaded.stats().bytes_to_device, 0);
+    ASSERT_EQ(offloaded.stats().bytes_to_host, 0);
+    ASSERT_EQ(offloaded.stats().to_device_bandwidth(), 0);
+  }
+
+  offloaded.zero_grad();
+  ASSERT_EQ(group1[0].grad().sum().item<float>(), 0);
+  ASSERT_EQ(group2[0].grad().sum().item<float>(), 0);
+}
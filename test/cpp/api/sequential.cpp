@@ -670,3 +670,52 @@ TEST_F(SequentialTest, ModuleForwardMethodOptionalArg) {
     ASSERT_TRUE(torch::allclose(rnn_output, expected_output, 1e-05, 2e-04));
   }
 }
+
+TEST_F(SequentialTest, PipelineSequentialMatchesSequential) {
+  torch::manual_seed(0);
+  Sequential sequential(Linear(4, 5), Functional(torch::relu), Linear(5, 3));
+  PipelineSequential pipeline(
+      PipelineSequentialOptions({torch::kCPU, torch::kCPU}).chunks(3));
+  // Share the submodules so both containers compute the same function.
+  for (const auto& module : *sequential) {
+    pipeline->push_back(module);
+  }
+
+  auto input = torch::randn({8, 4});
+  auto expected = sequential->forward(input);
+  auto output = pipeline->forward(input);
+  ASSERT_TRUE(output.allclose(expected));
+
+  // More micro-batches than rows still covers the whole input.
+  pipeline->options.chunks(16);
+  ASSERT_TRUE(pipeline->forward(input).allclose(expected));
+}
+
+TEST_F(SequentialTest, PipelineSequentialChecksConfiguration) {
+  ASSERT_THROWS_WITH(
+      PipelineSequential(PipelineSequentialOptions({})),
+      "PipelineSequential requires at least one device");
+  ASSERT_THROWS_WITH(
+      PipelineSequential(
+          PipelineSequentialOptions({torch::kCPU, torch::kCPU}), Linear(3, 3))
+          ->forward(torch::ones({2, 3})),
+      "every stage needs at least one submodule");
+}
+
+TEST_F(SequentialTest, PipelineSequentialAcrossDevices_CUDA) {
+  torch::manual_seed(0);
+  Sequential sequential(Linear(4, 5), Functional(torch::relu), Linear(5, 3));
+  PipelineSequential pipeline(
+      PipelineSequentialOptions({torch::Device(torch::kCUDA, 0)})
+          .chunks(4)
+          .max_in_flight(2));
+  for (const auto& module : *sequential) {
+    pipeline->push_back(module.clone());
+  }
+
+  auto input = torch::randn({8, 4});
+  auto expected = sequential->forward(input);
+  auto output = pipeline->forward(input.to(torch::kCUDA));
+  ASSERT_EQ(output.device(), torch::Device(torch::kCUDA, 0));
+  ASSERT_TRUE(output.cpu().allclose(expected, 1e-05, 1e-05));
+}
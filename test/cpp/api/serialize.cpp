@@ -259,6 +259,27 @@ TEST(SerializeTest, BasicToFile) {
   ASSERT_TRUE(x.allclose(y));
 }
 
+TEST(SerializeTest, SaveAsync) {
+  torch::manual_seed(0);
+
+  auto x = torch::randn({5, 5});
+  auto expected = x.clone();
+
+  auto tempfile = c10::make_tempfile();
+  auto pending = torch::save_async(x, tempfile.name);
+  // The snapshot is taken before save_async returns, so mutations made
+  // while the file is being written must not leak into the checkpoint.
+  x.add_(1);
+  pending.get();
+
+  torch::Tensor y;
+  torch::load(y, tempfile.name);
+
+  ASSERT_TRUE(y.defined());
+  ASSERT_EQ(expected.sizes().vec(), y.sizes().vec());
+  ASSERT_TRUE(expected.allclose(y));
+}
+
 TEST(SerializeTest, BasicViaFunc) {
   torch::manual_seed(0);
 
@@ -346,6 +346,63 @@ TEST(TCPStoreTest, testKeyDelete) {
   testKeyChangeHelper(*store, key, "1", c10::nullopt);
 }
 
+TEST(TCPStoreTest, testMultiSetGet) {
+  auto serverTCPStore = _createServer();
+  auto store =
+      c10::make_intrusive<c10d::PrefixStore>("multiPrefix", serverTCPStore);
+
+  std::vector<std::string> keys{"key0", "key1", "key2"};
+  std::vector<std::vector<uint8_t>> values;
+  for (const auto& key : keys) {
+    std::string value = "value_for_" + key;
+    values.emplace_back(value.begin(), value.end());
+  }
+  store->multiSet(keys, values);
+
+  // The batched set must be observable through the single-key API and
+  // vice versa.
+  c10d::test::check(*store, "key1", "value_for_key1");
+  c10d::test::set(*store, "key3", "value_for_key3");
+
+  auto result = store->multiGet({"key0", "key2", "key3"});
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_EQ(
+      std::string(result[0].begin(), result[0].end()), "value_for_key0");
+  EXPECT_EQ(
+      std::string(result[1].begin(), result[1].end()), "value_for_key2");
+  EXPECT_EQ(
+      std::string(result[2].begin(), result[2].end()), "value_for_key3");
+}
+
+TEST(TCPStoreTest, testWatchPrefixCallback) {
+  auto store = _createServer();
+
+  constexpr int expectedCallbacks = 2;
+  std::promise<int> callbacksExecutedPromise;
+  std::atomic<int> callbacksExecuted{0};
+  c10d::WatchKeyCallback callback =
+      [&callbacksExecuted, &callbacksExecutedPromise](
+          c10::optional<std::string> /* unused */,
+          c10::optional<std::string> /* unused */) {
+        if (++callbacksExecuted == expectedCallbacks) {
+          callbacksExecutedPromise.set_value(callbacksExecuted);
+        }
+      };
+
+  // A key outside the prefix must not trigger the callback.
+  c10d::test::set(*store, "unwatched/key", "value");
+  store->watchPrefix("watched/", callback);
+  c10d::test::set(*store, "watched/key0", "value0");
+  c10d::test::set(*store, "watched/key1", "value1");
+
+  std::future<int> callbacksExecutedFuture =
+      callbacksExecutedPromise.get_future();
+  std::chrono::milliseconds span(kStoreCallbackTimeoutMillis);
+  if (callbacksExecutedFuture.wait_for(span) == std::future_status::timeout)
+    TORCH_CHECK(false, "Callback execution timed out.");
+  EXPECT_EQ(callbacksExecutedFuture.get(), expectedCallbacks);
+}
+
 TEST(TCPStoreTest, testCleanShutdown) {
   int numWorkers = 2;
 
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/stack.h>
+#include <torch/abi_library.h>
+#include <torch/torch.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// out = in * scale + (flag ? 1 : 0), written against the pure C surface the
+// way an out-of-tree plugin would (ATen is only used inside the kernel body).
+int scale_shift_kernel(
+    const TorchAbiValue* args,
+    size_t num_args,
+    TorchAbiValue* returns,
+    size_t num_returns) {
+  if (num_args != 3 || num_returns != 1) {
+    torch_abi_set_error("unexpected arity");
+    return 1;
+  }
+  // Borrowed handle -> owned Tensor: retain first, then adopt.
+  torch_abi_tensor_retain(args[0].tensor);
+  at::Tensor self(c10::intrusive_ptr<c10::TensorImpl, c10::UndefinedTensorImpl>::
+                      reclaim(reinterpret_cast<c10::TensorImpl*>(args[0].tensor)));
+  at::Tensor result =
+      self * args[1].double_value + (args[2].bool_value ? 1 : 0);
+  // Hand one reference over to the trampoline.
+  returns[0].tensor = reinterpret_cast<TorchAbiTensorHandle>(
+      result.unsafeReleaseTensorImpl());
+  return 0;
+}
+
+int failing_kernel(
+    const TorchAbiValue* /* args */,
+    size_t /* num_args */,
+    TorchAbiValue* /* returns */,
+    size_t /* num_returns */) {
+  torch_abi_set_error("deliberate failure");
+  return 1;
+}
+
+int identity_int_kernel(
+    const TorchAbiValue* args,
+    size_t /* num_args */,
+    TorchAbiValue* returns,
+    size_t /* num_returns */) {
+  returns[0].int64_value = args[0].int64_value;
+  return 0;
+}
+
+std::vector<c10::IValue> callOp(
+    const char* name,
+    std::vector<c10::IValue> stack) {
+  auto op = c10::Dispatcher::singleton().findSchemaOrThrow(name, "");
+  op.callBoxed(&stack);
+  return stack;
+}
+
+} // namespace
+
+TEST(AbiLibraryTest, RegistersAndCallsKernel) {
+  ASSERT_EQ(
+      torch_abi_register_kernel(
+          "abi_test::scale_shift(Tensor self, float scale, bool shift) -> Tensor",
+          "CPU",
+          &scale_shift_kernel),
+      0)
+      << torch_abi_last_error();
+
+  auto input = torch::randn({4, 4});
+  auto stack = callOp("abi_test::scale_shift", {input, 2.5, true});
+  ASSERT_EQ(stack.size(), 1);
+  ASSERT_TRUE(stack[0].toTensor().allclose(input * 2.5 + 1));
+
+  // Input must be unaffected by the borrow/retain dance.
+  ASSERT_EQ(input.use_count(), 1);
+}
+
+TEST(AbiLibraryTest, NonTensorReturn) {
+  ASSERT_EQ(
+      torch_abi_register_kernel(
+          "abi_test::identity_int(int value) -> int",
+          nullptr,
+          &identity_int_kernel),
+      0)
+      << torch_abi_last_error();
+
+  auto stack = callOp("abi_test::identity_int", {int64_t(42)});
+  ASSERT_EQ(stack.size(), 1);
+  ASSERT_EQ(stack[0].toInt(), 42);
+}
+
+TEST(AbiLibraryTest, KernelFailureSurfacesAsError) {
+  ASSERT_EQ(
+      torch_abi_register_kernel(
+          "abi_test::fail(Tensor self) -> Tensor", "CPU", &failing_kernel),
+      0)
+      << torch_abi_last_error();
+
+  try {
+    callOp("abi_test::fail", {torch::ones({1})});
+    FAIL() << "expected the kernel failure to throw";
+  } catch (const c10::Error& e) {
+    ASSERT_NE(std::string(e.what()).find("deliberate failure"), std::string::npos);
+  }
+}
+
+TEST(AbiLibraryTest, RejectsUnsupportedSchema) {
+  ASSERT_NE(
+      torch_abi_register_kernel(
+          "abi_test::bad(Tensor[] xs) -> Tensor", "CPU", &failing_kernel),
+      0);
+  ASSERT_NE(
+      std::string(torch_abi_last_error()).find("unsupported"),
+      std::string::npos);
+
+  ASSERT_NE(torch_abi_register_kernel(nullptr, "CPU", &failing_kernel), 0);
+}
+
+} // namespace jit
+} // namespace torch
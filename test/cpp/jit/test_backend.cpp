@@ -2,13 +2,44 @@
 #include <test/cpp/jit/test_utils.h>
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/backends/backend_detail.h>
+#include <torch/csrc/jit/mobile/compiled_artifact_cache.h>
 #include <torch/csrc/jit/mobile/import.h>
 #include <torch/csrc/jit/serialization/import.h>
 #include <torch/torch.h>
 
+#include <cstdio>
+
 // Tests go in torch::jit
 namespace torch {
 namespace jit {
+
+TEST(BackendTest, CompiledArtifactFileCacheRoundTrip) {
+  std::string dir = ::testing::TempDir();
+  mobile::FileCompiledArtifactCache cache(dir);
+
+  const std::string key = "modelhash/devicefingerprint";
+  // A miss returns an empty artifact.
+  ASSERT_EQ(cache.get(key), "");
+
+  cache.put(key, "compiled blob");
+  ASSERT_EQ(cache.get(key), "compiled blob");
+
+  // Overwrites publish atomically and win.
+  cache.put(key, "recompiled blob");
+  ASSERT_EQ(cache.get(key), "recompiled blob");
+
+  // Distinct keys do not collide.
+  ASSERT_EQ(cache.get("otherhash/devicefingerprint"), "");
+
+  // An installed cache is visible through the config used by the runtime.
+  mobile::compiledArtifactCacheConfig().setCache(
+      std::make_unique<mobile::FileCompiledArtifactCache>(dir));
+  ASSERT_NE(mobile::compiledArtifactCacheConfig().getCache(), nullptr);
+  ASSERT_EQ(
+      mobile::compiledArtifactCacheConfig().getCache()->get(key),
+      "recompiled blob");
+  mobile::compiledArtifactCacheConfig().setCache(nullptr);
+}
 TEST(BackendTest, ToBackend) {
   Module m("m");
   m.define(R"(
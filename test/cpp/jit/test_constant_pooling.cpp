@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <ATen/ATen.h>
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/ir/irparser.h>
 #include <torch/csrc/jit/passes/constant_pooling.h>
@@ -89,6 +90,35 @@ graph():
       ->run(*graph);
 }
 
+TEST(ConstantPoolingTest, ConsolidateConstantTensors) {
+#ifndef _WIN32
+  auto graph = std::make_shared<Graph>();
+  auto a = at::rand({4, 4});
+  auto b = at::rand({8});
+  Value* va = graph->insertConstant(a);
+  Value* vb = graph->insertConstant(b);
+  // Use b before a: the arena is laid out in first-use order.
+  Node* tup = graph->createTuple({vb, va});
+  graph->insertNode(tup);
+  graph->registerOutput(tup->output());
+
+  ConsolidateConstantTensors(graph, /*use_hugepages=*/false);
+
+  auto pooled_a = toIValue(va)->toTensor();
+  auto pooled_b = toIValue(vb)->toTensor();
+  ASSERT_TRUE(pooled_a.equal(a));
+  ASSERT_TRUE(pooled_b.equal(b));
+
+  auto* pa = static_cast<char*>(pooled_a.data_ptr());
+  auto* pb = static_cast<char*>(pooled_b.data_ptr());
+  // b is used first and sits at the front of the arena; both payloads are
+  // 64-byte aligned, so b's 32 bytes round up to put a at offset 64.
+  ASSERT_LT(pb, pa);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(pb) % 64, 0);
+  ASSERT_EQ(pa - pb, 64);
+#endif
+}
+
 TEST(ConstantPoolingTest, DictConstantPooling) {
   auto graph = std::make_shared<Graph>();
   parseIR(
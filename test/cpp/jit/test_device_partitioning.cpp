@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/device_partitioning.h>
+#include <torch/csrc/jit/testing/file_check.h>
+
+namespace torch {
+namespace jit {
+
+TEST(DevicePartitioningTest, ForksOffDeviceTower) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu),
+      %b : Float(4, 4, strides=[4, 1], requires_grad=0, device=cuda:0)):
+  %c : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::relu(%a)
+  %d : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::tanh(%c)
+  %e : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::sigmoid(%d)
+  %f : Float(4, 4, strides=[4, 1], requires_grad=0, device=cuda:0) = aten::relu(%b)
+  %g : Float(4, 4, strides=[4, 1], requires_grad=0, device=cuda:0) = aten::tanh(%f)
+  return (%e, %g)
+)IR",
+      &*graph);
+
+  auto report = PartitionDeviceSubgraphs(graph);
+
+  // Two device-affine partitions; the smaller CUDA tower is forked and
+  // overlaps with the inline CPU tower.
+  ASSERT_EQ(report.partitions.size(), 2);
+  size_t forked = 0;
+  for (const auto& partition : report.partitions) {
+    forked += partition.forked;
+    if (partition.forked) {
+      EXPECT_EQ(partition.device, c10::Device("cuda:0"));
+      EXPECT_EQ(partition.num_nodes, 2);
+    } else {
+      EXPECT_EQ(partition.device, c10::Device("cpu"));
+      EXPECT_EQ(partition.num_nodes, 3);
+    }
+  }
+  EXPECT_EQ(forked, 1);
+  EXPECT_EQ(report.unpartitioned_nodes, 0);
+
+  // The forked tower runs as a prim::fork subgraph joined by aten::wait,
+  // with the inline CPU tower in between.
+  testing::FileCheck()
+      .check("prim::fork")
+      ->check("aten::relu")
+      ->check("aten::wait")
+      ->run(*graph);
+}
+
+TEST(DevicePartitioningTest, InsertsTransferForCrossDeviceInput) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu)):
+  %b : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::relu(%a)
+  %c : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::tanh(%b)
+  %d : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::sigmoid(%c)
+  %e : Float(4, 4, strides=[4, 1], requires_grad=0, device=cuda:0) = aten::relu(%a)
+  %f : Float(4, 4, strides=[4, 1], requires_grad=0, device=cuda:0) = aten::tanh(%e)
+  return (%d, %f)
+)IR",
+      &*graph);
+
+  PartitionDeviceSubgraphs(graph);
+
+  // The CUDA partition consumes a CPU value, so the transfer is made
+  // explicit before the fork.
+  testing::FileCheck()
+      .check("aten::to")
+      ->check("prim::fork")
+      ->check("aten::wait")
+      ->run(*graph);
+}
+
+TEST(DevicePartitioningTest, SingleDeviceGraphIsUntouched) {
+  auto graph = std::make_shared<Graph>();
+  parseIR(
+      R"IR(
+graph(%a : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu)):
+  %b : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::relu(%a)
+  %c : Float(4, 4, strides=[4, 1], requires_grad=0, device=cpu) = aten::tanh(%b)
+  return (%c)
+)IR",
+      &*graph);
+
+  auto report = PartitionDeviceSubgraphs(graph);
+
+  for (const auto& partition : report.partitions) {
+    EXPECT_FALSE(partition.forked);
+  }
+  testing::FileCheck().check_not("prim::fork")->run(*graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -174,6 +174,64 @@ TEST(FlatbufferTest, MethodInvocation) { // NOLINT (use =delete in gtest)
   }
 }
 
+TEST(FlatbufferTest, OperatorTable) {
+  Module m("m");
+  m.register_parameter("foo", torch::ones({}), false);
+  m.define(R"(
+    def add_it(self, x):
+      return self.foo + x + 1
+    def mul_it(self, x):
+      return (self.foo + x) * x
+  )");
+
+  CompilationOptions options;
+  mobile::Module bc = jitModuleToMobile(m, options);
+  auto buff = save_mobile_module_to_bytes(bc);
+
+  auto* flatbuffer_module = mobile::serialization::GetMutableModule(buff.data());
+  const auto* operator_table = flatbuffer_module->operator_table();
+  ASSERT_NE(operator_table, nullptr);
+  ASSERT_GT(operator_table->size(), 0);
+  // The table is sorted and deduplicated.
+  for (uint32_t i = 1; i < operator_table->size(); ++i) {
+    const auto* prev = operator_table->Get(i - 1);
+    const auto* cur = operator_table->Get(i);
+    auto prev_key = std::make_tuple(
+        prev->name()->str(),
+        prev->overload_name()->str(),
+        prev->num_args_serialized());
+    auto cur_key = std::make_tuple(
+        cur->name()->str(),
+        cur->overload_name()->str(),
+        cur->num_args_serialized());
+    EXPECT_LT(prev_key, cur_key);
+  }
+  // Every function's operator_index aligns with its legacy operator list.
+  for (uint32_t i = 0; i < flatbuffer_module->ivalues()->size(); ++i) {
+    const auto* func = flatbuffer_module->ivalues()->Get(i)->val_as_Function();
+    if (func == nullptr) {
+      continue;
+    }
+    const auto* operator_index = func->operator_index();
+    ASSERT_NE(operator_index, nullptr);
+    ASSERT_EQ(operator_index->size(), func->operators()->size());
+    for (uint32_t j = 0; j < operator_index->size(); ++j) {
+      const auto* entry = operator_table->Get(operator_index->Get(j));
+      const auto* op = func->operators()->Get(j);
+      EXPECT_EQ(entry->name()->str(), op->name()->str());
+      EXPECT_EQ(entry->overload_name()->str(), op->overload_name()->str());
+      EXPECT_EQ(entry->num_args_serialized(), op->num_args_serialized());
+    }
+  }
+
+  // Loading resolves operators through the shared table and still runs.
+  mobile::Module bc2 = parse_mobile_module(buff.data(), buff.size());
+  auto input = 3 * torch::ones({});
+  auto ref = m.run_method("mul_it", input);
+  auto res = bc2.get_method("mul_it")({input});
+  AT_ASSERT(res.toTensor().equal(ref.toTensor()));
+}
+
 #if defined(ENABLE_FLATBUFFER) && !defined(FB_XPLAT_BUILD)
 TEST(FlatbufferTest, FlatbufferBackPortTest) {
   Module m("m");
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/passes/hoist_loop_invariant_getattrs.h>
+#include <torch/csrc/jit/testing/file_check.h>
+#include <torch/torch.h>
+
+namespace torch {
+namespace jit {
+
+TEST(HoistLoopInvariantGetAttrsTest, HoistsParameterReads) {
+  Module m("m");
+  m.register_parameter("weight", torch::ones({2}), /*is_buffer=*/false);
+  m.define(R"(
+    def forward(self, x: Tensor, n: int):
+        for i in range(n):
+            x = x + self.weight
+        return x
+  )");
+  auto graph = m.get_method("forward").graph();
+
+  ASSERT_TRUE(HoistLoopInvariantGetAttrs(graph));
+
+  // The attribute read now precedes the loop.
+  testing::FileCheck()
+      .check("prim::GetAttr")
+      ->check("prim::Loop")
+      ->check_not("prim::GetAttr")
+      ->run(*graph);
+
+  // Hoisting did not change what the method computes.
+  auto x = torch::randn({2});
+  auto result = m.forward({x, 3}).toTensor();
+  ASSERT_TRUE(result.allclose(x + 3));
+}
+
+TEST(HoistLoopInvariantGetAttrsTest, HoistsChainedSubmoduleReads) {
+  Module cell("cell");
+  cell.register_parameter("weight", torch::ones({2}), /*is_buffer=*/false);
+  Module m("m");
+  m.register_module("cell", cell);
+  m.define(R"(
+    def forward(self, x: Tensor, n: int):
+        for i in range(n):
+            x = x + self.cell.weight
+        return x
+  )");
+  auto graph = m.get_method("forward").graph();
+
+  ASSERT_TRUE(HoistLoopInvariantGetAttrs(graph));
+
+  // Both levels of the attribute chain were hoisted.
+  testing::FileCheck()
+      .check("prim::GetAttr")
+      ->check("prim::GetAttr")
+      ->check("prim::Loop")
+      ->check_not("prim::GetAttr")
+      ->run(*graph);
+}
+
+TEST(HoistLoopInvariantGetAttrsTest, DoesNotHoistMutatedAttributes) {
+  Module m("m");
+  m.register_attribute("counter", IntType::get(), 0);
+  m.define(R"(
+    def forward(self, n: int) -> int:
+        for i in range(n):
+            self.counter = self.counter + 1
+        return self.counter
+  )");
+  auto graph = m.get_method("forward").graph();
+
+  ASSERT_FALSE(HoistLoopInvariantGetAttrs(graph));
+
+  testing::FileCheck().check("prim::Loop")->check("prim::GetAttr")->run(
+      *graph);
+}
+
+} // namespace jit
+} // namespace torch
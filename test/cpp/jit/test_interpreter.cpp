@@ -147,6 +147,183 @@ TEST(InterpreterTest, Basic_CUDA) {
   ASSERT_TRUE(exactlyEqual(outputs[1], cx));
 }
 
+namespace {
+
+std::shared_ptr<Graph> build_superinstruction_graph() {
+  auto graph = std::make_shared<Graph>();
+  std::unordered_map<std::string, Value*> vmap;
+  parseIR(
+      R"IR(
+graph(%a : Tensor,
+      %b : Tensor):
+  %2 : int = prim::Constant[value=1]()
+  %x : Tensor = aten::add(%a, %b, %2)
+  %y : Tensor = aten::mul(%x, %x)
+  %z : Tensor = aten::add(%y, %x, %2)
+  return (%z)
+  )IR",
+      &*graph,
+      vmap);
+  return graph;
+}
+
+size_t countInstructions(const Code& code, OpCode op) {
+  size_t count = 0;
+  for (const Instruction& inst : code.instructions()) {
+    if (inst.op == op) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+bool hasSuperInstruction(const Code& code) {
+  for (const Instruction& inst : code.instructions()) {
+    switch (inst.op) {
+      case LOAD_LOAD:
+      case LOAD_MOVE:
+      case MOVE_MOVE:
+      case OP_STORE:
+      case OP_DROP:
+        return true;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+TEST(InterpreterTest, FusesSuperInstructions) {
+  Code function(build_superinstruction_graph(), "");
+  ASSERT_TRUE(hasSuperInstruction(function));
+
+  auto a = at::rand({2, 2}, at::kFloat);
+  auto b = at::rand({2, 2}, at::kFloat);
+  std::vector<IValue> stack({a, b});
+  InterpreterState interp(function);
+  interp.run(stack);
+
+  auto x = a.add(b);
+  auto expected = x.mul(x).add(x);
+  ASSERT_TRUE(exactlyEqual(stack[0].toTensor(), expected));
+}
+
+TEST(InterpreterTest, SuperInstructionsDisabled) {
+  bool original_flag_value = FLAGS_torch_jit_enable_superinstructions;
+  FLAGS_torch_jit_enable_superinstructions = false;
+  Code function(build_superinstruction_graph(), "");
+  FLAGS_torch_jit_enable_superinstructions = original_flag_value;
+  ASSERT_FALSE(hasSuperInstruction(function));
+
+  auto a = at::rand({2, 2}, at::kFloat);
+  auto b = at::rand({2, 2}, at::kFloat);
+  std::vector<IValue> stack({a, b});
+  InterpreterState interp(function);
+  interp.run(stack);
+
+  auto x = a.add(b);
+  auto expected = x.mul(x).add(x);
+  ASSERT_TRUE(exactlyEqual(stack[0].toTensor(), expected));
+}
+
+TEST(InterpreterTest, InstructionPairFrequencies) {
+  resetInstructionPairFrequencies();
+  Code function(build_superinstruction_graph(), "");
+  auto frequencies = getInstructionPairFrequencies();
+  ASSERT_FALSE(frequencies.empty());
+  int64_t total = 0;
+  for (const auto& entry : frequencies) {
+    total += entry.second;
+  }
+  // one pair per adjacent instruction, recorded before fusion
+  ASSERT_EQ(total, static_cast<int64_t>(function.instructions().size()) - 1);
+  resetInstructionPairFrequencies();
+}
+
+TEST(InterpreterTest, MovesLastUseInEachIfBranch) {
+  auto graph = std::make_shared<Graph>();
+  std::unordered_map<std::string, Value*> vmap;
+  parseIR(
+      R"IR(
+graph(%c : bool,
+      %a : Tensor,
+      %b : Tensor):
+  %1 : int = prim::Constant[value=1]()
+  %r : Tensor = prim::If(%c)
+    block0():
+      %t : Tensor = aten::add(%a, %b, %1)
+      -> (%t)
+    block1():
+      %u : Tensor = aten::mul(%a, %b)
+      -> (%u)
+  return (%r)
+  )IR",
+      &*graph,
+      vmap);
+
+  bool original_flag_value = FLAGS_torch_jit_enable_superinstructions;
+  FLAGS_torch_jit_enable_superinstructions = false;
+  Code function(graph, "");
+  FLAGS_torch_jit_enable_superinstructions = original_flag_value;
+
+  // the last reads of %a and %b sit inside the If, so each branch moves
+  // them out of their registers; the Drop after the If only has to clear
+  // whatever the branch that ran left behind. MOVEs: %c, %a and %b in both
+  // branches, and %r at the return.
+  ASSERT_EQ(countInstructions(function, MOVE), 6);
+  ASSERT_EQ(countInstructions(function, LOAD), 0);
+  ASSERT_EQ(countInstructions(function, DROPR), 2);
+
+  auto a = at::rand({2, 2}, at::kFloat);
+  auto b = at::rand({2, 2}, at::kFloat);
+  for (bool cond : {true, false}) {
+    std::vector<IValue> stack({cond, a, b});
+    InterpreterState interp(function);
+    interp.run(stack);
+    auto expected = cond ? a.add(b) : a.mul(b);
+    ASSERT_TRUE(exactlyEqual(stack[0].toTensor(), expected));
+  }
+}
+
+TEST(InterpreterTest, LoadsOuterValuesInLoopBodies) {
+  auto graph = std::make_shared<Graph>();
+  std::unordered_map<std::string, Value*> vmap;
+  parseIR(
+      R"IR(
+graph(%x : Tensor,
+      %a : Tensor,
+      %n : int):
+  %cond : bool = prim::Constant[value=1]()
+  %1 : int = prim::Constant[value=1]()
+  %r : Tensor = prim::Loop(%n, %cond, %x)
+    block0(%i : int, %acc : Tensor):
+      %next : Tensor = aten::add(%acc, %a, %1)
+      -> (%cond, %next)
+  return (%r)
+  )IR",
+      &*graph,
+      vmap);
+
+  bool original_flag_value = FLAGS_torch_jit_enable_superinstructions;
+  FLAGS_torch_jit_enable_superinstructions = false;
+  Code function(graph, "");
+  FLAGS_torch_jit_enable_superinstructions = original_flag_value;
+
+  // %a is read again on the next iteration, so its use inside the body must
+  // stay the only LOAD; it is released by the Drop after the Loop instead
+  ASSERT_EQ(countInstructions(function, LOAD), 1);
+  ASSERT_EQ(countInstructions(function, DROPR), 2);
+
+  auto x = at::zeros({2, 2}, at::kFloat);
+  auto a = at::ones({2, 2}, at::kFloat);
+  std::vector<IValue> stack({x, a, 3});
+  InterpreterState interp(function);
+  interp.run(stack);
+  ASSERT_TRUE(exactlyEqual(stack[0].toTensor(), x.add(a.mul(3))));
+}
+
 TEST(InterpreterTest, IgnorableArgsInSchema) {
   auto graph = build_mobile_export_analysis_graph();
   MobileCode function(graph, "");
@@ -32,6 +32,7 @@
 #include <torch/csrc/jit/passes/create_autodiff_subgraphs.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
+#include <torch/csrc/jit/passes/group_mm.h>
 #include <torch/csrc/jit/passes/guard_elimination.h>
 #include <torch/csrc/jit/passes/inline_autodiff_subgraphs.h>
 #include <torch/csrc/jit/passes/insert_guards.h>
@@ -3086,5 +3087,45 @@ TEST_F(Composed, ComposedOp) {
 #endif
 }
 
+TEST(GroupMMTest, Basic) {
+  const auto graph_string = R"IR(
+    graph(%a : Tensor, %b : Tensor, %c : Tensor, %d : Tensor):
+      %0 : Tensor = aten::mm(%a, %b)
+      %1 : Tensor = aten::mm(%b, %c)
+      %2 : Tensor = aten::mm(%c, %d)
+      %3 : Tensor = aten::mm(%d, %a)
+      %4 : Tensor = aten::mm(%0, %1)
+      return (%4, %2, %3))IR";
+  auto graph = std::make_shared<Graph>();
+  parseIR(graph_string, graph.get());
+
+  GroupMM(graph);
+
+  // The four independent mms are coalesced; %4 depends on two of them and
+  // stays a plain mm.
+  testing::FileCheck()
+      .check_count("= aten::_grouped_mm", 1, /*exactly=*/true)
+      ->run(*graph);
+  testing::FileCheck()
+      .check_count("= aten::mm", 1, /*exactly=*/true)
+      ->run(*graph);
+
+  auto a = at::rand({8, 8});
+  auto b = at::rand({8, 8});
+  auto c = at::rand({8, 8});
+  auto d = at::rand({8, 8});
+
+  Code code(graph, "");
+  InterpreterState interpreter{code};
+  std::vector<IValue> stack = {a, b, c, d};
+  interpreter.run(stack);
+  at::Tensor out3 = pop(stack).toTensor();
+  at::Tensor out2 = pop(stack).toTensor();
+  at::Tensor out1 = pop(stack).toTensor();
+  ASSERT_TRUE(at::allclose(out1, at::mm(at::mm(a, b), at::mm(b, c))));
+  ASSERT_TRUE(at::allclose(out2, at::mm(c, d)));
+  ASSERT_TRUE(at::allclose(out3, at::mm(d, a)));
+}
+
 } // namespace jit
 } // namespace torch
@@ -5,6 +5,7 @@
 #include <ATen/core/qualified_name.h>
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/frontend/resolver.h>
+#include <torch/csrc/jit/passes/freeze_module.h>
 #include <torch/csrc/jit/serialization/import.h>
 #include <torch/csrc/jit/serialization/import_source.h>
 #include <torch/csrc/jit/testing/file_check.h>
@@ -404,6 +405,38 @@ TEST(ModuleAPITest, Freezing) {
   testing::FileCheck().check("GetAttr")->run(*forward_g);
 }
 
+TEST(ModuleAPITest, FreezingInternsSharedWeights) {
+  Module m("m");
+  m.register_parameter("foo", torch::ones({2, 2}, torch::requires_grad()), false);
+  m.define(R"(
+    def forward(self, x):
+      return self.foo + x
+    def infer(self, x):
+      return self.foo * x
+  )");
+  m.eval();
+
+  // Both preserved methods fold self.foo; the detached constants must share
+  // one TensorImpl rather than each method getting its own copy.
+  auto frozen_mod = freeze_module(m, {"infer"});
+  auto get_tensor_constant = [](const std::shared_ptr<Graph>& g) {
+    for (auto n : g->nodes()) {
+      if (n->kind() == prim::Constant && n->outputs().size() == 1 &&
+          n->output()->type()->isSubtypeOf(*TensorType::get())) {
+        return toIValue(n->output())->toTensor();
+      }
+    }
+    return at::Tensor();
+  };
+  auto forward_const =
+      get_tensor_constant(frozen_mod.get_method("forward").graph());
+  auto infer_const = get_tensor_constant(frozen_mod.get_method("infer").graph());
+  ASSERT_TRUE(forward_const.defined());
+  ASSERT_TRUE(infer_const.defined());
+  ASSERT_EQ(
+      forward_const.unsafeGetTensorImpl(), infer_const.unsafeGetTensorImpl());
+}
+
 TEST(ModuleAPITest, OfiFreezesTraining) {
   Module m("m");
   m.register_parameter("foo", torch::ones({}), false);
@@ -426,6 +459,67 @@ TEST(ModuleAPITest, OfiFreezesTraining) {
   testing::FileCheck().check_not("GetAttr")->run(*forward_g);
 }
 
+TEST(ModuleAPITest, ForwardBatch) {
+  Module m("m");
+  m.define(R"(
+    def forward(self, x: Tensor) -> Tensor:
+        return x + 2.0
+  )");
+  std::vector<std::vector<IValue>> requests;
+  for (const auto i : c10::irange(4)) {
+    requests.emplace_back(
+        std::vector<IValue>{torch::full({2, 3}, static_cast<double>(i))});
+  }
+  auto results = m.forward_batch(std::move(requests));
+  ASSERT_EQ(results.size(), 4);
+  for (const auto i : c10::irange(4)) {
+    ASSERT_TRUE(results[i].toTensor().allclose(
+        torch::full({2, 3}, static_cast<double>(i) + 2.0)));
+  }
+}
+
+TEST(ModuleAPITest, ForwardBatchConcat) {
+  Module m("m");
+  m.define(R"(
+    def forward(self, x: Tensor) -> Tensor:
+        return x * 3.0
+  )");
+  // Aligned shapes (with differing leading dims) take the concat fast path.
+  std::vector<std::vector<IValue>> requests;
+  requests.emplace_back(std::vector<IValue>{torch::full({1, 3}, 1.0)});
+  requests.emplace_back(std::vector<IValue>{torch::full({2, 3}, 2.0)});
+  auto results = m.forward_batch(std::move(requests), /*try_concat=*/true);
+  ASSERT_EQ(results.size(), 2);
+  ASSERT_TRUE(results[0].toTensor().allclose(torch::full({1, 3}, 3.0)));
+  ASSERT_TRUE(results[1].toTensor().allclose(torch::full({2, 3}, 6.0)));
+
+  // Misaligned trailing shapes must fall back to per-request execution.
+  std::vector<std::vector<IValue>> misaligned;
+  misaligned.emplace_back(std::vector<IValue>{torch::full({1, 3}, 1.0)});
+  misaligned.emplace_back(std::vector<IValue>{torch::full({1, 4}, 2.0)});
+  results = m.forward_batch(std::move(misaligned), /*try_concat=*/true);
+  ASSERT_EQ(results.size(), 2);
+  ASSERT_TRUE(results[0].toTensor().allclose(torch::full({1, 3}, 3.0)));
+  ASSERT_TRUE(results[1].toTensor().allclose(torch::full({1, 4}, 6.0)));
+}
+
+TEST(ModuleAPITest, ForwardBatchConcatReductionFallsBack) {
+  Module m("m");
+  m.define(R"(
+    def forward(self, x: Tensor) -> Tensor:
+        return x.sum(dim=0)
+  )");
+  // The output does not follow the batch dimension, so concatenation is not
+  // semantics-preserving and forward_batch must rerun per request.
+  std::vector<std::vector<IValue>> requests;
+  requests.emplace_back(std::vector<IValue>{torch::full({2, 3}, 1.0)});
+  requests.emplace_back(std::vector<IValue>{torch::full({2, 3}, 2.0)});
+  auto results = m.forward_batch(std::move(requests), /*try_concat=*/true);
+  ASSERT_EQ(results.size(), 2);
+  ASSERT_TRUE(results[0].toTensor().allclose(torch::full({3}, 2.0)));
+  ASSERT_TRUE(results[1].toTensor().allclose(torch::full({3}, 4.0)));
+}
+
 TEST(ModuleAPITest, To_CUDA) {
   Module m("test");
   {
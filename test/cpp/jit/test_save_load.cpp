@@ -8,6 +8,9 @@
 #include <torch/csrc/jit/serialization/export_bytecode.h>
 #include <torch/csrc/jit/serialization/import.h>
 #include <torch/csrc/jit/serialization/import_source.h>
+#include <torch/csrc/jit/serialization/pickle.h>
+#include <torch/csrc/jit/serialization/storage_dedup.h>
+#include <torch/csrc/jit/testing/file_check.h>
 #include <torch/torch.h>
 
 #include "caffe2/serialize/istream_adapter.h"
@@ -149,6 +152,62 @@ TEST(SerializationTest, TypeTags) {
   }
 }
 
+TEST(SerializationTest, TestLoadTensorSubset) {
+  auto state_dict = c10::Dict<std::string, at::Tensor>();
+  state_dict.insert("encoder.weight", torch::rand({4, 4}));
+  state_dict.insert("encoder.bias", torch::rand({4}));
+  state_dict.insert("decoder.weight", torch::rand({4, 4}));
+  auto bytes = torch::jit::pickle_save(state_dict);
+
+  auto subset = torch::jit::pickle_load_tensor_subset(
+      bytes, [](const std::string& name) {
+        return name.compare(0, 8, "encoder.") == 0;
+      });
+
+  ASSERT_EQ(subset.size(), 2u);
+  ASSERT_FALSE(subset.contains("decoder.weight"));
+  ASSERT_TRUE(
+      subset.at("encoder.weight").equal(state_dict.at("encoder.weight")));
+  ASSERT_TRUE(subset.at("encoder.bias").equal(state_dict.at("encoder.bias")));
+}
+
+TEST(SerializationTest, StorageDeduplication) {
+  Module m("m");
+  m.register_parameter("w", torch::rand({64, 64}), false);
+  m.register_parameter("v", torch::rand({64, 64}), false);
+  std::ostringstream oss;
+  m.save(oss);
+  std::string saved = oss.str();
+
+  setStorageDeduplication(true);
+  const auto stats_before = getStorageDedupStats();
+  std::istringstream iss1(saved);
+  Module m1 = torch::jit::load(iss1);
+  std::istringstream iss2(saved);
+  Module m2 = torch::jit::load(iss2);
+  setStorageDeduplication(false);
+
+  // the second load found both payloads already resident and aliased them
+  auto w1 = m1.attr("w").toTensor();
+  auto w2 = m2.attr("w").toTensor();
+  ASSERT_TRUE(w2.is_alias_of(w1));
+  ASSERT_TRUE(w2.equal(w1));
+  ASSERT_TRUE(m2.attr("v").toTensor().is_alias_of(m1.attr("v").toTensor()));
+  // distinct payloads within one module stay distinct
+  ASSERT_FALSE(w1.is_alias_of(m1.attr("v").toTensor()));
+
+  const auto stats_after = getStorageDedupStats();
+  ASSERT_GE(stats_after.storages_shared - stats_before.storages_shared, 2u);
+  ASSERT_GE(
+      stats_after.bytes_saved - stats_before.bytes_saved,
+      2u * 64 * 64 * sizeof(float));
+
+  // loads with deduplication off do not alias
+  std::istringstream iss3(saved);
+  Module m3 = torch::jit::load(iss3);
+  ASSERT_FALSE(m3.attr("w").toTensor().is_alias_of(w1));
+}
+
 TEST(SerializationTest, TestJitStream_CUDA) {
   torch::jit::Module model;
   std::vector<torch::jit::IValue> inputs;
@@ -250,6 +309,30 @@ TEST(TestSourceRoundTrip,
   }
 }
 
+TEST(SerializationTest, LoadForInference) {
+  Module m("m");
+  m.register_parameter("weight", torch::ones({5, 5}), /*is_buffer=*/false);
+  m.define(R"(
+    def forward(self, input: Tensor):
+        return torch.relu(input + self.weight)
+  )");
+  m.eval();
+  auto input = torch::randn({5, 5});
+  auto expected = m.forward({input}).toTensor();
+
+  std::stringstream ss;
+  m.save(ss);
+  Module loaded = load_for_inference(ss);
+
+  // The loaded module is frozen and the add/relu pair is fused.
+  EXPECT_FALSE(loaded._ivalue()->type()->hasAttribute("training"));
+  testing::FileCheck().check("_add_relu")->run(
+      *loaded.get_method("forward").graph());
+
+  auto output = loaded.forward({input}).toTensor();
+  ASSERT_TRUE(output.allclose(expected));
+}
+
 TEST(SerializationTest, ParentDirNotExist) {
   expectThrowsEq(
       []() {
@@ -7,6 +7,7 @@
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/ir/ir_views.h>
 #include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/passes/compiled_shape_function.h>
 #include <torch/csrc/jit/passes/constant_propagation.h>
 #include <torch/csrc/jit/passes/symbolic_shape_analysis.h>
 #include <torch/csrc/jit/passes/symbolic_shape_cache.h>
@@ -493,5 +494,36 @@ TEST(ShapeAnalysisTest, TestShapeMultipleReturns) {
   EXPECT_EQ(res->at(0), res->at(1));
   EXPECT_EQ(get_shape_cache_size(), 1);
 }
+
+TEST(ShapeAnalysisTest, CompiledShapeFunction) {
+  auto graph = std::make_shared<Graph>();
+  const auto graph_string = R"IR(
+      graph(%x : Tensor, %y : Tensor):
+        %2 : Tensor = aten::mm(%x, %y)
+        %3 : Tensor = aten::relu(%2)
+        return (%3))IR";
+  parseIR(graph_string, graph.get());
+
+  // Batch dimension is symbolic, feature dimensions are static.
+  std::vector<c10::optional<int64_t>> x_sizes{c10::nullopt, 5};
+  graph->inputs().at(0)->setType(
+      TensorType::create(at::rand({8, 5}))
+          ->withSymbolicShapes(c10::SymbolicShape(x_sizes)));
+  graph->inputs().at(1)->setType(TensorType::create(at::rand({5, 3})));
+
+  auto shape_fn = CompiledShapeFunction::compile(graph);
+  ASSERT_TRUE(shape_fn.has_value());
+
+  // Exact output shapes for any batch size without running the model.
+  for (int64_t batch : {1, 2, 64}) {
+    auto out_shapes = shape_fn->run({{batch, 5}, {5, 3}});
+    ASSERT_EQ(out_shapes.size(), 1);
+    ASSERT_EQ(out_shapes[0], (std::vector<int64_t>{batch, 3}));
+  }
+
+  // Rank mismatches are rejected up front.
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_ANY_THROW(shape_fn->run({{2, 5, 1}, {5, 3}}));
+}
 } // namespace jit
 } // namespace torch
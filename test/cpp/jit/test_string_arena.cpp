@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+#include <torch/csrc/jit/api/function_impl.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+#include <torch/jit.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+std::vector<IValue> runFunction(
+    const std::shared_ptr<CompilationUnit>& cu,
+    const std::string& name,
+    std::vector<IValue> stack) {
+  auto graph = toGraphFunction(cu->get_function(name)).graph();
+  Code code(graph, "");
+  InterpreterState interp(code);
+  interp.run(stack);
+  return stack;
+}
+
+c10::List<std::string> stringList(std::vector<std::string> strings) {
+  c10::List<std::string> result;
+  for (auto& s : strings) {
+    result.push_back(std::move(s));
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(StringArenaTest, RoundTrip) {
+  auto cu = compile(R"JIT(
+    def round_trip(xs: List[str]) -> List[str]:
+        offsets, bytes = torch._string_to_arena(xs)
+        return torch._string_from_arena(offsets, bytes)
+  )JIT");
+  auto inputs = stringList({"hello", "", "world", "a b c"});
+  auto stack = runFunction(cu, "round_trip", {inputs});
+  auto result = stack.at(0).toList();
+  ASSERT_EQ(result.size(), 4);
+  ASSERT_EQ(result.get(0).toStringRef(), "hello");
+  ASSERT_EQ(result.get(1).toStringRef(), "");
+  ASSERT_EQ(result.get(2).toStringRef(), "world");
+  ASSERT_EQ(result.get(3).toStringRef(), "a b c");
+}
+
+TEST(StringArenaTest, Split) {
+  auto cu = compile(R"JIT(
+    def split_tokens(xs: List[str], sep: str) -> Tuple[Tensor, List[str]]:
+        offsets, bytes = torch._string_to_arena(xs)
+        row_splits, ranges = torch._arena_split(offsets, bytes, sep)
+        return row_splits, torch._arena_ranges_to_strings(ranges, bytes)
+  )JIT");
+  auto inputs = stringList({"a b", "cc  d", ""});
+  auto stack = runFunction(cu, "split_tokens", {inputs, std::string(" ")});
+  auto result = stack.at(0).toTuple()->elements();
+  auto row_splits = result.at(0).toTensor();
+  auto tokens = result.at(1).toList();
+  // Per-string token counts: 2, 3 (the run of two separators yields an
+  // empty token, matching aten::split.str), and 1 for the empty string.
+  ASSERT_EQ(row_splits[0].item<int64_t>(), 0);
+  ASSERT_EQ(row_splits[1].item<int64_t>(), 2);
+  ASSERT_EQ(row_splits[2].item<int64_t>(), 5);
+  ASSERT_EQ(row_splits[3].item<int64_t>(), 6);
+  ASSERT_EQ(tokens.size(), 6);
+  ASSERT_EQ(tokens.get(0).toStringRef(), "a");
+  ASSERT_EQ(tokens.get(1).toStringRef(), "b");
+  ASSERT_EQ(tokens.get(2).toStringRef(), "cc");
+  ASSERT_EQ(tokens.get(3).toStringRef(), "");
+  ASSERT_EQ(tokens.get(4).toStringRef(), "d");
+  ASSERT_EQ(tokens.get(5).toStringRef(), "");
+}
+
+TEST(StringArenaTest, Find) {
+  auto cu = compile(R"JIT(
+    def find_all(xs: List[str], sub: str) -> Tensor:
+        offsets, bytes = torch._string_to_arena(xs)
+        return torch._arena_find(offsets, bytes, sub)
+  )JIT");
+  auto inputs = stringList({"abcabc", "xbc", "nothing", ""});
+  auto stack = runFunction(cu, "find_all", {inputs, std::string("bc")});
+  auto result = stack.at(0).toTensor();
+  ASSERT_EQ(result[0].item<int64_t>(), 1);
+  ASSERT_EQ(result[1].item<int64_t>(), 1);
+  ASSERT_EQ(result[2].item<int64_t>(), -1);
+  ASSERT_EQ(result[3].item<int64_t>(), -1);
+}
+
+TEST(StringArenaTest, Normalize) {
+  auto cu = compile(R"JIT(
+    def normalize(xs: List[str], collapse: bool) -> List[str]:
+        offsets, bytes = torch._string_to_arena(xs)
+        out_offsets, out_bytes = torch._arena_normalize(offsets, bytes, True, collapse)
+        return torch._string_from_arena(out_offsets, out_bytes)
+  )JIT");
+  auto inputs = stringList({"Hello  World", "  A\tB  ", "ok"});
+
+  auto stack = runFunction(cu, "normalize", {inputs, false});
+  auto lowered = stack.at(0).toList();
+  ASSERT_EQ(lowered.get(0).toStringRef(), "hello  world");
+  ASSERT_EQ(lowered.get(1).toStringRef(), "  a\tb  ");
+  ASSERT_EQ(lowered.get(2).toStringRef(), "ok");
+
+  stack = runFunction(cu, "normalize", {inputs, true});
+  auto collapsed = stack.at(0).toList();
+  ASSERT_EQ(collapsed.get(0).toStringRef(), "hello world");
+  ASSERT_EQ(collapsed.get(1).toStringRef(), "a b");
+  ASSERT_EQ(collapsed.get(2).toStringRef(), "ok");
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <torch/csrc/monitor/events.h>
+#include <torch/csrc/monitor/histogram.h>
+
+using namespace torch::monitor;
+
+namespace {
+struct AggregatingEventHandler : public EventHandler {
+  std::vector<Event> events;
+
+  void handle(const Event& e) override {
+    events.emplace_back(e);
+  }
+};
+} // namespace
+
+TEST(HistogramTest, Quantiles) {
+  Histogram h{"h"};
+  ASSERT_EQ(h.count(), 0);
+  ASSERT_EQ(h.quantile(0.5), 0);
+
+  for (int64_t i = 1; i <= 100; i++) {
+    h.add(i);
+  }
+  ASSERT_EQ(h.count(), 100);
+
+  // values below kSubBuckets are tracked exactly
+  ASSERT_EQ(h.quantile(0.0), 1);
+  ASSERT_EQ(h.quantile(0.25), 25);
+
+  // larger values land in log-spaced buckets with bounded relative error
+  auto p99 = h.quantile(0.99);
+  ASSERT_GE(p99, 99);
+  ASSERT_LE(p99, 103);
+}
+
+TEST(HistogramTest, LargeValues) {
+  Histogram h{"h"};
+  h.add(1'000'000);
+  auto p50 = h.quantile(0.5);
+  ASSERT_GE(p50, 1'000'000);
+  // relative error is bounded by the sub-bucket width (~3%)
+  ASSERT_LE(p50, 1'032'000);
+
+  // negative values are clamped rather than corrupting the buckets
+  h.add(-5);
+  ASSERT_EQ(h.count(), 2);
+  ASSERT_EQ(h.quantile(0.0), 0);
+}
+
+TEST(HistogramTest, LogEvent) {
+  auto handler = std::make_shared<AggregatingEventHandler>();
+  registerEventHandler(handler);
+
+  Histogram h{"op.latency_us"};
+
+  // empty histograms don't log
+  h.log();
+  ASSERT_EQ(handler->events.size(), 0);
+
+  for (int64_t i = 0; i < 10; i++) {
+    h.add(10);
+  }
+  h.log();
+  ASSERT_EQ(handler->events.size(), 1);
+
+  Event e = handler->events.at(0);
+  ASSERT_EQ(e.name, "torch.monitor.Histogram");
+  ASSERT_EQ(e.data.at("op.latency_us.count"), data_value_t(10L));
+  ASSERT_EQ(e.data.at("op.latency_us.p50"), data_value_t(10L));
+  ASSERT_EQ(e.data.at("op.latency_us.p99"), data_value_t(10L));
+
+  // log() resets the histogram
+  ASSERT_EQ(h.count(), 0);
+  h.log();
+  ASSERT_EQ(handler->events.size(), 1);
+
+  unregisterEventHandler(handler);
+}
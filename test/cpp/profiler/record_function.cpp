@@ -4,6 +4,8 @@
 #include <iostream>
 #include <memory>
 #include <random>
+#include <thread>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -11,6 +13,7 @@
 #include <gtest/gtest.h>
 
 #include <ATen/Parallel.h>
+#include <ATen/FlightRecorder.h>
 #include <ATen/record_function.h>
 #include <c10/util/irange.h>
 
@@ -305,3 +308,58 @@ TEST(RecordFunctionTest, MultipleCallbacks) {
   at::clearCallbacks();
   ASSERT_FALSE(at::hasCallbacks());
 }
+
+// Test that the flight recorder captures events with sane timestamps.
+TEST(RecordFunctionTest, FlightRecorder) {
+  at::clearCallbacks();
+  ASSERT_FALSE(at::hasCallbacks());
+
+  at::enableFlightRecorder(/*entries_per_thread=*/128);
+  ASSERT_TRUE(at::isFlightRecorderEnabled());
+
+  { RECORD_FUNCTION("FlightRecorderTestOp", {}); }
+
+  auto entries = at::dumpFlightRecorder();
+  at::disableFlightRecorder();
+  ASSERT_FALSE(at::isFlightRecorderEnabled());
+  ASSERT_FALSE(at::hasCallbacks());
+
+  bool found = false;
+  for (const auto& entry : entries) {
+    if (std::strcmp(entry.name, "FlightRecorderTestOp") == 0) {
+      found = true;
+      EXPECT_GE(entry.end_ns, entry.start_ns);
+      EXPECT_GT(entry.thread_id, 0);
+    }
+  }
+  ASSERT_TRUE(found);
+}
+
+// Test that the per-thread ring buffer wraps instead of growing.
+TEST(RecordFunctionTest, FlightRecorderWraps) {
+  at::clearCallbacks();
+
+  constexpr size_t capacity = 4;
+  at::enableFlightRecorder(capacity);
+
+  // Use a fresh thread so its ring buffer is created with this capacity;
+  // buffers of previously seen threads keep the capacity they were created
+  // with.
+  std::thread([]() {
+    for (C10_UNUSED const auto i : c10::irange(3 * capacity)) {
+      RECORD_FUNCTION("FlightRecorderWrapOp", {});
+    }
+  }).join();
+
+  auto entries = at::dumpFlightRecorder();
+  at::disableFlightRecorder();
+
+  size_t count = 0;
+  for (const auto& entry : entries) {
+    if (std::strcmp(entry.name, "FlightRecorderWrapOp") == 0) {
+      ++count;
+    }
+  }
+  EXPECT_GT(count, 0);
+  EXPECT_LE(count, capacity);
+}
@@ -101,6 +101,170 @@ TEST(TensorpipeSerialize, Base) {
   EXPECT_TRUE(torch::equal(t2, recvingRpcMessage->tensors()[1]));
 }
 
+TEST(TensorpipeSerialize, InlineTensors) {
+  // Small CPU tensors are expected to be inlined as extra payloads instead
+  // of going through a TensorPipe channel.
+  at::Tensor t1 = torch::ones({16}, at::ScalarType::Float);
+  at::Tensor t2 = torch::ones({32}, at::ScalarType::Int);
+  std::vector<at::Tensor> tensors{t1, t2};
+  std::vector<char> payload = {'a', 'b', 'c'};
+  std::vector<char> payloadCopy = payload; // for testing
+  torch::distributed::rpc::MessageType mtype =
+      torch::distributed::rpc::MessageType::UNKNOWN;
+  int64_t mId = 200;
+  auto sendingRpcMessage = c10::make_intrusive<torch::distributed::rpc::Message>(
+      std::move(payload), std::move(tensors), mtype);
+  sendingRpcMessage->setId(mId);
+  tensorpipe::Message sendingTpMessage;
+  torch::distributed::rpc::TensorpipeWriteBuffers sendingTpBuffers;
+  std::tie(sendingTpMessage, sendingTpBuffers) =
+      torch::distributed::rpc::tensorpipeSerialize(
+          std::move(sendingRpcMessage), {}, {});
+
+  // Both tensors ride along as payloads, none through channels
+  EXPECT_EQ(sendingTpMessage.tensors.size(), 0);
+  EXPECT_EQ(sendingTpMessage.payloads.size(), 6);
+
+  // Mimic receiving message descriptor
+  tensorpipe::Descriptor recvingTpDescriptor;
+  recvingTpDescriptor.metadata = sendingTpMessage.metadata;
+  recvingTpDescriptor.payloads.reserve(sendingTpMessage.payloads.size());
+  for (auto& tpPayload : sendingTpMessage.payloads) {
+    tensorpipe::Descriptor::Payload p;
+    p.length = tpPayload.length;
+    p.metadata = tpPayload.metadata;
+    recvingTpDescriptor.payloads.push_back(std::move(p));
+  }
+
+  tensorpipe::Allocation recvingTpAllocation;
+  torch::distributed::rpc::TensorpipeReadBuffers recvingTpBuffers;
+  std::tie(recvingTpAllocation, recvingTpBuffers) =
+      torch::distributed::rpc::tensorpipeAllocate(recvingTpDescriptor, {});
+
+  // Mimic tensorpipe data transfer
+  EXPECT_EQ(
+      recvingTpAllocation.payloads.size(), sendingTpMessage.payloads.size());
+  for (const auto i : c10::irange(recvingTpAllocation.payloads.size())) {
+    tensorpipe::Message::Payload& srcPayload = sendingTpMessage.payloads[i];
+    tensorpipe::Allocation::Payload& dstPayload =
+        recvingTpAllocation.payloads[i];
+    if (srcPayload.length) {
+      memcpy(dstPayload.data, srcPayload.data, srcPayload.length);
+    }
+  }
+
+  c10::intrusive_ptr<torch::distributed::rpc::Message> recvingRpcMessage =
+      torch::distributed::rpc::tensorpipeDeserialize(
+          std::move(recvingTpDescriptor), std::move(recvingTpBuffers));
+
+  EXPECT_EQ(mtype, recvingRpcMessage->type());
+  EXPECT_EQ(payloadCopy, recvingRpcMessage->payload());
+  EXPECT_EQ(mId, recvingRpcMessage->id());
+  EXPECT_TRUE(torch::equal(t1, recvingRpcMessage->tensors()[0]));
+  EXPECT_TRUE(torch::equal(t2, recvingRpcMessage->tensors()[1]));
+}
+
+TEST(TensorpipeSerialize, InlineTensorsSizeCutoff) {
+  // Tensors at or above the inline cutoff must still use channels
+  at::Tensor large = torch::ones(
+      {static_cast<long>(
+          torch::distributed::rpc::kTpMessageInlineTensorMaxBytes /
+          sizeof(float))},
+      at::ScalarType::Float);
+  std::vector<at::Tensor> tensors{large};
+  std::vector<char> payload = {'a'};
+  auto sendingRpcMessage = c10::make_intrusive<torch::distributed::rpc::Message>(
+      std::move(payload),
+      std::move(tensors),
+      torch::distributed::rpc::MessageType::UNKNOWN);
+
+  tensorpipe::Message sendingTpMessage;
+  torch::distributed::rpc::TensorpipeWriteBuffers sendingTpBuffers;
+  std::tie(sendingTpMessage, sendingTpBuffers) =
+      torch::distributed::rpc::tensorpipeSerialize(
+          std::move(sendingRpcMessage), {}, {});
+
+  EXPECT_EQ(sendingTpMessage.tensors.size(), 1);
+  EXPECT_EQ(sendingTpMessage.payloads.size(), 4);
+}
+
+TEST(TensorpipeSerialize, Batch) {
+  // Two tensor-free messages coalesced into a single TensorPipe message
+  std::vector<char> payload1 = {'1', '2', '3'};
+  std::vector<char> payload2 = {'4', '5'};
+  std::vector<char> payload1Copy = payload1; // for testing
+  std::vector<char> payload2Copy = payload2; // for testing
+  auto rpcMessage1 = c10::make_intrusive<torch::distributed::rpc::Message>(
+      std::move(payload1),
+      std::vector<at::Tensor>(),
+      torch::distributed::rpc::MessageType::UNKNOWN);
+  rpcMessage1->setId(300);
+  auto rpcMessage2 = c10::make_intrusive<torch::distributed::rpc::Message>(
+      std::move(payload2),
+      std::vector<at::Tensor>(),
+      torch::distributed::rpc::MessageType::EXCEPTION);
+  rpcMessage2->setId(301);
+
+  std::vector<c10::intrusive_ptr<torch::distributed::rpc::Message>> rpcMessages;
+  rpcMessages.push_back(std::move(rpcMessage1));
+  rpcMessages.push_back(std::move(rpcMessage2));
+
+  tensorpipe::Message sendingTpMessage;
+  std::vector<torch::distributed::rpc::TensorpipeWriteBuffers> sendingTpBuffers;
+  std::tie(sendingTpMessage, sendingTpBuffers) =
+      torch::distributed::rpc::tensorpipeSerializeBatch(std::move(rpcMessages));
+
+  EXPECT_EQ(
+      sendingTpMessage.metadata,
+      torch::distributed::rpc::kTpMessageBatchMetadata);
+  EXPECT_EQ(sendingTpMessage.tensors.size(), 0);
+  EXPECT_EQ(sendingTpMessage.payloads.size(), 8);
+
+  // Mimic receiving message descriptor
+  tensorpipe::Descriptor recvingTpDescriptor;
+  recvingTpDescriptor.metadata = sendingTpMessage.metadata;
+  recvingTpDescriptor.payloads.reserve(sendingTpMessage.payloads.size());
+  for (auto& tpPayload : sendingTpMessage.payloads) {
+    tensorpipe::Descriptor::Payload p;
+    p.length = tpPayload.length;
+    p.metadata = tpPayload.metadata;
+    recvingTpDescriptor.payloads.push_back(std::move(p));
+  }
+
+  tensorpipe::Allocation recvingTpAllocation;
+  std::vector<torch::distributed::rpc::TensorpipeReadBuffers> recvingTpBuffers;
+  std::tie(recvingTpAllocation, recvingTpBuffers) =
+      torch::distributed::rpc::tensorpipeAllocateBatch(recvingTpDescriptor);
+
+  EXPECT_EQ(recvingTpBuffers.size(), 2);
+  EXPECT_EQ(
+      recvingTpAllocation.payloads.size(), sendingTpMessage.payloads.size());
+  for (const auto i : c10::irange(recvingTpAllocation.payloads.size())) {
+    tensorpipe::Message::Payload& srcPayload = sendingTpMessage.payloads[i];
+    tensorpipe::Allocation::Payload& dstPayload =
+        recvingTpAllocation.payloads[i];
+    if (srcPayload.length) {
+      memcpy(dstPayload.data, srcPayload.data, srcPayload.length);
+    }
+  }
+
+  std::vector<c10::intrusive_ptr<torch::distributed::rpc::Message>>
+      recvingRpcMessages = torch::distributed::rpc::tensorpipeDeserializeBatch(
+          std::move(recvingTpBuffers));
+
+  EXPECT_EQ(recvingRpcMessages.size(), 2);
+  EXPECT_EQ(
+      torch::distributed::rpc::MessageType::UNKNOWN,
+      recvingRpcMessages[0]->type());
+  EXPECT_EQ(payload1Copy, recvingRpcMessages[0]->payload());
+  EXPECT_EQ(300, recvingRpcMessages[0]->id());
+  EXPECT_EQ(
+      torch::distributed::rpc::MessageType::EXCEPTION,
+      recvingRpcMessages[1]->type());
+  EXPECT_EQ(payload2Copy, recvingRpcMessages[1]->payload());
+  EXPECT_EQ(301, recvingRpcMessages[1]->id());
+}
+
 TEST(TensorpipeSerialize, RecopySparseTensors) {
   // Take a 1K row of a 1M tensors, and make sure we don't send across 1M rows.
   constexpr size_t k1K = 1024;
@@ -157,23 +321,64 @@ TEST(TensorpipeSerialize, NoDeleterTensors) {
   EXPECT_EQ(tpBuffers.copiedTensors.size(), 2);
   EXPECT_EQ(sendingTpMessage.tensors.size(), 2);
   EXPECT_EQ(
-      tpBuffers.copiedTensors[0].size(), sendingTpMessage.tensors[0].length);
+      tpBuffers.copiedTensors[0]->size(), sendingTpMessage.tensors[0].length);
   EXPECT_EQ(
-      tpBuffers.copiedTensors[1].size(), sendingTpMessage.tensors[1].length);
+      tpBuffers.copiedTensors[1]->size(), sendingTpMessage.tensors[1].length);
   EXPECT_EQ(
-      tpBuffers.copiedTensors[0].data(),
+      tpBuffers.copiedTensors[0]->data(),
       sendingTpMessage.tensors[0].buffer.unwrap<tensorpipe::CpuBuffer>().ptr);
   EXPECT_EQ(
-      tpBuffers.copiedTensors[1].data(),
+      tpBuffers.copiedTensors[1]->data(),
       sendingTpMessage.tensors[1].buffer.unwrap<tensorpipe::CpuBuffer>().ptr);
   EXPECT_TRUE(
       memcmp(
-          tpBuffers.copiedTensors[0].data(),
+          tpBuffers.copiedTensors[0]->data(),
           t1.storage().data(),
           sendingTpMessage.tensors[0].length) == 0);
   EXPECT_TRUE(
       memcmp(
-          tpBuffers.copiedTensors[1].data(),
+          tpBuffers.copiedTensors[1]->data(),
           t2.storage().data(),
           sendingTpMessage.tensors[1].length) == 0);
 }
+
+TEST(TensorpipeSerialize, NoDeleterTensorsReuseStagingBuffers) {
+  std::vector<float> blob{.8, .2, .6};
+  at::Tensor t = torch::from_blob((float*)(blob.data()), blob.size());
+  std::vector<char> payload = {'1', '2', '3'};
+  torch::distributed::rpc::MessageType mtype =
+      torch::distributed::rpc::MessageType::UNKNOWN;
+
+  auto serialize = [&]() {
+    auto sendingRpcMessage =
+        c10::make_intrusive<torch::distributed::rpc::Message>(
+            std::vector<char>(payload),
+            std::vector<at::Tensor>{t},
+            mtype);
+    tensorpipe::Message sendingTpMessage;
+    torch::distributed::rpc::TensorpipeWriteBuffers tpBuffers;
+    std::tie(sendingTpMessage, tpBuffers) =
+        torch::distributed::rpc::tensorpipeSerialize(
+            std::move(sendingRpcMessage), {}, {});
+    EXPECT_EQ(tpBuffers.copiedTensors.size(), 1);
+    return tpBuffers.copiedTensors[0];
+  };
+
+  // Sequential sends of the same storage reuse the same staging buffer.
+  char* firstPtr = nullptr;
+  {
+    auto firstBuffer = serialize();
+    firstPtr = firstBuffer->data();
+  }
+  blob[0] = .4;
+  auto secondBuffer = serialize();
+  EXPECT_EQ(secondBuffer->data(), firstPtr);
+  // The data is re-copied on every send.
+  EXPECT_TRUE(
+      memcmp(secondBuffer->data(), blob.data(), blob.size() * sizeof(float)) ==
+      0);
+
+  // A buffer still held by an in-flight write is not handed out again.
+  auto thirdBuffer = serialize();
+  EXPECT_NE(thirdBuffer->data(), secondBuffer->data());
+}
@@ -39,6 +39,45 @@ TEST(WireSerialize, Base) {
   run("more", {torch::randn({5, 5}), torch::rand({10, 10})});
 }
 
+TEST(WireSerialize, Segments) {
+  auto run = [](const std::string& payload,
+                const std::vector<at::Tensor>& tensors) {
+    std::vector<char> mpayload(payload.begin(), payload.end());
+    auto wire =
+        torch::distributed::rpc::wireSerializeSegments(mpayload, tensors);
+
+    // One inline segment, plus one segment per pickled tensor that aliases
+    // the tensor's storage in place rather than copying it.
+    EXPECT_EQ(wire.segments.size(), 1 + wire.tensorData.size());
+    for (const auto i : c10::irange(wire.tensorData.size())) {
+      EXPECT_EQ(
+          wire.segments[i + 1].first,
+          static_cast<const char*>(wire.tensorData[i].storage().data()));
+    }
+
+    // Gathering the segments reproduces the contiguous wire format.
+    std::string gathered;
+    for (const auto& segment : wire.segments) {
+      gathered.append(segment.first, segment.second);
+    }
+    auto deser = torch::distributed::rpc::wireDeserialize(
+        gathered.data(), gathered.size());
+    EXPECT_EQ(payload.size(), deser.first.size());
+    EXPECT_EQ(tensors.size(), deser.second.size());
+    if (payload.size() > 0) {
+      EXPECT_TRUE(
+          memcmp(deser.first.data(), payload.data(), payload.size()) == 0);
+    }
+    for (const auto i : c10::irange(tensors.size())) {
+      EXPECT_TRUE(torch::equal(tensors[i], deser.second[i]));
+    }
+  };
+  run("", {});
+  run("hi", {});
+  run("hi", {torch::randn({5, 5})});
+  run("more", {torch::randn({5, 5}), torch::rand({10, 10})});
+}
+
 TEST(WireSerialize, RecopySparseTensors) {
   // Take a 1K row of a 1M tensors, and make sure we don't send across 1M rows.
   constexpr size_t k1K = 1024;
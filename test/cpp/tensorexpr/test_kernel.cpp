@@ -8,6 +8,7 @@
 #include <torch/csrc/jit/passes/constant_propagation.h>
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/tensorexpr/kernel.h>
+#include <torch/csrc/jit/tensorexpr/kernel_cache.h>
 #include <torch/csrc/jit/tensorexpr/loopnest.h>
 #include <torch/csrc/jit/tensorexpr/tensor.h>
 #include <torch/csrc/jit/testing/file_check.h>
@@ -2062,5 +2063,81 @@ TEST_F(Kernel, DoNotFuseLoopsWithMismatchingVariableDims) {
 #endif
 }
 
+TEST_F(Kernel, KernelCacheReusesIdenticalSubgraphs) {
+  const auto graph_string = R"IR(
+      graph(%0 : Float(5, 3, strides=[3, 1], device=cpu),
+            %1 : Float(5, 3, strides=[3, 1], device=cpu)):
+        %2 : Float(5, 3, strides=[3, 1]) = aten::mul(%0, %1)
+        %3 : Float(5, 3, strides=[3, 1]) = aten::mul(%0, %2)
+        return (%3))IR";
+  auto graph1 = std::make_shared<Graph>();
+  parseIR(graph_string, &*graph1);
+  auto graph2 = std::make_shared<Graph>();
+  parseIR(graph_string, &*graph2);
+
+  debugClearTensorExprKernelCache();
+  auto kernel1 = getOrCompileKernel(graph1);
+  auto kernel2 = getOrCompileKernel(graph2);
+  ASSERT_EQ(kernel1, kernel2);
+  ASSERT_EQ(debugNumCachedTensorExprKernels(), 1);
+
+  auto a = at::rand({5, 3}, TensorOptions(kCPU).dtype(at::kFloat));
+  auto b = at::rand({5, 3}, TensorOptions(kCPU).dtype(at::kFloat));
+  std::vector<IValue> stack = fmap<IValue>(std::vector<at::Tensor>({a, b}));
+  kernel2->run(stack);
+  auto o = stack[0].toTensor();
+  ASSERT_TRUE(at::allclose(o, a * (a * b)));
+  debugClearTensorExprKernelCache();
+}
+
+TEST_F(Kernel, KernelCacheDistinguishesSpecializations) {
+  // Same ops, different shape specialization: must not share a kernel.
+  const auto graph_template = R"IR(
+      graph(%0 : Float(${n}, 3, strides=[3, 1], device=cpu),
+            %1 : Float(${n}, 3, strides=[3, 1], device=cpu)):
+        %2 : Float(${n}, 3, strides=[3, 1]) = aten::mul(%0, %1)
+        return (%2))IR";
+  at::jit::TemplateEnv env1;
+  env1.s("n", "5");
+  auto graph1 = std::make_shared<Graph>();
+  parseIR(format(graph_template, env1), &*graph1);
+  at::jit::TemplateEnv env2;
+  env2.s("n", "7");
+  auto graph2 = std::make_shared<Graph>();
+  parseIR(format(graph_template, env2), &*graph2);
+
+  debugClearTensorExprKernelCache();
+  auto kernel1 = getOrCompileKernel(graph1);
+  auto kernel2 = getOrCompileKernel(graph2);
+  ASSERT_NE(kernel1, kernel2);
+  ASSERT_EQ(debugNumCachedTensorExprKernels(), 2);
+  debugClearTensorExprKernelCache();
+}
+
+TEST_F(Kernel, KernelCacheSkipsTensorConstants) {
+  // A tensor constant's payload is not visible in the printed graph, so the
+  // subgraph must bypass the cache.
+  const auto graph_string = R"IR(
+      graph(%0 : Float(3, strides=[1], device=cpu),
+            %1 : Float(3, strides=[1], device=cpu)):
+        %2 : Float(3, strides=[1]) = aten::mul(%0, %1)
+        return (%2))IR";
+  auto graph = std::make_shared<Graph>();
+  parseIR(graph_string, &*graph);
+  {
+    WithInsertionPoint insert_guard(*graph->nodes().begin());
+    auto constant = graph->insertConstant(at::ones({3}));
+    graph->inputs()[1]->replaceAllUsesWith(constant);
+  }
+  graph->eraseInput(1);
+
+  debugClearTensorExprKernelCache();
+  auto kernel1 = getOrCompileKernel(graph);
+  auto kernel2 = getOrCompileKernel(graph);
+  ASSERT_NE(kernel1, kernel2);
+  ASSERT_EQ(debugNumCachedTensorExprKernels(), 0);
+  debugClearTensorExprKernelCache();
+}
+
 } // namespace jit
 } // namespace torch
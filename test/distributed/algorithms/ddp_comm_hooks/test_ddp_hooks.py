@@ -15,6 +15,10 @@ from torch.distributed.algorithms.ddp_comm_hooks import (
     DDPCommHookType,
     register_ddp_comm_hook,
 )
+from torch.distributed.algorithms.ddp_comm_hooks.hierarchical_allreduce_hook import (
+    HierarchicalAllreduceState,
+    hierarchical_allreduce_hook,
+)
 from torch.nn.parallel import DistributedDataParallel
 from torch.testing._internal.common_distributed import (
     MultiProcessTestCase,
@@ -200,6 +204,45 @@ class DistributedDataParallelCommHookTest(MultiProcessTestCase):
 
         torch.testing.assert_allclose(hook_grads, reference_grads, rtol=1e-5, atol=0)
 
+    @requires_nccl()
+    @skip_if_lt_x_gpu(2)
+    def test_ddp_comm_hook_hierarchical_allreduce_hook(self):
+        """
+        This unit test verifies the ``hierarchical allreduce`` hook registered
+        case gives same result with no hook registered case, for every valid
+        subgroup size. With 2 ranks the two-level scheme degenerates on one of
+        its levels either way, which exercises the no-op handling of both the
+        intra-node and the cross-node phase.
+        """
+        store = dist.FileStore(self.file_name, self.world_size)
+        dist.init_process_group(
+            backend="nccl",
+            store=store,
+            rank=self.rank,
+            world_size=self.world_size,
+        )
+        process_group = dist.distributed_c10d._get_default_group()
+
+        # No hook registered case, get the reference grads.
+        reference_grads = self._get_grads(process_group, None)
+
+        for subgroup_size in [1, self.world_size]:
+            state = HierarchicalAllreduceState(subgroup_size=subgroup_size)
+            device_id = gpus_for_rank(self.world_size)[self.rank][0]
+            gpu_model = DistributedDataParallel(
+                TestDdpCommHook().to(device_id),
+                device_ids=[device_id],
+                process_group=process_group,
+            )
+            gpu_model.register_comm_hook(state, hierarchical_allreduce_hook)
+            hook_grads = self._run_and_get_grads(gpu_model)
+
+            torch.testing.assert_allclose(
+                hook_grads, reference_grads, rtol=1e-5, atol=1e-4
+            )
+
+        dist.destroy_process_group()
+
     @requires_nccl()
     @skip_if_lt_x_gpu(2)
     def test_is_last_hook(self):
@@ -2057,16 +2057,24 @@ class DistributedDataParallelTest(
 
     def _test_builtin_ddp_comm_hooks_nccl(self, gradient_as_bucket_view=False):
         """
-        This unit test verifies whether built-in C++ DDP communication hooks ALLREDUCE and FP16_COMPRESS
-        can give the same result with the case of no hook registered.
+        This unit test verifies whether built-in C++ DDP communication hooks ALLREDUCE, FP16_COMPRESS
+        and BF16_COMPRESS can give the same result with the case of no hook registered.
         """
         store = c10d.FileStore(self.file_name, self.world_size)
         process_group = c10d.ProcessGroupNCCL(store, self.rank, self.world_size)
 
-        for comm_hook_type in [
+        hook_types = [
             dist.BuiltinCommHookType.ALLREDUCE,
             dist.BuiltinCommHookType.FP16_COMPRESS,
-        ]:
+        ]
+        if (
+            not TEST_WITH_ROCM
+            and BFLOAT16_AVAILABLE
+            and c10d.is_nccl_available()
+            and torch.cuda.nccl.version() >= (2, 10)
+        ):
+            hook_types.append(dist.BuiltinCommHookType.BF16_COMPRESS)
+        for comm_hook_type in hook_types:
             # Get GPU model with the built-in communication hook.
             gpu_model = self._gpu_model_with_builtin_ddp_comm_hook(
                 process_group, comm_hook_type, gradient_as_bucket_view
@@ -2094,6 +2094,57 @@ class TestFrozenOptimizations(JitTestCase):
 
         self.assertEqual(mod_to_device(*test_vals_to_device), script_mod(*test_vals_to_device))
 
+    def test_linear_autotune(self):
+        class ModLinear(torch.nn.Module):
+            def __init__(self):
+                super(ModLinear, self).__init__()
+                self.bias = torch.nn.Parameter(torch.rand(30))
+                self.weight = torch.nn.Parameter(torch.rand([30, 20]))
+
+            def forward(self, x):
+                return torch._C._nn.linear(x, self.weight, self.bias)
+
+        mod_eager = ModLinear().eval()
+        test_val = torch.rand([50, 20])
+
+        # Without a recorded activation shape there is nothing to time, so the
+        # pass keeps the transposed-matmul form.
+        scripted_mod = torch.jit.freeze(torch.jit.script(mod_eager))
+        self.run_pass("autotune_frozen_linear", scripted_mod.graph)
+        FileCheck().check_not("aten::linear").check("aten::matmul").run(scripted_mod.graph)
+        self.assertEqual(mod_eager(test_val), scripted_mod(test_val))
+
+        # With a traced float32 shape the candidate layouts are timed; the
+        # winner is machine-dependent but must preserve numerics.
+        with set_default_dtype(torch.float):
+            mod_eager = ModLinear().eval()
+            test_val = torch.rand([50, 20])
+            traced_mod = torch.jit.freeze(torch.jit.trace(mod_eager, (test_val,)))
+            self.run_pass("autotune_frozen_linear", traced_mod.graph)
+            self.assertEqual(mod_eager(test_val), traced_mod(test_val))
+
+    def test_linear_autotune_records_choices(self):
+        class ModLinear(torch.nn.Module):
+            def __init__(self):
+                super(ModLinear, self).__init__()
+                self.weight = torch.nn.Parameter(torch.rand([30, 20]))
+
+            def forward(self, x):
+                return torch._C._nn.linear(x, self.weight)
+
+        # Double weights so neither the mkldnn pass nor the timed candidates
+        # claim the op, making the recorded choice deterministic.
+        scripted_mod = torch.jit.script(ModLinear().eval())
+        frozen_mod = torch.jit.optimize_for_inference(scripted_mod)
+
+        self.assertTrue(hasattr(frozen_mod, "linear_layout_choices"))
+        choices = list(frozen_mod.linear_layout_choices)
+        self.assertEqual(len(choices), 1)
+        self.assertTrue("transposed" in choices[0])
+
+        test_val = torch.rand([50, 20])
+        self.assertEqual(scripted_mod(test_val), frozen_mod(test_val))
+
     @staticmethod
     def conv():
         # Generic composable conv for testing purposes
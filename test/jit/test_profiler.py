@@ -43,6 +43,31 @@ class TestProfiler(JitTestCase):
         torch._C._debug_set_fusion_group_inlining(self.old_fusion_inlining)
         torch._C._jit_set_te_must_use_llvm_cpu(self.old_te_must_use_llvm_cpu)
 
+    def test_plan_cache_alternating_shapes(self):
+        old_size = torch._C._jit_set_plan_cache_size(4)
+        try:
+            @torch.jit.script
+            def foo(x, y):
+                return x + y * 2
+
+            a = torch.rand([16, 16])
+            b = torch.rand([8, 8])
+            # warm up a specialized plan for each shape
+            for _ in range(4):
+                foo(a, a)
+            for _ in range(4):
+                foo(b, b)
+            hits = torch._C._jit_plan_cache_hit_count()
+            misses = torch._C._jit_plan_cache_miss_count()
+            # alternating shapes should now both hit their cached plans
+            for _ in range(3):
+                self.assertEqual(foo(a, a), a + a * 2)
+                self.assertEqual(foo(b, b), b + b * 2)
+            self.assertEqual(torch._C._jit_plan_cache_hit_count() - hits, 6)
+            self.assertEqual(torch._C._jit_plan_cache_miss_count(), misses)
+        finally:
+            torch._C._jit_set_plan_cache_size(old_size)
+
     def test_tensor_type_not_determined_by_inputs(self):
         @torch.jit.script
         def scalar_type_input(x, y, z):
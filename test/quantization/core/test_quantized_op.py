@@ -4561,6 +4561,68 @@ class TestQuantizedConv(TestCase):
             device=torch.device("cuda"),
             input_dtype=torch.qint8, weight_dtype=torch.qint8, output_dtype=torch.qint8)
 
+    """Tests the fused post-op chain of quantized::conv2d_epilogue against
+    running the same ops unfused on the conv output."""
+    @skipIfNoFBGEMM
+    def test_qconv2d_epilogue(self):
+        batch_size, in_channels, out_channels = 2, 8, 16
+        height, width = 10, 10
+        X_scale, X_zero_point = 1.3, 2
+        W_scale, W_zero_point = 0.4, 0
+        Y_scale, Y_zero_point = 4.5, 3
+
+        X = torch.rand(batch_size, in_channels, height, width) * 4 - 2
+        W = torch.rand(out_channels, in_channels, 3, 3) * 2 - 1
+        bias = torch.rand(out_channels) * 0.1
+        X_q = torch.quantize_per_tensor(X, X_scale, X_zero_point, torch.quint8)
+        W_q = torch.quantize_per_tensor(W, W_scale, W_zero_point, torch.qint8)
+        w_packed = torch.ops.quantized.conv2d_prepack(
+            W_q, bias, (1, 1), (1, 1), (1, 1), 1)
+
+        Y_q = torch.ops.quantized.conv2d.new(
+            X_q, w_packed, Y_scale, Y_zero_point)
+        accum_q = torch.quantize_per_tensor(
+            torch.rand_like(Y_q.dequantize()) * 4 - 2, 2.1, 1, torch.quint8)
+
+        def requantize(Y):
+            return torch.quantize_per_tensor(
+                Y, Y_scale, Y_zero_point, torch.quint8)
+
+        cases = [
+            (["hardswish"], [], None,
+             lambda Y: torch.nn.functional.hardswish(Y)),
+            (["clamp"], [-1.0, 3.0], None,
+             lambda Y: torch.clamp(Y, -1.0, 3.0)),
+            (["leaky_relu"], [0.1], None,
+             lambda Y: torch.nn.functional.leaky_relu(Y, 0.1)),
+            (["clamp", "hardswish"], [-2.0, 5.0], None,
+             lambda Y: torch.nn.functional.hardswish(torch.clamp(Y, -2.0, 5.0))),
+            (["add"], [], accum_q,
+             lambda Y: Y + accum_q.dequantize()),
+            (["add", "clamp"], [0.0, 6.0], accum_q,
+             lambda Y: torch.clamp(Y + accum_q.dequantize(), 0.0, 6.0)),
+        ]
+        for ops, args, accum, ref_fn in cases:
+            Y_fused = torch.ops.quantized.conv2d_epilogue(
+                X_q, accum, w_packed, ops, args, Y_scale, Y_zero_point)
+            # The unfused reference applies the chain to the dequantized
+            # requantized conv output, matching what the epilogue sees.
+            Y_ref = requantize(ref_fn(Y_q.dequantize()))
+            np.testing.assert_array_almost_equal(
+                Y_ref.int_repr().numpy(), Y_fused.int_repr().numpy(),
+                decimal=0, err_msg=f"epilogue ops: {ops}, args: {args}")
+
+        # Argument validation
+        with self.assertRaisesRegex(RuntimeError, "unsupported epilogue op"):
+            torch.ops.quantized.conv2d_epilogue(
+                X_q, None, w_packed, ["gelu"], [], Y_scale, Y_zero_point)
+        with self.assertRaisesRegex(RuntimeError, "requires the accum"):
+            torch.ops.quantized.conv2d_epilogue(
+                X_q, None, w_packed, ["add"], [], Y_scale, Y_zero_point)
+        with self.assertRaisesRegex(RuntimeError, "missing argument"):
+            torch.ops.quantized.conv2d_epilogue(
+                X_q, None, w_packed, ["clamp"], [0.0], Y_scale, Y_zero_point)
+
     @unittest.skip("used for local benchmarking, comment when we want to run it")
     def test_benchmark(self):
         batch_size = 16
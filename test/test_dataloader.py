@@ -2424,6 +2424,21 @@ except RuntimeError as e:
     assert "set_sharing_strategy" in str(e)
 """])
 
+    def test_resume_after_abandoned_epoch(self):
+        # A fully consumed epoch resumes the workers without draining the
+        # result queue, while an abandoned one has to discard stale results
+        # first. Both kinds of predecessor must keep later epochs correct.
+        dataset = list(range(20))
+        dataloader = self._get_data_loader(dataset, batch_size=2, num_workers=2)
+        expected = [list(range(2 * i, 2 * i + 2)) for i in range(10)]
+        self.assertEqual([batch.tolist() for batch in dataloader], expected)
+        # abandon an epoch mid-way, leaving results in flight
+        for i, batch in enumerate(dataloader):
+            if i == 2:
+                break
+        for _ in range(2):
+            self.assertEqual([batch.tolist() for batch in dataloader], expected)
+
     def test_dataset_not_reset(self):
         dataset = DummyDataset()
         pin_memory_configs = [False]
@@ -1923,6 +1923,16 @@ graph(%Ra, %Rb):
         self.assertEqual(a + b, torch.ops.aten.add(a, b))
         self.assertEqual(a + 1, torch.ops.aten.add(a, 1))
 
+    def test_torch_ops_overloaded_same_arity(self):
+        # same name, arity and kwarg set, but different argument types: the
+        # second call must still reach its own overload (to.other) rather
+        # than reuse whatever the first call (to.dtype) resolved to
+        t = torch.rand(3, 4)
+        other = torch.rand(3, 4, dtype=torch.float64)
+        for _ in range(2):
+            self.assertEqual(torch.ops.aten.to(t, torch.float64).dtype, torch.float64)
+            self.assertEqual(torch.ops.aten.to(t, other).dtype, torch.float64)
+
     def test_torch_ops_kwonly(self):
         a, b = torch.rand(3, 4), torch.rand(3, 4)
         with self.assertRaisesRegex(RuntimeError, "positional argument"):
@@ -121,6 +121,40 @@ class TestAutocast(JitTestCase):
         self.assertEqual(e.dtype, torch.float16)
         self.assertEqual(f.dtype, torch.float16)
 
+    # a value consumed by several ops in one region should only be cast once
+    # (the pass caches and reuses cast results); this is a graph-level check,
+    # so it does not need a CUDA device
+    def test_cast_cse(self):
+        @torch.jit.script
+        def fn(a, b, c):
+            with autocast():
+                x = torch.mm(a, b)
+                y = torch.mm(a, c)
+                z = torch.mm(x, y)
+            return z
+        graph = fn.graph.copy()
+        torch._C._jit_pass_autocast(graph)
+        # without reuse `a` would be cast twice, for 6 casts total
+        FileCheck().check_count(
+            "aten::_autocast_to_reduced_precision", 5, exactly=True
+        ).run(graph)
+
+    # scripted code never reaches autocast.__exit__, so casts must not be
+    # cached anywhere that outlives the forward: an in-place parameter update
+    # has to be visible to the next scripted call
+    @unittest.skipIf(not TEST_CUDA, "No cuda")
+    def test_cast_observes_inplace_update(self):
+        @torch.jit.script
+        def fn(a, b):
+            with autocast():
+                return torch.mm(a, b)
+        a = torch.rand((2, 2), dtype=torch.float32, device='cuda', requires_grad=True)
+        fn(a, self.b_fp32)
+        with torch.no_grad():
+            a.zero_()
+        result = fn(a, self.b_fp32)
+        self.assertEqual(result.abs().sum().item(), 0)
+
     @unittest.skipIf(not TEST_CUDA, "No cuda")
     def test_fp32_policy(self):
         @torch.jit.script
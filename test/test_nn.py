@@ -2405,6 +2405,71 @@ tensor(..., device='meta', size=(1,), requires_grad=True)""")
             clip_grad_norm_([p2], max_norm, norm_type=norm_type)
             self.assertEqual(p1.grad, p2.grad)
 
+    def test_fused_clip_grad_norm(self):
+        from torch.nn.utils.clip_grad import _fused_clip_grad_norm_
+
+        def make_params(dtype, scale):
+            params = []
+            for shape in [(10, 10), (10,), (3, 5)]:
+                p = torch.zeros(shape, dtype=dtype)
+                p.grad = (torch.randn(shape, dtype=torch.double) * scale).to(dtype).detach()
+                params.append(p)
+            return params
+
+        def clone_params(params):
+            clones = []
+            for p in params:
+                q = p.detach().clone()
+                q.grad = p.grad.clone()
+                clones.append(q)
+            return clones
+
+        max_norm = 2.0
+        # scale 1.0 clips; scale 1e-4 exercises the clip_coef >= 1 path,
+        # which must leave the gradients untouched
+        for dtype in [torch.float32, torch.float64]:
+            for norm_type in [1.0, 2.0]:
+                for scale in [1.0, 1e-4]:
+                    ref = make_params(dtype, scale)
+                    fused = clone_params(ref)
+                    expected = clip_grad_norm_(ref, max_norm, norm_type=norm_type)
+                    actual = _fused_clip_grad_norm_(fused, max_norm, norm_type=norm_type)
+                    self.assertEqual(actual.item(), expected.item(), atol=1e-5, rtol=1e-5)
+                    for p, q in zip(ref, fused):
+                        self.assertEqual(q.grad, p.grad, atol=1e-6, rtol=1e-6)
+
+        # reduced precision gradients accumulate the norm in fp32; compare
+        # against the fp32 reference over the same values
+        for dtype in [torch.float16, torch.bfloat16]:
+            p = torch.zeros(64, dtype=dtype)
+            p.grad = torch.linspace(-1, 1, 64).to(dtype).detach()
+            p32 = torch.zeros(64)
+            p32.grad = p.grad.float().detach()
+            expected = clip_grad_norm_([p32], 1.0)
+            actual = _fused_clip_grad_norm_([p], 1.0)
+            self.assertEqual(actual.item(), expected.item(), atol=1e-2, rtol=1e-2)
+            self.assertEqual(p.grad.float(), p32.grad, atol=1e-2, rtol=1e-2)
+
+        # non-contiguous or mixed-dtype gradients fall back to the unfused
+        # path and must still produce the same clipping
+        p1 = torch.zeros(4, 4)
+        p1.grad = torch.randn(4, 8)[:, ::2].detach()
+        self.assertFalse(p1.grad.is_contiguous())
+        p2 = torch.zeros(4, 4, dtype=torch.float64)
+        p2.grad = torch.randn(4, 4, dtype=torch.float64).detach()
+        unfusable = [p1, p2]
+        ref = clone_params(unfusable)
+        expected = clip_grad_norm_(ref, 1.0)
+        actual = _fused_clip_grad_norm_(unfusable, 1.0)
+        self.assertEqual(actual, expected)
+        for p, q in zip(ref, unfusable):
+            self.assertEqual(q.grad, p.grad)
+
+        # but the fallback cannot honour a collective, so requesting one on
+        # unfusable inputs is an error rather than a silently local norm
+        with self.assertRaisesRegex(RuntimeError, "process_group"):
+            _fused_clip_grad_norm_(unfusable, 1.0, process_group=object())
+
     def test_clip_grad_value(self):
         l = nn.Linear(10, 10)
         clip_value = 2.5
@@ -7080,6 +7145,22 @@ tensor(..., device='meta', size=(1,), requires_grad=True)""")
 
                 hx.sum().backward()
 
+    def test_RNN_cpu_inference_fused_cell(self):
+        # The CPU LSTM/GRU cells take a fused pointwise gate kernel under
+        # no_grad; it must agree with the decomposed autograd path.
+        for module, proj_size in ((nn.LSTM, 0), (nn.LSTM, 8), (nn.GRU, 0)):
+            for dtype in (torch.float, torch.double):
+                kwargs = {'proj_size': proj_size} if proj_size else {}
+                rnn = module(16, 32, num_layers=2, bidirectional=True,
+                             **kwargs).to(dtype)
+                input = torch.randn(7, 3, 16, dtype=dtype)
+                output, hidden = rnn(input)
+                with torch.no_grad():
+                    output_inf, hidden_inf = rnn(input)
+                self.assertEqual(output_inf, output)
+                self.assertEqual(hidden_inf, hidden)
+                self.assertFalse(output_inf.requires_grad)
+
     def test_RNN_cell_forward_input_size(self):
         input = torch.randn(3, 11)
         hx = torch.randn(3, 20)
@@ -11617,6 +11698,14 @@ tensor(..., device='meta', size=(1,), requires_grad=True)""")
         self.assertEqual(input.grad.dtype, dtype)
         self.assertEqual(input.grad, inputf.grad.to(dtype), atol=1e-3, rtol=0)
 
+    def test_softmax_cpu_online_variant(self, dtype=torch.float):
+        # Rows larger than the L2 threshold take the online-softmax path of
+        # the CPU kernel; compare it against a double-precision reference.
+        input = torch.rand(2, 70000, device="cpu", dtype=dtype)
+        out = F.softmax(input, dim=-1)
+        ref = F.softmax(input.double(), dim=-1).to(dtype)
+        self.assertEqual(out, ref, atol=1e-6, rtol=0)
+
     def test_adaptive_log_softmax(self):
         # args validation
         with self.assertRaises(ValueError):
@@ -16883,6 +16972,34 @@ torch.cuda.synchronize()
                     rtol = None
                 self.assertEqual(grad, grad_check, msg=msg, atol=atol, rtol=rtol)
 
+    @onlyCPU
+    def test_padded_softmax(self, device):
+        for dtype in [torch.float, torch.double]:
+            for (B, num_heads, L) in [(1, 1, 32), (3, 4, 310), (4, 2, 137)]:
+                input = torch.randn((B, num_heads, L, L), dtype=dtype)
+                seq_lens = torch.randint(0, L + 1, (B,))
+                native_res = torch._padded_softmax(input, seq_lens)
+
+                # Reference: mask out the padded key suffix, softmax, and
+                # zero the padded columns (and fully padded rows).
+                mask = torch.arange(L).expand(B, L) < seq_lens.unsqueeze(1)
+                mask = mask.reshape(B, 1, 1, L)
+                ref = input.masked_fill(~mask, float('-inf')).softmax(dim=-1)
+                ref = torch.nan_to_num(ref).masked_fill(~mask, 0)
+                self.assertEqual(native_res, ref, exact_dtype=True)
+
+        # No padding must match the regular softmax exactly.
+        input = torch.randn(2, 8, 8)
+        seq_lens = torch.full((2,), 8, dtype=torch.long)
+        self.assertEqual(torch._padded_softmax(input, seq_lens),
+                         input.softmax(dim=-1))
+
+        # Shape and dtype validation.
+        with self.assertRaisesRegex(RuntimeError, "1-D int64"):
+            torch._padded_softmax(input, seq_lens.float())
+        with self.assertRaisesRegex(RuntimeError, "one length per batch"):
+            torch._padded_softmax(input, torch.full((3,), 8, dtype=torch.long))
+
     def _slow_masked_softmax(self, input, mask):
         exp = torch.exp(input)
         exp = exp * mask
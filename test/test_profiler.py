@@ -25,7 +25,8 @@ from torch.autograd.profiler import profile as _profile
 from torch.autograd.profiler_legacy import profile as _profile_legacy
 from torch.profiler import (
     kineto_available, profile, record_function, supported_activities,
-    DeviceType, ProfilerAction, ProfilerActivity, ExecutionGraphObserver
+    DeviceType, ProfilerAction, ProfilerActivity, ExecutionGraphObserver,
+    StreamingTraceObserver, streaming_trace_to_chrome_trace
 )
 from torch.testing._internal.common_device_type import skipCUDAVersionIn
 
@@ -428,6 +429,92 @@ class TestExecutionGraph(TestCase):
         assert found_root_node
 
 
+class TestStreamingTrace(TestCase):
+    def test_streaming_trace_capture_and_convert(self):
+        # Binary trace file plus its Chrome trace conversion.
+        fp = tempfile.NamedTemporaryFile('w+b', suffix='.pt.trace', delete=False)
+        fp.close()
+        expected_loop_events = 0
+
+        ob = StreamingTraceObserver()
+        ob.register_callback(fp.name)
+        ob.start()
+        for idx in range(5):
+            expected_loop_events += 1
+            with record_function(f"## LOOP {idx} ##"):
+                x = torch.randn(10, 10)
+                y = torch.randn(10, 10)
+                z = x + y + x * y
+        ob.stop()
+        ob.unregister_callback()
+        assert fp.name == ob.get_output_file_path()
+
+        with tempfile.NamedTemporaryFile('w+t', suffix='.json', delete=False) as out:
+            pass
+        streaming_trace_to_chrome_trace(fp.name, out.name)
+        with open(out.name) as f:
+            trace = json.load(f)
+        events = trace["traceEvents"]
+        loop_count = 0
+        saw_add = False
+        for e in events:
+            assert e["ph"] == "X"
+            assert e["dur"] >= 0
+            if e["name"].startswith("## LOOP "):
+                loop_count += 1
+            if e["name"] == "aten::add":
+                saw_add = True
+        assert loop_count == expected_loop_events
+        assert saw_add
+
+    def test_streaming_trace_start_stop(self):
+        fp = tempfile.NamedTemporaryFile('w+b', suffix='.pt.trace', delete=False)
+        fp.close()
+        expected_loop_events = 0
+        ob = StreamingTraceObserver()
+        ob.register_callback(fp.name)
+        for idx in range(10):
+            if idx == 3:
+                ob.start()
+            elif idx == 5:
+                ob.stop()
+            elif idx == 8:
+                ob.start()
+            elif idx == 9:
+                ob.stop()
+                ob.unregister_callback()
+            if ob._running:
+                expected_loop_events += 1
+            with record_function(f"## LOOP {idx} ##"):
+                x = torch.randn(10, 10)
+                y = x + x
+
+        with tempfile.NamedTemporaryFile('w+t', suffix='.json', delete=False) as out:
+            pass
+        streaming_trace_to_chrome_trace(fp.name, out.name)
+        with open(out.name) as f:
+            trace = json.load(f)
+        loop_count = 0
+        for e in trace["traceEvents"]:
+            if e["name"].startswith("## LOOP "):
+                loop_count += 1
+        assert loop_count == expected_loop_events
+
+    def test_streaming_trace_no_capture(self):
+        fp = tempfile.NamedTemporaryFile('w+b', suffix='.pt.trace', delete=False)
+        fp.close()
+        ob = StreamingTraceObserver()
+        ob.register_callback(fp.name)
+        ob.unregister_callback()
+
+        with tempfile.NamedTemporaryFile('w+t', suffix='.json', delete=False) as out:
+            pass
+        streaming_trace_to_chrome_trace(fp.name, out.name)
+        with open(out.name) as f:
+            trace = json.load(f)
+        assert trace["traceEvents"] == []
+
+
 class TestProfiler(TestCase):
 
     @unittest.skipIf(TEST_WITH_CROSSREF, "crossref intercepts calls and changes the callsite.")
@@ -2219,6 +2219,29 @@ class TestReductions(TestCase):
         self.assertEqual(x.argmax(dim=-2, keepdim=True), torch.zeros(1, n, dtype=torch.int64))
         self.assertEqual(x.argmin(dim=-2, keepdim=True), torch.zeros(1, n, dtype=torch.int64))
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double, torch.half, torch.bfloat16, torch.int, torch.long)
+    def test_argminmax_lastdim_matches_generic(self, device, dtype):
+        # The contiguous last-dim kernel finds the extreme value first and
+        # then scans for its first occurrence; ties and NaNs must resolve the
+        # same way as the generic pair-carrying reduction, which the
+        # transposed (non-last-dim) layout still uses.
+        if dtype.is_floating_point:
+            x = torch.randn(5, 4099, device=device).to(dtype)
+            x[1, 7] = float('nan')
+            x[2, 100] = float('nan')
+            x[2, 4000] = float('nan')
+        else:
+            x = torch.randint(-50, 50, (5, 4099), device=device, dtype=dtype)
+        # Duplicate the extremes so first-occurrence semantics are exercised.
+        x[3, 9] = x[3, 5] = x[3].max()
+        x[4, 11] = x[4, 2] = x[4].min()
+        # A strided last dim falls back to the generic kernel.
+        strided = torch.empty(5, 2 * 4099, device=device, dtype=dtype)[:, ::2]
+        strided.copy_(x)
+        self.assertEqual(x.argmax(dim=-1), strided.argmax(dim=-1))
+        self.assertEqual(x.argmin(dim=-1), strided.argmin(dim=-1))
+
     @dtypes(torch.int, torch.long, torch.float, torch.double)
     @dtypesIfCUDA(torch.int, torch.long, torch.half, torch.float, torch.double)
     def test_median_real_values(self, device, dtype):
@@ -2793,6 +2816,8 @@ class TestReductions(TestCase):
 
         test_against_np(torch.tensor([1., 2, 1], device=device))
         test_against_np(torch.randn(5000, device=device))
+        # large enough to exercise the blocked/parallel CPU fast path
+        test_against_np(torch.randn(100000, device=device))
 
         # Test bins arg
         test_against_np(torch.randn(301, device=device), bins=10)
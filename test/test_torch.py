@@ -2315,6 +2315,30 @@ else:
         # Check that output maintained correct shape
         self.assertEqual(raw_tensor.shape, raw_tensor.grad.shape)
 
+    @onlyCPU
+    def test_cumsum_cumprod_parallel_scan(self, device):
+        # Long contiguous 1D scans take a chunked parallel path; check it
+        # against the row-wise serial kernel and that results do not depend
+        # on the thread count.
+        n = 300000
+        ints = torch.randint(-100, 100, (n,), device=device)
+        self.assertEqual(ints.cumsum(0), ints.unsqueeze(0).cumsum(1).squeeze(0))
+
+        floats = torch.rand(n, device=device)
+        self.assertEqual(floats.cumsum(0), floats.unsqueeze(0).cumsum(1).squeeze(0))
+
+        factors = torch.rand(n, device=device) * 0.02 + 0.99
+        self.assertEqual(factors.cumprod(0), factors.unsqueeze(0).cumprod(1).squeeze(0))
+
+        num_threads = torch.get_num_threads()
+        try:
+            multi_threaded = floats.cumsum(0)
+            torch.set_num_threads(1)
+            single_threaded = floats.cumsum(0)
+        finally:
+            torch.set_num_threads(num_threads)
+        self.assertEqual(multi_threaded, single_threaded, rtol=0, atol=0)
+
     @skipIfMps
     def test_cumprod(self, device):
         x = torch.rand(100, 100, device=device)
@@ -5838,6 +5862,25 @@ class TestTorch(TestCase):
                             dest2[idx[i]] += src[i] * 2
                         self.assertEqual(dest, dest2)
 
+    def test_index_add_parallel_deterministic(self):
+        # The parallel dim-0 fast path must be bitwise identical to the
+        # single-threaded reference, for any thread count and run after run.
+        num_threads = torch.get_num_threads()
+        try:
+            for dtype in [torch.float, torch.double]:
+                for rows, cols, n in [(64, 64, 4096), (3, 128, 2048), (1024, 1, 40000)]:
+                    dest = torch.randn(rows, cols, dtype=dtype)
+                    src = torch.randn(n, cols, dtype=dtype)
+                    idx = torch.randint(0, rows, (n,))
+                    torch.set_num_threads(1)
+                    expected = dest.clone().index_add_(0, idx, src, alpha=0.5)
+                    torch.set_num_threads(num_threads)
+                    for _ in range(2):
+                        actual = dest.clone().index_add_(0, idx, src, alpha=0.5)
+                        self.assertEqual(actual, expected, atol=0, rtol=0)
+        finally:
+            torch.set_num_threads(num_threads)
+
     # FIXME: resolve comment below and move this to indexing test suite
     # add coverage for issue with atomic add that appeared only for
     # specific dtypes on cuda:
@@ -7195,6 +7238,59 @@ tensor([[[1.+1.j, 1.+1.j, 1.+1.j,  ..., 1.+1.j, 1.+1.j, 1.+1.j],
         c = torch.randn(2, 1, 10)[::2].as_strided((2, 1, 5), (10, 0, 2))
         self.assertEqual(torch._debug_has_internal_overlap(c), OVERLAP_TOO_HARD)
 
+    def test_content_hash(self):
+        a = torch.randn(64, 64)
+
+        # Deterministic, and stable across repeated calls (the second call
+        # reads the cached fingerprint keyed on the version counter).
+        h = torch._content_hash(a)
+        self.assertEqual(torch._content_hash(a), h)
+        self.assertEqual(torch._content_hash(a.clone()), h)
+
+        # An in-place op bumps the version counter and dirties the cache.
+        a.add_(1)
+        self.assertNotEqual(torch._content_hash(a), h)
+
+        # Same bytes under a different shape or dtype hash differently.
+        b = torch.zeros(16, dtype=torch.float32)
+        self.assertNotEqual(torch._content_hash(b),
+                            torch._content_hash(b.view(4, 4)))
+        self.assertNotEqual(torch._content_hash(b),
+                            torch._content_hash(b.view(torch.int32)))
+
+        # A whole-storage alias made with set_() has its own version
+        # counter; once the storage has been observed through two counters
+        # no cached value may be served, since a bump of one counter is
+        # invisible to entries keyed on the other.
+        c = torch.randn(64)
+        d = torch.empty(0)
+        d.set_(c)
+        hc = torch._content_hash(c)
+        self.assertEqual(torch._content_hash(d), hc)
+        d.zero_()
+        self.assertNotEqual(torch._content_hash(d), hc)
+        self.assertEqual(torch._content_hash(c), torch._content_hash(d))
+
+        # Views and non-contiguous tensors hash their own window.
+        c = torch.randn(8, 8)
+        self.assertEqual(torch._content_hash(c.t()),
+                         torch._content_hash(c.t().contiguous()))
+        self.assertNotEqual(torch._content_hash(c[:4]), torch._content_hash(c))
+
+    def test_numa_replicate(self):
+        # On single-node machines (and non-NUMA builds) replication is a
+        # no-op; either way the tensor must read back unchanged and the
+        # plumbing must not throw.
+        t = torch.randn(64)
+        expected = t.clone()
+        result = torch._numa_replicate_(t)
+        self.assertTrue(result is t)
+        self.assertIsInstance(torch._is_numa_replicated(t), bool)
+        self.assertEqual(t, expected)
+        if torch.cuda.is_available():
+            with self.assertRaisesRegex(RuntimeError, "CPU tensor"):
+                torch._numa_replicate_(torch.ones(4, device='cuda'))
+
     def test_allow_tensor_metadata_change(self):
         def do_test(t):
             with self.assertRaisesRegex(
@@ -710,5 +710,37 @@ class TestCppExtensionUtils(TestCase):
         self.assertTrue(torch.utils.cpp_extension.check_compiler_ok_for_platform('cc'))
 
 
+class TestSelectiveBuild(TestCase):
+    def test_trace_called_operators(self):
+        from torch.utils.selective_build import trace_called_operators
+
+        with trace_called_operators() as ops:
+            torch.add(torch.ones(2), torch.ones(2))
+        self.assertIn('aten::add.Tensor', ops)
+        # Operators called outside the traced region are not recorded.
+        with trace_called_operators() as ops:
+            pass
+        self.assertNotIn('aten::add.Tensor', ops)
+
+    def test_write_selected_operators_yaml(self):
+        import yaml
+        from torch.utils.selective_build import write_selected_operators_yaml
+
+        with tempfile.TemporaryDirectory() as temp_dir:
+            path = os.path.join(temp_dir, 'selected_operators.yaml')
+            write_selected_operators_yaml(path, {'aten::add.Tensor', 'aten::mul.Tensor'})
+            with open(path) as f:
+                selected = yaml.safe_load(f)
+
+        self.assertTrue(selected['include_all_non_op_selectives'])
+        self.assertEqual(
+            sorted(selected['operators'].keys()),
+            ['aten::add.Tensor', 'aten::mul.Tensor'])
+        for op_info in selected['operators'].values():
+            self.assertTrue(op_info['is_root_operator'])
+            self.assertFalse(op_info['is_used_for_training'])
+            self.assertFalse(op_info['include_all_overloads'])
+
+
 if __name__ == '__main__':
     run_tests()
@@ -554,6 +554,26 @@ class TestVmapAPI(TestCase):
         result = vmap(op, (2, 0))(x, y)
         self.assertEqual(result, op(x.permute(2, 0, 1), y))
 
+    def test_fallback_stats(self):
+        # NB: like test_fallback_atan2, this relies on torch.atan2 not having
+        # a batching rule; replace the operator if one gets implemented.
+        torch._C._debug_reset_vmap_fallback_stats()
+        self.assertEqual(torch._C._debug_vmap_fallback_stats(), {})
+
+        x = torch.randn(5, 7, 11)
+        y = torch.randn(5, 7, 11)
+        vmap(torch.atan2)(x, y)
+        vmap(torch.atan2)(x, y)
+
+        stats = torch._C._debug_vmap_fallback_stats()
+        self.assertIn('aten::atan2', stats)
+        count, total_ns = stats['aten::atan2']
+        self.assertEqual(count, 2)
+        self.assertGreater(total_ns, 0)
+
+        torch._C._debug_reset_vmap_fallback_stats()
+        self.assertEqual(torch._C._debug_vmap_fallback_stats(), {})
+
         # fallback on torch.atan2, nested vmap
         x = torch.randn(7, 11, 5)
         y = torch.randn(5, 7, 11)
@@ -1706,6 +1726,34 @@ class TestVmapOperators(Namespace.TestVmapBase):
         test(vmap(op, in_dims=(0, None)),
              (torch.rand(B1, 2, 5), torch.rand(B0, 5, 2)), in_dims=(None, 0))
 
+    def test_addmm(self):
+        op = torch.addmm
+        test = self._vmap_test
+        B0 = 7
+
+        # shape mismatch
+        msg = "Shape mismatch"
+        with self.assertRaisesRegex(RuntimeError, msg):
+            vmap(op, in_dims=(None, 0, None))(
+                torch.randn(2, 2), torch.randn(B0, 2), torch.randn(2, 2))
+
+        # only mat1 is vmapped
+        test(op, (torch.rand(2, 2), torch.rand(B0, 2, 5), torch.rand(5, 2)),
+             in_dims=(None, 0, None))
+        # only mat2 is vmapped
+        test(op, (torch.rand(2, 2), torch.rand(2, 5), torch.rand(B0, 5, 2)),
+             in_dims=(None, None, 0))
+        # only input is vmapped
+        test(op, (torch.rand(B0, 2, 2), torch.rand(2, 5), torch.rand(5, 2)),
+             in_dims=(0, None, None))
+        # all args are vmapped
+        test(op, (torch.rand(B0, 2, 2), torch.rand(B0, 2, 5), torch.rand(B0, 5, 2)))
+
+        # non-default scaling factors
+        for beta, alpha in [(0, 1), (1, 2), (0.5, 2.5)]:
+            test(functools.partial(op, beta=beta, alpha=alpha),
+                 (torch.rand(B0, 2, 2), torch.rand(B0, 2, 5), torch.rand(B0, 5, 2)))
+
     def test_mv(self):
         op = torch.mv
         test = self._vmap_test
@@ -0,0 +1,110 @@
+# Owner(s): ["module: codegen"]
+
+import os
+import unittest
+
+from torchgen.gen import parse_native_yaml
+from torchgen.mobile.bytecode import Instruction, MobileMethod, OperatorCall
+from torchgen.mobile.gen_aot_model import AotUnsupportedError, generate_aot_cpp
+
+path = os.path.dirname(os.path.realpath(__file__))
+aten_native_path = os.path.join(path, "../../aten/src/ATen/native")
+
+
+def make_method(instructions, operators, constants=(), types=(), register_size=4):
+    return MobileMethod(
+        qualified_name="__torch__.m.forward",
+        instructions=tuple(Instruction(*ins) for ins in instructions),
+        operators=tuple(OperatorCall(*op) for op in operators),
+        constants=tuple(constants),
+        types=tuple(types),
+        register_size=register_size,
+    )
+
+
+class TestGenMobileAot(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls) -> None:
+        cls.native_functions = parse_native_yaml(
+            os.path.join(aten_native_path, "native_functions.yaml"),
+            os.path.join(aten_native_path, "tags.yaml"),
+        ).native_functions
+
+    def generate(self, method):
+        return generate_aot_cpp(method, self.native_functions, model_name="test.ptl")
+
+    def test_straight_line_method(self) -> None:
+        # forward(self, x, y): return torch.relu(torch.add(x, y, alpha=1))
+        method = make_method(
+            instructions=[
+                ("STOREN", 1, 3),
+                ("MOVE", 2, 0),
+                ("MOVE", 3, 0),
+                ("LOADC", 0, 0),
+                ("OP", 0, 0),
+                ("OP", 1, 0),
+                ("RET", 0, 0),
+            ],
+            operators=[
+                ("aten::add", "Tensor", 3),
+                ("aten::relu", "", 1),
+            ],
+            constants=[1],
+        )
+        code = self.generate(method)
+        self.assertIn("at::add(", code)
+        self.assertIn("at::relu(", code)
+        # The alpha constant is a Scalar, inlined rather than read from the
+        # runtime constant table.
+        self.assertIn("static_cast<int64_t>(1)", code)
+        self.assertIn("return std::vector<c10::IValue>", code)
+        self.assertNotIn("constants[", code)
+
+    def test_tensor_constant_stays_in_table(self) -> None:
+        from torchgen.mobile.bytecode import OpaqueConstant
+
+        # forward(self, x): return torch.add(x, <tensor constant>, alpha=1)
+        method = make_method(
+            instructions=[
+                ("STOREN", 1, 2),
+                ("MOVE", 2, 0),
+                ("LOADC", 0, 0),
+                ("LOADC", 1, 0),
+                ("OP", 0, 0),
+                ("RET", 0, 0),
+            ],
+            operators=[("aten::add", "Tensor", 3)],
+            constants=[OpaqueConstant(), 1],
+        )
+        code = self.generate(method)
+        self.assertIn("constants[0]", code)
+
+    def test_control_flow_is_rejected(self) -> None:
+        method = make_method(
+            instructions=[
+                ("STOREN", 1, 2),
+                ("MOVE", 2, 0),
+                ("JF", 3, 0),
+                ("RET", 0, 0),
+            ],
+            operators=[],
+        )
+        with self.assertRaisesRegex(AotUnsupportedError, "JF"):
+            self.generate(method)
+
+    def test_non_aten_op_is_rejected(self) -> None:
+        method = make_method(
+            instructions=[
+                ("STOREN", 1, 2),
+                ("MOVE", 2, 0),
+                ("OP", 0, 0),
+                ("RET", 0, 0),
+            ],
+            operators=[("quantized::linear", "", 2)],
+        )
+        with self.assertRaisesRegex(AotUnsupportedError, "quantized::linear"):
+            self.generate(method)
+
+
+if __name__ == "__main__":
+    unittest.main()
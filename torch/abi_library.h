@@ -0,0 +1,91 @@
+#pragma once
+
+/// \file
+///
+/// C-ABI registration path for out-of-tree kernels.
+///
+/// TORCH_LIBRARY (torch/library.h) registers kernels through template
+/// machinery that must be instantiated in the plugin, which ties the plugin
+/// to the exact compiler and standard library libtorch was built with. The
+/// functions below instead accept a plain C function pointer together with
+/// the operator schema; the unboxing trampoline that adapts the dispatcher's
+/// boxed calling convention to the C signature is built inside libtorch at
+/// registration time, so the plugin boundary is a stable C ABI and the
+/// per-call overhead matches an in-tree boxed wrapper: one precomputed
+/// tag-switch per argument, with no schema inspection on the hot path.
+///
+/// Values cross the boundary as TorchAbiValue tagged unions, one per
+/// argument in schema order followed by one slot per return. Tensor argument
+/// handles are borrowed: they stay valid for the duration of the call and
+/// must not be released by the kernel. Tensor return handles are owned: the
+/// kernel hands over one reference, which libtorch adopts (use
+/// torch_abi_tensor_retain to return an input tensor unchanged).
+///
+/// A kernel reports failure by returning a non-zero value after recording a
+/// message with torch_abi_set_error; the trampoline rethrows it as a c10
+/// error on the calling thread.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <c10/macros/Export.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Opaque handle to a tensor (internally a TensorImpl pointer).
+typedef struct TorchAbiTensorOpaque* TorchAbiTensorHandle;
+
+/// Argument/return types representable across the C boundary. The supported
+/// set maps 1:1 onto schema types: Tensor, int, float, bool.
+typedef enum TorchAbiTypeTag {
+  TORCH_ABI_TAG_TENSOR = 0,
+  TORCH_ABI_TAG_INT64 = 1,
+  TORCH_ABI_TAG_DOUBLE = 2,
+  TORCH_ABI_TAG_BOOL = 3,
+} TorchAbiTypeTag;
+
+typedef union TorchAbiValue {
+  TorchAbiTensorHandle tensor;
+  int64_t int64_value;
+  double double_value;
+  uint8_t bool_value;
+} TorchAbiValue;
+
+/// Kernel entry point. `args` holds `num_args` values in schema order;
+/// the kernel writes its results to the `num_returns` slots of `returns`.
+/// Returns 0 on success, non-zero on failure.
+typedef int (*TorchAbiKernel)(
+    const TorchAbiValue* args,
+    size_t num_args,
+    TorchAbiValue* returns,
+    size_t num_returns);
+
+/// Registers `kernel` for the operator described by `schema` (e.g.
+/// "myops::relu6(Tensor self) -> Tensor"). If no operator with that name
+/// exists yet the schema is registered as well. `dispatch_key` selects the
+/// backend ("CPU", "CUDA", ...); pass NULL to register a catch-all kernel.
+/// Returns 0 on success; on failure returns non-zero and the reason is
+/// available from torch_abi_last_error. The registration lives for the
+/// remainder of the process.
+TORCH_API int torch_abi_register_kernel(
+    const char* schema,
+    const char* dispatch_key,
+    TorchAbiKernel kernel);
+
+/// Increments the reference count of a tensor handle. Needed when a kernel
+/// wants to return one of its (borrowed) argument tensors.
+TORCH_API void torch_abi_tensor_retain(TorchAbiTensorHandle handle);
+
+/// Records an error message for the current thread; meant to be called by a
+/// kernel right before it returns non-zero.
+TORCH_API void torch_abi_set_error(const char* message);
+
+/// Returns the message recorded by the last failing call on this thread, or
+/// an empty string.
+TORCH_API const char* torch_abi_last_error(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
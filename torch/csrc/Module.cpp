@@ -12,6 +12,7 @@
 #include <ATen/LinalgBackend.h>
 #include <ATen/Parallel.h>
 #include <ATen/Utils.h>
+#include <ATen/BatchedFallback.h>
 #include <ATen/VmapMode.h>
 #include <ATen/dlpack.h>
 #include <ATen/core/Vitals.h>
@@ -183,6 +184,36 @@ static PyObject * THPModule_setNumThreads(PyObject *module, PyObject *arg)
   Py_RETURN_NONE;
 }
 
+static PyObject * THPModule_getThreadAffinity(PyObject *module, PyObject *noargs)
+{
+  auto cpus = at::get_thread_affinity();
+  THPObjectPtr tuple(PyTuple_New(cpus.size()));
+  if (!tuple) throw python_error();
+  for (size_t i = 0; i < cpus.size(); ++i) {
+    PyObject* cpu = THPUtils_packInt32(cpus[i]);
+    if (!cpu) throw python_error();
+    PyTuple_SET_ITEM(tuple.get(), i, cpu);
+  }
+  return tuple.release();
+}
+
+static PyObject * THPModule_setThreadAffinity(PyObject *module, PyObject *arg)
+{
+  THPUtils_assert(PySequence_Check(arg), "set_thread_affinity expects a sequence of ints, "
+          "but got %s", THPUtils_typename(arg));
+  THPObjectPtr seq(PySequence_Fast(arg, "expected a sequence"));
+  if (!seq) throw python_error();
+  std::vector<int> cpus;
+  Py_ssize_t length = PySequence_Fast_GET_SIZE(seq.get());
+  for (Py_ssize_t i = 0; i < length; ++i) {
+    PyObject* item = PySequence_Fast_GET_ITEM(seq.get(), i);
+    THPUtils_assert(THPUtils_checkLong(item), "set_thread_affinity expects a sequence of ints");
+    cpus.push_back((int)THPUtils_unpackLong(item));
+  }
+  at::set_thread_affinity(cpus);
+  Py_RETURN_NONE;
+}
+
 static PyObject * THPModule_getNumInteropThreads(PyObject *module, PyObject *noargs)
 {
   return THPUtils_packInt32(at::get_num_interop_threads());
@@ -682,6 +713,8 @@ static PyMethodDef TorchMethods[] = {
   {"_get_backcompat_keepdim_warn", THPModule_getBackcompatKeepdimWarn, METH_NOARGS, nullptr},
   {"get_num_threads", THPModule_getNumThreads,     METH_NOARGS,  nullptr},
   {"set_num_threads", THPModule_setNumThreads,     METH_O,       nullptr},
+  {"get_thread_affinity", THPModule_getThreadAffinity, METH_NOARGS, nullptr},
+  {"set_thread_affinity", THPModule_setThreadAffinity, METH_O,     nullptr},
   {"get_num_interop_threads", THPModule_getNumInteropThreads,     METH_NOARGS,  nullptr},
   {"set_num_interop_threads", THPModule_setNumInteropThreads,     METH_O,       nullptr},
   {"_get_cudnn_enabled", THPModule_userEnabledCuDNN, METH_NOARGS,     nullptr},
@@ -896,6 +929,20 @@ PyObject* initModule() {
   py_module.def("_demangle", &c10::demangle);
   py_module.def("_log_api_usage_once", &LogAPIUsageOnceFromPython);
 
+  py_module.def("_debug_vmap_fallback_stats", []() {
+    // Maps operator name -> (number of fallback invocations, cumulative wall
+    // time in nanoseconds spent in the fallback loop).
+    std::unordered_map<std::string, std::pair<int64_t, int64_t>> result;
+    for (const auto& entry : at::getVmapFallbackStats()) {
+      result.emplace(
+          entry.first,
+          std::make_pair(entry.second.count, entry.second.total_ns));
+    }
+    return result;
+  });
+  py_module.def(
+      "_debug_reset_vmap_fallback_stats", &at::resetVmapFallbackStats);
+
   py_module.def("vitals_enabled", &at::vitals::torchVitalEnabled);
   py_module.def("set_vital", [](const std::string &vital, const std::string &attr, const std::string value){
     return at::vitals::VitalsAPI.setVital(vital, attr, value);
@@ -0,0 +1,205 @@
+#include <torch/abi_library.h>
+
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/ivalue.h>
+#include <ATen/core/stack.h>
+#include <c10/util/SmallVector.h>
+#include <torch/csrc/jit/frontend/function_schema_parser.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+thread_local std::string abi_last_error;
+
+enum class Tag : uint8_t { Tensor, Int64, Double, Bool };
+
+c10::optional<Tag> tagForType(const c10::TypePtr& type) {
+  switch (type->kind()) {
+    case c10::TypeKind::TensorType:
+      return Tag::Tensor;
+    case c10::TypeKind::IntType:
+      return Tag::Int64;
+    case c10::TypeKind::FloatType:
+      return Tag::Double;
+    case c10::TypeKind::BoolType:
+      return Tag::Bool;
+    default:
+      return c10::nullopt;
+  }
+}
+
+std::vector<Tag> tagsForArguments(
+    const std::vector<c10::Argument>& arguments,
+    const char* what) {
+  std::vector<Tag> tags;
+  tags.reserve(arguments.size());
+  for (const auto& argument : arguments) {
+    auto tag = tagForType(argument.type());
+    TORCH_CHECK(
+        tag.has_value(),
+        "torch_abi_register_kernel: unsupported ",
+        what,
+        " type ",
+        argument.type()->str(),
+        " for '",
+        argument.name(),
+        "'; supported types are Tensor, int, float, bool");
+    tags.push_back(*tag);
+  }
+  return tags;
+}
+
+// Boxed dispatcher kernel that adapts the stack to the C calling convention.
+// The tag vectors are computed from the schema once at registration; a call
+// is one switch per argument with no schema inspection.
+class AbiTrampoline final : public c10::OperatorKernel {
+ public:
+  AbiTrampoline(
+      TorchAbiKernel kernel,
+      std::vector<Tag> arg_tags,
+      std::vector<Tag> ret_tags)
+      : kernel_(kernel),
+        arg_tags_(std::move(arg_tags)),
+        ret_tags_(std::move(ret_tags)) {}
+
+  void operator()(
+      const c10::OperatorHandle& op,
+      c10::DispatchKeySet /* unused */,
+      c10::Stack* stack) {
+    const size_t num_args = arg_tags_.size();
+    const size_t num_returns = ret_tags_.size();
+    const size_t base = stack->size() - num_args;
+
+    c10::SmallVector<TorchAbiValue, 8> args(num_args);
+    for (const auto i : c10::irange(num_args)) {
+      const c10::IValue& ivalue = (*stack)[base + i];
+      switch (arg_tags_[i]) {
+        case Tag::Tensor:
+          // Borrowed: the IValue on the stack owns the reference for the
+          // duration of the call.
+          args[i].tensor = reinterpret_cast<TorchAbiTensorHandle>(
+              ivalue.toTensor().unsafeGetTensorImpl());
+          break;
+        case Tag::Int64:
+          args[i].int64_value = ivalue.toInt();
+          break;
+        case Tag::Double:
+          args[i].double_value = ivalue.toDouble();
+          break;
+        case Tag::Bool:
+          args[i].bool_value = ivalue.toBool() ? 1 : 0;
+          break;
+      }
+    }
+
+    c10::SmallVector<TorchAbiValue, 4> returns(num_returns);
+    if (kernel_(args.data(), num_args, returns.data(), num_returns) != 0) {
+      TORCH_CHECK(
+          false,
+          "ABI kernel for ",
+          op.operator_name(),
+          " failed: ",
+          abi_last_error);
+    }
+
+    torch::jit::drop(*stack, num_args);
+    for (const auto i : c10::irange(num_returns)) {
+      switch (ret_tags_[i]) {
+        case Tag::Tensor:
+          // Owned: adopt the reference the kernel handed over.
+          stack->emplace_back(at::Tensor(
+              c10::intrusive_ptr<c10::TensorImpl, c10::UndefinedTensorImpl>::
+                  reclaim(reinterpret_cast<c10::TensorImpl*>(
+                      returns[i].tensor))));
+          break;
+        case Tag::Int64:
+          stack->emplace_back(returns[i].int64_value);
+          break;
+        case Tag::Double:
+          stack->emplace_back(returns[i].double_value);
+          break;
+        case Tag::Bool:
+          stack->emplace_back(returns[i].bool_value != 0);
+          break;
+      }
+    }
+  }
+
+ private:
+  TorchAbiKernel kernel_;
+  std::vector<Tag> arg_tags_;
+  std::vector<Tag> ret_tags_;
+};
+
+// ABI registrations have no RAII owner on the plugin side, so the handles
+// live for the remainder of the process.
+void keepAlive(std::vector<c10::RegistrationHandleRAII> handles) {
+  static std::mutex mutex;
+  static std::vector<c10::RegistrationHandleRAII>& registrations =
+      *new std::vector<c10::RegistrationHandleRAII>();
+  std::lock_guard<std::mutex> guard(mutex);
+  for (auto& handle : handles) {
+    registrations.push_back(std::move(handle));
+  }
+}
+
+} // namespace
+
+int torch_abi_register_kernel(
+    const char* schema,
+    const char* dispatch_key,
+    TorchAbiKernel kernel) {
+  try {
+    TORCH_CHECK(
+        schema != nullptr && kernel != nullptr,
+        "torch_abi_register_kernel: schema and kernel must be non-null");
+    auto parsed = torch::jit::parseSchema(schema);
+    auto arg_tags = tagsForArguments(parsed.arguments(), "argument");
+    auto ret_tags = tagsForArguments(parsed.returns(), "return");
+
+    c10::optional<c10::DispatchKey> key;
+    if (dispatch_key != nullptr && *dispatch_key != '\0') {
+      key = c10::parseDispatchKey(dispatch_key);
+    }
+
+    auto& dispatcher = c10::Dispatcher::singleton();
+    const c10::OperatorName op_name{parsed.name(), parsed.overload_name()};
+    std::vector<c10::RegistrationHandleRAII> handles;
+    if (!dispatcher.findSchema(op_name).has_value()) {
+      handles.push_back(dispatcher.registerDef(parsed, "abi_library"));
+    }
+    handles.push_back(dispatcher.registerImpl(
+        op_name,
+        key,
+        c10::KernelFunction::makeFromBoxedFunctor(
+            std::make_unique<AbiTrampoline>(
+                kernel, std::move(arg_tags), std::move(ret_tags))),
+        c10::nullopt,
+        nullptr,
+        "abi_library"));
+    keepAlive(std::move(handles));
+    return 0;
+  } catch (const std::exception& e) {
+    abi_last_error = e.what();
+    return -1;
+  }
+}
+
+void torch_abi_tensor_retain(TorchAbiTensorHandle handle) {
+  if (handle != nullptr) {
+    c10::raw::intrusive_ptr::incref(
+        reinterpret_cast<c10::TensorImpl*>(handle));
+  }
+}
+
+void torch_abi_set_error(const char* message) {
+  abi_last_error = message != nullptr ? message : "";
+}
+
+const char* torch_abi_last_error(void) {
+  return abi_last_error.c_str();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/data/datasets/base.h>
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <torch/csrc/Export.h>
+
+#include <cstddef>
+#include <string>
+
+namespace torch {
+namespace data {
+namespace datasets {
+
+/// Options for the `CSVDataset`.
+struct TORCH_API CSVDatasetOptions {
+  /// The character separating fields within a row.
+  TORCH_ARG(char, delimiter) = ',';
+  /// Whether to skip the first row of the file (a header line).
+  TORCH_ARG(bool, skip_header) = false;
+  /// If set, the given (zero-based) column is split off into the target
+  /// tensor of each batch instead of the data tensor.
+  TORCH_ARG(optional<size_t>, target_column) = nullopt;
+  /// The dtype the target column is converted to, e.g. `torch::kLong` for
+  /// classification labels. Only used when `target_column` is set.
+  TORCH_ARG(torch::Dtype, target_dtype) = torch::kFloat32;
+};
+
+/// A dataset over a numeric CSV file.
+///
+/// The file is read once at construction and parsed row-wise in parallel
+/// over the intra-op thread pool into a single `[rows, columns]` float tensor
+/// (plus an optional target column), so iteration afterwards is pure tensor
+/// indexing.
+/// Unlike `Dataset` subclasses, batches are emitted pre-collated: `get_batch`
+/// returns one stacked `Example` per batch rather than a vector of rows, so
+/// no per-example stacking transform is required in the data pipeline.
+class TORCH_API CSVDataset : public BatchDataset<CSVDataset, Example<>> {
+ public:
+  /// Loads and parses the CSV file at `path`.
+  explicit CSVDataset(const std::string& path, CSVDatasetOptions options = {});
+
+  /// Returns a single `Example` holding the stacked rows (and targets) for
+  /// the given indices.
+  Example<> get_batch(ArrayRef<size_t> indices) override;
+
+  /// Returns the number of rows in the file.
+  optional<size_t> size() const override;
+
+  /// Returns all rows stacked into a single `[rows, columns]` tensor.
+  const Tensor& data() const;
+
+  /// Returns the target column as a single tensor. Only defined if
+  /// `target_column` was set in the options.
+  const Tensor& targets() const;
+
+ private:
+  Tensor data_, targets_;
+};
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
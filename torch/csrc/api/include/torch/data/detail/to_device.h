@@ -0,0 +1,108 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <c10/core/Stream.h>
+
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// Recursively moves the tensors in a batch to `device`. Tensors that already
+/// live on `device` are returned unchanged, and so are batch types without a
+/// more specific overload. When `non_blocking` is true the copy is merely
+/// enqueued on the current stream; the caller is responsible for ordering any
+/// consumers after it (e.g. via a `c10::Event`).
+template <typename Batch>
+Batch to_device(
+    Batch batch,
+    const Device& /*device*/,
+    bool /*non_blocking*/) {
+  return batch;
+}
+
+inline Tensor to_device(Tensor tensor, const Device& device, bool non_blocking) {
+  if (tensor.defined() && tensor.device() != device) {
+    return tensor.to(device, non_blocking);
+  }
+  return tensor;
+}
+
+template <typename Data, typename Target>
+Example<Data, Target> to_device(
+    Example<Data, Target> example,
+    const Device& device,
+    bool non_blocking) {
+  return {
+      to_device(std::move(example.data), device, non_blocking),
+      to_device(std::move(example.target), device, non_blocking)};
+}
+
+template <typename Data>
+Example<Data, example::NoTarget> to_device(
+    Example<Data, example::NoTarget> example,
+    const Device& device,
+    bool non_blocking) {
+  return Example<Data, example::NoTarget>(
+      to_device(std::move(example.data), device, non_blocking));
+}
+
+template <typename T>
+std::vector<T> to_device(
+    std::vector<T> batch,
+    const Device& device,
+    bool non_blocking) {
+  for (auto& item : batch) {
+    item = to_device(std::move(item), device, non_blocking);
+  }
+  return batch;
+}
+
+template <typename T>
+optional<T> to_device(optional<T> batch, const Device& device, bool non_blocking) {
+  if (batch) {
+    return to_device(std::move(*batch), device, non_blocking);
+  }
+  return batch;
+}
+
+/// Recursively tells the caching allocator that the tensors in a batch are
+/// consumed on `stream`, so their memory is not handed out again while the
+/// consumer stream still has work queued on them. Tensors on other devices and
+/// batch types without a more specific overload are ignored.
+template <typename Batch>
+void record_stream(Batch& /*batch*/, const c10::Stream& /*stream*/) {}
+
+inline void record_stream(Tensor& tensor, const c10::Stream& stream) {
+  if (tensor.defined() && tensor.device() == stream.device()) {
+    tensor.record_stream(stream);
+  }
+}
+
+template <typename Data, typename Target>
+void record_stream(Example<Data, Target>& example, const c10::Stream& stream) {
+  record_stream(example.data, stream);
+  record_stream(example.target, stream);
+}
+
+template <typename Data>
+void record_stream(
+    Example<Data, example::NoTarget>& example,
+    const c10::Stream& stream) {
+  record_stream(example.data, stream);
+}
+
+template <typename T>
+void record_stream(std::vector<T>& batch, const c10::Stream& stream) {
+  for (auto& item : batch) {
+    record_stream(item, stream);
+  }
+}
+
+} // namespace detail
+} // namespace data
+} // namespace torch
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <torch/data/detail/pin_memory.h>
+#include <torch/data/detail/to_device.h>
+#include <torch/data/iterator.h>
+#include <torch/data/worker_exception.h>
+#include <torch/types.h>
+
+#include <torch/csrc/utils/memory.h>
+
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/Exception.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace torch {
+namespace data {
+
+/// Decorates a `DataLoader` iterator range with asynchronous device prefetch.
+///
+/// A background thread pulls batches from the wrapped range, pins them and
+/// copies them to `device` on a stream from the device's global pool, keeping
+/// up to `depth` device-resident batches in flight. Dereferencing the
+/// decorated iterator hands out a batch whose host-to-device copy was issued
+/// during the previous step's compute; the consumer's current stream is
+/// ordered after the copy with an event, so no host synchronization occurs.
+/// For devices without asynchronous streams (e.g. CPU) the copy degenerates
+/// to a synchronous `to()` in the background thread.
+///
+/// A `DevicePrefetcher` wraps exactly one epoch:
+/// ```
+/// auto prefetcher = torch::data::make_device_prefetcher(
+///     *data_loader, torch::kCUDA, /*depth=*/2);
+/// for (auto& batch : *prefetcher) {
+///   // batch tensors are already resident on the device
+/// }
+/// ```
+template <typename Batch>
+class DevicePrefetcher {
+ public:
+  using BatchType = Batch;
+
+  DevicePrefetcher(
+      Iterator<Batch> begin,
+      Iterator<Batch> end,
+      Device device,
+      size_t depth = 2)
+      : current_(std::move(begin)),
+        end_(std::move(end)),
+        device_(device),
+        depth_(depth) {
+    TORCH_CHECK(depth_ > 0, "DevicePrefetcher requires a depth of at least 1");
+    worker_ = std::thread([this] { this->worker_thread(); });
+  }
+
+  DevicePrefetcher(const DevicePrefetcher&) = delete;
+  DevicePrefetcher& operator=(const DevicePrefetcher&) = delete;
+
+  ~DevicePrefetcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+  }
+
+  /// Returns an iterator over the prefetched batches. Like the `DataLoader`
+  /// iterator this is a single-pass input iterator; it compares equal to
+  /// `end()` once the wrapped range is exhausted.
+  Iterator<Batch> begin() {
+    return Iterator<Batch>(torch::make_unique<detail::ValidIterator<Batch>>(
+        [this] { return this->next(); }));
+  }
+
+  Iterator<Batch> end() {
+    return Iterator<Batch>(
+        torch::make_unique<detail::SentinelIterator<Batch>>());
+  }
+
+ private:
+  /// A transferred batch together with the event that marks the completion of
+  /// its copy; an empty batch without exception marks the end of the epoch.
+  struct Result {
+    optional<Batch> batch;
+    optional<c10::Event> ready;
+    std::exception_ptr exception;
+  };
+
+  optional<Batch> next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !results_.empty(); });
+    Result result = std::move(results_.front());
+    results_.pop_front();
+    lock.unlock();
+    // A slot freed up; wake the worker so it can start the next transfer.
+    cv_.notify_all();
+    if (result.exception) {
+      throw WorkerException(result.exception);
+    }
+    if (result.batch && result.ready) {
+      // Order the consumer's current stream after the prefetch copy and let
+      // the caching allocator know the batch is consumed on it.
+      c10::impl::VirtualGuardImpl impl(device_.type());
+      const c10::Stream consumer_stream = impl.getStream(device_);
+      result.ready->block(consumer_stream);
+      detail::record_stream(*result.batch, consumer_stream);
+    }
+    return std::move(result.batch);
+  }
+
+  void worker_thread() {
+    // Transfers go on a dedicated side stream so they overlap with compute
+    // the consumer issues on its own stream.
+    const bool async = device_.is_cuda();
+    optional<c10::Stream> copy_stream;
+    if (async) {
+      c10::impl::VirtualGuardImpl impl(device_.type());
+      copy_stream = impl.getStreamFromGlobalPool(device_);
+    }
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return quit_ || results_.size() < depth_; });
+        if (quit_) {
+          return;
+        }
+      }
+      Result result;
+      try {
+        if (current_ != end_) {
+          Batch batch = std::move(*current_);
+          ++current_;
+          if (async) {
+            c10::StreamGuard guard(*copy_stream);
+            // Pin so the host-to-device copy below is truly asynchronous.
+            batch = detail::to_device(
+                detail::pin_memory(std::move(batch)),
+                device_,
+                /*non_blocking=*/true);
+            result.ready.emplace(device_.type());
+            result.ready->record(*copy_stream);
+          } else {
+            batch = detail::to_device(
+                std::move(batch), device_, /*non_blocking=*/false);
+          }
+          result.batch = std::move(batch);
+        }
+      } catch (...) {
+        result.exception = std::current_exception();
+      }
+      const bool finished = !result.batch.has_value();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        results_.push_back(std::move(result));
+      }
+      cv_.notify_all();
+      if (finished) {
+        // Epoch exhausted (or the wrapped iterator threw); the end marker has
+        // been delivered, so the worker has nothing left to do.
+        return;
+      }
+    }
+  }
+
+  Iterator<Batch> current_;
+  Iterator<Batch> end_;
+  const Device device_;
+  const size_t depth_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Result> results_;
+  bool quit_ = false;
+
+  std::thread worker_;
+};
+
+/// Creates a `DevicePrefetcher` over one epoch of the given `data_loader`,
+/// keeping up to `depth` batches resident on `device`.
+template <typename DataLoader>
+std::unique_ptr<DevicePrefetcher<typename DataLoader::BatchType>>
+make_device_prefetcher(DataLoader& data_loader, Device device, size_t depth = 2) {
+  return torch::make_unique<DevicePrefetcher<typename DataLoader::BatchType>>(
+      data_loader.begin(), data_loader.end(), device, depth);
+}
+
+} // namespace data
+} // namespace torch
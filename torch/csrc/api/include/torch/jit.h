@@ -30,6 +30,11 @@ namespace jit {
 ///   )JIT");
 ///   IValue output = module->run_method("relu_script", a, b);
 /// \endrst
+///
+/// Compilation results are cached process-wide by source string: repeated
+/// calls with identical source return fresh `CompilationUnit`s that share
+/// the parsed graphs copy-on-write instead of re-compiling, so each unit
+/// still optimizes and specializes independently.
 TORCH_API std::shared_ptr<CompilationUnit> compile(const std::string& source);
 
 } // namespace jit
@@ -9,6 +9,7 @@
 #include <torch/nn/modules/container/moduledict.h>
 #include <torch/nn/modules/container/modulelist.h>
 #include <torch/nn/modules/container/named_any.h>
+#include <torch/nn/modules/container/pipeline_sequential.h>
 #include <torch/nn/modules/container/sequential.h>
 #include <torch/nn/modules/container/parameterdict.h>
 #include <torch/nn/modules/container/parameterlist.h>
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/nn/modules/container/sequential.h>
+#include <torch/types.h>
+
+#include <c10/core/Device.h>
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace nn {
+
+/// Options for the `PipelineSequential` module.
+///
+/// Example:
+/// ```
+/// PipelineSequential pipeline(
+///     PipelineSequentialOptions({torch::Device(torch::kCUDA, 0),
+///                                torch::Device(torch::kCUDA, 1)})
+///         .chunks(4)
+///         .max_in_flight(2),
+///     Linear(8, 8), ReLU(), Linear(8, 8));
+/// ```
+struct PipelineSequentialOptions {
+  /* implicit */ PipelineSequentialOptions(std::vector<Device> devices)
+      : devices_(std::move(devices)) {}
+
+  /// The devices the submodules are partitioned across, one per pipeline
+  /// stage, in execution order.
+  TORCH_ARG(std::vector<Device>, devices);
+
+  /// The number of micro-batches the input is split into along dimension 0.
+  TORCH_ARG(int64_t, chunks) = 1;
+
+  /// The maximum number of micro-batches allowed in flight at once. Larger
+  /// values expose more overlap at the cost of keeping more inter-stage
+  /// activations alive; the default of 2 double-buffers them.
+  TORCH_ARG(int64_t, max_in_flight) = 2;
+};
+
+/// A `Sequential` whose submodules are partitioned into pipeline stages
+/// spread across multiple devices.
+///
+/// The submodules are split into as many contiguous, maximally even stages as
+/// there are entries in `options.devices()`, and each stage is moved to its
+/// device. `forward()` splits its input into `options.chunks()` micro-batches
+/// along dimension 0 and streams them through the stages, so that stage `k`
+/// of micro-batch `i` runs concurrently with stage `k + 1` of micro-batch
+/// `i - 1`. When all devices are CUDA devices, each stage executes on its own
+/// stream and stage boundaries are ordered with events; at most
+/// `options.max_in_flight()` micro-batches are in flight at any time, which
+/// bounds the number of live inter-stage activation buffers. On other
+/// devices, where there is no asynchronous stream semantics to exploit, the
+/// micro-batches simply run back to back.
+///
+/// Unlike `Sequential`, every submodule must accept and return a single
+/// `Tensor`, since activations have to be moved between devices at stage
+/// boundaries.
+///
+/// Example:
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::nn::PipelineSequential pipeline(
+///       torch::nn::PipelineSequentialOptions(
+///           {torch::Device(torch::kCUDA, 0), torch::Device(torch::kCUDA, 1)})
+///           .chunks(4),
+///       torch::nn::Linear(3, 4),
+///       torch::nn::ReLU(),
+///       torch::nn::Linear(4, 5));
+///
+///   auto output = pipeline->forward(torch::ones({8, 3}));
+///
+/// \endrst
+// NOLINTNEXTLINE(bugprone-exception-escape)
+class PipelineSequentialImpl : public SequentialImpl {
+ public:
+  explicit PipelineSequentialImpl(PipelineSequentialOptions options_)
+      : options(std::move(options_)) {
+    check_options();
+  }
+
+  /// Constructs the `PipelineSequential` from a variadic list of modules.
+  template <typename... Modules>
+  PipelineSequentialImpl(PipelineSequentialOptions options_, Modules&&... modules)
+      : SequentialImpl(std::forward<Modules>(modules)...),
+        options(std::move(options_)) {
+    check_options();
+  }
+
+  /// Special cloning function for `PipelineSequential` because it does not
+  /// use `reset()`.
+  std::shared_ptr<Module> clone(
+      const optional<Device>& device = nullopt) const override {
+    auto clone = std::make_shared<PipelineSequentialImpl>(options);
+    for (const auto& module : *this) {
+      clone->push_back(module.clone(device));
+    }
+    return clone;
+  }
+
+  /// Pretty prints the `PipelineSequential` module into the given `stream`.
+  void pretty_print(std::ostream& stream) const override {
+    stream << "torch::nn::PipelineSequential";
+  }
+
+  /// Feeds `input` through the pipeline and returns the concatenated outputs
+  /// of the final stage, in micro-batch order.
+  Tensor forward(const Tensor& input) {
+    TORCH_CHECK(
+        !is_empty(), "Cannot call forward() on an empty PipelineSequential");
+    place_stages();
+
+    const auto& devices = options.devices();
+    const auto num_stages = devices.size();
+    const auto chunks = input.chunk(options.chunks(), /*dim=*/0);
+    const auto max_in_flight = options.max_in_flight();
+
+    // Events only have meaning for devices with asynchronous streams; on
+    // other devices every operation below is synchronous anyway.
+    const bool pipelined = std::all_of(
+        devices.begin(), devices.end(), [](const Device& device) {
+          return device.is_cuda();
+        });
+
+    // The micro-batches are produced on the caller's current stream; the
+    // first stage must not read them before they are ready.
+    if (pipelined && input.is_cuda()) {
+      c10::impl::VirtualGuardImpl impl(input.device().type());
+      c10::Event input_ready(input.device().type());
+      input_ready.record(impl.getStream(input.device()));
+      input_ready.block(streams_.front());
+    }
+
+    // One event per stage boundary, re-recorded for every micro-batch. Since
+    // micro-batches are issued in order, blocking on the latest version of
+    // the previous stage's event establishes exactly the producer/consumer
+    // ordering needed at each boundary.
+    std::vector<c10::optional<c10::Event>> stage_done(num_stages);
+    // Completion event of each micro-batch, recorded on the last stage's
+    // stream. Used both to bound the number of micro-batches in flight and
+    // to order the final concatenation after the pipeline.
+    std::vector<c10::Event> batch_done;
+    batch_done.reserve(chunks.size());
+
+    std::vector<Tensor> outputs(chunks.size());
+    for (const auto m : c10::irange(chunks.size())) {
+      if (pipelined &&
+          static_cast<int64_t>(m) >= max_in_flight) {
+        // Bounds activation memory: stage 0 of micro-batch m may not start
+        // until micro-batch m - max_in_flight has fully drained.
+        batch_done[m - max_in_flight].block(streams_.front());
+      }
+
+      Tensor activation = chunks[m];
+      for (const auto stage : c10::irange(num_stages)) {
+        const auto& stream = streams_[stage];
+        c10::StreamGuard guard(stream);
+        if (pipelined && stage > 0) {
+          stage_done[stage - 1]->block(stream);
+        }
+        if (activation.device() != devices[stage]) {
+          if (pipelined && activation.is_cuda()) {
+            // The activation was allocated on the previous stage's stream;
+            // tell the caching allocator it is consumed on this one.
+            activation.record_stream(stream);
+          }
+          activation = activation.to(devices[stage], /*non_blocking=*/pipelined);
+        }
+        for (auto i = stage_begin_[stage]; i < stage_begin_[stage + 1]; ++i) {
+          activation =
+              (begin() + i)->any_forward(std::move(activation)).get<Tensor>();
+        }
+        if (pipelined) {
+          if (!stage_done[stage]) {
+            stage_done[stage].emplace(devices[stage].type());
+          }
+          stage_done[stage]->record(stream);
+        }
+      }
+      if (pipelined) {
+        batch_done.emplace_back(devices.back().type());
+        batch_done.back().record(streams_.back());
+      }
+      outputs[m] = std::move(activation);
+    }
+
+    // Joins the pipeline back onto the caller's current stream before the
+    // outputs are concatenated there.
+    if (pipelined) {
+      c10::impl::VirtualGuardImpl impl(devices.back().type());
+      const auto current = impl.getStream(devices.back());
+      for (auto& event : batch_done) {
+        event.block(current);
+      }
+      for (auto& output : outputs) {
+        output.record_stream(current);
+      }
+    }
+    return torch::cat(outputs, /*dim=*/0);
+  }
+
+  /// The options with which this `PipelineSequential` was constructed.
+  PipelineSequentialOptions options;
+
+ private:
+  void check_options() const {
+    TORCH_CHECK(
+        !options.devices().empty(),
+        "PipelineSequential requires at least one device");
+    TORCH_CHECK(options.chunks() > 0, "chunks must be positive");
+    TORCH_CHECK(options.max_in_flight() > 0, "max_in_flight must be positive");
+  }
+
+  /// Assigns submodules to stages and moves each stage to its device. Called
+  /// at the beginning of every forward() so that modules added via
+  /// `push_back()` after construction are picked up; once the assignment is
+  /// up to date this is a no-op.
+  void place_stages() {
+    const auto& devices = options.devices();
+    const auto num_stages = devices.size();
+    TORCH_CHECK(
+        size() >= num_stages,
+        "PipelineSequential has ",
+        size(),
+        " submodules but ",
+        num_stages,
+        " devices; every stage needs at least one submodule");
+    if (!stage_begin_.empty() && stage_begin_.back() == size()) {
+      return;
+    }
+    // Contiguous, maximally even partition of the submodules over the stages.
+    stage_begin_.resize(num_stages + 1);
+    for (const auto stage : c10::irange(num_stages + 1)) {
+      stage_begin_[stage] = stage * size() / num_stages;
+    }
+    streams_.clear();
+    streams_.reserve(num_stages);
+    for (const auto stage : c10::irange(num_stages)) {
+      for (auto i = stage_begin_[stage]; i < stage_begin_[stage + 1]; ++i) {
+        ptr(i)->to(devices[stage]);
+      }
+      c10::impl::VirtualGuardImpl impl(devices[stage].type());
+      // Each CUDA stage computes on its own stream so that stages of
+      // different micro-batches can overlap.
+      streams_.push_back(
+          devices[stage].is_cuda() ? impl.getStreamFromGlobalPool(devices[stage])
+                                   : impl.getStream(devices[stage]));
+    }
+  }
+
+  /// `stage_begin_[s]` is the index of the first submodule of stage `s`;
+  /// the final entry is the total number of submodules.
+  std::vector<size_t> stage_begin_;
+  /// The per-stage compute streams, parallel to `options.devices()`.
+  std::vector<c10::Stream> streams_;
+};
+
+/// A `ModuleHolder` subclass for `PipelineSequentialImpl`.
+/// See the documentation for `PipelineSequentialImpl` class to learn what
+/// methods it provides, or the documentation for `ModuleHolder` to learn
+/// about PyTorch's module storage semantics.
+TORCH_MODULE(PipelineSequential);
+
+} // namespace nn
+} // namespace torch
@@ -2,4 +2,5 @@
 
 #include <torch/nn/utils/clip_grad.h>
 #include <torch/nn/utils/convert_parameters.h>
+#include <torch/nn/utils/flat_grad_view.h>
 #include <torch/nn/utils/rnn.h>
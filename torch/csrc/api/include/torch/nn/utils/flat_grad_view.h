@@ -0,0 +1,91 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/nn/utils/convert_parameters.h>
+#include <torch/types.h>
+
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace nn {
+namespace utils {
+
+// A FlatGradView allocates one flat buffer covering the gradients of a fixed
+// parameter list and re-points each parameter's `.grad()` at a view into it,
+// the same trick c10d's Reducer plays with its bucket buffers. Once the view
+// is established, the per-step gradient epilogue collapses into single passes
+// over the flat buffer: `zero_()` is one fill instead of one kernel per
+// parameter, `unscale_()` is one fused check-and-scale pass, and `norm()` is
+// one reduction.
+//
+// Autograd accumulates into defined grads in place, so the views survive
+// backward. The views do NOT survive anything that replaces the grad tensor
+// wholesale, e.g. `zero_grad(/*set_to_none=*/true)` or manual assignment to
+// `.mutable_grad()`; after that, the affected parameter silently detaches
+// from the flat buffer. All parameters must share one device and dtype, the
+// same restriction parameters_to_vector imposes.
+class FlatGradView {
+ public:
+  explicit FlatGradView(const std::vector<Tensor>& parameters) {
+    TORCH_CHECK(
+        !parameters.empty(), "FlatGradView expects at least one parameter");
+
+    c10::optional<int64_t> param_device;
+    int64_t total_numel = 0;
+    for (const auto& param : parameters) {
+      param_device = _check_param_device(param, param_device);
+      TORCH_CHECK(
+          param.dtype() == parameters[0].dtype(),
+          "FlatGradView expects all parameters to have the same dtype, but got ",
+          param.dtype(),
+          " and ",
+          parameters[0].dtype());
+      total_numel += param.numel();
+    }
+
+    flat_ = torch::zeros({total_numel}, parameters[0].options());
+
+    int64_t offset = 0;
+    for (const auto& param : parameters) {
+      auto grad_view =
+          flat_.slice(0, offset, offset + param.numel()).view_as(param);
+      if (param.grad().defined()) {
+        grad_view.copy_(param.grad());
+      }
+      param.mutable_grad() = std::move(grad_view);
+      offset += param.numel();
+    }
+  }
+
+  // The flat buffer all tracked gradients alias.
+  const Tensor& flat_gradients() const {
+    return flat_;
+  }
+
+  // Zeroes every tracked gradient with a single kernel.
+  void zero_() {
+    flat_.zero_();
+  }
+
+  // Multiplies every tracked gradient by inv_scale in one pass, writing 1.0
+  // to found_inf if any element is inf or NaN. Mirrors the per-tensor-list
+  // semantics of _amp_foreach_non_finite_check_and_unscale_; pre-zeroing
+  // found_inf is the caller's responsibility.
+  void unscale_(Tensor& found_inf, const Tensor& inv_scale) {
+    torch::_amp_foreach_non_finite_check_and_unscale_(
+        {flat_}, found_inf, inv_scale);
+  }
+
+  // Total gradient norm, computed as one reduction over the flat buffer.
+  Tensor norm(double norm_type = 2.0) const {
+    return flat_.norm(norm_type);
+  }
+
+ private:
+  Tensor flat_;
+};
+
+} // namespace utils
+} // namespace nn
+} // namespace torch
@@ -42,6 +42,7 @@ struct TORCH_API AdagradParamState : public OptimizerCloneableParamState<Adagrad
 public:
   void serialize(torch::serialize::InputArchive& archive) override;
   void serialize(torch::serialize::OutputArchive& archive) const override;
+  int64_t to(const torch::Device& device, bool non_blocking = false) override;
   TORCH_API friend bool operator==(const AdagradParamState& lhs, const AdagradParamState& rhs);
   ~AdagradParamState() override = default;
 };
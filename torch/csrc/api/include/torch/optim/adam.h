@@ -43,6 +43,7 @@ struct TORCH_API AdamParamState : public OptimizerCloneableParamState<AdamParamS
 public:
   void serialize(torch::serialize::InputArchive& archive) override;
   void serialize(torch::serialize::OutputArchive& archive) const override;
+  int64_t to(const torch::Device& device, bool non_blocking = false) override;
   TORCH_API friend bool operator==(const AdamParamState& lhs, const AdamParamState& rhs);
   ~AdamParamState() override = default;
 };
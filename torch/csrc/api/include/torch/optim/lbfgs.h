@@ -48,6 +48,7 @@ struct TORCH_API LBFGSParamState : public OptimizerCloneableParamState<LBFGSPara
  public:
   void serialize(torch::serialize::InputArchive& archive) override;
   void serialize(torch::serialize::OutputArchive& archive) const override;
+  int64_t to(const torch::Device& device, bool non_blocking = false) override;
   TORCH_API friend bool operator==(const LBFGSParamState& lhs, const LBFGSParamState& rhs);
   ~LBFGSParamState() override = default;
 };
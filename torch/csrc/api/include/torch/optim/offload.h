@@ -0,0 +1,105 @@
+#pragma once
+
+#include <torch/optim/optimizer.h>
+
+#include <c10/core/Device.h>
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace torch {
+namespace optim {
+
+/// Builds the inner optimizer that owns one parameter group's state, e.g.:
+/// `[](OptimizerParamGroup g) { return std::make_unique<Adam>(
+///      std::vector<OptimizerParamGroup>{std::move(g)}); }`
+using OptimizerFactory =
+    std::function<std::unique_ptr<Optimizer>(OptimizerParamGroup)>;
+
+/// An optimizer wrapper that keeps optimizer state in pinned CPU memory and
+/// streams it through the accelerator one parameter group at a time, so that
+/// models whose optimizer states do not fit in device memory can still train
+/// on-device. During `step()`, the next group's states are prefetched to the
+/// device on a side stream while the current group's update runs on the
+/// compute stream, and each group's updated states are written back to the
+/// host asynchronously afterwards. When the target device has no accelerator
+/// backend available, the wrapper degrades to stepping the inner optimizers
+/// in place with no copies.
+///
+/// Peak device memory for optimizer state is bounded by the two largest
+/// adjacent groups instead of the total, so splitting parameters into more
+/// groups lowers the bound (at the cost of less copy/compute overlap per
+/// group).
+class TORCH_API OffloadOptimizer {
+ public:
+  /// Per-direction transfer counters, in bytes and wall-clock seconds spent
+  /// issuing the copies. Useful for checking that the interconnect, not the
+  /// optimizer math, is the bottleneck.
+  struct Stats {
+    int64_t bytes_to_device = 0;
+    int64_t bytes_to_host = 0;
+    double seconds_to_device = 0;
+    double seconds_to_host = 0;
+
+    double to_device_bandwidth() const {
+      return seconds_to_device > 0 ? bytes_to_device / seconds_to_device : 0;
+    }
+    double to_host_bandwidth() const {
+      return seconds_to_host > 0 ? bytes_to_host / seconds_to_host : 0;
+    }
+  };
+
+  /// Constructs one inner optimizer per parameter group via `factory`.
+  /// Parameters are expected to live on `device`; only the optimizer states
+  /// are offloaded.
+  OffloadOptimizer(
+      std::vector<OptimizerParamGroup> param_groups,
+      OptimizerFactory factory,
+      Device device = c10::kCUDA);
+
+  /// Runs one optimization step over all groups, overlapping state transfers
+  /// with the per-group updates as described above.
+  Tensor step(Optimizer::LossClosure closure = nullptr);
+
+  /// Zeros out the gradients of all parameters.
+  void zero_grad();
+
+  size_t num_groups() const noexcept {
+    return optimizers_.size();
+  }
+
+  /// The inner optimizer that owns group `index`'s parameters and state.
+  Optimizer& group_optimizer(size_t index) {
+    return *optimizers_.at(index);
+  }
+
+  const Stats& stats() const noexcept {
+    return stats_;
+  }
+
+  void reset_stats() {
+    stats_ = Stats();
+  }
+
+ private:
+  /// Moves group `index`'s states to the device on the copy stream and
+  /// records `prefetch_done_[index]`. No-op when `index` is out of range.
+  void prefetch_group(size_t index);
+  /// Moves group `index`'s states back to pinned host memory on the copy
+  /// stream, after the compute stream's update finished.
+  void offload_group(size_t index, const c10::Stream& compute_stream);
+  int64_t move_group_state(size_t index, const Device& device);
+
+  std::vector<std::unique_ptr<Optimizer>> optimizers_;
+  Device device_;
+  bool streaming_ = false;
+  c10::optional<c10::Stream> copy_stream_;
+  std::vector<c10::Event> prefetch_done_;
+  Stats stats_;
+};
+
+} // namespace optim
+} // namespace torch
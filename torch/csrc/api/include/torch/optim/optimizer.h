@@ -21,6 +21,7 @@ class Tensor;
 } // namespace at
 
 namespace torch {
+using at::Device;
 using at::Tensor;
 namespace serialize {
 class OutputArchive;
@@ -31,12 +32,30 @@ class InputArchive;
 
 namespace torch {
 namespace optim {
+namespace detail {
+
+/// Moves `tensor` to `device` in place and returns the number of bytes
+/// moved (0 for undefined tensors or when it is already there). When
+/// offloading from an accelerator to the CPU the destination is allocated
+/// in pinned memory so the copy can stay asynchronous. Shared by the
+/// `OptimizerParamState::to` overrides.
+TORCH_API int64_t move_state_tensor(
+    Tensor& tensor,
+    const torch::Device& device,
+    bool non_blocking);
+
+} // namespace detail
 
 class TORCH_API OptimizerParamState {
  public:
   virtual std::unique_ptr<OptimizerParamState> clone() const;
   virtual void serialize(torch::serialize::InputArchive& archive);
   virtual void serialize(torch::serialize::OutputArchive& archive) const;
+  /// Moves any tensors held by this state to `device` and returns the
+  /// number of bytes moved (for bandwidth accounting). The default
+  /// implementation moves nothing; states that hold tensors override it.
+  /// Used by `OffloadOptimizer` to stream states between host and device.
+  virtual int64_t to(const torch::Device& device, bool non_blocking = false);
   virtual ~OptimizerParamState() = default;
 };
 
@@ -48,6 +48,7 @@ struct TORCH_API RMSpropParamState : public OptimizerCloneableParamState<RMSprop
  public:
   void serialize(torch::serialize::InputArchive& archive) override;
   void serialize(torch::serialize::OutputArchive& archive) const override;
+  int64_t to(const torch::Device& device, bool non_blocking = false) override;
   TORCH_API friend bool operator==(const RMSpropParamState& lhs, const RMSpropParamState& rhs);
   ~RMSpropParamState() override = default;
 };
@@ -74,6 +74,31 @@ void save(const std::vector<torch::Tensor>& tensor_vec, SaveToArgs&&... args) {
   archive.save_to(std::forward<SaveToArgs>(args)...);
 }
 
+/// Snapshots the given `value` and serializes it to a file at `filename` on
+/// a background thread.
+///
+/// Unlike `torch::save`, this only blocks for as long as it takes to deep
+/// copy the value's tensors; pickling and file I/O then run asynchronously
+/// against the snapshot, so training may keep mutating the original tensors
+/// right away. Wait on the returned future before relying on the file;
+/// serialization errors are rethrown from `get()`.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::nn::Linear model(3, 4);
+///   auto pending = torch::save_async(model, "checkpoint.pt");
+///   // ... keep training while the checkpoint is written ...
+///   pending.get();
+/// \endrst
+template <typename Value>
+std::future<void> save_async(const Value& value, std::string filename) {
+  serialize::OutputArchive archive(
+      std::make_shared<jit::CompilationUnit>());
+  archive << value;
+  return archive.save_to_async(std::move(filename));
+}
+
 TORCH_API std::vector<char> pickle_save(const torch::IValue& ivalue);
 TORCH_API torch::IValue pickle_load(const std::vector<char>& data);
 
@@ -3,6 +3,7 @@
 #include <torch/csrc/Export.h>
 #include <torch/csrc/jit/api/module.h>
 
+#include <future>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -64,6 +65,17 @@ class TORCH_API OutputArchive final {
   /// given writer function.
   void save_to(const std::function<size_t(const void*, size_t)>& func);
 
+  /// Snapshots the archive's current tensor data and saves it to a file at
+  /// `filename` on a background thread.
+  ///
+  /// The calling thread only pays for a deep copy of the tensors (a memcpy,
+  /// or a device copy for non-CPU tensors); pickling and file I/O happen
+  /// asynchronously against the snapshot, so the caller may keep mutating
+  /// the original tensors immediately after this returns. Wait on the
+  /// returned future to ensure the file is complete; serialization errors
+  /// are rethrown from `get()`.
+  std::future<void> save_to_async(std::string filename);
+
   /// Forwards all arguments to `write()`.
   /// Useful for generic code that can be re-used for both `OutputArchive` and
   /// `InputArchive` (where `operator()` forwards to `read()`).
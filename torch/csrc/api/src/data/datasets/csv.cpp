@@ -0,0 +1,203 @@
+#include <torch/data/datasets/csv.h>
+
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <ATen/Parallel.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace datasets {
+namespace {
+
+// A row is a [begin, end) range into the file contents.
+using Row = std::pair<const char*, const char*>;
+
+std::string read_file(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  TORCH_CHECK(file, "Error opening CSV file at ", path);
+  const auto size = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+  std::string contents(size, '\0');
+  if (size != 0) {
+    TORCH_CHECK(
+        file.read(&contents.front(), size),
+        "Error reading CSV file at ",
+        path);
+  }
+  return contents;
+}
+
+// Finds the boundaries of every (non-empty) row. memchr dispatches to the
+// vectorized scanner in libc, so this pass runs at close to memory bandwidth.
+std::vector<Row> index_rows(const std::string& contents) {
+  std::vector<Row> rows;
+  const char* ptr = contents.data();
+  const char* const end = ptr + contents.size();
+  while (ptr < end) {
+    const char* newline =
+        static_cast<const char*>(std::memchr(ptr, '\n', end - ptr));
+    const char* row_end = newline != nullptr ? newline : end;
+    if (row_end > ptr && row_end[-1] == '\r') {
+      --row_end; // CRLF line endings.
+    }
+    if (row_end > ptr) {
+      rows.emplace_back(ptr, row_end);
+    }
+    ptr = newline != nullptr ? newline + 1 : end;
+  }
+  return rows;
+}
+
+size_t count_columns(const Row& row, char delimiter) {
+  return std::count(row.first, row.second, delimiter) + 1;
+}
+
+// Parses one row of `columns` numeric fields into `out`. The row points into
+// the file contents, which are NUL-terminated as a whole, so strtof cannot
+// run off the buffer; it stops at the delimiter or the line terminator.
+void parse_row(
+    const Row& row,
+    char delimiter,
+    int64_t row_number,
+    size_t columns,
+    float* out) {
+  const char* ptr = row.first;
+  for (const auto column : c10::irange(columns)) {
+    char* next = nullptr;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    out[column] = std::strtof(ptr, &next);
+    TORCH_CHECK(
+        next != ptr && next <= row.second,
+        "Malformed numeric field in row ",
+        row_number,
+        ", column ",
+        column);
+    if (column + 1 < columns) {
+      TORCH_CHECK(
+          next < row.second && *next == delimiter,
+          "Expected ",
+          columns,
+          " columns in row ",
+          row_number);
+      ptr = next + 1;
+    } else {
+      TORCH_CHECK(
+          next == row.second,
+          "Expected ",
+          columns,
+          " columns in row ",
+          row_number);
+    }
+  }
+}
+
+Tensor make_index_tensor(ArrayRef<size_t> indices) {
+  auto tensor = torch::empty(
+      {static_cast<int64_t>(indices.size())}, torch::kInt64);
+  auto* data = tensor.data_ptr<int64_t>();
+  std::copy(indices.begin(), indices.end(), data);
+  return tensor;
+}
+
+} // namespace
+
+CSVDataset::CSVDataset(const std::string& path, CSVDatasetOptions options) {
+  const std::string contents = read_file(path);
+  std::vector<Row> rows = index_rows(contents);
+  if (options.skip_header() && !rows.empty()) {
+    rows.erase(rows.begin());
+  }
+
+  if (rows.empty()) {
+    data_ = torch::empty({0, 0});
+    if (options.target_column().has_value()) {
+      targets_ = torch::empty({0}, options.target_dtype());
+    }
+    return;
+  }
+
+  const auto num_rows = static_cast<int64_t>(rows.size());
+  const size_t num_columns = count_columns(rows.front(), options.delimiter());
+  if (options.target_column().has_value()) {
+    TORCH_CHECK(
+        *options.target_column() < num_columns,
+        "Target column ",
+        *options.target_column(),
+        " is out of range for a CSV file with ",
+        num_columns,
+        " columns");
+  }
+
+  auto parsed =
+      torch::empty(
+          {num_rows, static_cast<int64_t>(num_columns)}, torch::kFloat32);
+  float* parsed_data = parsed.data_ptr<float>();
+  // Rows are independent, so the parse fans out over the intra-op pool. The
+  // grain keeps per-task work around GRAIN_SIZE parsed fields.
+  const int64_t grain_size = std::max<int64_t>(
+      at::internal::GRAIN_SIZE / static_cast<int64_t>(num_columns), 1);
+  at::parallel_for(0, num_rows, grain_size, [&](int64_t begin, int64_t end) {
+    for (const auto row : c10::irange(begin, end)) {
+      parse_row(
+          rows[row],
+          options.delimiter(),
+          row,
+          num_columns,
+          parsed_data + row * static_cast<int64_t>(num_columns));
+    }
+  });
+
+  if (options.target_column().has_value()) {
+    const auto target = static_cast<int64_t>(*options.target_column());
+    targets_ = parsed.select(1, target).to(options.target_dtype());
+    auto keep = torch::empty(
+        {static_cast<int64_t>(num_columns) - 1}, torch::kInt64);
+    auto* keep_data = keep.data_ptr<int64_t>();
+    for (const auto column : c10::irange(static_cast<int64_t>(num_columns))) {
+      if (column != target) {
+        *keep_data++ = column;
+      }
+    }
+    data_ = parsed.index_select(1, keep).contiguous();
+  } else {
+    data_ = std::move(parsed);
+  }
+}
+
+Example<> CSVDataset::get_batch(ArrayRef<size_t> indices) {
+  const auto index_tensor = make_index_tensor(indices);
+  Example<> batch;
+  batch.data = data_.index_select(0, index_tensor);
+  if (targets_.defined()) {
+    batch.target = targets_.index_select(0, index_tensor);
+  }
+  return batch;
+}
+
+optional<size_t> CSVDataset::size() const {
+  return data_.size(0);
+}
+
+const Tensor& CSVDataset::data() const {
+  return data_;
+}
+
+const Tensor& CSVDataset::targets() const {
+  return targets_;
+}
+
+} // namespace datasets
+} // namespace data
+} // namespace torch
@@ -1,22 +1,75 @@
 #include <torch/jit.h>
 
+#include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/frontend/ir_emitter.h>
 #include <ATen/core/stack.h>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace torch {
 namespace jit {
 
+namespace {
+
+// Process-wide cache of compiled source strings. Worker processes that are
+// forked or re-deployed with the same preprocessing scripts repeatedly call
+// compile() on identical sources; compiling once and handing out shared
+// graphs makes worker startup pay lexing/parsing/compilation only on the
+// first call. Keyed by the full source string (the map hashes it; equality
+// on the string guards against hash collisions).
+std::mutex compilation_cache_mutex;
+std::unordered_map<std::string, std::shared_ptr<CompilationUnit>>&
+compilationCache() {
+  static auto* cache =
+      new std::unordered_map<std::string, std::shared_ptr<CompilationUnit>>();
+  return *cache;
+}
+
+// Builds an independent CompilationUnit whose functions share the cached
+// unit's unoptimized graphs. The sharing is copy-on-write: GraphFunction
+// copies its graph before optimizing (see optimized_graph()), so each
+// returned unit specializes and optimizes privately while the parsed IR is
+// kept once.
+std::shared_ptr<CompilationUnit> cloneSharingGraphs(
+    const CompilationUnit& unit) {
+  auto clone = std::make_shared<CompilationUnit>();
+  for (Function* function : unit.get_functions()) {
+    auto& graph_function = toGraphFunction(*function);
+    Function* cloned =
+        clone->create_function(function->qualname(), graph_function.graph());
+    // Preserve the schema emitted from the source (e.g. default arguments),
+    // which the default graph-derived schema would lose.
+    cloned->setSchema(function->getSchema());
+  }
+  return clone;
+}
+
+} // namespace
+
 std::shared_ptr<CompilationUnit> compile(const std::string& source) {
+  {
+    std::lock_guard<std::mutex> lock(compilation_cache_mutex);
+    auto it = compilationCache().find(source);
+    if (it != compilationCache().end()) {
+      return cloneSharingGraphs(*it->second);
+    }
+  }
+
+  // Compile outside the lock; concurrent first-time compiles of the same
+  // source race benignly (one result wins the cache slot).
   auto module = std::make_shared<CompilationUnit>();
   module->define(
       c10::nullopt,
       source,
       nativeResolver(),
       nullptr);
-  return module;
+
+  std::lock_guard<std::mutex> lock(compilation_cache_mutex);
+  auto emplaced = compilationCache().emplace(source, module);
+  return cloneSharingGraphs(*emplaced.first->second);
 }
 
 } // namespace jit
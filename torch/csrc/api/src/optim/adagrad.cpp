@@ -62,6 +62,10 @@ void AdagradParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(Tensor, sum);
 }
 
+int64_t AdagradParamState::to(const torch::Device& device, bool non_blocking) {
+  return detail::move_state_tensor(sum_, device, non_blocking);
+}
+
 /// Adapted from
 /// https://github.com/pytorch/pytorch/blob/master/torch/optim/adagrad.py
 Tensor Adagrad::step(LossClosure closure) {
@@ -70,6 +70,14 @@ void AdamWParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(Tensor, max_exp_avg_sq);
 }
 
+int64_t AdamWParamState::to(const torch::Device& device, bool non_blocking) {
+  int64_t bytes = 0;
+  bytes += detail::move_state_tensor(exp_avg_, device, non_blocking);
+  bytes += detail::move_state_tensor(exp_avg_sq_, device, non_blocking);
+  bytes += detail::move_state_tensor(max_exp_avg_sq_, device, non_blocking);
+  return bytes;
+}
+
 Tensor AdamW::step(LossClosure closure)  {
   NoGradGuard no_grad;
   Tensor loss = {};
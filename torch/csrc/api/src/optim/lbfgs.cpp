@@ -112,6 +112,28 @@ void LBFGSParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG_OPTIONAL(std::vector<Tensor>, al);
 }
 
+int64_t LBFGSParamState::to(const torch::Device& device, bool non_blocking) {
+  int64_t bytes = 0;
+  bytes += detail::move_state_tensor(d_, device, non_blocking);
+  bytes += detail::move_state_tensor(H_diag_, device, non_blocking);
+  bytes += detail::move_state_tensor(prev_flat_grad_, device, non_blocking);
+  for (auto& dir : old_dirs_) {
+    bytes += detail::move_state_tensor(dir, device, non_blocking);
+  }
+  for (auto& stp : old_stps_) {
+    bytes += detail::move_state_tensor(stp, device, non_blocking);
+  }
+  for (auto& r : ro_) {
+    bytes += detail::move_state_tensor(r, device, non_blocking);
+  }
+  if (al_.has_value()) {
+    for (auto& a : *al_) {
+      bytes += detail::move_state_tensor(a, device, non_blocking);
+    }
+  }
+  return bytes;
+}
+
 Tensor LBFGS::_gather_flat_grad() {
   std::vector<Tensor> views;
   for (const auto& p : param_groups_.at(0).params()) {
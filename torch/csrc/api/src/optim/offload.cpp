@@ -0,0 +1,127 @@
+#include <torch/optim/offload.h>
+
+#include <torch/cuda.h>
+#include <torch/types.h>
+
+#include <c10/core/DeviceGuard.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+#include <chrono>
+#include <utility>
+
+namespace torch {
+namespace optim {
+namespace {
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+OffloadOptimizer::OffloadOptimizer(
+    std::vector<OptimizerParamGroup> param_groups,
+    OptimizerFactory factory,
+    Device device)
+    : device_(device) {
+  TORCH_CHECK(factory != nullptr, "OffloadOptimizer requires a factory");
+  TORCH_CHECK(
+      !param_groups.empty(),
+      "OffloadOptimizer requires at least one parameter group");
+  optimizers_.reserve(param_groups.size());
+  for (auto& group : param_groups) {
+    auto optimizer = factory(std::move(group));
+    TORCH_CHECK(
+        optimizer != nullptr, "OptimizerFactory returned a null optimizer");
+    optimizers_.push_back(std::move(optimizer));
+  }
+
+  streaming_ = device_.is_cuda() && torch::cuda::is_available();
+  if (streaming_) {
+    c10::impl::VirtualGuardImpl impl(device_.type());
+    if (!device_.has_index()) {
+      device_ = impl.getDevice();
+    }
+    copy_stream_ = impl.getStreamFromGlobalPool(device_);
+    prefetch_done_.reserve(optimizers_.size());
+    for (size_t i = 0; i < optimizers_.size(); ++i) {
+      prefetch_done_.emplace_back(device_.type());
+    }
+    // States created on the device by the first step(s) migrate to the host
+    // the first time offload_group() sees them; nothing to do up front.
+  }
+}
+
+Tensor OffloadOptimizer::step(Optimizer::LossClosure closure) {
+  Tensor loss = {};
+  if (closure != nullptr) {
+    at::AutoGradMode enable_grad(true);
+    loss = closure();
+  }
+  if (!streaming_) {
+    for (auto& optimizer : optimizers_) {
+      optimizer->step();
+    }
+    return loss;
+  }
+
+  c10::DeviceGuard device_guard(device_);
+  c10::impl::VirtualGuardImpl impl(device_.type());
+  const auto compute_stream = impl.getStream(device_);
+
+  prefetch_group(0);
+  for (size_t i = 0; i < optimizers_.size(); ++i) {
+    // The update below must not start before this group's states arrived.
+    prefetch_done_[i].block(compute_stream);
+    prefetch_group(i + 1);
+    optimizers_[i]->step();
+    offload_group(i, compute_stream);
+  }
+  return loss;
+}
+
+void OffloadOptimizer::zero_grad() {
+  for (auto& optimizer : optimizers_) {
+    optimizer->zero_grad();
+  }
+}
+
+void OffloadOptimizer::prefetch_group(size_t index) {
+  if (index >= optimizers_.size()) {
+    return;
+  }
+  // The host-side buffers being uploaded were last written by a device-to-host
+  // copy on this same stream, so ordering within the copy stream suffices.
+  const auto start = std::chrono::steady_clock::now();
+  c10::StreamGuard stream_guard(*copy_stream_);
+  stats_.bytes_to_device += move_group_state(index, device_);
+  prefetch_done_[index].record(*copy_stream_);
+  stats_.seconds_to_device += seconds_since(start);
+}
+
+void OffloadOptimizer::offload_group(
+    size_t index,
+    const c10::Stream& compute_stream) {
+  const auto start = std::chrono::steady_clock::now();
+  // The copy stream must not read the states before the compute stream's
+  // update finished writing them.
+  c10::Event update_done(device_.type());
+  update_done.record(compute_stream);
+  c10::StreamGuard stream_guard(*copy_stream_);
+  update_done.block(*copy_stream_);
+  stats_.bytes_to_host += move_group_state(index, Device(torch::kCPU));
+  stats_.seconds_to_host += seconds_since(start);
+}
+
+int64_t OffloadOptimizer::move_group_state(size_t index, const Device& device) {
+  int64_t bytes = 0;
+  for (auto& entry : optimizers_[index]->state()) {
+    bytes += entry.second->to(device, /*non_blocking=*/true);
+  }
+  return bytes;
+}
+
+} // namespace optim
+} // namespace torch
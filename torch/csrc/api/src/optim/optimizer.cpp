@@ -4,12 +4,44 @@
 #include <torch/ordered_dict.h>
 #include <torch/types.h>
 
+#include <c10/core/impl/VirtualGuardImpl.h>
+
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace torch {
 namespace optim {
+namespace detail {
+
+int64_t move_state_tensor(
+    Tensor& tensor,
+    const torch::Device& device,
+    bool non_blocking) {
+  if (!tensor.defined() || tensor.device() == device) {
+    return 0;
+  }
+  if (device.is_cpu() && !tensor.device().is_cpu()) {
+    // A pinned destination keeps the device-to-host copy asynchronous.
+    auto dst = torch::empty(
+        tensor.sizes(), tensor.options().device(device).pinned_memory(true));
+    dst.copy_(tensor, non_blocking);
+    if (non_blocking) {
+      // The device tensor is released as soon as it is replaced below; keep
+      // its memory out of allocator reuse until the in-flight copy read it.
+      c10::impl::VirtualGuardImpl impl(tensor.device().type());
+      impl.recordDataPtrOnStream(
+          tensor.storage().data_ptr(), impl.getStream(tensor.device()));
+    }
+    tensor = std::move(dst);
+  } else {
+    tensor = tensor.to(
+        tensor.options().device(device), non_blocking, /*copy=*/false);
+  }
+  return tensor.nbytes();
+}
+
+} // namespace detail
 
 bool OptimizerParamGroup::has_options() const {
   return options_ != nullptr;
@@ -56,6 +88,12 @@ void OptimizerParamState::serialize(torch::serialize::OutputArchive& archive) co
     "You must override it in your subclass of torch::optim::OptimizerCloneableParamState<YourOptimizerParamState>.");
 }
 
+int64_t OptimizerParamState::to(
+    const torch::Device& /*device*/,
+    bool /*non_blocking*/) {
+  return 0;
+}
+
 double OptimizerOptions::get_lr() const {
   TORCH_CHECK(false, "double get_lr() has not been overidden and implemented in subclass of torch::optim::OptimizerOptions, you must override it in your subclass.");
 }
@@ -70,6 +70,14 @@ void RMSpropParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(Tensor, grad_avg);
 }
 
+int64_t RMSpropParamState::to(const torch::Device& device, bool non_blocking) {
+  int64_t bytes = 0;
+  bytes += detail::move_state_tensor(square_avg_, device, non_blocking);
+  bytes += detail::move_state_tensor(momentum_buffer_, device, non_blocking);
+  bytes += detail::move_state_tensor(grad_avg_, device, non_blocking);
+  return bytes;
+}
+
 /// Adapted from
 /// https://github.com/pytorch/pytorch/blob/master/torch/optim/rmsprop.py
 Tensor RMSprop::step(LossClosure closure)  {
@@ -61,6 +61,10 @@ void SGDParamState::serialize(torch::serialize::InputArchive& archive) {
   _TORCH_OPTIM_DESERIALIZE_TORCH_ARG(Tensor, momentum_buffer);
 }
 
+int64_t SGDParamState::to(const torch::Device& device, bool non_blocking) {
+  return detail::move_state_tensor(momentum_buffer_, device, non_blocking);
+}
+
 Tensor SGD::step(LossClosure closure)  {
   NoGradGuard no_grad;
   Tensor loss = {};
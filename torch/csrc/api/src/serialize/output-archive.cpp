@@ -8,9 +8,11 @@
 
 #include <c10/util/Exception.h>
 
+#include <future>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 
 namespace torch {
 namespace serialize {
@@ -47,5 +49,18 @@ void OutputArchive::save_to(
     const std::function<size_t(const void*, size_t)>& func) {
   jit::ExportModule(module_, func);
 }
+
+std::future<void> OutputArchive::save_to_async(std::string filename) {
+  // Deep-copying the module snapshots all tensor data up front, so the
+  // caller can keep mutating the original tensors while the much slower
+  // pickling, checksumming and file I/O run on the background thread.
+  auto snapshot = module_.deepcopy();
+  return std::async(
+      std::launch::async,
+      [snapshot = std::move(snapshot),
+       filename = std::move(filename)]() mutable {
+        jit::ExportModule(snapshot, filename);
+      });
+}
 } // namespace serialize
 } // namespace torch
@@ -2,6 +2,7 @@
 
 #include <torch/csrc/autograd/autograd.h>
 #include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/accumulate_grad.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/anomaly_mode.h>
@@ -17,15 +18,20 @@
 #include <c10/core/Stream.h>
 #include <c10/core/Event.h>
 #include <c10/core/DeviceGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/env.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 #include <c10/util/Optional.h>
 #include <c10/util/ThreadLocal.h>
 #include <c10/core/StreamGuard.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -64,6 +70,83 @@ inline bool should_run_in_cpu_ready_queue(c10::DeviceType device) {
     return false;
   }
 }
+
+// Opt-in: route leaf gradient accumulation to a dedicated side stream per
+// device so it overlaps with the remaining backward compute.
+// See Note [Streaming backwards].
+bool side_stream_accumulation_enabled() {
+  static const bool enabled =
+      c10::utils::check_env("TORCH_AUTOGRAD_SIDE_STREAM_ACCUMULATION") == true;
+  return enabled;
+}
+
+// One dedicated accumulation stream per device. Sharing a single stream per
+// device keeps accumulations into the same grad ordered across backward
+// calls (e.g. gradient accumulation over micro-batches) without any
+// per-variable bookkeeping.
+c10::Stream accumulation_stream_for_device(c10::Device device) {
+  static std::mutex mutex;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::vector<c10::optional<c10::Stream>> streams;
+  const auto guard = c10::impl::VirtualGuardImpl{c10::DeviceType::CUDA};
+  std::lock_guard<std::mutex> lock(mutex);
+  if (streams.size() <= static_cast<size_t>(device.index())) {
+    streams.resize(device.index() + 1);
+  }
+  auto& opt_stream = streams[device.index()];
+  if (!opt_stream.has_value()) {
+    opt_stream = guard.getStreamFromGlobalPool(device);
+  }
+  return *opt_stream;
+}
+
+// If `func` is an AccumulateGrad whose grads live on a CUDA stream and side
+// stream accumulation has been requested, returns the device's dedicated
+// accumulation stream, synced (via an event) with the parent stream that
+// produced the incoming grads. The caller must guard onto the returned
+// stream and record it as the node's leaf stream, so that
+// GraphTask::exec_post_processing syncs the caller's current streams with
+// the accumulation work and the user-facing stream semantics of a
+// backward() call are unchanged.
+c10::optional<c10::Stream> accumulate_grad_side_stream(
+    Node* func,
+    const c10::optional<c10::Stream>& opt_parent_stream,
+    InputBuffer& inputs) {
+  if (!opt_parent_stream.has_value() || !side_stream_accumulation_enabled()) {
+    return c10::nullopt;
+  }
+  if (!dynamic_cast<AccumulateGrad*>(func)) {
+    return c10::nullopt;
+  }
+  auto side_stream = accumulation_stream_for_device(opt_parent_stream->device());
+  if (side_stream == *opt_parent_stream) {
+    return c10::nullopt;
+  }
+  {
+    c10::OptionalDeviceGuard device_guard{opt_parent_stream->device()};
+    auto event = c10::Event{c10::DeviceType::CUDA};
+    event.record(*opt_parent_stream);
+    side_stream.wait(event);
+  }
+  // InputBuffer::add made the incoming grads safe to consume on the parent
+  // stream; now that they're consumed on the side stream instead, the
+  // caching allocator must not recycle their blocks until the side stream
+  // is done with them.
+  const auto guard = c10::impl::VirtualGuardImpl{c10::DeviceType::CUDA};
+  for (const auto i : c10::irange(inputs.size())) {
+    auto var = inputs[i];
+    if (!var.defined() || !var.device().is_cuda()) {
+      continue;
+    }
+    if (var.is_sparse()) {
+      guard.recordDataPtrOnStream(var._indices().storage().data_ptr(), side_stream);
+      guard.recordDataPtrOnStream(var._values().storage().data_ptr(), side_stream);
+    } else {
+      guard.recordDataPtrOnStream(var.storage().data_ptr(), side_stream);
+    }
+  }
+  return side_stream;
+}
 }
 
 // Threads spawned by the engine are assigned a 'worker_device' specifying
@@ -237,6 +320,169 @@ bool ReadyQueue::empty() const {
   return heap_.empty();
 }
 
+std::shared_ptr<ReadyQueue> ReadyQueue::create() {
+  static const bool use_lock_free = [] {
+    const char* env = getenv("TORCH_AUTOGRAD_LOCKFREE_READYQUEUE");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  if (use_lock_free) {
+    return std::make_shared<LockFreeReadyQueue>();
+  }
+  return std::make_shared<ReadyQueue>();
+}
+
+LockFreeReadyQueue::LockFreeReadyQueue() : ring_(kRingSize) {
+  for (const auto i : c10::irange(kRingSize)) {
+    ring_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool LockFreeReadyQueue::try_push_ring(NodeTask& item) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Cell& cell = ring_[pos & (kRingSize - 1)];
+    const size_t seq = cell.sequence.load(std::memory_order_acquire);
+    const intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+    if (dif == 0) {
+      if (enqueue_pos_.compare_exchange_weak(
+              pos, pos + 1, std::memory_order_relaxed)) {
+        cell.task.emplace(std::move(item));
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (dif < 0) {
+      // Ring is full.
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool LockFreeReadyQueue::try_pop_ring(NodeTask& out) {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Cell& cell = ring_[pos & (kRingSize - 1)];
+    const size_t seq = cell.sequence.load(std::memory_order_acquire);
+    const intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+    if (dif == 0) {
+      if (dequeue_pos_.compare_exchange_weak(
+              pos, pos + 1, std::memory_order_relaxed)) {
+        out = std::move(*cell.task);
+        cell.task.reset();
+        cell.sequence.store(pos + kRingSize, std::memory_order_release);
+        return true;
+      }
+    } else if (dif < 0) {
+      // Ring is empty.
+      return false;
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void LockFreeReadyQueue::push_overflow(NodeTask item) {
+  {
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    overflow_.push(std::move(item));
+  }
+}
+
+auto LockFreeReadyQueue::push(NodeTask item, bool incrementOutstandingTasks)
+    -> void {
+  if (incrementOutstandingTasks) {
+    std::shared_ptr<GraphTask> graph_task = item.base_.lock();
+    TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
+    ++graph_task->outstanding_tasks_;
+  }
+  // Reentrant and sentinel tasks depend on the depth-based priority order;
+  // everything else takes the lock-free ring, overflowing to the heap.
+  const bool needs_priority =
+      item.isShutdownTask_ || !item.fn_ || item.getReentrantDepth() > 0;
+  if (needs_priority || !try_push_ring(item)) {
+    push_overflow(std::move(item));
+  }
+  // Only pay for the wakeup mutex when a consumer is actually parked.
+  if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    wakeup_cv_.notify_one();
+  }
+}
+
+auto LockFreeReadyQueue::pushShutdownTask() -> void {
+  push_overflow(NodeTask({}, nullptr, InputBuffer(0), true));
+  std::lock_guard<std::mutex> lock(overflow_mutex_);
+  wakeup_cv_.notify_all();
+}
+
+auto LockFreeReadyQueue::pop() -> NodeTask {
+  // Sentinel/reentrant tasks are rare; check the heap cheaply first so they
+  // are not starved behind a steady stream of ring tasks.
+  {
+    std::unique_lock<std::mutex> lock(overflow_mutex_, std::try_to_lock);
+    if (lock.owns_lock() && !overflow_.empty()) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      auto task = std::move(const_cast<NodeTask&>(overflow_.top()));
+      overflow_.pop();
+      return task;
+    }
+  }
+  NodeTask task({}, nullptr, InputBuffer(0));
+  if (try_pop_ring(task)) {
+    return task;
+  }
+  // Spin briefly before parking: backward graphs with many small nodes
+  // usually produce the next task within a few hundred cycles.
+  for (int spin = 0; spin < 512; ++spin) {
+    if (try_pop_ring(task)) {
+      return task;
+    }
+    std::this_thread::yield();
+  }
+  return pop_blocking();
+}
+
+auto LockFreeReadyQueue::pop_blocking() -> NodeTask {
+  NodeTask task({}, nullptr, InputBuffer(0));
+  std::unique_lock<std::mutex> lock(overflow_mutex_);
+  sleepers_.fetch_add(1, std::memory_order_seq_cst);
+  while (true) {
+    if (!overflow_.empty()) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      task = std::move(const_cast<NodeTask&>(overflow_.top()));
+      overflow_.pop();
+      break;
+    }
+    // Re-check the ring while holding the mutex: a producer that saw no
+    // sleepers must have published its task before we registered.
+    if (try_pop_ring(task)) {
+      break;
+    }
+    wakeup_cv_.wait_for(lock, std::chrono::milliseconds(10));
+  }
+  sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+  return task;
+}
+
+bool LockFreeReadyQueue::empty() const {
+  {
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    if (!overflow_.empty()) {
+      return false;
+    }
+  }
+  return dequeue_pos_.load(std::memory_order_acquire) >=
+      enqueue_pos_.load(std::memory_order_acquire);
+}
+
+size_t LockFreeReadyQueue::size() const {
+  std::lock_guard<std::mutex> lock(overflow_mutex_);
+  const size_t enq = enqueue_pos_.load(std::memory_order_acquire);
+  const size_t deq = dequeue_pos_.load(std::memory_order_acquire);
+  return overflow_.size() + (enq > deq ? enq - deq : 0);
+}
+
 Engine::Engine() : max_recursion_depth_(MAX_DEPTH), non_reentrant_device_thread_count_(0) {}
 
 Engine::~Engine() {
@@ -807,8 +1053,15 @@ void Engine::evaluate_function(
   // ensure they're safe to consume in the context of the present
   // func's stream (if applicable). So we guard onto that stream
   // before working with the grads in any capacity.
+  // Leaf gradient accumulation may optionally be routed to a dedicated
+  // side stream instead, with event-based ordering against the parent
+  // stream, so that it overlaps with the remaining backward compute.
   const auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
-  c10::OptionalStreamGuard parent_stream_guard{opt_parent_stream};
+  const auto opt_side_stream =
+      accumulate_grad_side_stream(func, opt_parent_stream, inputs);
+  const auto& opt_fn_stream =
+      opt_side_stream.has_value() ? opt_side_stream : opt_parent_stream;
+  c10::OptionalStreamGuard parent_stream_guard{opt_fn_stream};
 
   // If exec_info_ is not empty, we have to instrument the execution
   auto& exec_info_ = graph_task->exec_info_;
@@ -823,9 +1076,9 @@ void Engine::evaluate_function(
         for (auto& hook : capture.hooks_) {
           captured_grad = (*hook)(captured_grad);
         }
-        if (opt_parent_stream) {
+        if (opt_fn_stream) {
           // No need to take graph_task->mutex_ here, we already hold it
-          graph_task->leaf_streams.emplace(*opt_parent_stream);
+          graph_task->leaf_streams.emplace(*opt_fn_stream);
         }
       }
     }
@@ -846,9 +1099,9 @@ void Engine::evaluate_function(
   if (num_outputs == 0) { // Note: doesn't acquire the mutex
     // Records leaf stream (if applicable)
     // See Note [Streaming backwards]
-    if (opt_parent_stream) {
+    if (opt_fn_stream) {
       std::lock_guard<std::mutex> lock(graph_task->mutex_);
-      graph_task->leaf_streams.emplace(*opt_parent_stream);
+      graph_task->leaf_streams.emplace(*opt_fn_stream);
     }
     return;
   }
@@ -947,8 +1200,119 @@ inline static uint64_t compute_min_topological_nr(const edge_list& outputs) {
   return min_topo_nr;
 }
 
+namespace {
+
+// Declared-static backward replay (see Engine::set_static_graph_replay).
+//
+// A training loop that retains its graph and re-executes backward each
+// iteration pays for a full graph traversal per call just to rebuild the
+// dependency counts. When replay is enabled, the counts computed for a
+// backward graph are snapshotted together with a cheap structure hash;
+// a later backward over the same root with a matching hash copies the
+// snapshot instead of re-traversing the graph. A single slot suffices:
+// there is one static training loop per process in practice.
+struct StaticGraphSnapshot {
+  Node* root = nullptr;
+  uint64_t min_topo_nr = 0;
+  size_t structure_hash = 0;
+  bool will_use_cuda = false;
+  std::unordered_map<Node*, int> dependencies;
+};
+
+std::atomic<bool> static_graph_replay_{false};
+std::mutex static_graph_snapshot_mutex_;
+StaticGraphSnapshot static_graph_snapshot_;
+
+// Hashes the op names and fan-outs of a bounded region of the graph below
+// the root. This is a cheap validity check for snapshot reuse, not a full
+// fingerprint: it catches a changed or freed-and-rebuilt graph near the
+// root without paying for a full traversal (which is exactly the cost the
+// snapshot exists to avoid).
+size_t staticGraphStructureHash(Node* root) {
+  constexpr size_t kMaxVisitedNodes = 64;
+  std::vector<Node*> visited;
+  visited.reserve(kMaxVisitedNodes);
+  std::vector<Node*> stack{root};
+  size_t hash = 0;
+  while (!stack.empty() && visited.size() < kMaxVisitedNodes) {
+    Node* fn = stack.back();
+    stack.pop_back();
+    if (std::find(visited.begin(), visited.end(), fn) != visited.end()) {
+      continue;
+    }
+    visited.push_back(fn);
+    hash = c10::hash_combine(hash, std::hash<std::string>()(fn->name()));
+    hash = c10::hash_combine(hash, fn->next_edges().size());
+    // Node addresses and sequence numbers distinguish a retained graph from
+    // a structurally identical graph that was freed and rebuilt (possibly at
+    // the same addresses); the latter must not reuse pointer-keyed counts.
+    hash = c10::hash_combine(hash, reinterpret_cast<size_t>(fn));
+    hash = c10::hash_combine(hash, static_cast<size_t>(fn->sequence_nr()));
+    for (const auto& edge : fn->next_edges()) {
+      if (edge.function) {
+        stack.push_back(edge.function.get());
+      }
+    }
+  }
+  return hash;
+}
+
+bool tryReuseStaticGraphSnapshot(
+    Node* root,
+    uint64_t min_topo_nr,
+    GraphTask& task) {
+  if (!static_graph_replay_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(static_graph_snapshot_mutex_);
+  if (static_graph_snapshot_.root != root ||
+      static_graph_snapshot_.min_topo_nr != min_topo_nr ||
+      static_graph_snapshot_.structure_hash != staticGraphStructureHash(root)) {
+    return false;
+  }
+  task.dependencies_ = static_graph_snapshot_.dependencies;
+  if (static_graph_snapshot_.will_use_cuda) {
+    task.stash_current_streams();
+  }
+  return true;
+}
+
+void snapshotStaticGraph(
+    Node* root,
+    uint64_t min_topo_nr,
+    const GraphTask& task,
+    bool will_use_cuda) {
+  if (!static_graph_replay_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(static_graph_snapshot_mutex_);
+  static_graph_snapshot_.root = root;
+  static_graph_snapshot_.min_topo_nr = min_topo_nr;
+  static_graph_snapshot_.structure_hash = staticGraphStructureHash(root);
+  static_graph_snapshot_.will_use_cuda = will_use_cuda;
+  static_graph_snapshot_.dependencies = task.dependencies_;
+}
+
+} // namespace
+
+void Engine::set_static_graph_replay(bool enabled) {
+  static_graph_replay_.store(enabled, std::memory_order_relaxed);
+  if (!enabled) {
+    std::lock_guard<std::mutex> lock(static_graph_snapshot_mutex_);
+    static_graph_snapshot_ = StaticGraphSnapshot();
+  }
+}
+
+bool Engine::static_graph_replay_enabled() {
+  return static_graph_replay_.load(std::memory_order_relaxed);
+}
+
 auto Engine::compute_dependencies(Node* root, GraphTask& task, uint64_t min_topo_nr) -> void {
   // Computes the number of dependencies for each function which requires grad
+  if (tryReuseStaticGraphSnapshot(root, min_topo_nr, task)) {
+    return;
+  }
+
   std::unordered_set<Node*> seen;
   std::vector<Node*> queue { root };
   bool might_use_cuda = at::globalContext().hasCUDA();
@@ -979,6 +1343,12 @@ auto Engine::compute_dependencies(Node* root, GraphTask& task, uint64_t min_topo
     // so GraphTask::exec_post_processing can sync them with leaf_streams.
     task.stash_current_streams();
   }
+
+  // Only a retained graph can be executed again, so only then is the
+  // snapshot ever reusable.
+  if (task.keep_graph_) {
+    snapshotStaticGraph(root, min_topo_nr, task, will_use_cuda);
+  }
 }
 
 auto Engine::execute(const edge_list& roots,
@@ -1177,7 +1547,7 @@ void Engine::init_local_ready_queue(std::shared_ptr<ReadyQueue> ready_queue) {
     local_ready_queue = std::move(ready_queue);
   } else if (!local_ready_queue){
     // otherwise if local_ready_queue not allocated, allocate a new ready_queue
-    local_ready_queue = std::make_shared<ReadyQueue>();
+    local_ready_queue = ReadyQueue::create();
   }
 }
 
@@ -1236,7 +1606,7 @@ auto Engine::start_device_threads() -> void {
   // types), and pre-allocate the device_ready_queues_ to ensure safe reading on it.
   device_ready_queues_ = std::vector<std::shared_ptr<ReadyQueue>>(num_devices);
   for (auto& queue : device_ready_queues_)    {
-    queue = std::make_shared<ReadyQueue>();
+    queue = ReadyQueue::create();
   }
 
   for (const auto i : c10::irange(num_devices)) {
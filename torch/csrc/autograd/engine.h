@@ -243,7 +243,7 @@ class CheckpointValidGuard {
 
 
 struct ReadyQueue {
- private:
+ protected:
   // Returns true when t2 should be (weakly) BEFORE t1 in the queue.
   // Shutdown tasks are first and then empty NodeTask are next.
   struct CompareNodeTaskTime {
@@ -275,11 +275,66 @@ struct ReadyQueue {
   // 'outstanding_tasks_' for the associated GraphTask. This should mostly
   // always be true and is only set false in certain cases (see docs for
   // DistEngine.execute_graph_task_until_ready_queue_empty)
-  void push(NodeTask item, bool incrementOutstandingTasks = true);
-  void pushShutdownTask();
-  NodeTask pop();
-  bool empty() const;
-  size_t size() const;
+  virtual void push(NodeTask item, bool incrementOutstandingTasks = true);
+  virtual void pushShutdownTask();
+  virtual NodeTask pop();
+  virtual bool empty() const;
+  virtual size_t size() const;
+  virtual ~ReadyQueue() = default;
+
+  // Returns either a ReadyQueue or, when TORCH_AUTOGRAD_LOCKFREE_READYQUEUE=1
+  // is set, a LockFreeReadyQueue. All engine call sites construct their
+  // queues through this factory so the two implementations never mix within
+  // one process.
+  static std::shared_ptr<ReadyQueue> create();
+};
+
+// A mostly lock-free ReadyQueue for backward passes with many small nodes,
+// where the single mutex + priority_queue above becomes the scaling
+// bottleneck on high-core-count machines.
+//
+// Ordinary (non-reentrant) tasks go through a bounded lock-free MPMC ring
+// buffer; the sequence_nr priority order of the base class is a locality
+// heuristic rather than a correctness requirement, so FIFO order inside the
+// ring is acceptable. Shutdown tasks, dummy tasks, and reentrant tasks --
+// which do rely on the depth-based priority -- as well as ring overflow fall
+// back to the locked heap of the base class. Consumers spin briefly on the
+// ring before parking on the base-class condition variable, and producers
+// only take the wakeup mutex when a consumer is parked.
+struct LockFreeReadyQueue final : ReadyQueue {
+  LockFreeReadyQueue();
+  void push(NodeTask item, bool incrementOutstandingTasks = true) override;
+  void pushShutdownTask() override;
+  NodeTask pop() override;
+  bool empty() const override;
+  size_t size() const override;
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    c10::optional<NodeTask> task;
+  };
+
+  bool try_push_ring(NodeTask& item);
+  bool try_pop_ring(NodeTask& out);
+  void push_overflow(NodeTask item);
+  NodeTask pop_blocking();
+
+  static constexpr size_t kRingBits = 10; // 1024 slots
+  static constexpr size_t kRingSize = size_t(1) << kRingBits;
+
+  // Vyukov-style bounded MPMC queue.
+  std::vector<Cell> ring_;
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+
+  // Overflow heap shared with reentrant/shutdown tasks; reuses the base
+  // class ordering. Guarded by overflow_mutex_.
+  mutable std::mutex overflow_mutex_;
+  std::priority_queue<NodeTask, std::vector<NodeTask>, CompareNodeTaskTime>
+      overflow_;
+  std::condition_variable wakeup_cv_;
+  std::atomic<int64_t> sleepers_{0};
 };
 
 // A single instance of this struct should be created through the whole process lifetime.
@@ -290,6 +345,15 @@ struct TORCH_API Engine {
 
   static Engine& get_base_engine();
 
+  // Declared-static backward replay: after a warmup backward over a retained
+  // graph, the engine snapshots the graph's dependency counts, and later
+  // backward calls over the same graph (validated by a cheap structure hash
+  // over op names, fan-outs, and sequence numbers near the root) reuse them
+  // instead of re-traversing the whole graph. Only the GraphTask setup is
+  // replayed; gradients themselves are recomputed normally.
+  static void set_static_graph_replay(bool enabled);
+  static bool static_graph_replay_enabled();
+
   Engine(const Engine&) = delete;
   Engine(Engine&&) = delete;
   virtual ~Engine();
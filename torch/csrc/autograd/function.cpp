@@ -7,8 +7,12 @@
 #include <ATen/ATen.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -16,6 +20,178 @@
 
 namespace torch { namespace autograd {
 
+namespace {
+
+// [Node allocation pool]
+//
+// Every differentiable op allocates a Node (and most free one shortly after
+// backward), so for small-op-dominated training the global allocator sees
+// millions of short-lived, similarly sized allocations per second. Nodes are
+// also usually freed on a different thread (the engine's backward threads)
+// than the forward thread that allocated them, which rules out a plain
+// thread-local cache: the forward thread would keep growing while the
+// backward thread accumulated blocks it never reuses.
+//
+// Instead, each thread owns a pool that carves blocks out of bump-allocated
+// slabs, and every block carries a header naming its pool and size class.
+// Frees from the owning thread go onto a local freelist; frees from other
+// threads are pushed onto a mutex-protected remote list, which the owner
+// splices into its local freelist when that runs dry - so recycled blocks
+// flow back to the thread that allocates. A pool is kept alive by a
+// reference count (one reference per outstanding block, plus one for the
+// owning thread) and its slabs are only released once its thread has exited
+// and the last block has been freed. Blocks larger than kMaxPooledBytes
+// (rare; Nodes with unusually large inline state) fall through to the
+// global allocator.
+constexpr size_t kBlockAlign = alignof(std::max_align_t);
+constexpr size_t kGranularityBytes = 64;
+constexpr size_t kMaxPooledBytes = 1024;
+constexpr size_t kNumSizeClasses = kMaxPooledBytes / kGranularityBytes;
+constexpr size_t kSlabBytes = 64 * 1024;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+class NodePool {
+ public:
+  void* allocate(size_t block_bytes, uint32_t size_class) {
+    FreeBlock* block = free_lists_[size_class];
+    if (block == nullptr) {
+      drainRemoteFrees(size_class);
+      block = free_lists_[size_class];
+    }
+    if (block != nullptr) {
+      free_lists_[size_class] = block->next;
+      return block;
+    }
+    if (slab_remaining_ < block_bytes) {
+      slabs_.emplace_back(new char[kSlabBytes]);
+      slab_ptr_ = slabs_.back().get();
+      slab_remaining_ = kSlabBytes;
+    }
+    void* result = slab_ptr_;
+    slab_ptr_ += block_bytes;
+    slab_remaining_ -= block_bytes;
+    return result;
+  }
+
+  // Only called by the owning thread.
+  void freeLocal(FreeBlock* block, uint32_t size_class) {
+    block->next = free_lists_[size_class];
+    free_lists_[size_class] = block;
+  }
+
+  void freeRemote(FreeBlock* block, uint32_t size_class) {
+    std::lock_guard<std::mutex> lock(remote_mutex_);
+    block->next = remote_free_lists_[size_class];
+    remote_free_lists_[size_class] = block;
+  }
+
+  void retain() {
+    refcount_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void release() {
+    if (refcount_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+ private:
+  void drainRemoteFrees(uint32_t size_class) {
+    std::lock_guard<std::mutex> lock(remote_mutex_);
+    free_lists_[size_class] = remote_free_lists_[size_class];
+    remote_free_lists_[size_class] = nullptr;
+  }
+
+  std::array<FreeBlock*, kNumSizeClasses> free_lists_{};
+  char* slab_ptr_ = nullptr;
+  size_t slab_remaining_ = 0;
+  std::vector<std::unique_ptr<char[]>> slabs_;
+
+  std::mutex remote_mutex_;
+  std::array<FreeBlock*, kNumSizeClasses> remote_free_lists_{};
+
+  // One reference per outstanding block plus one for the owning thread.
+  std::atomic<size_t> refcount_{1};
+};
+
+struct alignas(kBlockAlign) BlockHeader {
+  NodePool* pool; // nullptr for blocks from the global allocator
+  uint32_t size_class;
+};
+static_assert(
+    sizeof(BlockHeader) == kBlockAlign,
+    "BlockHeader must preserve max_align_t alignment of the payload");
+
+struct PoolHolder {
+  NodePool* pool = nullptr;
+  ~PoolHolder() {
+    if (pool != nullptr) {
+      // Drop the owning thread's reference; the pool lives on until its
+      // last outstanding block is freed. Clear the pointer so frees from
+      // thread-local destructors that run after this one take the remote
+      // path instead of touching a possibly-deleted pool.
+      pool->release();
+      pool = nullptr;
+    }
+  }
+};
+thread_local PoolHolder pool_holder;
+
+void* poolAllocate(size_t bytes) {
+  const size_t block_bytes = kGranularityBytes *
+      ((bytes + sizeof(BlockHeader) + kGranularityBytes - 1) /
+       kGranularityBytes);
+  if (block_bytes > kMaxPooledBytes) {
+    void* raw = ::operator new(sizeof(BlockHeader) + bytes);
+    auto* header = new (raw) BlockHeader{nullptr, 0};
+    return reinterpret_cast<char*>(header) + sizeof(BlockHeader);
+  }
+  if (C10_UNLIKELY(pool_holder.pool == nullptr)) {
+    pool_holder.pool = new NodePool();
+  }
+  NodePool* pool = pool_holder.pool;
+  pool->retain();
+  const auto size_class =
+      static_cast<uint32_t>(block_bytes / kGranularityBytes - 1);
+  void* raw = pool->allocate(block_bytes, size_class);
+  auto* header = new (raw) BlockHeader{pool, size_class};
+  return reinterpret_cast<char*>(header) + sizeof(BlockHeader);
+}
+
+void poolDeallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto* header = reinterpret_cast<BlockHeader*>(
+      static_cast<char*>(ptr) - sizeof(BlockHeader));
+  NodePool* pool = header->pool;
+  if (pool == nullptr) {
+    ::operator delete(header);
+    return;
+  }
+  const auto size_class = header->size_class;
+  auto* block = reinterpret_cast<FreeBlock*>(header);
+  if (pool == pool_holder.pool) {
+    pool->freeLocal(block, size_class);
+  } else {
+    pool->freeRemote(block, size_class);
+  }
+  pool->release();
+}
+
+} // namespace
+
+void* Node::operator new(size_t size) {
+  return poolAllocate(size);
+}
+
+void Node::operator delete(void* ptr) {
+  poolDeallocate(ptr);
+}
+
 // The current evaluating node. This is useful to assign the current node as a
 // parent of new nodes created during the evaluation of this node in anomaly
 // mode.
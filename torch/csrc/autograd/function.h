@@ -461,6 +461,14 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
     return false;
   }
 
+  /// Nodes are allocated and freed at very high rates when training
+  /// small-op-dominated models, and are usually freed on a different thread
+  /// (the engine's backward thread) than the forward thread that allocated
+  /// them. Route them through a recycling slab pool instead of the global
+  /// allocator. See [Node allocation pool] in function.cpp.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
  protected:
   /// Performs the `Node`'s actual operation.
   virtual variable_list apply(variable_list&& inputs) = 0;
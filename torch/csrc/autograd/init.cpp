@@ -6,6 +6,7 @@
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/engine.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <ATen/autocast_mode.h>
@@ -23,6 +24,7 @@
 #include <torch/csrc/autograd/record_function_ops.h>
 #include <torch/csrc/utils/pycfunction_helpers.h>
 #include <torch/csrc/profiler/execution_graph_observer.h>
+#include <torch/csrc/profiler/streaming_trace_observer.h>
 #include <c10/core/ScalarType.h>
 #include <ATen/PythonTorchFunctionTLS.h>
 
@@ -310,6 +312,12 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
   m.def("_enable_execution_graph_observer", &torch::profiler::impl::enableExecutionGraphObserver);
   m.def("_disable_execution_graph_observer", &torch::profiler::impl::disableExecutionGraphObserver);
 
+  // PyTorch profiler streaming trace internal interface.
+  m.def("_add_streaming_trace_observer", &torch::profiler::impl::addStreamingTraceObserver, py::arg("output_file_name"));
+  m.def("_remove_streaming_trace_observer", &torch::profiler::impl::removeStreamingTraceObserver);
+  m.def("_enable_streaming_trace_observer", &torch::profiler::impl::enableStreamingTraceObserver);
+  m.def("_disable_streaming_trace_observer", &torch::profiler::impl::disableStreamingTraceObserver);
+
   // NOTICE: These record functions are not torch operators and may not show up
   // in TorchScript tracing, FX transforms, or operator serialization. For these
   // use cases, please use `torch.profiler.record_function`.
@@ -385,6 +393,12 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
   m.def("_pop_saved_tensors_default_hooks", []() {
     torch::autograd::PyDefaultSavedVariableHooks::pop_hooks();
   });
+  m.def("_set_static_graph_replay", [](bool enabled) {
+    torch::autograd::Engine::set_static_graph_replay(enabled);
+  });
+  m.def("_is_static_graph_replay_enabled", []() {
+    return torch::autograd::Engine::static_graph_replay_enabled();
+  });
 
   _C_m.def("_register_py_class_for_device", [](const std::string& device, py::object python_type_class) {
     auto cls = python_type_class.ptr();
@@ -587,6 +601,26 @@ static PyObject * is_anomaly_mode_enabled(PyObject* _unused, PyObject *arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject * set_saved_variable_trimming_enabled(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (!PyBool_Check(arg)) {
+    throw TypeError("enabled must be a bool (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  SavedVariableTrimming::set_enabled(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * is_saved_variable_trimming_enabled(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (SavedVariableTrimming::is_enabled()) {
+    Py_RETURN_TRUE;
+  } else {
+    Py_RETURN_FALSE;
+  }
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject * python_enter_dual_level(PyObject* _unused, PyObject* arg) {
   HANDLE_TH_ERRORS
   // It is unlikely that the depth of forward nesting will overflow int64_t so we
@@ -683,6 +717,8 @@ static PyMethodDef methods[] = { // NOLINT
   {"set_autocast_cache_enabled", set_autocast_cache_enabled, METH_O, nullptr},
   {"set_anomaly_enabled", set_anomaly_mode_enabled, METH_O, nullptr},
   {"is_anomaly_enabled", is_anomaly_mode_enabled, METH_NOARGS, nullptr},
+  {"_set_saved_variable_trimming_enabled", set_saved_variable_trimming_enabled, METH_O, nullptr},
+  {"_is_saved_variable_trimming_enabled", is_saved_variable_trimming_enabled, METH_NOARGS, nullptr},
   {"_enter_dual_level", python_enter_dual_level, METH_NOARGS, nullptr},
   {"_exit_dual_level", castPyCFunctionWithKeywords(python_exit_dual_level), METH_VARARGS | METH_KEYWORDS, nullptr},
   {"_set_torch_dispatch_mode", set_torch_dispatch_mode, METH_O, nullptr},
@@ -38,6 +38,8 @@ struct InputBuffer {
 
   Variable operator[](size_t pos) { return buffer[pos]; }
 
+  size_t size() const { return buffer.size(); }
+
   // Returns the inputs as a list of variables. Destroys given InputBuffer.
   static std::vector<Variable> variables(InputBuffer&& g);
 
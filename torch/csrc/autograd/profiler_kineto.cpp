@@ -76,8 +76,9 @@ struct EventFieldsVisitor {
       KinetoEvent& kineto_event,
       const post_process_t& post_process)
       : kineto_event_{kineto_event},
-        post_process_{post_process} {
-    pushPythonMetadata(result->parent_.lock());
+        post_process_{post_process},
+        parent_{result->parent_.lock()} {
+    pushPythonMetadata(parent_);
     c10::visit(*this, result->extra_fields_);
     handleStack(result->parent_);
   }
@@ -155,6 +156,37 @@ struct EventFieldsVisitor {
     if (alloc.total_reserved_ >= 0) {
       annotations_.emplace_back("Total Reserved", std::to_string(alloc.total_reserved_));
     }
+    if (alloc.segment_ptr_ != nullptr) {
+      annotations_.emplace_back(
+          "Segment Addr",
+          std::to_string(reinterpret_cast<intptr_t>(alloc.segment_ptr_)));
+      annotations_.emplace_back(
+          "Segment Size", std::to_string(alloc.segment_size_));
+    }
+    handleAllocatingOp();
+  }
+
+  // build_tree has already placed allocation events under the op that was
+  // live when the allocator fired; surface that linkage (plus the op's input
+  // shapes) so memory traces can be correlated without the op timeline.
+  void handleAllocatingOp() {
+    auto parent = parent_;
+    while (parent != nullptr &&
+           !c10::holds_alternative<ExtraFields<EventType::TorchOp>>(
+               parent->extra_fields_)) {
+      parent = parent->parent_.lock();
+    }
+    if (parent == nullptr) {
+      return;
+    }
+    annotations_.emplace_back("Allocating Op", parent->name());
+    annotations_.emplace_back(
+        "Allocating Op Id", std::to_string(parent->correlationID()));
+    auto& shapes = c10::get<ExtraFields<EventType::TorchOp>>(
+        parent->extra_fields_).inputs_.shapes_;
+    if (!shapes.empty()) {
+      annotations_.emplace_back("Allocating Op Input Dims", shapesToStr(shapes));
+    }
   }
 
   template <typename T>
@@ -242,6 +274,7 @@ struct EventFieldsVisitor {
 
   std::reference_wrapper<KinetoEvent> kineto_event_;
   std::reference_wrapper<const post_process_t> post_process_;
+  std::shared_ptr<Result> parent_;
   std::vector<PythonMetadata> py_metadata_;
   annotation_t annotations_;
 };
@@ -278,7 +311,9 @@ struct KinetoThreadLocalState : public ProfilerThreadLocalStateBase {
       int64_t alloc_size,
       int64_t total_allocated,
       int64_t total_reserved,
-      c10::Device device) override {
+      c10::Device device,
+      void* segment_ptr,
+      int64_t segment_size) override {
     if (config_.profile_memory && config_.state != ProfilerState::Disabled) {
       record_queue_.getSubqueue()->emplace_allocation_event(
           torch::profiler::impl::getApproximateTime(),
@@ -286,6 +321,8 @@ struct KinetoThreadLocalState : public ProfilerThreadLocalStateBase {
           alloc_size,
           total_allocated,
           total_reserved,
+          segment_ptr,
+          segment_size,
           device.type(),
           device.index());
     }
@@ -153,7 +153,9 @@ struct ProfilerLegacyThreadLocalState : public ProfilerThreadLocalStateBase {
       int64_t alloc_size,
       int64_t /* total_allocated, unused for legacy */,
       int64_t /* total_reserved, unused for legacy */,
-      c10::Device device) override;
+      c10::Device device,
+      void* /* segment_ptr, unused for legacy */,
+      int64_t /* segment_size, unused for legacy */) override;
 
   ActiveProfilerType profilerType() override {
     return ActiveProfilerType::LEGACY;
@@ -288,7 +290,9 @@ void ProfilerLegacyThreadLocalState::reportMemoryUsage(
     int64_t alloc_size,
     int64_t /* total_allocated, unused for legacy */,
     int64_t /* total_reserved, unused for legacy */,
-    c10::Device device) {
+    c10::Device device,
+    void* /* segment_ptr, unused for legacy */,
+    int64_t /* segment_size, unused for legacy */) {
   if (config_.profile_memory && config_.state != torch::profiler::impl::ProfilerState::Disabled) {
     uint64_t thread_id = at::RecordFunction::currentThreadId();
     LegacyEvent evt(
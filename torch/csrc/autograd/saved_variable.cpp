@@ -16,6 +16,19 @@
 
 namespace torch { namespace autograd {
 
+namespace {
+// See Note [Trimmed saved variables]
+thread_local bool saved_variable_trimming_enabled = false;
+} // namespace
+
+bool SavedVariableTrimming::is_enabled() {
+  return saved_variable_trimming_enabled;
+}
+
+void SavedVariableTrimming::set_enabled(bool enabled) {
+  saved_variable_trimming_enabled = enabled;
+}
+
 SavedVariable::SavedVariable(const Variable& variable, bool is_output, bool is_inplace_on_view) {
   if (variable.defined()) {
     // Note [Inference tensor cannot be saved for backward]
@@ -39,8 +52,11 @@ SavedVariable::SavedVariable(const Variable& variable, bool is_output, bool is_i
       "you can make a clone to get a normal tensor and use it in autograd.")
 
     was_default_constructed_ = false;
-    const auto& version_counter = impl::version_counter(variable);
-    saved_version_ = version_counter.current_version();
+    trimmed_ = SavedVariableTrimming::is_enabled();
+    if (!trimmed_) {
+      const auto& version_counter = impl::version_counter(variable);
+      saved_version_ = version_counter.current_version();
+    }
     is_leaf_ = variable.is_leaf();
     is_output_ = is_output;
     is_inplace_on_view_ = is_inplace_on_view;
@@ -50,7 +66,10 @@ SavedVariable::SavedVariable(const Variable& variable, bool is_output, bool is_i
       weak_grad_fn_ = variable.grad_fn();
     }
 
-    auto maybe_hooks = get_default_hooks();
+    // Trimmed saved variables store their data directly; default hooks are
+    // part of the pack/unpack machinery they opt out of.
+    auto maybe_hooks =
+        trimmed_ ? std::unique_ptr<SavedVariableHooks>() : get_default_hooks();
 
     if (maybe_hooks) {
       save_metadata(variable);
@@ -83,7 +102,9 @@ void SavedVariable::save_metadata(const Variable& data) {
   // Save output number, version counter and fw_grad if needed
 
   output_nr_ = data.output_nr();
-  version_counter_ = impl::version_counter(data);
+  if (!trimmed_) {
+    version_counter_ = impl::version_counter(data);
+  }
 
   if (is_leaf_) {
     grad_accumulator_ = impl::grad_accumulator(data);
@@ -136,7 +157,9 @@ Variable SavedVariable::unpack(std::shared_ptr<Node> saved_for) const {
 
   // Only check version counter in the case without hooks
   // If user provides hooks, we can't track versions through the hooks
-  if (!hooks_) {
+  // Trimmed saved variables did not snapshot a version, so there is nothing
+  // to check against (see Note [Trimmed saved variables])
+  if (!hooks_ && !trimmed_) {
     auto current_version = saved_original_ ? impl::version_counter(data_).current_version()
                                            : version_counter_.current_version();
 
@@ -185,7 +208,9 @@ Variable SavedVariable::unpack(std::shared_ptr<Node> saved_for) const {
     var = make_variable(data, requires_grad_);
   }
 
-  impl::set_version_counter(var, version_counter_);
+  if (!trimmed_) {
+    impl::set_version_counter(var, version_counter_);
+  }
 
   // If a Variable is a leaf (no grad_fn saved), and it requires_grad, then we
   // should have saved the grad accumulator. Even if the Variable is no longer
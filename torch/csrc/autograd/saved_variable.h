@@ -16,6 +16,41 @@ struct Node;
 
 TORCH_API extern const char* ERR_BACKWARD_TWICE;
 
+// Note [Trimmed saved variables]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A SavedVariable normally snapshots the version counter of the tensor it
+// saves so that unpack() can detect in-place overwrites, and consults the
+// thread-local default pack/unpack hooks on construction. Both are pure
+// overhead for graphs that are built once, backwarded once and thrown away
+// (retain_graph=False) by a caller who guarantees the saved tensors are not
+// mutated in place between forward and backward. When trimming is enabled,
+// SavedVariables constructed on this thread skip the version-counter
+// snapshot, the version check at unpack time and the default hooks lookup.
+// The double-backward protection (ERR_BACKWARD_TWICE) is unaffected: it
+// relies on the saved data being released, not on version counters.
+// Trimming trades safety checks for speed, so it is opt-in and thread-local,
+// scoped via SavedVariableTrimmingGuard. With trimming enabled, an in-place
+// overwrite of a saved tensor produces silently wrong gradients instead of
+// an error.
+struct TORCH_API SavedVariableTrimming {
+  static bool is_enabled();
+  static void set_enabled(bool enabled);
+};
+
+/// A RAII guard that enables trimmed saved variables for the current thread.
+/// See Note [Trimmed saved variables].
+struct TORCH_API SavedVariableTrimmingGuard {
+  SavedVariableTrimmingGuard() : prev_(SavedVariableTrimming::is_enabled()) {
+    SavedVariableTrimming::set_enabled(true);
+  }
+  ~SavedVariableTrimmingGuard() {
+    SavedVariableTrimming::set_enabled(prev_);
+  }
+
+ private:
+  bool prev_;
+};
+
 /// A snapshot of a variable at a certain version. A `SavedVariable` stores
 /// enough information to reconstruct a variable from a certain point in time.
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
@@ -82,6 +117,8 @@ class TORCH_API SavedVariable {
   uint32_t saved_version_ = 0;
   uint32_t output_nr_ = 0;
   bool was_default_constructed_ = true;
+  // See Note [Trimmed saved variables]
+  bool trimmed_ = false;
   bool is_inplace_on_view_ = false;
   bool saved_original_ = false;
   bool is_leaf_ = false;
@@ -471,6 +471,8 @@ PyObject * THCPModule_memoryStats(PyObject *_unused, PyObject *arg)
   result["inactive_split_bytes"] = statArrayToDict(stats.inactive_split_bytes);
   result["oversize_allocations"] = statToDict(stats.oversize_allocations);
   result["oversize_segments"] = statToDict(stats.oversize_segments);
+  result["spill_allocations"] = statToDict(stats.spill_allocations);
+  result["spill_bytes"] = statToDict(stats.spill_bytes);
 
   return result.release().ptr();
   END_HANDLE_TH_ERRORS
@@ -143,8 +143,56 @@ Package InterpreterManager::loadPackage(
   TORCH_DEPLOY_SAFE_CATCH_RETHROW
 }
 
+// rebuilds `value` with every tensor replaced by a fresh alias of the same
+// storage. The new TensorImpls carry no interpreter-specific python state, so
+// each interpreter receiving the value can wrap its own python object around
+// them without tripping the multi-interpreter tensor ownership check, while
+// the underlying storage is shared by refcount rather than copied.
+static at::IValue detachTensors(const at::IValue& value) {
+  if (value.isTensor()) {
+    return value.toTensor().detach();
+  }
+  if (value.isList()) {
+    auto list = value.toList();
+    c10::impl::GenericList result(list.elementType());
+    result.reserve(list.size());
+    for (const auto i : c10::irange(list.size())) {
+      result.push_back(detachTensors(list.get(i)));
+    }
+    return result;
+  }
+  if (value.isTuple()) {
+    std::vector<at::IValue> elements;
+    for (const auto& element : value.toTupleRef().elements()) {
+      elements.push_back(detachTensors(element));
+    }
+    return c10::ivalue::Tuple::create(std::move(elements));
+  }
+  if (value.isGenericDict()) {
+    auto dict = value.toGenericDict();
+    c10::impl::GenericDict result(dict.keyType(), dict.valueType());
+    for (const auto& entry : dict) {
+      result.insert(detachTensors(entry.key()), detachTensors(entry.value()));
+    }
+    return result;
+  }
+  return value;
+}
+
+ReplicatedObj InterpreterManager::createMovable(at::IValue value) {
+  TORCH_DEPLOY_TRY
+  return ReplicatedObj(std::make_shared<ReplicatedObjImpl>(
+      nextObjectId_++, detachTensors(value), this));
+  TORCH_DEPLOY_SAFE_CATCH_RETHROW
+}
+
 Obj InterpreterSession::fromMovable(const ReplicatedObj& obj) {
   TORCH_DEPLOY_TRY
+  if (obj.pImpl_->isIValue_) {
+    // detach again so this interpreter gets TensorImpls it alone owns; the
+    // storages are still shared with the original value.
+    return impl_->fromIValue(detachTensors(obj.pImpl_->ivalue_));
+  }
   return impl_->unpickleOrGet(obj.pImpl_->objectId_, obj.pImpl_->data_);
   TORCH_DEPLOY_SAFE_CATCH_RETHROW
 }
@@ -168,6 +216,12 @@ InterpreterSession::~InterpreterSession() {
 
 void ReplicatedObjImpl::unload(const Interpreter* onThisInterpreter) {
   TORCH_DEPLOY_TRY
+  if (isIValue_) {
+    // IValue-backed objects are materialized fresh on every fromMovable and
+    // never cached in an interpreter's object table, so there is nothing to
+    // unload.
+    return;
+  }
   if (!onThisInterpreter) {
     // NOLINTNEXTLINE(clang-analyzer-core.NullDereference)
     for (auto& interp : manager_->allInstances()) {
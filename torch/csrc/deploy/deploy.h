@@ -143,6 +143,13 @@ struct TORCH_API InterpreterManager {
   Package loadPackage(
       std::shared_ptr<caffe2::serialize::ReadAdapterInterface> reader);
 
+  // wraps `value` in a ReplicatedObj without serializing it. Because all
+  // interpreters share the process address space, tensors inside `value`
+  // cross interpreters as refcounted aliases of the same storage: moving a
+  // large activation costs a shallow TensorImpl copy instead of a pickle
+  // round-trip. Tensors are detached from autograd in the process.
+  ReplicatedObj createMovable(at::IValue value);
+
   // convience function for loading some python source code as a module across
   // all interpreters. this can be used for writing tests of deploy that need to
   // execute python code, or for small amounts of application logic that are
@@ -172,11 +179,24 @@ struct TORCH_API ReplicatedObjImpl {
       PickledObject data,
       InterpreterManager* manager)
       : objectId_(object_id), data_(data), manager_(manager) {}
+  ReplicatedObjImpl(
+      size_t object_id,
+      at::IValue value,
+      InterpreterManager* manager)
+      : objectId_(object_id),
+        ivalue_(std::move(value)),
+        isIValue_(true),
+        manager_(manager) {}
   // NOLINTNEXTLINE(bugprone-exception-escape)
   ~ReplicatedObjImpl();
   void unload(const Interpreter* onThisInterpreter);
   int64_t objectId_;
   PickledObject data_;
+  // set when created directly from an IValue (InterpreterManager::
+  // createMovable(at::IValue)). Such objects skip pickling entirely; the
+  // IValue is rematerialized in each interpreter via fromIValue.
+  at::IValue ivalue_;
+  bool isIValue_ = false;
   InterpreterManager* manager_;
 };
 
@@ -344,6 +344,22 @@ def get_tensor():
   ASSERT_TRUE(tensorOnI.storage().is_alias_of(tensorOnI2.storage()));
 }
 
+TEST(TorchpyTest, IValueMovableZeroCopy) {
+  torch::deploy::InterpreterManager m(2);
+  at::Tensor t = torch::ones({2, 2});
+  auto replicated = m.createMovable(t);
+
+  auto I0 = m.allInstances()[0].acquireSession();
+  auto I1 = m.allInstances()[1].acquireSession();
+  auto tensorOnI0 = I0.fromMovable(replicated).toIValue().toTensor();
+  auto tensorOnI1 = I1.fromMovable(replicated).toIValue().toTensor();
+  // the tensor data itself is never copied or re-pickled; every interpreter
+  // sees the same storage.
+  ASSERT_EQ(t.data_ptr(), tensorOnI0.data_ptr());
+  ASSERT_EQ(t.data_ptr(), tensorOnI1.data_ptr());
+  ASSERT_TRUE(at::equal(tensorOnI0, tensorOnI1));
+}
+
 #ifdef TEST_CUSTOM_LIBRARY
 thread_local int in_another_module = 5;
 TEST(TorchpyTest, SharedLibraryLoad) {
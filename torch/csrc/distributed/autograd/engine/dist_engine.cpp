@@ -111,7 +111,7 @@ void DistEngine::globalCpuThread(
 DistEngine::DistEngine()
     : initializedContextIds_(),
       engine_(Engine::get_default_engine()),
-      global_cpu_ready_queue_(std::make_shared<ReadyQueue>()),
+      global_cpu_ready_queue_(ReadyQueue::create()),
       global_cpu_thread_(
           &DistEngine::globalCpuThread,
           this,
@@ -337,7 +337,7 @@ void DistEngine::execute_graph_task_until_ready_queue_empty(
   // Create a ready queue per call to traverse the graph_task from
   // root_to_execute This allow concurrent execution of the same GraphTask from
   // different threads
-  std::shared_ptr<ReadyQueue> cpu_ready_queue = std::make_shared<ReadyQueue>();
+  std::shared_ptr<ReadyQueue> cpu_ready_queue = ReadyQueue::create();
   auto graph_task = node_task.base_.lock();
   if (graph_task == nullptr) {
     LOG(ERROR) << "GraphTask has expired for NodeTask: "
@@ -0,0 +1,105 @@
+#include <c10d/CallbackExecutor.hpp>
+
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+#include <c10/util/Exception.h>
+
+namespace c10d {
+
+namespace {
+
+std::mutex executors_mutex;
+size_t executor_num_threads = 0;
+
+size_t defaultNumThreads() {
+  const char* env = std::getenv("C10D_CALLBACK_EXECUTOR_THREADS");
+  if (env != nullptr) {
+    const int val = std::atoi(env);
+    if (val > 0) {
+      return static_cast<size_t>(val);
+    }
+  }
+  return 1;
+}
+
+} // namespace
+
+CallbackExecutor& CallbackExecutor::get(const c10::Device& device) {
+  std::lock_guard<std::mutex> lock(executors_mutex);
+  // Executors are intentionally leaked: their threads must outlive any
+  // future completed through them, which can happen arbitrarily late during
+  // process teardown.
+  static auto* executors = new std::map<
+      std::pair<c10::DeviceType, c10::DeviceIndex>,
+      CallbackExecutor*>();
+  auto key = std::make_pair(device.type(), device.index());
+  auto it = executors->find(key);
+  if (it == executors->end()) {
+    if (executor_num_threads == 0) {
+      executor_num_threads = defaultNumThreads();
+    }
+    it = executors->emplace(key, new CallbackExecutor(executor_num_threads))
+             .first;
+  }
+  return *it->second;
+}
+
+void CallbackExecutor::setNumThreads(size_t num_threads) {
+  TORCH_CHECK(
+      num_threads > 0, "CallbackExecutor needs at least one thread");
+  std::lock_guard<std::mutex> lock(executors_mutex);
+  executor_num_threads = num_threads;
+}
+
+CallbackExecutor::CallbackExecutor(size_t num_threads) {
+  threads_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(&CallbackExecutor::runLoop, this);
+    threads_.back().detach();
+  }
+}
+
+void CallbackExecutor::runLoop() {
+  while (true) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return !tasks_.empty(); });
+    auto task = tasks_.top().fn;
+    tasks_.pop();
+    lock.unlock();
+    task();
+  }
+}
+
+void CallbackExecutor::run(std::function<void()> task, int64_t priority) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(Task{std::move(task), priority, next_seq_++});
+  }
+  cv_.notify_one();
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> CallbackExecutor::wrapFuture(
+    const c10::intrusive_ptr<c10::ivalue::Future>& future,
+    int64_t priority) {
+  auto wrapped = c10::make_intrusive<c10::ivalue::Future>(
+      future->elementType(), future->devices());
+  // The inline callback only enqueues, so the completing thread (e.g. the
+  // NCCL watchdog) does constant work; the forwarding — and with it every
+  // continuation of `wrapped` — runs on an executor thread.
+  future->addCallback([this, wrapped, future, priority](c10::ivalue::Future&) {
+    run(
+        [wrapped, future]() {
+          if (future->hasError()) {
+            wrapped->setError(future->exception_ptr());
+          } else {
+            wrapped->markCompleted(future->value(), future->storages());
+          }
+        },
+        priority);
+  });
+  return wrapped;
+}
+
+} // namespace c10d
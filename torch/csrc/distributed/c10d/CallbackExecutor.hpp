@@ -0,0 +1,83 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <ATen/core/ivalue.h>
+#include <ATen/core/ivalue_inl.h>
+#include <c10/core/Device.h>
+
+namespace c10d {
+
+// Dedicated threads for collective-completion callbacks.
+//
+// Continuations attached to a Work's future run inline on whichever thread
+// marks the future complete — for NCCL that is the watchdog thread, for
+// gloo/MPI/UCC a backend worker thread — so a heavyweight user callback
+// (e.g. gradient clipping in a comm hook) can stall communication progress.
+// Routing a future through a CallbackExecutor moves completion, and with it
+// every attached continuation, onto executor threads owned by c10d.
+//
+// One executor exists per device, created lazily; the number of threads per
+// executor is configurable before first use. Tasks run in descending
+// priority order, FIFO within equal priorities.
+class TORCH_API CallbackExecutor {
+ public:
+  // Returns the executor dedicated to callbacks of work touching `device`.
+  // Executors live for the duration of the process.
+  static CallbackExecutor& get(const c10::Device& device);
+
+  // Sets the number of threads per executor. Only affects executors created
+  // afterwards; defaults to 1 or the C10D_CALLBACK_EXECUTOR_THREADS
+  // environment variable.
+  static void setNumThreads(size_t num_threads);
+
+  // Enqueues `task`; higher `priority` tasks run first when the executor is
+  // backlogged.
+  void run(std::function<void()> task, int64_t priority = 0);
+
+  // Returns a future that completes on this executor's threads (with the
+  // same value or error) whenever `future` completes. Continuations
+  // attached to the returned future therefore never run on the thread that
+  // completes `future`.
+  c10::intrusive_ptr<c10::ivalue::Future> wrapFuture(
+      const c10::intrusive_ptr<c10::ivalue::Future>& future,
+      int64_t priority = 0);
+
+  CallbackExecutor(const CallbackExecutor&) = delete;
+  CallbackExecutor& operator=(const CallbackExecutor&) = delete;
+
+ private:
+  explicit CallbackExecutor(size_t num_threads);
+
+  void runLoop();
+
+  struct Task {
+    std::function<void()> fn;
+    int64_t priority;
+    // Enqueue order, used to break priority ties FIFO.
+    uint64_t seq;
+  };
+
+  struct TaskOrder {
+    bool operator()(const Task& lhs, const Task& rhs) const {
+      if (lhs.priority != rhs.priority) {
+        return lhs.priority < rhs.priority;
+      }
+      return lhs.seq > rhs.seq;
+    }
+  };
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::priority_queue<Task, std::vector<Task>, TaskOrder> tasks_;
+  uint64_t next_seq_{0};
+  std::vector<std::thread> threads_;
+};
+
+} // namespace c10d
@@ -0,0 +1,107 @@
+#include <c10d/CollectivePacer.hpp>
+
+#include <algorithm>
+
+#include <c10/util/Exception.h>
+
+namespace c10d {
+
+namespace {
+
+// Default burst capacity: 100ms worth of the budget, but never less than a
+// typical DDP bucket so a single gradient bucket does not have to straddle
+// refills.
+constexpr int64_t kMinBurstBytes = 1024 * 1024;
+
+double defaultBurstBytes(int64_t bandwidthBytesPerSecond) {
+  return static_cast<double>(
+      std::max(bandwidthBytesPerSecond / 10, kMinBurstBytes));
+}
+
+} // namespace
+
+CollectivePacer::CollectivePacer(const PacingOptions& options)
+    : bytesPerSecond_(static_cast<double>(options.bandwidthBytesPerSecond)),
+      burstBytes_(
+          options.burstBytes > 0
+              ? static_cast<double>(options.burstBytes)
+              : defaultBurstBytes(options.bandwidthBytesPerSecond)),
+      tokens_(burstBytes_),
+      lastRefill_(std::chrono::steady_clock::now()) {
+  TORCH_CHECK(
+      options.bandwidthBytesPerSecond > 0,
+      "CollectivePacer requires a positive bandwidth budget, got ",
+      options.bandwidthBytesPerSecond);
+}
+
+std::shared_ptr<CollectivePacer> CollectivePacer::create(
+    const PacingOptions& options) {
+  if (options.bandwidthBytesPerSecond <= 0) {
+    return nullptr;
+  }
+  if (!options.shareProcessWideBucket) {
+    return std::make_shared<CollectivePacer>(options);
+  }
+  // The shared bucket lives as long as some group references it; a weak
+  // pointer lets a fresh set of groups reconfigure the budget after all
+  // previous holders are gone.
+  static std::mutex sharedMutex;
+  static std::weak_ptr<CollectivePacer> sharedPacer;
+  std::lock_guard<std::mutex> lock(sharedMutex);
+  auto pacer = sharedPacer.lock();
+  if (!pacer) {
+    pacer = std::make_shared<CollectivePacer>(options);
+    sharedPacer = pacer;
+  }
+  return pacer;
+}
+
+void CollectivePacer::refill() {
+  const auto now = std::chrono::steady_clock::now();
+  const std::chrono::duration<double> elapsed = now - lastRefill_;
+  lastRefill_ = now;
+  tokens_ =
+      std::min(burstBytes_, tokens_ + elapsed.count() * bytesPerSecond_);
+}
+
+void CollectivePacer::acquire(int64_t bytes, int priority) {
+  if (bytes <= 0) {
+    return;
+  }
+  // A message larger than the burst capacity proceeds once the bucket is
+  // full; withdrawing the full size below then drives the bucket negative,
+  // which delays later acquires and preserves the long-run rate.
+  const double need =
+      std::min(static_cast<double>(bytes), burstBytes_);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  ++waiters_[priority];
+  while (true) {
+    refill();
+    const bool preempted = waiters_.begin()->first > priority;
+    if (!preempted && tokens_ >= need) {
+      break;
+    }
+    if (preempted) {
+      // A higher tier is blocked; let it withdraw first. It wakes us when
+      // its acquire completes.
+      cv_.wait(lock);
+      continue;
+    }
+    const auto deficit = need - tokens_;
+    cv_.wait_for(
+        lock,
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration<double>(deficit / bytesPerSecond_)) +
+            std::chrono::microseconds(1));
+  }
+  tokens_ -= static_cast<double>(bytes);
+  auto it = waiters_.find(priority);
+  if (--it->second == 0) {
+    waiters_.erase(it);
+  }
+  lock.unlock();
+  cv_.notify_all();
+}
+
+} // namespace c10d
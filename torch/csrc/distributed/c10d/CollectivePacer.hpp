@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <c10/macros/Macros.h>
+#include <c10d/Types.hpp>
+
+namespace c10d {
+
+// Token-bucket rate limiter for collective traffic.
+//
+// When several jobs share top-of-rack uplinks, the bursty allreduces of one
+// job collide with those of its neighbors and both see inflated tail step
+// times. A CollectivePacer shapes a process group's collective submissions
+// to a sustained bandwidth budget: each collective must withdraw tokens
+// proportional to its message size before the backend hands it to the
+// network, and tokens replenish at the configured rate up to a bounded
+// burst. Messages larger than the burst capacity drive the bucket negative,
+// so the long-run rate is honored without splitting them.
+//
+// Several process groups in one process may share a single bucket (see
+// PacingOptions::shareProcessWideBucket); when they do, blocked withdrawals
+// are served in descending priority order so a latency-critical group's
+// traffic drains first.
+class TORCH_API CollectivePacer {
+ public:
+  explicit CollectivePacer(const PacingOptions& options);
+
+  // Returns a pacer configured from `options`, or nullptr when no bandwidth
+  // budget is set (the common case; callers skip pacing entirely). Groups
+  // constructed with shareProcessWideBucket receive the same process-wide
+  // instance, whose budget is fixed by the first such group.
+  static std::shared_ptr<CollectivePacer> create(const PacingOptions& options);
+
+  // Blocks the calling thread until the bucket can cover a message of
+  // `bytes` bytes, then withdraws the tokens. Withdrawals blocked at a
+  // lower `priority` yield to higher-priority ones. Returns immediately
+  // when `bytes` is not positive.
+  void acquire(int64_t bytes, int priority = 0);
+
+ private:
+  // Credits tokens for the time elapsed since the last refill, capped at
+  // the burst size. The caller must hold mutex_.
+  void refill();
+
+  const double bytesPerSecond_;
+  const double burstBytes_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  double tokens_;
+  std::chrono::steady_clock::time_point lastRefill_;
+  // Count of blocked acquires per priority tier, highest tier first.
+  std::map<int, int, std::greater<int>> waiters_;
+};
+
+} // namespace c10d
@@ -18,6 +18,10 @@
 #include <gloo/transport/uv/device.h>
 #endif
 
+#ifdef __linux__
+#include <c10d/GlooShmTransport.hpp>
+#endif
+
 // On Linux, check that the tcp transport is available.
 #ifdef __linux__
 #if !GLOO_HAVE_TRANSPORT_TCP
@@ -65,6 +69,19 @@ C10_REGISTER_CREATOR(GlooDeviceRegistry, LINUX, makeTCPDevice);
 C10_REGISTER_CREATOR(GlooDeviceRegistry, TCP, makeTCPDevice);
 #endif
 
+#ifdef __linux__
+static std::shared_ptr<::gloo::transport::Device> makeShmDevice(
+    const std::string& interfaceName,
+    const std::string& hostname) {
+  return makeGlooShmDevice(hostname.empty() ? interfaceName : hostname);
+}
+
+// Shared-memory rings between same-host ranks, skipping the kernel network
+// stack. Opt-in via GLOO_DEVICE_TRANSPORT=SHM; every rank of the group must
+// run on the same host, multi-host jobs keep the TCP default.
+C10_REGISTER_CREATOR(GlooDeviceRegistry, SHM, makeShmDevice);
+#endif
+
 #if GLOO_HAVE_TRANSPORT_TCP_TLS
 static std::string cstr_to_std_string(const char* chars) {
   return std::string (chars != nullptr ? chars : "");
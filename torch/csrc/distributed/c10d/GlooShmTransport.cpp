@@ -0,0 +1,805 @@
+#include <c10d/GlooShmTransport.hpp>
+
+#ifdef USE_C10D_GLOO
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <c10/util/Exception.h>
+#include <c10/util/Optional.h>
+
+#include <gloo/transport/address.h>
+#include <gloo/transport/buffer.h>
+#include <gloo/transport/context.h>
+#include <gloo/transport/pair.h>
+#include <gloo/transport/unbound_buffer.h>
+
+namespace c10d {
+namespace {
+
+// Each connected pair of ranks shares one ring per direction. A ring is a
+// byte stream in a shm segment: the producer appends whole frames and
+// publishes them with a single head update, so the consumer never observes a
+// partial frame. head/tail are free-running byte counters; the 32-bit
+// sequence words next to them are futex words that sleeping peers park on
+// when the ring is empty (consumer) or full (producer).
+
+struct RingHeader {
+  std::atomic<uint64_t> head; // bytes produced
+  std::atomic<uint64_t> tail; // bytes consumed
+  std::atomic<uint32_t> headSeq; // bumped with head, futex for consumers
+  std::atomic<uint32_t> tailSeq; // bumped with tail, futex for producers
+  uint64_t capacity;
+};
+
+// Messages larger than the ring are split into frames; chunkOffset/
+// chunkBytes locate each frame inside the message identified by its tag.
+struct FrameHeader {
+  uint64_t tag;
+  uint64_t totalBytes;
+  uint64_t chunkOffset;
+  uint64_t chunkBytes;
+};
+
+int futexWait(
+    std::atomic<uint32_t>* word,
+    uint32_t expected,
+    const struct timespec* timeout) {
+  // No FUTEX_PRIVATE_FLAG: the word lives in shared memory.
+  return syscall(
+      SYS_futex,
+      reinterpret_cast<uint32_t*>(word),
+      FUTEX_WAIT,
+      expected,
+      timeout,
+      nullptr,
+      0);
+}
+
+void futexWakeAll(std::atomic<uint32_t>* word) {
+  syscall(
+      SYS_futex,
+      reinterpret_cast<uint32_t*>(word),
+      FUTEX_WAKE,
+      std::numeric_limits<int>::max(),
+      nullptr,
+      nullptr,
+      0);
+}
+
+size_t ringCapacityBytes() {
+  static const size_t capacity = []() {
+    size_t bytes = 1 << 20;
+    if (const char* env = std::getenv("C10D_GLOO_SHM_RING_BYTES")) {
+      bytes = std::max<size_t>(std::strtoull(env, nullptr, 10), 1 << 16);
+    }
+    const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (bytes + page - 1) / page * page;
+  }();
+  return capacity;
+}
+
+class ShmRing {
+ public:
+  ShmRing() = default;
+  ShmRing(const ShmRing&) = delete;
+  ShmRing& operator=(const ShmRing&) = delete;
+
+  ~ShmRing() {
+    if (header_ != nullptr) {
+      munmap(header_, mapSize_);
+    }
+    if (owned_) {
+      shm_unlink(name_.c_str());
+    }
+  }
+
+  void create(const std::string& name) {
+    const size_t capacity = ringCapacityBytes();
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    TORCH_CHECK(
+        fd >= 0,
+        "GlooShmTransport: shm_open(",
+        name,
+        ") failed: ",
+        strerror(errno));
+    mapSize_ = sizeof(RingHeader) + capacity;
+    if (ftruncate(fd, mapSize_) != 0) {
+      ::close(fd);
+      shm_unlink(name.c_str());
+      TORCH_CHECK(false, "GlooShmTransport: ftruncate failed: ", strerror(errno));
+    }
+    map(fd, name, /*owned=*/true);
+    // The segment is zero-filled; only the capacity needs initializing.
+    header_->capacity = capacity;
+  }
+
+  void open(const std::string& name) {
+    const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    TORCH_CHECK(
+        fd >= 0,
+        "GlooShmTransport: peer segment ",
+        name,
+        " is gone: ",
+        strerror(errno));
+    struct stat st {};
+    TORCH_CHECK(fstat(fd, &st) == 0, "GlooShmTransport: fstat failed");
+    mapSize_ = static_cast<size_t>(st.st_size);
+    map(fd, name, /*owned=*/false);
+  }
+
+  bool valid() const {
+    return header_ != nullptr;
+  }
+
+  const std::string& name() const {
+    return name_;
+  }
+
+  RingHeader& header() {
+    return *header_;
+  }
+
+  size_t capacity() const {
+    return header_->capacity;
+  }
+
+  size_t used() const {
+    return header_->head.load(std::memory_order_acquire) -
+        header_->tail.load(std::memory_order_acquire);
+  }
+
+  size_t freeSpace() const {
+    return capacity() - used();
+  }
+
+  // Wrapped copies relative to a free-running byte position.
+  void copyIn(uint64_t pos, const void* src, size_t nbytes) {
+    const size_t at = pos % capacity();
+    const size_t first = std::min(nbytes, capacity() - at);
+    std::memcpy(data() + at, src, first);
+    std::memcpy(data(), static_cast<const char*>(src) + first, nbytes - first);
+  }
+
+  void copyOut(uint64_t pos, void* dst, size_t nbytes) const {
+    const size_t at = pos % capacity();
+    const size_t first = std::min(nbytes, capacity() - at);
+    std::memcpy(dst, data() + at, first);
+    std::memcpy(static_cast<char*>(dst) + first, data(), nbytes - first);
+  }
+
+  void publish(size_t nbytes) {
+    header_->head.fetch_add(nbytes, std::memory_order_release);
+    header_->headSeq.fetch_add(1, std::memory_order_release);
+    futexWakeAll(&header_->headSeq);
+  }
+
+  void consume(size_t nbytes) {
+    header_->tail.fetch_add(nbytes, std::memory_order_release);
+    header_->tailSeq.fetch_add(1, std::memory_order_release);
+    futexWakeAll(&header_->tailSeq);
+  }
+
+  // Park until the producer publishes something (bounded nap; callers
+  // re-check their own conditions and deadlines in a loop).
+  void waitProduced() {
+    const uint32_t seq = header_->headSeq.load(std::memory_order_acquire);
+    if (used() != 0) {
+      return;
+    }
+    struct timespec ts {
+      0, 2 * 1000 * 1000
+    }; // 2ms
+    futexWait(&header_->headSeq, seq, &ts);
+  }
+
+  void waitConsumed() {
+    const uint32_t seq = header_->tailSeq.load(std::memory_order_acquire);
+    struct timespec ts {
+      0, 2 * 1000 * 1000
+    };
+    futexWait(&header_->tailSeq, seq, &ts);
+  }
+
+ private:
+  void map(int fd, const std::string& name, bool owned) {
+    void* addr =
+        mmap(nullptr, mapSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    TORCH_CHECK(
+        addr != MAP_FAILED, "GlooShmTransport: mmap failed: ", strerror(errno));
+    header_ = static_cast<RingHeader*>(addr);
+    name_ = name;
+    owned_ = owned;
+  }
+
+  char* data() const {
+    return reinterpret_cast<char*>(header_) + sizeof(RingHeader);
+  }
+
+  RingHeader* header_{nullptr};
+  size_t mapSize_{0};
+  std::string name_;
+  bool owned_{false};
+};
+
+class ShmAddress : public ::gloo::transport::Address {
+ public:
+  ShmAddress() = default;
+  ShmAddress(std::string name, int rank)
+      : name_(std::move(name)), rank_(rank) {}
+
+  std::string str() const override {
+    return name_ + "/" + std::to_string(rank_);
+  }
+
+  std::vector<char> bytes() const override {
+    std::vector<char> out(sizeof(int32_t) + name_.size());
+    const auto rank = static_cast<int32_t>(rank_);
+    std::memcpy(out.data(), &rank, sizeof(rank));
+    std::memcpy(out.data() + sizeof(rank), name_.data(), name_.size());
+    return out;
+  }
+
+  static ShmAddress fromBytes(const std::vector<char>& bytes) {
+    TORCH_CHECK(
+        bytes.size() >= sizeof(int32_t),
+        "GlooShmTransport: malformed address");
+    int32_t rank = 0;
+    std::memcpy(&rank, bytes.data(), sizeof(rank));
+    return ShmAddress(
+        std::string(bytes.data() + sizeof(rank), bytes.size() - sizeof(rank)),
+        rank);
+  }
+
+  const std::string& name() const {
+    return name_;
+  }
+
+ private:
+  std::string name_;
+  int rank_{-1};
+};
+
+class ShmContext;
+class ShmPair;
+
+class ShmUnboundBuffer : public ::gloo::transport::UnboundBuffer {
+ public:
+  ShmUnboundBuffer(ShmContext* context, void* ptr, size_t size)
+      : ::gloo::transport::UnboundBuffer(ptr, size), context_(context) {}
+
+  ~ShmUnboundBuffer() override = default;
+
+  bool waitRecv(int* rank, std::chrono::milliseconds timeout) override;
+  bool waitSend(int* rank, std::chrono::milliseconds timeout) override;
+
+  void abortWaitRecv() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    abortRecv_ = true;
+    cv_.notify_all();
+  }
+
+  void abortWaitSend() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    abortSend_ = true;
+    cv_.notify_all();
+  }
+
+  void send(int dstRank, uint64_t slot, size_t offset, size_t nbytes) override;
+  void recv(int srcRank, uint64_t slot, size_t offset, size_t nbytes) override;
+  void recv(
+      std::vector<int> srcRanks,
+      uint64_t slot,
+      size_t offset,
+      size_t nbytes) override;
+
+  void signalRecvCompletion(int rank) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    recvRanks_.push_back(rank);
+    cv_.notify_all();
+  }
+
+  void signalSendCompletion(int rank) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sendRanks_.push_back(rank);
+    cv_.notify_all();
+  }
+
+  void addRecvPair(ShmPair* pair) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto* p : recvPairs_) {
+      if (p == pair) {
+        return;
+      }
+    }
+    recvPairs_.push_back(pair);
+  }
+
+ private:
+  ShmContext* const context_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<int> recvRanks_;
+  std::deque<int> sendRanks_;
+  // Pairs with an operation outstanding for this buffer; the waiting thread
+  // drives their progress itself, there is no background thread.
+  std::vector<ShmPair*> recvPairs_;
+  bool abortRecv_{false};
+  bool abortSend_{false};
+};
+
+struct PendingRecv {
+  ShmUnboundBuffer* buf;
+  uint64_t tag;
+  size_t offset;
+  size_t nbytes;
+  size_t received{0};
+};
+
+// A complete or partially arrived message with no matching posted receive.
+struct UnexpectedMessage {
+  uint64_t tag;
+  std::vector<char> data;
+  size_t received{0};
+};
+
+class ShmPair : public ::gloo::transport::Pair {
+ public:
+  ShmPair(ShmContext* context, int selfRank, int peerRank);
+
+  ~ShmPair() override {
+    close();
+  }
+
+  const ::gloo::transport::Address& address() const override {
+    return self_;
+  }
+
+  void connect(const std::vector<char>& bytes) override {
+    const auto peer = ShmAddress::fromBytes(bytes);
+    outbound_.open(peer.name());
+  }
+
+  void close() override {}
+
+  void setSync(bool /* sync */, bool /* busyPoll */) override {
+    // The transport is synchronous by construction.
+  }
+
+  std::unique_ptr<::gloo::transport::Buffer> createSendBuffer(
+      int /* slot */,
+      void* /* ptr */,
+      size_t /* size */) override {
+    TORCH_CHECK(
+        false,
+        "GlooShmTransport: the legacy gloo buffer API is not supported; "
+        "use unbound buffers");
+  }
+
+  std::unique_ptr<::gloo::transport::Buffer> createRecvBuffer(
+      int /* slot */,
+      void* /* ptr */,
+      size_t /* size */) override {
+    TORCH_CHECK(
+        false,
+        "GlooShmTransport: the legacy gloo buffer API is not supported; "
+        "use unbound buffers");
+  }
+
+  void send(
+      ::gloo::transport::UnboundBuffer* tbuf,
+      uint64_t tag,
+      size_t offset,
+      size_t nbytes) override {
+    auto* buf = static_cast<ShmUnboundBuffer*>(tbuf);
+    writeMessage(tag, static_cast<const char*>(buf->ptr) + offset, nbytes);
+    // The payload is buffered in the ring (or already consumed); the
+    // caller's memory is reusable, which is all send completion promises.
+    buf->signalSendCompletion(peerRank_);
+  }
+
+  void recv(
+      ::gloo::transport::UnboundBuffer* tbuf,
+      uint64_t tag,
+      size_t offset,
+      size_t nbytes) override {
+    auto* buf = static_cast<ShmUnboundBuffer*>(tbuf);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!tryMatchUnexpected(buf, tag, offset, nbytes)) {
+        pending_.push_back({buf, tag, offset, nbytes});
+      }
+    }
+    buf->addRecvPair(this);
+  }
+
+  // Drains every complete frame currently in the inbound ring. Returns
+  // whether anything was consumed. Called by whichever thread is waiting on
+  // an operation that involves this pair.
+  bool progress();
+
+  void parkUntilProduced() {
+    inbound_.waitProduced();
+  }
+
+  int peerRank() const {
+    return peerRank_;
+  }
+
+ private:
+  void writeMessage(uint64_t tag, const char* src, size_t nbytes);
+  void handleFrame(const FrameHeader& frame, uint64_t payloadPos);
+  bool tryMatchUnexpected(
+      ShmUnboundBuffer* buf,
+      uint64_t tag,
+      size_t offset,
+      size_t nbytes);
+
+  ShmContext* const context_;
+  const int peerRank_;
+  ShmAddress self_;
+  ShmRing inbound_; // created by us, peer writes
+  ShmRing outbound_; // created by peer, we write
+  std::mutex mutex_; // guards pending_ and unexpected_
+  std::deque<PendingRecv> pending_;
+  std::deque<UnexpectedMessage> unexpected_;
+};
+
+class ShmDevice;
+
+class ShmContext : public ::gloo::transport::Context {
+ public:
+  ShmContext(std::shared_ptr<ShmDevice> device, int rank, int size)
+      : ::gloo::transport::Context(rank, size), device_(std::move(device)) {
+    pairs_.resize(size);
+  }
+
+  std::unique_ptr<::gloo::transport::Pair>& createPair(int rank) override {
+    pairs_[rank] = std::make_unique<ShmPair>(this, this->rank, rank);
+    return pairs_[rank];
+  }
+
+  std::unique_ptr<::gloo::transport::UnboundBuffer> createUnboundBuffer(
+      void* ptr,
+      size_t size) override {
+    return std::make_unique<ShmUnboundBuffer>(this, ptr, size);
+  }
+
+  ShmPair* getShmPair(int rank) {
+    return static_cast<ShmPair*>(pairs_[rank].get());
+  }
+
+  void addAnyRecv(
+      ShmUnboundBuffer* buf,
+      uint64_t tag,
+      std::vector<int> ranks,
+      size_t offset,
+      size_t nbytes) {
+    std::lock_guard<std::mutex> lock(anyMutex_);
+    anyRecvs_.push_back({buf, tag, std::move(ranks), offset, nbytes});
+  }
+
+  // Called by a pair when a frame matches neither its pending receives nor
+  // an unexpected message in flight: the first frame of a message may claim
+  // a posted receive-from-any; the claim moves it onto that pair.
+  c10::optional<PendingRecv> claimAnyRecv(int rank, uint64_t tag) {
+    std::lock_guard<std::mutex> lock(anyMutex_);
+    for (auto it = anyRecvs_.begin(); it != anyRecvs_.end(); ++it) {
+      if (it->tag != tag) {
+        continue;
+      }
+      const auto& ranks = it->ranks;
+      if (std::find(ranks.begin(), ranks.end(), rank) == ranks.end()) {
+        continue;
+      }
+      PendingRecv claimed{it->buf, it->tag, it->offset, it->nbytes};
+      anyRecvs_.erase(it);
+      return claimed;
+    }
+    return c10::nullopt;
+  }
+
+ private:
+  struct AnyRecv {
+    ShmUnboundBuffer* buf;
+    uint64_t tag;
+    std::vector<int> ranks;
+    size_t offset;
+    size_t nbytes;
+  };
+
+  std::shared_ptr<ShmDevice> device_;
+  std::mutex anyMutex_;
+  std::deque<AnyRecv> anyRecvs_;
+};
+
+class ShmDevice : public ::gloo::transport::Device,
+                  public std::enable_shared_from_this<ShmDevice> {
+ public:
+  explicit ShmDevice(std::string hostname) : hostname_(std::move(hostname)) {}
+
+  std::string str() const override {
+    return "shm, host=" + hostname_;
+  }
+
+  const std::string& getPCIBusID() const override {
+    return pciBusID_;
+  }
+
+  std::shared_ptr<::gloo::transport::Context> createContext(int rank, int size)
+      override {
+    return std::make_shared<ShmContext>(shared_from_this(), rank, size);
+  }
+
+ private:
+  const std::string hostname_;
+  const std::string pciBusID_;
+};
+
+ShmPair::ShmPair(ShmContext* context, int selfRank, int peerRank)
+    : context_(context), peerRank_(peerRank) {
+  // The pid in the name makes a segment leaked by a crashed job
+  // identifiable; a live pair unlinks its inbound segment on destruction.
+  static std::atomic<uint64_t> counter{0};
+  static const uint64_t token = std::random_device{}();
+  std::ostringstream name;
+  name << "/c10d-shm-" << getpid() << "-" << std::hex << token << "-"
+       << std::dec << counter.fetch_add(1) << "-" << selfRank << "-"
+       << peerRank;
+  inbound_.create(name.str());
+  self_ = ShmAddress(name.str(), selfRank);
+}
+
+void ShmPair::writeMessage(uint64_t tag, const char* src, size_t nbytes) {
+  TORCH_CHECK(
+      outbound_.valid(), "GlooShmTransport: pair used before connect()");
+  // Cap frames at half the ring so two frames always fit; zero-byte
+  // messages (barriers, notifications) still produce one frame.
+  const size_t maxChunk = outbound_.capacity() / 2 - sizeof(FrameHeader);
+  size_t sent = 0;
+  do {
+    const size_t chunk = std::min(nbytes - sent, maxChunk);
+    const size_t need = sizeof(FrameHeader) + chunk;
+    while (outbound_.freeSpace() < need) {
+      // While blocked on a full outbound ring, keep draining our inbound
+      // ring: two ranks sending each other messages larger than a ring
+      // would otherwise deadlock.
+      if (!progress()) {
+        outbound_.waitConsumed();
+      }
+    }
+    const FrameHeader frame{tag, nbytes, sent, chunk};
+    const uint64_t head = outbound_.header().head.load(std::memory_order_relaxed);
+    outbound_.copyIn(head, &frame, sizeof(frame));
+    outbound_.copyIn(head + sizeof(frame), src + sent, chunk);
+    outbound_.publish(need);
+    sent += chunk;
+  } while (sent < nbytes);
+}
+
+bool ShmPair::progress() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bool any = false;
+  while (inbound_.used() >= sizeof(FrameHeader)) {
+    const uint64_t tail = inbound_.header().tail.load(std::memory_order_relaxed);
+    FrameHeader frame{};
+    inbound_.copyOut(tail, &frame, sizeof(frame));
+    handleFrame(frame, tail + sizeof(frame));
+    inbound_.consume(sizeof(frame) + frame.chunkBytes);
+    any = true;
+  }
+  return any;
+}
+
+void ShmPair::handleFrame(const FrameHeader& frame, uint64_t payloadPos) {
+  // Later chunks of a message that started out unexpected stay with it.
+  for (auto it = unexpected_.begin(); it != unexpected_.end(); ++it) {
+    if (it->tag == frame.tag && it->received < it->data.size()) {
+      inbound_.copyOut(
+          payloadPos, it->data.data() + frame.chunkOffset, frame.chunkBytes);
+      it->received += frame.chunkBytes;
+      return;
+    }
+  }
+
+  auto deliver = [&](std::deque<PendingRecv>::iterator it) {
+    TORCH_CHECK(
+        frame.totalBytes <= it->nbytes,
+        "GlooShmTransport: message of ",
+        frame.totalBytes,
+        " bytes overflows posted receive of ",
+        it->nbytes,
+        " bytes");
+    inbound_.copyOut(
+        payloadPos,
+        static_cast<char*>(it->buf->ptr) + it->offset + frame.chunkOffset,
+        frame.chunkBytes);
+    it->received += frame.chunkBytes;
+    if (it->received == frame.totalBytes) {
+      it->buf->signalRecvCompletion(peerRank_);
+      pending_.erase(it);
+    }
+  };
+
+  for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+    if (it->tag == frame.tag) {
+      deliver(it);
+      return;
+    }
+  }
+
+  if (auto claimed = context_->claimAnyRecv(peerRank_, frame.tag)) {
+    pending_.push_back(*claimed);
+    deliver(std::prev(pending_.end()));
+    return;
+  }
+
+  unexpected_.push_back({frame.tag, std::vector<char>(frame.totalBytes), 0});
+  auto& msg = unexpected_.back();
+  inbound_.copyOut(
+      payloadPos, msg.data.data() + frame.chunkOffset, frame.chunkBytes);
+  msg.received += frame.chunkBytes;
+}
+
+bool ShmPair::tryMatchUnexpected(
+    ShmUnboundBuffer* buf,
+    uint64_t tag,
+    size_t offset,
+    size_t nbytes) {
+  for (auto it = unexpected_.begin(); it != unexpected_.end(); ++it) {
+    if (it->tag != tag || it->received != it->data.size()) {
+      continue;
+    }
+    TORCH_CHECK(
+        it->data.size() <= nbytes,
+        "GlooShmTransport: message of ",
+        it->data.size(),
+        " bytes overflows posted receive of ",
+        nbytes,
+        " bytes");
+    std::memcpy(
+        static_cast<char*>(buf->ptr) + offset, it->data.data(), it->received);
+    unexpected_.erase(it);
+    buf->signalRecvCompletion(peerRank_);
+    return true;
+  }
+  return false;
+}
+
+bool ShmUnboundBuffer::waitRecv(int* rank, std::chrono::milliseconds timeout) {
+  const bool bounded = timeout != std::chrono::milliseconds::zero() &&
+      timeout != std::chrono::milliseconds::max();
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (true) {
+    std::vector<ShmPair*> pairs;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!recvRanks_.empty()) {
+        if (rank != nullptr) {
+          *rank = recvRanks_.front();
+        }
+        recvRanks_.pop_front();
+        return true;
+      }
+      if (abortRecv_) {
+        abortRecv_ = false;
+        return false;
+      }
+      pairs = recvPairs_;
+    }
+    // No background thread: the waiter drives the rings itself.
+    bool progressed = false;
+    for (auto* pair : pairs) {
+      progressed |= pair->progress();
+    }
+    if (!progressed) {
+      if (pairs.size() == 1) {
+        pairs.front()->parkUntilProduced();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    if (bounded && std::chrono::steady_clock::now() >= deadline) {
+      TORCH_CHECK(
+          false,
+          "GlooShmTransport: timed out waiting ",
+          timeout.count(),
+          "ms for recv");
+    }
+  }
+}
+
+bool ShmUnboundBuffer::waitSend(int* rank, std::chrono::milliseconds timeout) {
+  // Sends complete inside Pair::send once the payload is in the ring.
+  const bool bounded = timeout != std::chrono::milliseconds::zero() &&
+      timeout != std::chrono::milliseconds::max();
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto ready = [&]() { return !sendRanks_.empty() || abortSend_; };
+  if (bounded) {
+    if (!cv_.wait_for(lock, timeout, ready)) {
+      TORCH_CHECK(
+          false,
+          "GlooShmTransport: timed out waiting ",
+          timeout.count(),
+          "ms for send");
+    }
+  } else {
+    cv_.wait(lock, ready);
+  }
+  if (abortSend_) {
+    abortSend_ = false;
+    return false;
+  }
+  if (rank != nullptr) {
+    *rank = sendRanks_.front();
+  }
+  sendRanks_.pop_front();
+  return true;
+}
+
+void ShmUnboundBuffer::send(
+    int dstRank,
+    uint64_t slot,
+    size_t offset,
+    size_t nbytes) {
+  if (nbytes == ::gloo::transport::kUnspecifiedByteCount) {
+    nbytes = size - offset;
+  }
+  context_->getShmPair(dstRank)->send(this, slot, offset, nbytes);
+}
+
+void ShmUnboundBuffer::recv(
+    int srcRank,
+    uint64_t slot,
+    size_t offset,
+    size_t nbytes) {
+  if (nbytes == ::gloo::transport::kUnspecifiedByteCount) {
+    nbytes = size - offset;
+  }
+  context_->getShmPair(srcRank)->recv(this, slot, offset, nbytes);
+}
+
+void ShmUnboundBuffer::recv(
+    std::vector<int> srcRanks,
+    uint64_t slot,
+    size_t offset,
+    size_t nbytes) {
+  if (nbytes == ::gloo::transport::kUnspecifiedByteCount) {
+    nbytes = size - offset;
+  }
+  for (const int rank : srcRanks) {
+    addRecvPair(context_->getShmPair(rank));
+  }
+  context_->addAnyRecv(this, slot, std::move(srcRanks), offset, nbytes);
+}
+
+} // namespace
+
+std::shared_ptr<::gloo::transport::Device> makeGlooShmDevice(
+    const std::string& hostname) {
+  return std::make_shared<ShmDevice>(hostname);
+}
+
+} // namespace c10d
+
+#endif // __linux__
+#endif // USE_C10D_GLOO
@@ -0,0 +1,26 @@
+#pragma once
+
+#ifdef USE_C10D_GLOO
+#ifdef __linux__
+
+#include <memory>
+#include <string>
+
+#include <gloo/transport/device.h>
+
+namespace c10d {
+
+// Creates a gloo transport device that moves messages between ranks on the
+// same host through shared-memory rings instead of TCP loopback. Each
+// connected pair of ranks shares one single-producer single-consumer ring
+// per direction; producers and consumers run lock free and park on a futex
+// only when the ring is full or empty. Selected via
+// GLOO_DEVICE_TRANSPORT=SHM; every rank of the group must live on the same
+// host (use the default TCP transport for multi-host jobs).
+std::shared_ptr<::gloo::transport::Device> makeGlooShmDevice(
+    const std::string& hostname);
+
+} // namespace c10d
+
+#endif // __linux__
+#endif // USE_C10D_GLOO
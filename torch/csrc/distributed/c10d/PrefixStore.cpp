@@ -38,6 +38,17 @@ std::vector<uint8_t> PrefixStore::get(const std::string& key) {
   return store_->get(joinKey(key));
 }
 
+void PrefixStore::multiSet(
+    const std::vector<std::string>& keys,
+    const std::vector<std::vector<uint8_t>>& values) {
+  store_->multiSet(joinKeys(keys), values);
+}
+
+std::vector<std::vector<uint8_t>> PrefixStore::multiGet(
+    const std::vector<std::string>& keys) {
+  return store_->multiGet(joinKeys(keys));
+}
+
 int64_t PrefixStore::add(const std::string& key, int64_t value) {
   return store_->add(joinKey(key), value);
 }
@@ -50,6 +61,12 @@ void PrefixStore::watchKey(const std::string& key, WatchKeyCallback callback) {
   return store_->watchKey(joinKey(key), std::move(callback));
 }
 
+void PrefixStore::watchPrefix(
+    const std::string& prefix,
+    WatchKeyCallback callback) {
+  return store_->watchPrefix(joinKey(prefix), std::move(callback));
+}
+
 int64_t PrefixStore::getNumKeys() {
   return store_->getNumKeys();
 }
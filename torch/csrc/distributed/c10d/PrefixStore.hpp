@@ -22,6 +22,13 @@ class TORCH_API PrefixStore : public Store {
 
   std::vector<uint8_t> get(const std::string& key) override;
 
+  void multiSet(
+      const std::vector<std::string>& keys,
+      const std::vector<std::vector<uint8_t>>& values) override;
+
+  std::vector<std::vector<uint8_t>> multiGet(
+      const std::vector<std::string>& keys) override;
+
   int64_t add(const std::string& key, int64_t value) override;
 
   bool deleteKey(const std::string& key) override;
@@ -42,6 +49,9 @@ class TORCH_API PrefixStore : public Store {
 
   void watchKey(const std::string& key, WatchKeyCallback callback) override;
 
+  void watchPrefix(const std::string& prefix, WatchKeyCallback callback)
+      override;
+
  protected:
   std::string prefix_;
   c10::intrusive_ptr<Store> store_;
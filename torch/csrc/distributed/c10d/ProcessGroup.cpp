@@ -2,6 +2,7 @@
 #include <c10d/ProcessGroup.hpp>
 
 #include <c10/util/Logging.h>
+#include <c10d/CallbackExecutor.hpp>
 #include <fmt/format.h>
 
 namespace c10d {
@@ -150,6 +151,15 @@ c10::intrusive_ptr<c10::ivalue::Future> ProcessGroup::Work::getFuture() {
   TORCH_CHECK(false, "ProcessGroup::Work::getFuture not implemented.")
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> ProcessGroup::Work::getOffloadedFuture(
+    int64_t priority) {
+  auto future = getFuture();
+  const auto device = future->devices().empty()
+      ? c10::Device(c10::kCPU)
+      : future->devices().front();
+  return CallbackExecutor::get(device).wrapFuture(std::move(future), priority);
+}
+
 void ProcessGroup::Work::finish(std::exception_ptr exception) {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_ = true;
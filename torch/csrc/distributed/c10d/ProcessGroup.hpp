@@ -147,6 +147,14 @@ class TORCH_API ProcessGroup : public torch::CustomClassHolder {
     // work. Only NCCL backend is currently supported.
     virtual c10::intrusive_ptr<c10::ivalue::Future> getFuture();
 
+    // Like getFuture(), except the returned future completes on a dedicated
+    // c10d callback executor thread for the work's device, so continuations
+    // attached to it never run on the backend's communication progress
+    // threads (e.g. the NCCL watchdog). Higher `priority` callbacks run
+    // first when the executor is backlogged.
+    c10::intrusive_ptr<c10::ivalue::Future> getOffloadedFuture(
+        int64_t priority = 0);
+
     OpType retrieveOpType();
 
    protected:
@@ -189,6 +197,11 @@ class TORCH_API ProcessGroup : public torch::CustomClassHolder {
 
     // backend name
     const std::string backend;
+
+    // Optional traffic-shaping budget for this group's collectives; unset
+    // (zero bandwidth) by default. Backends that support pacing consult it
+    // at construction.
+    PacingOptions pacing;
   };
 
   explicit ProcessGroup(int rank, int size);
@@ -725,6 +725,7 @@ ProcessGroupGloo::ProcessGroupGloo(
     : ProcessGroup(rank, size),
       store_(new GlooStore(store)),
       options_(options),
+      pacer_(CollectivePacer::create(options->pacing)),
       stop_(false),
       collectiveCounter_(0) {
   auto& devices = options->devices;
@@ -785,8 +786,19 @@ ProcessGroupGloo::~ProcessGroupGloo() {
   }
 }
 
+namespace {
+
+// Collective tags carry the reconfiguration epoch in their top byte, so
+// slots from consecutive epochs occupy disjoint ranges and a straggling
+// message from before a reconfiguration can never match new work.
+constexpr uint32_t kTagEpochShift = 24;
+constexpr uint32_t kTagCounterMask = (1u << kTagEpochShift) - 1;
+
+} // namespace
+
 uint32_t ProcessGroupGloo::nextTag() {
-  return collectiveCounter_++;
+  return ((epoch_ & 0xff) << kTagEpochShift) |
+      (collectiveCounter_++ & kTagCounterMask);
 }
 
 std::shared_ptr<::gloo::Context> ProcessGroupGloo::getContext(uint32_t tag) {
@@ -811,10 +823,64 @@ void ProcessGroupGloo::runLoop(int workerIndex) {
     // does not immediately block.
     workConsumeCV_.notify_one();
 
+    if (pacer_) {
+      // Withdraw tokens sized to the data this collective moves before
+      // touching the network. Works without tensors (e.g. barrier) pass
+      // through unpaced.
+      int64_t bytes = 0;
+      for (const auto& tensors : work->outputTensors_) {
+        for (const auto& tensor : tensors) {
+          bytes += static_cast<int64_t>(tensor.nbytes());
+        }
+      }
+      pacer_->acquire(bytes, options_->pacing.priority);
+    }
+
     AsyncWork::execute(std::move(work));
     lock.lock();
     workInProgress_[workerIndex].reset();
+
+    // reconfigure() fences on completed (not just dequeued) work.
+    workConsumeCV_.notify_all();
+  }
+}
+
+void ProcessGroupGloo::reconfigure(const c10::intrusive_ptr<Store>& store) {
+  // Drain the old epoch: every queued or running collective must retire
+  // before its context is swapped out from under it.
+  {
+    std::unique_lock<std::mutex> lock(workMutex_);
+    workConsumeCV_.wait(lock, [&] {
+      if (!workQueue_.empty()) {
+        return false;
+      }
+      for (const auto& work : workInProgress_) {
+        if (work) {
+          return false;
+        }
+      }
+      return true;
+    });
+    epoch_++;
+    collectiveCounter_ = 0;
+  }
+
+  // Rebuild contexts through rendezvous keys scoped by the new epoch. A
+  // replacement rank that restarts into this epoch only ever sees keys
+  // published for it, and surviving ranks cannot be tripped up by leftover
+  // keys from the member they lost.
+  store_ = std::unique_ptr<::gloo::rendezvous::Store>(new GlooStore(store));
+  std::vector<std::shared_ptr<::gloo::Context>> contexts;
+  contexts.reserve(options_->devices.size());
+  for (const auto i : c10::irange(options_->devices.size())) {
+    auto context = std::make_shared<::gloo::rendezvous::Context>(rank_, size_);
+    auto prefix = "epoch_" + std::to_string(epoch_) + "/" + std::to_string(i);
+    auto epochStore = ::gloo::rendezvous::PrefixStore(prefix, *store_);
+    context->setTimeout(options_->timeout);
+    context->connectFullMesh(epochStore, options_->devices[i]);
+    contexts.push_back(std::move(context));
   }
+  contexts_.swap(contexts);
 }
 
 void ProcessGroupGloo::enqueue(c10::intrusive_ptr<AsyncWork> work) {
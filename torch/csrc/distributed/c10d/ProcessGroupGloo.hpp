@@ -18,6 +18,7 @@
 
 #include <c10/util/hash.h>
 
+#include <c10d/CollectivePacer.hpp>
 #include <c10d/ProcessGroup.hpp>
 #include <c10d/Store.hpp>
 #include <c10d/Types.hpp>
@@ -322,10 +323,34 @@ class TORCH_API ProcessGroupGloo : public ProcessGroup {
     return options_->threads;
   }
 
+  // Reconfigures the group in place after an elastic membership change
+  // where a failed member was replaced but rank and world size are
+  // unchanged (the common preemption case). In-flight work from the old
+  // epoch is drained first, then contexts are rebuilt through rendezvous
+  // keys scoped by the new epoch so a restarted peer can never consume
+  // stale keys, and collective tags are versioned with the epoch so slots
+  // from different epochs cannot collide. Much cheaper than tearing the
+  // process group down and re-initializing: worker threads, queues and
+  // surviving process state all stay alive.
+  //
+  // All ranks must call this collectively with the same (typically fresh)
+  // store, and the caller is responsible for quiescing collective
+  // submission for the duration of the call.
+  void reconfigure(const c10::intrusive_ptr<Store>& store);
+
+  // Number of times this group has been reconfigured.
+  uint32_t reconfigurationEpoch() const {
+    return epoch_;
+  }
+
  protected:
   std::unique_ptr<::gloo::rendezvous::Store> store_;
   const c10::intrusive_ptr<Options> options_;
 
+  // Shapes collective traffic to the configured bandwidth budget; null when
+  // pacing is disabled. Worker threads withdraw tokens before running work.
+  std::shared_ptr<CollectivePacer> pacer_;
+
   // Every Gloo context represents a set of connections to its peers.
   // In order to use more than one device (or allow for parallelism on
   // a single device), you need multiple contexts.
@@ -339,6 +364,10 @@ class TORCH_API ProcessGroupGloo : public ProcessGroup {
   // to match up operations during concurrent execution.
   uint32_t collectiveCounter_;
 
+  // Bumped by reconfigure(); carried in the top byte of every collective
+  // tag so work from different epochs is fenced from each other.
+  uint32_t epoch_{0};
+
   // Returns next collective tag to use (uses collectiveCounter_).
   uint32_t nextTag();
 
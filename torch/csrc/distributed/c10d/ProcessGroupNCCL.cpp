@@ -299,6 +299,57 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(
   ncclComms_.resize(devices.size());
 }
 
+// [Host completion callbacks]
+//
+// After a collective's end events are recorded, a cudaLaunchHostFunc callback
+// is enqueued on every NCCL stream of the work. The callback of the last
+// stream to drain decrements `pendingStreams` to zero, flips `completed` and
+// notifies `cv`, so a thread blocked in synchronizeInternal (NCCL_BLOCKING_WAIT)
+// wakes the moment the collective finishes on the GPU instead of at the next
+// busy-poll tick, and subsequent isCompleted() checks short-circuit the CUDA
+// event queries. The state is reference counted because the callbacks can
+// fire after both the user's work handle and the cleanup thread's copy are
+// gone; conversely, if a communicator is aborted the callbacks may never
+// fire, so completion checks still fall back to querying the end events.
+struct WorkCompletionState {
+  std::atomic<int> pendingStreams{0};
+  std::atomic<bool> completed{false};
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
+namespace {
+
+void workCompletedHostFn(void* data) {
+  std::unique_ptr<std::shared_ptr<WorkCompletionState>> state(
+      static_cast<std::shared_ptr<WorkCompletionState>*>(data));
+  if ((*state)->pendingStreams.fetch_sub(1) == 1) {
+    {
+      std::lock_guard<std::mutex> lock((*state)->mutex);
+      (*state)->completed.store(true);
+    }
+    (*state)->cv.notify_all();
+  }
+}
+
+} // namespace
+
+void ProcessGroupNCCL::WorkNCCL::launchHostCompletionCallbacks(
+    const std::vector<at::cuda::CUDAStream>& ncclStreams) {
+  completionState_ = std::make_shared<WorkCompletionState>();
+  completionState_->pendingStreams = static_cast<int>(ncclStreams.size());
+  for (const auto i : c10::irange(ncclStreams.size())) {
+    at::cuda::CUDAGuard gpuGuard(devices_[i]);
+    // Each callback owns its own reference to the shared state.
+    auto* state = new std::shared_ptr<WorkCompletionState>(completionState_);
+    auto err = cudaLaunchHostFunc(ncclStreams[i], workCompletedHostFn, state);
+    if (err != cudaSuccess) {
+      delete state;
+      C10_CUDA_CHECK(err);
+    }
+  }
+}
+
 ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
     : Work(w.rank_, w.opType_),
       std::enable_shared_from_this<WorkNCCL>(w),
@@ -313,6 +364,7 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
       startTraceUpdated_(w.startTraceUpdated_),
       store_(w.store_) {
   exception_ = w.exception_;
+  completionState_ = w.completionState_;
 }
 
 ProcessGroupNCCL::WorkNCCL::~WorkNCCL() {}
@@ -375,6 +427,10 @@ bool ProcessGroupNCCL::WorkNCCL::startedGPUExecutionInternal() const {
 }
 
 bool ProcessGroupNCCL::WorkNCCL::finishedGPUExecutionInternal() const {
+  // Completion observed by the host callbacks; no need to query the events.
+  if (completionState_ != nullptr && completionState_->completed.load()) {
+    return true;
+  }
   try {
     for (const auto i : c10::irange(devices_.size())) {
       // Checking the work's corresponding CUDA events' status
@@ -485,8 +541,19 @@ void ProcessGroupNCCL::WorkNCCL::synchronizeInternal(
       }
       // Check for errors and throw appropriate exception.
       checkAndThrowException();
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(kSynchronizeBusyWaitMillis));
+      if (completionState_ != nullptr) {
+        // Woken by the host completion callback as soon as the collective
+        // finishes on the GPU; the wait is capped so timeouts and async
+        // errors are still checked periodically.
+        std::unique_lock<std::mutex> lock(completionState_->mutex);
+        completionState_->cv.wait_for(
+            lock,
+            std::chrono::milliseconds(kSynchronizeBusyWaitMillis),
+            [&] { return completionState_->completed.load(); });
+      } else {
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(kSynchronizeBusyWaitMillis));
+      }
     }
     checkAndThrowException();
   }
@@ -535,6 +602,7 @@ ProcessGroupNCCL::ProcessGroupNCCL(
     : ProcessGroup(rank, size),
       store_(store),
       options_(options),
+      pacer_(CollectivePacer::create(options->pacing)),
       ncclCommCounter_(0),
       traceKeyStart_(getTraceStartKey("NCCL", rank)),
       traceKeyEnd_(getTraceEndKey("NCCL", rank)),
@@ -1020,7 +1088,25 @@ void ProcessGroupNCCL::broadcastUniqueNCCLID(
 
   std::string storeKey;
   if (!isSingleP2POp) {
-    storeKey = std::to_string(ncclCommCounter_++);
+    bool warmStart = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = warmStartKeys_.find(p2pKey);
+      if (it != warmStartKeys_.end()) {
+        warmStart = true;
+        warmStartKeys_.erase(it);
+      }
+    }
+    if (warmStart) {
+      // Communicators built eagerly by initCommunicators exchange their ID
+      // under a key derived from the device set. Unlike the sequence number
+      // below, this key does not depend on how many communicators each rank
+      // has created so far, so ranks whose counters diverged (e.g. after a
+      // failover restart re-warms the pool) can still pair up.
+      storeKey = std::string("nccl_warm_id:") + p2pKey;
+    } else {
+      storeKey = std::to_string(ncclCommCounter_++);
+    }
   } else {
     storeKey = p2pKey;
   }
@@ -1083,6 +1169,26 @@ void ProcessGroupNCCL::destroyNCCLComms(const std::string& devNCCLCommMapKey) {
   usedDeviceIdxs_.clear();
 }
 
+void ProcessGroupNCCL::initCommunicators(std::vector<at::Device> devices) {
+  if (devices.empty()) {
+    devices.push_back(getDeviceForRank(rank_));
+  }
+  const auto key = getKeyFromDevices(devices);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (devNCCLCommMap_.find(key) != devNCCLCommMap_.end()) {
+      // Communicators for this device set are already warm.
+      return;
+    }
+    warmStartKeys_.insert(key);
+  }
+  LOG(INFO) << "[Rank " << rank_
+            << "] Eagerly initializing NCCL communicators for devices " << key;
+  // The OpType only matters insofar as it must not select the send/recv
+  // path; no collective is actually issued here.
+  getNCCLComm(key, devices, OpType::ALLREDUCE);
+}
+
 std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
     const std::string& devicesKey,
     const std::vector<at::Device>& devices,
@@ -1412,6 +1518,17 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
   // Bump collective counter
   seq_++;
 
+  if (pacer_) {
+    // Shape submission: block the issuing thread until the bucket covers
+    // this collective's payload so bursts of bucket allreduces drain at the
+    // configured rate instead of flooding shared uplinks.
+    int64_t bytes = 0;
+    for (const auto& tensor : inputs) {
+      bytes += static_cast<int64_t>(tensor.nbytes());
+    }
+    pacer_->acquire(bytes, options_->pacing.priority);
+  }
+
   // Currently, the API permits two scenarios where inputs.size() and outputs.size() are > 0.
   // 1. If the call was a _coalesced call, all inputs must be on the same device.
   //    The group of nccl calls applies the collective separately to each input,
@@ -1493,6 +1610,10 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
     work->ncclComms_[i] = ncclComms[i];
   }
 
+  // Enqueued after the end events so completion is signalled to CPU waiters
+  // as soon as the collective finishes. See [Host completion callbacks].
+  work->launchHostCompletionCallbacks(ncclStreams);
+
   {
     c10::cuda::CUDAMultiStreamGuard streamGuard(ncclStreams);
     work->future_ = c10::make_intrusive<at::ivalue::Future>(
@@ -1618,6 +1739,10 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::pointToPoint(
     work->store_ = store_;
   }
 
+  // Enqueued after the end events so completion is signalled to CPU waiters
+  // as soon as the p2p operation finishes. See [Host completion callbacks].
+  work->launchHostCompletionCallbacks(ncclStreams_[key]);
+
   // Future only needs to be created and marked completed with outputs for
   // recv(), but still create future for use cases such as profiling even for
   // send().
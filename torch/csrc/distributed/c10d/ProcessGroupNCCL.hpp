@@ -8,7 +8,9 @@
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
+#include <c10d/CollectivePacer.hpp>
 #include <c10d/NCCLUtils.hpp>
 #include <c10d/ProcessGroup.hpp>
 #include <c10d/Store.hpp>
@@ -44,6 +46,11 @@ constexpr const char* NCCL_DESYNC_DEBUG = "NCCL_DESYNC_DEBUG";
 
 constexpr const char* NCCL_BACKEND_NAME = "nccl";
 
+// State shared between a WorkNCCL (and the cleanup thread's copy of it) and
+// the host completion callbacks enqueued on its NCCL streams. Defined in the
+// implementation file; see [Host completion callbacks] there.
+struct WorkCompletionState;
+
 // ProcessGroupNCCL implements NCCL bindings for c10d.
 //
 // All functions of the class are expected to be called in the same order
@@ -190,6 +197,15 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
    private:
     // Helper function for synchronize
     void synchronizeInternal(std::chrono::milliseconds timeout);
+
+    // Enqueues a cudaLaunchHostFunc completion callback on each of the given
+    // NCCL streams, after the end events have been recorded. The callback of
+    // the last stream to finish marks this work as complete and wakes any
+    // thread blocked in synchronizeInternal, so completion is observed the
+    // moment the GPU work finishes instead of at the next busy-poll tick.
+    // See [Host completion callbacks].
+    void launchHostCompletionCallbacks(
+        const std::vector<at::cuda::CUDAStream>& ncclStreams);
     // Checks for NCCL errors and sets an appropriate exception_ptr.
     void checkAndSetException();
 
@@ -215,6 +231,12 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
     // The future returned by getFuture.
     c10::intrusive_ptr<at::ivalue::Future> future_;
 
+    // Completion state shared with the host callbacks enqueued by
+    // launchHostCompletionCallbacks and with the cleanup thread's copy of
+    // this work. May be null for works that never launched callbacks (e.g.
+    // works recreated from the store in tests).
+    std::shared_ptr<WorkCompletionState> completionState_;
+
     friend class ProcessGroupNCCL;
   };
 
@@ -370,6 +392,19 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
   // may indicate that there is some sort of collective desynchronization.
   uint64_t getSequenceNumberForGroup() override;
 
+  // Eagerly creates the NCCL communicators (and their streams and events)
+  // for the given devices instead of deferring creation to the first
+  // collective, so the multi-second ncclCommInitRank cost is paid during job
+  // setup rather than inside the first training step. Like a collective,
+  // this must be invoked by all ranks of the group with the same devices.
+  // If no devices are given, the device bound to this rank is used.
+  //
+  // The ncclUniqueId for an eagerly created communicator is exchanged
+  // through the store under a key derived from the device set instead of
+  // the communicator counter, so ranks whose counters diverged (e.g. when
+  // re-warming the pool after a failover restart) can still pair up.
+  void initCommunicators(std::vector<at::Device> devices = {});
+
   // Tests if the UCC fallback path is available
   bool isUCCAvailable() const;
 
@@ -498,6 +533,11 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
 
   const c10::intrusive_ptr<Options> options_;
 
+  // Shapes collective submissions to the configured bandwidth budget; null
+  // when pacing is disabled. Tokens are withdrawn on the thread issuing the
+  // collective, before any NCCL kernel is enqueued.
+  std::shared_ptr<CollectivePacer> pacer_;
+
   // The number of NCCL communicators that have been created during
   // the lifetime of this process group. This sequence number is
   // used to scope keys used in the store.
@@ -544,6 +584,12 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
   std::unordered_map<std::string, std::vector<std::shared_ptr<NCCLComm>>>
       ncclIdToCommMap_;
 
+  // Device keys whose next ncclUniqueId exchange should use the stable
+  // warm-start store key instead of the communicator counter. Populated by
+  // initCommunicators and consumed by broadcastUniqueNCCLID. Guarded by
+  // mutex_.
+  std::unordered_set<std::string> warmStartKeys_;
+
   // Mutex to guard maps like devNCCLCommMap_ and ncclIdToCommMap_.
   std::mutex mutex_;
 
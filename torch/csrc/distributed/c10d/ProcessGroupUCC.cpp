@@ -0,0 +1,526 @@
+#include <c10d/ProcessGroupUCC.hpp>
+
+#ifdef USE_C10D_UCC
+
+#include <cstring>
+#include <map>
+
+namespace c10d {
+
+#define UCC_CHECK(cmd)                                        \
+  do {                                                        \
+    ucc_status_t status = cmd;                                \
+    TORCH_CHECK(                                              \
+        status == UCC_OK,                                     \
+        "UCC error in: " + std::string(__FILE__) + ":" +      \
+            std::to_string(__LINE__) +                        \
+            ", with error: " + ucc_status_string(status));    \
+  } while (0)
+
+namespace {
+
+// Op mapping
+std::map<ReduceOp, ucc_reduction_op_t> uccOp = {
+    {ReduceOp::MIN, UCC_OP_MIN},
+    {ReduceOp::MAX, UCC_OP_MAX},
+    {ReduceOp::SUM, UCC_OP_SUM},
+    {ReduceOp::PRODUCT, UCC_OP_PROD},
+    {ReduceOp::BAND, UCC_OP_BAND},
+    {ReduceOp::BOR, UCC_OP_BOR},
+    {ReduceOp::BXOR, UCC_OP_BXOR},
+};
+// Type mapping
+std::map<at::ScalarType, ucc_datatype_t> uccDatatype = {
+    {at::kByte, UCC_DT_UINT8},
+    {at::kChar, UCC_DT_INT8},
+    {at::kDouble, UCC_DT_FLOAT64},
+    {at::kFloat, UCC_DT_FLOAT32},
+    {at::kHalf, UCC_DT_FLOAT16},
+    {at::kBFloat16, UCC_DT_BFLOAT16},
+    {at::kInt, UCC_DT_INT32},
+    {at::kLong, UCC_DT_INT64},
+    {at::kShort, UCC_DT_INT16},
+};
+
+void checkSingleTensorHelper(const at::Tensor& tensor) {
+  TORCH_CHECK(
+      tensor.is_cpu(),
+      "ProcessGroupUCC only supports CPU tensors, got tensor on ",
+      tensor.device());
+  TORCH_CHECK(
+      tensor.is_contiguous() && !tensor.is_sparse(),
+      "ProcessGroupUCC only supports dense contiguous tensors");
+  TORCH_CHECK(
+      uccDatatype.count(tensor.scalar_type()) > 0,
+      "ProcessGroupUCC does not support tensors of type ",
+      tensor.scalar_type());
+}
+
+void checkSingleTensor(const std::vector<at::Tensor>& tensors) {
+  TORCH_CHECK(
+      tensors.size() == 1,
+      "ProcessGroupUCC only supports a single tensor op");
+  checkSingleTensorHelper(tensors[0]);
+}
+
+void checkSameSizeAndType(
+    const at::Tensor& t_in,
+    const std::vector<at::Tensor>& tensors) {
+  for (const auto& tensor : tensors) {
+    TORCH_CHECK(
+        tensor.numel() == t_in.numel() &&
+            tensor.scalar_type() == t_in.scalar_type(),
+        "Tensors are not equal in size or data type");
+    checkSingleTensorHelper(tensor);
+  }
+}
+
+} // namespace
+
+// The store-backed out-of-band allgather UCC uses for context and team
+// wireup. The exchange is completed synchronously inside the callback (the
+// store blocks until peers publish their keys), so the returned request is
+// already done when req_test first runs.
+namespace {
+
+ucc_status_t oob_allgather(
+    void* sbuf,
+    void* rbuf,
+    size_t msglen,
+    void* coll_info,
+    void** req) {
+  auto* info = static_cast<ProcessGroupUCC::OobCollInfo*>(coll_info);
+  try {
+    const std::string prefix =
+        "ucc_oob/" + std::to_string(info->seq++) + "/";
+    auto* bytes = static_cast<const uint8_t*>(sbuf);
+    info->store->set(
+        prefix + std::to_string(info->rank),
+        std::vector<uint8_t>(bytes, bytes + msglen));
+    auto* out = static_cast<uint8_t*>(rbuf);
+    for (int r = 0; r < info->size; ++r) {
+      auto peer = info->store->get(prefix + std::to_string(r));
+      TORCH_CHECK(
+          peer.size() == msglen,
+          "ProcessGroupUCC oob allgather: peer published ",
+          peer.size(),
+          " bytes, expected ",
+          msglen);
+      std::memcpy(out + r * msglen, peer.data(), msglen);
+    }
+  } catch (...) {
+    return UCC_ERR_NO_MESSAGE;
+  }
+  *req = coll_info;
+  return UCC_OK;
+}
+
+ucc_status_t oob_allgather_test(void* /* req */) {
+  return UCC_OK;
+}
+
+ucc_status_t oob_allgather_free(void* /* req */) {
+  return UCC_OK;
+}
+
+} // namespace
+
+std::vector<at::Tensor> ProcessGroupUCC::WorkUCC::result() {
+  return outputTensors_;
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> ProcessGroupUCC::WorkUCC::getFuture() {
+  return future_;
+}
+
+void ProcessGroupUCC::WorkUCC::finishWorkUCCError(std::exception_ptr eptr) {
+  future_->setError(eptr);
+  finish(eptr);
+}
+
+void ProcessGroupUCC::WorkUCC::finishWorkUCC() {
+  future_->markCompleted(at::IValue(outputTensors_));
+  finish();
+}
+
+c10::intrusive_ptr<ProcessGroupUCC> ProcessGroupUCC::createProcessGroupUCC(
+    const c10::intrusive_ptr<Store>& store,
+    int rank,
+    int size) {
+  return c10::make_intrusive<ProcessGroupUCC>(store, rank, size);
+}
+
+ProcessGroupUCC::ProcessGroupUCC(
+    const c10::intrusive_ptr<Store>& store,
+    int rank,
+    int size)
+    : ProcessGroup(rank, size), stop_(false) {
+  oobInfo_.store = store;
+  oobInfo_.rank = rank;
+  oobInfo_.size = size;
+
+  ucc_oob_coll_t oob;
+  oob.allgather = oob_allgather;
+  oob.req_test = oob_allgather_test;
+  oob.req_free = oob_allgather_free;
+  oob.coll_info = &oobInfo_;
+  oob.n_oob_eps = static_cast<uint32_t>(size);
+  oob.oob_ep = static_cast<uint32_t>(rank);
+
+  ucc_lib_config_h lib_config;
+  ucc_lib_params_t lib_params;
+  std::memset(&lib_params, 0, sizeof(lib_params));
+  lib_params.mask = UCC_LIB_PARAM_FIELD_THREAD_MODE;
+  lib_params.thread_mode = UCC_THREAD_MULTIPLE;
+  UCC_CHECK(ucc_lib_config_read(nullptr, nullptr, &lib_config));
+  UCC_CHECK(ucc_init(&lib_params, lib_config, &lib_));
+  ucc_lib_config_release(lib_config);
+
+  // The context (and therefore the UCX workers and their registration
+  // caches) is created once and kept for the lifetime of the process group,
+  // so repeated collectives on the same buffers reuse memory registrations
+  // instead of registering and deregistering around every call.
+  ucc_context_config_h context_config;
+  UCC_CHECK(ucc_context_config_read(lib_, nullptr, &context_config));
+  ucc_context_params_t context_params;
+  std::memset(&context_params, 0, sizeof(context_params));
+  context_params.mask = UCC_CONTEXT_PARAM_FIELD_OOB;
+  context_params.oob = oob;
+  UCC_CHECK(
+      ucc_context_create(lib_, &context_params, context_config, &context_));
+  ucc_context_config_release(context_config);
+
+  ucc_team_params_t team_params;
+  std::memset(&team_params, 0, sizeof(team_params));
+  team_params.mask = UCC_TEAM_PARAM_FIELD_EP | UCC_TEAM_PARAM_FIELD_EP_RANGE |
+      UCC_TEAM_PARAM_FIELD_OOB;
+  team_params.ep = static_cast<uint64_t>(rank);
+  team_params.ep_range = UCC_COLLECTIVE_EP_RANGE_CONTIG;
+  team_params.oob = oob;
+  UCC_CHECK(ucc_team_create_post(&context_, 1, &team_params, &team_));
+  ucc_status_t status;
+  while ((status = ucc_team_create_test(team_)) == UCC_INPROGRESS) {
+    ucc_context_progress(context_);
+  }
+  UCC_CHECK(status);
+
+  workerThread_ = std::thread(&ProcessGroupUCC::runLoop, this);
+}
+
+ProcessGroupUCC::~ProcessGroupUCC() {
+  destroy();
+  if (team_) {
+    ucc_status_t status;
+    while ((status = ucc_team_destroy(team_)) == UCC_INPROGRESS) {
+      ucc_context_progress(context_);
+    }
+  }
+  if (context_) {
+    ucc_context_destroy(context_);
+  }
+  if (lib_) {
+    ucc_finalize(lib_);
+  }
+}
+
+void ProcessGroupUCC::destroy() {
+  std::unique_lock<std::mutex> lock(pgMutex_);
+  queueConsumeCV_.wait(lock, [&] { return queue_.empty(); });
+
+  // Queue is empty, signal stop
+  stop_ = true;
+
+  // Release lock to allow the loop to run
+  lock.unlock();
+  queueProduceCV_.notify_all();
+
+  // Join the single worker thread
+  workerThread_.join();
+}
+
+void ProcessGroupUCC::runLoop() {
+  std::unique_lock<std::mutex> lock(pgMutex_);
+
+  while (!stop_) {
+    if (queue_.empty()) {
+      queueProduceCV_.wait(lock);
+      continue;
+    }
+
+    auto workTuple = std::move(queue_.front());
+    queue_.pop_front();
+
+    auto& workEntry = std::get<0>(workTuple);
+    auto& work = std::get<1>(workTuple);
+
+    lock.unlock();
+    queueConsumeCV_.notify_one();
+
+    try {
+      workEntry->run(*workEntry);
+      work->finishWorkUCC();
+    } catch (...) {
+      work->finishWorkUCCError(std::current_exception());
+    }
+
+    lock.lock();
+  }
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::enqueue(
+    std::unique_ptr<WorkEntry> entry,
+    const char* profilingTitle,
+    const c10::optional<std::vector<at::Tensor>>& inputTensors) {
+  auto work =
+      c10::make_intrusive<WorkUCC>(entry->dst, profilingTitle, inputTensors);
+  std::unique_lock<std::mutex> lock(pgMutex_);
+  queue_.push_back(std::make_tuple(std::move(entry), work));
+  lock.unlock();
+  queueProduceCV_.notify_one();
+  return work;
+}
+
+void ProcessGroupUCC::runCollective(ucc_coll_args_t& args) {
+  ucc_coll_req_h request = nullptr;
+  UCC_CHECK(ucc_collective_init(&args, &request, team_));
+  UCC_CHECK(ucc_collective_post(request));
+  ucc_status_t status;
+  while ((status = ucc_collective_test(request)) == UCC_INPROGRESS) {
+    ucc_context_progress(context_);
+  }
+  ucc_collective_finalize(request);
+  UCC_CHECK(status);
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::broadcast(
+    std::vector<at::Tensor>& tensors,
+    const BroadcastOptions& opts) {
+  checkSingleTensor(tensors);
+  auto entry = std::make_unique<WorkEntry>([opts, this](WorkEntry& entry) {
+    auto& data = entry.src[0];
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.coll_type = UCC_COLL_TYPE_BCAST;
+    args.root = static_cast<uint64_t>(opts.rootRank);
+    args.src.info.buffer = data.data_ptr();
+    args.src.info.count = static_cast<uint64_t>(data.numel());
+    args.src.info.datatype = uccDatatype.at(data.scalar_type());
+    args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    runCollective(args);
+  });
+  entry->src = tensors;
+  entry->dst = tensors;
+  return enqueue(
+      std::move(entry),
+      "ucc:broadcast",
+      c10::optional<std::vector<at::Tensor>>(tensors));
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::allreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  checkSingleTensor(tensors);
+  TORCH_CHECK(
+      uccOp.count(opts.reduceOp) > 0,
+      "ProcessGroupUCC does not support reduce op ",
+      static_cast<int>(opts.reduceOp));
+  auto entry = std::make_unique<WorkEntry>([opts, this](WorkEntry& entry) {
+    auto& data = entry.src[0];
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.mask = UCC_COLL_ARGS_FIELD_FLAGS;
+    args.flags = UCC_COLL_ARGS_FLAG_IN_PLACE;
+    args.coll_type = UCC_COLL_TYPE_ALLREDUCE;
+    args.op = uccOp.at(opts.reduceOp);
+    args.dst.info.buffer = data.data_ptr();
+    args.dst.info.count = static_cast<uint64_t>(data.numel());
+    args.dst.info.datatype = uccDatatype.at(data.scalar_type());
+    args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    runCollective(args);
+  });
+  entry->src = tensors;
+  entry->dst = tensors;
+  return enqueue(
+      std::move(entry),
+      "ucc:all_reduce",
+      c10::optional<std::vector<at::Tensor>>(tensors));
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::allgather(
+    std::vector<std::vector<at::Tensor>>& outputTensors,
+    std::vector<at::Tensor>& inputTensors,
+    const AllgatherOptions& /* unused */) {
+  checkSingleTensor(inputTensors);
+  TORCH_CHECK(
+      outputTensors.size() == 1,
+      "ProcessGroupUCC only supports a single tensor op");
+  TORCH_CHECK(
+      static_cast<int>(outputTensors[0].size()) == size_,
+      "All gather: number of output tensors should equal to the world size");
+  checkSameSizeAndType(inputTensors[0], outputTensors[0]);
+
+  auto entry = std::make_unique<WorkEntry>([this](WorkEntry& entry) {
+    auto& data = entry.src[0];
+    // UCC allgather expects one contiguous destination; gather into a flat
+    // buffer and scatter out to the user's output tensors afterwards.
+    auto flat = at::empty(
+        {static_cast<int64_t>(size_) * data.numel()}, data.options());
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.coll_type = UCC_COLL_TYPE_ALLGATHER;
+    args.src.info.buffer = data.data_ptr();
+    args.src.info.count = static_cast<uint64_t>(data.numel());
+    args.src.info.datatype = uccDatatype.at(data.scalar_type());
+    args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.dst.info.buffer = flat.data_ptr();
+    args.dst.info.count = static_cast<uint64_t>(flat.numel());
+    args.dst.info.datatype = uccDatatype.at(data.scalar_type());
+    args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    runCollective(args);
+
+    for (int r = 0; r < size_; ++r) {
+      entry.dst[r].view(-1).copy_(
+          flat.narrow(0, r * data.numel(), data.numel()));
+    }
+  });
+  entry->src = inputTensors;
+  entry->dst = outputTensors[0];
+  return enqueue(
+      std::move(entry),
+      "ucc:all_gather",
+      c10::optional<std::vector<at::Tensor>>(inputTensors));
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::_allgather_base(
+    at::Tensor& outputBuffer,
+    at::Tensor& inputBuffer,
+    const AllgatherOptions& /* unused */) {
+  checkSingleTensorHelper(inputBuffer);
+  checkSingleTensorHelper(outputBuffer);
+  TORCH_CHECK(
+      outputBuffer.numel() == inputBuffer.numel() * size_,
+      "_allgather_base: output buffer size must equal world size times input buffer size");
+  TORCH_CHECK(
+      outputBuffer.scalar_type() == inputBuffer.scalar_type(),
+      "_allgather_base: output buffer must have the same type as input buffer");
+
+  auto entry = std::make_unique<WorkEntry>([this](WorkEntry& entry) {
+    auto& src = entry.src[0];
+    auto& dst = entry.dst[0];
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.coll_type = UCC_COLL_TYPE_ALLGATHER;
+    args.src.info.buffer = src.data_ptr();
+    args.src.info.count = static_cast<uint64_t>(src.numel());
+    args.src.info.datatype = uccDatatype.at(src.scalar_type());
+    args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.dst.info.buffer = dst.data_ptr();
+    args.dst.info.count = static_cast<uint64_t>(dst.numel());
+    args.dst.info.datatype = uccDatatype.at(dst.scalar_type());
+    args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    runCollective(args);
+  });
+  entry->src = {inputBuffer};
+  entry->dst = {outputBuffer};
+  return enqueue(
+      std::move(entry),
+      "ucc:all_gather_base",
+      c10::optional<std::vector<at::Tensor>>({inputBuffer}));
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::reduce_scatter(
+    std::vector<at::Tensor>& outputTensors,
+    std::vector<std::vector<at::Tensor>>& inputTensors,
+    const ReduceScatterOptions& opts) {
+  checkSingleTensor(outputTensors);
+  TORCH_CHECK(
+      inputTensors.size() == 1,
+      "ProcessGroupUCC only supports a single tensor op");
+  TORCH_CHECK(
+      static_cast<int>(inputTensors[0].size()) == size_,
+      "Reduce scatter: number of input tensors should equal to the world size");
+  checkSameSizeAndType(outputTensors[0], inputTensors[0]);
+  TORCH_CHECK(
+      uccOp.count(opts.reduceOp) > 0,
+      "ProcessGroupUCC does not support reduce op ",
+      static_cast<int>(opts.reduceOp));
+
+  auto entry = std::make_unique<WorkEntry>([opts, this](WorkEntry& entry) {
+    // Flatten the per-rank inputs into one contiguous source buffer.
+    auto flat = at::cat(entry.src).contiguous();
+    auto& dst = entry.dst[0];
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.coll_type = UCC_COLL_TYPE_REDUCE_SCATTER;
+    args.op = uccOp.at(opts.reduceOp);
+    args.src.info.buffer = flat.data_ptr();
+    args.src.info.count = static_cast<uint64_t>(flat.numel());
+    args.src.info.datatype = uccDatatype.at(flat.scalar_type());
+    args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.dst.info.buffer = dst.data_ptr();
+    args.dst.info.count = static_cast<uint64_t>(dst.numel());
+    args.dst.info.datatype = uccDatatype.at(dst.scalar_type());
+    args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    runCollective(args);
+  });
+  entry->src = inputTensors[0];
+  entry->dst = outputTensors;
+  return enqueue(
+      std::move(entry),
+      "ucc:reduce_scatter",
+      c10::optional<std::vector<at::Tensor>>(inputTensors[0]));
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::_reduce_scatter_base(
+    at::Tensor& outputTensor,
+    at::Tensor& inputTensor,
+    const ReduceScatterOptions& opts) {
+  checkSingleTensorHelper(inputTensor);
+  checkSingleTensorHelper(outputTensor);
+  TORCH_CHECK(
+      inputTensor.numel() == outputTensor.numel() * size_,
+      "_reduce_scatter_base: input buffer size must equal world size times output buffer size");
+  TORCH_CHECK(
+      uccOp.count(opts.reduceOp) > 0,
+      "ProcessGroupUCC does not support reduce op ",
+      static_cast<int>(opts.reduceOp));
+
+  auto entry = std::make_unique<WorkEntry>([opts, this](WorkEntry& entry) {
+    auto& src = entry.src[0];
+    auto& dst = entry.dst[0];
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.coll_type = UCC_COLL_TYPE_REDUCE_SCATTER;
+    args.op = uccOp.at(opts.reduceOp);
+    args.src.info.buffer = src.data_ptr();
+    args.src.info.count = static_cast<uint64_t>(src.numel());
+    args.src.info.datatype = uccDatatype.at(src.scalar_type());
+    args.src.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    args.dst.info.buffer = dst.data_ptr();
+    args.dst.info.count = static_cast<uint64_t>(dst.numel());
+    args.dst.info.datatype = uccDatatype.at(dst.scalar_type());
+    args.dst.info.mem_type = UCC_MEMORY_TYPE_HOST;
+    runCollective(args);
+  });
+  entry->src = {inputTensor};
+  entry->dst = {outputTensor};
+  return enqueue(
+      std::move(entry),
+      "ucc:reduce_scatter_base",
+      c10::optional<std::vector<at::Tensor>>({inputTensor}));
+}
+
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupUCC::barrier(
+    const BarrierOptions& /* unused */) {
+  auto entry = std::make_unique<WorkEntry>([this](WorkEntry& /* unused */) {
+    ucc_coll_args_t args;
+    std::memset(&args, 0, sizeof(args));
+    args.coll_type = UCC_COLL_TYPE_BARRIER;
+    runCollective(args);
+  });
+  return enqueue(std::move(entry), "ucc:barrier", c10::nullopt);
+}
+
+} // namespace c10d
+
+#endif // USE_C10D_UCC
@@ -43,6 +43,34 @@ class TORCH_API Store : public torch::CustomClassHolder {
 
   virtual std::vector<uint8_t> get(const std::string& key) = 0;
 
+  // Batched variants of set()/get(). The default implementations simply
+  // loop, but backends with per-operation network round trips (TCPStore)
+  // override them to coalesce the whole batch into a single round trip.
+  virtual void multiSet(
+      const std::vector<std::string>& keys,
+      const std::vector<std::vector<uint8_t>>& values) {
+    TORCH_CHECK(
+        keys.size() == values.size(),
+        "multiSet requires one value per key, got ",
+        keys.size(),
+        " keys and ",
+        values.size(),
+        " values");
+    for (size_t i = 0; i < keys.size(); ++i) {
+      set(keys[i], values[i]);
+    }
+  }
+
+  virtual std::vector<std::vector<uint8_t>> multiGet(
+      const std::vector<std::string>& keys) {
+    std::vector<std::vector<uint8_t>> result;
+    result.reserve(keys.size());
+    for (const auto& key : keys) {
+      result.emplace_back(get(key));
+    }
+    return result;
+  }
+
   virtual int64_t add(const std::string& key, int64_t value) = 0;
 
   virtual bool deleteKey(const std::string& key) = 0;
@@ -77,6 +105,17 @@ class TORCH_API Store : public torch::CustomClassHolder {
         "watchKey only implemented for TCPStore and PrefixStore that wraps TCPStore.");
   }
 
+  // Like watchKey(), but the callback fires for every key starting with
+  // `prefix`, so one registration round trip covers an entire key family
+  // (e.g. all keys of a rendezvous round).
+  virtual void watchPrefix(
+      const std::string& /* unused */,
+      WatchKeyCallback /* unused */) {
+    TORCH_CHECK(
+        false,
+        "watchPrefix only implemented for TCPStore and PrefixStore that wraps TCPStore.");
+  }
+
  protected:
   std::chrono::milliseconds timeout_;
 };
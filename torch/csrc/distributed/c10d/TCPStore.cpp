@@ -17,6 +17,10 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
 #ifdef _WIN32
 #include <c10d/WinSockUtils.hpp>
 #else
@@ -146,6 +150,9 @@ enum class QueryType : uint8_t {
   GETNUMKEYS,
   WATCH_KEY,
   DELETE_KEY,
+  MULTI_SET,
+  MULTI_GET,
+  WATCH_PREFIX,
 };
 
 enum class CheckResponseType : uint8_t { READY, NOT_READY };
@@ -170,6 +177,7 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void run();
   void queryFds(std::vector<struct pollfd>& fds);
   void query(int socket);
+  void clearSocketWaitState(int socket);
 
   // The master runs on a single thread so only
   // one handler can be executed at a time
@@ -182,6 +190,13 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void deleteHandler(int socket);
   void waitHandler(int socket);
   void watchHandler(int socket);
+  void multiSetHandler(int socket);
+  void multiGetHandler(int socket) const;
+  void watchPrefixHandler(int socket);
+
+  // Shared by setHandler and multiSetHandler: stores the value and notifies
+  // waiting/watching clients.
+  void doSet(const std::string& key, std::vector<uint8_t>&& newData);
 
   bool checkKeys(const std::vector<std::string>& keys) const;
   // Helper function to alerts waiting workers, used in setHandler, getHandler
@@ -200,6 +215,8 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   std::unordered_map<int, size_t> keysAwaited_;
   // From key -> the list of sockets watching the key
   std::unordered_map<std::string, std::vector<int>> watchedSockets_;
+  // From prefix -> the list of sockets watching all keys under the prefix
+  std::unordered_map<std::string, std::vector<int>> watchedPrefixes_;
 };
 
 // Simply start the daemon thread
@@ -232,29 +249,8 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
       // exception, other connections will get an exception once they try to
       // use the store. We will go ahead and close this connection whenever
       // we hit an exception here.
+      clearSocketWaitState(fds[fdIdx].fd);
 
-      // Remove all the tracking state of the close FD
-      for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
-        for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
-          if (*vecIt == fds[fdIdx].fd) {
-            vecIt = it->second.erase(vecIt);
-          } else {
-            ++vecIt;
-          }
-        }
-        if (it->second.size() == 0) {
-          it = waitingSockets_.erase(it);
-        } else {
-          ++it;
-        }
-      }
-      for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
-        if (it->first == fds[fdIdx].fd) {
-          it = keysAwaited_.erase(it);
-        } else {
-          ++it;
-        }
-      }
       fds.erase(fds.begin() + fdIdx);
       sockets_.erase(sockets_.begin() + fdIdx - CONNECT_SOCKET_OFFSET);
       --fdIdx;
@@ -263,6 +259,31 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
   }
 }
 
+void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
+  // Remove all the tracking state of the closed socket
+  for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
+    for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
+      if (*vecIt == socket) {
+        vecIt = it->second.erase(vecIt);
+      } else {
+        ++vecIt;
+      }
+    }
+    if (it->second.size() == 0) {
+      it = waitingSockets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
+    if (it->first == socket) {
+      it = keysAwaited_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 // query communicates with the worker. The format
 // of the query is as follows:
 // type of query | size of arg1 | arg1 | size of arg2 | arg2 | ...
@@ -298,6 +319,15 @@ void TCPStoreMasterDaemon::query(int socket) {
   } else if (qt == QueryType::WATCH_KEY) {
     watchHandler(socket);
 
+  } else if (qt == QueryType::MULTI_SET) {
+    multiSetHandler(socket);
+
+  } else if (qt == QueryType::MULTI_GET) {
+    multiGetHandler(socket);
+
+  } else if (qt == QueryType::WATCH_PREFIX) {
+    watchPrefixHandler(socket);
+
   } else {
     TORCH_CHECK(false, "Unexpected query type");
   }
@@ -321,17 +351,29 @@ void TCPStoreMasterDaemon::sendKeyUpdatesToClients(
     const enum WatchResponseType& type,
     std::vector<uint8_t>& oldData,
     std::vector<uint8_t>& newData) {
-  for (int socket : watchedSockets_[key]) {
+  auto sendUpdate = [&](int socket) {
     tcputil::sendValue<WatchResponseType>(socket, type);
     tcputil::sendString(socket, key, true);
     tcputil::sendVector<uint8_t>(socket, oldData);
     tcputil::sendVector<uint8_t>(socket, newData);
+  };
+  for (int socket : watchedSockets_[key]) {
+    sendUpdate(socket);
+  }
+  // A socket registered for both the exact key and a covering prefix gets
+  // one notification per registration, matching watchKey semantics.
+  for (const auto& watched : watchedPrefixes_) {
+    if (key.compare(0, watched.first.size(), watched.first) == 0) {
+      for (int socket : watched.second) {
+        sendUpdate(socket);
+      }
+    }
   }
 }
 
-void TCPStoreMasterDaemon::setHandler(int socket) {
-  std::string key = tcputil::recvString(socket);
-  std::vector<uint8_t> newData = tcputil::recvVector<uint8_t>(socket);
+void TCPStoreMasterDaemon::doSet(
+    const std::string& key,
+    std::vector<uint8_t>&& newData) {
   std::vector<uint8_t> oldData;
   bool newKey = true;
   auto it = tcpStore_.find(key);
@@ -349,6 +391,12 @@ void TCPStoreMasterDaemon::setHandler(int socket) {
                key, WatchResponseType::KEY_UPDATED, oldData, newData);
 }
 
+void TCPStoreMasterDaemon::setHandler(int socket) {
+  std::string key = tcputil::recvString(socket);
+  std::vector<uint8_t> newData = tcputil::recvVector<uint8_t>(socket);
+  doSet(key, std::move(newData));
+}
+
 void TCPStoreMasterDaemon::compareSetHandler(int socket) {
   std::string key = tcputil::recvString(socket);
   std::vector<uint8_t> currentValue = tcputil::recvVector<uint8_t>(socket);
@@ -482,6 +530,38 @@ void TCPStoreMasterDaemon::watchHandler(int socket) {
       socket, WatchResponseType::KEY_CALLBACK_REGISTERED);
 }
 
+void TCPStoreMasterDaemon::multiSetHandler(int socket) {
+  SizeType nargs;
+  tcputil::recvBytes<SizeType>(socket, &nargs, 1);
+  for (const auto i : c10::irange(nargs)) {
+    (void)i;
+    std::string key = tcputil::recvString(socket);
+    std::vector<uint8_t> newData = tcputil::recvVector<uint8_t>(socket);
+    doSet(key, std::move(newData));
+  }
+}
+
+void TCPStoreMasterDaemon::multiGetHandler(int socket) const {
+  SizeType nargs;
+  tcputil::recvBytes<SizeType>(socket, &nargs, 1);
+  for (const auto i : c10::irange(nargs)) {
+    std::string key = tcputil::recvString(socket);
+    auto& data = tcpStore_.at(key);
+    tcputil::sendVector<uint8_t>(socket, data, i + 1 < nargs);
+  }
+}
+
+void TCPStoreMasterDaemon::watchPrefixHandler(int socket) {
+  std::string prefix = tcputil::recvString(socket);
+
+  // Record the socket to respond to when any key under the prefix changes
+  watchedPrefixes_[prefix].push_back(socket);
+
+  // Send update to TCPStoreWorkerDaemon on client
+  tcputil::sendValue<WatchResponseType>(
+      socket, WatchResponseType::KEY_CALLBACK_REGISTERED);
+}
+
 bool TCPStoreMasterDaemon::checkKeys(
     const std::vector<std::string>& keys) const {
   return std::all_of(keys.begin(), keys.end(), [this](const std::string& s) {
@@ -531,6 +611,93 @@ void TCPStoreMasterDaemon::run() {
     queryFds(fds);
   }
 }
+#elif defined(__linux__)
+// On Linux the master daemon multiplexes its clients with epoll rather than
+// poll. With thousands of ranks connected, every poll wakeup costs a kernel
+// scan of all registered fds plus a userspace pass to reset revents, which
+// makes rendezvous quadratic in the number of ranks; epoll only reports the
+// fds that are actually ready.
+void TCPStoreMasterDaemon::run() {
+  struct EpollFd {
+    int fd;
+    EpollFd() {
+      SYSCHECK_ERR_RETURN_NEG1(fd = ::epoll_create1(EPOLL_CLOEXEC));
+    }
+    ~EpollFd() {
+      ::close(fd);
+    }
+  } epoll;
+
+  auto addFd = [&epoll](int fd) {
+    struct epoll_event ev {};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    SYSCHECK_ERR_RETURN_NEG1(::epoll_ctl(epoll.fd, EPOLL_CTL_ADD, fd, &ev));
+  };
+  addFd(storeListenSocket_.handle());
+  // See the comment in the poll-based implementation below for why the main
+  // thread writes a byte to the control pipe on shutdown instead of relying
+  // on the hang-up event alone.
+  addFd(controlPipeFd_[0]);
+
+  std::array<struct epoll_event, 64> events{};
+  std::vector<int> staleFds;
+  while (true) {
+    int numReady;
+    SYSCHECK_ERR_RETURN_NEG1(
+        numReady = ::epoll_wait(epoll.fd, events.data(), events.size(), -1));
+    staleFds.clear();
+    for (const auto i : c10::irange(numReady)) {
+      const int fd = events[i].data.fd;
+
+      // A failed query earlier in this batch marked this fd stale; its
+      // event must not be serviced anymore.
+      if (std::find(staleFds.begin(), staleFds.end(), fd) != staleFds.end()) {
+        continue;
+      }
+
+      // TCPStore's listening socket has an event and it should now be able
+      // to accept new connections.
+      if (fd == storeListenSocket_.handle()) {
+        Socket socket = storeListenSocket_.accept();
+        int rawSocket = socket.handle();
+        sockets_.emplace_back(std::move(socket));
+        addFd(rawSocket);
+        continue;
+      }
+
+      // The pipe receives an event which tells us to shutdown the daemon
+      if (fd == controlPipeFd_[0]) {
+        // The main thread will write a byte to the pipe then close it before
+        // joining the background thread
+        return;
+      }
+
+      try {
+        query(fd);
+      } catch (...) {
+        // There was an error when processing query; see the comment in
+        // queryFds for why we swallow it. Destroying the socket closes the
+        // fd, which also removes it from the epoll set - but that close is
+        // deferred until the batch is drained: freeing the fd number here
+        // would let an accept() for a later event of this same batch reuse
+        // it, and a remaining stale event for the dead connection would
+        // then be routed to the brand-new one, whose blocking reads (on a
+        // socket that has sent nothing) would stall the daemon.
+        clearSocketWaitState(fd);
+        staleFds.push_back(fd);
+      }
+    }
+    for (const int fd : staleFds) {
+      for (auto it = sockets_.begin(); it != sockets_.end(); ++it) {
+        if (it->handle() == fd) {
+          sockets_.erase(it);
+          break;
+        }
+      }
+    }
+  }
+}
 #else
 void TCPStoreMasterDaemon::run() {
   std::vector<struct pollfd> fds;
@@ -598,6 +765,8 @@ class TCPStoreWorkerDaemon : public BackgroundThread {
   ~TCPStoreWorkerDaemon() override;
   // Set the callback to run key change
   void setCallback(std::string key, WatchKeyCallback cb);
+  // Set the callback to run when any key under the prefix changes
+  void setPrefixCallback(std::string prefix, WatchKeyCallback cb);
   void waitForCallbackRegistration() {
     // Block until callback has been registered successfully
     std::unique_lock<std::mutex> callbackRegistrationLock(
@@ -622,6 +791,8 @@ class TCPStoreWorkerDaemon : public BackgroundThread {
   void callbackHandler(int socket);
   // List of callbacks map each watched key
   std::unordered_map<std::string, WatchKeyCallback> keyToCallbacks_{};
+  // List of callbacks map each watched prefix
+  std::unordered_map<std::string, WatchKeyCallback> prefixToCallbacks_{};
   std::mutex keyToCallbacksMutex_{};
   std::mutex callbackRegistrationMutex_{};
   std::condition_variable callbackRegisteredCV_{};
@@ -645,6 +816,13 @@ void TCPStoreWorkerDaemon::setCallback(
   keyToCallbacks_[key] = callback;
 }
 
+void TCPStoreWorkerDaemon::setPrefixCallback(
+    std::string prefix,
+    WatchKeyCallback callback) {
+  const std::lock_guard<std::mutex> lock(keyToCallbacksMutex_);
+  prefixToCallbacks_[prefix] = callback;
+}
+
 // Runs all the callbacks that the worker has registered
 void TCPStoreWorkerDaemon::callbackHandler(int socket) {
   auto watchResponse = tcputil::recvValue<WatchResponseType>(socket);
@@ -671,7 +849,20 @@ void TCPStoreWorkerDaemon::callbackHandler(int socket) {
     newValue = std::string(newValueVec.begin(), newValueVec.end());
   }
   const std::lock_guard<std::mutex> lock(keyToCallbacksMutex_);
-  keyToCallbacks_.at(key)(currentValue, newValue);
+  auto it = keyToCallbacks_.find(key);
+  if (it != keyToCallbacks_.end()) {
+    it->second(currentValue, newValue);
+    return;
+  }
+  // Not an exact-key watch; the master only notifies us for keys we
+  // registered, so this update must belong to a watched prefix.
+  for (const auto& watched : prefixToCallbacks_) {
+    if (key.compare(0, watched.first.size(), watched.first) == 0) {
+      watched.second(currentValue, newValue);
+      return;
+    }
+  }
+  TORCH_CHECK(false, "Received update for unwatched key: ", key);
 }
 
 #ifdef _WIN32
@@ -840,15 +1031,21 @@ class TCPClient {
 
   void sendCommandForKey(QueryType type, const std::string& key);
 
-  void sendBytes(const std::vector<std::uint8_t>& value) {
-    tcputil::sendVector<std::uint8_t>(socket_.handle(), value);
+  void sendBytes(
+      const std::vector<std::uint8_t>& value,
+      bool moreData = false) {
+    tcputil::sendVector<std::uint8_t>(socket_.handle(), value, moreData);
+  }
+
+  void sendString(const std::string& value, bool moreData = false) {
+    tcputil::sendString(socket_.handle(), value, moreData);
   }
 
   void sendStrings(c10::ArrayRef<std::string> value);
 
   template <typename T>
-  void sendValue(const T& value) {
-    tcputil::sendValue<T>(socket_.handle(), value);
+  void sendValue(const T& value, bool moreData = false) {
+    tcputil::sendValue<T>(socket_.handle(), value, moreData);
   }
 
   std::vector<std::uint8_t> receiveBits() {
@@ -933,6 +1130,8 @@ class TCPCallbackClient {
 
   void setCallback(const std::string& key, WatchKeyCallback callback);
 
+  void setPrefixCallback(const std::string& prefix, WatchKeyCallback callback);
+
   explicit TCPCallbackClient(
       int rawSocket,
       std::unique_ptr<TCPStoreWorkerDaemon>&& daemon)
@@ -973,6 +1172,20 @@ void TCPCallbackClient::setCallback(
   daemon_->waitForCallbackRegistration();
 }
 
+void TCPCallbackClient::setPrefixCallback(
+    const std::string& prefix,
+    WatchKeyCallback callback) {
+  std::lock_guard<std::mutex> guard{mutex_};
+
+  daemon_->setPrefixCallback(prefix, callback);
+
+  tcputil::sendValue<QueryType>(rawSocket_, QueryType::WATCH_PREFIX);
+
+  tcputil::sendString(rawSocket_, prefix);
+
+  daemon_->waitForCallbackRegistration();
+}
+
 } // namespace detail
 
 using detail::Socket;
@@ -1080,6 +1293,51 @@ std::vector<uint8_t> TCPStore::doGet(const std::string& key) {
   return client_->receiveBits();
 }
 
+void TCPStore::multiSet(
+    const std::vector<std::string>& keys,
+    const std::vector<std::vector<uint8_t>>& values) {
+  TORCH_CHECK(
+      keys.size() == values.size(),
+      "multiSet requires one value per key, got ",
+      keys.size(),
+      " keys and ",
+      values.size(),
+      " values");
+  const std::lock_guard<std::mutex> lock(activeOpLock_);
+  client_->sendCommand(detail::QueryType::MULTI_SET);
+  client_->sendValue<SizeType>(keys.size(), /*moreData=*/true);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    client_->sendString(keyPrefix_ + keys[i], /*moreData=*/true);
+    client_->sendBytes(values[i], /*moreData=*/i + 1 < keys.size());
+  }
+}
+
+std::vector<std::vector<uint8_t>> TCPStore::multiGet(
+    const std::vector<std::string>& keys) {
+  const std::lock_guard<std::mutex> lock(activeOpLock_);
+  std::vector<std::string> prefixedKeys;
+  prefixedKeys.reserve(keys.size());
+  for (const std::string& key : keys) {
+    prefixedKeys.emplace_back(keyPrefix_ + key);
+  }
+  // One round trip to block until every key exists, one to fetch the batch.
+  doWait(prefixedKeys, timeout_);
+
+  client_->sendCommand(detail::QueryType::MULTI_GET);
+  client_->sendValue<SizeType>(
+      prefixedKeys.size(), /*moreData=*/true);
+  for (size_t i = 0; i < prefixedKeys.size(); ++i) {
+    client_->sendString(prefixedKeys[i], /*moreData=*/i + 1 < prefixedKeys.size());
+  }
+
+  std::vector<std::vector<uint8_t>> result;
+  result.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    result.emplace_back(client_->receiveBits());
+  }
+  return result;
+}
+
 int64_t TCPStore::add(const std::string& key, int64_t value) {
   const std::lock_guard<std::mutex> lock(activeOpLock_);
   return incrementValueBy(keyPrefix_ + key, value);
@@ -1097,6 +1355,13 @@ void TCPStore::watchKey(const std::string& key, WatchKeyCallback callback) {
   callbackClient_->setCallback(keyPrefix_ + key, callback);
 }
 
+void TCPStore::watchPrefix(
+    const std::string& prefix,
+    WatchKeyCallback callback) {
+  const std::lock_guard<std::mutex> lock(activeOpLock_);
+  callbackClient_->setPrefixCallback(keyPrefix_ + prefix, callback);
+}
+
 int64_t TCPStore::incrementValueBy(const std::string& key, int64_t delta) {
   client_->sendCommandForKey(detail::QueryType::ADD, key);
   client_->sendValue<std::int64_t>(delta);
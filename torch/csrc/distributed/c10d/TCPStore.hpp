@@ -59,6 +59,15 @@ class TORCH_API TCPStore : public Store {
 
   std::vector<uint8_t> get(const std::string& key) override;
 
+  // Batched set/get; the whole batch is exchanged in a single round trip
+  // with the master daemon.
+  void multiSet(
+      const std::vector<std::string>& keys,
+      const std::vector<std::vector<uint8_t>>& values) override;
+
+  std::vector<std::vector<uint8_t>> multiGet(
+      const std::vector<std::string>& keys) override;
+
   int64_t add(const std::string& key, int64_t value) override;
 
   bool deleteKey(const std::string& key) override;
@@ -70,6 +79,11 @@ class TORCH_API TCPStore : public Store {
   // threads. Only one thread can call watchKey() at a time.
   void watchKey(const std::string& key, WatchKeyCallback callback) override;
 
+  // Same contract and threading caveats as watchKey(), but the callback
+  // fires for every key starting with the given prefix.
+  void watchPrefix(const std::string& prefix, WatchKeyCallback callback)
+      override;
+
   bool check(const std::vector<std::string>& keys) override;
 
   int64_t getNumKeys() override;
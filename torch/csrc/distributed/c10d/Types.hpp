@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 namespace c10d {
 
@@ -19,6 +20,25 @@ enum class ReduceOp : std::uint8_t {
 
 constexpr auto kUnsetTimeout = std::chrono::milliseconds(-1);
 
+// Traffic-shaping budget for a process group's collectives, enforced by a
+// token-bucket rate limiter (see CollectivePacer) where the backend hands
+// work to the network.
+struct PacingOptions {
+  // Sustained collective bandwidth budget in bytes per second. Zero (the
+  // default) disables pacing.
+  std::int64_t bandwidthBytesPerSecond = 0;
+  // Maximum burst the bucket can accumulate. Zero picks 100ms worth of the
+  // budget.
+  std::int64_t burstBytes = 0;
+  // Tier of this group's traffic when several groups share a bucket; blocked
+  // withdrawals from higher tiers are served first.
+  int priority = 0;
+  // Share one process-wide bucket among all groups constructed with this
+  // flag instead of giving each group a private bucket. The first such
+  // group's budget configures the shared bucket.
+  bool shareProcessWideBucket = false;
+};
+
 struct BroadcastOptions {
   int rootRank = 0;
   int rootTensor = 0;
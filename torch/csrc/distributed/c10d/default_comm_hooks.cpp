@@ -45,6 +45,34 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> BF16CompressCommHook::runHook(
+    GradBucket& bucket) {
+  auto compressed_tensor = bucket.getBufferRef().to(torch::kBFloat16);
+  // Apply the division first to avoid overflow.
+  compressed_tensor /= state_->getSize();
+  std::vector<at::Tensor> tensors = {compressed_tensor};
+
+  auto allreduce_fut = state_->allreduce(tensors)->getFuture();
+  auto decompressed_tensor = bucket.getBufferRef();
+  auto decompress = [decompressed_tensor](c10::ivalue::Future& allreduce_fut) {
+    auto result = allreduce_fut.value();
+    TORCH_INTERNAL_ASSERT(
+        result.isTensorList(),
+        "ProcessGroup::allreduce should return TensorList");
+
+    auto reduce_tensor = result.toTensorVector()[0];
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      reduce_tensor.scalar_type() == at::ScalarType::BFloat16,
+      "Expected reduced tensor to be bf16 in BF16CompressHook, but got type ",
+      reduce_tensor.scalar_type()
+    );
+    decompressed_tensor.copy_(reduce_tensor);
+    return c10::IValue(decompressed_tensor);
+  };
+
+  return allreduce_fut->then(decompress, allreduce_fut->elementType());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::
     runHook(GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
@@ -8,6 +8,7 @@ namespace c10d {
 enum class BuiltinCommHookType {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  BF16_COMPRESS = 3,
 };
 
 class AllReduceCommHook : public CppCommHookInterface<ProcessGroup*> {
@@ -30,6 +31,19 @@ class FP16CompressCommHook : public CppCommHookInterface<ProcessGroup*> {
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+// Same as FP16CompressCommHook, but compresses the bucket to BFloat16.
+// BFloat16 keeps the dynamic range of FP32, so no gradient scaling is needed;
+// requires NCCL 2.10+ for BFloat16 allreduce support.
+class BF16CompressCommHook : public CppCommHookInterface<ProcessGroup*> {
+ public:
+  explicit BF16CompressCommHook(ProcessGroup* state)
+      : CppCommHookInterface<ProcessGroup*>(state) {}
+
+  ~BF16CompressCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the user.
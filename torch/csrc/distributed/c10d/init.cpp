@@ -24,6 +24,10 @@
 #include <c10d/ProcessGroupMPI.hpp>
 #endif
 
+#ifdef USE_C10D_UCC
+#include <c10d/ProcessGroupUCC.hpp>
+#endif
+
 #include <c10d/PrefixStore.hpp>
 #include <fmt/format.h>
 #include <pybind11/chrono.h>
@@ -330,9 +334,10 @@ Replaces the tensor in the bucket with the input tensor buffer.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS`` and ``BF16_COMPRESS``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("BF16_COMPRESS", ::c10d::BuiltinCommHookType::BF16_COMPRESS);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -1430,6 +1435,11 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               py::arg("size"),
               py::arg("timeout") = kProcessGroupDefaultTimeout,
               py::call_guard<py::gil_scoped_release>())
+          .def(
+              "init_communicators",
+              &::c10d::ProcessGroupNCCL::initCommunicators,
+              py::arg("devices") = std::vector<at::Device>(),
+              py::call_guard<py::gil_scoped_release>())
           .def_property_readonly(
               "options", &::c10d::ProcessGroupNCCL::getOptions)
           .def_property_readonly(
@@ -1481,6 +1491,19 @@ Example::
       py::call_guard<py::gil_scoped_release>());
 #endif
 
+#ifdef USE_C10D_UCC
+  auto processGroupUCC =
+      intrusive_ptr_no_gil_destructor_class_<::c10d::ProcessGroupUCC>(
+          module, "ProcessGroupUCC", processGroup);
+  processGroupUCC.def_static(
+      "create",
+      [](const c10::intrusive_ptr<::c10d::Store>& store, int rank, int size) {
+        return ::c10d::ProcessGroupUCC::createProcessGroupUCC(
+            store, rank, size);
+      },
+      py::call_guard<py::gil_scoped_release>());
+#endif
+
   py::class_<::c10d::ProcessGroup::Work,
              c10::intrusive_ptr<::c10d::ProcessGroup::Work>,
              ::c10d::PyProcessGroup::PyWork>(module, "Work")
@@ -1525,6 +1548,22 @@ Example::
           &::c10d::ProcessGroup::Work::wait,
           py::arg("timeout") = kNoTimeout,
           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "get_offloaded_future",
+          [](::c10d::ProcessGroup::Work& work, int64_t priority)
+              -> std::shared_ptr<jit::PythonFutureWrapper> {
+            return std::make_shared<jit::PythonFutureWrapper>(
+                work.getOffloadedFuture(priority));
+          },
+          py::arg("priority") = 0,
+          R"(
+            Like ``get_future``, but the returned ``torch.futures.Future``
+            completes on a dedicated c10d callback executor thread for the
+            work's device, so callbacks attached to it never run on the
+            backend's communication progress threads (e.g. the NCCL
+            watchdog). Callbacks with a higher ``priority`` run first when
+            the executor is backlogged.
+           )")
       .def(
           "get_future",
           [](::c10d::ProcessGroup::Work& work)
@@ -4,6 +4,7 @@
 #include <c10d/default_comm_hooks.hpp>
 
 #include <functional>
+#include <unordered_set>
 
 #include <c10/core/DeviceGuard.h>
 #include <c10/core/StreamGuard.h>
@@ -92,6 +93,7 @@ Reducer::Reducer(
       find_unused_parameters_(find_unused_parameters),
       gradient_as_bucket_view_(gradient_as_bucket_view),
       local_used_map_reduced_(false),
+      global_used_map_cache_valid_(false),
       num_iterations_(0),
       num_buckets_ready_(0),
       has_rebuilt_bucket_(false),
@@ -245,6 +247,12 @@ Reducer::Reducer(
 // be specified by calling `register_builtin_comm_hook` from Python API.
 
 Reducer::~Reducer() noexcept(false) {
+  // A background bucket reassignment kicked off at the end of the last
+  // backward pass may still be referencing this Reducer; wait for it.
+  if (rebuilt_bucket_assignment_future_.valid()) {
+    rebuilt_bucket_assignment_future_.wait();
+  }
+
   // Remove all hooks on variables registered by this Reducer. This is necessary
   // to make DDP failure recoverable. Otherwise, multiple Reducer instances
   // (from recoveries) will add their hooks to the original model, and those
@@ -286,12 +294,19 @@ void Reducer::initialize_local_used_map() {
   local_used_map_ =
       at::zeros({static_cast<long>(variable_count)}, options);
 
+  // See Note [Steady-state local_used_map_ caching]
+  prev_local_used_map_ =
+      at::zeros({static_cast<long>(variable_count)}, options);
+  global_used_map_cache_ =
+      at::zeros({static_cast<long>(variable_count)}, options);
+
   // This tensor needs to be on the same device as the replica params because
   // backend such as NCCL may not support CPU tensors, and hence it might not
   // work if we always put it on CPU.
   options = options.device(params_[0].device());
   local_used_map_dev_ =
       at::empty({static_cast<long>(variable_count)}, options);
+  local_used_map_changed_dev_ = at::empty({1}, options);
 }
 
 void Reducer::check_grad_layout(
@@ -636,8 +651,50 @@ void Reducer::autograd_hook(size_t index) {
   }
 }
 
+// Note [Steady-state local_used_map_ caching]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With find_unused_parameters=true the usage map is a per-parameter tensor,
+// so allreducing it every iteration adds a fixed cost that grows with the
+// model. In most trainings the set of locally used parameters settles after
+// a few iterations, and the global map is a pure function of the per-rank
+// local maps; once no rank's local map changes, the previous global map is
+// still the consensus and re-reducing it is wasted bandwidth.
+//
+// We therefore allreduce a single "my local map changed" flag here, and
+// defer the full map allreduce to finish_local_used_map_reduction(), which
+// runs it only when some rank reported a change. The flag result is
+// identical on all ranks, so all ranks agree on whether the full map
+// collective runs and the collective schedules stay matched. Since both the
+// flag wait and the conditional full reduction happen after every bucket
+// allreduce of the iteration has been launched, the collective order is the
+// same on every rank as well.
 void Reducer::all_reduce_local_used_map() {
   // See Note [Skip allreducing local_used_map_dev]
+  // See Note [Steady-state local_used_map_ caching]
+  local_used_map_changed_dev_.fill_(
+      global_used_map_cache_valid_ &&
+              local_used_map_.equal(prev_local_used_map_)
+          ? 0
+          : 1);
+  std::vector<at::Tensor> temp_local_used_map_changed_vec_ = {
+      local_used_map_changed_dev_};
+  local_used_work_ =
+      process_group_->allreduce(temp_local_used_map_changed_vec_);
+}
+
+void Reducer::finish_local_used_map_reduction() {
+  // Completes the reduction started by all_reduce_local_used_map(), leaving
+  // the global usage map in local_used_map_.
+  // See Note [Steady-state local_used_map_ caching]
+  local_used_work_->wait();
+  if (local_used_map_changed_dev_.item<int>() == 0) {
+    // No rank's local usage changed since the last full reduction, so the
+    // cached global map is still the consensus.
+    local_used_map_.copy_(global_used_map_cache_);
+    local_used_map_reduced_ = true;
+    return;
+  }
+
   // H2D from local_used_map_ to local_used_map_dev_
   if (local_used_map_dev_.is_cuda()) {
     // Note [local_used_map_ -> local_used_map_dev copying]
@@ -662,6 +719,11 @@ void Reducer::all_reduce_local_used_map() {
     // won't do any blocking work between now and the re-zeroing, so the
     // danger is real.
     //
+    // Now that this copy runs at the wait point and blocks on the
+    // allreduce below before any host mutation, the window is much
+    // narrower than it used to be, but the pinned staging copy is kept
+    // as cheap insurance.
+    //
     // Defensively ensures local_used_map_tmp is distinct from
     // local_used_map_
     auto local_used_map_tmp = at::native::empty_like(
@@ -682,7 +744,18 @@ void Reducer::all_reduce_local_used_map() {
     local_used_map_dev_.copy_(local_used_map_, true);
   }
   std::vector<at::Tensor> temp_local_used_map_dev_vec_ = {local_used_map_dev_};
-  local_used_work_ = process_group_->allreduce(temp_local_used_map_dev_vec_);
+  auto local_used_map_work =
+      process_group_->allreduce(temp_local_used_map_dev_vec_);
+  // Remember the local map that produced this reduction before the D2H copy
+  // below overwrites local_used_map_ with the global result.
+  prev_local_used_map_.copy_(local_used_map_);
+  local_used_map_work->wait();
+  // D2H from local_used_map_dev_ to local_used_map_
+  // Blocking copy, if local_used_map_dev_ is cuda
+  local_used_map_.copy_(local_used_map_dev_);
+  global_used_map_cache_.copy_(local_used_map_);
+  global_used_map_cache_valid_ = true;
+  local_used_map_reduced_ = true;
 }
 
 at::Tensor& Reducer::get_param_from_index(size_t index) {
@@ -947,7 +1020,9 @@ void Reducer::initialize_buckets(std::vector<std::vector<size_t>> bucket_indices
       logger_,
       "`initialize_buckets` must NOT be called during autograd execution.");
 
-  // Clear current bucket assignment.
+  // Clear current bucket assignment, but keep the old buckets around so that
+  // buckets whose variable composition is unchanged can be reused below.
+  auto prev_buckets = std::move(buckets_);
   buckets_.clear();
   variable_locators_.clear();
 
@@ -958,6 +1033,22 @@ void Reducer::initialize_buckets(std::vector<std::vector<size_t>> bucket_indices
   const auto bucket_count = bucket_indices.size();
   buckets_.reserve(bucket_count);
   for (const auto bucket_index : c10::irange(bucket_count)) {
+    // Reuse the previous bucket wholesale when its variable composition is
+    // unchanged: the flattened `gradients` tensor, the views into it, and
+    // the per-variable metadata all remain valid, so an incremental rebuild
+    // only pays for the buckets the new ready order actually moved.
+    if (bucket_index < prev_buckets.size() &&
+        prev_buckets[bucket_index].variable_indices ==
+            bucket_indices[bucket_index]) {
+      size_t intra_bucket_index = 0;
+      for (const auto variable_index : bucket_indices[bucket_index]) {
+        variable_locators_[variable_index] =
+            VariableLocator(bucket_index, intra_bucket_index++);
+      }
+      buckets_.push_back(std::move(prev_buckets[bucket_index]));
+      continue;
+    }
+
     Bucket bucket;
 
     // TODO(@pietern): Validate indices.
@@ -1385,15 +1476,12 @@ void Reducer::finalize_bucket_dense(Bucket& bucket) {
       global_unused =
           local_used_map_[variable_index].item<int>() == 0;
       if (global_unused && !local_used_map_reduced_) {
-        // Wait for local_used_map reduction to complete.
-        local_used_work_->wait();
-        // D2H from local_used_map_dev_ to local_used_map_
-        // Blocking copy, if local_used_map_dev_ is cuda
-        local_used_map_.copy_(local_used_map_dev_);
+        // Complete the pending local_used_map reduction; afterwards
+        // local_used_map_ holds the global consensus.
+        finish_local_used_map_reduction();
 
         global_unused =
             local_used_map_[variable_index].item<int>() == 0;
-        local_used_map_reduced_ = true;
       }
     }
 
@@ -1495,8 +1583,11 @@ void Reducer::finalize_backward() {
     // complete before kicking off next one. Otherwise the previous one may
     // interfere, write to the device-side memory and clobber the content of
     // local_unused_maps_dev_.
+    // Even when this rank never consulted the global map this iteration, the
+    // reduction must be driven to completion: if any rank reported a change,
+    // every rank has to take part in the full map allreduce that finishes it.
     if (!local_used_map_reduced_) {
-      local_used_work_->wait();
+      finish_local_used_map_reduction();
     }
   }
 
@@ -1510,6 +1601,19 @@ void Reducer::finalize_backward() {
   if (should_collect_runtime_stats()) {
     record_backward_comm_end_time();
   }
+
+  // The gradient ready order is final once backward finishes, so the
+  // (CPU-only, collective-free) bucket reassignment can be computed in the
+  // background while the next forward pass runs. rebuild_buckets() consumes
+  // the result on the next forward pass and then only pays for syncing the
+  // assignment across ranks and re-initializing the buckets that moved.
+  if (should_rebuild_buckets() &&
+      rebuilt_param_indices_.size() == params_.size()) {
+    rebuilt_bucket_assignment_future_ = std::async(
+        std::launch::async, [this] {
+          return compute_rebuilt_bucket_assignment();
+        });
+  }
 }
 
 void Reducer::runGradCallbackForVariable(
@@ -1627,6 +1731,44 @@ bool Reducer::rebuild_buckets() {
     return false;
   }
 
+  std::vector<std::vector<size_t>> rebuilt_bucket_indices;
+  std::vector<size_t> per_bucket_size_limits;
+  if (rebuilt_bucket_assignment_future_.valid()) {
+    // The assignment was already computed in the background while the forward
+    // pass ran (see finalize_backward); only syncing and initialization of
+    // the buckets that moved remain on the critical path.
+    std::tie(rebuilt_bucket_indices, per_bucket_size_limits) =
+        rebuilt_bucket_assignment_future_.get();
+  } else {
+    std::tie(rebuilt_bucket_indices, per_bucket_size_limits) =
+        compute_rebuilt_bucket_assignment();
+  }
+
+  if (ddp_debug_level_ != c10d::DebugLevel::Off) {
+    TORCH_INTERNAL_ASSERT(
+        rebuilt_bucket_indices.size() == per_bucket_size_limits.size())
+    LOG(INFO) << rebuilt_bucket_indices.size()
+              << " buckets rebuilt with size limits: "
+              << c10::Join(", ", per_bucket_size_limits)
+              << " bytes.";
+  }
+
+  // For rebuilt bucket indices, it needs to be synced across all ranks.
+  // Broadcast the newly rebuilt bucket indices from rank 0 in default.
+  // After syncing up rebuilt bucket indices, initialize buckets for reducer.
+  sync_bucket_indices(rebuilt_bucket_indices);
+
+  has_rebuilt_bucket_ = true;
+  rebuilt_params_.clear();
+  rebuilt_param_indices_.clear();
+
+  initialize_buckets(std::move(rebuilt_bucket_indices));
+
+  return true;
+}
+
+std::tuple<std::vector<std::vector<size_t>>, std::vector<size_t>>
+Reducer::compute_rebuilt_bucket_assignment() {
   TORCH_INTERNAL_ASSERT(
       rebuilt_params_.size() == rebuilt_param_indices_.size(),
       c10::str(
@@ -1649,6 +1791,40 @@ bool Reducer::rebuild_buckets() {
   std::vector<size_t> per_bucket_size_limits;
   auto ddp_set_last_bucket_as_small =
       (parse_env("DDP_SET_LAST_BUCKET_CAP").compare("1") == 0);
+  auto ddp_adaptive_bucket_cap =
+      (parse_env("DDP_ADAPTIVE_BUCKET_CAP").compare("1") == 0);
+  size_t small_tensor_fusion_bytes = 0;
+  if (ddp_adaptive_bucket_cap) {
+    // Models with many tiny parameters (norm scales, biases) pay a collective
+    // launch per bucket entry; fuse sub-1KiB grads into one flattened bucket
+    // that is allreduced once per iteration.
+    small_tensor_fusion_bytes = 1024;
+    // If the measured per-bucket communication time from the previous
+    // iteration is dominated by launch latency rather than bandwidth, the
+    // bucket cap is too small for this model/interconnect; scale it up so
+    // fewer, larger collectives are issued.
+    constexpr int64_t kMinPerBucketCommNs = 200 * 1000; // 200us
+    constexpr size_t kMaxBucketCapScale = 8;
+    if (timer_ && !buckets_.empty()) {
+      auto comm_time_ns = timer_->measureDifference(
+          Timer::Event::kBackwardCommStart, Timer::Event::kBackwardCommEnd);
+      if (comm_time_ns && *comm_time_ns > 0) {
+        const int64_t per_bucket_ns =
+            *comm_time_ns / static_cast<int64_t>(buckets_.size());
+        if (per_bucket_ns < kMinPerBucketCommNs) {
+          const auto scale = std::min(
+              kMaxBucketCapScale,
+              static_cast<size_t>(kMinPerBucketCommNs / per_bucket_ns));
+          bucket_size_limits.back() = bucket_bytes_cap_ * scale;
+          if (ddp_debug_level_ != c10d::DebugLevel::Off) {
+            LOG(INFO) << "Per-bucket allreduce took " << per_bucket_ns
+                      << "ns (launch latency bound); scaling bucket cap to "
+                      << bucket_size_limits.back() << " bytes.";
+          }
+        }
+      }
+    }
+  }
 
   if (ddp_set_last_bucket_as_small) {
     // Reverse so that first_bucket_bytes_cap_ (smaller bucket) becomes the last
@@ -1665,7 +1841,8 @@ bool Reducer::rebuild_buckets() {
           bucket_size_limits,
           expect_sparse_gradients_,
           rebuilt_param_indices_,
-          logger_);
+          logger_,
+          small_tensor_fusion_bytes);
 
   if (ddp_set_last_bucket_as_small) {
     // Reverse again because buckets were rebuilt in the opposite of gradient
@@ -1674,27 +1851,8 @@ bool Reducer::rebuild_buckets() {
     std::reverse(per_bucket_size_limits.begin(), per_bucket_size_limits.end());
   }
 
-  if (ddp_debug_level_ != c10d::DebugLevel::Off) {
-    TORCH_INTERNAL_ASSERT(
-        rebuilt_bucket_indices.size() == per_bucket_size_limits.size())
-    LOG(INFO) << rebuilt_bucket_indices.size()
-              << " buckets rebuilt with size limits: "
-              << c10::Join(", ", per_bucket_size_limits)
-              << " bytes.";
-  }
-
-  // For rebuilt bucket indices, it needs to be synced across all ranks.
-  // Broadcast the newly rebuilt bucket indices from rank 0 in default.
-  // After syncing up rebuilt bucket indices, initialize buckets for reducer.
-  sync_bucket_indices(rebuilt_bucket_indices);
-
-  has_rebuilt_bucket_ = true;
-  rebuilt_params_.clear();
-  rebuilt_param_indices_.clear();
-
-  initialize_buckets(std::move(rebuilt_bucket_indices));
-
-  return true;
+  return std::make_tuple(
+      std::move(rebuilt_bucket_indices), std::move(per_bucket_size_limits));
 }
 
 // See Note [DDP Communication Hook]
@@ -1726,6 +1884,11 @@ void Reducer::register_builtin_comm_hook(
           std::make_unique<c10d::FP16CompressCommHook>(process_group_.get());
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::BF16_COMPRESS:
+      comm_hook_ =
+          std::make_unique<c10d::BF16CompressCommHook>(process_group_.get());
+      LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
@@ -1920,7 +2083,8 @@ compute_bucket_assignment_by_size(
     const std::vector<size_t>& bucket_size_limits,
     const std::vector<bool>& expect_sparse_gradient,
     const std::vector<int64_t>& tensor_indices,
-    const c10::optional<std::weak_ptr<c10d::Logger>>& logger) {
+    const c10::optional<std::weak_ptr<c10d::Logger>>& logger,
+    size_t small_tensor_fusion_bytes) {
   // Either expect_sparse_gradient is not specified or it has as many elements
   // as the vector with tensors.
   TORCH_INTERNAL_ASSERT(
@@ -1948,6 +2112,11 @@ compute_bucket_assignment_by_size(
   std::unordered_map<BucketKey, BucketAccumulator, c10::hash<BucketKey>>
       buckets;
 
+  // Fused buckets for tensors below small_tensor_fusion_bytes; exempt from
+  // the bucket size limits.
+  std::unordered_map<BucketKey, BucketAccumulator, c10::hash<BucketKey>>
+      small_tensor_buckets;
+
   for (const auto i : c10::irange(tensors.size())) {
     const auto& tensor = tensors[i];
     auto msg = std::string("No support for sparse tensors.");
@@ -1972,9 +2141,19 @@ compute_bucket_assignment_by_size(
     }
 
     auto key = BucketKey(tensor.scalar_type(), tensor.device());
+    const size_t tensor_bytes = tensor.numel() * tensor.element_size();
+    // Tiny tensors are fused into a dedicated, unbounded bucket per key so
+    // collective launch overhead is paid once for all of them.
+    if (small_tensor_fusion_bytes != 0 &&
+        tensor_bytes < small_tensor_fusion_bytes) {
+      auto& small_bucket = small_tensor_buckets[key];
+      small_bucket.indices.push_back(tensor_index);
+      small_bucket.size += tensor_bytes;
+      continue;
+    }
     auto& bucket = buckets[key];
     bucket.indices.push_back(tensor_index);
-    bucket.size += tensor.numel() * tensor.element_size();
+    bucket.size += tensor_bytes;
 
     // Initialize bucket size limit iterator if necessary.
     if (bucket_size_limit_iterators.count(key) == 0) {
@@ -2004,6 +2183,14 @@ compute_bucket_assignment_by_size(
     }
   }
 
+  // Emit one fused bucket per key for the small tensors.
+  for (auto& it : small_tensor_buckets) {
+    auto& bucket = it.second;
+    if (!bucket.indices.empty()) {
+      result.emplace_back(std::move(bucket.indices), kNoSizeLimit);
+    }
+  }
+
   // If tensor_indices is not empty, the order of the tensors is in the gradient
   // ready order, so no need to sort.
   // If tensor_indices is empty, sort resulting buckets by the minimum tensor
@@ -2040,6 +2227,33 @@ compute_bucket_assignment_by_size(
   return std::make_tuple(bucket_indices, per_bucket_size_limits);
 }
 
+namespace {
+
+// Fingerprint of a DDP parameter layout: param count plus every param's
+// dtype, sizes, and strides. Bucket assignment is a pure function of these,
+// so matching fingerprints imply matching bucket layouts too.
+uint64_t compute_params_fingerprint(const std::vector<at::Tensor>& params) {
+  size_t hash = params.size();
+  for (const auto& t : params) {
+    hash = c10::hash_combine(hash, static_cast<size_t>(t.scalar_type()));
+    for (const auto& sz : t.sizes()) {
+      hash = c10::hash_combine(hash, static_cast<size_t>(sz));
+    }
+    for (const auto& str : t.strides()) {
+      hash = c10::hash_combine(hash, static_cast<size_t>(str));
+    }
+  }
+  return hash;
+}
+
+// Fingerprints already verified against each process group in this process,
+// so DDP re-construction over a recurring group (elastic restarts of the
+// same model) skips even the single-element allgather.
+std::mutex verified_layouts_mutex;
+std::unordered_map<void*, std::unordered_set<uint64_t>> verified_layouts;
+
+} // namespace
+
 // Verifies corresponding params in the model replica have the same sizes/strides
 // across processes.
 void verify_params_across_processes(
@@ -2047,6 +2261,49 @@ void verify_params_across_processes(
     const std::vector<at::Tensor>& params,
     const c10::optional<std::weak_ptr<c10d::Logger>>& logger) {
 
+  // Layout-fingerprint fast path: instead of broadcasting per-param
+  // metadata (2 * dim entries per param), ranks exchange one hash of the
+  // full layout. When every rank reports the same hash the layouts agree
+  // and the verbose verification below is skipped; on any mismatch we fall
+  // through to it for its per-param error messages. A layout verified once
+  // against a process group is not re-exchanged in this process.
+  const auto fingerprint = compute_params_fingerprint(params);
+  {
+    std::lock_guard<std::mutex> lock(verified_layouts_mutex);
+    auto it = verified_layouts.find(process_group.get());
+    if (it != verified_layouts.end() &&
+        it->second.count(fingerprint) != 0) {
+      return;
+    }
+  }
+  {
+    at::TensorOptions fp_options;
+    fp_options = fp_options.dtype(at::kLong);
+    fp_options = fp_options.device(params[0].device());
+    at::Tensor fp_tensor = at::tensor(
+        {static_cast<int64_t>(fingerprint)}, fp_options);
+    std::vector<std::vector<at::Tensor>> fp_output_tensors;
+    fp_output_tensors.emplace_back(std::vector<at::Tensor>{});
+    for (const auto i : c10::irange(process_group->getSize())) {
+      (void)i;
+      fp_output_tensors.front().emplace_back(at::empty_like(fp_tensor));
+    }
+    std::vector<at::Tensor> fp_vec{fp_tensor};
+    process_group->allgather(fp_output_tensors, fp_vec)->wait();
+    bool all_match = true;
+    for (const auto& rank_fp : fp_output_tensors.front()) {
+      if (rank_fp[0].item<int64_t>() != static_cast<int64_t>(fingerprint)) {
+        all_match = false;
+        break;
+      }
+    }
+    if (all_match) {
+      std::lock_guard<std::mutex> lock(verified_layouts_mutex);
+      verified_layouts[process_group.get()].insert(fingerprint);
+      return;
+    }
+  }
+
   // First verify number of parameters to avoid inconsistent inputs into
   // broadcast which can cause a crash.
   // See https://github.com/pytorch/pytorch/issues/73547
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <tuple>
@@ -223,6 +224,16 @@ class TORCH_API Reducer {
   at::Tensor local_used_map_dev_;
   // Indicate that reduction is done and D2H copy is done as well.
   bool local_used_map_reduced_;
+  // See Note [Steady-state local_used_map_ caching]
+  // Snapshot of local_used_map_ as of the last full reduction, and a host
+  // copy of the global map that reduction produced. Valid once the first
+  // full reduction has completed.
+  at::Tensor prev_local_used_map_;
+  at::Tensor global_used_map_cache_;
+  bool global_used_map_cache_valid_;
+  // One-element device tensor holding this rank's "local usage changed since
+  // the last full reduction" flag, allreduced in place of the full map.
+  at::Tensor local_used_map_changed_dev_;
 
   // Weak pointer to associated DDP logger.
   std::weak_ptr<c10d::Logger> logger_;
@@ -230,7 +241,7 @@ class TORCH_API Reducer {
   // at the end of backwards pass.
   c10::optional<c10::List<c10::intrusive_ptr<c10::ivalue::Future>>> installed_futures_{c10::nullopt};
 
-  // Work handle for allreduce on local_used_map_
+  // Work handle for the allreduce on local_used_map_changed_dev_
   c10::intrusive_ptr<c10d::ProcessGroup::Work> local_used_work_;
 
   void mark_variable_ready_dense(size_t variable_index);
@@ -261,6 +272,14 @@ class TORCH_API Reducer {
   // the buckets
   void sync_bucket_indices(std::vector<std::vector<size_t>>& bucket_indices);
 
+  // Computes the rebuilt bucket assignment from the gradient ready order
+  // recorded in `rebuilt_params_`/`rebuilt_param_indices_`. Runs either
+  // inline from `rebuild_buckets` or in the background at the end of the
+  // backward pass (see `finalize_backward`) so the computation overlaps with
+  // the next forward pass.
+  std::tuple<std::vector<std::vector<size_t>>, std::vector<size_t>>
+  compute_rebuilt_bucket_assignment();
+
   // We'd like to use DistAutogradContext::GradCallback here but dist autograd
   // doesn't exist under Windows. So we just directly use the concrete type but
   // to preserve and enforce our original intent we do a static assert when dist
@@ -416,6 +435,11 @@ class TORCH_API Reducer {
   bool has_rebuilt_bucket_;
   std::vector<at::Tensor> rebuilt_params_;
   std::vector<int64_t> rebuilt_param_indices_;
+  // Bucket reassignment computed in the background at the end of the backward
+  // pass (see finalize_backward) so it overlaps with the next forward pass;
+  // consumed by rebuild_buckets().
+  std::future<std::tuple<std::vector<std::vector<size_t>>, std::vector<size_t>>>
+      rebuilt_bucket_assignment_future_;
   const int64_t bucket_bytes_cap_;
 
 #ifndef _WIN32
@@ -473,6 +497,13 @@ class TORCH_API Reducer {
   // kick off all reduce to local used map, it can help find global unused
   // parameters
   void all_reduce_local_used_map();
+
+  // Completes the reduction started by all_reduce_local_used_map(), leaving
+  // the global usage map in local_used_map_. Runs the full map allreduce
+  // only if some rank's local usage changed since the last full reduction;
+  // otherwise reuses the cached global map.
+  // See Note [Steady-state local_used_map_ caching]
+  void finish_local_used_map_reduction();
   // initialize locally used parameter maps
   void initialize_local_used_map();
   // get current cuda stream
@@ -527,7 +558,12 @@ compute_bucket_assignment_by_size(
     const std::vector<size_t>& bucket_size,
     const std::vector<bool>& expect_sparse_gradient = {},
     const std::vector<int64_t>& tensor_indices = {},
-    const c10::optional<std::weak_ptr<c10d::Logger>>& logger = {});
+    const c10::optional<std::weak_ptr<c10d::Logger>>& logger = {},
+    // When nonzero, tensors smaller than this many bytes are coalesced into
+    // one dedicated bucket per (dtype, device) with no size limit, so models
+    // with thousands of tiny parameters flatten them into a single fused
+    // buffer that is allreduced once per iteration.
+    size_t small_tensor_fusion_bytes = 0);
 
 // Verify models across all processes are the same as model on rank 0 with
 // respect to no. of params and matching dtype/size/layout.
@@ -264,6 +264,11 @@ C10_REGISTER_CREATOR(TensorPipeChannelRegistry, cma, makeCmaChannel);
 
 constexpr static int kNumUvThreads = 16;
 
+// Outbound messages without tensors and with payloads smaller than this are
+// eligible for coalescing into batched pipe writes (see
+// TensorPipeAgent::pipeWrite).
+constexpr static size_t kCoalesceMaxPayloadBytes = 4096;
+
 std::unique_ptr<ChannelRegistration> makeMultiplexedUvChannel() {
   std::vector<std::shared_ptr<tensorpipe::transport::Context>> contexts;
   std::vector<std::shared_ptr<tensorpipe::transport::Listener>> listeners;
@@ -552,13 +557,13 @@ void TensorPipeAgent::pipeRead(
     const std::shared_ptr<tensorpipe::Pipe>& pipe,
     std::function<void(
         const tensorpipe::Error&,
-        c10::intrusive_ptr<Message>,
+        std::vector<c10::intrusive_ptr<Message>>,
         std::vector<c10::Stream>)> fn) noexcept {
   pipe->readDescriptor([this, fn{std::move(fn)}, pipe](
                            const tensorpipe::Error& error,
                            tensorpipe::Descriptor tpDescriptor) mutable {
     if (error) {
-      fn(error, c10::intrusive_ptr<Message>(), {});
+      fn(error, {}, {});
       return;
     }
 
@@ -567,6 +572,32 @@ void TensorPipeAgent::pipeRead(
       GroupMembershipLockGuard guard(groupMembershipMutex_, isStaticGroup_);
       streams = getStreamsFromPoolForDevices(devices_);
     }
+
+    if (tpDescriptor.metadata == kTpMessageBatchMetadata) {
+      // Several tensor-free messages coalesced into one pipe write (see
+      // pipeWrite): allocate their buffers and demux after the read.
+      tensorpipe::Allocation tpAllocation;
+      std::vector<TensorpipeReadBuffers> tpBuffers;
+      std::tie(tpAllocation, tpBuffers) = tensorpipeAllocateBatch(tpDescriptor);
+
+      pipe->read(
+          std::move(tpAllocation),
+          [tpBuffers{std::make_shared<std::vector<TensorpipeReadBuffers>>(
+               std::move(tpBuffers))},
+           fn{std::move(fn)},
+           streams{std::move(streams)}](const tensorpipe::Error& error) mutable {
+            if (error) {
+              fn(error, {}, {});
+              return;
+            }
+
+            fn(error,
+               tensorpipeDeserializeBatch(std::move(*tpBuffers)),
+               std::move(streams));
+          });
+      return;
+    }
+
     tensorpipe::Allocation tpAllocation;
     TensorpipeReadBuffers tpBuffers;
     std::tie(tpAllocation, tpBuffers) =
@@ -580,7 +611,7 @@ void TensorPipeAgent::pipeRead(
          fn{std::move(fn)},
          streams{std::move(streams)}](const tensorpipe::Error& error) mutable {
           if (error) {
-            fn(error, c10::intrusive_ptr<Message>(), {});
+            fn(error, {}, {});
             return;
           }
 
@@ -589,7 +620,9 @@ void TensorPipeAgent::pipeRead(
           c10::intrusive_ptr<Message> rpcMessage = tensorpipeDeserialize(
               std::move(tpDescriptor), std::move(*tpBuffers));
 
-          fn(error, std::move(rpcMessage), std::move(streams));
+          std::vector<c10::intrusive_ptr<Message>> rpcMessages;
+          rpcMessages.push_back(std::move(rpcMessage));
+          fn(error, std::move(rpcMessages), std::move(streams));
         });
   });
 }
@@ -600,6 +633,16 @@ void TensorPipeAgent::pipeWrite(
     std::vector<c10::Device>&& devices,
     std::vector<c10::Stream> streams,
     std::function<void(const tensorpipe::Error&)> fn) noexcept {
+  // Small tensor-free messages (which dominate parameter-server control
+  // traffic) take the coalescing path; anything carrying tensors needs its
+  // own pipe write so it can go through the channels with the streams the
+  // caller set up.
+  if (rpcMessage->tensors().empty() && devices.empty() &&
+      rpcMessage->payload().size() < kCoalesceMaxPayloadBytes) {
+    pipeWriteCoalesced(pipe, std::move(rpcMessage), std::move(fn));
+    return;
+  }
+
   tensorpipe::Message tpMessage;
   TensorpipeWriteBuffers tpBuffers;
 
@@ -616,6 +659,96 @@ void TensorPipeAgent::pipeWrite(
       });
 }
 
+std::shared_ptr<TensorPipeAgent::OutboundCoalescer> TensorPipeAgent::
+    getCoalescer(const std::shared_ptr<tensorpipe::Pipe>& pipe) {
+  std::lock_guard<std::mutex> lock(coalescersMutex_);
+  auto& coalescer = coalescers_[pipe.get()];
+  if (coalescer == nullptr) {
+    coalescer = std::make_shared<OutboundCoalescer>();
+  }
+  return coalescer;
+}
+
+void TensorPipeAgent::dropCoalescer(tensorpipe::Pipe* pipe) {
+  std::lock_guard<std::mutex> lock(coalescersMutex_);
+  coalescers_.erase(pipe);
+}
+
+void TensorPipeAgent::pipeWriteCoalesced(
+    const std::shared_ptr<tensorpipe::Pipe>& pipe,
+    c10::intrusive_ptr<Message> rpcMessage,
+    std::function<void(const tensorpipe::Error&)> fn) noexcept {
+  auto coalescer = getCoalescer(pipe);
+  {
+    std::lock_guard<std::mutex> lock(coalescer->mutex_);
+    if (coalescer->writeInFlight_) {
+      // Ride along with the flush that happens when the in-flight write
+      // completes.
+      coalescer->pendingMessages_.push_back(std::move(rpcMessage));
+      coalescer->pendingFns_.push_back(std::move(fn));
+      return;
+    }
+    coalescer->writeInFlight_ = true;
+  }
+
+  std::vector<c10::intrusive_ptr<Message>> messages;
+  messages.push_back(std::move(rpcMessage));
+  std::vector<std::function<void(const tensorpipe::Error&)>> fns;
+  fns.push_back(std::move(fn));
+  writeCoalescedBatch(pipe, std::move(coalescer), std::move(messages), std::move(fns));
+}
+
+void TensorPipeAgent::writeCoalescedBatch(
+    const std::shared_ptr<tensorpipe::Pipe>& pipe,
+    std::shared_ptr<OutboundCoalescer> coalescer,
+    std::vector<c10::intrusive_ptr<Message>> messages,
+    std::vector<std::function<void(const tensorpipe::Error&)>> fns) noexcept {
+  tensorpipe::Message tpMessage;
+  std::vector<TensorpipeWriteBuffers> tpBuffers;
+
+  std::tie(tpMessage, tpBuffers) = tensorpipeSerializeBatch(std::move(messages));
+
+  pipe->write(
+      std::move(tpMessage),
+      [this,
+       pipe,
+       coalescer{std::move(coalescer)},
+       tpBuffers{std::make_shared<std::vector<TensorpipeWriteBuffers>>(
+           std::move(tpBuffers))},
+       fns{std::move(fns)}](const tensorpipe::Error& error) mutable {
+        for (auto& fn : fns) {
+          fn(error);
+        }
+
+        std::vector<c10::intrusive_ptr<Message>> nextMessages;
+        std::vector<std::function<void(const tensorpipe::Error&)>> nextFns;
+        {
+          std::lock_guard<std::mutex> lock(coalescer->mutex_);
+          if (error || coalescer->pendingMessages_.empty()) {
+            coalescer->writeInFlight_ = false;
+          }
+          nextMessages.swap(coalescer->pendingMessages_);
+          nextFns.swap(coalescer->pendingFns_);
+        }
+
+        if (error) {
+          // The pipe is broken, so fail whatever was waiting for the flush.
+          for (auto& fn : nextFns) {
+            fn(error);
+          }
+          return;
+        }
+
+        if (!nextMessages.empty()) {
+          writeCoalescedBatch(
+              pipe,
+              std::move(coalescer),
+              std::move(nextMessages),
+              std::move(nextFns));
+        }
+      });
+}
+
 void TensorPipeAgent::sendCompletedResponseMessage(
     std::shared_ptr<tensorpipe::Pipe>& pipe,
     JitFuture& futureResponseMessage,
@@ -717,7 +850,7 @@ void TensorPipeAgent::respond(std::shared_ptr<tensorpipe::Pipe>& pipe) {
       pipe,
       [this, pipe](
           const tensorpipe::Error& error,
-          c10::intrusive_ptr<Message> requestMessage,
+          std::vector<c10::intrusive_ptr<Message>> requestMessages,
           std::vector<c10::Stream> streams) mutable {
         if (error) {
           if (shuttingDown_) {
@@ -728,63 +861,149 @@ void TensorPipeAgent::respond(std::shared_ptr<tensorpipe::Pipe>& pipe) {
                 << " encountered error when reading incoming request from "
                 << pipe->getRemoteName() << ": " << error.what();
           }
+          // Not re-arming the read loop drops the last reference to this
+          // pipe, so retire its coalescing state before the address can be
+          // recycled by a later accept.
+          dropCoalescer(pipe.get());
           return;
         }
 
         // Arm for next read
         respond(pipe);
 
-        uint64_t messageId = requestMessage->id();
-        increaseCallCount(serverActiveCalls_);
-
-        VLOG(1) << "RPC agent for " << workerInfo_.name_
-                << " received request #" << messageId << " from "
-                << pipe->getRemoteName();
+        // A single pipe read may carry several coalesced requests; process
+        // each of them as if it had arrived on its own.
+        for (auto& requestMessage : requestMessages) {
+          uint64_t messageId = requestMessage->id();
+          increaseCallCount(serverActiveCalls_);
 
-        // Defer user RPC UDF run to thread pool
-        threadPool_.run([this,
-                         pipe,
-                         messageId,
-                         requestMessage{std::move(requestMessage)},
-                         streams{std::move(streams)}]() mutable {
           VLOG(1) << "RPC agent for " << workerInfo_.name_
-                  << " is running request #" << messageId << " from "
-                  << pipe->getRemoteName() << " in thread pool";
-
-          c10::intrusive_ptr<JitFuture> futureResponseMessage;
-          try {
-            // Instead of creating a MultiStreamGuard here, the ctx is passed
-            // to the callback and the MultiStreamGuard is created there,
-            // because subsequent processing can switch threads due to 1)
-            // waiting for RRef arguments to become ready 2) async_execution.
-            // Besides, the `ctx` also needs to be propagated to
-            // `process***Call` methods to synchronize CUDA streams there
-            // to make sure that we fetch the correct value from `to_here()`
-            // call.
-            futureResponseMessage =
-                cb_->operator()(*requestMessage, std::move(streams));
-          } catch (const std::exception& /* unused */) {
-            futureResponseMessage =
-                c10::make_intrusive<JitFuture>(at::AnyClassType::get());
-            futureResponseMessage->setError(std::current_exception());
+                  << " received request #" << messageId << " from "
+                  << pipe->getRemoteName();
+
+          // Defer user RPC UDF run to thread pool
+          threadPool_.run([this,
+                           pipe,
+                           messageId,
+                           requestMessage{std::move(requestMessage)},
+                           streams]() mutable {
+            VLOG(1) << "RPC agent for " << workerInfo_.name_
+                    << " is running request #" << messageId << " from "
+                    << pipe->getRemoteName() << " in thread pool";
+
+            c10::intrusive_ptr<JitFuture> futureResponseMessage;
+            try {
+              // Instead of creating a MultiStreamGuard here, the ctx is passed
+              // to the callback and the MultiStreamGuard is created there,
+              // because subsequent processing can switch threads due to 1)
+              // waiting for RRef arguments to become ready 2) async_execution.
+              // Besides, the `ctx` also needs to be propagated to
+              // `process***Call` methods to synchronize CUDA streams there
+              // to make sure that we fetch the correct value from `to_here()`
+              // call.
+              futureResponseMessage =
+                  cb_->operator()(*requestMessage, std::move(streams));
+            } catch (const std::exception& /* unused */) {
+              futureResponseMessage =
+                  c10::make_intrusive<JitFuture>(at::AnyClassType::get());
+              futureResponseMessage->setError(std::current_exception());
+            }
+
+            increaseCallCount(serverActiveAsyncCalls_);
+            futureResponseMessage->addCallback(
+                [this, pipe, messageId](
+                    JitFuture& futureResponseMessage) mutable {
+                  decreaseCallCount(serverActiveCalls_);
+                  decreaseCallCount(serverActiveAsyncCalls_);
+                  auto streams = getCurrentStreamsForDevices(
+                      futureResponseMessage.devices());
+                  sendCompletedResponseMessage(
+                      pipe, futureResponseMessage, messageId, std::move(streams));
+                });
+
+            VLOG(1) << "RPC agent for " << workerInfo_.name_
+                    << " done running request #" << messageId << " from "
+                    << pipe->getRemoteName() << " in thread pool";
+          });
+        }
+      });
+}
+
+void TensorPipeAgent::armClientRead(ClientPipe& clientPipe) {
+  pipeRead(
+      clientPipe.pipe_,
+      [this, &clientPipe](
+          const tensorpipe::Error& error,
+          std::vector<c10::intrusive_ptr<Message>> responseMessages,
+          std::vector<c10::Stream> streams) {
+        if (error) {
+          if (error.isOfType<tensorpipe::PipeClosedError>() &&
+              !rpcAgentRunning_.load()) {
+            // This is expected.
+          } else {
+            // With no responses outstanding this is just the remote end
+            // going away, which doesn't deserve a warning.
+            bool hasPendingMessages;
+            {
+              std::lock_guard<std::mutex> lock(clientPipe.mutex_);
+              hasPendingMessages = !clientPipe.pendingResponseMessage_.empty();
+            }
+            if (hasPendingMessages) {
+              LOG(WARNING)
+                  << "RPC agent for " << workerInfo_.name_
+                  << " encountered error when reading incoming response from "
+                  << clientPipe.pipe_->getRemoteName() << ": " << error.what();
+            }
           }
+          handleClientError(clientPipe, error);
+          return;
+        }
 
-          increaseCallCount(serverActiveAsyncCalls_);
-          futureResponseMessage->addCallback(
-              [this, pipe, messageId](
-                  JitFuture& futureResponseMessage) mutable {
-                decreaseCallCount(serverActiveCalls_);
-                decreaseCallCount(serverActiveAsyncCalls_);
-                auto streams = getCurrentStreamsForDevices(
-                    futureResponseMessage.devices());
-                sendCompletedResponseMessage(
-                    pipe, futureResponseMessage, messageId, std::move(streams));
-              });
+        // Arm for the next response on this pipe.
+        armClientRead(clientPipe);
+
+        // A single pipe read may carry several coalesced responses, each of
+        // which identifies its future by message ID.
+        for (auto& responseMessage : responseMessages) {
+          uint64_t messageId = responseMessage->id();
 
           VLOG(1) << "RPC agent for " << workerInfo_.name_
-                  << " done running request #" << messageId << " from "
-                  << pipe->getRemoteName() << " in thread pool";
-        });
+                  << " received response #" << messageId << " from "
+                  << clientPipe.pipe_->getRemoteName();
+
+          std::shared_ptr<AtomicJitFuture> futureResponseMessage;
+          {
+            std::lock_guard<std::mutex> lock(clientPipe.mutex_);
+            // A read error will lead all following callbacks to be
+            // invoked with error, and shouldn't reach here.
+            TORCH_INTERNAL_ASSERT(
+                !clientPipe.inError_, "Shouldn't be in error state");
+            auto it = clientPipe.pendingResponseMessage_.find(messageId);
+            TORCH_INTERNAL_ASSERT(
+                it != clientPipe.pendingResponseMessage_.end(),
+                "message ID ",
+                messageId,
+                " is not recognized");
+            futureResponseMessage = std::move(it->second);
+            clientPipe.pendingResponseMessage_.erase(it);
+          }
+
+          // Remove entry from timeoutMap_.
+          removeFromTimeoutMap(messageId);
+
+          if (responseMessage->type() == MessageType::EXCEPTION) {
+            markFutureWithError(
+                std::move(futureResponseMessage),
+                std::string(
+                    responseMessage->payload().begin(),
+                    responseMessage->payload().end()));
+          } else {
+            markFutureAsComplete(
+                std::move(futureResponseMessage),
+                std::move(responseMessage),
+                streams);
+          }
+        }
       });
 }
 
@@ -824,6 +1043,9 @@ c10::intrusive_ptr<JitFuture> TensorPipeAgent::send(
           std::forward_as_tuple(toWorkerInfo.id_),
           std::forward_as_tuple(context_->connect(
               url, tensorpipe::PipeOptions().remoteName(toWorkerInfo.name_))));
+      // All responses on this pipe arrive through a single read loop, since
+      // the server may coalesce several of them into one pipe message.
+      armClientRead(it->second);
     }
   }
   ClientPipe& clientPipe = it->second;
@@ -925,68 +1147,6 @@ c10::intrusive_ptr<JitFuture> TensorPipeAgent::send(
 
         VLOG(1) << "RPC agent for " << workerInfo_.name_ << " sent request #"
                 << messageId << " to " << clientPipe.pipe_->getRemoteName();
-
-        pipeRead(
-            clientPipe.pipe_,
-            [this, &clientPipe](
-                const tensorpipe::Error& error,
-                c10::intrusive_ptr<Message> responseMessage,
-                std::vector<c10::Stream> streams) {
-              if (error) {
-                if (error.isOfType<tensorpipe::PipeClosedError>() &&
-                    !rpcAgentRunning_.load()) {
-                  // This is expected.
-                } else {
-                  LOG(WARNING)
-                      << "RPC agent for " << workerInfo_.name_
-                      << " encountered error when reading incoming response from "
-                      << clientPipe.pipe_->getRemoteName() << ": "
-                      << error.what();
-                }
-                handleClientError(clientPipe, error);
-                return;
-              }
-
-              // Identify future response message by message ID
-              uint64_t messageId = responseMessage->id();
-
-              VLOG(1) << "RPC agent for " << workerInfo_.name_
-                      << " received response #" << messageId << " from "
-                      << clientPipe.pipe_->getRemoteName();
-
-              std::shared_ptr<AtomicJitFuture> futureResponseMessage;
-              {
-                std::lock_guard<std::mutex> lock(clientPipe.mutex_);
-                // A read error will lead all following callbacks to be
-                // invoked with error, and shouldn't reach here.
-                TORCH_INTERNAL_ASSERT(
-                    !clientPipe.inError_, "Shouldn't be in error state");
-                auto it = clientPipe.pendingResponseMessage_.find(messageId);
-                TORCH_INTERNAL_ASSERT(
-                    it != clientPipe.pendingResponseMessage_.end(),
-                    "message ID ",
-                    messageId,
-                    " is not recognized");
-                futureResponseMessage = std::move(it->second);
-                clientPipe.pendingResponseMessage_.erase(it);
-              }
-
-              // Remove entry from timeoutMap_.
-              removeFromTimeoutMap(messageId);
-
-              if (responseMessage->type() == MessageType::EXCEPTION) {
-                markFutureWithError(
-                    std::move(futureResponseMessage),
-                    std::string(
-                        responseMessage->payload().begin(),
-                        responseMessage->payload().end()));
-              } else {
-                markFutureAsComplete(
-                    std::move(futureResponseMessage),
-                    std::move(responseMessage),
-                    std::move(streams));
-              }
-            });
       });
 
   return futureResponseMessage->jitFuture;
@@ -1011,6 +1171,11 @@ void TensorPipeAgent::handleClientError(
     // Remove entry from timeoutMap_.
     removeFromTimeoutMap(p.first);
   }
+
+  // All in-flight and queued writes on this pipe are aborted with the error,
+  // so its coalescing state is dead; drop it rather than let a pipe later
+  // allocated at the same address inherit it.
+  dropCoalescer(clientPipe.pipe_.get());
 }
 
 void TensorPipeAgent::pollTimeoutRpcs() {
@@ -2,6 +2,11 @@
 
 #ifdef USE_TENSORPIPE
 
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+
 #include <c10/util/irange.h>
 
 #include <tensorpipe/tensorpipe.h>
@@ -24,6 +29,11 @@ constexpr int kTpMessagePayloadIdx = 2;
 // Last comes the pickle of rpc::Message::tensors() (with the tensors themselves
 // stored as, well, tensors in the tensorpipe::Message).
 constexpr int kTpMessagePickleIdx = 3;
+// Every message thus carries this many payloads...
+constexpr size_t kTpMessageNumPayloads = 4;
+// ...except that small CPU tensors may ride along inline as additional
+// payloads, starting at this index (see tensorpipeSerialize).
+constexpr size_t kTpMessageInlineTensorsIdx = 4;
 
 inline c10::Device indexToDevice(c10::DeviceIndex index) {
   if (index == -1) {
@@ -33,9 +43,64 @@ inline c10::Device indexToDevice(c10::DeviceIndex index) {
   }
 }
 
+// Staging buffers for storages that must be copied before sending (see
+// TensorpipeCpuConverter below). The cache is keyed on the storage's data
+// pointer and size, so that repeated sends of the same storage (e.g. the same
+// parameter tensor in a parameter-server loop) reuse the same staging buffer.
+// Besides skipping the allocation, this keeps the buffer's address stable
+// across sends, which lets channels that register memory with the NIC (e.g.
+// the ibv-based ones) hit their registration caches instead of pinning and
+// registering fresh pages on every send. The data itself is re-copied on each
+// send, so a stale entry (the blob was freed and its address reused) is
+// harmless.
+class CpuStagingBufferCache {
+ public:
+  std::shared_ptr<std::vector<char>> acquire(const void* ptr, size_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Key key(ptr, nbytes);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+      // A buffer still referenced by an in-flight write must not be
+      // overwritten with new data, so hand out (and cache) a fresh one.
+      if (it->second.buffer.use_count() == 1) {
+        return it->second.buffer;
+      }
+      it->second.buffer = std::make_shared<std::vector<char>>(nbytes);
+      return it->second.buffer;
+    }
+    while (entries_.size() >= kMaxEntries) {
+      entries_.erase(lru_.back());
+      lru_.pop_back();
+    }
+    lru_.push_front(key);
+    auto buffer = std::make_shared<std::vector<char>>(nbytes);
+    entries_.emplace(key, Entry{buffer, lru_.begin()});
+    return buffer;
+  }
+
+  static CpuStagingBufferCache& get() {
+    static CpuStagingBufferCache cache;
+    return cache;
+  }
+
+ private:
+  using Key = std::pair<const void*, size_t>;
+  struct Entry {
+    std::shared_ptr<std::vector<char>> buffer;
+    std::list<Key>::iterator lruIt;
+  };
+
+  static constexpr size_t kMaxEntries = 16;
+
+  std::mutex mutex_;
+  std::map<Key, Entry> entries_;
+  std::list<Key> lru_;
+};
+
 class TensorpipeCpuConverter : public TensorpipeDeviceTypeConverter {
  public:
-  c10::optional<std::vector<char>> prepareTensorForSending(
+  std::shared_ptr<std::vector<char>> prepareTensorForSending(
       const c10::Storage& storage,
       const std::vector<c10::Stream>& /* streams */,
       tensorpipe::Message& message) const override {
@@ -43,19 +108,20 @@ class TensorpipeCpuConverter : public TensorpipeDeviceTypeConverter {
     // that the tensor doesn't own the memory.
     bool storageHasDeleter = storage.data_ptr().get_context() != nullptr;
     if (!storageHasDeleter) {
-      std::vector<char> storageData(
-          storage.data<char>(), storage.data<char>() + storage.nbytes());
+      auto storageData = CpuStagingBufferCache::get().acquire(
+          storage.data(), storage.nbytes());
+      std::memcpy(storageData->data(), storage.data<char>(), storage.nbytes());
 
       tensorpipe::CpuBuffer buffer;
-      buffer.ptr = storageData.data();
+      buffer.ptr = storageData->data();
 
       tensorpipe::Message::Tensor tensor;
       tensor.buffer = buffer;
-      tensor.length = storageData.size();
+      tensor.length = storageData->size();
 
       message.tensors.push_back(std::move(tensor));
 
-      return c10::make_optional(std::move(storageData));
+      return storageData;
     } else {
       tensorpipe::CpuBuffer buffer;
       buffer.ptr = storage.data<char>();
@@ -66,7 +132,7 @@ class TensorpipeCpuConverter : public TensorpipeDeviceTypeConverter {
 
       message.tensors.push_back(std::move(tensor));
 
-      return c10::nullopt;
+      return nullptr;
     }
   }
 
@@ -177,6 +243,43 @@ std::tuple<tensorpipe::Message, TensorpipeWriteBuffers> tensorpipeSerialize(
   tpMessage.payloads.push_back(tensorpipe::Message::Payload{
       buffers.pickle.data(), buffers.pickle.size()});
   const std::vector<torch::Tensor>& tensorDataVec = pickler.tensorData();
+
+  // Small CPU tensors staying on CPU ride along as extra payloads, skipping
+  // the per-tensor channel negotiation whose latency dominates small control
+  // messages. This is all-or-nothing so that the receiving side can map the
+  // extra payloads back to tensors purely by position.
+  bool inlineTensors = !tensorDataVec.empty();
+  for (const auto i : c10::irange(tensorDataVec.size())) {
+    if (!tensorDataVec[i].device().is_cpu() ||
+        tensorDataVec[i].storage().nbytes() >= kTpMessageInlineTensorMaxBytes ||
+        (!devices.empty() && !devices[i].is_cpu())) {
+      inlineTensors = false;
+      break;
+    }
+  }
+  if (inlineTensors) {
+    for (const torch::Tensor& tensor : tensorDataVec) {
+      const c10::Storage& storage = tensor.storage();
+      // As in TensorpipeCpuConverter, data the storage doesn't own must be
+      // staged, since the payload is only read once the asynchronous write
+      // is processed.
+      bool storageHasDeleter = storage.data_ptr().get_context() != nullptr;
+      if (!storageHasDeleter) {
+        auto storageData = CpuStagingBufferCache::get().acquire(
+            storage.data(), storage.nbytes());
+        std::memcpy(
+            storageData->data(), storage.data<char>(), storage.nbytes());
+        tpMessage.payloads.push_back(tensorpipe::Message::Payload{
+            storageData->data(), storageData->size()});
+        buffers.copiedTensors.push_back(std::move(storageData));
+      } else {
+        tpMessage.payloads.push_back(tensorpipe::Message::Payload{
+            storage.data<char>(), storage.nbytes()});
+      }
+    }
+    return std::make_tuple(std::move(tpMessage), std::move(buffers));
+  }
+
   tpMessage.tensors.reserve(tensorDataVec.size());
   for (const auto i : c10::irange(tensorDataVec.size())) {
     const torch::Tensor& tensor = tensorDataVec[i];
@@ -189,7 +292,7 @@ std::tuple<tensorpipe::Message, TensorpipeWriteBuffers> tensorpipeSerialize(
         tensor.device());
 
     TORCH_INTERNAL_ASSERT(tpMessage.tensors.size() == i);
-    c10::optional<std::vector<char>> maybeCopiedTensor =
+    std::shared_ptr<std::vector<char>> maybeCopiedTensor =
         converter->prepareTensorForSending(
             tensor.storage(), streams, tpMessage);
     TORCH_INTERNAL_ASSERT(tpMessage.tensors.size() == i + 1);
@@ -199,8 +302,8 @@ std::tuple<tensorpipe::Message, TensorpipeWriteBuffers> tensorpipeSerialize(
         : tensorpipe::Device{tensorpipe::kCudaDeviceType, devices[i].index()};
     tpMessage.tensors.back().targetDevice = std::move(targetDevice);
 
-    if (maybeCopiedTensor.has_value()) {
-      buffers.copiedTensors.push_back(std::move(maybeCopiedTensor).value());
+    if (maybeCopiedTensor != nullptr) {
+      buffers.copiedTensors.push_back(std::move(maybeCopiedTensor));
     }
   }
 
@@ -214,8 +317,10 @@ std::pair<tensorpipe::Allocation, TensorpipeReadBuffers> tensorpipeAllocate(
   TensorpipeReadBuffers buffers;
 
   TORCH_INTERNAL_ASSERT(
-      tpDescriptor.payloads.size() == 4,
-      "message expected to contain 4 payloads, whereas it contained ",
+      tpDescriptor.payloads.size() >= kTpMessageNumPayloads,
+      "message expected to contain at least ",
+      kTpMessageNumPayloads,
+      " payloads, whereas it contained ",
       tpDescriptor.payloads.size(),
       " payloads");
   tpAllocation.payloads.resize(tpDescriptor.payloads.size());
@@ -247,6 +352,24 @@ std::pair<tensorpipe::Allocation, TensorpipeReadBuffers> tensorpipeAllocate(
   buffers.pickle.resize(tpDescriptor.payloads[kTpMessagePickleIdx].length);
   tpAllocation.payloads[kTpMessagePickleIdx].data = buffers.pickle.data();
 
+  // Payloads beyond the standard four are inline tensors (see
+  // tensorpipeSerialize); when present, the message carries no channel
+  // tensors at all, so the buffers line up with the pickled tensor indices.
+  if (tpDescriptor.payloads.size() > kTpMessageNumPayloads) {
+    TORCH_INTERNAL_ASSERT(
+        tpDescriptor.tensors.empty(),
+        "message with inline tensors not expected to also contain channel "
+        "tensors");
+    for (size_t payloadIdx = kTpMessageInlineTensorsIdx;
+         payloadIdx < tpDescriptor.payloads.size();
+         payloadIdx++) {
+      at::DataPtr dataPtr = at::getCPUAllocator()->allocate(
+          tpDescriptor.payloads[payloadIdx].length);
+      tpAllocation.payloads[payloadIdx].data = dataPtr.get();
+      buffers.tensors.push_back(std::move(dataPtr));
+    }
+  }
+
   size_t numTensors = tpDescriptor.tensors.size();
   tpAllocation.tensors.reserve(numTensors);
   for (const auto tensorIdx : c10::irange(numTensors)) {
@@ -334,6 +457,108 @@ c10::intrusive_ptr<Message> tensorpipeDeserialize(
       *buffers.type,
       *buffers.id);
 }
+
+std::tuple<tensorpipe::Message, std::vector<TensorpipeWriteBuffers>>
+tensorpipeSerializeBatch(std::vector<c10::intrusive_ptr<Message>> rpcMessages) {
+  tensorpipe::Message tpMessage;
+  tpMessage.metadata = kTpMessageBatchMetadata;
+  std::vector<TensorpipeWriteBuffers> buffersVec;
+  buffersVec.reserve(rpcMessages.size());
+
+  for (auto& rpcMessage : rpcMessages) {
+    TORCH_INTERNAL_ASSERT(
+        rpcMessage->tensors().empty(),
+        "only tensor-free messages can be coalesced into a batch");
+    tensorpipe::Message tpSubMessage;
+    TensorpipeWriteBuffers buffers;
+    std::tie(tpSubMessage, buffers) =
+        tensorpipeSerialize(std::move(rpcMessage), {}, {});
+    for (auto& payload : tpSubMessage.payloads) {
+      tpMessage.payloads.push_back(std::move(payload));
+    }
+    buffersVec.push_back(std::move(buffers));
+  }
+
+  return std::make_tuple(std::move(tpMessage), std::move(buffersVec));
+}
+
+std::pair<tensorpipe::Allocation, std::vector<TensorpipeReadBuffers>>
+tensorpipeAllocateBatch(const tensorpipe::Descriptor& tpDescriptor) {
+  tensorpipe::Allocation tpAllocation;
+  std::vector<TensorpipeReadBuffers> buffersVec;
+
+  TORCH_INTERNAL_ASSERT(
+      tpDescriptor.tensors.empty(),
+      "batched message not expected to contain tensors");
+  TORCH_INTERNAL_ASSERT(
+      !tpDescriptor.payloads.empty() &&
+          tpDescriptor.payloads.size() % kTpMessageNumPayloads == 0,
+      "batched message expected to contain a multiple of ",
+      kTpMessageNumPayloads,
+      " payloads, whereas it contained ",
+      tpDescriptor.payloads.size(),
+      " payloads");
+  tpAllocation.payloads.resize(tpDescriptor.payloads.size());
+
+  const size_t numMessages = tpDescriptor.payloads.size() / kTpMessageNumPayloads;
+  buffersVec.reserve(numMessages);
+  for (const auto msgIdx : c10::irange(numMessages)) {
+    const size_t base = msgIdx * kTpMessageNumPayloads;
+    TensorpipeReadBuffers buffers;
+
+    TORCH_INTERNAL_ASSERT(
+        tpDescriptor.payloads[base + kTpMessageTypeIdx].length ==
+            sizeof(MessageType),
+        "type payload of message ",
+        msgIdx,
+        " expected to contain ",
+        sizeof(MessageType),
+        " bytes, whereas it contained ",
+        tpDescriptor.payloads[base + kTpMessageTypeIdx].length,
+        " bytes");
+    buffers.type = std::make_unique<MessageType>();
+    tpAllocation.payloads[base + kTpMessageTypeIdx].data = buffers.type.get();
+
+    TORCH_INTERNAL_ASSERT(
+        tpDescriptor.payloads[base + kTpMessageIdIdx].length == sizeof(int64_t),
+        "id payload of message ",
+        msgIdx,
+        " expected to contain ",
+        sizeof(int64_t),
+        " bytes, whereas it contained ",
+        tpDescriptor.payloads[base + kTpMessageIdIdx].length,
+        " bytes");
+    buffers.id = std::make_unique<int64_t>();
+    tpAllocation.payloads[base + kTpMessageIdIdx].data = buffers.id.get();
+
+    buffers.payload.resize(
+        tpDescriptor.payloads[base + kTpMessagePayloadIdx].length);
+    tpAllocation.payloads[base + kTpMessagePayloadIdx].data =
+        buffers.payload.data();
+
+    buffers.pickle.resize(
+        tpDescriptor.payloads[base + kTpMessagePickleIdx].length);
+    tpAllocation.payloads[base + kTpMessagePickleIdx].data =
+        buffers.pickle.data();
+
+    buffersVec.push_back(std::move(buffers));
+  }
+
+  return {std::move(tpAllocation), std::move(buffersVec)};
+}
+
+std::vector<c10::intrusive_ptr<Message>> tensorpipeDeserializeBatch(
+    std::vector<TensorpipeReadBuffers>&& holders) {
+  std::vector<c10::intrusive_ptr<Message>> rpcMessages;
+  rpcMessages.reserve(holders.size());
+  for (auto& buffers : holders) {
+    // Batched messages carry no tensors, so the descriptor contents don't
+    // matter for deserialization and an empty one will do.
+    rpcMessages.push_back(
+        tensorpipeDeserialize(tensorpipe::Descriptor{}, std::move(buffers)));
+  }
+  return rpcMessages;
+}
 } // namespace rpc
 } // namespace distributed
 } // namespace torch
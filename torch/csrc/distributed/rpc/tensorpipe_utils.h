@@ -27,7 +27,9 @@ class TensorpipeDeviceTypeConverter {
   // cannot include the TensorPipe headers because it's a private dependency.
   // Thus we bend over backwards and entrust this method with appending that
   // object to the `tensors` field of the tensorpipe::Message object we pass.
-  virtual c10::optional<std::vector<char>> prepareTensorForSending(
+  // Returns a staging buffer holding a copy of the storage's data if one had
+  // to be made (see TensorpipeWriteBuffers::copiedTensors), else nullptr.
+  virtual std::shared_ptr<std::vector<char>> prepareTensorForSending(
       const c10::Storage& storage,
       const std::vector<c10::Stream>& streams,
       tensorpipe::Message& message) const = 0;
@@ -78,7 +80,13 @@ struct TensorpipeWriteBuffers {
   std::vector<torch::Tensor> tensors;
   // This contains the copies of the data of the tensors that didn't own their
   // memory, e.g., the ones created from torch::from_blob() with no deleter.
-  std::vector<std::vector<char>> copiedTensors;
+  // The buffers come from a cache keyed on the source storage, so that
+  // repeated sends of the same storage reuse the same staging memory (and
+  // thus the same address, which lets channels that register memory with the
+  // NIC hit their registration caches instead of pinning fresh pages each
+  // time); they are shared_ptrs so the cache can tell when a buffer is still
+  // in use by an in-flight write.
+  std::vector<std::shared_ptr<std::vector<char>>> copiedTensors;
 };
 
 // A struct that holds pointers that keep alive all the memory that will be
@@ -92,6 +100,17 @@ struct TensorpipeReadBuffers {
   std::vector<c10::DataPtr> tensors;
 };
 
+// CPU tensors staying on CPU and smaller than this are serialized inline, as
+// extra message payloads, instead of going through a TensorPipe channel; this
+// skips the per-tensor channel negotiation, whose latency dominates the cost
+// of small control messages.
+constexpr size_t kTpMessageInlineTensorMaxBytes = 4096;
+
+// Top-level metadata marking a TensorPipe message that carries several
+// coalesced tensor-free RPC messages (four payloads each, in the usual
+// layout), written by the sending agent as a single pipe write.
+constexpr auto kTpMessageBatchMetadata = "rpc_batch";
+
 // Convert an RPC message into a TensorPipe message, plus a holder to all the
 // data that must be kept alive while the write is performed asynchronously.
 TORCH_API std::tuple<tensorpipe::Message, TensorpipeWriteBuffers>
@@ -100,6 +119,11 @@ tensorpipeSerialize(
     std::vector<c10::Device> devices,
     const std::vector<c10::Stream>& streams);
 
+// Pack several tensor-free RPC messages into a single TensorPipe message,
+// marked with kTpMessageBatchMetadata, so they can share one pipe write.
+TORCH_API std::tuple<tensorpipe::Message, std::vector<TensorpipeWriteBuffers>>
+tensorpipeSerializeBatch(std::vector<c10::intrusive_ptr<Message>> rpcMessages);
+
 // Allocate the buffers that will hold the incoming data. They will be managed
 // by the returned holder, which must be kept alive until the asynchronous read
 // has finished. Pointers to these buffers will be stored in the returned
@@ -116,6 +140,15 @@ TORCH_API c10::intrusive_ptr<Message> tensorpipeDeserialize(
     tensorpipe::Descriptor&& tpDescriptor,
     TensorpipeReadBuffers&& holder);
 
+// Counterparts of the two functions above for batched messages (recognized
+// by kTpMessageBatchMetadata on the descriptor): one holder per coalesced
+// message, demuxed back into individual RPC messages after the read.
+TORCH_API std::pair<tensorpipe::Allocation, std::vector<TensorpipeReadBuffers>>
+tensorpipeAllocateBatch(const tensorpipe::Descriptor& tpDescriptor);
+
+TORCH_API std::vector<c10::intrusive_ptr<Message>> tensorpipeDeserializeBatch(
+    std::vector<TensorpipeReadBuffers>&& holders);
+
 } // namespace rpc
 } // namespace distributed
 } // namespace torch
@@ -344,7 +344,7 @@ c10::List<at::Tensor> cloneSparseTensors(
   return pTensors;
 }
 
-std::string wireSerialize(
+WireSegments wireSerializeSegments(
     const std::vector<char>& payload,
     const std::vector<at::Tensor>& tensors) {
   for (const auto& tensor : tensors) {
@@ -363,7 +363,7 @@ std::string wireSerialize(
   };
   std::vector<Ent> entries;
   std::string metaEntry;
-  std::vector<at::Tensor> tensorData;
+  WireSegments out;
 
   if (!payload.empty()) {
     entries.push_back({kPayload, payload.data(), payload.size()});
@@ -377,17 +377,17 @@ std::string wireSerialize(
     pickler.protocol();
     pickler.pushIValue(cloneSparseTensors(tensors));
     pickler.stop();
-    tensorData = pickler.tensorData();
+    out.tensorData = pickler.tensorData();
     entries.push_back({kMeta, metaEntry.data(), metaEntry.size()});
-    for (const auto i : c10::irange(tensorData.size())) {
+    for (const auto i : c10::irange(out.tensorData.size())) {
       // Construct WritableTensorData for each tensor in the pickler tensorData
-      // Since tensorData is in function scope, and getWritableTensorData just
+      // Since out.tensorData pins the tensors, and getWritableTensorData just
       // record the tensors, the data() pointers stay valid for CPU tensors
       // Note that RPC serde doesn't support CUDA tensors yet, if we should
       // support CUDA tensor, we need to be careful since getWritableTensorData
       // converts CUDA tensor to cpu and data() might get destructed as we go
       // out of scope of this loop.
-      auto writeableTensorData = jit::getWriteableTensorData(tensorData[i]);
+      auto writeableTensorData = jit::getWriteableTensorData(out.tensorData[i]);
       entries.push_back(
           {c10::to_string(i),
            writeableTensorData.data(),
@@ -396,9 +396,7 @@ std::string wireSerialize(
   }
 
   std::string header;
-  size_t tot = 0;
   for (const auto& e : entries) {
-    tot += e.size;
     header.append(e.name)
         .append(" ")
         .append(c10::to_string(e.size))
@@ -406,11 +404,39 @@ std::string wireSerialize(
   }
   header.push_back('\n');
 
-  std::string out;
-  out.reserve(header.size() + tot);
-  out.append(header);
+  // The first segment gathers the header and the small inline sections; each
+  // tensor's bytes stay in its storage and go out as their own segment. The
+  // segments point into out's own buffers, which is fine across moves: both
+  // std::vector moves leave pointers to elements valid.
+  out.inlineSections.reserve(header.size() + payload.size() + metaEntry.size());
+  out.inlineSections.insert(
+      out.inlineSections.end(), header.begin(), header.end());
+  out.inlineSections.insert(
+      out.inlineSections.end(), payload.begin(), payload.end());
+  out.inlineSections.insert(
+      out.inlineSections.end(), metaEntry.begin(), metaEntry.end());
+  out.segments.emplace_back(
+      out.inlineSections.data(), out.inlineSections.size());
   for (const auto& e : entries) {
-    out.append(e.data, e.size);
+    if (e.name != kPayload && e.name != kMeta) {
+      out.segments.emplace_back(e.data, e.size);
+    }
+  }
+  return out;
+}
+
+std::string wireSerialize(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors) {
+  auto wire = wireSerializeSegments(payload, tensors);
+  size_t tot = 0;
+  for (const auto& segment : wire.segments) {
+    tot += segment.second;
+  }
+  std::string out;
+  out.reserve(tot);
+  for (const auto& segment : wire.segments) {
+    out.append(segment.first, segment.second);
   }
   return out;
 }
@@ -52,6 +52,30 @@ TORCH_API std::string wireSerialize(
     const std::vector<char>& payload,
     const std::vector<at::Tensor>& tensors);
 
+// A wire-format message split into scatter-gather segments. Concatenating the
+// segments in order yields exactly the buffer wireSerialize() produces, so the
+// receiving side can keep using wireDeserialize(). The buffers below own the
+// memory the segments alias and must outlive the send.
+struct TORCH_API WireSegments {
+  // iovec-style (pointer, size) views, in wire order, suitable for a vectored
+  // send (writev/sendmsg).
+  std::vector<std::pair<const char*, size_t>> segments;
+  // Header plus the inline sections (payload and pickle metadata), referenced
+  // by the first segment.
+  std::vector<char> inlineSections;
+  // Pins the tensor storages the remaining segments alias.
+  std::vector<at::Tensor> tensorData;
+};
+
+// Scatter-gather variant of wireSerialize(). Rather than gathering every
+// tensor's bytes into one contiguous buffer, the first segment holds the
+// header and the inline sections and each subsequent segment aliases a
+// tensor's storage in place, so a multi-tensor message is never memcpy'd
+// before it reaches the transport.
+TORCH_API WireSegments wireSerializeSegments(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors);
+
 TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
     const void* data,
     size_t data_size);
@@ -1,3 +1,4 @@
+#include <ATen/Parallel.h>
 #include <ATen/core/symbol.h>
 #include <ATen/record_function.h>
 #include <c10/util/Exception.h>
@@ -10,15 +11,19 @@
 #include <torch/csrc/jit/frontend/ir_emitter.h>
 #include <torch/csrc/jit/frontend/schema_matching.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/constant_pooling.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/freeze_module.h>
+#include <torch/csrc/jit/passes/fuse_relu.h>
 #include <torch/csrc/jit/passes/frozen_conv_add_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
-#include <torch/csrc/jit/passes/frozen_linear_transpose.h>
+#include <torch/csrc/jit/passes/frozen_linear_autotune.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
+#include <numeric>
+
 namespace torch {
 namespace jit {
 
@@ -264,6 +269,171 @@ IValue Module::operator()(std::vector<IValue> inputs) {
   return outputs;
 }
 
+namespace {
+
+// Concatenates per-request input stacks along dim 0 into a single stack, or
+// returns nullopt if the requests do not line up (non-tensor arguments,
+// mismatched arity, dtype, device or trailing shape). On success, `rows`
+// holds each request's leading-dimension size, for splitting outputs.
+c10::optional<std::vector<IValue>> concatRequestInputs(
+    const std::vector<std::vector<IValue>>& inputs,
+    std::vector<int64_t>& rows) {
+  const size_t arity = inputs[0].size();
+  if (arity == 0) {
+    return c10::nullopt;
+  }
+  rows.clear();
+  rows.reserve(inputs.size());
+  for (const auto& request : inputs) {
+    if (request.size() != arity) {
+      return c10::nullopt;
+    }
+    int64_t request_rows = -1;
+    for (const auto& input : request) {
+      if (!input.isTensor()) {
+        return c10::nullopt;
+      }
+      const auto& t = input.toTensor();
+      if (t.dim() == 0) {
+        return c10::nullopt;
+      }
+      if (request_rows == -1) {
+        request_rows = t.size(0);
+      } else if (t.size(0) != request_rows) {
+        return c10::nullopt;
+      }
+    }
+    rows.push_back(request_rows);
+  }
+  std::vector<IValue> batched;
+  batched.reserve(arity);
+  for (const auto arg : c10::irange(arity)) {
+    std::vector<at::Tensor> parts;
+    parts.reserve(inputs.size());
+    const auto& first = inputs[0][arg].toTensor();
+    for (const auto& request : inputs) {
+      const auto& t = request[arg].toTensor();
+      if (t.dtype() != first.dtype() || t.device() != first.device() ||
+          t.sizes().slice(1) != first.sizes().slice(1)) {
+        return c10::nullopt;
+      }
+      parts.push_back(t);
+    }
+    batched.emplace_back(at::cat(parts, 0));
+  }
+  return batched;
+}
+
+// Splits a batched output back into per-request outputs. Returns false if the
+// output shape does not follow the batch dimension (e.g. the model reduces
+// over dim 0), in which case concatenation was not semantics-preserving and
+// the caller must rerun per request.
+bool splitBatchedOutput(
+    const IValue& batched,
+    const std::vector<int64_t>& rows,
+    int64_t total_rows,
+    std::vector<IValue>& results) {
+  if (batched.isTensor()) {
+    const auto& t = batched.toTensor();
+    if (t.dim() == 0 || t.size(0) != total_rows) {
+      return false;
+    }
+    auto parts = t.split_with_sizes(rows, 0);
+    for (const auto i : c10::irange(results.size())) {
+      results[i] = parts[i];
+    }
+    return true;
+  }
+  if (batched.isTuple()) {
+    const auto& elements = batched.toTupleRef().elements();
+    std::vector<std::vector<IValue>> per_request(
+        results.size(), std::vector<IValue>());
+    for (const auto& element : elements) {
+      if (!element.isTensor()) {
+        return false;
+      }
+      const auto& t = element.toTensor();
+      if (t.dim() == 0 || t.size(0) != total_rows) {
+        return false;
+      }
+      auto parts = t.split_with_sizes(rows, 0);
+      for (const auto i : c10::irange(results.size())) {
+        per_request[i].emplace_back(parts[i]);
+      }
+    }
+    for (const auto i : c10::irange(results.size())) {
+      results[i] = c10::ivalue::Tuple::create(std::move(per_request[i]));
+    }
+    return true;
+  }
+  return false;
+}
+
+} // namespace
+
+std::vector<IValue> Module::forward_batch(
+    std::vector<std::vector<IValue>> inputs,
+    bool try_concat) {
+  std::vector<IValue> results(inputs.size());
+  if (inputs.empty()) {
+    return results;
+  }
+  auto method = get_method("forward");
+  if (try_concat && inputs.size() > 1) {
+    std::vector<int64_t> rows;
+    if (auto batched_inputs = concatRequestInputs(inputs, rows)) {
+      const int64_t total_rows =
+          std::accumulate(rows.begin(), rows.end(), static_cast<int64_t>(0));
+      IValue batched_output = method(std::move(*batched_inputs));
+      if (splitBatchedOutput(batched_output, rows, total_rows, results)) {
+        return results;
+      }
+      // The output did not follow the batch dimension; fall through to
+      // per-request execution.
+    }
+  }
+  if (inputs.size() == 1) {
+    results[0] = method(std::move(inputs[0]));
+    return results;
+  }
+  // Pipeline requests after the first through the inter-op pool; each task
+  // runs its own interpreter but they all share the method's graph executor
+  // (and thus its cached execution plans).
+  std::vector<c10::intrusive_ptr<c10::ivalue::Future>> futures;
+  futures.reserve(inputs.size() - 1);
+  for (const auto i : c10::irange(static_cast<size_t>(1), inputs.size())) {
+    auto future = c10::make_intrusive<c10::ivalue::Future>(c10::AnyType::get());
+    futures.push_back(future);
+    at::launch([method, future, stack = std::move(inputs[i])]() mutable {
+      try {
+        future->markCompleted(method(std::move(stack)));
+      } catch (...) {
+        future->setError(std::current_exception());
+      }
+    });
+  }
+  std::exception_ptr first_error;
+  try {
+    results[0] = method(std::move(inputs[0]));
+  } catch (...) {
+    first_error = std::current_exception();
+  }
+  for (const auto i : c10::irange(futures.size())) {
+    futures[i]->wait();
+    if (futures[i]->hasError()) {
+      if (!first_error) {
+        first_error = futures[i]->exception_ptr();
+      }
+    } else {
+      results[i + 1] = futures[i]->value();
+    }
+  }
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+  return results;
+}
+
 void Module::clone_method(
     const Module& orig,
     const Function& method,
@@ -486,10 +656,17 @@ Module freeze(
 }
 
 namespace {
-void optimize_for_inference(std::shared_ptr<Graph> graph) {
+void optimize_for_inference(
+    std::shared_ptr<Graph> graph,
+    std::vector<std::string>& linear_layout_choices) {
   FuseFrozenConvAddRelu(graph);
   ConvertFrozenOpsToMKLDNN(graph);
-  FrozenLinearTranspose(graph);
+  FrozenLinearAutotune(graph, &linear_layout_choices);
+  // Fuses the add/relu pairs the frozen conv fusion above did not claim.
+  FuseAddRelu(graph);
+  // The folding passes run by freeze materialize constants per use; pool
+  // them so the optimized module does not carry duplicates.
+  ConstantPooling(graph);
 }
 } // namespace
 
@@ -504,10 +681,26 @@ Module optimize_for_inference(
     frozen_mod = module;
   }
 
-  optimize_for_inference(frozen_mod.get_method("forward").graph());
+  std::vector<std::string> linear_layout_choices;
+  optimize_for_inference(
+      frozen_mod.get_method("forward").graph(), linear_layout_choices);
 
   for (const auto& method : other_methods) {
-    optimize_for_inference(frozen_mod.get_method(method).graph());
+    optimize_for_inference(
+        frozen_mod.get_method(method).graph(), linear_layout_choices);
+  }
+
+  // Keep a record of the weight layouts the autotuner picked so the decisions
+  // made on this machine can be inspected and reproduced.
+  if (!linear_layout_choices.empty()) {
+    c10::List<std::string> choices;
+    for (const auto& choice : linear_layout_choices) {
+      choices.push_back(choice);
+    }
+    frozen_mod.register_attribute(
+        "linear_layout_choices",
+        ListType::ofStrings(),
+        IValue(std::move(choices)));
   }
   return frozen_mod;
 }
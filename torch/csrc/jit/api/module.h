@@ -114,6 +114,22 @@ struct TORCH_API Module : public Object {
     return get_method("forward")(std::move(inputs), kwargs);
   }
 
+  // Runs `forward` over a batch of independent input stacks and returns one
+  // output per stack, amortizing per-call setup across requests: the first
+  // request runs on the calling thread while the rest are pipelined through
+  // the inter-op thread pool, all sharing this module's graph executor and
+  // its cached execution plans.
+  //
+  // If `try_concat` is true and every request consists of tensors that agree
+  // in everything but their leading (batch) dimension, the requests are
+  // concatenated along dim 0 and executed as a single call, and the outputs
+  // are split back per request. This is only profitable (and only valid) for
+  // models that treat dim 0 as a batch dimension; if the output shape does
+  // not follow the batch dimension we fall back to per-request execution.
+  std::vector<IValue> forward_batch(
+      std::vector<std::vector<IValue>> inputs,
+      bool try_concat = false);
+
   // In script modules, buffers are Tensors attribute that are _not_ registered
   // as parameters. This is different than in nn.Module where there is a special
   // register_buffer method. With this simplification, we only need to track
@@ -3,6 +3,7 @@
 #include <ATen/core/builtin_function.h>
 #include <ATen/core/stack.h>
 #include <torch/csrc/jit/backends/backend_interface.h>
+#include <torch/csrc/jit/mobile/compiled_artifact_cache.h>
 #include <torch/custom_class.h>
 
 namespace torch {
@@ -68,6 +69,26 @@ std::function<void(Stack&)> getCompileFunc() {
     auto method_compile_spec = pop(stack).toGenericDict();
     auto processed = pop(stack);
     auto self = pop(stack).toCustomClass<TBackendInterface>();
+    // Persistent artifact fast path: when the backend opts into caching (see
+    // PyTorchBackendInterface::compile_cache_key) and a cache is installed,
+    // hand it the artifact persisted by a previous load so it can skip its
+    // on-device compiler, and persist whatever it emits for the next one.
+    auto* cache = mobile::compiledArtifactCacheConfig().getCache();
+    const auto cache_key = cache != nullptr
+        ? self->compile_cache_key(processed, method_compile_spec)
+        : std::string();
+    if (!cache_key.empty()) {
+      const auto cached_artifact = cache->get(cache_key);
+      std::string artifact_to_persist;
+      auto ret = self->compile_cached(
+          processed, method_compile_spec, cached_artifact, &artifact_to_persist);
+      if (!artifact_to_persist.empty() &&
+          artifact_to_persist != cached_artifact) {
+        cache->put(cache_key, artifact_to_persist);
+      }
+      push(stack, ret);
+      return;
+    }
     auto ret = self->compile(processed, method_compile_spec);
     push(stack, ret);
   };
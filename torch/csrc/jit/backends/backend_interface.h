@@ -24,6 +24,36 @@ class TORCH_API PyTorchBackendInterface : public torch::CustomClassHolder {
       c10::IValue processed,
       c10::impl::GenericDict method_compile_spec) = 0;
 
+  // Optional extension for backends whose compile step invokes an expensive
+  // on-device compiler. A backend opts in by returning a non-empty key that
+  // incorporates a hash of \p processed and a device/driver fingerprint;
+  // when a mobile::CompiledArtifactCache is installed, the runtime then
+  // calls compile_cached instead of compile, passing the artifact persisted
+  // under that key (empty on a cache miss) and persisting whatever the
+  // backend leaves in \p artifact_to_persist. The default key disables
+  // caching.
+  virtual std::string compile_cache_key(
+      const c10::IValue& processed,
+      const c10::impl::GenericDict& method_compile_spec) {
+    (void)processed;
+    (void)method_compile_spec;
+    return std::string();
+  }
+
+  // Like compile, but may reconstruct the handles from \p cached_artifact
+  // (the bytes persisted by an earlier call) instead of recompiling, and may
+  // fill \p artifact_to_persist with bytes to store for the next load. The
+  // default ignores the cache and compiles from scratch.
+  virtual c10::impl::GenericDict compile_cached(
+      c10::IValue processed,
+      c10::impl::GenericDict method_compile_spec,
+      const std::string& cached_artifact,
+      std::string* artifact_to_persist) {
+    (void)cached_artifact;
+    (void)artifact_to_persist;
+    return compile(std::move(processed), std::move(method_compile_spec));
+  }
+
   // Execute the method specified by \p handle using \p inputs. \returns the
   // outputs as a tuple.
   virtual c10::impl::GenericList execute(
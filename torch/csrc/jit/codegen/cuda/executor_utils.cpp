@@ -3,6 +3,7 @@
 #include <ATen/cuda/nvrtc_stub/ATenNVRTC.h>
 
 #include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 
 #include <torch/csrc/jit/codegen/cuda/contiguity.h>
@@ -42,6 +43,7 @@
 #endif
 
 #include <fstream>
+#include <iterator>
 
 namespace torch {
 namespace jit {
@@ -889,6 +891,112 @@ void initializeCudaContext() {
   }
 }
 
+namespace {
+
+#ifndef __HIP_PLATFORM_HCC__
+
+//! Directory for the on-disk compiled-kernel cache, taken from the
+//! PYTORCH_NVFUSER_KERNEL_CACHE environment variable. Empty disables the
+//! cache. Unlike PYTORCH_NVFUSER_CUBIN, which dumps binaries for
+//! inspection, entries written here are read back on later runs so that
+//! warmup skips nvrtc entirely for kernels compiled by a previous process.
+std::string compiledKernelCacheDir() {
+  const char* dir = getenv("PYTORCH_NVFUSER_KERNEL_CACHE");
+  return dir != nullptr ? dir : "";
+}
+
+//! Key for the on-disk cache. Everything that can change the generated
+//! binary must feed the hash: the complete kernel source, the name
+//! expression, every compile argument (which covers the target
+//! architecture and sass-vs-ptx), and the toolkit version.
+std::string compiledKernelCacheKey(
+    const std::string& code,
+    const std::string& func_name,
+    const std::vector<const char*>& args) {
+  size_t hash = std::hash<std::string>{}(code);
+  hash = c10::hash_combine(hash, std::hash<std::string>{}(func_name));
+  for (auto arg : args) {
+    hash = c10::hash_combine(hash, std::hash<std::string>{}(arg));
+  }
+  hash = c10::hash_combine(hash, static_cast<size_t>(CUDA_VERSION));
+  std::stringstream ss;
+  ss << std::hex << hash;
+  return ss.str();
+}
+
+//! Loads a previously cached binary and resolves its kernel. Returns false
+//! on any miss or load failure (stale driver, truncated file, ...) so the
+//! caller falls back to a fresh compilation.
+bool loadCompiledKernelFromDisk(
+    const std::string& cache_base,
+    const std::vector<CUjit_option>& options,
+    const std::vector<void*>& option_vals,
+    NvrtcFunction* compiled_kernel) {
+  std::ifstream name_file(cache_base + ".name");
+  std::string lowered_kernel_name;
+  if (!name_file.is_open() ||
+      !std::getline(name_file, lowered_kernel_name) ||
+      lowered_kernel_name.empty()) {
+    return false;
+  }
+
+  std::ifstream bin_file(cache_base + ".bin", std::ios::in | std::ios::binary);
+  if (!bin_file.is_open()) {
+    return false;
+  }
+  std::vector<char> binary(
+      (std::istreambuf_iterator<char>(bin_file)),
+      std::istreambuf_iterator<char>());
+  if (binary.empty()) {
+    return false;
+  }
+
+  NvrtcFunction loaded;
+  if (at::globalContext().getNVRTC().cuModuleLoadDataEx(
+          &loaded.module,
+          binary.data(),
+          options.size(),
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+          const_cast<CUjit_option*>(options.data()),
+          const_cast<void**>(option_vals.data())) != CUDA_SUCCESS) {
+    return false;
+  }
+  if (at::globalContext().getNVRTC().cuModuleGetFunction(
+          &loaded.function, loaded.module, lowered_kernel_name.c_str()) !=
+      CUDA_SUCCESS) {
+    at::globalContext().getNVRTC().cuModuleUnload(loaded.module);
+    return false;
+  }
+  *compiled_kernel = loaded;
+  return true;
+}
+
+//! Writes the compiled binary and its lowered kernel name next to each
+//! other. The name file is written last so that a partially written entry
+//! (e.g. the process died mid-write) is treated as a miss.
+void saveCompiledKernelToDisk(
+    const std::string& cache_base,
+    const std::vector<char>& binary,
+    const char* lowered_kernel_name) {
+  std::ofstream bin_file(cache_base + ".bin", std::ios::out | std::ios::binary);
+  if (!bin_file.is_open()) {
+    return;
+  }
+  bin_file.write(binary.data(), binary.size());
+  bin_file.close();
+  if (!bin_file.good()) {
+    return;
+  }
+  std::ofstream name_file(cache_base + ".name");
+  if (name_file.is_open()) {
+    name_file << lowered_kernel_name << std::endl;
+  }
+}
+
+#endif // __HIP_PLATFORM_HCC__
+
+} // namespace
+
 std::pair<NvrtcFunction, std::string> nvrtcCompile(
     const std::string& code,
     const std::string& func_name,
@@ -1065,6 +1173,28 @@ std::pair<NvrtcFunction, std::string> nvrtcCompile(
   }
 #endif
 
+#ifndef __HIP_PLATFORM_HCC__
+  // With a cache directory configured, skip nvrtc entirely when a binary
+  // compiled with identical source and options is already on disk. All
+  // compile arguments are final at this point, so they can key the lookup.
+  std::string cache_base;
+  const auto cache_dir = compiledKernelCacheDir();
+  if (!cache_dir.empty()) {
+    cache_base =
+        cache_dir + "/" + compiledKernelCacheKey(code, func_name, args);
+    NvrtcFunction cached_kernel;
+    FUSER_PERF_SCOPE("executor_utils::Nvrtc::LoadCachedKernel");
+    if (loadCompiledKernelFromDisk(
+            cache_base, options, option_vals, &cached_kernel)) {
+      TORCH_CHECK(
+          !isDisabled(DisableOption::ArchCheck),
+          "NVFuser Compile: arch check disabled, should not return any compiled kernel");
+      ptxas_log << "kernel " << id << " loaded from " << cache_base << "\n";
+      return {cached_kernel, ptxas_log.str()};
+    }
+  }
+#endif
+
   at::globalContext().getNVRTC().nvrtcAddNameExpression(
       program, func_name.c_str());
 
@@ -1122,6 +1252,12 @@ std::pair<NvrtcFunction, std::string> nvrtcCompile(
 
   NvrtcFunction compiled_kernel_;
 
+#ifndef __HIP_PLATFORM_HCC__
+  if (!cache_base.empty()) {
+    saveCompiledKernelToDisk(cache_base, ptx, lowered_kernel_name);
+  }
+#endif
+
   // TODO: We do go through different code path, should investigate whether this
   // has an impact on generated binary.
 #ifndef __HIP_PLATFORM_HCC__
@@ -0,0 +1,63 @@
+#include <torch/csrc/jit/mobile/compiled_artifact_cache.h>
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <utility>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+FileCompiledArtifactCache::FileCompiledArtifactCache(std::string dir)
+    : dir_(std::move(dir)) {}
+
+std::string FileCompiledArtifactCache::pathFor(const std::string& key) const {
+  std::ostringstream path;
+  path << dir_ << "/" << std::hex << std::hash<std::string>()(key)
+       << ".delegate";
+  return path.str();
+}
+
+std::string FileCompiledArtifactCache::get(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::ifstream file(pathFor(key), std::ios::binary);
+  if (!file) {
+    return std::string();
+  }
+  std::ostringstream artifact;
+  artifact << file.rdbuf();
+  return artifact.str();
+}
+
+void FileCompiledArtifactCache::put(
+    const std::string& key,
+    const std::string& artifact) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto path = pathFor(key);
+  const auto tmp_path = path + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return;
+    }
+    file.write(artifact.data(), artifact.size());
+    if (!file) {
+      return;
+    }
+  }
+  // Atomic publish; a failure here just means the next load recompiles.
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+CompiledArtifactCacheConfig& compiledArtifactCacheConfig() {
+  static CompiledArtifactCacheConfig instance;
+  return instance;
+}
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+// On-device store for backend-compiled artifacts. Delegated backends (NNAPI,
+// Metal, ...) invoke a vendor compiler inside compile() on every model load;
+// an installed cache lets a backend persist the vendor compiler's output and
+// skip it on subsequent launches. Keys are produced by the backend via
+// PyTorchBackendInterface::compile_cache_key and are expected to incorporate
+// both a hash of the processed model and a device/driver fingerprint, so a
+// model update or OS/driver upgrade naturally misses and recompiles.
+class TORCH_API CompiledArtifactCache {
+ public:
+  virtual ~CompiledArtifactCache() = default;
+
+  // Returns the persisted artifact for \p key, or an empty string when the
+  // key is absent or the artifact cannot be read.
+  virtual std::string get(const std::string& key) = 0;
+
+  // Persists \p artifact under \p key. Failures should be swallowed: a cache
+  // write error must never fail a model load.
+  virtual void put(const std::string& key, const std::string& artifact) = 0;
+};
+
+// A CompiledArtifactCache that stores one file per key in a directory, e.g.
+// an app's cache dir. Keys are hashed into file names, writes go through a
+// temporary file and a rename so concurrent loads never observe a partial
+// artifact.
+class TORCH_API FileCompiledArtifactCache : public CompiledArtifactCache {
+ public:
+  explicit FileCompiledArtifactCache(std::string dir);
+
+  std::string get(const std::string& key) override;
+  void put(const std::string& key, const std::string& artifact) override;
+
+ private:
+  std::string pathFor(const std::string& key) const;
+
+  std::string dir_;
+  std::mutex mutex_;
+};
+
+class CompiledArtifactCacheConfig {
+ public:
+  void setCache(std::unique_ptr<CompiledArtifactCache> cache) {
+    cache_ = std::move(cache);
+  }
+  CompiledArtifactCache* getCache() {
+    return cache_.get();
+  }
+
+ private:
+  std::unique_ptr<CompiledArtifactCache> cache_;
+};
+
+TORCH_API CompiledArtifactCacheConfig& compiledArtifactCacheConfig();
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
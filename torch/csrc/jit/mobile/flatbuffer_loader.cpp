@@ -192,6 +192,10 @@ mobile::Module FlatbufferLoader::parseModule(
   storages_.resize(module->storage_data_size());
   storage_loaded_.resize(module->storage_data_size(), false);
 
+  if (should_load_operators_) {
+    parseOperatorTable(module);
+  }
+
   for (uint32_t i = 0; i < ivalues->size(); i++) {
     const auto* ival = ivalues->Get(i);
     if (const auto* func = ival->val_as_Function()) {
@@ -261,7 +265,13 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
   }
 
   if (should_load_operators_) {
-    function->initialize_operators(true);
+    const auto* operator_index = method->operator_index();
+    if (operator_index != nullptr &&
+        operator_index->size() == method->operators()->size()) {
+      installResolvedOperators(*function, *operator_index);
+    } else {
+      function->initialize_operators(true);
+    }
   }
 
   for (const auto i : *method->type_annotations()) {
@@ -309,6 +319,48 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
   return function;
 }
 
+void FlatbufferLoader::parseOperatorTable(
+    const mobile::serialization::Module* module) {
+  resolved_operator_table_.clear();
+  const auto* operator_table = module->operator_table();
+  if (operator_table == nullptr) {
+    return;
+  }
+  resolved_operator_table_.reserve(operator_table->size());
+  for (const auto* op : *operator_table) {
+    c10::optional<int> num_args = c10::nullopt;
+    if (op->num_args_serialized() > -1) {
+      num_args = op->num_args_serialized();
+    }
+    resolved_operator_table_.push_back(makeOperatorFunction(
+        c10::OperatorName(op->name()->str(), op->overload_name()->str()),
+        num_args));
+  }
+}
+
+void FlatbufferLoader::installResolvedOperators(
+    mobile::Function& function,
+    const flatbuffers::Vector<uint32_t>& operator_index) {
+  std::vector<std::function<void(Stack&)>> operators;
+  operators.reserve(operator_index.size());
+  for (uint32_t slot : operator_index) {
+    TORCH_CHECK(
+        slot < resolved_operator_table_.size(),
+        "Operator table slot ",
+        slot,
+        " out of range");
+    const auto& resolved = resolved_operator_table_[slot];
+    if (!resolved.has_value()) {
+      // An operator is missing from this runtime; fall back to the
+      // per-function path for its detailed error message.
+      function.initialize_operators(true);
+      return;
+    }
+    operators.push_back(*resolved);
+  }
+  function.set_resolved_operators(std::move(operators));
+}
+
 IValue parseEnum(
     FlatbufferLoader& loader,
     const mobile::serialization::IValue& ivalue) {
@@ -141,6 +141,13 @@ class TORCH_API FlatbufferLoader {
   IValue parseIValue(const mobile::serialization::IValue* ivalue);
   std::unique_ptr<mobile::Function> parseFunction(
       const mobile::serialization::Function* method);
+  // Resolves every entry of the module-level operator table once, so
+  // functions referencing the table by slot share the results instead of
+  // repeating Dispatcher lookups per method.
+  void parseOperatorTable(const mobile::serialization::Module* module);
+  void installResolvedOperators(
+      mobile::Function& function,
+      const flatbuffers::Vector<uint32_t>& operator_index);
 
   std::unordered_map<uint32_t, mobile::Function*> all_functions_;
   std::vector<ClassTypePtr> all_types_;
@@ -154,6 +161,10 @@ class TORCH_API FlatbufferLoader {
       static_cast<uint8_t>(mobile::serialization::IValueUnion::MAX) + 1>
       ivalue_parsers_;
   TypeResolver type_resolver_ = nullptr;
+  // See parseOperatorTable; nullopt entries are operators missing from the
+  // current runtime.
+  std::vector<c10::optional<std::function<void(Stack&)>>>
+      resolved_operator_table_;
   mobile::serialization::Module* module_ = nullptr;
   bool module_parsed_ = false;
   bool should_copy_tensor_memory_ = false;
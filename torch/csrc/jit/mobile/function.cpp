@@ -92,6 +92,18 @@ bool Function::initialize_operators(bool should_check_operators) {
   return all_ops_supported;
 }
 
+void Function::set_resolved_operators(
+    std::vector<std::function<void(Stack&)>> operators) {
+  TORCH_CHECK(
+      operators.size() == code_.op_names_.size(),
+      "Expected ",
+      code_.op_names_.size(),
+      " resolved operators but got ",
+      operators.size());
+  code_.operators_ = std::move(operators);
+  code_.initialized = true;
+}
+
 void Function::append_constant(const c10::IValue& constant) {
   code_.constants_.push_back(constant);
 }
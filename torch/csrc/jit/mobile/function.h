@@ -69,6 +69,13 @@ class TORCH_API Function : public torch::jit::Function {
   // in unsupported_op_names
   bool initialize_operators(bool should_check_operators);
 
+  // Installs operator functions that were already resolved elsewhere (e.g.
+  // through a module-level operator table shared across methods), so
+  // initialize_operators does not have to repeat the Dispatcher lookups.
+  // Must match the operators appended via append_operator, in order.
+  void set_resolved_operators(
+      std::vector<std::function<void(Stack&)>> operators);
+
  private:
   c10::QualifiedName name_;
   Code code_;
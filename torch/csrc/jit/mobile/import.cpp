@@ -13,6 +13,8 @@
 #include <torch/csrc/jit/mobile/file_format.h>
 #if defined(ENABLE_FLATBUFFER)
 #include <torch/csrc/jit/mobile/flatbuffer_loader.h>
+#include <torch/csrc/jit/serialization/flatbuffer_serializer.h>
+#include <sys/stat.h>
 #endif
 #include <torch/csrc/jit/mobile/interpreter.h>
 #include <torch/csrc/jit/mobile/observer.h>
@@ -634,6 +636,57 @@ mobile::Module _load_for_mobile(
   return module;
 }
 
+#if defined(ENABLE_FLATBUFFER)
+namespace {
+
+// A cache is usable if it exists and is at least as new as the model it was
+// built from.
+bool mobile_cache_is_fresh(
+    const std::string& model_filename,
+    const std::string& cache_filename) {
+  struct stat model_stat {};
+  struct stat cache_stat {};
+  if (stat(model_filename.c_str(), &model_stat) != 0 ||
+      stat(cache_filename.c_str(), &cache_stat) != 0) {
+    return false;
+  }
+  return cache_stat.st_mtime >= model_stat.st_mtime;
+}
+
+} // namespace
+#endif
+
+mobile::Module _load_for_mobile_cached(
+    const std::string& filename,
+    const std::string& cache_filename,
+    c10::optional<at::Device> device) {
+#if defined(ENABLE_FLATBUFFER)
+  // A flatbuffer file is already the ready-to-run representation; load it
+  // directly (mmapped) and don't maintain a cache for it.
+  if (getFileFormat(filename) == FileFormat::FlatbufferFileFormat) {
+    return _load_for_mobile(filename, device);
+  }
+  if (mobile_cache_is_fresh(filename, cache_filename) &&
+      getFileFormat(cache_filename) == FileFormat::FlatbufferFileFormat) {
+    try {
+      return _load_for_mobile(cache_filename, device);
+    } catch (const std::exception&) {
+      // A corrupt cache (e.g. truncated by a crash mid-write) falls through
+      // to a reparse of the model, which rewrites the cache below.
+    }
+  }
+  auto module = _load_for_mobile(filename, device);
+  try {
+    save_mobile_module(module, cache_filename);
+  } catch (const std::exception&) {
+    // Failing to persist the cache must not fail the load.
+  }
+  return module;
+#else
+  return _load_for_mobile(filename, device);
+#endif
+}
+
 mobile::Module _load_for_mobile_impl(
     std::unique_ptr<ReadAdapterInterface> rai,
     c10::optional<c10::Device> device,
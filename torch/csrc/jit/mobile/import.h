@@ -52,6 +52,25 @@ TORCH_API mobile::Module _load_for_mobile(
     std::unique_ptr<ReadAdapterInterface> rai,
     c10::optional<c10::Device> device = c10::nullopt);
 
+/**
+ * Load `filename` like `_load_for_mobile`, but maintain an on-device cache
+ * of the ready-to-run representation at `cache_filename`.
+ *
+ * The first load of a pickled-bytecode model parses it as usual and then
+ * persists the resulting module as a flatbuffer, which stores the parsed
+ * instruction stream and constant tables directly; subsequent loads mmap
+ * that file instead of reparsing the bytecode. The cache is ignored and
+ * rebuilt when it is older than the model file or fails to load. A failure
+ * to write the cache (e.g. no space) does not fail the load.
+ *
+ * In builds without flatbuffer support this behaves exactly like
+ * `_load_for_mobile` and no cache is written.
+ */
+TORCH_API mobile::Module _load_for_mobile_cached(
+    const std::string& filename,
+    const std::string& cache_filename,
+    c10::optional<at::Device> device = c10::nullopt);
+
 /**
  * Load only the contents of the "extra/" files whose names are
  * passed in the map (extra_files). Populate the corresponding values
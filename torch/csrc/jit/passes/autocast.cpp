@@ -10,7 +10,9 @@
 #include <torch/csrc/jit/passes/cuda_graph_fuser.h>
 #include <torch/csrc/jit/passes/quantization/helper.h>
 
+#include <map>
 #include <stack>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -38,6 +40,29 @@ struct AutocastScope {
   void stack(const AutocastContext& parent_context) {}
 };
 
+// A cast is fully determined by the source value, the cast op and the
+// autocast context flags (the flags become the non-tensor cast inputs), so
+// casts with the same key are interchangeable and we only need to emit one.
+using CastKey = std::
+    tuple<Value*, Symbol, bool, bool, c10::ScalarType, c10::ScalarType>;
+using CastCache = std::map<CastKey, Value*>;
+
+// Casts are inserted right before their first consumer and nodes are visited
+// in execution order, so an earlier cast dominates a later node iff the
+// later node's block is the cast's block or is nested inside it.
+bool castDominates(Value* casted, Node* user) {
+  Block* cast_block = casted->node()->owningBlock();
+  for (Block* block = user->owningBlock(); block != nullptr;
+       block = block->owningNode() != nullptr
+           ? block->owningNode()->owningBlock()
+           : nullptr) {
+    if (block == cast_block) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool isAutocastNode(Value* value) {
   const auto class_name = getModuleName(value);
   return class_name.has_value() &&
@@ -140,7 +165,8 @@ c10::optional<AutocastScope> parseAutocast(
 void castTensorInputs(
     Node* node,
     Symbol cast_op,
-    const AutocastContext& context) {
+    const AutocastContext& context,
+    CastCache& cast_cache) {
   if (!context) {
     return;
   }
@@ -165,6 +191,25 @@ void castTensorInputs(
   WithInsertPoint insert_point(node);
 
   for (auto input : casted_inputs_ordered) {
+    // The target scalar types only participate in reduced precision casts,
+    // so leave them out of the key otherwise to maximize reuse
+    const bool reduced = cast_op == aten::_autocast_to_reduced_precision;
+    CastKey key{
+        input,
+        cast_op,
+        context.gpu_enabled,
+        context.cpu_enabled,
+        reduced ? context.gpu_scalar_type : c10::ScalarType::Undefined,
+        reduced ? context.cpu_scalar_type : c10::ScalarType::Undefined};
+
+    // Reuse an earlier cast of the same value under the same context, so a
+    // value consumed by several ops in one region is converted only once
+    const auto it = cast_cache.find(key);
+    if (it != cast_cache.end() && castDominates(it->second, node)) {
+      node->replaceInputWith(input, it->second);
+      continue;
+    }
+
     if (cast_op == aten::_autocast_to_full_precision) {
       const auto new_input = graph->insert(
           cast_op,
@@ -172,6 +217,7 @@ void castTensorInputs(
            graph->insertConstant(IValue(context.gpu_enabled)),
            graph->insertConstant(IValue(context.cpu_enabled))});
       node->replaceInputWith(input, new_input);
+      cast_cache[key] = new_input;
     } else if (cast_op == aten::_autocast_to_reduced_precision) {
       const auto new_input = graph->insert(
           cast_op,
@@ -181,6 +227,7 @@ void castTensorInputs(
            graph->insertConstant(IValue(context.gpu_scalar_type)),
            graph->insertConstant(IValue(context.cpu_scalar_type))});
       node->replaceInputWith(input, new_input);
+      cast_cache[key] = new_input;
     } else {
       TORCH_INTERNAL_ASSERT(
           false, "unrecognized cast_op symbol: ", cast_op.toQualString());
@@ -196,7 +243,10 @@ bool hasExplicitDtypeArgument(Node* node) {
   return false;
 }
 
-void castInputsToWidestType(Node* node, const AutocastContext& context) {
+void castInputsToWidestType(
+    Node* node,
+    const AutocastContext& context,
+    CastCache& cast_cache) {
   if (!context) {
     return;
   }
@@ -209,7 +259,8 @@ void castInputsToWidestType(Node* node, const AutocastContext& context) {
     if (auto tensor_type = input->type()->cast<TensorType>()) {
       const auto dtype = tensor_type->scalarType();
       if (!dtype.has_value() || *dtype == at::ScalarType::Float) {
-        castTensorInputs(node, aten::_autocast_to_full_precision, context);
+        castTensorInputs(
+            node, aten::_autocast_to_full_precision, context, cast_cache);
         return;
       }
     }
@@ -232,7 +283,10 @@ void castInputsToWidestType(Node* node, const AutocastContext& context) {
 // expects dgrad to be the same scalar type to throw mismatch error.
 //
 // TODO: Use the list from AMP eager directly
-void handleBlock(Block* block, AutocastContext initial_state) {
+void handleBlock(
+    Block* block,
+    AutocastContext initial_state,
+    CastCache& cast_cache) {
   std::stack<AutocastScope> autocast_stack;
 
   c10::optional<bool> incompatible_amp = c10::nullopt;
@@ -244,6 +298,14 @@ void handleBlock(Block* block, AutocastContext initial_state) {
   };
 
   for (Node* node : block->nodes()) {
+    // In-place ops may overwrite a value we already cast, so drop the cached
+    // casts and let later uses convert the updated tensor again
+    if (const auto* schema = node->maybeSchema()) {
+      if (schema->is_mutable()) {
+        cast_cache.clear();
+      }
+    }
+
     switch (node->kind()) {
       case prim::CallFunction:
         // TODO: limit it only to amp related node;
@@ -253,7 +315,10 @@ void handleBlock(Block* block, AutocastContext initial_state) {
           // function calls
           if (current_state()) {
             castTensorInputs(
-                node, aten::_autocast_to_full_precision, current_state());
+                node,
+                aten::_autocast_to_full_precision,
+                current_state(),
+                cast_cache);
           }
           break;
         }
@@ -271,7 +336,10 @@ void handleBlock(Block* block, AutocastContext initial_state) {
           // function calls
           if (current_state()) {
             castTensorInputs(
-                node, aten::_autocast_to_full_precision, current_state());
+                node,
+                aten::_autocast_to_full_precision,
+                current_state(),
+                cast_cache);
           }
           break;
         }
@@ -349,7 +417,10 @@ void handleBlock(Block* block, AutocastContext initial_state) {
       case aten::rnn_relu_cell:
         if (!node->schema().is_mutable()) {
           castTensorInputs(
-              node, aten::_autocast_to_reduced_precision, current_state());
+              node,
+              aten::_autocast_to_reduced_precision,
+              current_state(),
+              cast_cache);
         }
         break;
 
@@ -398,7 +469,10 @@ void handleBlock(Block* block, AutocastContext initial_state) {
       case aten::logsumexp:
         if (!node->schema().is_mutable()) {
           castTensorInputs(
-              node, aten::_autocast_to_full_precision, current_state());
+              node,
+              aten::_autocast_to_full_precision,
+              current_state(),
+              cast_cache);
         }
         break;
 
@@ -410,7 +484,10 @@ void handleBlock(Block* block, AutocastContext initial_state) {
       case aten::sum:
         if (!node->schema().is_mutable() && !hasExplicitDtypeArgument(node)) {
           castTensorInputs(
-              node, aten::_autocast_to_full_precision, current_state());
+              node,
+              aten::_autocast_to_full_precision,
+              current_state(),
+              cast_cache);
         }
         break;
 
@@ -419,7 +496,8 @@ void handleBlock(Block* block, AutocastContext initial_state) {
         if (!node->schema().is_mutable() && !hasExplicitDtypeArgument(node)) {
           auto context = current_state();
           context.cpu_enabled = false;
-          castTensorInputs(node, aten::_autocast_to_full_precision, context);
+          castTensorInputs(
+              node, aten::_autocast_to_full_precision, context, cast_cache);
         }
         break;
 
@@ -444,7 +522,7 @@ void handleBlock(Block* block, AutocastContext initial_state) {
       case aten::mul:
       case aten::div:
         if (!node->schema().is_mutable()) {
-          castInputsToWidestType(node, current_state());
+          castInputsToWidestType(node, current_state(), cast_cache);
         }
         break;
 
@@ -457,7 +535,7 @@ void handleBlock(Block* block, AutocastContext initial_state) {
 
     // process sub-blocks, if any
     for (Block* sub_block : node->blocks()) {
-      handleBlock(sub_block, current_state());
+      handleBlock(sub_block, current_state(), cast_cache);
     }
   }
 
@@ -485,7 +563,8 @@ void Autocast(const std::shared_ptr<Graph>& graph) {
         at::autocast::is_cpu_enabled(),
         at::autocast::get_autocast_gpu_dtype(),
         at::autocast::get_autocast_cpu_dtype()};
-    handleBlock(graph->block(), init);
+    CastCache cast_cache;
+    handleBlock(graph->block(), init, cast_cache);
   }
   GRAPH_DUMP("\nAfter Autocast: ", graph);
 }
@@ -0,0 +1,148 @@
+#include <torch/csrc/jit/passes/compiled_shape_function.h>
+
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/passes/symbolic_shape_analysis.h>
+
+#include <unordered_map>
+#include <utility>
+
+namespace torch {
+namespace jit {
+
+CompiledShapeFunction::CompiledShapeFunction(
+    std::shared_ptr<Graph> shape_graph,
+    std::vector<size_t> shape_input_sources,
+    std::vector<c10::optional<size_t>> tensor_input_ranks,
+    std::vector<std::vector<int64_t>> output_recipes)
+    : shape_graph_(std::move(shape_graph)),
+      code_(std::make_shared<Code>(shape_graph_, "<shape function>")),
+      shape_input_sources_(std::move(shape_input_sources)),
+      tensor_input_ranks_(std::move(tensor_input_ranks)),
+      output_recipes_(std::move(output_recipes)) {}
+
+c10::optional<CompiledShapeFunction> CompiledShapeFunction::compile(
+    const std::shared_ptr<Graph>& graph) {
+  // Shape analysis refines types in place; work on a copy so the caller's
+  // graph is untouched.
+  auto graph_copy = graph->copy();
+  auto mapping = PropagateShapesAndBuildLargeShapeComputeGraph(
+      graph_copy, *graph_copy->nodes().begin(), *graph_copy->nodes().end());
+  if (!mapping) {
+    return c10::nullopt;
+  }
+  auto& shape_graph = mapping->partial_eval_shape_graph;
+
+  // Index the Tensor inputs of the graph; these are the only values whose
+  // shapes callers provide at run time.
+  std::unordered_map<Value*, size_t> tensor_input_index;
+  std::vector<c10::optional<size_t>> tensor_input_ranks;
+  for (Value* input : graph_copy->inputs()) {
+    if (auto tt = input->type()->cast<TensorType>()) {
+      tensor_input_index[input] = tensor_input_ranks.size();
+      tensor_input_ranks.push_back(tt->symbolic_sizes().rank());
+    }
+  }
+
+  // Each shape graph input consumes the shape of one enclosing-graph value.
+  // We can only evaluate the shape graph ahead of execution if all of those
+  // values are Tensor inputs of the graph.
+  std::unordered_map<Value*, Value*> shape_input_to_enclosing_value;
+  for (const auto& pr : mapping->enclosing_graph_value_to_shape_graph_input_) {
+    shape_input_to_enclosing_value[pr.second] = pr.first;
+  }
+  std::vector<size_t> shape_input_sources;
+  for (Value* shape_input : shape_graph->inputs()) {
+    auto enclosing_it = shape_input_to_enclosing_value.find(shape_input);
+    if (enclosing_it == shape_input_to_enclosing_value.end()) {
+      return c10::nullopt;
+    }
+    auto index_it = tensor_input_index.find(enclosing_it->second);
+    if (index_it == tensor_input_index.end()) {
+      return c10::nullopt;
+    }
+    shape_input_sources.push_back(index_it->second);
+  }
+
+  // Map each symbolic dimension the shape graph computes to the index of
+  // the graph output holding its value.
+  std::unordered_map<int64_t, int64_t> sym_dim_to_output_index;
+  for (const auto i : c10::irange(shape_graph->outputs().size())) {
+    auto it = mapping->graph_output_to_symbolic_shape_dim_.find(
+        shape_graph->outputs().at(i));
+    if (it != mapping->graph_output_to_symbolic_shape_dim_.end()) {
+      sym_dim_to_output_index[it->second] = static_cast<int64_t>(i);
+    }
+  }
+
+  // Record, per graph output dimension, either its static size or the shape
+  // graph output that computes it.
+  std::vector<std::vector<int64_t>> output_recipes;
+  for (Value* output : graph_copy->outputs()) {
+    auto tt = output->type()->cast<TensorType>();
+    if (!tt || !tt->symbolic_sizes().rank()) {
+      return c10::nullopt;
+    }
+    std::vector<int64_t> recipe;
+    for (const auto& shape_symbol : *tt->symbolic_sizes().sizes()) {
+      if (shape_symbol.is_static()) {
+        recipe.push_back(shape_symbol.static_size());
+      } else {
+        auto it = sym_dim_to_output_index.find(shape_symbol.value());
+        if (it == sym_dim_to_output_index.end()) {
+          return c10::nullopt;
+        }
+        recipe.push_back(-it->second - 1);
+      }
+    }
+    output_recipes.push_back(std::move(recipe));
+  }
+
+  return CompiledShapeFunction(
+      shape_graph,
+      std::move(shape_input_sources),
+      std::move(tensor_input_ranks),
+      std::move(output_recipes));
+}
+
+std::vector<std::vector<int64_t>> CompiledShapeFunction::run(
+    const std::vector<std::vector<int64_t>>& input_shapes) const {
+  TORCH_CHECK(
+      input_shapes.size() == tensor_input_ranks_.size(),
+      "Expected one shape per Tensor input (",
+      tensor_input_ranks_.size(),
+      "), got ",
+      input_shapes.size());
+  for (const auto i : c10::irange(input_shapes.size())) {
+    TORCH_CHECK(
+        !tensor_input_ranks_[i] ||
+            input_shapes[i].size() == *tensor_input_ranks_[i],
+        "Expected input ",
+        i,
+        " to have rank ",
+        *tensor_input_ranks_[i],
+        ", got ",
+        input_shapes[i].size());
+  }
+
+  Stack stack;
+  for (const auto source : shape_input_sources_) {
+    stack.emplace_back(input_shapes[source]);
+  }
+  InterpreterState(*code_).run(stack);
+  TORCH_INTERNAL_ASSERT(stack.size() == shape_graph_->outputs().size());
+
+  std::vector<std::vector<int64_t>> result;
+  result.reserve(output_recipes_.size());
+  for (const auto& recipe : output_recipes_) {
+    std::vector<int64_t> sizes;
+    sizes.reserve(recipe.size());
+    for (const auto dim : recipe) {
+      sizes.push_back(dim >= 0 ? dim : stack.at(-dim - 1).toInt());
+    }
+    result.push_back(std::move(sizes));
+  }
+  return result;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+
+#include <memory>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+// A precompiled shape transfer function for a graph.
+//
+// compile() runs symbolic shape analysis once, stitching the per-node shape
+// functions from the symbolic shape registry into a single straight-line
+// integer graph (see PropagateShapesAndBuildLargeShapeComputeGraph), and
+// compiles that graph to interpreter code. run() then evaluates the compiled
+// code with concrete input shapes, yielding the exact shape of every graph
+// output - e.g. for output preallocation in serving - without executing any
+// tensor computation.
+//
+// compile() returns nullopt when some output shape cannot be expressed as a
+// function of the input shapes alone: data-dependent shapes, shapes that
+// depend on non-tensor inputs, or ops without a registered shape function.
+class TORCH_API CompiledShapeFunction {
+ public:
+  static c10::optional<CompiledShapeFunction> compile(
+      const std::shared_ptr<Graph>& graph);
+
+  // `input_shapes` must contain one concrete shape per Tensor input of the
+  // graph, in graph input order. Returns one concrete shape per graph
+  // output.
+  std::vector<std::vector<int64_t>> run(
+      const std::vector<std::vector<int64_t>>& input_shapes) const;
+
+ private:
+  CompiledShapeFunction(
+      std::shared_ptr<Graph> shape_graph,
+      std::vector<size_t> shape_input_sources,
+      std::vector<c10::optional<size_t>> tensor_input_ranks,
+      std::vector<std::vector<int64_t>> output_recipes);
+
+  // The stitched shape compute graph and its compiled form.
+  std::shared_ptr<Graph> shape_graph_;
+  std::shared_ptr<Code> code_;
+
+  // For each input of shape_graph_, the index of the graph's Tensor input
+  // whose shape it consumes.
+  std::vector<size_t> shape_input_sources_;
+
+  // Expected rank of each Tensor input, when known, for input validation.
+  std::vector<c10::optional<size_t>> tensor_input_ranks_;
+
+  // Per graph output, one entry per dimension: a non-negative value is a
+  // static size, a negative value v refers to shape graph output (-v - 1).
+  std::vector<std::vector<int64_t>> output_recipes_;
+};
+
+} // namespace jit
+} // namespace torch
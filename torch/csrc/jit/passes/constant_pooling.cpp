@@ -1,10 +1,20 @@
 #include <torch/csrc/jit/passes/constant_pooling.h>
 
+#include <ATen/ATen.h>
 #include <ATen/core/symbol.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/ir/ir.h>
 #include <torch/csrc/jit/ir/node_hashing.h>
+#include <cstring>
+#include <memory>
 #include <unordered_set>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace torch {
 namespace jit {
@@ -64,6 +74,65 @@ void ConstantPooling(
       node->moveBefore(first_node);
   }
 }
+
+#ifndef _WIN32
+
+constexpr size_t kConstantArenaAlignment = 64;
+
+// Read-only mmap'd backing for consolidated constant tensors. One arena is
+// shared by every tensor carved out of it and unmapped when the last of
+// them goes away.
+struct ConstantArena {
+  ConstantArena(void* ptr, size_t size) : ptr_(ptr), size_(size) {}
+  ~ConstantArena() {
+    munmap(ptr_, size_);
+  }
+  void* ptr_;
+  size_t size_;
+};
+
+void scanNodeInputs(
+    Node* node,
+    std::vector<Node*>& order,
+    std::unordered_set<Node*>& seen) {
+  for (Value* input : node->inputs()) {
+    Node* producer = input->node();
+    if (producer->kind() != prim::Constant ||
+        !seen.insert(producer).second) {
+      continue;
+    }
+    auto ivalue = toIValue(input);
+    if (!ivalue || !ivalue->isTensor()) {
+      continue;
+    }
+    const auto& tensor = ivalue->toTensor();
+    // Only dense CPU payloads go into the arena; quantized and sparse
+    // tensors carry extra state next to the data and stay as they are.
+    if (!tensor.defined() || !tensor.device().is_cpu() ||
+        tensor.is_quantized() || tensor.is_sparse() || tensor.numel() == 0) {
+      continue;
+    }
+    order.push_back(producer);
+  }
+}
+
+// Collects tensor constants in the order execution first uses them, so the
+// arena layout matches the access pattern at run time.
+void collectTensorConstants(
+    Block* block,
+    std::vector<Node*>& order,
+    std::unordered_set<Node*>& seen) {
+  for (Node* node : block->nodes()) {
+    scanNodeInputs(node, order, seen);
+    for (Block* sub : node->blocks()) {
+      collectTensorConstants(sub, order, seen);
+    }
+  }
+  scanNodeInputs(block->return_node(), order, seen);
+}
+
+#endif // _WIN32
+
 } // anonymous namespace
 
 void ConstantPooling(const std::shared_ptr<Graph>& graph) {
@@ -71,5 +140,82 @@ void ConstantPooling(const std::shared_ptr<Graph>& graph) {
   std::unordered_set<Node*, HashNode, EqualNode> constants;
   ConstantPooling(graph->block(), constants, aliasDb);
 }
+
+void ConsolidateConstantTensors(
+    const std::shared_ptr<Graph>& graph,
+    bool use_hugepages) {
+#ifndef _WIN32
+  std::vector<Node*> order;
+  std::unordered_set<Node*> seen;
+  collectTensorConstants(graph->block(), order, seen);
+
+  // Lay the payloads out back to back, each aligned like a fresh CPU
+  // allocation.
+  std::vector<at::Tensor> payloads;
+  std::vector<size_t> offsets;
+  size_t total = 0;
+  for (Node* node : order) {
+    at::Tensor contig = toIValue(node->output())->toTensor().contiguous();
+    total = (total + kConstantArenaAlignment - 1) / kConstantArenaAlignment *
+        kConstantArenaAlignment;
+    offsets.push_back(total);
+    total += contig.nbytes();
+    payloads.emplace_back(std::move(contig));
+  }
+  if (total == 0) {
+    return;
+  }
+
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const size_t map_size = (total + page_size - 1) / page_size * page_size;
+  void* base = mmap(
+      nullptr,
+      map_size,
+      PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS,
+      -1,
+      0);
+  TORCH_CHECK(
+      base != MAP_FAILED,
+      "ConsolidateConstantTensors: could not map ",
+      map_size,
+      " bytes for the constant arena");
+#ifdef MADV_HUGEPAGE
+  if (use_hugepages) {
+    // Best effort; the kernel may have transparent hugepages disabled.
+    madvise(base, map_size, MADV_HUGEPAGE);
+  }
+#else
+  (void)use_hugepages;
+#endif
+
+  for (const auto i : c10::irange(order.size())) {
+    std::memcpy(
+        static_cast<char*>(base) + offsets[i],
+        payloads[i].data_ptr(),
+        payloads[i].nbytes());
+  }
+  // Seal the arena. A stray in-place write to a frozen weight now faults
+  // instead of silently corrupting every graph sharing the constant, and
+  // the pages stay shared across forked workers.
+  mprotect(base, map_size, PROT_READ);
+
+  auto arena = std::make_shared<ConstantArena>(base, map_size);
+  for (const auto i : c10::irange(order.size())) {
+    const auto& payload = payloads[i];
+    at::Tensor pooled = at::from_blob(
+        static_cast<char*>(base) + offsets[i],
+        payload.sizes(),
+        payload.strides(),
+        [arena](void*) {},
+        payload.options());
+    order[i]->t_(attr::value, std::move(pooled));
+  }
+#else
+  // Needs mmap/mprotect.
+  (void)graph;
+  (void)use_hugepages;
+#endif // _WIN32
+}
 } // namespace jit
 } // namespace torch
@@ -7,5 +7,21 @@ namespace jit {
 
 TORCH_API void ConstantPooling(const std::shared_ptr<Graph>& graph);
 
+// Copies the payloads of all dense CPU tensor constants in the graph into
+// one contiguous read-only arena, laid out in the order execution first
+// touches them, and rewrites the constants to view the arena. Scattered
+// individually-allocated weights (the typical state after freezing) then
+// walk a compact address range instead of the whole heap, and because the
+// arena is sealed with PROT_READ and never written again, forked workers
+// keep sharing its pages. With use_hugepages the arena additionally asks
+// for transparent hugepage backing (best effort).
+//
+// Only safe when the constants are treated as read-only from then on; do
+// not run passes that mutate constant payloads in place afterwards. No-op
+// on platforms without mmap/mprotect.
+TORCH_API void ConsolidateConstantTensors(
+    const std::shared_ptr<Graph>& graph,
+    bool use_hugepages = true);
+
 }
 } // namespace torch
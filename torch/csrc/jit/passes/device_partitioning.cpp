@@ -0,0 +1,298 @@
+#include <torch/csrc/jit/passes/device_partitioning.h>
+
+#include <c10/util/Exception.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+
+#include <sstream>
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Temporary grouping symbol; every group is either unmerged back into the
+// block or rewritten into a prim::fork before the pass returns.
+const Symbol kDeviceAffineGroup =
+    Symbol::fromQualString("prim::DeviceAffineGroup");
+
+// Partitions smaller than this stay inline; a fork + wait round trip is
+// not worth it for a single node.
+constexpr size_t kMinPartitionSize = 2;
+
+class DevicePartitioner {
+ public:
+  explicit DevicePartitioner(std::shared_ptr<Graph> graph)
+      : graph_(std::move(graph)), aliasDb_(graph_) {}
+
+  DeviceScheduleReport run() {
+    buildGroups();
+    return schedule();
+  }
+
+ private:
+  // The device a node's outputs live on, or nullopt if it produces no
+  // tensors or produces tensors on several devices.
+  c10::optional<c10::Device> inferNodeDevice(Node* node) {
+    c10::optional<c10::Device> device;
+    for (Value* output : node->outputs()) {
+      auto tt = output->type()->cast<TensorType>();
+      if (!tt) {
+        continue;
+      }
+      auto d = tt->device();
+      if (!d) {
+        return c10::nullopt;
+      }
+      if (device && *device != *d) {
+        return c10::nullopt;
+      }
+      device = d;
+    }
+    return device;
+  }
+
+  // The device affinity under which `node` may join a partition. Control
+  // flow stays serial, and mutating ops are excluded because a forked
+  // partition's writes would race with the main thread.
+  c10::optional<c10::Device> affinity(Node* node) {
+    if (node->kind() == kDeviceAffineGroup) {
+      return group_devices_.at(node);
+    }
+    if (node->kind() == prim::Constant || !node->blocks().empty() ||
+        node->hasSideEffects() || aliasDb_.isMutable(node)) {
+      return c10::nullopt;
+    }
+    return inferNodeDevice(node);
+  }
+
+  value_list sortReverseTopological(ArrayRef<Value*> inputs) {
+    value_list result;
+    for (auto i : inputs) {
+      if (i->node()->owningBlock() == graph_->block()) {
+        result.push_back(i);
+      }
+    }
+    std::sort(result.begin(), result.end(), [&](Value* a, Value* b) {
+      return a->node()->isAfter(b->node());
+    });
+    return result;
+  }
+
+  c10::optional<Node*> tryMerge(Node* consumer, Node* producer) {
+    AT_ASSERT(consumer->kind() == kDeviceAffineGroup);
+    auto device = affinity(producer);
+    bool can_merge = device && *device == group_devices_.at(consumer) &&
+        aliasDb_.moveBeforeTopologicallyValid(producer, consumer);
+    if (!can_merge) {
+      return c10::nullopt;
+    }
+    SubgraphUtils::mergeNodeIntoSubgraphAndUpdateAliasing(
+        producer, consumer, aliasDb_);
+    return consumer;
+  }
+
+  std::pair<graph_node_list::iterator, bool> scanNode(Node* consumer) {
+    if (affinity(consumer)) {
+      if (consumer->kind() != kDeviceAffineGroup) {
+        auto device = *affinity(consumer);
+        consumer = SubgraphUtils::createSingletonSubgraphAndUpdateAliasing(
+            consumer, kDeviceAffineGroup, aliasDb_);
+        group_devices_.erase(consumer);
+        group_devices_.emplace(consumer, device);
+      }
+      auto inputs = sortReverseTopological(consumer->inputs());
+      for (auto input : inputs) {
+        if (auto group = tryMerge(consumer, input->node())) {
+          // Merging changed the group's inputs; rescan it for further
+          // opportunities.
+          return std::make_pair(group.value()->reverseIterator(), true);
+        }
+      }
+    }
+    return std::make_pair(++consumer->reverseIterator(), false);
+  }
+
+  void buildGroups() {
+    // moveBeforeTopologicallyValid can reorder nodes to after the
+    // iteration point, so rescan until no merge fires (see the analogous
+    // loop in create_autodiff_subgraphs.cpp).
+    Block* block = graph_->block();
+    bool any_changed = true;
+    while (any_changed) {
+      any_changed = false;
+      for (auto it = block->nodes().rbegin(); it != block->nodes().rend();) {
+        bool changed = false;
+        std::tie(it, changed) = scanNode(*it);
+        any_changed |= changed;
+      }
+    }
+  }
+
+  size_t groupSize(Node* group) {
+    size_t size = 0;
+    for (Node* n : SubgraphUtils::getSubgraph(group)->nodes()) {
+      size += !n->notExecutedOp();
+    }
+    return size;
+  }
+
+  // Rewrites `group` into prim::fork + aten::wait. The fork keeps the
+  // group's position; the wait is placed just before the earliest
+  // external consumer so everything in between overlaps with the forked
+  // partition.
+  void forkGroup(Node* group, c10::Device device) {
+    Graph* graph = group->owningGraph();
+    std::shared_ptr<Graph> subgraph = SubgraphUtils::getSubgraph(group);
+
+    // Make cross-device inputs explicit transfers, visible in the
+    // schedule instead of buried inside the first consumer op.
+    {
+      WithInsertPoint guard(group);
+      for (size_t i = 0; i < group->inputs().size(); ++i) {
+        Value* input = group->input(i);
+        auto tt = input->type()->cast<TensorType>();
+        if (!tt || !tt->device() || *tt->device() == device) {
+          continue;
+        }
+        Value* moved = graph->insert(
+            aten::to, {input, graph->insertConstant(device)});
+        moved->setType(tt->withDevice(device));
+        group->replaceInput(i, moved);
+        subgraph->inputs().at(i)->setType(tt->withDevice(device));
+      }
+    }
+
+    // prim::fork subgraphs return a single value; bundle multiple
+    // outputs into a tuple and unpack after the join.
+    const bool needs_tuple = subgraph->outputs().size() != 1;
+    TypePtr payload_type;
+    if (needs_tuple) {
+      std::vector<Value*> outputs = subgraph->outputs().vec();
+      Node* tuple = subgraph->appendNode(subgraph->createTuple(outputs));
+      for (size_t i = outputs.size(); i > 0; --i) {
+        subgraph->eraseOutput(i - 1);
+      }
+      subgraph->registerOutput(tuple->output());
+      payload_type = tuple->output()->type();
+    } else {
+      payload_type = subgraph->outputs().at(0)->type();
+    }
+
+    Node* fork = graph->create(prim::fork, 1)->insertBefore(group);
+    for (Value* input : group->inputs()) {
+      fork->addInput(input);
+    }
+    fork->g_(attr::Subgraph, subgraph);
+    fork->output()->setType(FutureType::create(payload_type));
+
+    // Join as late as possible: right before the first consumer of any
+    // partition output (uses in nested blocks join before their owning
+    // top-level node).
+    Node* first_use = nullptr;
+    for (Value* output : group->outputs()) {
+      for (const Use& use : output->uses()) {
+        Node* user = use.user;
+        while (user->owningBlock() != graph->block()) {
+          user = user->owningBlock()->owningNode();
+        }
+        if (!first_use || user->isBefore(first_use)) {
+          first_use = user;
+        }
+      }
+    }
+    WithInsertPoint guard(first_use ? first_use : graph->return_node());
+    Value* waited = graph->insert(aten::wait, {fork->output()});
+    if (needs_tuple) {
+      Node* unpack = graph->insertNode(graph->createTupleUnpack(waited));
+      for (size_t i = 0; i < group->outputs().size(); ++i) {
+        group->output(i)->replaceAllUsesWith(unpack->output(i));
+      }
+    } else {
+      group->output(0)->replaceAllUsesWith(waited);
+    }
+    group->destroy();
+  }
+
+  DeviceScheduleReport schedule() {
+    DeviceScheduleReport report;
+
+    std::vector<Node*> groups;
+    for (Node* node : graph_->block()->nodes()) {
+      if (node->kind() == kDeviceAffineGroup) {
+        groups.push_back(node);
+      } else {
+        report.unpartitioned_nodes += !node->notExecutedOp();
+      }
+    }
+
+    // The device carrying the most partitioned work stays inline on the
+    // calling thread; everything else is forked to overlap with it.
+    std::unordered_map<c10::Device, size_t> device_load;
+    for (Node* group : groups) {
+      device_load[group_devices_.at(group)] += groupSize(group);
+    }
+    c10::optional<c10::Device> primary;
+    for (const auto& entry : device_load) {
+      if (!primary || entry.second > device_load.at(*primary)) {
+        primary = entry.first;
+      }
+    }
+
+    for (Node* group : groups) {
+      c10::Device device = group_devices_.at(group);
+      size_t size = groupSize(group);
+      if (size < kMinPartitionSize || group->outputs().empty()) {
+        report.unpartitioned_nodes += size;
+        SubgraphUtils::unmergeSubgraph(group);
+        continue;
+      }
+      // Forking is only profitable against work on another device, and
+      // is unsafe if the main thread could write a partition input while
+      // the fork reads it.
+      bool fork_it = device_load.size() > 1 && device != *primary;
+      for (Value* input : group->inputs()) {
+        fork_it = fork_it && !aliasDb_.hasWriters(input);
+      }
+      report.partitions.push_back(DevicePartition{device, size, fork_it});
+      if (fork_it) {
+        forkGroup(group, device);
+      } else {
+        SubgraphUtils::unmergeSubgraph(group);
+      }
+    }
+
+    GRAPH_DEBUG("After PartitionDeviceSubgraphs\n", *graph_);
+    return report;
+  }
+
+  std::shared_ptr<Graph> graph_;
+  AliasDb aliasDb_;
+  std::unordered_map<Node*, c10::Device> group_devices_;
+};
+
+} // namespace
+
+std::string DeviceScheduleReport::str() const {
+  std::ostringstream oss;
+  size_t forked = 0;
+  for (const auto i : c10::irange(partitions.size())) {
+    const DevicePartition& p = partitions[i];
+    oss << "partition " << i << ": device " << p.device << ", "
+        << p.num_nodes << " node(s), " << (p.forked ? "forked" : "inline")
+        << "\n";
+    forked += p.forked;
+  }
+  oss << "unpartitioned node(s): " << unpartitioned_nodes << "\n";
+  oss << forked << " partition(s) overlap with the inline schedule\n";
+  return oss.str();
+}
+
+DeviceScheduleReport PartitionDeviceSubgraphs(std::shared_ptr<Graph>& graph) {
+  return DevicePartitioner(graph).run();
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// One device-affine partition discovered by PartitionDeviceSubgraphs.
+struct DevicePartition {
+  c10::Device device;
+  // Executable nodes captured by the partition.
+  size_t num_nodes;
+  // True if the partition was rewritten into a prim::fork subgraph and
+  // runs concurrently on the inter-op pool; false if it stays inline.
+  bool forked;
+};
+
+// Schedule report returned by PartitionDeviceSubgraphs, describing the
+// overlap the pass discovered.
+struct TORCH_API DeviceScheduleReport {
+  std::vector<DevicePartition> partitions;
+  // Top-level executable nodes that did not join any partition (unknown
+  // or mixed device, mutation, control flow).
+  size_t unpartitioned_nodes = 0;
+  std::string str() const;
+};
+
+// Splits the top-level block into device-affine subgraphs and rewrites
+// partitions off the dominant device into prim::fork subgraphs joined by
+// aten::wait, so disjoint towers targeting different devices execute
+// concurrently on the inter-op pool. Cross-device partition inputs get
+// explicit aten::to transfer nodes, and the aten::wait join is placed
+// just before the first consumer so the main thread keeps executing the
+// dominant-device partition in the meantime.
+//
+// Expects device-annotated tensor types (profiled or frozen graphs);
+// nodes without a consistent device, mutating ops and control flow stay
+// on the serial path. Runs as a no-op on single-device graphs.
+TORCH_API DeviceScheduleReport PartitionDeviceSubgraphs(
+    std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,452 @@
+#include <torch/csrc/jit/passes/fold_view_chains.h>
+
+#include <ATen/InferSize.h>
+#include <ATen/TensorUtils.h>
+#include <c10/core/WrapDimMinimal.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+
+#include <unordered_set>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Strided view of the base tensor, tracked symbolically while walking a
+// chain. `offset` is relative to the base tensor's own storage offset.
+struct ViewState {
+  std::vector<int64_t> sizes;
+  std::vector<int64_t> strides;
+  int64_t offset = 0;
+
+  int64_t dim() const {
+    return static_cast<int64_t>(sizes.size());
+  }
+
+  int64_t numel() const {
+    int64_t n = 1;
+    for (auto size : sizes) {
+      n *= size;
+    }
+    return n;
+  }
+};
+
+c10::optional<int64_t> constInt(Value* value) {
+  auto ivalue = toIValue(value);
+  if (ivalue && ivalue->isInt()) {
+    return ivalue->toInt();
+  }
+  return c10::nullopt;
+}
+
+c10::optional<std::vector<int64_t>> constIntList(Value* value) {
+  auto ivalue = toIValue(value);
+  if (ivalue && ivalue->isIntList()) {
+    return ivalue->toIntVector();
+  }
+  return c10::nullopt;
+}
+
+bool wrapDim(int64_t& dim, int64_t ndim) {
+  if (dim < -ndim || dim >= std::max<int64_t>(ndim, 1)) {
+    return false;
+  }
+  if (dim < 0) {
+    dim += ndim;
+  }
+  return true;
+}
+
+bool applySlice(Node* node, ViewState& state) {
+  auto dim = constInt(node->input(1));
+  auto step = constInt(node->input(4));
+  if (!dim || !wrapDim(*dim, state.dim()) || !step || *step <= 0) {
+    return false;
+  }
+  const auto size = state.sizes[*dim];
+  auto start_ivalue = toIValue(node->input(2));
+  auto end_ivalue = toIValue(node->input(3));
+  if (!start_ivalue || !end_ivalue) {
+    return false;
+  }
+  int64_t start = start_ivalue->isNone() ? 0 : start_ivalue->toInt();
+  int64_t end = end_ivalue->isNone() ? size : end_ivalue->toInt();
+  if (start < 0) {
+    start += size;
+  }
+  if (end < 0) {
+    end += size;
+  }
+  start = std::min(std::max<int64_t>(start, 0), size);
+  end = std::min(std::max<int64_t>(end, start), size);
+  state.offset += start * state.strides[*dim];
+  state.sizes[*dim] = (end - start + *step - 1) / *step;
+  state.strides[*dim] *= *step;
+  return true;
+}
+
+bool applySelect(Node* node, ViewState& state) {
+  auto dim = constInt(node->input(1));
+  auto index = constInt(node->input(2));
+  if (!dim || !wrapDim(*dim, state.dim()) || !index || state.dim() == 0) {
+    return false;
+  }
+  const auto size = state.sizes[*dim];
+  if (*index < -size || *index >= size) {
+    return false;
+  }
+  if (*index < 0) {
+    *index += size;
+  }
+  state.offset += *index * state.strides[*dim];
+  state.sizes.erase(state.sizes.begin() + *dim);
+  state.strides.erase(state.strides.begin() + *dim);
+  return true;
+}
+
+bool applyTranspose(Node* node, ViewState& state) {
+  auto dim0 = constInt(node->input(1));
+  auto dim1 = constInt(node->input(2));
+  if (!dim0 || !dim1 || !wrapDim(*dim0, state.dim()) ||
+      !wrapDim(*dim1, state.dim())) {
+    return false;
+  }
+  std::swap(state.sizes[*dim0], state.sizes[*dim1]);
+  std::swap(state.strides[*dim0], state.strides[*dim1]);
+  return true;
+}
+
+bool applyT(ViewState& state) {
+  if (state.dim() > 2) {
+    return false;
+  }
+  if (state.dim() == 2) {
+    std::swap(state.sizes[0], state.sizes[1]);
+    std::swap(state.strides[0], state.strides[1]);
+  }
+  return true;
+}
+
+bool applyPermute(Node* node, ViewState& state) {
+  auto dims = constIntList(node->input(1));
+  if (!dims || static_cast<int64_t>(dims->size()) != state.dim()) {
+    return false;
+  }
+  std::vector<bool> seen(dims->size(), false);
+  ViewState permuted = state;
+  for (const auto i : c10::irange(dims->size())) {
+    auto dim = (*dims)[i];
+    if (!wrapDim(dim, state.dim()) || seen[dim]) {
+      return false;
+    }
+    seen[dim] = true;
+    permuted.sizes[i] = state.sizes[dim];
+    permuted.strides[i] = state.strides[dim];
+  }
+  state = std::move(permuted);
+  return true;
+}
+
+bool applyUnsqueeze(Node* node, ViewState& state) {
+  auto dim = constInt(node->input(1));
+  if (!dim || !wrapDim(*dim, state.dim() + 1)) {
+    return false;
+  }
+  const auto new_stride = *dim >= state.dim()
+      ? 1
+      : state.sizes[*dim] * state.strides[*dim];
+  state.sizes.insert(state.sizes.begin() + *dim, 1);
+  state.strides.insert(state.strides.begin() + *dim, new_stride);
+  return true;
+}
+
+bool applySqueezeDim(Node* node, ViewState& state) {
+  auto dim = constInt(node->input(1));
+  if (!dim || !wrapDim(*dim, state.dim())) {
+    return false;
+  }
+  if (state.dim() > 0 && state.sizes[*dim] == 1) {
+    state.sizes.erase(state.sizes.begin() + *dim);
+    state.strides.erase(state.strides.begin() + *dim);
+  }
+  return true;
+}
+
+bool applySqueeze(ViewState& state) {
+  ViewState squeezed;
+  squeezed.offset = state.offset;
+  for (const auto i : c10::irange(state.sizes.size())) {
+    if (state.sizes[i] != 1) {
+      squeezed.sizes.push_back(state.sizes[i]);
+      squeezed.strides.push_back(state.strides[i]);
+    }
+  }
+  state = std::move(squeezed);
+  return true;
+}
+
+bool applyNarrow(Node* node, ViewState& state) {
+  auto dim = constInt(node->input(1));
+  auto start = constInt(node->input(2));
+  auto length = constInt(node->input(3));
+  if (!dim || !wrapDim(*dim, state.dim()) || !start || !length ||
+      *length < 0) {
+    return false;
+  }
+  const auto size = state.sizes[*dim];
+  if (*start < 0) {
+    *start += size;
+  }
+  if (*start < 0 || *start + *length > size) {
+    return false;
+  }
+  state.offset += *start * state.strides[*dim];
+  state.sizes[*dim] = *length;
+  return true;
+}
+
+bool applyView(Node* node, ViewState& state) {
+  auto shape = constIntList(node->input(1));
+  if (!shape) {
+    return false;
+  }
+  auto sizes = at::infer_size(*shape, state.numel());
+  auto strides = at::detail::computeStride(
+      c10::IntArrayRef(state.sizes), c10::IntArrayRef(state.strides), sizes);
+  if (!strides) {
+    return false;
+  }
+  state.sizes = std::move(sizes);
+  state.strides = std::move(*strides);
+  return true;
+}
+
+bool applyExpand(Node* node, ViewState& state) {
+  auto shape = constIntList(node->input(1));
+  if (!shape || static_cast<int64_t>(shape->size()) < state.dim()) {
+    return false;
+  }
+  const auto leading = static_cast<int64_t>(shape->size()) - state.dim();
+  ViewState expanded;
+  expanded.offset = state.offset;
+  for (const auto i : c10::irange(static_cast<int64_t>(shape->size()))) {
+    auto target = (*shape)[i];
+    if (i < leading) {
+      if (target < 0) {
+        return false;
+      }
+      expanded.sizes.push_back(target);
+      expanded.strides.push_back(0);
+      continue;
+    }
+    const auto size = state.sizes[i - leading];
+    const auto stride = state.strides[i - leading];
+    if (target == -1 || target == size) {
+      expanded.sizes.push_back(size);
+      expanded.strides.push_back(stride);
+    } else if (size == 1 && target >= 0) {
+      expanded.sizes.push_back(target);
+      expanded.strides.push_back(0);
+    } else {
+      return false;
+    }
+  }
+  state = std::move(expanded);
+  return true;
+}
+
+// Applies `node` to `state` if it is a view op this pass understands with
+// constant arguments. aten::reshape is deliberately absent: it copies when
+// the result is not expressible as a view, so folding it would change
+// aliasing semantics.
+bool applyViewOp(Node* node, ViewState& state) {
+  if (node->matches(
+          "aten::slice.Tensor(Tensor(a) self, int dim=0, int? start=None, int? end=None, int step=1) -> Tensor(a)")) {
+    return applySlice(node, state);
+  }
+  if (node->matches(
+          "aten::select.int(Tensor(a) self, int dim, int index) -> Tensor(a)")) {
+    return applySelect(node, state);
+  }
+  if (node->matches(
+          "aten::transpose.int(Tensor(a) self, int dim0, int dim1) -> Tensor(a)")) {
+    return applyTranspose(node, state);
+  }
+  if (node->matches("aten::t(Tensor(a) self) -> Tensor(a)")) {
+    return applyT(state);
+  }
+  if (node->matches(
+          "aten::permute(Tensor(a) self, int[] dims) -> Tensor(a)")) {
+    return applyPermute(node, state);
+  }
+  if (node->matches("aten::unsqueeze(Tensor(a) self, int dim) -> Tensor(a)")) {
+    return applyUnsqueeze(node, state);
+  }
+  if (node->matches(
+          "aten::squeeze.dim(Tensor(a) self, int dim) -> Tensor(a)")) {
+    return applySqueezeDim(node, state);
+  }
+  if (node->matches("aten::squeeze(Tensor(a) self) -> Tensor(a)")) {
+    return applySqueeze(state);
+  }
+  if (node->matches(
+          "aten::narrow(Tensor(a) self, int dim, int start, int length) -> Tensor(a)")) {
+    return applyNarrow(node, state);
+  }
+  if (node->matches("aten::view(Tensor(a) self, int[] size) -> Tensor(a)")) {
+    return applyView(node, state);
+  }
+  if (node->matches(
+          "aten::expand(Tensor(a) self, int[] size, *, bool implicit=False) -> Tensor(a)")) {
+    return applyExpand(node, state);
+  }
+  return false;
+}
+
+c10::optional<ViewState> baseState(Value* value) {
+  auto type = value->type()->cast<TensorType>();
+  if (!type) {
+    return c10::nullopt;
+  }
+  auto sizes = type->sizes().concrete_sizes();
+  auto strides = type->strides().concrete_sizes();
+  if (!sizes || !strides) {
+    return c10::nullopt;
+  }
+  ViewState state;
+  state.sizes = std::move(*sizes);
+  state.strides = std::move(*strides);
+  return state;
+}
+
+struct ViewChainFolder {
+  explicit ViewChainFolder(std::shared_ptr<Graph> graph)
+      : graph_(std::move(graph)), alias_db_(graph_) {}
+
+  bool run() {
+    bool changed = processBlock(graph_->block());
+    if (changed) {
+      EliminateDeadCode(graph_);
+    }
+    return changed;
+  }
+
+ private:
+  bool processBlock(Block* block) {
+    bool changed = false;
+    for (auto* node : block->nodes()) {
+      for (auto* sub_block : node->blocks()) {
+        changed |= processBlock(sub_block);
+      }
+      changed |= tryFoldChainAt(node);
+    }
+    return changed;
+  }
+
+  // Greedily follows the longest chain of foldable view ops rooted at
+  // `node` and replaces it with one as_strided. Intermediates must be
+  // single-use (they die with the chain) and nothing in the chain may
+  // have writers, since a resize_ of the base would invalidate the
+  // precomputed geometry.
+  bool tryFoldChainAt(Node* node) {
+    if (folded_.count(node) != 0) {
+      return false;
+    }
+    Value* base = node->inputs().empty() ? nullptr : node->input(0);
+    if (base == nullptr || alias_db_.hasWriters(base)) {
+      return false;
+    }
+    auto state = baseState(base);
+    if (!state || !applyViewOp(node, *state)) {
+      return false;
+    }
+
+    Node* last = node;
+    size_t chain_length = 1;
+    while (true) {
+      Value* output = last->output();
+      if (output->uses().size() != 1 || alias_db_.hasWriters(output)) {
+        break;
+      }
+      Node* next = output->uses()[0].user;
+      if (next->owningBlock() != node->owningBlock() ||
+          next->inputs().empty() || next->input(0) != output) {
+        break;
+      }
+      ViewState next_state = *state;
+      if (!applyViewOp(next, next_state)) {
+        break;
+      }
+      *state = std::move(next_state);
+      last = next;
+      chain_length++;
+    }
+    if (chain_length < 2 || alias_db_.hasWriters(last->output())) {
+      return false;
+    }
+
+    WithInsertPoint insert_guard(last);
+    Value* offset_value = nullptr;
+    if (state->offset != 0) {
+      // as_strided takes an absolute storage offset; add the statically
+      // known delta to whatever offset the base happens to have.
+      Value* base_offset = graph_->insert(
+          Symbol::fromQualString("aten::storage_offset"), {base});
+      offset_value = graph_->insert(
+          aten::add, {base_offset, graph_->insertConstant(state->offset)});
+    } else {
+      offset_value = graph_->insertConstant(IValue());
+    }
+    Value* folded = graph_->insert(
+        aten::as_strided,
+        {base,
+         graph_->insertConstant(state->sizes),
+         graph_->insertConstant(state->strides),
+         offset_value});
+    folded->setType(last->output()->type());
+    last->output()->replaceAllUsesWith(folded);
+
+    GRAPH_UPDATE(
+        "Folded view chain of length ",
+        chain_length,
+        " rooted at ",
+        getHeader(node),
+        " into ",
+        getHeader(folded->node()));
+
+    // The replaced nodes are now dead; remember them so we do not try to
+    // fold a sub-chain of an already folded chain.
+    for (Node* n = node;; n = n->output()->uses().empty()
+             ? nullptr
+             : n->output()->uses()[0].user) {
+      if (n == nullptr) {
+        break;
+      }
+      folded_.insert(n);
+      if (n == last) {
+        break;
+      }
+    }
+    return true;
+  }
+
+  std::shared_ptr<Graph> graph_;
+  AliasDb alias_db_;
+  std::unordered_set<Node*> folded_;
+};
+
+} // namespace
+
+bool FoldViewChains(const std::shared_ptr<Graph>& graph) {
+  ViewChainFolder folder(graph);
+  bool changed = folder.run();
+  GRAPH_DUMP("After FoldViewChains: ", graph);
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Folds static view chains (slice/select/permute/view/...) whose base
+// tensor has complete shape information and whose arguments are constant
+// into a single aten::as_strided with precomputed sizes, strides and
+// storage offset. Intended for shape-specialized inference graphs, where
+// it removes the intermediate TensorImpl allocation done by every link of
+// the chain. Returns true if the graph was modified.
+TORCH_API bool FoldViewChains(const std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
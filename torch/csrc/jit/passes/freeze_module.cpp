@@ -133,6 +133,14 @@ class AttributePropagator {
     }
     GRAPH_DEBUG("Cleaning up module");
     cleanupFrozenModule();
+    if (tensorsDeduplicated_ > 0) {
+      GRAPH_UPDATE(
+          "Interned ",
+          tensorsDeduplicated_,
+          " duplicate weight tensor(s) while freezing; ",
+          bytesDeduplicated_,
+          " bytes deduplicated");
+    }
   }
 
  private:
@@ -408,6 +416,35 @@ class AttributePropagator {
     return attr;
   }
 
+  // Interns tensors by storage identity. Two attributes that view the same
+  // storage with identical metadata (dtype, sizes, strides, offset) fold to
+  // one shared TensorImpl, so constants created from them in different
+  // methods or submodules all reference a single tensor. Without this, each
+  // method freezing a shared weight gets its own TensorImpl (e.g. from the
+  // per-method detach in overrideGradient), and downstream passes that copy
+  // or serialize per-constant multiply the footprint by the method count.
+  at::Tensor internTensor(const at::Tensor& t) {
+    if (!t.has_storage()) {
+      return t;
+    }
+    auto& candidates = tensorMemo_[t.storage().unsafeGetStorageImpl()];
+    for (auto& candidate : candidates) {
+      if (candidate.unsafeGetTensorImpl() == t.unsafeGetTensorImpl()) {
+        return candidate;
+      }
+      if (candidate.dtype() == t.dtype() &&
+          candidate.storage_offset() == t.storage_offset() &&
+          candidate.sizes().equals(t.sizes()) &&
+          candidate.strides().equals(t.strides())) {
+        tensorsDeduplicated_++;
+        bytesDeduplicated_ += t.nbytes();
+        return candidate;
+      }
+    }
+    candidates.push_back(t);
+    return t;
+  }
+
   // This method is invoked only when 'freezeInterfaces' parameter is on.
   // The module associated with Interface is retrieved and the invoked method
   // is inlined.
@@ -478,6 +515,10 @@ class AttributePropagator {
   void propagateAttributes(std::shared_ptr<Graph>& graph) {
     std::unordered_map<ModulePtr, std::unordered_map<std::string, Value*>>
         attrValues;
+    // Constant pool for this graph: interned tensors that were already
+    // materialized as constants, so attributes folding to the same tensor
+    // share one prim::Constant regardless of their owning module.
+    std::unordered_map<at::TensorImpl*, Value*> tensorValues;
     auto isEval = !module_.hasattr("training") || !module_.is_training();
     GRAPH_DEBUG("Freezing Module: ", module_.type()->name()->name());
     auto block = graph->block();
@@ -543,21 +584,35 @@ class AttributePropagator {
                 attr = weak_class_obj;
               }
             }
-            if (auto attrVal = tryInsertConstant(*graph, attr)) {
-              paramConst = *attrVal;
-            } else {
-              GRAPH_DEBUG(
-                  attr.type()->cast<ClassType>() ? "" : "attribute: ",
-                  name,
-                  " is not materializable.");
-              continue;
+            if (attr.isTensor()) {
+              attr = internTensor(attr.toTensor());
+              auto pooled =
+                  tensorValues.find(attr.toTensor().unsafeGetTensorImpl());
+              if (pooled != tensorValues.end()) {
+                paramConst = pooled->second;
+              }
             }
-            std::string fullName("self.");
-            for (auto& name : names_) {
-              fullName += name + '.';
+            if (!paramConst) {
+              if (auto attrVal = tryInsertConstant(*graph, attr)) {
+                paramConst = *attrVal;
+              } else {
+                GRAPH_DEBUG(
+                    attr.type()->cast<ClassType>() ? "" : "attribute: ",
+                    name,
+                    " is not materializable.");
+                continue;
+              }
+              std::string fullName("self.");
+              for (auto& name : names_) {
+                fullName += name + '.';
+              }
+              fullName += name;
+              paramConst->setDebugName(fullName);
+              if (attr.isTensor()) {
+                tensorValues[attr.toTensor().unsafeGetTensorImpl()] =
+                    paramConst;
+              }
             }
-            fullName += name;
-            paramConst->setDebugName(fullName);
             attrValues[attrModule._ivalue()][name] = paramConst;
           }
           GRAPH_UPDATE(
@@ -857,6 +912,13 @@ class AttributePropagator {
   std::unordered_map<ModulePtr, std::unordered_set<std::string>>
       userPreservedAttrs_;
 
+  // Canonical tensors keyed by their storage, shared across all frozen
+  // methods. See internTensor.
+  std::unordered_map<const c10::StorageImpl*, std::vector<at::Tensor>>
+      tensorMemo_;
+  size_t tensorsDeduplicated_ = 0;
+  size_t bytesDeduplicated_ = 0;
+
 }; // class AttributePropagator
 
 void checkModuleDoesNotReturnSelf(const Module& module) {
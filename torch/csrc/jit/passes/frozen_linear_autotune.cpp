@@ -0,0 +1,252 @@
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/passes/frozen_linear_autotune.h>
+#include <torch/csrc/jit/passes/utils/optimization_utils.h>
+#include <torch/csrc/jit/runtime/graph_iterator.h>
+
+#include <ATen/Config.h>
+#include <c10/util/StringUtil.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/add.h>
+#include <ATen/ops/linear.h>
+#include <ATen/ops/matmul.h>
+#include <ATen/ops/mkldnn_linear.h>
+#include <ATen/ops/rand.h>
+#include <ATen/ops/transpose.h>
+#endif
+
+#include <chrono>
+#include <limits>
+
+namespace torch {
+namespace jit {
+namespace {
+
+using Tensor = at::Tensor;
+
+// Runs per candidate layout. The minimum over the timed runs is compared, so
+// a one-off scheduling hiccup cannot flip the choice.
+constexpr int kWarmupRuns = 2;
+constexpr int kTimedRuns = 5;
+
+double benchmarkMicros(const std::function<Tensor()>& fn) {
+  for (int i = 0; i < kWarmupRuns; ++i) {
+    fn();
+  }
+  double best = std::numeric_limits<double>::max();
+  for (int i = 0; i < kTimedRuns; ++i) {
+    auto begin = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::micro>(end - begin).count());
+  }
+  return best;
+}
+
+class AutotuneFrozenLinear {
+ public:
+  AutotuneFrozenLinear(
+      std::shared_ptr<Graph> graph,
+      std::vector<std::string>* choices)
+      : graph_(std::move(graph)), choices_(choices) {}
+
+  bool run() {
+    // Can't delete nodes while also iterating over it
+    DepthFirstGraphNodeIterator graph_it(graph_);
+
+    for (auto next_node = graph_it.next(); next_node != nullptr;) {
+      Node* node = next_node;
+      next_node = graph_it.next();
+
+      if (is_constant_linear_op(node)) {
+        autotune_linear(node);
+      }
+    }
+    return graph_modified_;
+  }
+
+  bool is_constant_linear_op(Node* node) {
+    if (node->kind() != aten::linear) {
+      return false;
+    }
+    return !nonConstantParameters(node);
+  }
+
+  // The activation shape seen at optimization time, if the graph recorded one
+  // we can time against: non-empty, fully concrete, and consistent with the
+  // weight's reduction dimension. Only float32 CPU linears qualify; for other
+  // devices and dtypes wall-clock timing on synthesized inputs would not be
+  // representative, so those ops keep the default layout.
+  c10::optional<std::vector<int64_t>> concrete_activation_sizes(
+      Node* node,
+      const Tensor& weight) {
+    if (!weight.device().is_cpu() || weight.ndimension() != 2 ||
+        weight.dtype() != c10::ScalarType::Float) {
+      return c10::nullopt;
+    }
+    auto type = node->inputs()[0]->type()->cast<TensorType>();
+    if (!type) {
+      return c10::nullopt;
+    }
+    auto sizes = type->sizes().concrete_sizes();
+    if (!sizes || sizes->empty() || sizes->back() != weight.size(1)) {
+      return c10::nullopt;
+    }
+    return sizes;
+  }
+
+  void autotune_linear(Node* node) {
+    Tensor weight = constant_as<Tensor>(node->namedInput("weight")).value();
+    auto input_sizes = concrete_activation_sizes(node, weight);
+    if (!input_sizes) {
+      // Nothing to measure; keep the transposed-matmul form that
+      // FrozenLinearTranspose has always produced for these ops.
+      record(node, weight, "transposed (no activation shape)");
+      replace_with_transposed_matmul(node);
+      return;
+    }
+
+    c10::optional<Tensor> bias;
+    if (node->namedInput("bias")->type() != NoneType::get()) {
+      bias = constant_as<Tensor>(node->namedInput("bias")).value();
+    }
+
+    Tensor input = at::rand(*input_sizes, weight.options());
+    Tensor weight_t =
+        at::transpose(weight, 1, 0).clone(at::MemoryFormat::Contiguous);
+
+    double plain_us =
+        benchmarkMicros([&]() { return at::linear(input, weight, bias); });
+    double transposed_us = benchmarkMicros([&]() {
+      Tensor out = at::matmul(input, weight_t);
+      return bias ? at::add(out, *bias) : out;
+    });
+
+    double mkldnn_us = std::numeric_limits<double>::max();
+#if AT_MKLDNN_ENABLED()
+    Tensor weight_mkldnn = weight.to_mkldnn();
+    mkldnn_us = benchmarkMicros([&]() {
+      return at::mkldnn_linear(input.to_mkldnn(), weight_mkldnn, bias)
+          .to_dense();
+    });
+#endif
+
+    if (mkldnn_us < plain_us && mkldnn_us < transposed_us) {
+#if AT_MKLDNN_ENABLED()
+      record(node, weight, "mkldnn");
+      replace_with_mkldnn_linear(node, weight_mkldnn);
+#endif
+    } else if (transposed_us < plain_us) {
+      record(node, weight, "transposed");
+      replace_with_transposed_matmul(node);
+    } else {
+      record(node, weight, "plain");
+    }
+  }
+
+  void replace_with_transposed_matmul(Node* node) {
+    graph_modified_ = true;
+    Node* matmul = nullptr;
+
+    {
+      WithInsertPoint insert_guard(node);
+      Tensor weight_tensor =
+          constant_as<Tensor>(node->namedInput("weight")).value();
+      Tensor weight_t_tensor = at::transpose(weight_tensor, 1, 0)
+                                   .clone(at::MemoryFormat::Contiguous);
+      Value* weight_t = graph_->insertConstant(weight_t_tensor);
+      matmul = graph_->create(aten::matmul, {node->inputs()[0], weight_t});
+      matmul->insertAfter(node);
+    }
+
+    WithInsertPoint insert_guard(matmul);
+    auto bias = node->namedInput("bias");
+    if (bias->type() == NoneType::get()) {
+      node->replaceAllUsesWith(matmul);
+    } else {
+      Value* bias_scale = graph_->insertConstant(1);
+      Node* bias_result =
+          graph_->create(aten::add, {matmul->output(), bias, bias_scale});
+      bias_result->insertAfter(matmul);
+      node->replaceAllUsesWith(bias_result);
+    }
+    node->destroy();
+  }
+
+#if AT_MKLDNN_ENABLED()
+  // Rewrites the linear into to_mkldnn -> mkldnn_linear -> to_dense, with the
+  // weight stored as a prim::ConstantMKLDNNTensor in the oneDNN blocked
+  // format, matching the shape ConvertFrozenOpsToMKLDNN gives the ops it
+  // claims itself.
+  void replace_with_mkldnn_linear(Node* node, const Tensor& weight_mkldnn) {
+    graph_modified_ = true;
+    WithInsertPoint insert_guard(node);
+
+    Value* none_value = graph_->insertConstant(IValue());
+    Node* weight_op = graph_->create(prim::ConstantMKLDNNTensor);
+    weight_op->t_(attr::value, weight_mkldnn);
+    weight_op->insertBefore(node);
+    weight_op->output()->setDebugName(
+        node->namedInput("weight")->debugName() + "_mkldnn");
+
+    Node* to_mkldnn = graph_->create(
+        c10::Symbol::fromQualString("aten::to_mkldnn"),
+        {node->inputs()[0], none_value});
+    to_mkldnn->insertBefore(node);
+
+    Node* linear = graph_->create(
+        c10::Symbol::fromQualString("aten::mkldnn_linear"),
+        {to_mkldnn->output(), weight_op->output(), node->namedInput("bias")});
+    linear->insertBefore(node);
+
+    Node* to_dense = graph_->create(
+        c10::Symbol::fromQualString("aten::to_dense"),
+        {linear->output(), none_value});
+    to_dense->insertBefore(node);
+
+    node->replaceAllUsesWith(to_dense);
+    node->destroy();
+  }
+#endif
+
+  void record(Node* node, const Tensor& weight, const char* choice) {
+    GRAPH_DEBUG(
+        "FrozenLinearAutotune: ",
+        node->output()->debugName(),
+        " -> ",
+        choice);
+    if (choices_ != nullptr) {
+      choices_->push_back(c10::str(
+          node->output()->debugName(),
+          ": weight ",
+          weight.sizes(),
+          " -> ",
+          choice));
+    }
+  }
+
+ private:
+  std::shared_ptr<Graph> graph_;
+  std::vector<std::string>* choices_;
+  bool graph_modified_ = false;
+};
+} // namespace
+
+TORCH_API bool FrozenLinearAutotune(
+    std::shared_ptr<Graph>& graph,
+    std::vector<std::string>* choices) {
+  AutotuneFrozenLinear autotune(graph, choices);
+  GRAPH_DUMP("Before FrozenLinearAutotune", graph);
+  bool changed = autotune.run();
+  if (changed) {
+    GRAPH_DUMP("After FrozenLinearAutotune", graph);
+  }
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Picks the fastest weight layout for each frozen linear op by timing the
+// candidate kernels (plain aten::linear, matmul against a pre-transposed
+// weight, and the oneDNN blocked format when mkldnn is built) on the
+// activation shape recorded in the graph, then rewrites the op to use the
+// winner. Linears whose activation shape is unknown, or which do not run in
+// float on CPU, keep the pre-transposed matmul form that FrozenLinearTranspose
+// would produce. One human-readable entry per linear is appended to `choices`
+// (when given) so callers can record which layout was picked.
+// This pass only works on frozen graphs.
+TORCH_API bool FrozenLinearAutotune(
+    std::shared_ptr<Graph>& graph,
+    std::vector<std::string>* choices = nullptr);
+
+} // namespace jit
+} // namespace torch
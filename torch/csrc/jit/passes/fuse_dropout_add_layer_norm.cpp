@@ -0,0 +1,53 @@
+#include <torch/csrc/jit/passes/fuse_dropout_add_layer_norm.h>
+#include <torch/csrc/jit/passes/quantization/helper.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// The rewriter deletes the matched nodes, so the intermediate dropout and add
+// results must not be used outside the chain.
+bool intermediates_have_single_use(
+    const Match& match,
+    const std::unordered_map<std::string, Value*>& vmap) {
+  const auto& match_vmap = match.values_map;
+  return match_vmap.at(vmap.at("a"))->uses().size() == 1 &&
+      match_vmap.at(vmap.at("x"))->uses().size() == 1;
+}
+
+} // namespace
+
+void FuseDropoutAddLayerNorm(std::shared_ptr<Graph>& graph) {
+  std::string dropout_add_ln_pattern = R"IR(
+    graph(%input, %residual, %p, %train, %alpha, %shape, %w, %b, %eps, %cudnn):
+        %a = aten::dropout(%input, %p, %train)
+        %x = aten::add(%a, %residual, %alpha)
+        %res = aten::layer_norm(%x, %shape, %w, %b, %eps, %cudnn)
+        return (%res))IR";
+  // Same chain with the operands of the residual add swapped.
+  std::string dropout_add_ln_pattern_rev = R"IR(
+    graph(%input, %residual, %p, %train, %alpha, %shape, %w, %b, %eps, %cudnn):
+        %a = aten::dropout(%input, %p, %train)
+        %x = aten::add(%residual, %a, %alpha)
+        %res = aten::layer_norm(%x, %shape, %w, %b, %eps, %cudnn)
+        return (%res))IR";
+  std::string fused_pattern = R"IR(
+    graph(%input, %residual, %p, %train, %alpha, %shape, %w, %b, %eps, %cudnn):
+        %res, %mask, %mean, %rstd = aten::_fused_dropout_add_layer_norm(%input, %residual, %shape, %w, %b, %p, %train, %eps)
+        return (%res))IR";
+
+  std::vector<std::pair<std::string, std::string>> value_mappings(
+      {{"res", "res"}, {"mask", "res"}, {"mean", "res"}, {"rstd", "res"}});
+  SubgraphRewriter rewriter;
+  rewriter.RegisterRewritePattern(
+      dropout_add_ln_pattern, fused_pattern, value_mappings);
+  rewriter.RegisterRewritePattern(
+      dropout_add_ln_pattern_rev, fused_pattern, value_mappings);
+  rewriter.runOnGraph(
+      graph, {aten_add_alpha_is_one, intermediates_have_single_use});
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,21 @@
+/** \brief Fusing the transformer residual path into a single op
+ */
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+/** \brief Rewrite dropout + residual add + layer_norm chains into
+ * aten::_fused_dropout_add_layer_norm.
+ *
+ * The fused op makes one pass over the activations where the eager chain
+ * makes three, and its backward recomputes the pre-norm activation from the
+ * dropout mask instead of saving it, so the rewrite also lowers training
+ * memory use. Numerics are unchanged up to the dropout RNG sequence.
+ */
+TORCH_API void FuseDropoutAddLayerNorm(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
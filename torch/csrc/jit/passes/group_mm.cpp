@@ -0,0 +1,113 @@
+#include <torch/csrc/jit/passes/group_mm.h>
+
+#include <ATen/core/functional.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Tunable parameter. Batching fewer mms than this isn't worth the list
+// construction overhead.
+constexpr size_t min_group_size = 4;
+
+bool isGroupableMM(Node* node, AliasDb& alias_db) {
+  return node->matches("aten::mm(Tensor self, Tensor mat2) -> Tensor") &&
+      !alias_db.hasWriters(node);
+}
+
+// Filters `mms` down to a set of pairwise independent nodes: every survivor
+// could be moved before every earlier survivor, so they can all be packed
+// next to the first one. Mirrors the filtering in batch_mm.cpp.
+std::vector<Node*> filterIndependentMMs(
+    std::vector<Node*> mms,
+    AliasDb& alias_db) {
+  for (const auto i : c10::irange(mms.size())) {
+    if (mms[i] == nullptr) {
+      continue;
+    }
+    for (size_t j = i + 1; j < mms.size(); ++j) {
+      if (mms[j] == nullptr) {
+        continue;
+      }
+      if (!alias_db.couldMoveBeforeTopologically(mms[j], mms[i])) {
+        mms[j] = nullptr;
+      }
+    }
+  }
+  return c10::filter(mms, [](Node* n) { return n != nullptr; });
+}
+
+void fuseGroup(std::vector<Node*>& mms, AliasDb& alias_db) {
+  // Pack the group next to its first member. Only moves nodes up, which the
+  // filtering above proved valid (each survivor could move before mms[0]).
+  for (size_t i = 0; i + 1 < mms.size(); ++i) {
+    bool move_ok = alias_db.moveAfterTopologicallyValid(mms[i + 1], mms[i]);
+    AT_ASSERT(move_ok);
+  }
+
+  WithInsertPoint insert_guard{mms[0]};
+  Graph* graph = mms[0]->owningGraph();
+  Value* self_list = graph
+      ->insertNode(graph->createList(
+          TensorType::get(),
+          fmap(mms, [](Node* n) { return n->inputs().at(0); })))
+      ->output();
+  Value* other_list = graph
+      ->insertNode(graph->createList(
+          TensorType::get(),
+          fmap(mms, [](Node* n) { return n->inputs().at(1); })))
+      ->output();
+  Node* grouped_mm = graph->insertNode(graph->create(
+      Symbol::fromQualString("aten::_grouped_mm"), {self_list, other_list}));
+  grouped_mm->output()->setType(ListType::ofTensors());
+  Node* unpack =
+      graph->insertNode(graph->createListUnpack(grouped_mm->output(), mms.size()));
+  for (const auto i : c10::irange(mms.size())) {
+    unpack->outputs().at(i)->setType(mms[i]->output()->type());
+    mms[i]->output()->replaceAllUsesWith(unpack->outputs().at(i));
+  }
+}
+
+void GroupMMInBlock(Block* block, AliasDb& alias_db) {
+  std::vector<Node*> mms;
+  for (Node* node : block->nodes()) {
+    for (Block* subblock : node->blocks()) {
+      GroupMMInBlock(subblock, alias_db);
+    }
+    if (isGroupableMM(node, alias_db)) {
+      mms.push_back(node);
+    }
+  }
+
+  // Greedily peel off groups of independent mms; nodes rejected from one
+  // group (because they depend on a member) seed the next one.
+  std::vector<Node*> remaining = std::move(mms);
+  while (remaining.size() >= min_group_size) {
+    std::vector<Node*> group = filterIndependentMMs(remaining, alias_db);
+    if (group.size() < min_group_size) {
+      break;
+    }
+    fuseGroup(group, alias_db);
+    remaining = c10::filter(remaining, [&](Node* n) {
+      return std::find(group.begin(), group.end(), n) == group.end();
+    });
+  }
+}
+
+} // namespace
+
+void GroupMM(std::shared_ptr<Graph>& graph) {
+  AliasDb alias_db(graph);
+  GroupMMInBlock(graph->block(), alias_db);
+  EliminateDeadCode(graph);
+}
+
+} // namespace jit
+} // namespace torch
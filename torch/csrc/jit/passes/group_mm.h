@@ -0,0 +1,17 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Coalesces independent aten::mm nodes within a block into a single
+// aten::_grouped_mm call, which dispatches all the products with one batched
+// BLAS call when the shapes match. Intended for inference graphs that issue
+// many small independent matrix multiplies per step (e.g. graph embeddings),
+// where per-op dispatch overhead dominates; it is not part of the default
+// optimization pipeline.
+TORCH_API void GroupMM(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
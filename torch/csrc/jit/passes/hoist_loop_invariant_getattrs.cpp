@@ -0,0 +1,108 @@
+#include <torch/csrc/jit/passes/hoist_loop_invariant_getattrs.h>
+
+#include <torch/csrc/jit/jit_log.h>
+
+#include <unordered_set>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+struct LoopBodySummary {
+  // Attribute names assigned by a prim::SetAttr somewhere in the loop body.
+  std::unordered_set<std::string> mutated_attributes;
+  // True if an object flows into a node other than GetAttr/SetAttr (a call,
+  // a container, ...), which could mutate any of its attributes.
+  bool objects_escape = false;
+};
+
+void summarizeLoopBody(Block* block, LoopBodySummary& summary) {
+  for (Node* node : block->nodes()) {
+    if (node->kind() == prim::SetAttr) {
+      summary.mutated_attributes.insert(node->s(attr::name));
+    } else if (node->kind() != prim::GetAttr) {
+      for (Value* input : node->inputs()) {
+        if (input->type()->cast<ClassType>()) {
+          summary.objects_escape = true;
+        }
+      }
+    }
+    for (Block* subblock : node->blocks()) {
+      summarizeLoopBody(subblock, summary);
+    }
+  }
+}
+
+bool isDefinedInside(Value* value, Node* loop) {
+  Block* block = value->node()->owningBlock();
+  while (block != nullptr) {
+    Node* owner = block->owningNode();
+    if (owner == loop) {
+      return true;
+    }
+    block = owner ? owner->owningBlock() : nullptr;
+  }
+  return false;
+}
+
+bool hoistFromLoop(Node* loop) {
+  Block* body = loop->blocks().at(0);
+  LoopBodySummary summary;
+  summarizeLoopBody(body, summary);
+  if (summary.objects_escape) {
+    return false;
+  }
+
+  bool changed = false;
+  // Hoisting a GetAttr can make GetAttrs chained on its output hoistable in
+  // turn (self.cell.weight), so iterate to a fixpoint. Only nodes directly
+  // in the loop body are hoisted; nodes in nested blocks may execute
+  // conditionally and are left alone.
+  bool hoisted_one = true;
+  while (hoisted_one) {
+    hoisted_one = false;
+    for (auto it = body->nodes().begin(); it != body->nodes().end();) {
+      Node* node = *it;
+      ++it;
+      if (node->kind() != prim::GetAttr ||
+          summary.mutated_attributes.count(node->s(attr::name)) != 0 ||
+          isDefinedInside(node->input(), loop)) {
+        continue;
+      }
+      GRAPH_UPDATE("Hoisting ", getHeader(node), " out of loop");
+      node->moveBefore(loop);
+      hoisted_one = true;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+bool processBlock(Block* block) {
+  bool changed = false;
+  for (Node* node : block->nodes()) {
+    // Process nested blocks first, so that inner loops hoist into outer
+    // loop bodies, from where the outer loop can hoist further.
+    for (Block* subblock : node->blocks()) {
+      changed |= processBlock(subblock);
+    }
+    if (node->kind() == prim::Loop) {
+      changed |= hoistFromLoop(node);
+    }
+  }
+  return changed;
+}
+
+} // namespace
+
+bool HoistLoopInvariantGetAttrs(std::shared_ptr<Graph>& graph) {
+  bool changed = processBlock(graph->block());
+  if (changed) {
+    GRAPH_DUMP("After HoistLoopInvariantGetAttrs: ", graph);
+  }
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
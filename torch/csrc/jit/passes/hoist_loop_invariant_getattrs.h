@@ -0,0 +1,19 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Hoists loop-invariant prim::GetAttr nodes out of loops, so that e.g. the
+// parameters read by a scripted RNN loop are resolved once instead of on
+// every iteration. A GetAttr is hoisted when its object is defined outside
+// the loop and nothing in the loop body could replace the attribute: there
+// is no prim::SetAttr with the same attribute name, and no node other than
+// GetAttr receives an object (a call could set attributes internally).
+//
+// Returns true if the graph was modified.
+TORCH_API bool HoistLoopInvariantGetAttrs(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
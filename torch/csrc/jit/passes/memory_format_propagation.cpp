@@ -0,0 +1,211 @@
+#include <torch/csrc/jit/passes/memory_format_propagation.h>
+
+#include <c10/core/MemoryFormat.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/runtime/graph_iterator.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+bool isConvolution(Node* node) {
+  static const std::unordered_set<Symbol> conv_ops = {
+      aten::conv2d,
+      aten::conv_transpose2d,
+      aten::convolution,
+      aten::_convolution,
+      aten::cudnn_convolution,
+  };
+  return conv_ops.count(node->kind()) != 0;
+}
+
+// Ops whose output layout follows the layout of their first tensor input,
+// so a channels-last preference flows through them unchanged.
+bool preservesMemoryFormat(Node* node) {
+  static const std::unordered_set<Symbol> format_preserving_ops = {
+      aten::relu,        aten::relu_,
+      aten::hardtanh,    aten::hardtanh_,
+      aten::hardswish,   aten::hardswish_,
+      aten::hardsigmoid, aten::hardsigmoid_,
+      aten::sigmoid,     aten::tanh,
+      aten::silu,        aten::gelu,
+      aten::leaky_relu,  aten::clamp,
+      aten::add,         aten::add_,
+      aten::sub,         aten::mul,
+      aten::mul_,        aten::div,
+      aten::batch_norm,  aten::instance_norm,
+      aten::dropout,     aten::max_pool2d,
+      aten::avg_pool2d,  aten::adaptive_avg_pool2d,
+      aten::upsample_nearest2d, aten::upsample_bilinear2d,
+  };
+  return format_preserving_ops.count(node->kind()) != 0;
+}
+
+// Ops that always produce contiguous outputs regardless of input layout,
+// i.e. the points where a channels-last chain is broken.
+bool forcesContiguousOutput(Node* node) {
+  static const std::unordered_set<Symbol> format_breaking_ops = {
+      aten::pixel_shuffle,
+      aten::pixel_unshuffle,
+      aten::view,
+      aten::reshape,
+      aten::flatten,
+  };
+  return format_breaking_ops.count(node->kind()) != 0;
+}
+
+// Returns the memory format implied by a value's profiled sizes/strides,
+// if both are concrete and 4-dimensional.
+c10::optional<c10::MemoryFormat> profiledMemoryFormat(Value* value) {
+  auto tensor_type = value->type()->cast<TensorType>();
+  if (!tensor_type) {
+    return c10::nullopt;
+  }
+  auto sizes = tensor_type->sizes().concrete_sizes();
+  auto strides = tensor_type->strides().concrete_sizes();
+  if (!sizes || !strides || sizes->size() != 4) {
+    return c10::nullopt;
+  }
+  return c10::is_channels_last_strides_2d(*sizes, *strides)
+      ? c10::MemoryFormat::ChannelsLast
+      : c10::MemoryFormat::Contiguous;
+}
+
+bool isFourDimTensor(Value* value) {
+  auto tensor_type = value->type()->cast<TensorType>();
+  if (!tensor_type) {
+    return false;
+  }
+  auto dim = tensor_type->dim();
+  return dim && *dim == 4;
+}
+
+class MemoryFormatPropagator {
+ public:
+  explicit MemoryFormatPropagator(std::shared_ptr<Graph> graph)
+      : graph_(std::move(graph)) {}
+
+  bool run() {
+    analyze();
+    if (!seen_channels_last_conv_) {
+      // The model is not running channels-last; leave the graph alone.
+      return false;
+    }
+    insertConversions();
+    return graph_modified_;
+  }
+
+ private:
+  // Forward pass over the graph computing the planned format of each
+  // tensor value.
+  void analyze() {
+    for (Value* input : graph_->inputs()) {
+      if (auto format = profiledMemoryFormat(input)) {
+        preferred_[input] = *format;
+      }
+    }
+    DepthFirstGraphNodeIterator graph_it(graph_);
+    for (Node* node = graph_it.next(); node != nullptr;
+         node = graph_it.next()) {
+      if (isConvolution(node)) {
+        if (preferredFormat(node->input(0)) ==
+            c10::MemoryFormat::ChannelsLast) {
+          seen_channels_last_conv_ = true;
+          preferred_[node->output()] = c10::MemoryFormat::ChannelsLast;
+        }
+      } else if (preservesMemoryFormat(node)) {
+        if (node->inputs().empty() || node->outputs().size() != 1) {
+          continue;
+        }
+        if (auto format = preferredFormat(node->input(0))) {
+          preferred_[node->output()] = *format;
+        }
+      } else if (forcesContiguousOutput(node)) {
+        for (Value* output : node->outputs()) {
+          preferred_[output] = c10::MemoryFormat::Contiguous;
+        }
+      }
+      // All other ops are left unknown; unknown values never trigger a
+      // conversion below.
+    }
+  }
+
+  c10::optional<c10::MemoryFormat> preferredFormat(Value* value) {
+    auto it = preferred_.find(value);
+    if (it != preferred_.end()) {
+      return it->second;
+    }
+    return profiledMemoryFormat(value);
+  }
+
+  // For every value planned contiguous that feeds one or more
+  // convolutions, convert it to channels-last once, right after its
+  // producer, and reroute the convolution consumers through the
+  // conversion. The convolutions then see channels-last inputs directly
+  // instead of each converting internally.
+  void insertConversions() {
+    DepthFirstGraphNodeIterator graph_it(graph_);
+    std::vector<Node*> convs;
+    for (Node* node = graph_it.next(); node != nullptr;
+         node = graph_it.next()) {
+      if (isConvolution(node)) {
+        convs.push_back(node);
+      }
+    }
+    std::unordered_map<Value*, Value*> converted;
+    for (Node* conv : convs) {
+      Value* input = conv->input(0);
+      if (preferredFormat(input) != c10::MemoryFormat::Contiguous ||
+          !isFourDimTensor(input)) {
+        continue;
+      }
+      auto it = converted.find(input);
+      if (it == converted.end()) {
+        Node* producer = input->node();
+        WithInsertPoint insert_guard(
+            producer->kind() == prim::Param ? *producer->owningBlock()
+                                                   ->nodes()
+                                                   .begin()
+                                            : producer->next());
+        Value* format_const = graph_->insertConstant(
+            static_cast<int64_t>(c10::MemoryFormat::ChannelsLast));
+        Node* contiguous =
+            graph_->create(aten::contiguous, {input, format_const});
+        // The profiled strides of the input no longer apply to the
+        // converted value; keep only rank/dtype/device.
+        contiguous->output()->setType(
+            input->type()->expect<TensorType>()->dimensionedOnly());
+        graph_->insertNode(contiguous);
+        it = converted.emplace(input, contiguous->output()).first;
+        preferred_[contiguous->output()] = c10::MemoryFormat::ChannelsLast;
+        graph_modified_ = true;
+      }
+      conv->replaceInputWith(input, it->second);
+    }
+  }
+
+  std::shared_ptr<Graph> graph_;
+  std::unordered_map<Value*, c10::MemoryFormat> preferred_;
+  bool seen_channels_last_conv_ = false;
+  bool graph_modified_ = false;
+};
+
+} // namespace
+
+bool PropagateMemoryFormat(std::shared_ptr<Graph>& graph) {
+  GRAPH_DUMP("Before PropagateMemoryFormat", graph);
+  MemoryFormatPropagator propagator(graph);
+  bool changed = propagator.run();
+  if (changed) {
+    GRAPH_DUMP("After PropagateMemoryFormat", graph);
+  }
+  return changed;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Plans tensor memory formats across the graph for channels-last CNN
+// inference. Starting from convolutions whose profiled input strides
+// suggest channels-last, the preferred format is propagated through
+// format-preserving ops (pointwise, pooling, normalization), while ops
+// that force contiguous outputs (e.g. pixel_shuffle, view, reshape)
+// reset it. Where a contiguous value later feeds convolutions, a single
+// aten::contiguous(..., ChannelsLast) conversion is inserted after the
+// producer and shared by all convolution consumers, instead of every
+// convolution converting its input internally.
+//
+// Expects a profiled graph (concrete strides on conv inputs); runs as a
+// no-op on graphs without channels-last convolutions.
+//
+// Returns true if the graph was modified.
+TORCH_API bool PropagateMemoryFormat(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
@@ -23,6 +23,7 @@
 #include <torch/csrc/jit/runtime/symbolic_shape_registry.h>
 #include <torch/csrc/jit/runtime/symbolic_shape_registry_util.h>
 #include <torch/csrc/jit/tensorexpr/kernel.h>
+#include <torch/csrc/jit/tensorexpr/kernel_cache.h>
 #include <torch/csrc/utils/memory.h>
 
 // NOLINTNEXTLINE
@@ -1320,8 +1321,9 @@ Operation createTensorExprOp(const Node* node) {
   bool dynamic_shape_fusion_node =
       node->hasAttribute(attr::striding_inputs_desc);
   if (!dynamic_shape_fusion_node) {
-    auto kernel =
-        std::make_shared<tensorexpr::TensorExprKernel>(node->g(attr::Subgraph));
+    // Complete-shape fusion groups repeat across layers and model replicas,
+    // so identical subgraphs share one compiled kernel.
+    auto kernel = tensorexpr::getOrCompileKernel(node->g(attr::Subgraph));
     return [kernel](Stack& stack) {
       RECORD_FUNCTION(kernel->getKernelName(), std::vector<c10::IValue>());
       kernel->run(stack);
@@ -2,6 +2,8 @@
 #include <torch/csrc/utils/python_arg_parser.h>
 
 #include <ATen/core/operator_name.h>
+#include <ATen/record_function.h>
+#include <c10/util/Synchronized.h>
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/backends/backend_init.h>
 #include <torch/csrc/jit/codegen/cuda/interface.h>
@@ -21,6 +23,7 @@
 #include <torch/csrc/jit/passes/canonicalize_graph_fuser_ops.h>
 #include <torch/csrc/jit/passes/common_subexpression_elimination.h>
 #include <torch/csrc/jit/passes/constant_pooling.h>
+#include <torch/csrc/jit/passes/fold_view_chains.h>
 #include <torch/csrc/jit/passes/constant_propagation.h>
 #include <torch/csrc/jit/passes/create_autodiff_subgraphs.h>
 #include <torch/csrc/jit/passes/create_functional_graphs.h>
@@ -28,6 +31,7 @@
 #include <torch/csrc/jit/passes/dbr_quantization/remove_redundant_aliases.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/decompose_ops.h>
+#include <torch/csrc/jit/passes/device_partitioning.h>
 #include <torch/csrc/jit/passes/device_type_analysis.h>
 #include <torch/csrc/jit/passes/dtype_analysis.h>
 #include <torch/csrc/jit/passes/erase_number_types.h>
@@ -37,17 +41,21 @@
 #include <torch/csrc/jit/passes/frozen_conv_add_relu_fusion.h>
 #include <torch/csrc/jit/passes/frozen_conv_folding.h>
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
+#include <torch/csrc/jit/passes/frozen_linear_autotune.h>
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
+#include <torch/csrc/jit/passes/fuse_dropout_add_layer_norm.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
 #include <torch/csrc/jit/passes/fuse_relu.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
+#include <torch/csrc/jit/passes/group_mm.h>
 #include <torch/csrc/jit/passes/inline_fork_wait.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/passes/integer_value_refinement.h>
 #include <torch/csrc/jit/passes/loop_unrolling.h>
 #include <torch/csrc/jit/passes/lower_graph.h>
 #include <torch/csrc/jit/passes/lower_tuples.h>
+#include <torch/csrc/jit/passes/memory_format_propagation.h>
 #include <torch/csrc/jit/passes/metal_rewrite.h>
 #include <torch/csrc/jit/passes/normalize_ops.h>
 #include <torch/csrc/jit/passes/peephole.h>
@@ -84,6 +92,7 @@
 #include <torch/csrc/jit/runtime/autodiff.h>
 #include <torch/csrc/jit/runtime/decomposition_registry.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
+#include <torch/csrc/jit/runtime/graph_executor_impl.h>
 #include <torch/csrc/jit/runtime/jit_exception.h>
 #include <torch/csrc/jit/runtime/jit_trace.h>
 #include <torch/csrc/jit/runtime/operator.h>
@@ -92,6 +101,7 @@
 #include <torch/csrc/jit/runtime/symbolic_shape_registry.h>
 #include <torch/csrc/jit/serialization/export.h>
 #include <torch/csrc/jit/serialization/import.h>
+#include <torch/csrc/jit/serialization/storage_dedup.h>
 #include <torch/csrc/jit/tensorexpr/kernel.h>
 #include <torch/csrc/jit/tensorexpr/tensorexpr_init.h>
 #include <torch/csrc/utils/cpp_stacktraces.h>
@@ -109,6 +119,7 @@
 
 #include <torch/csrc/jit/runtime/profiling_graph_executor_impl.h>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -136,6 +147,20 @@ bool loadPythonClasses() {
 
   return true;
 }
+
+// State for the runtime operator-call tracing mode exposed via the
+// _jit_{start,stop}_operator_call_tracing bindings below. The recording
+// callback mirrors torch::jit::mobile::OperatorCallTracer, which is only
+// compiled into the standalone model tracer binary.
+struct OperatorCallTracingState {
+  c10::Synchronized<std::set<std::string>> called_operators;
+  c10::optional<at::CallbackHandle> handle;
+};
+
+OperatorCallTracingState& operatorCallTracingState() {
+  static OperatorCallTracingState state;
+  return state;
+}
 } // anonymous namespace
 
 #if !defined(USE_ROCM)
@@ -349,6 +374,11 @@ void initJITBindings(PyObject* module) {
       .def("_jit_pass_convert_frozen_ops_to_mkldnn", &ConvertFrozenOpsToMKLDNN)
       .def("_jit_pass_fuse_frozen_conv_add_relu", &FuseFrozenConvAddRelu)
       .def("_jit_pass_transpose_frozen_linear", &FrozenLinearTranspose)
+      .def(
+          "_jit_pass_autotune_frozen_linear",
+          [](std::shared_ptr<Graph>& graph) {
+            return FrozenLinearAutotune(graph);
+          })
       .def("_jit_pass_optimize_frozen_graph", &OptimizeFrozenGraph)
       .def(
           "_jit_pass_optimize_for_inference",
@@ -358,6 +388,8 @@ void initJITBindings(PyObject* module) {
           py::arg("module"),
           py::arg("other_methods") = std::vector<std::string>())
       .def("_jit_pass_fuse_linear", &FuseLinear)
+      .def(
+          "_jit_pass_fuse_dropout_add_layer_norm", &FuseDropoutAddLayerNorm)
       .def(
           "_jit_pass_fuse_add_relu",
           [](std::shared_ptr<Graph>& graph) { FuseAddRelu(graph); })
@@ -410,9 +442,21 @@ void initJITBindings(PyObject* module) {
           py::arg("value_name_pairs") =
               std::vector<std::pair<std::string, std::string>>())
       .def("_jit_pass_constant_pooling", ConstantPooling)
+      .def(
+          "_jit_pass_consolidate_constant_tensors",
+          ConsolidateConstantTensors,
+          py::arg("graph"),
+          py::arg("use_hugepages") = true)
+      .def("_jit_pass_fold_view_chains", FoldViewChains)
       // RemoveInplaceOps is used by CoreML so it must be removed with care.
       .def("_jit_pass_propagate_dtype", DtypePropagation)
       .def("_jit_pass_propagate_device", DeviceTypePropagation)
+      .def("_jit_pass_propagate_memory_format", PropagateMemoryFormat)
+      .def(
+          "_jit_pass_partition_device_subgraphs",
+          [](std::shared_ptr<Graph>& g) {
+            return PartitionDeviceSubgraphs(g).str();
+          })
       .def(
           "_jit_pass_remove_inplace_ops",
           [](const std::shared_ptr<Graph>& g) { return RemoveInplaceOps(g); })
@@ -758,6 +802,31 @@ void initJITBindings(PyObject* module) {
             size_t num_runs = getNumProfiledRuns();
             return num_runs;
           })
+      .def(
+          "_jit_instruction_pair_frequencies",
+          &getInstructionPairFrequencies)
+      .def(
+          "_jit_reset_instruction_pair_frequencies",
+          &resetInstructionPairFrequencies)
+      .def(
+          "_jit_set_plan_cache_size",
+          [](size_t size) {
+            size_t old_size = getPlanCacheSize();
+            getPlanCacheSize() = size;
+            return old_size;
+          })
+      .def(
+          "_jit_plan_cache_hit_count",
+          [] {
+            size_t hits = getPlanCacheHits();
+            return hits;
+          })
+      .def(
+          "_jit_plan_cache_miss_count",
+          [] {
+            size_t misses = getPlanCacheMisses();
+            return misses;
+          })
       .def(
           "_jit_set_bailout_depth",
           [](size_t depth) {
@@ -797,6 +866,23 @@ void initJITBindings(PyObject* module) {
             setFusionStrategy(vec_conv);
             return strat;
           })
+      .def(
+          "_jit_set_storage_deduplication",
+          [](bool enabled) { setStorageDeduplication(enabled); })
+      .def(
+          "_jit_get_storage_deduplication",
+          []() { return getStorageDeduplication(); })
+      .def(
+          "_jit_storage_dedup_stats",
+          []() {
+            const auto stats = getStorageDedupStats();
+            py::dict result;
+            result["storages_seen"] = stats.storages_seen;
+            result["storages_shared"] = stats.storages_shared;
+            result["bytes_seen"] = stats.bytes_seen;
+            result["bytes_saved"] = stats.bytes_saved;
+            return result;
+          })
       .def(
           "_jit_set_inline_everything_mode",
           [](bool enabled) { getInlineEverythingMode() = enabled; })
@@ -1053,6 +1139,13 @@ void initJITBindings(PyObject* module) {
             return retval;
           })
       .def("_jit_pass_batch_mm", BatchMM)
+      .def(
+          "_jit_run_optimization_batch",
+          [](std::vector<std::shared_ptr<Graph>>& graphs) {
+            runOptimizationBatch(graphs);
+          },
+          py::call_guard<py::gil_scoped_release>())
+      .def("_jit_pass_group_mm", GroupMM)
       .def("_jit_decay_packed_param_input_types", [](Graph& g) {
         for (Value* i : g.inputs()) {
           if (i->type() ==
@@ -1147,6 +1240,9 @@ void initJITBindings(PyObject* module) {
       .def(py::init<std::string>())
       .def(py::init([](const py::object& buffer) {
         auto writer_func = [=](const void* data, size_t size) {
+          // The writer runs this on a background thread when asynchronous
+          // writes are enabled, so the GIL is not necessarily held.
+          py::gil_scoped_acquire acquire;
           auto bytes = py::bytes(reinterpret_cast<const char*>(data), size);
           buffer.attr("write")(std::move(bytes));
           return size;
@@ -1159,18 +1255,39 @@ void initJITBindings(PyObject* module) {
           [](PyTorchStreamWriter& self,
              const std::string& name,
              const char* data,
-             size_t size) { return self.writeRecord(name, data, size); })
-      .def("write_end_of_file", &PyTorchStreamWriter::writeEndOfFile)
+             size_t size,
+             bool compress) {
+            py::gil_scoped_release release;
+            return self.writeRecord(name, data, size, compress);
+          },
+          py::arg("name"),
+          py::arg("data"),
+          py::arg("size"),
+          py::arg("compress") = false)
+      .def(
+          "write_end_of_file",
+          &PyTorchStreamWriter::writeEndOfFile,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "set_async_writes",
+          &PyTorchStreamWriter::setAsyncWrites,
+          py::call_guard<py::gil_scoped_release>())
       .def("set_min_version", &PyTorchStreamWriter::setMinVersion)
       .def(
           "write_record",
           [](PyTorchStreamWriter& self,
              const std::string& name,
              uintptr_t data,
-             size_t size) {
+             size_t size,
+             bool compress) {
+            py::gil_scoped_release release;
             return self.writeRecord(
-                name, reinterpret_cast<const char*>(data), size);
-          })
+                name, reinterpret_cast<const char*>(data), size, compress);
+          },
+          py::arg("name"),
+          py::arg("data"),
+          py::arg("size"),
+          py::arg("compress") = false)
       .def("archive_name", &PyTorchStreamWriter::archiveName)
       .def(
           "get_all_written_records",
@@ -1266,6 +1383,22 @@ void initJITBindings(PyObject* module) {
             std::tie(data, size) = self.getRecord(key);
             return py::bytes(reinterpret_cast<const char*>(data.get()), size);
           })
+      .def(
+          "get_records",
+          [](PyTorchStreamReader& self, const std::vector<std::string>& keys) {
+            std::vector<std::tuple<at::DataPtr, size_t>> records;
+            {
+              py::gil_scoped_release release;
+              records = self.getRecords(keys);
+            }
+            py::list out;
+            for (auto& record : records) {
+              out.append(py::bytes(
+                  reinterpret_cast<const char*>(std::get<0>(record).get()),
+                  std::get<1>(record)));
+            }
+            return out;
+          })
       .def(
           "has_record",
           [](PyTorchStreamReader& self, const std::string& key) {
@@ -1350,6 +1483,44 @@ void initJITBindings(PyObject* module) {
         }
       });
 
+  // Records every operator dispatched while tracing is active, for use with
+  // the selective build machinery (torchgen/selective_build). See
+  // torch.utils.selective_build for the user-facing API.
+  m.def("_jit_start_operator_call_tracing", []() {
+    auto& state = operatorCallTracingState();
+    TORCH_CHECK(
+        !state.handle.has_value(), "Operator call tracing is already active");
+    state.called_operators.withLock(
+        [](std::set<std::string>& ops) { ops.clear(); });
+    state.handle = at::addGlobalCallback(
+        at::RecordFunctionCallback(
+            [](const at::RecordFunction& fn)
+                -> std::unique_ptr<at::ObserverContext> {
+              c10::optional<c10::OperatorName> op_name = fn.operator_name();
+              if (op_name.has_value()) {
+                operatorCallTracingState().called_operators.withLock(
+                    [&op_name](std::set<std::string>& ops) {
+                      ops.insert(c10::toString(*op_name));
+                    });
+              }
+              return nullptr;
+            })
+            .scopes({at::RecordScope::FUNCTION}));
+  });
+
+  m.def("_jit_stop_operator_call_tracing", []() {
+    auto& state = operatorCallTracingState();
+    TORCH_CHECK(
+        state.handle.has_value(), "Operator call tracing is not active");
+    at::removeCallback(*state.handle);
+    state.handle = c10::nullopt;
+    std::vector<std::string> result;
+    state.called_operators.withLock([&result](std::set<std::string>& ops) {
+      result.assign(ops.begin(), ops.end());
+    });
+    return result;
+  });
+
   m.def(
       "_get_operation_overload",
       [](const std::string& op_name, const std::string& overload_name) {
@@ -9,6 +9,9 @@
 #include <c10/core/QScheme.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace torch {
 namespace jit {
 
@@ -385,5 +388,75 @@ IValue toIValue(py::handle obj, const TypePtr& type, c10::optional<int32_t> N) {
       "toIValue() cannot handle converting to type: ", type->repr_str()));
 }
 
+namespace {
+
+// Call-site binding plans, keyed by fingerprint. Bounded so that callers
+// generating unbounded distinct signatures (e.g. varying kwarg sets) cannot
+// grow the table without limit; entries are never evicted since a plan stays
+// valid for the lifetime of the operator registry.
+constexpr size_t kMaxCallSiteBindings = 4096;
+
+std::mutex& callSiteBindingMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<std::string, std::shared_ptr<const CallSiteBinding>>&
+callSiteBindingCache() {
+  static std::unordered_map<std::string, std::shared_ptr<const CallSiteBinding>>
+      cache;
+  return cache;
+}
+
+} // namespace
+
+std::string callSiteFingerprint(
+    const std::string& op_name,
+    const py::args& args,
+    const py::kwargs& kwargs) {
+  std::string fingerprint;
+  fingerprint.reserve(
+      op_name.size() + 16 + (args.size() + kwargs.size()) * 12);
+  fingerprint += op_name;
+  fingerprint += '(';
+  // Overload resolution depends on argument types, not just arity, so each
+  // slot carries the Python type of its value; two calls that would resolve
+  // to different overloads must not share a plan.
+  for (const auto& arg : args) {
+    fingerprint += Py_TYPE(arg.ptr())->tp_name;
+    fingerprint += ',';
+  }
+  for (const auto& kwarg : kwargs) {
+    fingerprint += ';';
+    fingerprint += py::cast<std::string>(kwarg.first);
+    fingerprint += '=';
+    fingerprint += Py_TYPE(kwarg.second.ptr())->tp_name;
+  }
+  fingerprint += ')';
+  return fingerprint;
+}
+
+std::shared_ptr<const CallSiteBinding> lookupCallSiteBinding(
+    const std::string& fingerprint) {
+  std::lock_guard<std::mutex> lock(callSiteBindingMutex());
+  auto& cache = callSiteBindingCache();
+  auto it = cache.find(fingerprint);
+  return it == cache.end() ? nullptr : it->second;
+}
+
+void recordCallSiteBinding(
+    const std::string& fingerprint,
+    std::shared_ptr<const CallSiteBinding> binding) {
+  if (!binding) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(callSiteBindingMutex());
+  auto& cache = callSiteBindingCache();
+  if (cache.size() >= kMaxCallSiteBindings) {
+    return;
+  }
+  cache.emplace(fingerprint, std::move(binding));
+}
+
 } // namespace jit
 } // namespace torch
@@ -1134,16 +1134,118 @@ inline py::object invokeScriptMethodFromPython(
       });
 }
 
+// A resolved argument-binding plan for one dynamic call site, keyed by a
+// fingerprint of the call signature (operator name, the Python type of every
+// positional argument, and keyword names with their value types). A repeat
+// invocation with the same fingerprint knows, without re-running schema
+// matching, which overload matched, which schema slot each keyword argument
+// lands in, and which slots are filled from defaults. The type tags are
+// shallow (a list is just "list"), so a plan is a prediction, not a proof:
+// callers must be prepared to fall back to full matching when binding
+// against the cached schema fails.
+struct VISIBILITY_HIDDEN CallSiteBinding {
+  // One schema slot past the positional prefix.
+  struct TailSlot {
+    // Interned keyword name; repeat lookups reuse this PyUnicode object
+    // instead of allocating a new one per call.
+    py::str kwarg_name;
+    IValue default_value;
+    bool from_kwargs = false;
+  };
+  std::shared_ptr<Operator> op;
+  std::vector<TailSlot> tail_slots;
+};
+
+std::string callSiteFingerprint(
+    const std::string& op_name,
+    const py::args& args,
+    const py::kwargs& kwargs);
+std::shared_ptr<const CallSiteBinding> lookupCallSiteBinding(
+    const std::string& fingerprint);
+// Records a binding for `fingerprint`; a no-op once the (bounded) cache
+// is full.
+void recordCallSiteBinding(
+    const std::string& fingerprint,
+    std::shared_ptr<const CallSiteBinding> binding);
+
+// Builds the binding plan after `createStackForSchema` accepted this call
+// signature for `op`, so every slot past the positional prefix is known to
+// come from either kwargs or a default. Returns nullptr for signatures the
+// plan cannot describe (vararg schemas, or a slot with neither a kwarg nor
+// a default); those keep going through full schema matching.
+inline std::shared_ptr<const CallSiteBinding> makeCallSiteBinding(
+    std::shared_ptr<Operator> op,
+    size_t num_positional,
+    const py::kwargs& kwargs) {
+  const auto& arguments = op->schema().arguments();
+  if (op->schema().is_vararg() || num_positional > arguments.size()) {
+    return nullptr;
+  }
+  auto binding = std::make_shared<CallSiteBinding>();
+  binding->tail_slots.reserve(arguments.size() - num_positional);
+  for (size_t i = num_positional; i < arguments.size(); ++i) {
+    const auto& arg = arguments[i];
+    CallSiteBinding::TailSlot slot;
+    if (kwargs.contains(arg.name().c_str())) {
+      slot.kwarg_name = py::str(arg.name());
+      slot.from_kwargs = true;
+    } else if (arg.default_value()) {
+      slot.default_value = *arg.default_value();
+    } else {
+      return nullptr;
+    }
+    binding->tail_slots.push_back(std::move(slot));
+  }
+  binding->op = std::move(op);
+  return binding;
+}
+
+inline Stack bindCallSite(
+    const CallSiteBinding& binding,
+    const tuple_slice& args,
+    const py::kwargs& kwargs) {
+  const auto& schema = binding.op->schema();
+  Stack stack;
+  stack.reserve(schema.arguments().size());
+  for (const auto& arg : args) {
+    push(stack, argumentToIValue(schema, stack.size(), arg));
+  }
+  for (const auto& slot : binding.tail_slots) {
+    if (slot.from_kwargs) {
+      auto* value = PyDict_GetItem(kwargs.ptr(), slot.kwarg_name.ptr());
+      // The fingerprint pins the keyword-name set, so the plan's kwargs are
+      // always present.
+      TORCH_INTERNAL_ASSERT(value != nullptr);
+      push(stack, argumentToIValue(schema, stack.size(), py::handle(value)));
+    } else {
+      push(stack, slot.default_value);
+    }
+  }
+  return stack;
+}
+
 inline std::pair<std::shared_ptr<Operator>, Stack> getOpWithStack(
     const std::vector<std::shared_ptr<Operator>>& operations,
     py::args args,
     const py::kwargs& kwargs) {
   Stack stack;
+  auto fingerprint =
+      callSiteFingerprint(operations.at(0)->schema().name(), args, kwargs);
+  if (auto binding = lookupCallSiteBinding(fingerprint)) {
+    // The fingerprint's type tags are shallow, so the cached overload can
+    // still reject these arguments (e.g. a list whose element type belongs
+    // to a different overload); fall through to full schema matching then.
+    try {
+      return std::make_pair(binding->op, bindCallSite(*binding, args, kwargs));
+    } catch (schema_match_error&) {
+    }
+  }
   if (operations.size() == 1) {
     std::shared_ptr<Operator> op = operations.at(0);
     // Create a stack full of the arguments and keyword arguments.
-    stack = createStackForSchema(
-        op->schema(), std::move(args), kwargs, c10::nullopt);
+    stack = createStackForSchema(op->schema(), args, kwargs, c10::nullopt);
+    recordCallSiteBinding(
+        fingerprint, makeCallSiteBinding(op, args.size(), kwargs));
 
     return std::make_pair(op, stack);
   } else {
@@ -1166,6 +1268,8 @@ inline std::pair<std::shared_ptr<Operator>, Stack> getOpWithStack(
       }
       throw std::runtime_error(ss.str());
     }
+    recordCallSiteBinding(
+        fingerprint, makeCallSiteBinding(found_op, args.size(), kwargs));
 
     return std::make_pair(found_op, stack);
   }
@@ -1,6 +1,11 @@
 #include <torch/csrc/jit/runtime/graph_executor.h>
 
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/ivalue.h>
+#include <c10/core/Event.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/autograd/grad_mode.h>
@@ -45,11 +50,13 @@
 #include <torch/csrc/jit/python/update_graph_executor_opt.h>
 #include <torch/csrc/jit/runtime/logging.h>
 
+#include <condition_variable>
 #include <cstdint>
 #include <iterator>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -98,6 +105,16 @@ bool getFusionGroupInlining() {
   return fusion_group_inlining;
 }
 
+static std::atomic<bool> graph_executor_input_transfer(
+    std::getenv("PYTORCH_JIT_ENABLE_INPUT_TRANSFER") != nullptr);
+void setGraphExecutorInputTransfer(bool enabled) {
+  graph_executor_input_transfer = enabled;
+}
+
+bool getGraphExecutorInputTransfer() {
+  return graph_executor_input_transfer;
+}
+
 thread_local std::weak_ptr<Graph> last_executed_optimized_graph;
 std::shared_ptr<Graph> lastExecutedOptimizedGraph() {
   return last_executed_optimized_graph.lock();
@@ -567,6 +584,119 @@ GraphExecutor* getDifferentiableGraphOpExecutor(Operation& op) {
 }
 } // namespace detail
 
+InputTransferStage::InputTransferStage(const std::shared_ptr<Graph>& graph) {
+  // An input can be transferred ahead of time only if replacing it with its
+  // device copy cannot be observed: every use must be an aten::to whose
+  // device argument is the same constant accelerator device. aten::to on a
+  // tensor that is already on the target device is then an identity (or an
+  // on-device cast, if it also changes dtype).
+  auto inputs = graph->inputs();
+  for (const auto i : c10::irange(inputs.size())) {
+    Value* input = inputs[i];
+    if (!input->type()->cast<TensorType>() || input->uses().empty()) {
+      continue;
+    }
+    c10::optional<c10::Device> device;
+    bool eligible = true;
+    for (const Use& use : input->uses()) {
+      if (use.user->kind() != aten::to || use.offset != 0) {
+        eligible = false;
+        break;
+      }
+      auto device_arg = use.user->get(attr::device);
+      if (!device_arg || !device_arg->isDevice()) {
+        eligible = false;
+        break;
+      }
+      auto use_device = device_arg->toDevice();
+      if (!use_device.is_cuda() || (device && use_device != *device)) {
+        eligible = false;
+        break;
+      }
+      device = use_device;
+    }
+    if (eligible && device) {
+      slots_.push_back(Slot{i, *device, at::Tensor(), c10::nullopt});
+    }
+  }
+}
+
+void InputTransferStage::transferInputs(Stack& stack, size_t num_inputs) {
+  if (slots_.empty() || tracer::isTracing()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return;
+  }
+  const size_t stack_offset = stack.size() - num_inputs;
+  for (Slot& slot : slots_) {
+    IValue& iv = stack[stack_offset + slot.input];
+    if (!iv.isTensor()) {
+      continue;
+    }
+    const at::Tensor& tensor = iv.toTensor();
+    if (!tensor.defined() || !tensor.device().is_cpu() ||
+        !tensor.is_contiguous()) {
+      continue;
+    }
+    // pre-transferring would detach the input from the autograd graph the
+    // in-graph aten::to participates in
+    if (tensor.requires_grad() && autograd::GradMode::is_enabled()) {
+      continue;
+    }
+    if (!c10::impl::hasDeviceGuardImpl(slot.device.type())) {
+      continue;
+    }
+    c10::impl::VirtualGuardImpl impl(slot.device.type());
+    c10::Device device = slot.device;
+    if (!device.has_index()) {
+      device.set_index(impl.getDevice().index());
+    }
+
+    // stage through the pinned buffer unless the caller already handed us
+    // pinned memory (then the async copy can read from it directly)
+    at::Tensor source = tensor;
+    if (!tensor.is_pinned()) {
+      if (!slot.staging.defined() ||
+          !slot.staging.sizes().equals(tensor.sizes()) ||
+          slot.staging.scalar_type() != tensor.scalar_type()) {
+        slot.staging = at::empty(
+            tensor.sizes(), tensor.options().pinned_memory(true));
+        slot.pending_copy_stream = c10::nullopt;
+      } else if (slot.pending_copy_stream) {
+        // the previous run's device copy reads from this buffer; it has
+        // almost always finished by the time the next request arrives
+        impl.synchronizeStream(*slot.pending_copy_stream);
+      }
+      slot.staging.copy_(tensor);
+      source = slot.staging;
+    }
+
+    at::Tensor transferred = at::empty(
+        tensor.sizes(),
+        tensor.options().device(device).pinned_memory(false));
+    c10::Stream transfer_stream =
+        impl.getStreamFromGlobalPool(device, /*isHighPriority=*/false);
+    c10::Event copy_done(device.type());
+    {
+      c10::StreamGuard guard(transfer_stream);
+      transferred.copy_(source, /*non_blocking=*/true);
+      copy_done.record(transfer_stream);
+      impl.recordDataPtrOnStream(
+          transferred.storage().data_ptr(), transfer_stream);
+    }
+    // order the compute stream after the copy without blocking the CPU, so
+    // interpretation (and any CPU-side ops in the graph) overlaps with the
+    // transfer until the first consumer of this input runs
+    copy_done.block(impl.getStream(device));
+    if (source.is_same(slot.staging)) {
+      slot.pending_copy_stream = transfer_stream;
+    }
+    iv = std::move(transferred);
+  }
+}
+
 void GraphExecutorImplBase::run(Stack& stack) {
   TORCH_CHECK(
       stack.size() >= num_inputs,
@@ -579,6 +709,13 @@ void GraphExecutorImplBase::run(Stack& stack) {
   logging::getLogger()->addStatValue(
       logging::runtime_counters::GRAPH_EXECUTOR_INVOCATIONS, 1.0);
 
+  if (getGraphExecutorInputTransfer()) {
+    std::call_once(input_transfer_once_, [this] {
+      input_transfer_stage_ = std::make_unique<InputTransferStage>(graph);
+    });
+    input_transfer_stage_->transferInputs(stack, num_inputs);
+  }
+
   const ExecutionPlan& plan = getPlanFor(stack);
   InterpreterState(plan.code).run(stack);
   last_executed_optimized_graph = plan.graph;
@@ -598,6 +735,13 @@ c10::intrusive_ptr<Future> GraphExecutorImplBase::runAsync(
   logging::getLogger()->addStatValue(
       logging::runtime_counters::GRAPH_EXECUTOR_INVOCATIONS, 1.0);
 
+  if (getGraphExecutorInputTransfer()) {
+    std::call_once(input_transfer_once_, [this] {
+      input_transfer_stage_ = std::make_unique<InputTransferStage>(graph);
+    });
+    input_transfer_stage_->transferInputs(stack, num_inputs);
+  }
+
   struct Frame {
     explicit Frame(ExecutionPlan eplan, TaskLauncher taskLauncher)
         : plan(std::move(eplan)), state(plan.code, std::move(taskLauncher)) {}
@@ -963,10 +1107,74 @@ void runNondiffOptimization(
       "After customPostPassses (end of runNondiffOptimization)\n", *graph);
 }
 
+namespace {
+
+void hashTensorConstants(Block* block, size_t& hash) {
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::Constant && n->hasAttribute(attr::value) &&
+        n->kindOf(attr::value) == AttributeKind::t) {
+      hash = c10::hash_combine(
+          hash,
+          reinterpret_cast<size_t>(n->t(attr::value).unsafeGetTensorImpl()));
+    }
+    for (Block* sub_block : n->blocks()) {
+      hashTensorConstants(sub_block, hash);
+    }
+  }
+}
+
+// Fingerprints a graph by its textual form plus the identity of its tensor
+// constants (which print elided) and the optimization flags. Fingerprints of
+// runOptimization outputs are memoized so that graphs already at their
+// optimized fixed point - typically unchanged subgraphs when a many-method
+// module is re-optimized after minor edits - skip the pipeline entirely.
+size_t fingerprintGraph(
+    const std::shared_ptr<Graph>& graph,
+    bool unroll_non_constant_loops,
+    bool const_prop_user_classes) {
+  size_t hash = std::hash<std::string>()(
+      graph->toString(/*print_source_locations*/ false));
+  hashTensorConstants(graph->block(), hash);
+  hash = c10::hash_combine(
+      hash,
+      (unroll_non_constant_loops ? 1 : 0) | (const_prop_user_classes ? 2 : 0));
+  return hash;
+}
+
+// Bounds the memo so a long-lived process recompiling many graphs does not
+// grow it without limit; once hit, it simply starts over.
+constexpr size_t kMaxOptimizedFingerprints = 8192;
+
+std::mutex optimized_fingerprints_mutex;
+std::unordered_set<size_t> optimized_fingerprints;
+
+bool isOptimizedFingerprint(size_t fingerprint) {
+  std::lock_guard<std::mutex> lock(optimized_fingerprints_mutex);
+  return optimized_fingerprints.count(fingerprint) != 0;
+}
+
+void recordOptimizedFingerprint(size_t fingerprint) {
+  std::lock_guard<std::mutex> lock(optimized_fingerprints_mutex);
+  if (optimized_fingerprints.size() >= kMaxOptimizedFingerprints) {
+    optimized_fingerprints.clear();
+  }
+  optimized_fingerprints.insert(fingerprint);
+}
+
+} // anonymous namespace
+
 void runOptimization(
     std::shared_ptr<Graph>& graph,
     bool unroll_non_constant_loops,
     bool const_prop_user_classes) {
+  if (isOptimizedFingerprint(fingerprintGraph(
+          graph, unroll_non_constant_loops, const_prop_user_classes))) {
+    GRAPH_DEBUG(
+        "Graph is already at its optimized fixed point, skipping runOptimization\n",
+        *graph);
+    return;
+  }
+
   // Basic graph preprocessing to eliminate noise.
   GRAPH_DEBUG(
       "Before EliminateDeadCode (beginning of runOptimization)\n", *graph);
@@ -1017,6 +1225,57 @@ void runOptimization(
       "After EliminateCommonSubexpression, before CheckInplace\n", *graph);
   CheckInplace(graph);
   GRAPH_DEBUG("After CheckInplace (end of runOptimization)\n", *graph);
+
+  recordOptimizedFingerprint(fingerprintGraph(
+      graph, unroll_non_constant_loops, const_prop_user_classes));
+}
+
+void runOptimizationBatch(
+    std::vector<std::shared_ptr<Graph>>& graphs,
+    bool unroll_non_constant_loops,
+    bool const_prop_user_classes) {
+  if (graphs.size() <= 1) {
+    for (auto& graph : graphs) {
+      runOptimization(graph, unroll_non_constant_loops, const_prop_user_classes);
+    }
+    return;
+  }
+
+  // The graphs are independent, so optimize them concurrently on the
+  // inter-op thread pool, the same pool that executes forked subgraphs.
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t remaining = graphs.size();
+  std::exception_ptr first_exception;
+  for (auto& graph : graphs) {
+    at::launch([&mutex,
+                &cv,
+                &remaining,
+                &first_exception,
+                &graph,
+                unroll_non_constant_loops,
+                const_prop_user_classes] {
+      try {
+        runOptimization(
+            graph, unroll_non_constant_loops, const_prop_user_classes);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!first_exception) {
+          first_exception = std::current_exception();
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        --remaining;
+      }
+      cv.notify_one();
+    });
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&] { return remaining == 0; });
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
 }
 
 Node* replaceBlockWithFallbackGraph(Block* b, ArrayRef<Value*> inputs) {
@@ -104,6 +104,14 @@ TORCH_API void runRequiredPasses(const std::shared_ptr<Graph>& g);
 TORCH_API void debugSetFusionGroupInlining(bool state);
 TORCH_API bool getFusionGroupInlining();
 
+// When enabled, the graph executor pre-transfers CPU graph inputs that the
+// graph immediately moves to an accelerator, staging them through reusable
+// pinned buffers and an async copy on a side stream so that the transfer
+// overlaps with any CPU-side work that runs before the first consumer.
+// Defaults to the PYTORCH_JIT_ENABLE_INPUT_TRANSFER environment variable.
+TORCH_API void setGraphExecutorInputTransfer(bool enabled);
+TORCH_API bool getGraphExecutorInputTransfer();
+
 TORCH_API void debugSetAutodiffSubgraphInlining(bool state);
 TORCH_API std::shared_ptr<Graph> lastExecutedOptimizedGraph();
 
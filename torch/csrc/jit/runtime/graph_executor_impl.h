@@ -2,6 +2,7 @@
 #include <torch/csrc/jit/runtime/graph_executor.h>
 
 #include <ATen/core/ivalue.h>
+#include <c10/core/Stream.h>
 #include <c10/util/Exception.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/jit/frontend/tracer.h>
@@ -36,6 +37,14 @@ void runOptimization(
     std::shared_ptr<Graph>& graph,
     bool unroll_non_constant_loops = true,
     bool const_prop_user_classes = true);
+// Optimizes independent graphs concurrently on the inter-op thread pool.
+// Results are memoized by graph fingerprint (see runOptimization), so
+// re-optimizing a mostly unchanged set of subgraphs only pays for the
+// edited ones.
+void runOptimizationBatch(
+    std::vector<std::shared_ptr<Graph>>& graphs,
+    bool unroll_non_constant_loops = true,
+    bool const_prop_user_classes = true);
 void runNondiffOptimization(
     std::shared_ptr<Graph>& graph,
     bool strict_fuser_check = false);
@@ -50,6 +59,41 @@ bool getFusionGroupInlining();
 const size_t autodiffSubgraphNodeThreshold = 2;
 const size_t autodiffSubgraphInlineThreshold = 5;
 
+// Moves CPU graph inputs to their eventual device ahead of interpretation.
+// The stage learns, from a scan of the graph, which tensor inputs are
+// immediately moved to an accelerator (i.e. every use is an aten::to with
+// a constant device argument); run() then replaces those stack entries
+// with tensors that are already being copied to that device, staging each
+// one through a reusable pinned buffer and issuing the copy on a stream
+// from the device's global pool. The compute stream is made to wait on the
+// copy with an event, so interpretation of CPU-side ops proceeds while the
+// transfer is in flight and the graph's own aten::to becomes a no-op.
+struct InputTransferStage {
+  explicit InputTransferStage(const std::shared_ptr<Graph>& graph);
+
+  bool hasTransfers() const {
+    return !slots_.empty();
+  }
+
+  // Replaces eligible CPU tensors at the top of the stack (the last
+  // `num_inputs` entries) with their in-flight device copies. Inputs that
+  // do not match what was learned from the graph are left untouched.
+  void transferInputs(Stack& stack, size_t num_inputs);
+
+ private:
+  struct Slot {
+    size_t input; // graph input index
+    c10::Device device; // device every use of this input moves it to
+    at::Tensor staging; // reusable pinned staging buffer
+    // stream the last copy out of `staging` was issued on; it must finish
+    // before the buffer can be refilled
+    c10::optional<c10::Stream> pending_copy_stream;
+  };
+  std::vector<Slot> slots_;
+  // staging buffers are not thread-safe; concurrent callers skip the stage
+  std::mutex mutex_;
+};
+
 // a Graph can be created via tracing, or via a language-based frontend
 // GraphExecutor runs it. It can run the same graph on many different sizes
 // and different requires_grad states, and handles specializations for each
@@ -109,6 +153,12 @@ struct GraphExecutorImplBase {
   // to be held every time we access the fallback or plan_cache.
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::mutex compile_mutex;
+
+  // Lazily constructed on the first run with input transfer enabled.
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::unique_ptr<InputTransferStage> input_transfer_stage_;
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  std::once_flag input_transfer_once_;
 };
 
 } // namespace jit
@@ -73,7 +73,17 @@ namespace jit {
   _(FORK, "CN") /* launch a thread to run code entry x with N inputs  */       \
   _(WARN, "I") /* emit a warning with line information */                      \
   _(ENTER, "EN") /* enter scope of a contextmanager */                         \
-  _(EXIT, "EX") /* exit the last entered contextmanager */
+  _(EXIT, "EX") /* exit the last entered contextmanager */                     \
+  _(LOAD_LOAD, "RI") /* push values from registers X and then N */             \
+  _(LOAD_MOVE, "RI") /* push register X, then push and clear register N */     \
+  _(MOVE_MOVE, "RI") /* push and clear register X, then register N */          \
+  _(OP_STORE, "OI") /* invoke operator X, store the result to register N */    \
+  _(OP_DROP, "O") /* invoke operator X, drop the unused result */
+
+// The last five opcodes are superinstructions: CodeImpl::fuseInstructions
+// rewrites common adjacent instruction pairs into them after emission to
+// cut interpreter dispatch overhead. They are never emitted directly and
+// never appear in serialized (mobile) bytecode.
 
 enum OpCode : uint8_t {
 #define DEFINE_OP(op, _) op,
@@ -50,6 +50,11 @@ C10_DEFINE_bool(
     false,
     "enable rethrowing caught exception");
 
+C10_DEFINE_bool(
+    torch_jit_enable_superinstructions,
+    true,
+    "fuse common adjacent instruction pairs into superinstructions");
+
 namespace torch {
 namespace jit {
 
@@ -232,6 +237,12 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 #define INST_NEXT       \
   inst = INST_FETCH(1); \
   INST_DISPATCH
+// Superinstructions replace the first instruction of a fused pair; the
+// second one is left behind as an unreachable filler (so that jump offsets
+// stay valid) and is skipped by advancing the pc by two.
+#define INST_NEXT_FUSED \
+  inst = INST_FETCH(2); \
+  INST_DISPATCH
 
   bool runImpl(Stack& stack) {
     // if we have never run before, then we might have to return the
@@ -322,6 +333,48 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             reg(inst.X) = pop(stack);
           }
             INST_NEXT;
+          case INST(LOAD_LOAD): {
+            INST_GUARD;
+            stack.emplace_back(reg(inst.X));
+            stack.emplace_back(reg(inst.N));
+          }
+            INST_NEXT_FUSED;
+          case INST(LOAD_MOVE): {
+            INST_GUARD;
+            stack.emplace_back(reg(inst.X));
+            stack.emplace_back(std::move(reg(inst.N)));
+          }
+            INST_NEXT_FUSED;
+          case INST(MOVE_MOVE): {
+            INST_GUARD;
+            stack.emplace_back(std::move(reg(inst.X)));
+            stack.emplace_back(std::move(reg(inst.N)));
+          }
+            INST_NEXT_FUSED;
+          case INST(OP_STORE): {
+            INST_GUARD;
+#ifndef NDEBUG
+            size_t init_size = stack.size();
+#endif
+            frame.function->operator_table_[inst.X](stack);
+#ifndef NDEBUG
+            frame.function->assert_stack_size(inst.X, init_size, stack.size());
+#endif
+            reg(inst.N) = pop(stack);
+          }
+            INST_NEXT_FUSED;
+          case INST(OP_DROP): {
+            INST_GUARD;
+#ifndef NDEBUG
+            size_t init_size = stack.size();
+#endif
+            frame.function->operator_table_[inst.X](stack);
+#ifndef NDEBUG
+            frame.function->assert_stack_size(inst.X, init_size, stack.size());
+#endif
+            stack.pop_back();
+          }
+            INST_NEXT_FUSED;
           case INST(STOREN): {
             INST_GUARD;
             for (size_t i = inst.N; i > 0; --i) {
@@ -1121,6 +1174,45 @@ size_t Code::register_size() const {
   return pImpl->register_size_;
 }
 
+namespace {
+struct InstructionPairProfile {
+  std::mutex mutex;
+  std::unordered_map<std::string, int64_t> counts;
+};
+
+InstructionPairProfile& getInstructionPairProfile() {
+  static InstructionPairProfile profile;
+  return profile;
+}
+} // namespace
+
+void recordInstructionPairProfile(
+    const std::vector<Instruction>& instructions) {
+  if (instructions.size() < 2) {
+    return;
+  }
+  auto& profile = getInstructionPairProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  for (size_t i = 0; i + 1 < instructions.size(); ++i) {
+    std::string key = toString(instructions[i].op);
+    key += ' ';
+    key += toString(instructions[i + 1].op);
+    ++profile.counts[key];
+  }
+}
+
+std::unordered_map<std::string, int64_t> getInstructionPairFrequencies() {
+  auto& profile = getInstructionPairProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  return profile.counts;
+}
+
+void resetInstructionPairFrequencies() {
+  auto& profile = getInstructionPairProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+  profile.counts.clear();
+}
+
 InterpreterState::InterpreterState(const Code& code, TaskLauncher taskLauncher)
     : pImpl(c10::make_intrusive<InterpreterStateImpl>(
           code,
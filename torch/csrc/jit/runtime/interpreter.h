@@ -1,6 +1,8 @@
 #pragma once
 #include <c10/util/Optional.h>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ATen/ThreadLocalState.h>
@@ -16,6 +18,7 @@ C10_CLANG_DIAGNOSTIC_IGNORE("-Wdeprecated-copy-dtor")
 
 C10_DECLARE_bool(torch_jit_disable_warning_prints);
 C10_DECLARE_bool(torch_jit_enable_rethrow_caught_exception);
+C10_DECLARE_bool(torch_jit_enable_superinstructions);
 
 namespace at {
 class Tensor;
@@ -163,6 +166,15 @@ TORCH_API at::TensorTypePtr tensorTypeInCurrentExecutionContext(
 TORCH_API std::vector<StackEntry> currentCallstack();
 TORCH_API std::vector<std::string> currentModuleHierarchy();
 
+// Process-wide profile of adjacent opcode pairs seen while compiling code
+// objects, recorded before superinstruction fusion. Keys look like
+// "LOAD MOVE"; use the counts to decide which pairs are worth fusing next.
+TORCH_API void recordInstructionPairProfile(
+    const std::vector<Instruction>& instructions);
+TORCH_API std::unordered_map<std::string, int64_t>
+getInstructionPairFrequencies();
+TORCH_API void resetInstructionPairFrequencies();
+
 } // namespace jit
 } // namespace torch
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -12,6 +13,7 @@
 #include <torch/csrc/jit/runtime/calculate_necessary_args.h>
 #include <torch/csrc/jit/runtime/graph_iterator.h>
 #include <torch/csrc/jit/runtime/instruction.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
 #include <torch/csrc/jit/runtime/interpreter/preprocess_graph.h>
 
 namespace torch {
@@ -118,9 +120,8 @@ struct CodeImpl {
 
   std::unordered_map<std::string, size_t> op_to_num_out_args_;
 
-  // running count of uses as we emit. When we reach use_count_[v] =
-  // v.uses().size() we know it is the final use and we can move rather than
-  // load.
+  // running count of uses as we emit, indexing into the per-use move flags
+  // computed by the preprocessing step (see isMovableUse)
   std::unordered_map<Value*, size_t> use_count_;
 
   Node* current_node_; // used in creation of code to keep track
@@ -174,6 +175,64 @@ struct CodeImpl {
     // we deferred the emission of bailout blocks so they appear at the end
     // emit them now and patch up the jumps
     insertBailoutBlocks();
+    fuseInstructions();
+  }
+
+  // Fuses common adjacent instruction pairs into superinstructions to save
+  // a dispatch in the interpreter loop (see runImpl for the handlers). The
+  // second instruction of a fused pair stays in place as an unreachable
+  // filler so that jump offsets, bailout indices and instructions_source_
+  // remain valid; the fused handler skips it by advancing the pc by two.
+  // MobileCodeImpl overrides run() and never calls this, so serialized
+  // bytecode only contains the ordinary opcodes.
+  void fuseInstructions() {
+    if (!FLAGS_torch_jit_enable_superinstructions ||
+        instructions_.size() < 2) {
+      return;
+    }
+    recordInstructionPairProfile(instructions_);
+    // a pair cannot be fused when control flow can enter at its second
+    // instruction
+    std::vector<bool> is_jump_target(instructions_.size(), false);
+    for (const auto i : c10::irange(instructions_.size())) {
+      OpCode op = instructions_[i].op;
+      if (op == JF || op == JMP || op == LOOP) {
+        size_t target = i + instructions_[i].X;
+        if (target < instructions_.size()) {
+          is_jump_target[target] = true;
+        }
+      }
+    }
+    constexpr int32_t max_n = std::numeric_limits<uint16_t>::max();
+    for (size_t i = 0; i + 1 < instructions_.size(); ++i) {
+      if (is_jump_target[i + 1]) {
+        continue;
+      }
+      Instruction& first = instructions_[i];
+      const Instruction& second = instructions_[i + 1];
+      // the second operand is narrowed into the N field, so huge register
+      // and operator indices are left unfused
+      if (second.X < 0 || second.X > max_n) {
+        continue;
+      }
+      c10::optional<OpCode> fused;
+      if (first.op == LOAD && second.op == LOAD) {
+        fused = LOAD_LOAD;
+      } else if (first.op == LOAD && second.op == MOVE) {
+        fused = LOAD_MOVE;
+      } else if (first.op == MOVE && second.op == MOVE) {
+        fused = MOVE_MOVE;
+      } else if (first.op == OP && second.op == STORE) {
+        fused = OP_STORE;
+      } else if (first.op == OP && second.op == DROP) {
+        fused = OP_DROP;
+      }
+      if (fused) {
+        first = Instruction(*fused, first.X, second.X);
+        // skip the filler slot so it is not considered for another pair
+        ++i;
+      }
+    }
   }
 
   const std::vector<c10::IValue>& constant_table() const {
@@ -276,13 +335,12 @@ struct CodeImpl {
       }
     } else {
       int reg = registerFor(input);
-      bool moved = input->uses().size() == ++use_count_[input];
 
       // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
       OpCode op;
       if (input->node()->kind() == prim::Constant) {
         op = LOADC;
-      } else if (moved) {
+      } else if (isMovableUse(input)) {
         op = MOVE;
       } else {
         op = LOAD;
@@ -295,6 +353,19 @@ struct CodeImpl {
     }
   }
 
+  // move_flags records, per value and in emission order, whether each use is
+  // the last read on every execution path that reaches it. Some emitters
+  // legitimately skip uses (e.g. trailing default arguments on mobile), so
+  // fall back to a plain LOAD when we run past the recorded flags.
+  bool isMovableUse(Value* input) {
+    const auto it = preprocess_.move_flags.find(input);
+    if (it == preprocess_.move_flags.end()) {
+      return false;
+    }
+    size_t use_index = use_count_[input]++;
+    return use_index < it->second.size() && it->second[use_index];
+  }
+
   void emitLoadInputs(at::ArrayRef<Value*> inputs) {
     for (Value* input : inputs) {
       emitUse(input, false);
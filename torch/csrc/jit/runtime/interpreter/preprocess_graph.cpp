@@ -1,5 +1,7 @@
 #include <torch/csrc/jit/runtime/interpreter/preprocess_graph.h>
 
+#include <algorithm>
+
 #include <torch/csrc/jit/frontend/schema_matching.h>
 #include <torch/csrc/jit/runtime/interpreter/can_emit_inline.h>
 
@@ -204,13 +206,137 @@ void insertLastUses(Graph& g) {
   InsertLastUses ilu(g);
 }
 
+// decide, for every use of a value, whether the interpreter may MOVE the
+// value out of its register rather than copy it with a LOAD (and the
+// refcount bump that entails). A use may move exactly when no execution
+// path that reaches it reads the value again afterwards. For straight-line
+// code that is simply the textually last use, which the emitter used to
+// derive from a running use count, but that rule is too strict around
+// control flow: a value whose last use is nested in an If was loaded in
+// both branches and only released by the Drop node that insertLastUses
+// places after the If. Scanning each branch with its own copy of the
+// liveness state lets every branch move the values it reads last; the Drop
+// after the If then merely clears a register that is already empty on the
+// path that moved it, which touches no refcount. Reads inside a Loop body
+// of values defined outside the body are never moves, since the next
+// iteration reads the value again.
+struct ComputeMoveFlags {
+  // flags per value, gathered in reverse emission order and flipped at the
+  // end; CodeImpl::emitUse consumes them with a running per-value index
+  std::unordered_map<Value*, std::vector<bool>> move_flags_;
+
+  explicit ComputeMoveFlags(Graph& g) {
+    std::unordered_set<Value*> live;
+    scanBlock(g.block(), live);
+    for (auto& entry : move_flags_) {
+      std::reverse(entry.second.begin(), entry.second.end());
+    }
+    // some uses are never emitted: aten::warn may be skipped entirely at
+    // emission time (torch_jit_disable_warning_prints) and prim::Exit does
+    // not load its input (EXIT pops the entered-objects stack instead).
+    // A skipped use would throw the per-value use index out of sync with
+    // the recorded flags, so force all uses of these operands to plain
+    // loads; a skew can then never turn into an early move
+    for (Value* v : skipped_operands_) {
+      auto& flags = move_flags_[v];
+      flags.assign(flags.size(), false);
+    }
+  }
+
+  void scanBlock(Block* b, std::unordered_set<Value*>& live) {
+    scanNode(b->return_node(), live);
+    for (auto n : b->nodes().reverse()) {
+      scanNode(n, live);
+    }
+  }
+
+  void scanNode(Node* n, std::unordered_set<Value*>& live) {
+    if (n->kind() == prim::If) {
+      // only one branch runs, so each is scanned against the liveness state
+      // at the point just after the If and may move the values it reads last
+      auto after = live;
+      for (size_t i = n->blocks().size(); i > 0; --i) {
+        auto branch_live = after;
+        scanBlock(n->blocks()[i - 1], branch_live);
+        live.insert(branch_live.begin(), branch_live.end());
+      }
+    } else {
+      // any other nested block (a Loop body) may run more than once per
+      // entry, so everything it reads from enclosing scopes stays live
+      // throughout
+      for (size_t i = n->blocks().size(); i > 0; --i) {
+        Block* body = n->blocks()[i - 1];
+        markOuterReads(body, body, live);
+        scanBlock(body, live);
+      }
+    }
+    // inputs are emitted left to right; scan them backwards so that when a
+    // value appears twice in the list only the rightmost use is the move
+    for (size_t i = n->inputs().size(); i > 0; --i) {
+      scanUse(n, i - 1, live);
+    }
+  }
+
+  void scanUse(Node* n, size_t i, std::unordered_set<Value*>& live) {
+    Value* v = n->inputs()[i];
+    if (v->node()->kind() == prim::Constant) {
+      // constants are loaded from the constant table, never from a register
+      return;
+    }
+    if (n->kind() == prim::Drop) {
+      // a Drop clears the register but does not read the value
+      move_flags_[v].push_back(false);
+      return;
+    }
+    if (n->kind() == aten::warn || n->kind() == prim::Exit) {
+      skipped_operands_.insert(v);
+    }
+    move_flags_[v].push_back(live.insert(v).second);
+  }
+
+  // mark every value read anywhere inside 'b' but defined outside of
+  // 'boundary' as live, so uses of it within a Loop body are never moves
+  void markOuterReads(
+      Block* b,
+      Block* boundary,
+      std::unordered_set<Value*>& live) {
+    auto mark = [&](Node* node) {
+      for (Value* v : node->inputs()) {
+        if (!isDefinedInside(v, boundary)) {
+          live.insert(v);
+        }
+      }
+    };
+    mark(b->return_node());
+    for (auto n : b->nodes()) {
+      mark(n);
+      for (auto sub : n->blocks()) {
+        markOuterReads(sub, boundary, live);
+      }
+    }
+  }
+
+  static bool isDefinedInside(Value* v, Block* b) {
+    for (Node* n = v->node(); n != nullptr;
+         n = n->owningBlock() ? n->owningBlock()->owningNode() : nullptr) {
+      if (n->owningBlock() == b) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::unordered_set<Value*> skipped_operands_;
+};
+
 } // namespace
 
 PreprocessGraph::PreprocessGraph(Graph& g) : graph(g.copy()) {
   insertEnterMethodCalls(*graph);
   dropUnused(graph->block());
-  // fill in move_flags by scanning blocks;
   insertLastUses(*graph);
+  // fill in move_flags by scanning blocks;
+  move_flags = std::move(ComputeMoveFlags(*graph).move_flags_);
   can_emit_inline = std::move(CanEmitInline(*graph.get()).can_emit_inline_);
 }
 } // namespace interpreter
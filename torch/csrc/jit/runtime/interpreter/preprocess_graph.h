@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <torch/csrc/jit/ir/ir.h>
 
@@ -16,6 +17,11 @@ struct PreprocessGraph {
   // Outputs of the preprocessing:
   std::shared_ptr<Graph> graph;
   std::unordered_map<Node*, bool> can_emit_inline;
+  // for each non-constant value, one flag per use in the order the emitter
+  // visits them: true if no execution path that reaches the use reads the
+  // value again afterwards, so the value can be MOVEd out of its register
+  // instead of copied with a LOAD
+  std::unordered_map<Value*, std::vector<bool>> move_flags;
 };
 
 } // namespace interpreter
@@ -19,6 +19,7 @@
 #include <torch/csrc/jit/passes/decompose_ops.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/guard_elimination.h>
+#include <torch/csrc/jit/passes/hoist_loop_invariant_getattrs.h>
 #include <torch/csrc/jit/passes/inline_autodiff_subgraphs.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/passes/inplace_check.h>
@@ -553,7 +554,13 @@ void ProfilingGraphExecutorImpl::runProfilingInsensitiveOptimizations(
     return;
   }
 
-  GRAPH_DEBUG("After EliminateDeadCode, before DecomposeOps\n", *graph);
+  GRAPH_DEBUG(
+      "After EliminateDeadCode, before HoistLoopInvariantGetAttrs\n", *graph);
+  // Attribute reads not invalidated inside a loop (e.g. the parameters of a
+  // scripted RNN cell) are resolved once, ahead of the loop.
+  HoistLoopInvariantGetAttrs(graph);
+  GRAPH_DEBUG(
+      "After HoistLoopInvariantGetAttrs, before DecomposeOps\n", *graph);
   DecomposeOps(graph);
   GRAPH_DEBUG("After DecomposeOps, before ConstantPropagation\n", *graph);
   ConstantPropagation(graph);
@@ -678,6 +685,62 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   return *optimized_plan_;
 }
 
+std::atomic<size_t>& getPlanCacheSize() {
+  static std::atomic<size_t> plan_cache_size{0};
+  return plan_cache_size;
+}
+
+std::atomic<size_t>& getPlanCacheHits() {
+  static std::atomic<size_t> plan_cache_hits{0};
+  return plan_cache_hits;
+}
+
+std::atomic<size_t>& getPlanCacheMisses() {
+  static std::atomic<size_t> plan_cache_misses{0};
+  return plan_cache_misses;
+}
+
+const ExecutionPlan& ProfilingGraphExecutorImpl::getCachedPlanFor(
+    Stack& stack,
+    c10::optional<size_t> remaining_bailout_depth) {
+  if (!arg_spec_creator_) {
+    arg_spec_creator_.emplace(*graph);
+  }
+  ArgumentSpec spec =
+      arg_spec_creator_->create(autograd::GradMode::is_enabled(), stack);
+  auto it = plan_cache_.find(spec);
+  if (it != plan_cache_.end()) {
+    getPlanCacheHits()++;
+    plan_cache_lru_.splice(
+        plan_cache_lru_.begin(), plan_cache_lru_, it->second.second);
+    return it->second.first;
+  }
+  getPlanCacheMisses()++;
+  // The current plan (if any) was specialized for a different ArgumentSpec;
+  // restart profiling so the new plan specializes on the present inputs
+  // instead of reusing stale profiled properties.
+  if (optimized_plan_) {
+    pr_.reset();
+    profiling_plan_.reset();
+    optimized_plan_.reset();
+  }
+  const ExecutionPlan& plan =
+      getOptimizedPlanFor(stack, remaining_bailout_depth);
+  if (!optimized_plan_) {
+    // Still warming up (profiling or no-opt plan); nothing to cache yet.
+    return plan;
+  }
+  const size_t capacity = getPlanCacheSize();
+  while (plan_cache_.size() >= capacity && !plan_cache_lru_.empty()) {
+    plan_cache_.erase(plan_cache_lru_.back());
+    plan_cache_lru_.pop_back();
+  }
+  plan_cache_lru_.push_front(spec);
+  auto r = plan_cache_.emplace(
+      std::move(spec), std::make_pair(plan, plan_cache_lru_.begin()));
+  return r.first->second.first;
+}
+
 const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     Stack& stack,
     c10::optional<size_t> remaining_bailout_depth) {
@@ -685,6 +748,10 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
 
   // IMPORTANT: This is a hot path of calling a torchscript function. Try not to
   // add any code above this.
+  if (C10_UNLIKELY(getPlanCacheSize() > 0) && getGraphExecutorOptimize() &&
+      getProfilingMode()) {
+    return getCachedPlanFor(stack, remaining_bailout_depth);
+  }
   if (optimized_plan_) {
     return *optimized_plan_;
   }
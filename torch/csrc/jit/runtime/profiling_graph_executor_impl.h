@@ -3,6 +3,9 @@
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/runtime/graph_executor_impl.h>
 
+#include <list>
+#include <unordered_map>
+
 C10_DECLARE_bool(torch_jit_static_then_dynamic);
 
 C10_DECLARE_bool(torch_jit_always_dynamic);
@@ -12,6 +15,19 @@ namespace jit {
 
 TORCH_API void runNooptPassPipeline(std::shared_ptr<Graph>& graph);
 
+// Capacity of the shape-keyed plan cache in ProfilingGraphExecutorImpl.
+// When nonzero, the executor keeps up to this many specialized plans keyed
+// by the ArgumentSpec of the inputs (with LRU eviction) instead of a single
+// optimized plan, so workloads alternating between a few input shapes each
+// get a stable plan rather than repeatedly falling off their guards. Zero
+// (the default) preserves the single-plan behavior.
+TORCH_API std::atomic<size_t>& getPlanCacheSize();
+
+// Process-wide hit/miss counters for the plan cache, exposed to Python for
+// diagnosing recompilation thrash.
+TORCH_API std::atomic<size_t>& getPlanCacheHits();
+TORCH_API std::atomic<size_t>& getPlanCacheMisses();
+
 struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   ProfilingGraphExecutorImpl(
       const std::shared_ptr<Graph>& graph,
@@ -29,6 +45,8 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
     fallback_plan_.reset();
     profiling_plan_.reset();
     optimized_plan_.reset();
+    plan_cache_.clear();
+    plan_cache_lru_.clear();
     // prevent memory leaks
     fallback_functions_.clear();
     remaining_bailout_depth_.reset();
@@ -44,6 +62,9 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   const ExecutionPlan& getOptimizedPlanFor(
       Stack& stack,
       c10::optional<size_t> remaining_bailout_depth);
+  const ExecutionPlan& getCachedPlanFor(
+      Stack& stack,
+      c10::optional<size_t> remaining_bailout_depth);
   void runProfilingInsensitiveOptimizations(std::shared_ptr<Graph>& graph);
   void runProfilingOptimizations(
       std::shared_ptr<Graph>& graph,
@@ -73,6 +94,16 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   // of the GraphExecutor and only shared with InterpreterState
   std::vector<std::unique_ptr<Function>> fallback_functions_;
   c10::optional<size_t> remaining_bailout_depth_;
+
+  // Shape-keyed plan cache, used only when getPlanCacheSize() > 0. Each
+  // entry holds the specialized plan together with its position in the LRU
+  // list, whose back is the eviction candidate.
+  c10::optional<ArgumentSpecCreator> arg_spec_creator_;
+  std::list<ArgumentSpec> plan_cache_lru_;
+  std::unordered_map<
+      ArgumentSpec,
+      std::pair<ExecutionPlan, std::list<ArgumentSpec>::iterator>>
+      plan_cache_;
 };
 
 } // namespace jit
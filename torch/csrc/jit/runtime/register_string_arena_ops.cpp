@@ -0,0 +1,336 @@
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/jit_type.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/runtime/custom_operator.h>
+#include <torch/csrc/jit/runtime/operator.h>
+
+#include <cstring>
+
+// Batched string kernels over a flat arena representation. Scripted text
+// preprocessing through the per-element string ops pays interpreter dispatch
+// for every character; these ops instead take a batch of strings as two
+// tensors -- int64 offsets of size n+1 and the concatenated uint8 bytes --
+// and scan the whole batch with memchr/memcmp, which libc vectorizes, so
+// tokenizer loops run at memory bandwidth. _string_to_arena /
+// _string_from_arena bridge List[str] into and out of the representation;
+// _arena_split returns zero-copy token ranges into the input bytes.
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+c10::AliasAnalysisKind aliasAnalysisFromSchema() {
+  return c10::AliasAnalysisKind::FROM_SCHEMA;
+}
+
+void checkArena(const at::Tensor& offsets, const at::Tensor& bytes) {
+  TORCH_CHECK(
+      offsets.dim() == 1 && offsets.scalar_type() == at::kLong &&
+          offsets.is_contiguous(),
+      "string arena offsets must be a contiguous 1-D int64 tensor");
+  TORCH_CHECK(
+      bytes.dim() == 1 && bytes.scalar_type() == at::kByte &&
+          bytes.is_contiguous(),
+      "string arena bytes must be a contiguous 1-D uint8 tensor");
+  TORCH_CHECK(
+      offsets.numel() >= 1,
+      "string arena offsets must hold at least one entry");
+  TORCH_CHECK(
+      offsets[offsets.numel() - 1].item<int64_t>() == bytes.numel(),
+      "string arena offsets do not match the bytes tensor");
+}
+
+// memmem is not portable; memchr on the first byte plus memcmp on the rest
+// keeps the scan in vectorized libc code.
+const char* findSubstr(
+    const char* haystack,
+    int64_t haystack_len,
+    const char* needle,
+    int64_t needle_len) {
+  if (needle_len == 0 || needle_len > haystack_len) {
+    return needle_len == 0 ? haystack : nullptr;
+  }
+  const char* pos = haystack;
+  const char* end = haystack + haystack_len - needle_len + 1;
+  while (pos < end &&
+         (pos = static_cast<const char*>(
+              std::memchr(pos, needle[0], end - pos))) != nullptr) {
+    if (std::memcmp(pos, needle, needle_len) == 0) {
+      return pos;
+    }
+    ++pos;
+  }
+  return nullptr;
+}
+
+RegisterOperators reg({
+    OperatorGenerator(
+        TORCH_SELECTIVE_SCHEMA(
+            "aten::_string_to_arena(str[] strings) -> (Tensor, Tensor)"),
+        [](Stack& stack) {
+          auto strings = pop(stack).toListRef();
+          const auto n = static_cast<int64_t>(strings.size());
+          auto offsets = at::empty({n + 1}, at::kLong);
+          auto offsets_data = offsets.data_ptr<int64_t>();
+          int64_t total = 0;
+          for (const auto i : c10::irange(n)) {
+            offsets_data[i] = total;
+            total += static_cast<int64_t>(strings[i].toStringRef().size());
+          }
+          offsets_data[n] = total;
+          auto bytes = at::empty({total}, at::kByte);
+          auto* bytes_data = static_cast<char*>(bytes.data_ptr());
+          for (const auto i : c10::irange(n)) {
+            const auto& s = strings[i].toStringRef();
+            std::memcpy(bytes_data + offsets_data[i], s.data(), s.size());
+          }
+          push(stack, std::move(offsets), std::move(bytes));
+        },
+        aliasAnalysisFromSchema()),
+    OperatorGenerator(
+        TORCH_SELECTIVE_SCHEMA(
+            "aten::_string_from_arena(Tensor offsets, Tensor bytes) -> str[]"),
+        [](Stack& stack) {
+          auto bytes = pop(stack).toTensor();
+          auto offsets = pop(stack).toTensor();
+          checkArena(offsets, bytes);
+          const auto n = offsets.numel() - 1;
+          const auto* offsets_data = offsets.data_ptr<int64_t>();
+          const auto* bytes_data = static_cast<const char*>(bytes.data_ptr());
+          auto result = c10::impl::GenericList(c10::StringType::get());
+          result.reserve(n);
+          for (const auto i : c10::irange(n)) {
+            result.emplace_back(std::string(
+                bytes_data + offsets_data[i],
+                offsets_data[i + 1] - offsets_data[i]));
+          }
+          push(stack, std::move(result));
+        },
+        aliasAnalysisFromSchema()),
+    // Splits every string of the arena on a non-empty separator. Returns
+    // row_splits (int64, n+1: token count prefix sum per input string) and
+    // ranges (int64, [num_tokens, 2]: begin/end byte positions into the
+    // input bytes tensor), so no token bytes are copied. Adjacent
+    // separators produce empty tokens, matching aten::split.str with an
+    // explicit separator.
+    OperatorGenerator(
+        TORCH_SELECTIVE_SCHEMA(
+            "aten::_arena_split(Tensor offsets, Tensor bytes, str separator) -> (Tensor, Tensor)"),
+        [](Stack& stack) {
+          auto separator = pop(stack).toStringRef();
+          auto bytes = pop(stack).toTensor();
+          auto offsets = pop(stack).toTensor();
+          checkArena(offsets, bytes);
+          TORCH_CHECK(
+              !separator.empty(), "_arena_split: empty separator");
+          const auto n = offsets.numel() - 1;
+          const auto sep_len = static_cast<int64_t>(separator.size());
+          const auto* offsets_data = offsets.data_ptr<int64_t>();
+          const auto* bytes_data = static_cast<const char*>(bytes.data_ptr());
+
+          auto row_splits = at::empty({n + 1}, at::kLong);
+          auto* row_splits_data = row_splits.data_ptr<int64_t>();
+          std::vector<int64_t> token_ranges;
+          token_ranges.reserve(2 * n);
+          row_splits_data[0] = 0;
+          for (const auto i : c10::irange(n)) {
+            int64_t pos = offsets_data[i];
+            const int64_t str_end = offsets_data[i + 1];
+            while (true) {
+              const char* hit = findSubstr(
+                  bytes_data + pos, str_end - pos, separator.data(), sep_len);
+              const int64_t token_end =
+                  hit != nullptr ? hit - bytes_data : str_end;
+              token_ranges.push_back(pos);
+              token_ranges.push_back(token_end);
+              if (hit == nullptr) {
+                break;
+              }
+              pos = token_end + sep_len;
+            }
+            row_splits_data[i + 1] =
+                static_cast<int64_t>(token_ranges.size() / 2);
+          }
+          const auto num_tokens =
+              static_cast<int64_t>(token_ranges.size() / 2);
+          auto ranges = at::empty({num_tokens, 2}, at::kLong);
+          std::memcpy(
+              ranges.data_ptr<int64_t>(),
+              token_ranges.data(),
+              token_ranges.size() * sizeof(int64_t));
+          push(stack, std::move(row_splits), std::move(ranges));
+        },
+        aliasAnalysisFromSchema()),
+    // Materializes token ranges produced by _arena_split back into strings,
+    // flat across the batch; use row_splits to regroup per input string.
+    OperatorGenerator(
+        TORCH_SELECTIVE_SCHEMA(
+            "aten::_arena_ranges_to_strings(Tensor ranges, Tensor bytes) -> str[]"),
+        [](Stack& stack) {
+          auto bytes = pop(stack).toTensor();
+          auto ranges = pop(stack).toTensor();
+          TORCH_CHECK(
+              ranges.dim() == 2 && ranges.size(1) == 2 &&
+                  ranges.scalar_type() == at::kLong && ranges.is_contiguous(),
+              "_arena_ranges_to_strings: ranges must be a contiguous [T, 2] int64 tensor");
+          TORCH_CHECK(
+              bytes.dim() == 1 && bytes.scalar_type() == at::kByte &&
+                  bytes.is_contiguous(),
+              "_arena_ranges_to_strings: bytes must be a contiguous 1-D uint8 tensor");
+          const auto num_tokens = ranges.size(0);
+          const auto* ranges_data = ranges.data_ptr<int64_t>();
+          const auto* bytes_data = static_cast<const char*>(bytes.data_ptr());
+          const auto num_bytes = bytes.numel();
+          auto result = c10::impl::GenericList(c10::StringType::get());
+          result.reserve(num_tokens);
+          for (const auto t : c10::irange(num_tokens)) {
+            const auto begin = ranges_data[2 * t];
+            const auto end = ranges_data[2 * t + 1];
+            TORCH_CHECK(
+                begin >= 0 && begin <= end && end <= num_bytes,
+                "_arena_ranges_to_strings: range [", begin, ", ", end,
+                ") out of bounds");
+            result.emplace_back(std::string(bytes_data + begin, end - begin));
+          }
+          push(stack, std::move(result));
+        },
+        aliasAnalysisFromSchema()),
+    // Byte position of the first occurrence of substr within each string
+    // (relative to the string, not the arena), -1 when absent; like
+    // aten::find but over the whole batch in one call.
+    OperatorGenerator(
+        TORCH_SELECTIVE_SCHEMA(
+            "aten::_arena_find(Tensor offsets, Tensor bytes, str substr) -> Tensor"),
+        [](Stack& stack) {
+          auto substr = pop(stack).toStringRef();
+          auto bytes = pop(stack).toTensor();
+          auto offsets = pop(stack).toTensor();
+          checkArena(offsets, bytes);
+          const auto n = offsets.numel() - 1;
+          const auto sub_len = static_cast<int64_t>(substr.size());
+          const auto* offsets_data = offsets.data_ptr<int64_t>();
+          const auto* bytes_data = static_cast<const char*>(bytes.data_ptr());
+          auto result = at::empty({n}, at::kLong);
+          auto* result_data = result.data_ptr<int64_t>();
+          at::parallel_for(
+              0, n, at::internal::GRAIN_SIZE / 128, [&](int64_t b, int64_t e) {
+                for (const auto i : c10::irange(b, e)) {
+                  const char* hit = findSubstr(
+                      bytes_data + offsets_data[i],
+                      offsets_data[i + 1] - offsets_data[i],
+                      substr.data(),
+                      sub_len);
+                  result_data[i] = hit != nullptr
+                      ? hit - (bytes_data + offsets_data[i])
+                      : -1;
+                }
+              });
+          push(stack, std::move(result));
+        },
+        aliasAnalysisFromSchema()),
+    // ASCII normalization over the batch: optional lowercasing plus optional
+    // collapsing of whitespace runs to a single space (with leading/trailing
+    // whitespace dropped). Returns a new (offsets, bytes) arena.
+    OperatorGenerator(
+        TORCH_SELECTIVE_SCHEMA(
+            "aten::_arena_normalize(Tensor offsets, Tensor bytes, bool lowercase=True, bool collapse_whitespace=False) -> (Tensor, Tensor)"),
+        [](Stack& stack) {
+          auto collapse = pop(stack).toBool();
+          auto lowercase = pop(stack).toBool();
+          auto bytes = pop(stack).toTensor();
+          auto offsets = pop(stack).toTensor();
+          checkArena(offsets, bytes);
+          const auto n = offsets.numel() - 1;
+          const auto* offsets_data = offsets.data_ptr<int64_t>();
+          const auto* bytes_data =
+              static_cast<const unsigned char*>(bytes.data_ptr());
+
+          const auto is_space = [](unsigned char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+                c == '\f' || c == '\v';
+          };
+          const auto to_lower = [](unsigned char c) {
+            return c >= 'A' && c <= 'Z'
+                ? static_cast<unsigned char>(c + ('a' - 'A'))
+                : c;
+          };
+
+          if (!collapse) {
+            // Lengths are unchanged: reuse the offsets and lowercase the
+            // whole arena in one parallel bytewise pass.
+            auto out_bytes = at::empty_like(bytes);
+            auto* out_data =
+                static_cast<unsigned char*>(out_bytes.data_ptr());
+            const auto total = bytes.numel();
+            at::parallel_for(
+                0, total, at::internal::GRAIN_SIZE, [&](int64_t b, int64_t e) {
+                  for (const auto i : c10::irange(b, e)) {
+                    out_data[i] =
+                        lowercase ? to_lower(bytes_data[i]) : bytes_data[i];
+                  }
+                });
+            push(stack, offsets, std::move(out_bytes));
+            return;
+          }
+
+          // Collapsing changes lengths: size each output string first, turn
+          // the lengths into offsets, then write in parallel.
+          auto out_offsets = at::empty({n + 1}, at::kLong);
+          auto* out_offsets_data = out_offsets.data_ptr<int64_t>();
+          at::parallel_for(
+              0, n, at::internal::GRAIN_SIZE / 128, [&](int64_t b, int64_t e) {
+                for (const auto i : c10::irange(b, e)) {
+                  int64_t len = 0;
+                  bool pending_space = false;
+                  bool seen_char = false;
+                  for (int64_t p = offsets_data[i]; p < offsets_data[i + 1];
+                       ++p) {
+                    if (is_space(bytes_data[p])) {
+                      pending_space = seen_char;
+                    } else {
+                      len += pending_space ? 2 : 1;
+                      pending_space = false;
+                      seen_char = true;
+                    }
+                  }
+                  out_offsets_data[i + 1] = len;
+                }
+              });
+          out_offsets_data[0] = 0;
+          for (const auto i : c10::irange(n)) {
+            out_offsets_data[i + 1] += out_offsets_data[i];
+          }
+          auto out_bytes = at::empty({out_offsets_data[n]}, at::kByte);
+          auto* out_data = static_cast<unsigned char*>(out_bytes.data_ptr());
+          at::parallel_for(
+              0, n, at::internal::GRAIN_SIZE / 128, [&](int64_t b, int64_t e) {
+                for (const auto i : c10::irange(b, e)) {
+                  int64_t out = out_offsets_data[i];
+                  bool pending_space = false;
+                  bool seen_char = false;
+                  for (int64_t p = offsets_data[i]; p < offsets_data[i + 1];
+                       ++p) {
+                    const auto c = bytes_data[p];
+                    if (is_space(c)) {
+                      pending_space = seen_char;
+                    } else {
+                      if (pending_space) {
+                        out_data[out++] = ' ';
+                      }
+                      out_data[out++] = lowercase ? to_lower(c) : c;
+                      pending_space = false;
+                      seen_char = true;
+                    }
+                  }
+                }
+              });
+          push(stack, std::move(out_offsets), std::move(out_bytes));
+        },
+        aliasAnalysisFromSchema()),
+});
+
+} // namespace
+} // namespace jit
+} // namespace torch
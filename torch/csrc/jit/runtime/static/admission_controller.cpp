@@ -0,0 +1,104 @@
+#include <torch/csrc/jit/runtime/static/admission_controller.h>
+
+namespace torch {
+namespace jit {
+
+MemoryAdmissionController::Ticket::Ticket(Ticket&& other) noexcept
+    : controller_(other.controller_), bytes_(other.bytes_) {
+  other.controller_ = nullptr;
+  other.bytes_ = 0;
+}
+
+MemoryAdmissionController::Ticket& MemoryAdmissionController::Ticket::
+operator=(Ticket&& other) noexcept {
+  if (this != &other) {
+    if (controller_ != nullptr) {
+      controller_->release(bytes_);
+    }
+    controller_ = other.controller_;
+    bytes_ = other.bytes_;
+    other.controller_ = nullptr;
+    other.bytes_ = 0;
+  }
+  return *this;
+}
+
+MemoryAdmissionController::Ticket::~Ticket() {
+  if (controller_ != nullptr) {
+    controller_->release(bytes_);
+  }
+}
+
+MemoryAdmissionController& MemoryAdmissionController::singleton() {
+  static MemoryAdmissionController controller;
+  return controller;
+}
+
+void MemoryAdmissionController::set_budget_bytes(size_t budget_bytes) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_bytes_ = budget_bytes;
+  }
+  // Raising (or disabling) the budget may unblock queued waiters.
+  released_cv_.notify_all();
+}
+
+size_t MemoryAdmissionController::budget_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return budget_bytes_;
+}
+
+size_t MemoryAdmissionController::admitted_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return admitted_bytes_;
+}
+
+bool MemoryAdmissionController::fitsLocked(size_t estimated_bytes) const {
+  if (budget_bytes_ == 0) {
+    return true;
+  }
+  if (estimated_bytes > budget_bytes_) {
+    // Oversized request: let it through alone rather than deadlocking.
+    return admitted_bytes_ == 0;
+  }
+  return admitted_bytes_ + estimated_bytes <= budget_bytes_;
+}
+
+MemoryAdmissionController::Ticket MemoryAdmissionController::admit(
+    size_t estimated_bytes) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (budget_bytes_ == 0) {
+    return Ticket();
+  }
+  released_cv_.wait(lock, [&] { return fitsLocked(estimated_bytes); });
+  if (budget_bytes_ == 0) {
+    // The budget was cleared while we were waiting.
+    return Ticket();
+  }
+  admitted_bytes_ += estimated_bytes;
+  return Ticket(this, estimated_bytes);
+}
+
+c10::optional<MemoryAdmissionController::Ticket> MemoryAdmissionController::
+    try_admit(size_t estimated_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (budget_bytes_ == 0) {
+    return Ticket();
+  }
+  if (!fitsLocked(estimated_bytes)) {
+    return c10::nullopt;
+  }
+  admitted_bytes_ += estimated_bytes;
+  return Ticket(this, estimated_bytes);
+}
+
+void MemoryAdmissionController::release(size_t bytes) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    admitted_bytes_ -= bytes;
+  }
+  released_cv_.notify_all();
+}
+
+} // namespace jit
+} // namespace torch
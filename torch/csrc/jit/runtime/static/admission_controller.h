@@ -0,0 +1,85 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <c10/util/Optional.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace torch {
+namespace jit {
+
+// Process-wide admission control for planner-managed memory.
+//
+// Multi-tenant serving processes host many StaticModules and admit requests
+// concurrently; without coordination a burst of large-batch requests can
+// push the sum of their managed arenas past device memory and OOM. The
+// controller tracks the bytes reserved by all in-flight runs and makes new
+// runs wait until their projected footprint fits under a configurable
+// budget, turning OOM-crash-retry into queueing.
+//
+// StaticRuntime::operator() reserves StaticModule::peak_memory_estimate()
+// bytes for the inferred batch size before running and releases them when
+// the run finishes; the controller can also be used directly around any
+// other work whose footprint is known. A request whose estimate alone
+// exceeds the budget is admitted once nothing else is in flight, so a
+// too-small budget degrades to serial execution instead of deadlock.
+class TORCH_API MemoryAdmissionController {
+ public:
+  // RAII reservation: the bytes admitted for a run are returned to the
+  // budget when the ticket is destroyed. Default-constructed (or
+  // moved-from) tickets hold no reservation.
+  class TORCH_API Ticket {
+   public:
+    Ticket() = default;
+    Ticket(Ticket&& other) noexcept;
+    Ticket& operator=(Ticket&& other) noexcept;
+    Ticket(const Ticket&) = delete;
+    Ticket& operator=(const Ticket&) = delete;
+    ~Ticket();
+
+    size_t reserved_bytes() const {
+      return bytes_;
+    }
+
+   private:
+    friend class MemoryAdmissionController;
+    Ticket(MemoryAdmissionController* controller, size_t bytes)
+        : controller_(controller), bytes_(bytes) {}
+
+    MemoryAdmissionController* controller_ = nullptr;
+    size_t bytes_ = 0;
+  };
+
+  static MemoryAdmissionController& singleton();
+
+  // A budget of 0 (the default) disables admission control entirely:
+  // admit() returns an empty ticket without reserving anything. Lowering
+  // the budget does not evict tickets already admitted.
+  void set_budget_bytes(size_t budget_bytes);
+  size_t budget_bytes() const;
+
+  // Sum of reserved_bytes() over all live tickets.
+  size_t admitted_bytes() const;
+
+  // Blocks until `estimated_bytes` fits under the budget, then reserves
+  // them and returns the ticket holding the reservation.
+  Ticket admit(size_t estimated_bytes);
+
+  // Non-blocking variant: returns nullopt instead of waiting.
+  c10::optional<Ticket> try_admit(size_t estimated_bytes);
+
+ private:
+  // Caller must hold mutex_.
+  bool fitsLocked(size_t estimated_bytes) const;
+  void release(size_t bytes);
+
+  mutable std::mutex mutex_;
+  std::condition_variable released_cv_;
+  size_t budget_bytes_ = 0;
+  size_t admitted_bytes_ = 0;
+};
+
+} // namespace jit
+} // namespace torch
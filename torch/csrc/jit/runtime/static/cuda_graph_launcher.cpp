@@ -0,0 +1,54 @@
+// CUDA-side implementation of the CudaGraphLauncher interface declared in
+// torch/csrc/jit/runtime/static/impl.h. Registered into the launcher
+// registry so that the (CUDA-free) static runtime can capture and replay
+// whole-model CUDA graphs when built with CUDA.
+#include <torch/csrc/jit/runtime/static/impl.h>
+
+#include <ATen/cuda/CUDAGraph.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+namespace torch {
+namespace jit {
+namespace {
+
+class CudaGraphLauncherImpl : public CudaGraphLauncher {
+ public:
+  explicit CudaGraphLauncherImpl(c10::Device device) : device_(device) {}
+
+  bool capture(const std::function<void()>& fn) override {
+    try {
+      // Capture is not allowed on the default stream; run the model on a
+      // pool stream for the duration of the capture.
+      c10::cuda::CUDAGuard device_guard(device_);
+      c10::cuda::CUDAStream capture_stream = c10::cuda::getStreamFromPool(
+          /*isHighPriority=*/false, device_.index());
+      c10::cuda::CUDAStreamGuard stream_guard(capture_stream);
+      graph_.capture_begin();
+      fn();
+      graph_.capture_end();
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "CUDA graph capture of the model failed: " << e.what();
+      return false;
+    }
+    return true;
+  }
+
+  void replay() override {
+    c10::cuda::CUDAGuard device_guard(device_);
+    graph_.replay();
+  }
+
+ private:
+  c10::Device device_;
+  at::cuda::CUDAGraph graph_;
+};
+
+C10_REGISTER_TYPED_CLASS(
+    CudaGraphLauncherRegistry,
+    c10::kCUDA,
+    CudaGraphLauncherImpl);
+
+} // namespace
+} // namespace jit
+} // namespace torch
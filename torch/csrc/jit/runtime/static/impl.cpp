@@ -1,6 +1,7 @@
 #include <torch/csrc/jit/runtime/static/impl.h>
 
 #include <ATen/MemoryOverlap.h>
+#include <ATen/TensorMeta.h>
 #include <ATen/core/symbol.h>
 #include <ATen/record_function.h>
 #include <c10/core/CPUAllocator.h>
@@ -25,6 +26,7 @@
 #include <torch/csrc/jit/runtime/static/memory_planner.h>
 #include <torch/csrc/jit/runtime/static/ops.h>
 #include <torch/csrc/jit/runtime/static/passes.h>
+#include <torch/csrc/jit/runtime/static/processed_node_wrapper.h>
 #include <torch/csrc/jit/runtime/vararg_functions.h>
 #include <algorithm>
 
@@ -54,6 +56,13 @@ C10_DEFINE_bool(
 namespace torch {
 namespace jit {
 
+C10_DEFINE_TYPED_REGISTRY( // NOLINT
+    CudaGraphLauncherRegistry,
+    c10::DeviceType,
+    CudaGraphLauncher,
+    std::unique_ptr,
+    c10::Device);
+
 namespace {
 
 bool allArgsAreTensors(Node* node) {
@@ -259,7 +268,8 @@ std::pair<std::shared_ptr<Graph>, c10::optional<Module>> PrepareForStaticModule(
             << opts.manage_output_tensors << ", use_copy_variants "
             << opts.use_copy_variants << ", use_maybe_copy_variants "
             << opts.use_maybe_copy_variants << ", enable_tensorexpr_fusion "
-            << opts.enable_tensorexpr_fusion;
+            << opts.enable_tensorexpr_fusion << ", use_cuda_graphs "
+            << opts.use_cuda_graphs;
 
   Module module = m.copy();
   if (!is_frozen) {
@@ -646,6 +656,104 @@ void StaticModule::prepareFunctionsAndConstants(
     // new ProcessedFunction
     functions_.emplace_back(
         node, opts_.enable_out_variant, check_outputs_for_overlap);
+    if (functions_.back().kind() ==
+        ProcessedFunction::Kind::kInterpreterFallback) {
+      ++fallback_op_counts_[node->kind().toQualString()];
+    }
+  }
+}
+
+namespace {
+
+// Walks the graph in the same depth-first order used by
+// prepareFunctionsAndConstants, so constant positions line up with the
+// constants_ table.
+Node* findConstantNode(Block* block, size_t& remaining) {
+  for (auto* node : block->nodes()) {
+    for (auto* sub_block : node->blocks()) {
+      if (auto* found = findConstantNode(sub_block, remaining)) {
+        return found;
+      }
+    }
+    if (node->kind() == prim::Constant) {
+      if (remaining == 0) {
+        return node;
+      }
+      --remaining;
+    }
+  }
+  return nullptr;
+}
+
+// Same traversal, looking the constant up by output debug name instead of
+// position.
+c10::optional<size_t> findConstantIndex(
+    Block* block,
+    const std::string& name,
+    size_t& index) {
+  for (auto* node : block->nodes()) {
+    for (auto* sub_block : node->blocks()) {
+      if (auto found = findConstantIndex(sub_block, name, index)) {
+        return found;
+      }
+    }
+    if (node->kind() == prim::Constant) {
+      if (node->output()->debugName() == name) {
+        return index;
+      }
+      ++index;
+    }
+  }
+  return c10::nullopt;
+}
+
+} // namespace
+
+c10::optional<size_t> StaticModule::constant_index(
+    const std::string& name) const {
+  size_t index = 0;
+  return findConstantIndex(graph_->block(), name, index);
+}
+
+void StaticModule::swap_constant(
+    const size_t constant_idx,
+    const IValue& new_value) {
+  TORCH_CHECK(
+      constant_idx < constants_.size(),
+      "swap_constant: index ",
+      constant_idx,
+      " out of range for ",
+      constants_.size(),
+      " constants");
+  auto& old_value = constants_[constant_idx];
+  TORCH_CHECK(
+      old_value.isTensor() && new_value.isTensor(),
+      "swap_constant only supports tensor constants");
+  const auto& old_tensor = old_value.toTensor();
+  const auto& new_tensor = new_value.toTensor();
+  TORCH_CHECK(
+      old_tensor.scalar_type() == new_tensor.scalar_type() &&
+          old_tensor.sizes() == new_tensor.sizes() &&
+          old_tensor.strides() == new_tensor.strides() &&
+          old_tensor.device() == new_tensor.device(),
+      "swap_constant: replacement tensor (",
+      new_tensor.toString(),
+      ", sizes ",
+      new_tensor.sizes(),
+      ") is not layout-compatible with the old constant (",
+      old_tensor.toString(),
+      ", sizes ",
+      old_tensor.sizes(),
+      ")");
+  // Keep the graph consistent for debug dumps and StaticModules built from
+  // it later.
+  size_t remaining = constant_idx;
+  auto* node = findConstantNode(graph_->block(), remaining);
+  TORCH_INTERNAL_ASSERT(node != nullptr);
+  node->t_(attr::value, new_tensor);
+  old_value = new_value;
+  if (cached_runtime_) {
+    cached_runtime_->patch_constant(constant_idx, new_value);
   }
 }
 
@@ -946,7 +1054,8 @@ void BlockRunner::create_memory_planner() {
         block_info_,
         static_module_.opts().enable_out_variant,
         manage_output_tensors_enabled_,
-        static_module_.opts().optimize_memory);
+        static_module_.opts().optimize_memory,
+        static_module_.opts().reuse_plan_buffer);
   }
 }
 
@@ -1176,6 +1285,15 @@ c10::IValue BlockRunner::run_impl(
 
     set_inputs(std::forward<IValueList>(args), kwargs);
 
+    // Once a memory plan exists this graph already passed full shape
+    // validation; skip the redundant TORCH_META_CHECKs in structured
+    // kernels when the caller opted in.
+    c10::optional<at::impl::MetaShapeChecksDisabledGuard> no_meta_checks;
+    if (C10_UNLIKELY(
+            static_module_.opts().elide_meta_shape_checks && planner_)) {
+      no_meta_checks.emplace();
+    }
+
     for (auto& n : nodes_) {
       // LOG(INFO) << "Running node: " << PrintNode(n.node());
       n.run();
@@ -1215,9 +1333,81 @@ c10::IValue BlockRunner::run_impl_record_functions(
   return run_impl(std::forward<IValueList>(args), kwargs);
 }
 
+c10::IValue BlockRunner::run_with_cuda_graph(
+    const std::vector<c10::IValue>& args,
+    const KeywordArgs& kwargs) {
+  // Replay path: copy the new inputs into the tensors whose addresses the
+  // capture baked in, then launch the graph.
+  if (cuda_graph_launcher_) {
+    TORCH_CHECK(
+        args.size() == cuda_graph_inputs_.size(),
+        "Cannot replay CUDA graph: expected ",
+        cuda_graph_inputs_.size(),
+        " inputs, got ",
+        args.size());
+    for (const auto i : c10::irange(args.size())) {
+      if (cuda_graph_inputs_[i].isTensor()) {
+        cuda_graph_inputs_[i].toTensor().copy_(
+            args[i].toTensor(), /*non_blocking=*/true);
+      }
+    }
+    cuda_graph_launcher_->replay();
+    return cuda_graph_outputs_;
+  }
+
+  // The memory planner needs a couple of runs to reach its steady-state
+  // buffer layout; capture only records stable addresses after that.
+  constexpr size_t kCudaGraphWarmupRuns = 2;
+  if (!cuda_graph_capture_failed_ &&
+      cuda_graph_warmup_runs_ >= kCudaGraphWarmupRuns) {
+    c10::optional<c10::Device> device;
+    for (const auto& arg : args) {
+      if (arg.isTensor() && arg.toTensor().is_cuda()) {
+        device = arg.toTensor().device();
+        break;
+      }
+    }
+    if (device.has_value() && kwargs.empty() &&
+        CudaGraphLauncherRegistry()->Has(c10::kCUDA)) {
+      // Clone the inputs into persistent tensors; replays copy fresh data
+      // into these rather than rebinding addresses.
+      cuda_graph_inputs_.clear();
+      cuda_graph_inputs_.reserve(args.size());
+      for (const auto& arg : args) {
+        cuda_graph_inputs_.emplace_back(
+            arg.isTensor() ? IValue(arg.toTensor().clone()) : arg);
+      }
+      cuda_graph_launcher_ =
+          CudaGraphLauncherRegistry()->Create(c10::kCUDA, *device);
+      const bool captured = cuda_graph_launcher_->capture(
+          [&] { cuda_graph_outputs_ = run_impl(cuda_graph_inputs_, kwargs); });
+      if (captured) {
+        return cuda_graph_outputs_;
+      }
+      // The captured attempt's work is lost; run normally below and stop
+      // trying to capture.
+      cuda_graph_launcher_.reset();
+      cuda_graph_outputs_ = IValue();
+      cuda_graph_inputs_.clear();
+      cuda_graph_capture_failed_ = true;
+    } else {
+      cuda_graph_capture_failed_ = true;
+      LOG(WARNING)
+          << "use_cuda_graphs was set but the inputs are not capturable "
+             "(no CUDA tensor inputs, kwargs present, or CPU-only build); "
+             "falling back to regular execution";
+    }
+  }
+  ++cuda_graph_warmup_runs_;
+  return run_impl(args, kwargs);
+}
+
 c10::IValue BlockRunner::operator()(
     const std::vector<c10::IValue>& args,
     const KeywordArgs& kwargs) {
+  if (C10_UNLIKELY(static_module_.opts().use_cuda_graphs)) {
+    return run_with_cuda_graph(args, kwargs);
+  }
 #ifdef PYTORCH_DISABLE_NET_PROFILING
   return run_impl(args, kwargs);
 #else
@@ -1228,6 +1418,9 @@ c10::IValue BlockRunner::operator()(
 c10::IValue BlockRunner::operator()(
     std::vector<c10::IValue>&& args,
     const KeywordArgs& kwargs) {
+  if (C10_UNLIKELY(static_module_.opts().use_cuda_graphs)) {
+    return run_with_cuda_graph(args, kwargs);
+  }
 #ifdef PYTORCH_DISABLE_NET_PROFILING
   return run_impl(std::move(args), kwargs);
 #else
@@ -1850,10 +2043,10 @@ void ProcessedNode::run() {
     at::RecordFunction guard(std::move(*step_callbacks));
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(guard.isActive());
     if (guard.needsInputs()) {
-      const auto inputs = inputs_ivalue_vec();
-      guard.before(
-          get_op_name(),
-          c10::ArrayRef<const IValue>(inputs.data(), inputs.size()));
+      // The profiler only reads the inputs, so borrowing them avoids a
+      // refcount bump per input on every profiled iteration.
+      const BorrowedProcessedNodeInputs inputs(*this);
+      guard.before(get_op_name(), inputs.ivalues());
     } else {
       guard.before(get_op_name());
     }
@@ -2012,24 +2205,126 @@ void ProcessedNode::verify_and_correct_memory_overlap() {
   }
 }
 
+c10::optional<size_t> StaticModule::peak_memory_estimate(
+    int64_t batch_size) const {
+  if (batch_size <= 0) {
+    return c10::nullopt;
+  }
+  std::lock_guard<std::mutex> lock(memory_samples_mutex_);
+  if (memory_samples_.empty()) {
+    return c10::nullopt;
+  }
+  auto it = memory_samples_.lower_bound(batch_size);
+  if (it != memory_samples_.end() && it->first == batch_size) {
+    return it->second;
+  }
+  // No exact sample; scale linearly from the nearest observed batch size.
+  if (it == memory_samples_.end()) {
+    --it;
+  } else if (it != memory_samples_.begin()) {
+    auto prev = std::prev(it);
+    if (batch_size - prev->first < it->first - batch_size) {
+      it = prev;
+    }
+  }
+  const double bytes_per_example =
+      static_cast<double>(it->second) / static_cast<double>(it->first);
+  return static_cast<size_t>(
+      bytes_per_example * static_cast<double>(batch_size) + 0.5);
+}
+
+void StaticModule::record_memory_sample(
+    int64_t batch_size,
+    size_t managed_bytes) const {
+  if (batch_size <= 0 || managed_bytes == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(memory_samples_mutex_);
+  memory_samples_[batch_size] = managed_bytes;
+}
+
 StaticRuntime::StaticRuntime(const StaticModule& sm)
-    : values_(sm.value_buffer_size()) {
+    : static_module_(sm), values_(sm.value_buffer_size()) {
   std::copy(sm.constants().begin(), sm.constants().end(), values_.data());
   block_ = std::make_unique<BlockRunner>(
       sm, values_.data(), sm.root_block(), /*is_root_block*/ true);
   ;
 }
 
+void StaticRuntime::patch_constant(
+    const size_t constant_idx,
+    const IValue& new_value) {
+  // Constants occupy the leading section of the shared values array; see
+  // the constructor above.
+  TORCH_CHECK(
+      constant_idx < values_.size(),
+      "patch_constant: index ",
+      constant_idx,
+      " out of range");
+  values_.data()[constant_idx] = new_value;
+}
+
+namespace {
+
+// The serving batch size: leading dimension of the first non-scalar tensor
+// argument, following the convention used by MicroBatchExecutor.
+c10::optional<int64_t> inferBatchSize(const std::vector<c10::IValue>& args) {
+  for (const auto& arg : args) {
+    if (arg.isTensor()) {
+      const auto& tensor = arg.toTensor();
+      if (tensor.dim() > 0) {
+        return tensor.size(0);
+      }
+    }
+  }
+  return c10::nullopt;
+}
+
+} // namespace
+
 c10::IValue StaticRuntime::operator()(
     const std::vector<c10::IValue>& args,
     const KeywordArgs& kwargs) {
-  return (*block_)(args, kwargs);
+  const auto batch_size = inferBatchSize(args);
+  auto ticket = admitForRun(batch_size);
+  auto ret = (*block_)(args, kwargs);
+  recordMemorySample(batch_size);
+  return ret;
 }
 
 c10::IValue StaticRuntime::operator()(
     std::vector<c10::IValue>&& args,
     const KeywordArgs& kwargs) {
-  return (*block_)(std::move(args), kwargs);
+  const auto batch_size = inferBatchSize(args);
+  auto ticket = admitForRun(batch_size);
+  auto ret = (*block_)(std::move(args), kwargs);
+  recordMemorySample(batch_size);
+  return ret;
+}
+
+MemoryAdmissionController::Ticket StaticRuntime::admitForRun(
+    const c10::optional<int64_t>& batch_size) {
+  auto& controller = MemoryAdmissionController::singleton();
+  if (controller.budget_bytes() == 0) {
+    return MemoryAdmissionController::Ticket();
+  }
+  // Unknown batch sizes and not-yet-profiled modules pass through with a
+  // zero-byte reservation; the first run populates the estimate.
+  size_t estimate = 0;
+  if (batch_size.has_value()) {
+    estimate = static_module_.peak_memory_estimate(*batch_size).value_or(0);
+  }
+  return controller.admit(estimate);
+}
+
+void StaticRuntime::recordMemorySample(
+    const c10::optional<int64_t>& batch_size) {
+  if (!batch_size.has_value()) {
+    return;
+  }
+  if (const auto* planner = get_memory_planner()) {
+    static_module_.record_memory_sample(*batch_size, planner->total_managed());
+  }
 }
 
 bool StaticRuntime::check_for_memory_leak(bool output_returned) {
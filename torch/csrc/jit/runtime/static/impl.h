@@ -5,6 +5,7 @@
 #include <c10/core/CPUAllocator.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/ArrayRef.h>
+#include <c10/util/Registry.h>
 #include <c10/util/variant.h>
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/ir/graph_node_list.h>
@@ -13,7 +14,10 @@
 #include <torch/csrc/jit/passes/freeze_module.h>
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/static/ProcessedNodeInputs.h>
+#include <torch/csrc/jit/runtime/static/admission_controller.h>
 #include <limits>
+#include <map>
+#include <mutex>
 
 #ifdef FBCODE_CAFFE2
 #include <folly/container/F14Map.h>
@@ -154,6 +158,30 @@ class TORCH_API ManagedTensorRanges {
   FastMap<const Value*, Lifetime> value_lifetimes_{};
 };
 
+// Captures the work a model issues on the current CUDA stream and replays
+// it as a single graph launch. The implementation lives in the CUDA library
+// and is reached through the registry below so that this translation unit
+// stays CUDA-free; the registry is empty in CPU-only builds.
+class TORCH_API CudaGraphLauncher {
+ public:
+  virtual ~CudaGraphLauncher() = default;
+
+  // Runs `fn` under stream capture. Returns false if capture failed, in
+  // which case no graph is instantiated and the work `fn` issued must be
+  // considered lost; the caller should fall back to regular execution.
+  virtual bool capture(const std::function<void()>& fn) = 0;
+
+  // Replays the captured graph. Only valid after a successful capture().
+  virtual void replay() = 0;
+};
+
+C10_DECLARE_TYPED_REGISTRY(
+    CudaGraphLauncherRegistry,
+    c10::DeviceType,
+    CudaGraphLauncher,
+    std::unique_ptr,
+    c10::Device);
+
 struct TORCH_API StaticModuleOptions {
   // enabling out variant allows Static Runtime to do memory planning
   bool enable_out_variant{true};
@@ -164,6 +192,22 @@ struct TORCH_API StaticModuleOptions {
   // graph, where storage is deallocated outside static runtime
   // (enable_out_variant must be true)
   bool manage_output_tensors{false};
+  // to keep the memory planner's arena buffer alive across iterations and
+  // only reallocate it when the plan outgrows it. Since per-group plan sizes
+  // only ever grow, running one warm-up iteration at the maximum batch size
+  // makes every subsequent iteration at that size or below allocation-free;
+  // smaller batches simply use a prefix of each storage group
+  // (enable_out_variant must be true)
+  bool reuse_plan_buffer{false};
+  // to capture the whole model into a CUDA graph after a few warm-up
+  // iterations and replay it as a single graph launch on subsequent runs.
+  // Capture requires stable tensor addresses, which the memory planner
+  // provides after warm-up. Inputs are copied into the captured input
+  // tensors before each replay, and the same output tensors are returned
+  // from every run. Falls back to regular execution when capture fails
+  // (e.g. a node performs a capture-unsafe operation) or when the inputs
+  // are not on a CUDA device. Requires a CUDA-enabled build.
+  bool use_cuda_graphs{false};
   // Gates the ReplaceWithCopy pass, which replaces ops that
   // sometimes alias their outputs with out variants that
   // always copy (so the output may participate in memory planning).
@@ -181,6 +225,13 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // to skip the per-call shape validation inside structured-kernel meta
+  // functions (TORCH_META_CHECK in ATen) on iterations after the first.
+  // The first iteration runs the full checks while the memory planner is
+  // built; once a plan exists the same graph re-runs with shapes the checks
+  // already admitted. Only enable for graphs whose input shapes are
+  // validated upstream.
+  bool elide_meta_shape_checks{false};
 };
 
 /// The static runime supports two execution modes.
@@ -408,6 +459,31 @@ class TORCH_API StaticModule {
     return constants_;
   }
 
+  // Returns the index into constants() of the constant produced by the
+  // prim::Constant node whose output has the given debug name (e.g.
+  // "self.fc.weight" after freezing), or nullopt when no such constant
+  // exists. Companion to swap_constant.
+  c10::optional<size_t> constant_index(const std::string& name) const;
+
+  // Hot-swaps a tensor constant in place without rebuilding the module: the
+  // new tensor must match the old one's dtype, sizes, strides, and device so
+  // that memory planning and op resolution stay valid. Patches the constants
+  // table, the graph's prim::Constant node, and the cached runtime (if any).
+  // StaticRuntime instances created before the swap keep the old value
+  // unless patched individually via StaticRuntime::patch_constant.
+  void swap_constant(size_t constant_idx, const IValue& new_value);
+
+  // Projected peak bytes of planner-managed memory for a run at
+  // `batch_size`, for use with MemoryAdmissionController. Exact when a run
+  // at that batch size has been observed; otherwise scaled linearly from
+  // the nearest observed batch size. Returns nullopt until the first run
+  // has populated the memory planner.
+  c10::optional<size_t> peak_memory_estimate(int64_t batch_size) const;
+
+  // Records the managed bytes observed for a run at `batch_size`. Called by
+  // StaticRuntime after each run; may also be used to pre-seed estimates.
+  void record_memory_sample(int64_t batch_size, size_t managed_bytes) const;
+
   const BlockInfo& block_info(Block* block) const {
     return block_infos_.at(block);
   }
@@ -434,6 +510,13 @@ class TORCH_API StaticModule {
 
   C10_NODISCARD Node* findNodeWithKindForTesting(const std::string& kind) const;
 
+  // Number of nodes that fell back to the JIT interpreter, keyed by op name.
+  // Useful for finding which out variants would pay off next; populated once
+  // at construction time.
+  const FastMap<std::string, size_t>& fallbackOpCounts() const {
+    return fallback_op_counts_;
+  }
+
   const c10::optional<c10::FunctionSchema>& schema() const {
     return schema_;
   }
@@ -486,6 +569,8 @@ class TORCH_API StaticModule {
   std::vector<IValue> constants_;
   // The functions to be called by corresponding ProcessedNode.
   std::vector<ProcessedFunction> functions_{};
+  // See fallbackOpCounts().
+  FastMap<std::string, size_t> fallback_op_counts_;
   // A list of pre-processed nodes from which ProcessedNode are created per
   // StaticRuntime instance.
   std::vector<StaticNodeInfo> nodes_;
@@ -502,6 +587,12 @@ class TORCH_API StaticModule {
   // See `BlockInfo` definition. The blocks are stored in depth-first order.
   FastMap<Block*, BlockInfo> block_infos_;
   size_t value_buffer_size_ = 0;
+
+  // Observed planner-managed bytes keyed by batch size; see
+  // peak_memory_estimate(). Ordered so the nearest sample is cheap to find,
+  // and guarded since runtimes on different threads record concurrently.
+  mutable std::mutex memory_samples_mutex_;
+  mutable std::map<int64_t, size_t> memory_samples_;
 };
 
 // `BlockRunner` contains the core runtime logic. Each block runner
@@ -663,6 +754,14 @@ class TORCH_API BlockRunner {
       IValueList&& args,
       const KeywordArgs& kwargs);
 
+  // Driver for StaticModuleOptions::use_cuda_graphs: runs normally during
+  // warm-up, then captures one run into a CUDA graph and replays it (after
+  // copying the new inputs into the captured input tensors) on every run
+  // after that. Falls back to run_impl permanently if capture fails.
+  c10::IValue run_with_cuda_graph(
+      const std::vector<c10::IValue>& args,
+      const KeywordArgs& kwargs);
+
   // helper method for copying input args/kwargs into inputs_
   template <typename IValueList>
   void set_inputs(
@@ -732,6 +831,16 @@ class TORCH_API BlockRunner {
 
   std::vector<IValue*> outputs_;
   std::vector<ProcessedNode> nodes_;
+
+  // CUDA graph state, used only when opts().use_cuda_graphs is set. The
+  // launcher is non-null once a capture has succeeded; the inputs are the
+  // persistent tensors whose addresses the capture recorded, and the
+  // outputs are returned unchanged from every replay.
+  std::unique_ptr<CudaGraphLauncher> cuda_graph_launcher_;
+  std::vector<IValue> cuda_graph_inputs_;
+  IValue cuda_graph_outputs_;
+  size_t cuda_graph_warmup_runs_ = 0;
+  bool cuda_graph_capture_failed_ = false;
 };
 
 class TORCH_API ProcessedFunction {
@@ -955,6 +1064,11 @@ class TORCH_API StaticRuntime {
   bool check_for_memory_leak(bool output_returned = true);
   bool checkOutputTensorMemoryLeaks();
 
+  // Overwrites one entry of the constants section of the shared values
+  // array. Used by StaticModule::swap_constant; the caller is responsible
+  // for validating the replacement (see that method's contract).
+  void patch_constant(size_t constant_idx, const IValue& new_value);
+
   void deallocateOutputTensors();
   bool isManagedOutputTensor(const IValue& ivalue) const;
   void disableManageOutputTensors();
@@ -1020,6 +1134,17 @@ class TORCH_API StaticRuntime {
     size_t size_;
   };
 
+  // Reserves this run's projected footprint with the process-wide
+  // MemoryAdmissionController; blocks while over budget. Returns an empty
+  // ticket when no budget is set or the batch size is unknown.
+  MemoryAdmissionController::Ticket admitForRun(
+      const c10::optional<int64_t>& batch_size);
+
+  // Feeds the memory planner's managed bytes back into the StaticModule's
+  // per-batch-size samples after a run.
+  void recordMemorySample(const c10::optional<int64_t>& batch_size);
+
+  const StaticModule& static_module_;
   std::unique_ptr<BlockRunner> block_;
   IValueArray values_;
 };
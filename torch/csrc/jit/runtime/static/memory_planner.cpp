@@ -166,7 +166,9 @@ MemoryPlanner::MemoryPlanner(
     BlockRunner* block_runner,
     const BlockInfo& block_info,
     bool enable_out_variant,
-    bool manage_output_tensors) {
+    bool manage_output_tensors,
+    bool reuse_plan_buffer)
+    : reuse_plan_buffer_(reuse_plan_buffer) {
   const auto& managed_tensor_values = block_info.managed_tensor_values();
   const auto& managed_output_tensor_values =
       block_info.managed_output_tensor_values();
@@ -235,7 +237,13 @@ MemoryPlanner::MemoryPlanner(
 }
 
 uint8_t* MemoryPlanner::allocateBuffer(size_t num_bytes) {
+  if (reuse_plan_buffer_ && buffer_ && num_bytes <= buffer_capacity_) {
+    // The plan still fits in the buffer kept from the previous iteration;
+    // smaller batches use a prefix of it.
+    return buffer_start_;
+  }
   buffer_ = allocate_buffer(num_bytes);
+  buffer_capacity_ = num_bytes;
   uint8_t* start = static_cast<uint8_t*>(buffer_.get());
   buffer_start_ = start;
   buffer_end_ = start + num_bytes;
@@ -306,7 +314,9 @@ void MemoryPlanner::deallocate() {
   for (auto& iv : unmanaged_borrowed_ivalues_) {
     c10::MaybeOwnedTraits<c10::IValue>::destroyBorrow(*iv);
   }
-  buffer_ = {};
+  if (!reuse_plan_buffer_) {
+    buffer_ = {};
+  }
 }
 
 void MemoryPlanner::deallocateOutputTensors() {
@@ -330,12 +340,14 @@ StandardMemoryPlanner::StandardMemoryPlanner(
     const BlockInfo& block_info,
     bool enable_out_variant,
     bool manage_output_tensors,
-    bool optimize_memory)
+    bool optimize_memory,
+    bool reuse_plan_buffer)
     : MemoryPlanner(
           block_runner,
           block_info,
           enable_out_variant,
-          manage_output_tensors) {
+          manage_output_tensors,
+          reuse_plan_buffer) {
   const auto& managed_tensor_values = block_info.managed_tensor_values();
   if (enable_out_variant) {
     const auto tensor_value_to_tensor =
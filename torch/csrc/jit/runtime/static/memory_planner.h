@@ -96,7 +96,8 @@ class MemoryPlanner {
       BlockRunner* block_runner,
       const BlockInfo& block_info,
       bool enable_out_variant,
-      bool manage_output_tensors);
+      bool manage_output_tensors,
+      bool reuse_plan_buffer = false);
 
   // disable copying and moving
   MemoryPlanner(const MemoryPlanner&) = delete;
@@ -217,7 +218,12 @@ class MemoryPlanner {
   std::vector<IValue*> borrowed_ivalues_needing_incref_;
 
   std::vector<std::pair<size_t, at::Tensor*>> managed_output_tensors_{};
-  at::DataPtr buffer_; // allocated each time we call Run()
+  // Allocated each time we call Run() unless reuse_plan_buffer_ is set, in
+  // which case it is kept alive and only reallocated when the plan outgrows
+  // buffer_capacity_.
+  at::DataPtr buffer_;
+  bool reuse_plan_buffer_{false};
+  size_t buffer_capacity_{0};
   uint8_t* buffer_start_{nullptr};
   uint8_t* buffer_end_{nullptr};
   size_t num_managed_tensors_{0};
@@ -239,7 +245,8 @@ class StandardMemoryPlanner : public MemoryPlanner {
       const BlockInfo& block_info,
       bool enable_out_variant,
       bool manage_output_tensors,
-      bool optimize_memory);
+      bool optimize_memory,
+      bool reuse_plan_buffer = false);
 
  protected:
   void allocateManagedTensors() override;
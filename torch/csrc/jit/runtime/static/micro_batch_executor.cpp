@@ -0,0 +1,211 @@
+#include <torch/csrc/jit/runtime/static/micro_batch_executor.h>
+
+#include <ATen/ATen.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Returns the size of the request's tensor args along batch_dim, checking
+// that they all agree and that there is at least one tensor arg.
+int64_t batchLengthOfRequest(
+    const std::vector<c10::IValue>& args,
+    int64_t batch_dim) {
+  c10::optional<int64_t> length;
+  for (const auto& arg : args) {
+    if (!arg.isTensor()) {
+      continue;
+    }
+    const auto arg_length = arg.toTensor().size(batch_dim);
+    TORCH_CHECK(
+        !length.has_value() || *length == arg_length,
+        "MicroBatchExecutor: tensor args of one request must have the same "
+        "size along the batch dim; got ",
+        *length,
+        " and ",
+        arg_length);
+    length = arg_length;
+  }
+  TORCH_CHECK(
+      length.has_value(),
+      "MicroBatchExecutor: request must have at least one tensor arg");
+  return *length;
+}
+
+c10::IValue narrowResult(
+    const c10::IValue& output,
+    int64_t batch_dim,
+    int64_t start,
+    int64_t length) {
+  if (output.isTensor()) {
+    return output.toTensor().narrow(batch_dim, start, length);
+  }
+  if (output.isTuple()) {
+    const auto& elements = output.toTupleRef().elements();
+    std::vector<c10::IValue> narrowed;
+    narrowed.reserve(elements.size());
+    for (const auto& element : elements) {
+      TORCH_CHECK(
+          element.isTensor(),
+          "MicroBatchExecutor: batched output tuple may only contain "
+          "tensors, got ",
+          element.tagKind());
+      narrowed.emplace_back(
+          element.toTensor().narrow(batch_dim, start, length));
+    }
+    return c10::ivalue::Tuple::create(std::move(narrowed));
+  }
+  TORCH_CHECK(
+      false,
+      "MicroBatchExecutor: batched output must be a tensor or a tuple of "
+      "tensors, got ",
+      output.tagKind());
+}
+
+} // namespace
+
+MicroBatchExecutor::MicroBatchExecutor(
+    std::shared_ptr<StaticModule> module,
+    Options options)
+    : module_(std::move(module)), options_(options) {
+  TORCH_CHECK(module_ != nullptr, "MicroBatchExecutor: null StaticModule");
+  TORCH_CHECK(
+      options_.max_batch_size > 0,
+      "MicroBatchExecutor: max_batch_size must be positive");
+  TORCH_CHECK(
+      options_.num_runtimes > 0,
+      "MicroBatchExecutor: num_runtimes must be positive");
+  // The scattered results are views into the batched output tensors, so the
+  // runtime must not reclaim the outputs' memory on its next run.
+  TORCH_CHECK(
+      !module_->opts().manage_output_tensors,
+      "MicroBatchExecutor is incompatible with manage_output_tensors");
+  workers_.reserve(options_.num_runtimes);
+  for (const auto i : c10::irange(options_.num_runtimes)) {
+    (void)i;
+    workers_.emplace_back([this] { worker(); });
+  }
+}
+
+MicroBatchExecutor::~MicroBatchExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  cv_.notify_all();
+  for (auto& thread : workers_) {
+    thread.join();
+  }
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> MicroBatchExecutor::operator()(
+    std::vector<c10::IValue> args) {
+  Request request;
+  request.batch_length = batchLengthOfRequest(args, options_.batch_dim);
+  request.args = std::move(args);
+  request.enqueue_time = std::chrono::steady_clock::now();
+  request.future =
+      c10::make_intrusive<c10::ivalue::Future>(c10::AnyType::get());
+  auto future = request.future;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TORCH_CHECK(!shutdown_, "MicroBatchExecutor is shutting down");
+    queue_.push_back(std::move(request));
+  }
+  cv_.notify_one();
+  return future;
+}
+
+void MicroBatchExecutor::worker() {
+  StaticRuntime runtime(*module_);
+  while (true) {
+    std::vector<Request> batch;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return shutdown_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        // shutdown_ is set and all pending requests have been drained.
+        return;
+      }
+      // Give the batch a chance to fill up, but never hold the oldest
+      // request past its latency budget.
+      const auto deadline = queue_.front().enqueue_time + options_.max_latency;
+      cv_.wait_until(lock, deadline, [this] {
+        return shutdown_ || queue_.size() >= options_.max_batch_size;
+      });
+      const auto batch_size =
+          std::min(queue_.size(), options_.max_batch_size);
+      batch.reserve(batch_size);
+      for (const auto i : c10::irange(batch_size)) {
+        (void)i;
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+    }
+    // More requests may be pending than fit in this batch.
+    cv_.notify_one();
+    run_batch(runtime, std::move(batch));
+  }
+}
+
+void MicroBatchExecutor::run_batch(
+    StaticRuntime& runtime,
+    std::vector<Request> batch) const {
+  TORCH_INTERNAL_ASSERT(!batch.empty());
+  try {
+    const auto num_args = batch[0].args.size();
+    std::vector<c10::IValue> batched_args;
+    batched_args.reserve(num_args);
+    for (const auto arg_idx : c10::irange(num_args)) {
+      const auto& first_arg = batch[0].args[arg_idx];
+      if (!first_arg.isTensor()) {
+        // Non-tensor args (scalars, lists of ints, ...) are taken from the
+        // first request; we can only cheaply verify that the others agree
+        // in type.
+        for (const auto& request : batch) {
+          TORCH_CHECK(
+              request.args.size() == num_args &&
+                  request.args[arg_idx].tagKind() == first_arg.tagKind(),
+              "MicroBatchExecutor: requests in a batch must have matching "
+              "args");
+        }
+        batched_args.push_back(first_arg);
+        continue;
+      }
+      std::vector<at::Tensor> to_cat;
+      to_cat.reserve(batch.size());
+      for (const auto& request : batch) {
+        TORCH_CHECK(
+            request.args.size() == num_args &&
+                request.args[arg_idx].isTensor(),
+            "MicroBatchExecutor: requests in a batch must have matching "
+            "args");
+        to_cat.push_back(request.args[arg_idx].toTensor());
+      }
+      batched_args.emplace_back(at::cat(to_cat, options_.batch_dim));
+    }
+
+    const auto output = runtime(std::move(batched_args));
+
+    int64_t start = 0;
+    for (auto& request : batch) {
+      request.future->markCompleted(narrowResult(
+          output, options_.batch_dim, start, request.batch_length));
+      start += request.batch_length;
+    }
+  } catch (...) {
+    const auto error = std::current_exception();
+    for (auto& request : batch) {
+      if (!request.future->completed()) {
+        request.future->setError(error);
+      }
+    }
+  }
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <torch/csrc/jit/runtime/static/impl.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+// A cooperative micro-batching executor built on top of StaticRuntime.
+//
+// Single-example requests are enqueued from any thread via operator() and
+// accumulated until either `max_batch_size` requests are pending or the
+// oldest pending request has waited `max_latency`. A worker thread then
+// concatenates the tensor arguments along `batch_dim`, runs one
+// StaticRuntime call over the whole batch, and resolves each request's
+// future with its slice of the batched output. The slices are narrow()
+// views into the batched output tensors, so the scatter step performs no
+// per-request copy (the gather step still has to copy each request's
+// inputs into the batch).
+//
+// Each worker thread owns its own StaticRuntime instance spawned from the
+// shared StaticModule, following the one-runtime-per-thread pattern
+// described in README.md.
+class TORCH_API MicroBatchExecutor {
+ public:
+  struct Options {
+    // Run a batch as soon as this many requests are pending...
+    size_t max_batch_size = 8;
+    // ...or as soon as the oldest pending request has waited this long.
+    std::chrono::microseconds max_latency{1000};
+    // Number of worker threads, each owning one StaticRuntime instance.
+    size_t num_runtimes = 1;
+    // Dimension along which request tensors are concatenated and the
+    // outputs are split.
+    int64_t batch_dim = 0;
+  };
+
+  explicit MicroBatchExecutor(
+      std::shared_ptr<StaticModule> module,
+      Options options = Options());
+  ~MicroBatchExecutor();
+
+  MicroBatchExecutor(const MicroBatchExecutor&) = delete;
+  MicroBatchExecutor& operator=(const MicroBatchExecutor&) = delete;
+
+  // Enqueue one request. At least one argument must be a tensor, and all
+  // tensor arguments of a request must have the same size along
+  // `batch_dim`. Non-tensor arguments are taken from the first request of
+  // each batch and must agree across requests (only their type is
+  // verified). The returned future resolves to this request's slice of the
+  // batched output: a tensor, or a tuple of tensors, narrowed along
+  // `batch_dim`.
+  c10::intrusive_ptr<c10::ivalue::Future> operator()(
+      std::vector<c10::IValue> args);
+
+ private:
+  struct Request {
+    std::vector<c10::IValue> args;
+    // Size of this request's tensor args along batch_dim.
+    int64_t batch_length;
+    std::chrono::steady_clock::time_point enqueue_time;
+    c10::intrusive_ptr<c10::ivalue::Future> future;
+  };
+
+  void worker();
+  void run_batch(StaticRuntime& runtime, std::vector<Request> batch) const;
+
+  std::shared_ptr<StaticModule> module_;
+  const Options options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Request> queue_;
+  bool shutdown_ = false;
+
+  std::vector<std::thread> workers_;
+};
+
+} // namespace jit
+} // namespace torch
@@ -15,6 +15,7 @@
 #include <ATen/native/TensorAdvancedIndexing.h>
 #include <ATen/native/TensorConversions.h>
 #include <ATen/native/cpu/SerialStackImpl.h>
+#include <ATen/native/group_norm.h>
 #include <ATen/native/layer_norm.h>
 #include <ATen/native/quantized/cpu/fbgemm_utils.h>
 #include <ATen/native/quantized/cpu/qembeddingbag.h>
@@ -2111,6 +2112,108 @@ REGISTER_OPERATOR_FUNCTOR(aten::norm, aten_norm, [](Node* n) -> SROperator {
   return nullptr;
 });
 
+REGISTER_OPERATOR_FUNCTOR(
+    aten::group_norm,
+    aten_group_norm,
+    [](Node* n) -> SROperator {
+      if (!n->matches(torch::schema(
+              "aten::group_norm(Tensor input, int num_groups, Tensor? weight=None, Tensor? bias=None, float eps=1e-05, bool cudnn_enabled=True) -> Tensor"))) {
+        LogAndDumpSchema(n);
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        // ignore Input(5): `bool cudnn_enabled=True`
+        const auto& input = p_node->Input(0).toTensor();
+        const auto num_groups = p_node->Input(1).toInt();
+        const auto eps = p_node->Input(4).toDouble();
+
+        c10::MaybeOwned<at::Tensor> weight_maybe_owned =
+            borrow_from_optional_tensor_ivalue(p_node->Input(2));
+        const at::Tensor& weight = *weight_maybe_owned;
+        c10::MaybeOwned<at::Tensor> bias_maybe_owned =
+            borrow_from_optional_tensor_ivalue(p_node->Input(3));
+        const at::Tensor& bias = *bias_maybe_owned;
+
+        const int64_t N = input.size(0);
+        const int64_t C = input.size(1);
+        TORCH_CHECK(!weight.defined() || weight.numel() == C);
+        TORCH_CHECK(!bias.defined() || bias.numel() == C);
+        const int64_t HxW = N * C == 0 ? 0 : input.numel() / (N * C);
+
+        const auto memory_format = input.suggest_memory_format();
+        const auto X = input.expect_contiguous(memory_format);
+        const auto gamma = weight.expect_contiguous();
+        const auto beta = bias.expect_contiguous();
+
+        if (p_node->Output(0).isNone()) {
+          p_node->Output(0) = at::native::empty_like(
+              *X,
+              c10::nullopt /* dtype */,
+              c10::nullopt /* layout */,
+              c10::nullopt /* device */,
+              c10::nullopt /* pin_memory */,
+              memory_format);
+        } else {
+          at::native::resize_(
+              p_node->Output(0).toTensor(), X->sizes(), c10::nullopt);
+        }
+        at::Tensor& output = p_node->Output(0).toTensor();
+        at::Tensor mean = at::empty({N, num_groups}, X->options());
+        at::Tensor rstd = at::empty({N, num_groups}, X->options());
+        at::native::GroupNormKernel(
+            at::kCPU,
+            *X,
+            *gamma,
+            *beta,
+            N,
+            C,
+            HxW,
+            num_groups,
+            eps,
+            output,
+            mean,
+            rstd);
+      };
+    });
+
+REGISTER_OPERATOR_FUNCTOR(
+    aten::frobenius_norm,
+    aten_frobenius_norm,
+    [](Node* n) -> SROperator {
+      if (!n->matches(torch::schema(
+              "aten::frobenius_norm.dim(Tensor self, int[1] dim, bool keepdim=False) -> Tensor"))) {
+        LogAndDumpSchema(n);
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        const auto& self = p_node->Input(0).toTensor();
+        const auto dim = p_node->Input(1).toDimVector();
+        const auto keepdim = p_node->Input(2).toBool();
+        if (p_node->Output(0).isNone()) {
+          p_node->Output(0) = create_empty_from(self);
+        }
+        auto& out_t = p_node->Output(0).toTensor();
+        fastResizeToZero(out_t);
+        at::native::frobenius_norm_out(self, dim, keepdim, out_t);
+      };
+    });
+
+REGISTER_OPERATOR_FUNCTOR(aten::relu6, aten_relu6, [](Node* n) -> SROperator {
+  if (!n->matches(torch::schema("aten::relu6(Tensor self) -> Tensor"))) {
+    LogAndDumpSchema(n);
+    return nullptr;
+  }
+  return [](ProcessedNode* p_node) {
+    const auto& self = p_node->Input(0).toTensor();
+    if (p_node->Output(0).isNone()) {
+      p_node->Output(0) = create_empty_from(self);
+    }
+    auto& out_t = p_node->Output(0).toTensor();
+    fastResizeToZero(out_t);
+    at::native::hardtanh_out(self, 0, 6, out_t);
+  };
+});
+
 REGISTER_OPERATOR_FUNCTOR(aten::matmul, aten_matmul, [](Node* n) -> SROperator {
   if (!n->matches(
           torch::schema("aten::matmul(Tensor self, Tensor other) -> Tensor"))) {
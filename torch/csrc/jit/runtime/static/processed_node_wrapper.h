@@ -197,5 +197,42 @@ class ProcessedNodeOutputWrapper
   }
 };
 
+// Materializes a ProcessedNode's inputs as a contiguous array of IValues
+// without bumping any refcounts; each element is a borrow created via
+// c10::MaybeOwnedTraits<IValue>. The wrapped ProcessedNode must outlive this
+// object, and the borrowed IValues are strictly read-only: passing them to a
+// consumer that moves from or destroys stack entries (e.g. the JIT
+// interpreter) would release references the borrows never took.
+class BorrowedProcessedNodeInputs {
+ public:
+  explicit BorrowedProcessedNodeInputs(const ProcessedNode& pnode) {
+    borrows_.reserve(pnode.num_inputs());
+    for (const auto i : c10::irange(pnode.num_inputs())) {
+      borrows_.push_back(
+          c10::MaybeOwnedTraits<c10::IValue>::createBorrow(pnode.Input(i)));
+    }
+  }
+
+  BorrowedProcessedNodeInputs(const BorrowedProcessedNodeInputs&) = delete;
+  BorrowedProcessedNodeInputs& operator=(const BorrowedProcessedNodeInputs&) =
+      delete;
+  BorrowedProcessedNodeInputs(BorrowedProcessedNodeInputs&&) = delete;
+  BorrowedProcessedNodeInputs& operator=(BorrowedProcessedNodeInputs&&) =
+      delete;
+
+  ~BorrowedProcessedNodeInputs() {
+    for (auto& borrow : borrows_) {
+      c10::MaybeOwnedTraits<c10::IValue>::destroyBorrow(borrow);
+    }
+  }
+
+  c10::ArrayRef<const c10::IValue> ivalues() const {
+    return c10::ArrayRef<const c10::IValue>(borrows_.data(), borrows_.size());
+  }
+
+ private:
+  std::vector<c10::IValue> borrows_;
+};
+
 } // namespace jit
 } // namespace torch
@@ -310,13 +310,48 @@ void namedTupleConstruct(
     Stack& stack,
     c10::TypePtr tuple_type,
     size_t num_inputs) {
-  std::vector<IValue> elems{
-      std::make_move_iterator(stack.end() - num_inputs),
-      std::make_move_iterator(stack.end())};
-  drop(stack, num_inputs);
-  push(
-      stack,
-      c10::ivalue::Tuple::createNamed(std::move(elems), std::move(tuple_type)));
+  // As in tupleConstruct, use the inline TupleElements representation for
+  // small tuples to avoid allocating a std::vector on every construction.
+  switch (num_inputs) {
+    case 1:
+      stack.back() = c10::ivalue::Tuple::createNamed(
+          c10::ivalue::TupleElements(std::move(stack.back())),
+          std::move(tuple_type));
+      break;
+    case 2: {
+      auto tuple = c10::ivalue::Tuple::createNamed(
+          c10::ivalue::TupleElements(
+              std::move(stack[stack.size() - 2]),
+              std::move(stack[stack.size() - 1])),
+          std::move(tuple_type));
+      stack.pop_back();
+      stack.back() = std::move(tuple);
+      break;
+    }
+    case 3: {
+      auto tuple = c10::ivalue::Tuple::createNamed(
+          c10::ivalue::TupleElements(
+              std::move(stack[stack.size() - 3]),
+              std::move(stack[stack.size() - 2]),
+              std::move(stack[stack.size() - 1])),
+          std::move(tuple_type));
+      stack.pop_back();
+      stack.pop_back();
+      stack.back() = std::move(tuple);
+      break;
+    }
+    default: {
+      std::vector<IValue> elems{
+          std::make_move_iterator(stack.end() - num_inputs),
+          std::make_move_iterator(stack.end())};
+      drop(stack, num_inputs);
+      push(
+          stack,
+          c10::ivalue::Tuple::createNamed(
+              std::move(elems), std::move(tuple_type)));
+      break;
+    }
+  }
 }
 
 void listConstruct(
@@ -9,7 +9,9 @@
 #include <torch/csrc/jit/passes/inliner.h>
 #include <torch/csrc/jit/runtime/instruction.h>
 #include <torch/csrc/jit/serialization/export.h>
+#include <map>
 #include <string>
+#include <tuple>
 
 namespace torch {
 namespace jit {
@@ -130,6 +132,11 @@ class FlatbufferSerializer {
       flatbuffers::FlatBufferBuilder& fbb,
       ClassTypePtr class_type);
 
+  // Collects the sorted, deduplicated operator table across all methods and
+  // assigns each unique (name, overload, num_args) triple its slot, so that
+  // functionToFB can emit slot references.
+  void buildOperatorTable(const mobile::Module& module);
+
   flatbuffers::Offset<flatbuffers::Vector<
       flatbuffers::Offset<mobile::serialization::ExtraFile>>>
   storeExtraFilesAndGetOffset(
@@ -164,6 +171,11 @@ class FlatbufferSerializer {
 
   std::unordered_map<IValue, uint32_t, IValueHash> cached_ivalues_;
 
+  // (name, overload_name, num_args_serialized) -> slot in the module-level
+  // operator table. Ordered so slots follow the sorted table layout.
+  using OperatorKey = std::tuple<std::string, std::string, int>;
+  std::map<OperatorKey, uint32_t> operator_to_slot_;
+
   const mobile::CompilationUnit* mcu_ = nullptr;
 };
 
@@ -227,6 +239,17 @@ flatbuffers::Offset<mobile::serialization::Function> FlatbufferSerializer::
         op_size));
   }
 
+  // Slots into the module-level operator table, aligned with the legacy
+  // per-function operator list above (kept so older runtimes can still
+  // read the file).
+  std::vector<uint32_t> operator_index;
+  operator_index.reserve(code.op_names_.size());
+  for (int i = 0; i < code.op_names_.size(); ++i) {
+    const auto& opname = code.op_names_[i];
+    operator_index.push_back(operator_to_slot_.at(OperatorKey(
+        opname.name, opname.overload_name, code.operator_input_sizes_[i])));
+  }
+
   const auto& constants = code.constants_;
 
   std::vector<uint32_t> constant_indexes;
@@ -302,10 +325,30 @@ flatbuffers::Offset<mobile::serialization::Function> FlatbufferSerializer::
       register_size,
       schema_offset,
       debug_info_offset,
-      class_index);
+      class_index,
+      &operator_index);
   return function_offset;
 }
 
+void FlatbufferSerializer::buildOperatorTable(const mobile::Module& module) {
+  for (const auto& method : module.get_methods()) {
+    const auto& code = method.function().get_code();
+    for (int i = 0; i < code.op_names_.size(); ++i) {
+      const auto& opname = code.op_names_[i];
+      operator_to_slot_.emplace(
+          OperatorKey(
+              opname.name,
+              opname.overload_name,
+              code.operator_input_sizes_[i]),
+          0);
+    }
+  }
+  uint32_t slot = 0;
+  for (auto& entry : operator_to_slot_) {
+    entry.second = slot++;
+  }
+}
+
 flatbuffers::Offset<
     flatbuffers::Vector<flatbuffers::Offset<mobile::serialization::ExtraFile>>>
 FlatbufferSerializer::storeExtraFilesAndGetOffset(
@@ -338,6 +381,8 @@ flatbuffers::DetachedBuffer FlatbufferSerializer::serializeModule(
   // first element is None.
   insertIValue(CreateIValue(fbb, mobile::serialization::IValueUnion::NONE, 0));
 
+  buildOperatorTable(module);
+
   auto methods = module.get_methods();
   std::vector<uint32_t> functions_index;
   functions_index.reserve(methods.size());
@@ -361,6 +406,18 @@ flatbuffers::DetachedBuffer FlatbufferSerializer::serializeModule(
   for (const auto& ival : jit_constants) {
     jit_constants_indexes.emplace_back(storeIValueAndGetIndex(fbb, ival));
   }
+  std::vector<flatbuffers::Offset<mobile::serialization::Operator>>
+      operator_table_offsets;
+  operator_table_offsets.reserve(operator_to_slot_.size());
+  for (const auto& entry : operator_to_slot_) {
+    operator_table_offsets.push_back(CreateOperator(
+        fbb,
+        fbb.CreateSharedString(std::get<0>(entry.first)),
+        fbb.CreateSharedString(std::get<1>(entry.first)),
+        std::get<2>(entry.first)));
+  }
+  auto operator_table_offset = fbb.CreateVector(operator_table_offsets);
+
   const uint32_t operator_version =
       static_cast<uint32_t>(module.min_operator_version());
   uint32_t bytecode_version = static_cast<uint32_t>(module.bytecode_version());
@@ -408,7 +465,8 @@ flatbuffers::DetachedBuffer FlatbufferSerializer::serializeModule(
       fbb.CreateVector(obj_types_offset_),
       jit_source_offset,
       fbb.CreateVector(jit_constants_indexes),
-      operator_version);
+      operator_version,
+      operator_table_offset);
   FinishModuleBuffer(fbb, mod);
   return fbb.Release();
 }
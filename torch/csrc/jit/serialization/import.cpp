@@ -26,6 +26,7 @@
 
 #include <caffe2/serialize/file_adapter.h>
 #include <caffe2/serialize/inline_container.h>
+#include <caffe2/serialize/mmap_adapter.h>
 #include <caffe2/serialize/istream_adapter.h>
 #include <caffe2/serialize/versions.h>
 
@@ -451,6 +452,56 @@ Module load(
   }
 }
 
+Module load_mmap(const std::string& filename, c10::optional<at::Device> device) {
+  ExtraFilesMap extra_files;
+  return load_mmap(filename, device, extra_files);
+}
+
+Module load_mmap(
+    const std::string& filename,
+    c10::optional<at::Device> device,
+    ExtraFilesMap& extra_files) {
+  TORCH_CHECK(
+      caffe2::serialize::MmapAdapter::isSupported(),
+      "mmap loading is not supported on this platform");
+  auto format = getFileFormat(filename);
+  TORCH_CHECK(
+      format == FileFormat::ZipFileFormat,
+      "mmap loading is only supported for zip-format archives");
+  // PyTorchStreamReader recognizes the MmapAdapter and serves uncompressed,
+  // aligned tensor records as pointers into the mapping.
+  auto rai = std::make_shared<caffe2::serialize::MmapAdapter>(filename);
+  return load(std::move(rai), device, extra_files);
+}
+
+Module load_for_inference(
+    const std::string& filename,
+    c10::optional<at::Device> device) {
+  ExtraFilesMap extra_files;
+  return load_for_inference(filename, device, extra_files);
+}
+
+Module load_for_inference(
+    const std::string& filename,
+    c10::optional<at::Device> device,
+    ExtraFilesMap& extra_files) {
+  Module module = load(filename, device, extra_files);
+  return optimize_for_inference(module);
+}
+
+Module load_for_inference(std::istream& in, c10::optional<at::Device> device) {
+  ExtraFilesMap extra_files;
+  return load_for_inference(in, device, extra_files);
+}
+
+Module load_for_inference(
+    std::istream& in,
+    c10::optional<at::Device> device,
+    ExtraFilesMap& extra_files) {
+  Module module = load(in, device, extra_files);
+  return optimize_for_inference(module);
+}
+
 Module load(
     std::shared_ptr<ReadAdapterInterface> rai,
     c10::optional<c10::Device> device) {
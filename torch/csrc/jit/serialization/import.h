@@ -84,6 +84,46 @@ TORCH_API Module load(
     c10::optional<c10::Device> device,
     ExtraFilesMap& extra_files);
 
+/// Loads a serialized `Module` from the given `filename` through a private
+/// copy-on-write file mapping: CPU tensor payloads alias the mapped pages
+/// instead of being read into freshly allocated buffers, so loading is
+/// near-instant, RSS does not spike, and clean weight pages are shared with
+/// other processes mapping the same file. Only supported for zip-format
+/// archives on POSIX platforms.
+TORCH_API Module load_mmap(
+    const std::string& filename,
+    c10::optional<c10::Device> device = c10::nullopt);
+
+TORCH_API Module load_mmap(
+    const std::string& filename,
+    c10::optional<c10::Device> device,
+    ExtraFilesMap& extra_files);
+
+/// Loads a serialized `Module` and immediately optimizes it for inference:
+/// the module is frozen (which folds conv-batchnorm and other constant
+/// expressions into the weights), add/relu pairs are fused, linear weights
+/// are pre-transposed into the GEMM backend's preferred layout, and the
+/// resulting constants are pooled. Equivalent to `torch::jit::load` followed
+/// by `torch::jit::optimize_for_inference`; the returned module is only
+/// suitable for inference.
+TORCH_API Module load_for_inference(
+    const std::string& filename,
+    c10::optional<c10::Device> device = c10::nullopt);
+
+TORCH_API Module load_for_inference(
+    const std::string& filename,
+    c10::optional<c10::Device> device,
+    ExtraFilesMap& extra_files);
+
+TORCH_API Module load_for_inference(
+    std::istream& in,
+    c10::optional<c10::Device> device = c10::nullopt);
+
+TORCH_API Module load_for_inference(
+    std::istream& in,
+    c10::optional<c10::Device> device,
+    ExtraFilesMap& extra_files);
+
 /// Loads a serialized `Module` from the given shared_ptr `rai`.
 ///
 /// The reader adapter, which is for customized input stream, must contain a
@@ -24,6 +24,36 @@ TORCH_API IValue readArchiveAndTensors(
         Unpickler::defaultTypeParser,
     std::shared_ptr<DeserializationStorageContext> storage_context = nullptr);
 
+// Like readArchiveAndTensors, but does not read any tensor payloads: each
+// tensor in the returned value has its full metadata (sizes, strides,
+// dtype) and a storage holding a null DataPtr that records which archive
+// record backs it. Use materializeLazyStorage to fetch a payload on
+// demand. Tensors are restored on CPU regardless of the device they were
+// saved from; touching the data of an unmaterialized tensor is undefined.
+TORCH_API IValue readArchiveLazily(
+    const std::string& archive_name,
+    const std::string& pickle_prefix,
+    const std::string& tensor_prefix,
+    caffe2::serialize::PyTorchStreamReader& stream_reader,
+    c10::TypePtr (*type_parser)(const std::string&) =
+        Unpickler::defaultTypeParser);
+
+// Fetches the archive record backing a storage produced by
+// readArchiveLazily and binds it to the storage, fixing up every tensor
+// that views it. No-op if the storage is already materialized or empty.
+TORCH_API void materializeLazyStorage(
+    caffe2::serialize::PyTorchStreamReader& stream_reader,
+    const at::Storage& storage);
+
+// Restores only the named tensors of a state-dict style archive (a dict
+// of name -> tensor, as written by torch.save or pickle_save) for which
+// `filter` returns true. Payloads of filtered-out tensors are never read,
+// so memory and I/O are bounded by the selected subset.
+TORCH_API c10::Dict<std::string, at::Tensor> load_tensor_subset(
+    caffe2::serialize::PyTorchStreamReader& stream_reader,
+    const std::function<bool(const std::string&)>& filter,
+    const std::string& archive_name = "data");
+
 bool check_zip_file(
     std::shared_ptr<caffe2::serialize::ReadAdapterInterface> rai);
 
@@ -1746,7 +1746,8 @@ struct Function FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_REGISTER_SIZE = 14,
     VT_SCHEMA = 16,
     VT_DEBUG_INFO = 18,
-    VT_CLASS_TYPE = 20
+    VT_CLASS_TYPE = 20,
+    VT_OPERATOR_INDEX = 22
   };
   const flatbuffers::String *qn() const {
     return GetPointer<const flatbuffers::String *>(VT_QN);
@@ -1802,6 +1803,12 @@ struct Function FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_class_type(uint32_t _class_type = 0) {
     return SetField<uint32_t>(VT_CLASS_TYPE, _class_type, 0);
   }
+  const flatbuffers::Vector<uint32_t> *operator_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_OPERATOR_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_operator_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_OPERATOR_INDEX);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_QN) &&
@@ -1822,6 +1829,8 @@ struct Function FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_DEBUG_INFO) &&
            verifier.VerifyTable(debug_info()) &&
            VerifyField<uint32_t>(verifier, VT_CLASS_TYPE) &&
+           VerifyOffset(verifier, VT_OPERATOR_INDEX) &&
+           verifier.VerifyVector(operator_index()) &&
            verifier.EndTable();
   }
 };
@@ -1857,6 +1866,9 @@ struct FunctionBuilder {
   void add_class_type(uint32_t class_type) {
     fbb_.AddElement<uint32_t>(Function::VT_CLASS_TYPE, class_type, 0);
   }
+  void add_operator_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> operator_index) {
+    fbb_.AddOffset(Function::VT_OPERATOR_INDEX, operator_index);
+  }
   explicit FunctionBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1878,8 +1890,10 @@ inline flatbuffers::Offset<Function> CreateFunction(
     int32_t register_size = 0,
     flatbuffers::Offset<torch::jit::mobile::serialization::Schema> schema = 0,
     flatbuffers::Offset<torch::jit::mobile::serialization::DebugInfo> debug_info = 0,
-    uint32_t class_type = 0) {
+    uint32_t class_type = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> operator_index = 0) {
   FunctionBuilder builder_(_fbb);
+  builder_.add_operator_index(operator_index);
   builder_.add_class_type(class_type);
   builder_.add_debug_info(debug_info);
   builder_.add_schema(schema);
@@ -1902,12 +1916,14 @@ inline flatbuffers::Offset<Function> CreateFunctionDirect(
     int32_t register_size = 0,
     flatbuffers::Offset<torch::jit::mobile::serialization::Schema> schema = 0,
     flatbuffers::Offset<torch::jit::mobile::serialization::DebugInfo> debug_info = 0,
-    uint32_t class_type = 0) {
+    uint32_t class_type = 0,
+    const std::vector<uint32_t> *operator_index = nullptr) {
   auto qn__ = qn ? _fbb.CreateString(qn) : 0;
   auto instructions__ = instructions ? _fbb.CreateVectorOfStructs<torch::jit::mobile::serialization::Instruction>(*instructions) : 0;
   auto operators__ = operators ? _fbb.CreateVector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>>(*operators) : 0;
   auto constants__ = constants ? _fbb.CreateVector<uint32_t>(*constants) : 0;
   auto type_annotations__ = type_annotations ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*type_annotations) : 0;
+  auto operator_index__ = operator_index ? _fbb.CreateVector<uint32_t>(*operator_index) : 0;
   return torch::jit::mobile::serialization::CreateFunction(
       _fbb,
       qn__,
@@ -1918,7 +1934,8 @@ inline flatbuffers::Offset<Function> CreateFunctionDirect(
       register_size,
       schema,
       debug_info,
-      class_type);
+      class_type,
+      operator_index__);
 }
 
 struct StorageData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -2228,7 +2245,8 @@ struct Module FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_OBJECT_TYPES = 18,
     VT_JIT_SOURCES = 20,
     VT_JIT_CONSTANTS = 22,
-    VT_OPERATOR_VERSION = 24
+    VT_OPERATOR_VERSION = 24,
+    VT_OPERATOR_TABLE = 26
   };
   uint32_t bytecode_version() const {
     return GetField<uint32_t>(VT_BYTECODE_VERSION, 0);
@@ -2296,6 +2314,12 @@ struct Module FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_operator_version(uint32_t _operator_version = 0) {
     return SetField<uint32_t>(VT_OPERATOR_VERSION, _operator_version, 0);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>> *operator_table() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>> *>(VT_OPERATOR_TABLE);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>> *mutable_operator_table() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>> *>(VT_OPERATOR_TABLE);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint32_t>(verifier, VT_BYTECODE_VERSION) &&
@@ -2321,6 +2345,9 @@ struct Module FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_JIT_CONSTANTS) &&
            verifier.VerifyVector(jit_constants()) &&
            VerifyField<uint32_t>(verifier, VT_OPERATOR_VERSION) &&
+           VerifyOffset(verifier, VT_OPERATOR_TABLE) &&
+           verifier.VerifyVector(operator_table()) &&
+           verifier.VerifyVectorOfTables(operator_table()) &&
            verifier.EndTable();
   }
 };
@@ -2362,6 +2389,9 @@ struct ModuleBuilder {
   void add_operator_version(uint32_t operator_version) {
     fbb_.AddElement<uint32_t>(Module::VT_OPERATOR_VERSION, operator_version, 0);
   }
+  void add_operator_table(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>>> operator_table) {
+    fbb_.AddOffset(Module::VT_OPERATOR_TABLE, operator_table);
+  }
   explicit ModuleBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2385,8 +2415,10 @@ inline flatbuffers::Offset<Module> CreateModule(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::ObjectType>>> object_types = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::ExtraFile>>> jit_sources = 0,
     flatbuffers::Offset<flatbuffers::Vector<uint32_t>> jit_constants = 0,
-    uint32_t operator_version = 0) {
+    uint32_t operator_version = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>>> operator_table = 0) {
   ModuleBuilder builder_(_fbb);
+  builder_.add_operator_table(operator_table);
   builder_.add_operator_version(operator_version);
   builder_.add_jit_constants(jit_constants);
   builder_.add_jit_sources(jit_sources);
@@ -2413,7 +2445,8 @@ inline flatbuffers::Offset<Module> CreateModuleDirect(
     const std::vector<flatbuffers::Offset<torch::jit::mobile::serialization::ObjectType>> *object_types = nullptr,
     const std::vector<flatbuffers::Offset<torch::jit::mobile::serialization::ExtraFile>> *jit_sources = nullptr,
     const std::vector<uint32_t> *jit_constants = nullptr,
-    uint32_t operator_version = 0) {
+    uint32_t operator_version = 0,
+    const std::vector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>> *operator_table = nullptr) {
   auto extra_files__ = extra_files ? _fbb.CreateVector<flatbuffers::Offset<torch::jit::mobile::serialization::ExtraFile>>(*extra_files) : 0;
   auto methods__ = methods ? _fbb.CreateVector<uint32_t>(*methods) : 0;
   auto ivalues__ = ivalues ? _fbb.CreateVector<flatbuffers::Offset<torch::jit::mobile::serialization::IValue>>(*ivalues) : 0;
@@ -2421,6 +2454,7 @@ inline flatbuffers::Offset<Module> CreateModuleDirect(
   auto object_types__ = object_types ? _fbb.CreateVector<flatbuffers::Offset<torch::jit::mobile::serialization::ObjectType>>(*object_types) : 0;
   auto jit_sources__ = jit_sources ? _fbb.CreateVector<flatbuffers::Offset<torch::jit::mobile::serialization::ExtraFile>>(*jit_sources) : 0;
   auto jit_constants__ = jit_constants ? _fbb.CreateVector<uint32_t>(*jit_constants) : 0;
+  auto operator_table__ = operator_table ? _fbb.CreateVector<flatbuffers::Offset<torch::jit::mobile::serialization::Operator>>(*operator_table) : 0;
   return torch::jit::mobile::serialization::CreateModule(
       _fbb,
       bytecode_version,
@@ -2433,7 +2467,8 @@ inline flatbuffers::Offset<Module> CreateModuleDirect(
       object_types__,
       jit_sources__,
       jit_constants__,
-      operator_version);
+      operator_version,
+      operator_table__);
 }
 
 inline bool VerifyIValueUnion(flatbuffers::Verifier &verifier, const void *obj, IValueUnion type) {
@@ -117,6 +117,21 @@ IValue pickle_load(const std::vector<char>& data) {
 #endif
 };
 
+c10::Dict<std::string, at::Tensor> pickle_load_tensor_subset(
+    const std::vector<char>& data,
+    const std::function<bool(const std::string&)>& filter) {
+#ifndef C10_MOBILE
+  caffe2::serialize::PyTorchStreamReader reader(
+      std::make_unique<VectorReader>(data));
+
+  return load_tensor_subset(reader, filter);
+#else
+  AT_ERROR(
+      "pickle_load_tensor_subset not supported on mobile "
+      "(see https://github.com/pytorch/pytorch/pull/30108)");
+#endif
+}
+
 IValue unpickle(
     std::function<size_t(char*, size_t)> reader,
     TypeResolver type_resolver,
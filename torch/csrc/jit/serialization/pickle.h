@@ -61,6 +61,15 @@ TORCH_API std::vector<char> pickle_save(const IValue& ivalue);
 /// `torch::pickle_save` in C++ or `torch.save` in Python
 TORCH_API IValue pickle_load(const std::vector<char>& data);
 
+/// Restore only the named tensors of a state-dict style archive (a dict of
+/// name -> tensor produced by `torch::pickle_save` or `torch.save`) for
+/// which `filter` returns true. Payloads of filtered-out tensors are never
+/// read, so memory use is bounded by the selected subset; restored tensors
+/// are on CPU.
+TORCH_API c10::Dict<std::string, at::Tensor> pickle_load_tensor_subset(
+    const std::vector<char>& data,
+    const std::function<bool(const std::string&)>& filter);
+
 /// `reader` is a function that takes in a size to read from some pickled
 /// binary. `reader` should remember where it last read, and return
 /// the number of bytes read.
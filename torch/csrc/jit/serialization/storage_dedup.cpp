@@ -0,0 +1,101 @@
+#include <torch/csrc/jit/serialization/storage_dedup.h>
+
+#include <c10/core/StorageImpl.h>
+#include <c10/util/intrusive_ptr.h>
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// FNV-1a over 8-byte words (plus a byte-wise tail). Collisions only cost a
+// memcmp below, so a fast non-cryptographic hash is sufficient.
+uint64_t hashBytes(const void* data, size_t nbytes) {
+  constexpr uint64_t kPrime = 0x100000001b3;
+  uint64_t hash = 0xcbf29ce484222325;
+  const char* ptr = static_cast<const char*>(data);
+  const char* end = ptr + nbytes;
+  for (; end - ptr >= static_cast<ptrdiff_t>(sizeof(uint64_t));
+       ptr += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    hash = (hash ^ word) * kPrime;
+  }
+  for (; ptr != end; ++ptr) {
+    hash = (hash ^ static_cast<uint8_t>(*ptr)) * kPrime;
+  }
+  return hash;
+}
+
+struct DedupRegistry {
+  std::atomic<bool> enabled{false};
+  std::mutex mutex;
+  // Storages are held weakly so that unloading the last model that uses a
+  // payload releases the memory; expired entries are pruned lazily on the
+  // next lookup of their bucket.
+  std::unordered_map<uint64_t, std::vector<c10::weak_intrusive_ptr<c10::StorageImpl>>>
+      buckets;
+  StorageDedupStats stats;
+};
+
+DedupRegistry& getRegistry() {
+  static DedupRegistry registry;
+  return registry;
+}
+
+} // namespace
+
+void setStorageDeduplication(bool enabled) {
+  getRegistry().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool getStorageDeduplication() {
+  return getRegistry().enabled.load(std::memory_order_relaxed);
+}
+
+StorageDedupStats getStorageDedupStats() {
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  return registry.stats;
+}
+
+c10::Storage dedupStorage(c10::Storage storage) {
+  const size_t nbytes = storage.nbytes();
+  if (nbytes == 0 || storage.device_type() != c10::DeviceType::CPU ||
+      storage.data() == nullptr) {
+    return storage;
+  }
+  const uint64_t content_hash = hashBytes(storage.data(), nbytes);
+
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> guard(registry.mutex);
+  ++registry.stats.storages_seen;
+  registry.stats.bytes_seen += nbytes;
+
+  auto& bucket = registry.buckets[content_hash];
+  for (auto it = bucket.begin(); it != bucket.end();) {
+    auto candidate = it->lock();
+    if (!candidate) {
+      it = bucket.erase(it);
+      continue;
+    }
+    if (candidate->nbytes() == nbytes &&
+        std::memcmp(candidate->data(), storage.data(), nbytes) == 0) {
+      ++registry.stats.storages_shared;
+      registry.stats.bytes_saved += nbytes;
+      return c10::Storage(std::move(candidate));
+    }
+    ++it;
+  }
+  bucket.emplace_back(storage.getWeakStorageImpl());
+  return storage;
+}
+
+} // namespace jit
+} // namespace torch
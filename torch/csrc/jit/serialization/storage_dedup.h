@@ -0,0 +1,41 @@
+#pragma once
+
+#include <c10/core/Storage.h>
+
+#include <cstdint>
+
+namespace torch {
+namespace jit {
+
+// Aggregate savings from content-addressed storage sharing, accumulated
+// since process start. bytes_saved counts payload bytes that were dropped
+// in favor of an already-resident identical storage.
+struct StorageDedupStats {
+  uint64_t storages_seen = 0;
+  uint64_t storages_shared = 0;
+  uint64_t bytes_seen = 0;
+  uint64_t bytes_saved = 0;
+};
+
+// Enables content-addressed sharing of CPU storages during deserialization.
+// While enabled, every storage payload read by the unpickler is hashed and
+// compared against storages still resident from earlier loads; identical
+// payloads share a single c10::Storage. This collapses the memory footprint
+// of many fine-tuned variants of one base model to base + deltas.
+//
+// Sharing is by aliasing: an in-place write to a deduplicated weight is
+// visible through every model that shares the storage. Only enable this when
+// loaded weights are treated as read-only (e.g. inference serving).
+TORCH_API void setStorageDeduplication(bool enabled);
+TORCH_API bool getStorageDeduplication();
+
+TORCH_API StorageDedupStats getStorageDedupStats();
+
+// Returns a resident storage with identical content if one exists, otherwise
+// registers `storage` (under a weak reference, so it is evicted once the
+// last model using it is unloaded) and returns it unchanged. Only called by
+// the unpickler while deduplication is enabled.
+c10::Storage dedupStorage(c10::Storage storage);
+
+} // namespace jit
+} // namespace torch
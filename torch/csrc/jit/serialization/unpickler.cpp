@@ -7,6 +7,7 @@
 #include <torch/csrc/jit/mobile/type_parser.h>
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/jit/serialization/storage_context.h>
+#include <torch/csrc/jit/serialization/storage_dedup.h>
 #include <torch/csrc/jit/serialization/unpickler.h>
 #include <string>
 
@@ -486,6 +487,11 @@ PickleOpCode Unpickler::readInstruction() {
             /*allocator=*/nullptr,
             /*resizable=*/false); // NB: we didn't set any allocator for the
                                   // tensor
+        if (getStorageDeduplication()) {
+          // Share the payload with an already-resident identical storage
+          // (see setStorageDeduplication for the aliasing caveat).
+          storage = dedupStorage(std::move(storage));
+        }
         if (storage_context_ != nullptr) {
           storage_context_->addStorage(key, storage);
         }
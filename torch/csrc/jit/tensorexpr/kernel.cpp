@@ -1724,6 +1724,21 @@ void TensorExprKernel::compile() {
   if (has_symbolic_shapes_) {
     tensorOutputSizes_.resize(bufOutputs_.size());
     tensorOutputStrides_.resize(bufOutputs_.size());
+    // Flatten the symbolic output sizes into a runtime resolution plan, so
+    // that getStaticOutputSizesAndStrides does not have to inspect the size
+    // expressions on every call.
+    tensorOutputSymbolicDims_.resize(tensorOutputSymbolicSizes_.size());
+    for (size_t i = 0; i < tensorOutputSymbolicSizes_.size(); ++i) {
+      for (auto t : tensorOutputSymbolicSizes_[i]) {
+        SymbolicOutputDim dim;
+        if (t.AsNode<LongImm>()) {
+          dim.value = immediateAs<int64_t>(t.node());
+        } else {
+          dim.input_pos = shapeSymbolInputPos_.at(t.node());
+        }
+        tensorOutputSymbolicDims_[i].push_back(dim);
+      }
+    }
   }
 
   // Generate code.
@@ -1800,7 +1815,7 @@ void TensorExprKernel::getStaticOutputSizesAndStrides(
   // been computed at compile time. That has to be done here by using the
   // symbolic shape input params passed in to this call.
   TORCH_INTERNAL_ASSERT(
-      tensorOutputSymbolicSizes_.size() == bufOutputs_.size());
+      tensorOutputSymbolicDims_.size() == bufOutputs_.size());
 
   TORCH_INTERNAL_ASSERT(sizes);
   TORCH_INTERNAL_ASSERT(strides);
@@ -1810,14 +1825,14 @@ void TensorExprKernel::getStaticOutputSizesAndStrides(
   auto& static_strides = *strides;
   for (size_t i = 0, e = bufOutputs_.size(); i < e; ++i) {
     static_sizes[i].clear();
-    for (auto t : tensorOutputSymbolicSizes_[i]) {
-      if (t.AsNode<LongImm>()) {
-        static_sizes[i].emplace_back(immediateAs<int64_t>(t.node()));
+    for (const auto& dim : tensorOutputSymbolicDims_[i]) {
+      if (dim.input_pos < 0) {
+        static_sizes[i].emplace_back(dim.value);
       } else {
-        auto input_pos = shapeSymbolInputPos_.at(t.node());
-        TORCH_INTERNAL_ASSERT(input_pos < inputs.size());
-        TORCH_INTERNAL_ASSERT(inputs[input_pos].isInt());
-        static_sizes[i].emplace_back(inputs[input_pos].toInt());
+        TORCH_INTERNAL_ASSERT(
+            static_cast<size_t>(dim.input_pos) < inputs.size());
+        TORCH_INTERNAL_ASSERT(inputs[dim.input_pos].isInt());
+        static_sizes[i].emplace_back(inputs[dim.input_pos].toInt());
       }
     }
 
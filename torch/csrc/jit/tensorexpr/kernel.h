@@ -324,6 +324,15 @@ class TORCH_API TensorExprKernel {
       known_sizes_;
 
   std::vector<std::vector<ExprHandle>> tensorOutputSymbolicSizes_;
+  // Flattened form of tensorOutputSymbolicSizes_, precomputed at compile
+  // time so that resolving the output sizes on each call only needs array
+  // lookups: dims with input_pos >= 0 take the runtime value of that kernel
+  // input, the rest use the constant `value`.
+  struct SymbolicOutputDim {
+    int64_t input_pos{-1};
+    int64_t value{0};
+  };
+  std::vector<std::vector<SymbolicOutputDim>> tensorOutputSymbolicDims_;
   // A map from ShapeSymbol.value() to the corresponding Var.
   std::unordered_map<int64_t, VarHandle> shapeSymbolToVar_;
   std::unordered_map<ExprPtr, size_t> shapeSymbolInputPos_;
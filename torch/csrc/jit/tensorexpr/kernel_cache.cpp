@@ -0,0 +1,100 @@
+#include <torch/csrc/jit/tensorexpr/kernel_cache.h>
+
+#include <torch/csrc/jit/jit_log.h>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+namespace tensorexpr {
+
+namespace {
+
+struct KernelCacheImpl {
+  std::mutex mutex;
+  // Map of printed subgraph to its compiled kernel. std::unordered_map does
+  // not invalidate references on rehashing, and the mapped values are
+  // shared_ptrs, so entries can be handed out without holding the mutex.
+  std::unordered_map<std::string, std::shared_ptr<TensorExprKernel>> kernels;
+};
+
+KernelCacheImpl& getKernelCache() {
+  static KernelCacheImpl cache;
+  return cache;
+}
+
+static bool te_kernel_cache_enabled = true;
+
+// The printed form of a graph does not include the payload of tensor
+// constants or custom class objects, so a subgraph holding one cannot be
+// keyed by its text.
+bool isCacheableSubgraph(const std::shared_ptr<Graph>& subgraph) {
+  for (Node* node : subgraph->nodes()) {
+    if (node->kind() != prim::Constant) {
+      continue;
+    }
+    const TypePtr& type = node->output()->type();
+    if (type->isSubtypeOf(*TensorType::get()) || type->cast<ClassType>()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+std::shared_ptr<TensorExprKernel> getOrCompileKernel(
+    const std::shared_ptr<Graph>& subgraph) {
+  if (!te_kernel_cache_enabled || !isCacheableSubgraph(subgraph)) {
+    return std::make_shared<TensorExprKernel>(subgraph);
+  }
+
+  std::string repr = subgraph->toString(false);
+  auto& cache = getKernelCache();
+  {
+    std::lock_guard<std::mutex> guard{cache.mutex};
+    auto it = cache.kernels.find(repr);
+    if (it != cache.kernels.end()) {
+      GRAPH_DEBUG("Reusing cached TensorExprKernel for subgraph:\n", repr);
+      return it->second;
+    }
+  }
+
+  // Compile outside the lock; compilation can take long enough that
+  // serializing it across threads would stall parallel warmup. If two threads
+  // race on the same subgraph, the loser's kernel is dropped.
+  auto kernel = std::make_shared<TensorExprKernel>(subgraph);
+  {
+    std::lock_guard<std::mutex> guard{cache.mutex};
+    auto emplaced = cache.kernels.emplace(std::move(repr), kernel);
+    if (!emplaced.second) {
+      return emplaced.first->second;
+    }
+  }
+  return kernel;
+}
+
+void setTensorExprKernelCacheEnabled(bool val) {
+  te_kernel_cache_enabled = val;
+}
+
+bool tensorExprKernelCacheEnabled() {
+  return te_kernel_cache_enabled;
+}
+
+int64_t debugNumCachedTensorExprKernels() {
+  auto& cache = getKernelCache();
+  std::lock_guard<std::mutex> guard{cache.mutex};
+  return cache.kernels.size();
+}
+
+void debugClearTensorExprKernelCache() {
+  auto& cache = getKernelCache();
+  std::lock_guard<std::mutex> guard{cache.mutex};
+  cache.kernels.clear();
+}
+
+} // namespace tensorexpr
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <torch/csrc/jit/tensorexpr/kernel.h>
+
+namespace torch {
+namespace jit {
+namespace tensorexpr {
+
+// A process-wide, thread-safe cache of compiled TensorExprKernels.
+//
+// Fusion subgraphs produced by the TE fuser are shape-specialized, so repeated
+// structures (e.g. dozens of identical transformer layers, or several replicas
+// of the same model in one serving process) compile the exact same kernel over
+// and over. The cache keys on the printed form of the subgraph, which covers
+// the op sequence, the scalar constants and the complete tensor type
+// specializations (shape, strides, dtype, device).
+//
+// Subgraphs holding tensor or custom class constants are not cached: their
+// payloads are not part of the printed graph, so two textually identical
+// subgraphs could bake different data into the kernel.
+
+// Returns a kernel for `subgraph`, compiling one on a cache miss. The graph
+// must be a complete-shape fusion subgraph (no symbolic shapes or stride
+// descriptors; those live in node attributes the key does not see).
+TORCH_API std::shared_ptr<TensorExprKernel> getOrCompileKernel(
+    const std::shared_ptr<Graph>& subgraph);
+
+TORCH_API void setTensorExprKernelCacheEnabled(bool val);
+TORCH_API bool tensorExprKernelCacheEnabled();
+
+// Returns the number of cached kernels. Only used for testing.
+TORCH_API int64_t debugNumCachedTensorExprKernels();
+
+// Clears the cache. Only used for testing.
+TORCH_API void debugClearTensorExprKernelCache();
+
+} // namespace tensorexpr
+} // namespace jit
+} // namespace torch
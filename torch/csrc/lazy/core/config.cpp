@@ -61,6 +61,12 @@ C10_DEFINE_int(
     4096,
     "Set the size for the shape cache used for shape inference");
 
+C10_DEFINE_int(
+    torch_lazy_trace_cache_size,
+    // Cached traces hold their root IR values, and therefore whole graphs,
+    // alive; keep the cache small since only the steady-state traces matter.
+    16,
+    "Size of the per-step trace cache used with torch_lazy_reuse_ir");
 
 namespace torch {
 namespace lazy {
@@ -18,6 +18,7 @@ C10_DECLARE_int(torch_lazy_trim_graph_size);
 C10_DECLARE_string(torch_lazy_metrics_percentiles);
 
 C10_DECLARE_int(torch_lazy_shape_cache_size);
+C10_DECLARE_int(torch_lazy_trace_cache_size);
 
 namespace torch {
 namespace lazy {
@@ -727,6 +727,7 @@ LazyGraphExecutor::PostOrderData LazyGraphExecutor::RunPostOrder(
       if (!backend_data->HasValue()) {
         TensorCollectionBarrier(coll);
       }
+      po_data.device_data_nodes.push_back(node);
       BackendData::Handle handle = backend_data->GetHandle();
       auto it = data_handles.find(handle);
       if (it != data_handles.end()) {
@@ -738,6 +739,7 @@ LazyGraphExecutor::PostOrderData LazyGraphExecutor::RunPostOrder(
       }
     }
   }
+  po_data.post_order_size = po_data.post_order.size();
   return po_data;
 }
 
@@ -754,8 +756,8 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::TryRunCachedSync(
     auto* comp = cached_computation->computation.get();
     LOG(ERROR) << "Run a cached graph: " << comp->to_string() << std::endl;
   }
-  TORCH_LAZY_VALUE_METRIC("TensorsGraphSize", po_data->post_order.size());
-  VLOG(5) << "TensorsGraphSize=" << po_data->post_order.size();
+  TORCH_LAZY_VALUE_METRIC("TensorsGraphSize", po_data->post_order_size);
+  VLOG(5) << "TensorsGraphSize=" << po_data->post_order_size;
 
   return ScheduleSyncTensorsGraph(
       tensors,
@@ -850,6 +852,81 @@ LazyGraphExecutor::ComputationCache::TypePtr LazyGraphExecutor::
   return cached_computation;
 }
 
+LazyGraphExecutor::TraceCache* LazyGraphExecutor::GetTraceCache() {
+  static TraceCache* cache = new TraceCache(FLAGS_torch_lazy_trace_cache_size);
+  return cache;
+}
+
+bool LazyGraphExecutor::TryRunCachedTrace(
+    const std::vector<LazyTensorPtr>& tensors,
+    SyncTensorCollection* coll,
+    PostOrderData* po_data) {
+  if (!FLAGS_torch_lazy_reuse_ir) {
+    // Without IR reuse the roots are fresh nodes every step, so the pointer
+    // identity check below can never pass.
+    return false;
+  }
+  TraceCache::TypePtr cached_trace = GetTraceCache()->Get(coll->hash);
+  if (cached_trace == nullptr ||
+      cached_trace->roots.size() != coll->indices.size()) {
+    TORCH_LAZY_COUNTER("UncachedTrace", 1);
+    return false;
+  }
+  // The hash only covers the root values; require the roots to be the very
+  // same (reused) nodes before trusting the recorded device data nodes, since
+  // those are raw pointers into the graph the cached roots keep alive.
+  for (const auto i : c10::irange(coll->indices.size())) {
+    if (cached_trace->roots[i].node.get() !=
+        tensors.at(coll->indices[i])->CurrentIrValue().node.get()) {
+      TORCH_LAZY_COUNTER("UncachedTrace", 1);
+      return false;
+    }
+  }
+  TORCH_LAZY_COUNTER("CachedTrace", 1);
+  // Replay the parameter extraction of RunPostOrder over the recorded device
+  // data nodes. The dedup below has to be redone every step: reused DeviceData
+  // nodes get their data swapped in place (see DeviceData::Create), so which
+  // nodes share a handle can change between steps even though the graph,
+  // and hence its hash, did not.
+  std::unordered_map<BackendData::Handle, size_t> data_handles;
+  for (auto node : cached_trace->device_data_nodes) {
+    const auto backend_data = getBackend()->GetComputationDataFromNode(node);
+    TORCH_CHECK(backend_data);
+    /* Acceptable race condition: HasValue may return false. This is OK
+     * since the conditional barrier is a performance optimization. */
+    if (!backend_data->HasValue()) {
+      TensorCollectionBarrier(coll);
+    }
+    BackendData::Handle handle = backend_data->GetHandle();
+    auto it = data_handles.find(handle);
+    if (it != data_handles.end()) {
+      po_data->parameter_sequence.push_back(it->second);
+    } else {
+      po_data->parameter_sequence.push_back(po_data->parameters_data.size());
+      data_handles[handle] = po_data->parameters_data.size();
+      po_data->parameters_data.push_back(backend_data);
+    }
+  }
+  po_data->post_order_size = cached_trace->post_order_size;
+  return true;
+}
+
+void LazyGraphExecutor::CacheTrace(
+    const std::vector<LazyTensorPtr>& tensors,
+    const SyncTensorCollection& coll,
+    const hash_t& trace_hash,
+    const PostOrderData& po_data) {
+  if (!FLAGS_torch_lazy_reuse_ir) {
+    // Don't pin graphs which can never be matched again.
+    return;
+  }
+  auto cached_trace = std::make_shared<CachedTrace>();
+  cached_trace->roots = CollectRoots(tensors, coll.indices);
+  cached_trace->device_data_nodes = po_data.device_data_nodes;
+  cached_trace->post_order_size = po_data.post_order_size;
+  GetTraceCache()->Add(trace_hash, std::move(cached_trace));
+}
+
 #if defined(_MSC_VER)
 #include <BaseTsd.h>
 typedef SSIZE_T ssize_t;
@@ -901,7 +978,15 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
     TensorCollectionBarrier(&coll);
     return nullptr;
   }
-  PostOrderData po_data = RunPostOrder(*tensors, &coll);
+  // The trace hash only covers the root values; it is the key under which the
+  // trace is cached, while coll.hash additionally covers the parameter
+  // sequence, which is only known after the parameter extraction below.
+  hash_t trace_hash = coll.hash;
+  PostOrderData po_data;
+  bool used_cached_trace = TryRunCachedTrace(*tensors, &coll, &po_data);
+  if (!used_cached_trace) {
+    po_data = RunPostOrder(*tensors, &coll);
+  }
   DebugUtil::SaveTensorsGraphInfo("ScheduleSyncTensorsGraph", *tensors,
                                  &coll.indices);
   coll.hash = HashCombine(coll.hash, Hash(po_data.parameter_sequence));
@@ -911,6 +996,15 @@ std::shared_ptr<LazyGraphExecutor::Async> LazyGraphExecutor::
     return async;
   }
 
+  if (used_cached_trace) {
+    // Compilation needs the post order and emission map, which a cached trace
+    // does not carry; fall back to the full walk for this (rare) step. The
+    // parameter extraction is redone as part of it, so do not re-combine the
+    // hash.
+    po_data = RunPostOrder(*tensors, &coll);
+  } else {
+    CacheTrace(*tensors, coll, trace_hash, po_data);
+  }
   CompilationResult compile_result = Compile(*tensors, devices, coll, &po_data);
   if (GRAPH_DUMP_ENABLED) {
     auto* comp = compile_result.computation.get();
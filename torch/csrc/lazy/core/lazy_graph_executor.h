@@ -125,6 +125,24 @@ class TORCH_API LazyGraphExecutor {
 
   ComputationCache* GetComputationCache();
 
+  // A trace cached at a step boundary, keyed by the hash of its root IR
+  // values. When IR nodes are reused across steps (torch_lazy_reuse_ir), a
+  // steady-state training loop produces pointer-identical roots every step;
+  // in that case the recorded device data nodes are exactly the parameter
+  // nodes the full post-order walk would rediscover, and only their
+  // per-step substituted data (e.g. changing scalar inputs) needs to be
+  // re-read. The roots anchor the graph in memory, which keeps the raw
+  // device data node pointers below valid.
+  struct CachedTrace {
+    std::vector<Value> roots;
+    std::vector<Node*> device_data_nodes;
+    size_t post_order_size = 0;
+  };
+
+  using TraceCache = Cache<hash_t, CachedTrace, HashReducer>;
+
+  TraceCache* GetTraceCache();
+
   hash_t GetGraphHash(const std::vector<LazyTensorPtr>& tensors);
 
  private:
@@ -152,6 +170,12 @@ class TORCH_API LazyGraphExecutor {
     Util::EmissionMap emission_map;
     std::vector<BackendDataPtr> parameters_data;
     std::vector<size_t> parameter_sequence;
+    // All nodes of post_order carrying backend data, in post-order order;
+    // recorded so the trace cache can replay the parameter extraction.
+    std::vector<Node*> device_data_nodes;
+    // Tracked separately from post_order so that a cached trace, which does
+    // not materialize the post order, can still report the graph size.
+    size_t post_order_size = 0;
   };
 
   struct CompilationResult {
@@ -198,6 +222,24 @@ class TORCH_API LazyGraphExecutor {
   PostOrderData RunPostOrder(
       const std::vector<LazyTensorPtr>& tensors,
       SyncTensorCollection* coll);
+
+  // Attempts to serve the post-order walk from the trace cache: on a hit,
+  // fills in po_data by replaying the recorded parameter extraction instead
+  // of traversing the graph. A hit requires the cached roots to be pointer
+  // identical to the current ones, which is only possible with
+  // torch_lazy_reuse_ir. The returned po_data has no post_order or
+  // emission_map, so a subsequent compilation still needs RunPostOrder.
+  bool TryRunCachedTrace(
+      const std::vector<LazyTensorPtr>& tensors,
+      SyncTensorCollection* coll,
+      PostOrderData* po_data);
+
+  void CacheTrace(
+      const std::vector<LazyTensorPtr>& tensors,
+      const SyncTensorCollection& coll,
+      const hash_t& trace_hash,
+      const PostOrderData& po_data);
+
   std::shared_ptr<Async> TryRunCachedSync(
       std::vector<LazyTensorPtr>* tensors,
       SyncTensorCollection* coll,
@@ -0,0 +1,185 @@
+#include <torch/csrc/monitor/histogram.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ATen/record_function.h>
+#include <c10/util/llvmMathExtras.h>
+
+namespace torch {
+namespace monitor {
+
+Histogram::Histogram(std::string name) : name_(std::move(name)) {}
+
+int Histogram::bucketIndex(int64_t value) {
+  uint64_t v = value < 0 ? 0 : static_cast<uint64_t>(value);
+  if (v < static_cast<uint64_t>(kSubBuckets)) {
+    return static_cast<int>(v);
+  }
+  // The bucket for the value's power-of-two range, offset by the linear
+  // sub-bucket within it given by the kSubBucketBits bits below the MSB.
+  int msb = static_cast<int>(c10::llvm::Log2_64(v));
+  int shift = msb - kSubBucketBits;
+  return (shift + 1) * static_cast<int>(kSubBuckets) +
+      static_cast<int>((v >> shift) - kSubBuckets);
+}
+
+int64_t Histogram::bucketUpperBound(int index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+  int64_t shift = index / kSubBuckets - 1;
+  int64_t sub = index % kSubBuckets;
+  return ((sub + kSubBuckets + 1) << shift) - 1;
+}
+
+void Histogram::add(int64_t value) {
+  buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t Histogram::count() const {
+  return count_.load(std::memory_order_relaxed);
+}
+
+int64_t Histogram::quantile(double q) const {
+  int64_t total = count();
+  if (total == 0) {
+    return 0;
+  }
+  // rank of the q-th quantile, clamped to [1, total]
+  auto rank = static_cast<int64_t>(q * static_cast<double>(total));
+  rank = std::max<int64_t>(std::min(rank, total), 1);
+
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; i++) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+    if (seen >= rank) {
+      return bucketUpperBound(i);
+    }
+  }
+  return bucketUpperBound(kNumBuckets - 1);
+}
+
+void Histogram::log() {
+  if (count() == 0) {
+    return;
+  }
+
+  Event e;
+  e.name = "torch.monitor.Histogram";
+  e.timestamp = std::chrono::system_clock::now();
+
+  std::pair<const char*, double> quantiles[] = {
+      {"p50", 0.5}, {"p90", 0.9}, {"p99", 0.99}};
+  for (auto& kv : quantiles) {
+    std::stringstream key;
+    key << name_ << "." << kv.first;
+    e.data[key.str()] = quantile(kv.second);
+  }
+  e.data[name_ + ".count"] = count();
+
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+
+  logEvent(e);
+}
+
+namespace {
+
+// Per-operator latency histograms fed from a RecordFunction callback. The
+// histograms are keyed by operator name up to maxOpNames distinct names;
+// operators beyond that are lumped into a single overflow histogram so a
+// model with many custom ops can't blow up the metric cardinality.
+struct OpLatencyObserver {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::unique_ptr<Histogram>> histograms;
+  Histogram overflow{"torch.ops.other.latency_us"};
+  size_t maxOpNames = 0;
+  at::CallbackHandle handle = at::INVALID_CALLBACK_HANDLE;
+
+  Histogram& histogramFor(const char* opName) {
+    std::lock_guard<std::mutex> guard(mutex);
+    auto it = histograms.find(opName);
+    if (it != histograms.end()) {
+      return *it->second;
+    }
+    if (histograms.size() >= maxOpNames) {
+      return overflow;
+    }
+    auto histogram =
+        std::make_unique<Histogram>(std::string(opName) + ".latency_us");
+    return *histograms.emplace(opName, std::move(histogram)).first->second;
+  }
+};
+
+OpLatencyObserver& opLatencyObserver() {
+  static OpLatencyObserver observer;
+  return observer;
+}
+
+struct OpLatencyContext : public at::ObserverContext {
+  std::chrono::steady_clock::time_point start;
+};
+
+std::unique_ptr<at::ObserverContext> onOpEnter(
+    const at::RecordFunction& /*fn*/) {
+  auto ctx = std::make_unique<OpLatencyContext>();
+  ctx->start = std::chrono::steady_clock::now();
+  return ctx;
+}
+
+void onOpExit(const at::RecordFunction& fn, at::ObserverContext* ctx_ptr) {
+  auto* ctx = static_cast<OpLatencyContext*>(ctx_ptr);
+  if (ctx == nullptr) {
+    return;
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - ctx->start);
+  opLatencyObserver().histogramFor(fn.name()).add(elapsed.count());
+}
+
+} // namespace
+
+bool enableOpLatencyHistograms(size_t maxOpNames) {
+  auto& observer = opLatencyObserver();
+  std::lock_guard<std::mutex> guard(observer.mutex);
+  if (observer.handle != at::INVALID_CALLBACK_HANDLE) {
+    return false;
+  }
+  observer.maxOpNames = maxOpNames;
+  observer.handle = at::addGlobalCallback(
+      at::RecordFunctionCallback(&onOpEnter, &onOpExit)
+          .scopes({at::RecordScope::FUNCTION}));
+  return true;
+}
+
+void disableOpLatencyHistograms() {
+  auto& observer = opLatencyObserver();
+  std::lock_guard<std::mutex> guard(observer.mutex);
+  if (observer.handle != at::INVALID_CALLBACK_HANDLE) {
+    at::removeCallback(observer.handle);
+    observer.handle = at::INVALID_CALLBACK_HANDLE;
+  }
+  observer.histograms.clear();
+}
+
+void logOpLatencyHistograms() {
+  auto& observer = opLatencyObserver();
+  std::lock_guard<std::mutex> guard(observer.mutex);
+  for (auto& kv : observer.histograms) {
+    kv.second->log();
+  }
+  observer.overflow.log();
+}
+
+} // namespace monitor
+} // namespace torch
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <c10/macros/Macros.h>
+
+#include <torch/csrc/monitor/events.h>
+
+namespace torch {
+namespace monitor {
+
+// Histogram is a fixed-size HDR-style histogram for non-negative integer
+// values (typically latencies in microseconds). Values are bucketed into
+// power-of-two ranges, each split into 32 linear sub-buckets, which bounds
+// the relative quantile error to ~3% while keeping `add` to a couple of
+// arithmetic ops and one relaxed atomic increment - cheap enough to sit on
+// the operator hot path.
+//
+// Unlike Stat, Histogram does not log on a timer; callers decide when to
+// snapshot. `log` emits the current quantiles as a `torch.monitor.Histogram`
+// event through the registered event handlers and resets the counts, so a
+// metrics exporter can pull on its own schedule.
+class TORCH_API Histogram {
+ public:
+  static constexpr int kSubBucketBits = 5;
+  static constexpr int64_t kSubBuckets = int64_t{1} << kSubBucketBits;
+  static constexpr int kNumBuckets = (64 - kSubBucketBits) * kSubBuckets;
+
+  explicit Histogram(std::string name);
+
+  // add records a single value. Negative values are clamped to zero. Safe to
+  // call concurrently from multiple threads.
+  void add(int64_t value);
+
+  // count returns the number of values recorded since the last log().
+  int64_t count() const;
+
+  // quantile returns an upper bound for the q-th quantile (0 <= q <= 1) of
+  // the values recorded since the last log(). Zero if no values.
+  int64_t quantile(double q) const;
+
+  const std::string& name() const noexcept {
+    return name_;
+  }
+
+  // log emits a `torch.monitor.Histogram` event containing the count and the
+  // p50/p90/p99 quantiles, then resets the histogram. Doesn't log if no
+  // values were recorded.
+  void log();
+
+ private:
+  static int bucketIndex(int64_t value);
+  static int64_t bucketUpperBound(int index);
+
+  const std::string name_;
+  std::array<std::atomic<int64_t>, kNumBuckets> buckets_{};
+  std::atomic<int64_t> count_{0};
+};
+
+// enableOpLatencyHistograms registers a global RecordFunction callback that
+// measures the wall time of every top-level operator call and records it, in
+// microseconds, into a Histogram per operator name. To keep label cardinality
+// bounded for the metrics backend, at most `maxOpNames` distinct operator
+// names get their own histogram; the rest are aggregated under
+// `torch.ops.other`. Returns false if the observer is already registered.
+TORCH_API bool enableOpLatencyHistograms(size_t maxOpNames = 256);
+
+// disableOpLatencyHistograms removes the callback and drops the collected
+// histograms without logging them.
+TORCH_API void disableOpLatencyHistograms();
+
+// logOpLatencyHistograms emits one `torch.monitor.Histogram` event per
+// tracked operator via the event handlers and resets the histograms.
+TORCH_API void logOpLatencyHistograms();
+
+} // namespace monitor
+} // namespace torch
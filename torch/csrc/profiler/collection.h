@@ -104,6 +104,10 @@ struct ExtraFields<EventType::Allocation> {
   int64_t alloc_size_;
   int64_t total_allocated_;
   int64_t total_reserved_;
+  // Segment of the caching allocator that ptr_ was carved out of; nullptr
+  // when the reporting allocator does not track segments.
+  void* segment_ptr_;
+  int64_t segment_size_;
   c10::DeviceType device_type_;
   c10::DeviceIndex device_index_;
 };
@@ -21,8 +21,14 @@ struct NVTXThreadLocalState : ProfilerThreadLocalStateBase {
     return ActiveProfilerType::NVTX;
   }
 
-  void reportMemoryUsage(void*, int64_t, int64_t, int64_t, c10::Device)
-      override {}
+  void reportMemoryUsage(
+      void*,
+      int64_t,
+      int64_t,
+      int64_t,
+      c10::Device,
+      void*,
+      int64_t) override {}
 
   static NVTXThreadLocalState* getTLS() {
     auto tls = ProfilerThreadLocalStateBase::getTLS();
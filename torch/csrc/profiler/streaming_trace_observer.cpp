@@ -0,0 +1,306 @@
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <processthreadsapi.h>
+#else
+#include <unistd.h>
+#endif // _WIN32
+
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <ATen/record_function.h>
+#include <torch/csrc/profiler/streaming_trace_observer.h>
+#include <torch/csrc/profiler/util.h>
+
+using namespace at;
+
+namespace torch {
+namespace {
+
+//******************************************************************************
+// Streaming binary trace format.
+//
+// Unlike the Kineto/autograd profilers, which buffer every event in memory
+// until the trace is exported, this observer serializes each event as it
+// completes and flushes the serialized bytes to disk whenever a small staging
+// buffer fills up. Peak memory is therefore bounded by the staging buffer plus
+// the string intern table (one entry per distinct op name), independent of
+// trace duration, which makes continuous production profiling viable.
+//
+// The file layout is a 4-byte magic ("PTST") followed by a format version
+// varint and the recording process id, followed by a sequence of records. All integers are unsigned LEB128
+// varints; signed values are zigzag-encoded first. Record kinds:
+//
+//   kStringRecord: | kind | byte_length | utf8 bytes |
+//     Interns a string. Strings are numbered sequentially from 0 in the
+//     order their records appear.
+//
+//   kEventRecord: | kind | name_id | tid | scope | start_delta | duration_ns |
+//     One completed op. start_delta is the zigzag-encoded difference (in ns)
+//     between this event's start time and the start time of the previous
+//     event record in the file; the first event is relative to 0. Deltas
+//     between neighbouring events are typically small, so they varint-encode
+//     to a few bytes where an absolute epoch timestamp would take ten.
+//
+// The Python decoder lives in torch/profiler/profiler.py
+// (streaming_trace_to_chrome_trace). Keep the two in sync.
+//******************************************************************************
+
+constexpr char kMagic[4] = {'P', 'T', 'S', 'T'};
+constexpr uint64_t kFormatVersion = 1;
+constexpr uint64_t kStringRecord = 0;
+constexpr uint64_t kEventRecord = 1;
+
+// Staging buffer is flushed to the output stream once it grows past this.
+constexpr size_t kFlushThresholdBytes = 64 * 1024;
+
+void appendVarint(std::string& buf, uint64_t value) {
+  while (value >= 0x80) {
+    buf.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  buf.push_back(static_cast<char>(value));
+}
+
+void appendZigzag(std::string& buf, int64_t value) {
+  appendVarint(
+      buf, (static_cast<uint64_t>(value) << 1) ^ (value < 0 ? ~uint64_t(0) : 0));
+}
+
+inline int32_t processId() {
+#ifndef _WIN32
+  return static_cast<int32_t>(getpid());
+#else
+  return static_cast<int32_t>(GetCurrentProcessId());
+#endif
+}
+
+//******************************************************************************
+// Main StreamingTraceObserver implementation.
+//******************************************************************************
+
+static CallbackHandle handle_{INVALID_CALLBACK_HANDLE};
+
+// All mutable observer state. The enter callback only stamps the start time
+// into the per-call context, so the only cross-thread state is the intern
+// table, the staging buffer and the previous start time, all of which are
+// touched under `g_mutex` in the exit callback.
+struct StreamingTraceObserver {
+  // Observer run state.
+  enum class RunState { uninitialized, disabled, enabled };
+
+ private:
+  // Must use accessors to change this so that we can keep the
+  // RecordFunction callback in sync with the state.
+  RunState state{RunState::uninitialized};
+
+ public:
+  // Mutex for multithreaded access to the shared serialization state.
+  std::mutex g_mutex{};
+  // Binary output stream.
+  std::ofstream out{};
+  // Full path to the output file.
+  std::string file_name{};
+  // Serialized records waiting to be flushed to `out`.
+  std::string buffer{};
+  // Maps an already-interned string to its sequential id.
+  std::unordered_map<std::string, uint64_t> string_ids{};
+  // Start time of the previously serialized event, for delta encoding.
+  int64_t prev_start_ns{0};
+  int32_t pid{-1};
+
+  StreamingTraceObserver() = default;
+
+  RunState getState() const {
+    return state;
+  }
+
+  void setState(RunState newState) {
+    if (state == RunState::uninitialized ||
+        callbackShouldBeEnabled(state) != callbackShouldBeEnabled(newState)) {
+      if (callbackShouldBeEnabled(newState)) {
+        reenableCallback(handle_);
+      } else {
+        disableCallback(handle_);
+      }
+    }
+    state = newState;
+  }
+
+  // Returns the intern id for `name`, serializing a string record first if
+  // this is a new string. Must be called with `g_mutex` held.
+  uint64_t internString(const char* name) {
+    auto it = string_ids.find(name);
+    if (it != string_ids.end()) {
+      return it->second;
+    }
+    const auto id = static_cast<uint64_t>(string_ids.size());
+    string_ids.emplace(name, id);
+    const size_t len = std::strlen(name);
+    appendVarint(buffer, kStringRecord);
+    appendVarint(buffer, len);
+    buffer.append(name, len);
+    return id;
+  }
+
+  // Hands the staging buffer to the output stream. Must be called with
+  // `g_mutex` held.
+  void flushBuffer() {
+    if (!buffer.empty()) {
+      out.write(buffer.data(), buffer.size());
+      buffer.clear();
+    }
+  }
+
+ private:
+  static bool callbackShouldBeEnabled(RunState run_state) {
+    return run_state == StreamingTraceObserver::RunState::enabled;
+  }
+};
+
+// Using a singleton pattern here to avoid global static variable
+// initialization race.
+StreamingTraceObserver& observer() {
+  static StreamingTraceObserver _observer{};
+  return _observer;
+}
+
+struct StreamingEventContext : public ObserverContext {
+  int64_t start_ns{0};
+};
+
+bool openOutputFile(StreamingTraceObserver& ob) {
+  ob.out.open(
+      ob.file_name,
+      std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+  if (!ob.out) {
+    LOG(ERROR) << "Failed to open '" << ob.file_name << "'";
+    return false;
+  }
+  VLOG(1) << "Writing PyTorch streaming trace to: " << ob.file_name;
+  ob.out.write(kMagic, sizeof(kMagic));
+  appendVarint(ob.buffer, kFormatVersion);
+  appendVarint(ob.buffer, static_cast<uint64_t>(ob.pid));
+  return true;
+}
+
+std::unique_ptr<ObserverContext> onFunctionEnter(const RecordFunction& fn) {
+  auto& ob = observer();
+  if (ob.getState() != StreamingTraceObserver::RunState::enabled) {
+    return nullptr;
+  }
+  auto ctx = std::make_unique<StreamingEventContext>();
+  ctx->start_ns = torch::profiler::impl::getTime();
+  return ctx;
+}
+
+void onFunctionExit(const RecordFunction& fn, ObserverContext* ctx_ptr) {
+  auto& ob = observer();
+  if (ctx_ptr == nullptr ||
+      ob.getState() != StreamingTraceObserver::RunState::enabled) {
+    return;
+  }
+  auto ctx = dynamic_cast<StreamingEventContext*>(ctx_ptr);
+  if (ctx == nullptr) {
+    LOG(WARNING) << "StreamingEventContext is nullptr.";
+    return;
+  }
+  const auto end_ns = torch::profiler::impl::getTime();
+
+  const std::lock_guard<std::mutex> lock(ob.g_mutex);
+  const auto name_id = ob.internString(fn.name());
+  appendVarint(ob.buffer, kEventRecord);
+  appendVarint(ob.buffer, name_id);
+  appendVarint(ob.buffer, fn.threadId());
+  appendVarint(
+      ob.buffer, static_cast<std::underlying_type_t<RecordScope>>(fn.scope()));
+  appendZigzag(ob.buffer, ctx->start_ns - ob.prev_start_ns);
+  appendVarint(ob.buffer, static_cast<uint64_t>(end_ns - ctx->start_ns));
+  ob.prev_start_ns = ctx->start_ns;
+
+  if (ob.buffer.size() >= kFlushThresholdBytes) {
+    ob.flushBuffer();
+  }
+}
+
+} // namespace
+
+namespace profiler {
+namespace impl {
+// Add streaming trace observer callback functions to the RecordFunction
+// global observers.
+bool addStreamingTraceObserver(const std::string& output_file_path) {
+  if (handle_ == INVALID_CALLBACK_HANDLE) {
+    auto& ob = observer();
+    ob.pid = processId();
+    ob.file_name = output_file_path;
+    if (!openOutputFile(ob)) {
+      return false;
+    }
+
+    handle_ =
+        addGlobalCallback(RecordFunctionCallback(&onFunctionEnter, &onFunctionExit));
+    // Default to disabled.
+    ob.setState(StreamingTraceObserver::RunState::disabled);
+
+    VLOG(1) << "Added PyTorch streaming trace observer, output="
+            << output_file_path;
+  } else {
+    LOG(WARNING) << "Streaming trace observer is already registered.";
+  }
+  return handle_ != INVALID_CALLBACK_HANDLE;
+}
+
+void removeStreamingTraceObserver() {
+  auto& ob = observer();
+  if (ob.getState() != StreamingTraceObserver::RunState::disabled) {
+    disableStreamingTraceObserver();
+  }
+
+  if (handle_ != INVALID_CALLBACK_HANDLE) {
+    {
+      const std::lock_guard<std::mutex> lock(ob.g_mutex);
+      ob.flushBuffer();
+      ob.out.close();
+      ob.string_ids.clear();
+      ob.prev_start_ns = 0;
+    }
+    removeCallback(handle_);
+    handle_ = INVALID_CALLBACK_HANDLE;
+    ob.setState(StreamingTraceObserver::RunState::uninitialized);
+    VLOG(1) << "Removed PyTorch streaming trace observer";
+  } else {
+    LOG(WARNING) << "Streaming trace observer was not registered.";
+  }
+}
+
+void enableStreamingTraceObserver() {
+  auto& ob = observer();
+  if (ob.getState() == StreamingTraceObserver::RunState::enabled) {
+    LOG(WARNING) << "Streaming trace observer is already enabled.";
+    return;
+  }
+  ob.setState(StreamingTraceObserver::RunState::enabled);
+}
+
+void disableStreamingTraceObserver() {
+  auto& ob = observer();
+  if (ob.getState() != StreamingTraceObserver::RunState::disabled) {
+    ob.setState(StreamingTraceObserver::RunState::disabled);
+    // Push whatever has accumulated to disk so the file is readable while the
+    // observer stays registered.
+    const std::lock_guard<std::mutex> lock(ob.g_mutex);
+    ob.flushBuffer();
+    ob.out.flush();
+  }
+}
+} // namespace impl
+} // namespace profiler
+} // namespace torch
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+namespace torch {
+namespace profiler {
+namespace impl {
+
+// Adds the streaming trace observer as a global callback function. Events are
+// flushed incrementally to the output file in a compact binary format
+// (interned strings, delta-encoded timestamps) so memory use stays bounded
+// regardless of how long the capture runs. The output can be converted to a
+// Chrome trace with torch.profiler.streaming_trace_to_chrome_trace().
+bool addStreamingTraceObserver(const std::string& output_file_path);
+
+// Remove the streaming trace observer from the global callback functions.
+void removeStreamingTraceObserver();
+
+// Enables streaming trace observer.
+void enableStreamingTraceObserver();
+
+// Disables streaming trace observer.
+void disableStreamingTraceObserver();
+
+} // namespace impl
+} // namespace profiler
+} // namespace torch
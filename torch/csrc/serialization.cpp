@@ -5,6 +5,12 @@
 #include <torch/csrc/serialization.h>
 #include <c10/core/CPUAllocator.h>
 
+#ifdef USE_CUDA
+#include <ATen/cuda/CUDAEvent.h>
+#include <ATen/cuda/PinnedMemoryAllocator.h>
+#include <c10/cuda/CUDAStream.h>
+#endif
+
 template <class io>
 Py_ssize_t doPartialRead(io fildes, void* buf, size_t nbytes);
 
@@ -168,6 +174,80 @@ void doWrite(io fildes, void* raw_buf, size_t nbytes) {
   }
 }
 
+#ifdef USE_CUDA
+// CUDA storages are streamed to/from the file through two bounded pinned
+// staging buffers instead of a host copy of the whole storage: the device
+// copy of one chunk overlaps the file I/O of the other, and host memory
+// stays bounded no matter how large the storage is.
+constexpr int64_t kCudaStagingChunkBytes = 64 * 1024 * 1024;
+
+template <class io>
+void doWriteCudaChunked(io fd, const uint8_t* device_data, int64_t size_bytes) {
+  if (size_bytes == 0) {
+    return;
+  }
+  const int64_t chunk_bytes = std::min(size_bytes, kCudaStagingChunkBytes);
+  at::Allocator* allocator = at::cuda::getPinnedMemoryAllocator();
+  at::DataPtr buffers[2] = {
+      allocator->allocate(chunk_bytes), allocator->allocate(chunk_bytes)};
+  at::cuda::CUDAEvent events[2];
+  auto stream = c10::cuda::getCurrentCUDAStream();
+
+  auto issue_copy = [&](int64_t offset) {
+    auto slot = (offset / chunk_bytes) % 2;
+    C10_CUDA_CHECK(cudaMemcpyAsync(
+        buffers[slot].get(),
+        device_data + offset,
+        std::min(chunk_bytes, size_bytes - offset),
+        cudaMemcpyDeviceToHost,
+        stream));
+    events[slot].record(stream);
+  };
+
+  issue_copy(0);
+  for (int64_t offset = 0; offset < size_bytes; offset += chunk_bytes) {
+    // start the next chunk's copy so it runs while this chunk is written
+    if (offset + chunk_bytes < size_bytes) {
+      issue_copy(offset + chunk_bytes);
+    }
+    auto slot = (offset / chunk_bytes) % 2;
+    events[slot].synchronize();
+    doWrite(fd, buffers[slot].get(), std::min(chunk_bytes, size_bytes - offset));
+  }
+}
+
+template <class io>
+void doReadCudaChunked(io file, uint8_t* device_data, int64_t size_bytes) {
+  if (size_bytes == 0) {
+    return;
+  }
+  const int64_t chunk_bytes = std::min(size_bytes, kCudaStagingChunkBytes);
+  at::Allocator* allocator = at::cuda::getPinnedMemoryAllocator();
+  at::DataPtr buffers[2] = {
+      allocator->allocate(chunk_bytes), allocator->allocate(chunk_bytes)};
+  at::cuda::CUDAEvent events[2];
+  auto stream = c10::cuda::getCurrentCUDAStream();
+
+  for (int64_t offset = 0; offset < size_bytes; offset += chunk_bytes) {
+    auto slot = (offset / chunk_bytes) % 2;
+    auto nbytes = std::min(chunk_bytes, size_bytes - offset);
+    // wait until the copy that last used this buffer has drained before
+    // overwriting it with fresh file data
+    events[slot].synchronize();
+    doRead(file, buffers[slot].get(), nbytes);
+    C10_CUDA_CHECK(cudaMemcpyAsync(
+        device_data + offset,
+        buffers[slot].get(),
+        nbytes,
+        cudaMemcpyHostToDevice,
+        stream));
+    events[slot].record(stream);
+  }
+  events[0].synchronize();
+  events[1].synchronize();
+}
+#endif
+
 // save_save is necessary since the old eager format saved storages as
 // [size + data], but the v1.5 eager format removes this since size is saved in
 // the filesize.
@@ -181,21 +261,6 @@ void THPStorage_writeFileRaw(c10::StorageImpl *self, io fd, bool save_size, uint
   std::unique_ptr<char[]> cpu_data;
   int64_t size_bytes = self->nbytes();
   int64_t numel = size_bytes / element_size;
-  if (self->device_type() == at::kCPU) {
-    data = self->data<uint8_t>();
-#ifdef USE_CUDA
-  } else if (self->device_type() == at::kCUDA) {
-    cpu_data = std::unique_ptr<char[]>(new char[size_bytes]);
-    data = (uint8_t*)cpu_data.get();
-    C10_CUDA_CHECK(cudaMemcpy(
-        data,
-        self->data<uint8_t>(),
-        size_bytes,
-        cudaMemcpyDeviceToHost));
-#endif
-  } else {
-    TORCH_CHECK(false, "writeFileRaw: Device not recognized: ", self->device_type());
-  }
   if (save_size) {
     if (torch::utils::THP_nativeByteOrder() ==
         torch::utils::THPByteOrder::THP_LITTLE_ENDIAN)
@@ -211,6 +276,30 @@ void THPStorage_writeFileRaw(c10::StorageImpl *self, io fd, bool save_size, uint
       doWrite(fd, &nsize, sizeof(int64_t));
     }
   }
+  if (self->device_type() == at::kCPU) {
+    data = self->data<uint8_t>();
+#ifdef USE_CUDA
+  } else if (self->device_type() == at::kCUDA) {
+    if (element_size == 1 ||
+        torch::utils::THP_nativeByteOrder() ==
+            torch::utils::THPByteOrder::THP_LITTLE_ENDIAN) {
+      // no byte order conversion needed, so the storage can be streamed
+      // straight through bounded pinned staging buffers
+      doWriteCudaChunked(fd, self->data<uint8_t>(), size_bytes);
+      return;
+    }
+    // the big endian conversion below wants the data in one piece
+    cpu_data = std::unique_ptr<char[]>(new char[size_bytes]);
+    data = (uint8_t*)cpu_data.get();
+    C10_CUDA_CHECK(cudaMemcpy(
+        data,
+        self->data<uint8_t>(),
+        size_bytes,
+        cudaMemcpyDeviceToHost));
+#endif
+  } else {
+    TORCH_CHECK(false, "writeFileRaw: Device not recognized: ", self->device_type());
+  }
   // fast track for bytes and little endian
   if (element_size == 1 ||
       torch::utils::THP_nativeByteOrder() ==
@@ -288,6 +377,18 @@ c10::intrusive_ptr<c10::StorageImpl> THPStorage_readFileRaw(
         _storage_nbytes);
   }
 
+#ifdef USE_CUDA
+  if (storage->device_type() == at::kCUDA &&
+      (element_size == 1 ||
+       torch::utils::THP_nativeByteOrder() ==
+           torch::utils::THPByteOrder::THP_LITTLE_ENDIAN)) {
+    // no byte order conversion needed: stream the payload through bounded
+    // pinned staging buffers, overlapping each H2D copy with the next read
+    doReadCudaChunked(file, storage->data<uint8_t>(), nbytes);
+    return storage;
+  }
+#endif
+
   // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
   std::unique_ptr<char[]> cpu_data;
 
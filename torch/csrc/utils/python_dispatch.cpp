@@ -204,6 +204,16 @@ void initDispatchBindings(PyObject* module) {
     c10::Dispatcher::singleton().checkInvariants();
   });
 
+  // Freeze the dispatcher's operator tables before forking workers; see
+  // Dispatcher::finalizeDispatchTables().
+  m.def("_dispatch_finalize", []() {
+    c10::Dispatcher::singleton().finalizeDispatchTables();
+  });
+
+  m.def("_dispatch_is_finalized", []() -> bool {
+    return c10::Dispatcher::singleton().isFinalized();
+  });
+
   m.def("_dispatch_has_kernel", [](const char* name) -> bool {
     auto op = c10::Dispatcher::singleton().findOp(torch::jit::parseName(name));
     return static_cast<bool>(op);
@@ -0,0 +1,106 @@
+import torch
+import torch.distributed as dist
+
+
+class HierarchicalAllreduceState(object):
+    r"""
+    Stores the subgroups used by ``hierarchical_allreduce_hook``.
+
+    The world is split into intra-node subgroups of ``subgroup_size``
+    consecutive ranks each, plus one cross-node "rail" subgroup per local
+    rank that contains the ranks with that local rank on every node. If
+    ``subgroup_size`` is ``None``, the number of CUDA devices on this
+    machine is used, matching the default node-sized subgroups created by
+    ``torch.distributed.new_subgroups``.
+
+    Creating this state is a collective operation: every rank of the
+    default process group must construct it, with the same
+    ``subgroup_size``.
+    """
+
+    def __init__(self, subgroup_size=None):
+        if subgroup_size is None:
+            subgroup_size = torch.cuda.device_count()
+        world_size = dist.get_world_size()
+        if subgroup_size <= 0 or world_size % subgroup_size != 0:
+            raise ValueError(
+                "The world size ({}) must be divisible by the subgroup size ({}).".format(
+                    world_size, subgroup_size
+                )
+            )
+        self.subgroup_size = subgroup_size
+        self.num_nodes = world_size // subgroup_size
+        # The intra-node subgroup containing this rank.
+        self.intra_node_group, _ = dist.new_subgroups(group_size=subgroup_size)
+        # The cross-node subgroup containing this rank: one rank per node,
+        # all with the same local rank ("rail").
+        rails = [
+            [
+                local_rank + node * subgroup_size
+                for node in range(self.num_nodes)
+            ]
+            for local_rank in range(subgroup_size)
+        ]
+        self.cross_node_group, _ = dist.new_subgroups_by_enumeration(rails)
+
+
+def hierarchical_allreduce_hook(
+    state: HierarchicalAllreduceState, bucket: dist.GradBucket
+) -> torch.futures.Future[torch.Tensor]:
+    """
+    This DDP communication hook replaces the flat world-size allreduce with a
+    two-level scheme: a reduce-scatter inside each node, an allreduce of each
+    shard across nodes (one rank per node), and an all-gather inside each
+    node. Only ``1/subgroup_size`` of every gradient bucket crosses the node
+    boundary, which cuts inter-node traffic by the subgroup size (8x on an
+    8-GPU-per-node cluster) while the intra-node phases ride the fast
+    intra-node interconnect. The result is identical to an averaging
+    allreduce, so registering this hook does not change DDP's numerics beyond
+    reduction order.
+
+    The degenerate configurations need no special handling: with a single
+    node the cross-node allreduce is a no-op, and with one rank per node the
+    intra-node phases are no-ops.
+
+    Example::
+        >>> state = HierarchicalAllreduceState(subgroup_size=8)
+        >>> ddp_model.register_comm_hook(state, hierarchical_allreduce_hook)
+    """
+    intra_node_group = state.intra_node_group
+    cross_node_group = state.cross_node_group
+    subgroup_size = state.subgroup_size
+
+    tensor = bucket.buffer()
+    # Apply the division upfront to avoid overflow, especially for FP16.
+    tensor.div_(dist.get_world_size())
+
+    # The reduce-scatter needs the bucket to be evenly divisible across the
+    # intra-node subgroup; pad the tail shard if it is not.
+    numel = tensor.numel()
+    shard_numel = (numel + subgroup_size - 1) // subgroup_size
+    if shard_numel * subgroup_size != numel:
+        padded = tensor.new_zeros(shard_numel * subgroup_size)
+        padded[:numel].copy_(tensor)
+    else:
+        padded = tensor
+    shard = tensor.new_empty(shard_numel)
+
+    fut = dist._reduce_scatter_base(
+        shard, padded, group=intra_node_group, async_op=True
+    ).get_future()
+
+    def cross_node_allreduce(fut):
+        dist.all_reduce(
+            shard, group=cross_node_group, async_op=True
+        ).get_future().wait()
+        return shard
+
+    def intra_node_allgather(fut):
+        dist._all_gather_base(
+            padded, shard, group=intra_node_group, async_op=True
+        ).get_future().wait()
+        if padded is not tensor:
+            tensor.copy_(padded[:numel])
+        return tensor
+
+    return fut.then(cross_node_allreduce).then(intra_node_allgather)
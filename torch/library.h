@@ -424,6 +424,19 @@ inline c10::FunctionSchema&& schema(c10::FunctionSchema&& s) {
   return std::move(s);
 }
 
+/// \private
+///
+/// Already constructed function schemas are accepted if they are
+/// rvalues, with an explicitly specified c10::AliasAnalysisKind.  This
+/// is how the code generator registers schemas it has pre-parsed at
+/// build time (see RegisterSchema.cpp).
+///
+/// \ingroup torch-schema-overloads
+inline c10::FunctionSchema schema(c10::FunctionSchema&& s, c10::AliasAnalysisKind k) {
+  s.setAliasAnalysis(k);
+  return std::move(s);
+}
+
 namespace detail {
 
 inline c10::either<c10::OperatorName, c10::FunctionSchema> constructSchemaOrName(
@@ -56,6 +56,65 @@ def clip_grad_norm_(
     return total_norm
 
 
+def _fused_clip_grad_norm_(
+        parameters: _tensor_or_tensors, max_norm: float, norm_type: float = 2.0,
+        process_group=None) -> torch.Tensor:
+    r"""Fused variant of :func:`clip_grad_norm_`.
+
+    Instead of one reduction per gradient followed by a Python-side
+    combination, this computes the total norm in a single multi-tensor pass
+    and rescales the gradients in a second one. All gradients must be
+    contiguous, dense, of the same floating point dtype and on the same
+    device, and ``norm_type`` must be 1 or 2; other inputs fall back to
+    :func:`clip_grad_norm_`.
+
+    When ``process_group`` is given, the ``norm_type``-th power of the norm
+    (which, unlike the norm itself, is additive across ranks) is all-reduced
+    over the group between the two passes, so every rank clips against the
+    global gradient norm at the cost of a single collective on one scalar.
+
+    Args:
+        parameters (Iterable[Tensor] or Tensor): an iterable of Tensors or a
+            single Tensor that will have gradients normalized
+        max_norm (float or int): max norm of the gradients
+        norm_type (float or int): type of the used p-norm. Must be 1 or 2.
+        process_group (ProcessGroup, optional): if given, the norm is reduced
+            across this group before clipping. Default: ``None``
+
+    Returns:
+        Total norm of the parameter gradients (viewed as a single vector,
+        concatenated across the process group when one is given).
+    """
+    if isinstance(parameters, torch.Tensor):
+        parameters = [parameters]
+    else:
+        # materialize generators: the fallback path iterates a second time
+        parameters = list(parameters)
+    grads = [p.grad for p in parameters if p.grad is not None]
+    max_norm = float(max_norm)
+    norm_type = float(norm_type)
+    if len(grads) == 0:
+        return torch.tensor(0.)
+    fusable = norm_type in (1.0, 2.0) and all(
+        not g.is_sparse and g.is_contiguous() and g.is_floating_point()
+        and g.dtype == grads[0].dtype and g.device == grads[0].device
+        for g in grads)
+    if not fusable:
+        if process_group is not None:
+            raise RuntimeError(
+                "_fused_clip_grad_norm_ with a process_group requires contiguous "
+                "dense gradients of a single floating point dtype on a single "
+                "device and norm_type 1 or 2")
+        return clip_grad_norm_(parameters, max_norm, norm_type)
+    if process_group is None:
+        return torch._fused_clip_grad_norm_(grads, max_norm, norm_type)
+    import torch.distributed as dist
+    total_pow_norm = torch._fused_clip_grad_sq_norm(grads, norm_type)
+    dist.all_reduce(total_pow_norm, group=process_group)
+    torch._fused_clip_grad_scale_(grads, total_pow_norm, max_norm, norm_type)
+    return total_pow_norm if norm_type == 1.0 else total_pow_norm.sqrt()
+
+
 def clip_grad_norm(
         parameters: _tensor_or_tensors, max_norm: float, norm_type: float = 2.,
         error_if_nonfinite: bool = False) -> torch.Tensor:
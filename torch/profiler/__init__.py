@@ -9,10 +9,12 @@ examine their input shapes and stack traces, study device kernel activity and vi
 '''
 from .profiler import profile, _KinetoProfile, \
     schedule, supported_activities, tensorboard_trace_handler, ProfilerAction, \
-    _ExperimentalConfig, ExecutionGraphObserver
+    _ExperimentalConfig, ExecutionGraphObserver, StreamingTraceObserver, \
+    streaming_trace_to_chrome_trace
 from torch._C._autograd import ProfilerActivity, kineto_available, _supported_activities, DeviceType
 from torch.autograd.profiler import record_function
 
 __all__ = ['profile', 'schedule', 'supported_activities',
            'tensorboard_trace_handler', 'ProfilerAction', 'ProfilerActivity',
-           'kineto_available', 'DeviceType', 'record_function', 'ExecutionGraphObserver']
+           'kineto_available', 'DeviceType', 'record_function', 'ExecutionGraphObserver',
+           'StreamingTraceObserver', 'streaming_trace_to_chrome_trace']
@@ -15,6 +15,10 @@ from torch._C._autograd import (
     _remove_execution_graph_observer,
     _enable_execution_graph_observer,
     _disable_execution_graph_observer,
+    _add_streaming_trace_observer,
+    _remove_streaming_trace_observer,
+    _enable_streaming_trace_observer,
+    _disable_streaming_trace_observer,
 )
 from torch.autograd import ProfilerActivity, kineto_available
 
@@ -580,3 +584,151 @@ class ExecutionGraphObserver:
         Returns the output file name.
         """
         return self._output_file_path
+
+
+class StreamingTraceObserver:
+    """Streaming Trace Observer
+
+    Records one compact binary event per completed op and flushes the encoded
+    bytes to the output file incrementally, so memory use stays bounded no
+    matter how long the capture runs. This makes it suitable for continuously
+    profiling long-running jobs where the regular profiler, which buffers the
+    whole trace in memory before export, would run out of memory.
+
+    Each process can have a single StreamingTraceObserver instance. Usage
+    mirrors ExecutionGraphObserver: register_callback() installs the observer,
+    start()/stop() control when events are recorded, and unregister_callback()
+    finalizes the output file. Use streaming_trace_to_chrome_trace() to convert
+    the binary output to a Chrome trace for visualization.
+    """
+    def __init__(self):
+        """
+        Initializes the default states.
+        """
+        self._registered = False
+        self._running = False
+
+    def __del__(self):
+        """
+        Calls unregister_callback() to make sure to finalize outputs.
+        """
+        self.unregister_callback()
+
+    def register_callback(self, output_file_path: str):
+        """
+        Adds the observer to record function callbacks. Encoded events will be
+        streamed to output_file_path.
+        """
+        if not self._registered:
+            self._output_file_path = output_file_path
+            self._registered = _add_streaming_trace_observer(output_file_path)
+
+    def unregister_callback(self):
+        """
+        Removes the observer from record function callbacks and finalizes the
+        output file.
+        """
+        if self._registered:
+            self.stop()
+            _remove_streaming_trace_observer()
+            self._registered = False
+
+    def start(self):
+        """
+        Starts to capture.
+        """
+        if self._registered and not self._running:
+            _enable_streaming_trace_observer()
+            self._running = True
+
+    def stop(self):
+        """
+        Stops to capture.
+        """
+        if self._running:
+            _disable_streaming_trace_observer()
+            self._running = False
+
+    def get_output_file_path(self) -> str:
+        """
+        Returns the output file name.
+        """
+        return self._output_file_path
+
+
+def _read_varint(data: bytes, pos: int) -> Tuple[int, int]:
+    """Decodes an unsigned LEB128 varint, returning (value, next position)."""
+    result = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        result |= (byte & 0x7f) << shift
+        if not byte & 0x80:
+            return result, pos
+        shift += 7
+
+
+def _parse_streaming_trace(data: bytes) -> Tuple[int, List[Dict[str, Any]]]:
+    """Decodes StreamingTraceObserver output into (pid, list of events).
+
+    Each event is a dict with "name", "tid", "scope", "start_ns" and "dur_ns"
+    keys. Must be kept in sync with the encoder in
+    torch/csrc/profiler/streaming_trace_observer.cpp.
+    """
+    if data[:4] != b"PTST":
+        raise ValueError("not a PyTorch streaming trace file (bad magic)")
+    pos = 4
+    version, pos = _read_varint(data, pos)
+    if version != 1:
+        raise ValueError(f"unsupported streaming trace version: {version}")
+    pid, pos = _read_varint(data, pos)
+
+    strings: List[str] = []
+    events: List[Dict[str, Any]] = []
+    prev_start_ns = 0
+    while pos < len(data):
+        kind, pos = _read_varint(data, pos)
+        if kind == 0:  # string intern record
+            length, pos = _read_varint(data, pos)
+            strings.append(data[pos:pos + length].decode("utf-8"))
+            pos += length
+        elif kind == 1:  # event record
+            name_id, pos = _read_varint(data, pos)
+            tid, pos = _read_varint(data, pos)
+            scope, pos = _read_varint(data, pos)
+            zigzag, pos = _read_varint(data, pos)
+            start_delta = (zigzag >> 1) ^ -(zigzag & 1)
+            dur_ns, pos = _read_varint(data, pos)
+            start_ns = prev_start_ns + start_delta
+            prev_start_ns = start_ns
+            events.append({
+                "name": strings[name_id],
+                "tid": tid,
+                "scope": scope,
+                "start_ns": start_ns,
+                "dur_ns": dur_ns,
+            })
+        else:
+            raise ValueError(f"unknown streaming trace record kind: {kind}")
+    return pid, events
+
+
+def streaming_trace_to_chrome_trace(input_path: str, output_path: str):
+    """
+    Converts a binary trace written by StreamingTraceObserver into the Chrome
+    trace JSON format understood by chrome://tracing and Perfetto.
+    """
+    with open(input_path, "rb") as f:
+        pid, events = _parse_streaming_trace(f.read())
+    trace_events = [{
+        "ph": "X",
+        "name": e["name"],
+        "pid": pid,
+        "tid": e["tid"],
+        "ts": e["start_ns"] / 1000.0,
+        "dur": e["dur_ns"] / 1000.0,
+        "args": {"scope": e["scope"]},
+    } for e in events]
+    with open(output_path, "w") as f:
+        json.dump({"traceEvents": trace_events}, f)
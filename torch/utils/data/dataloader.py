@@ -1076,6 +1076,15 @@ class _MultiProcessingDataLoaderIter(_BaseDataLoaderIter):
         self._reset(loader, first_iter=True)
 
     def _reset(self, loader, first_iter=False):
+        # If the previous epoch ran to completion, every dispatched task was
+        # consumed, so the index and result queues are known to be empty. In
+        # that case the workers can be resumed without a full acknowledgement
+        # barrier: the `_ResumeIteration` acks are collected lazily in
+        # `_next_data` while the workers already work on the new epoch's
+        # indices. When an epoch was abandoned mid-way, stale results may
+        # still be in flight and have to be drained before task indices are
+        # reused, so we fall back to the blocking barrier.
+        needs_drain = not first_iter and self._tasks_outstanding > 0
         super()._reset(loader, first_iter)
         self._send_idx = 0  # idx of the next task to be sent to workers
         self._rcvd_idx = 0  # idx of the next task to be returned in __next__
@@ -1098,12 +1107,21 @@ class _MultiProcessingDataLoaderIter(_BaseDataLoaderIter):
         if not first_iter:
             for idx in range(self._num_workers):
                 self._index_queues[idx].put(_utils.worker._ResumeIteration(self._shared_seed))
-            resume_iteration_cnt = self._num_workers
-            while resume_iteration_cnt > 0:
-                return_idx, return_data = self._get_data()
-                if isinstance(return_idx, _utils.worker._ResumeIteration):
-                    assert return_data is None
-                    resume_iteration_cnt -= 1
+            if needs_drain:
+                # acks left over from a previous lazy resume are still in the
+                # result queue and have to be counted as well, otherwise the
+                # drain below would stop at the wrong epoch boundary
+                resume_iteration_cnt = self._num_workers + self._resume_acks_outstanding
+                self._resume_acks_outstanding = 0
+                while resume_iteration_cnt > 0:
+                    return_idx, return_data = self._get_data()
+                    if isinstance(return_idx, _utils.worker._ResumeIteration):
+                        assert return_data is None
+                        resume_iteration_cnt -= 1
+            else:
+                self._resume_acks_outstanding += self._num_workers
+        else:
+            self._resume_acks_outstanding = 0
         # prime the prefetch loop
         for _ in range(self._prefetch_factor * self._num_workers):
             self._try_put_index()
@@ -1318,6 +1336,11 @@ class _MultiProcessingDataLoaderIter(_BaseDataLoaderIter):
 
             assert not self._shutdown and self._tasks_outstanding > 0
             idx, data = self._get_data()
+            if isinstance(idx, _utils.worker._ResumeIteration):
+                # lazily collected resume acknowledgement (see `_reset`)
+                assert data is None
+                self._resume_acks_outstanding -= 1
+                continue
             self._tasks_outstanding -= 1
             if self._dataset_kind == _DatasetKind.Iterable:
                 # Check for _IterableDatasetStopIteration
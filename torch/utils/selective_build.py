@@ -0,0 +1,75 @@
+"""Utilities for generating selective build operator lists from runtime traces.
+
+Selective build (see ``torchgen/selective_build``) strips unused operator
+kernels out of a custom build, but needs a static list of the operators the
+workload actually uses. The mobile model tracer can produce that list for
+bundled mobile models; this module produces it for arbitrary eager/scripted
+workloads by recording every operator dispatched while a representative run
+(e.g. a QA suite) executes.
+
+Example::
+
+    from torch.utils.selective_build import (
+        trace_called_operators,
+        write_selected_operators_yaml,
+    )
+
+    with trace_called_operators() as ops:
+        run_qa_workload()
+    write_selected_operators_yaml("selected_operators.yaml", ops)
+
+The resulting YAML is consumed by the code generator (and ultimately the
+linker, which drops the unregistered kernels) through
+``torchgen.selective_build.selector.SelectiveBuilder``, e.g. via the
+``SELECTED_OP_LIST`` option of a custom build.
+"""
+
+import contextlib
+from typing import Iterable, Iterator, Set
+
+import torch
+
+__all__ = ["trace_called_operators", "write_selected_operators_yaml"]
+
+
+@contextlib.contextmanager
+def trace_called_operators() -> Iterator[Set[str]]:
+    """Context manager recording every operator dispatched in its scope.
+
+    Yields a set which, once the ``with`` block exits, contains the
+    fully-qualified name (``namespace::operator.overload``) of every operator
+    that was called via the dispatcher, on any thread. Tracing may not be
+    nested.
+    """
+    torch._C._jit_start_operator_call_tracing()
+    ops: Set[str] = set()
+    try:
+        yield ops
+    finally:
+        ops.update(torch._C._jit_stop_operator_call_tracing())
+
+
+def write_selected_operators_yaml(
+    path: str,
+    operators: Iterable[str],
+    *,
+    used_for_training: bool = False,
+) -> None:
+    """Writes an operator list in the format selective build expects.
+
+    The format matches the output of the mobile model tracer binary
+    (torch/csrc/jit/mobile/model_tracer/tracer.cpp). A runtime trace cannot
+    distinguish root operators from transitively called ones, so every traced
+    operator is conservatively marked as a root operator, which keeps it
+    unconditionally.
+    """
+    with open(path, "w") as out:
+        out.write("include_all_non_op_selectives: true\n")
+        out.write("operators:\n")
+        for op in sorted(set(operators)):
+            out.write(f"  {op}:\n")
+            out.write(
+                f"    is_used_for_training: {'true' if used_for_training else 'false'}\n"
+            )
+            out.write("    is_root_operator: true\n")
+            out.write("    include_all_overloads: false\n")
@@ -0,0 +1,273 @@
+"""
+Renders a torchgen FunctionSchema as a C++ expression that constructs the
+corresponding c10::FunctionSchema directly, so that RegisterSchema.cpp can
+register codegen'd operators without going through the runtime schema string
+parser at static initialization time.
+
+The contract here is exact: the expression we emit must construct precisely
+the schema that torch/csrc/jit/frontend/function_schema_parser.cpp would have
+produced from str(func), including the fake/real type split for ScalarType,
+Layout and MemoryFormat and the parser's lexical treatment of default values
+(e.g. the default of an optional float typed by the presence of a decimal
+point, not by the declared type).  Whenever a schema uses a construct we are
+not certain we reproduce faithfully, we return None and the caller falls back
+to registering the schema string; test_function_schema.py's round-trip test
+(parse_schema(str(schema)) == schema) keeps this translation honest.
+"""
+
+import re
+from typing import List, Optional, Tuple
+
+from torchgen.model import (
+    Annotation,
+    Argument,
+    BaseTy,
+    BaseType,
+    FunctionSchema,
+    ListType,
+    OptionalType,
+    Return,
+    Type,
+)
+
+# BaseTy -> (fake type expression, real type expression), following
+# SchemaTypeParser::parseBaseType and parseFakeAndRealType: the fake type of
+# ScalarType, Layout and MemoryFormat arguments is Int, everything else
+# coincides.  DimVector and ConstQuantizerPtr are deliberately absent; they
+# never show up in registered schemas and fall back to the string form.
+BASE_TYPE_EXPRS = {
+    BaseTy.Generator: ("c10::GeneratorType::get()", "c10::GeneratorType::get()"),
+    BaseTy.ScalarType: ("c10::IntType::get()", "c10::ScalarTypeType::get()"),
+    BaseTy.Tensor: ("c10::TensorType::get()", "c10::TensorType::get()"),
+    BaseTy.int: ("c10::IntType::get()", "c10::IntType::get()"),
+    BaseTy.Dimname: ("c10::StringType::get()", "c10::StringType::get()"),
+    BaseTy.float: ("c10::FloatType::get()", "c10::FloatType::get()"),
+    BaseTy.str: ("c10::StringType::get()", "c10::StringType::get()"),
+    BaseTy.bool: ("c10::BoolType::get()", "c10::BoolType::get()"),
+    BaseTy.Layout: ("c10::IntType::get()", "c10::LayoutType::get()"),
+    BaseTy.Device: ("c10::DeviceObjType::get()", "c10::DeviceObjType::get()"),
+    BaseTy.Scalar: ("c10::NumberType::get()", "c10::NumberType::get()"),
+    BaseTy.MemoryFormat: ("c10::IntType::get()", "c10::MemoryFormatType::get()"),
+    BaseTy.QScheme: ("c10::QSchemeType::get()", "c10::QSchemeType::get()"),
+    BaseTy.Storage: ("c10::StorageType::get()", "c10::StorageType::get()"),
+    BaseTy.Stream: ("c10::StreamObjType::get()", "c10::StreamObjType::get()"),
+    BaseTy.SymInt: ("c10::SymIntType::get()", "c10::SymIntType::get()"),
+}
+
+# Enumeration identifiers the schema parser accepts as default values
+# (SchemaParser::parseSingleConstant); all of them parse as int64_t.
+ENUM_DEFAULT_EXPRS = {
+    "float": "static_cast<int64_t>(c10::ScalarType::Float)",
+    "complex": "static_cast<int64_t>(c10::ScalarType::ComplexFloat)",
+    "long": "static_cast<int64_t>(c10::ScalarType::Long)",
+    "strided": "static_cast<int64_t>(c10::Layout::Strided)",
+    "Mean": "static_cast<int64_t>(at::Reduction::Mean)",
+    "contiguous_format": "static_cast<int64_t>(c10::MemoryFormat::Contiguous)",
+}
+
+NUMBER_RE = re.compile(r"^-?(\d+(\.\d*)?|\.\d+)(e[+-]?\d+)?$", re.IGNORECASE)
+STRING_RE = re.compile(r"^(\"[^\"'\\]*\"|'[^\"'\\]*')$")
+
+
+def type_exprs(t: Type) -> Optional[Tuple[str, str]]:
+    if isinstance(t, BaseType):
+        return BASE_TYPE_EXPRS.get(t.name)
+    if isinstance(t, OptionalType):
+        elem = type_exprs(t.elem)
+        if elem is None:
+            return None
+        return tuple(f"c10::OptionalType::create({e})" for e in elem)  # type: ignore[return-value]
+    if isinstance(t, ListType):
+        elem = type_exprs(t.elem)
+        if elem is None:
+            return None
+        return tuple(f"c10::ListType::create({e})" for e in elem)  # type: ignore[return-value]
+    return None
+
+
+def list_size(t: Type) -> Optional[int]:
+    # A size hint can only occur on the outermost list, possibly wrapped in
+    # an optional ('int[2]' or 'int[2]?'); it lands in Argument::N.
+    if isinstance(t, OptionalType):
+        t = t.elem
+    if isinstance(t, ListType):
+        return t.size
+    return None
+
+
+def single_constant_expr(text: str, *, is_float_kind: bool) -> Optional[str]:
+    if text == "True":
+        return "true"
+    if text == "False":
+        return "false"
+    if text == "None":
+        return "c10::IValue()"
+    if STRING_RE.match(text):
+        return f'std::string("{text[1:-1]}")'
+    if text in ENUM_DEFAULT_EXPRS:
+        return ENUM_DEFAULT_EXPRS[text]
+    # The parser types a numeric literal by its spelling unless the declared
+    # type is (non-optional) float: '1' stays an int64_t even for an optional
+    # float argument.
+    if NUMBER_RE.match(text) and (is_float_kind or "." in text or "e" in text):
+        return f"double({text})"
+    if re.match(r"^-?\d+$", text):
+        value = int(text)
+        if not -(2**63) < value < 2**63:
+            return None
+        return f"int64_t({text})"
+    return None
+
+
+def list_default_expr(default: str, elem: Type, n: Optional[int]) -> Optional[str]:
+    if not isinstance(elem, BaseType):
+        return None
+    if elem.name == BaseTy.int:
+        vector = "std::vector<int64_t>"
+    elif elem.name == BaseTy.float:
+        vector = "std::vector<double>"
+    elif elem.name == BaseTy.bool:
+        vector = "std::vector<bool>"
+    else:
+        return None
+    is_float_kind = elem.name == BaseTy.float
+
+    def element_expr(text: str) -> Optional[str]:
+        e = single_constant_expr(text, is_float_kind=is_float_kind)
+        if e is None:
+            return None
+        # The element expression must agree with the vector's element type;
+        # anything else would not have parsed either.
+        if elem.name == BaseTy.int and not e.startswith("int64_t("):
+            return None
+        if elem.name == BaseTy.float and not e.startswith("double("):
+            return None
+        if elem.name == BaseTy.bool and e not in ("true", "false"):
+            return None
+        return e
+
+    elems: List[str] = []
+    if n is not None and not default.startswith("["):
+        # A scalar default on a sized list replicates, e.g. 'int[2] k=1'.
+        e = element_expr(default)
+        if e is None:
+            return None
+        elems = [e] * n
+    else:
+        if not (default.startswith("[") and default.endswith("]")):
+            return None
+        body = default[1:-1].strip()
+        for item in body.split(",") if body else []:
+            e = element_expr(item.strip())
+            if e is None:
+                return None
+            elems.append(e)
+    return f"{vector}{{{', '.join(elems)}}}"
+
+
+def default_expr(default: str, t: Type, n: Optional[int]) -> Optional[str]:
+    # Mirrors SchemaParser::parseDefaultValue, which switches on the fake
+    # type's kind.
+    if isinstance(t, BaseType):
+        if t.name in (BaseTy.Tensor, BaseTy.Generator):
+            return "c10::IValue()" if default == "None" else None
+        if t.name in (BaseTy.str, BaseTy.Dimname):
+            return single_constant_expr(default, is_float_kind=False)
+        if t.name in (BaseTy.int, BaseTy.ScalarType, BaseTy.Layout, BaseTy.MemoryFormat, BaseTy.bool, BaseTy.Scalar):
+            return single_constant_expr(default, is_float_kind=False)
+        if t.name == BaseTy.float:
+            return single_constant_expr(default, is_float_kind=True)
+        if t.name == BaseTy.Device:
+            if STRING_RE.match(default):
+                return f'c10::Device("{default[1:-1]}")'
+            return None
+        return None
+    if isinstance(t, OptionalType):
+        # The parser does not recurse into the element type here: the default
+        # of any optional argument is parsed as a single constant whose
+        # numeric literals are typed lexically.
+        return single_constant_expr(default, is_float_kind=False)
+    if isinstance(t, ListType):
+        return list_default_expr(default, t.elem, n)
+    return None
+
+
+def alias_info_expr(annotation: Optional[Annotation], t: Type) -> Optional[str]:
+    if annotation is None:
+        return "c10::nullopt"
+    # The parser attaches the annotation of a 'Tensor(a!)[]' argument to the
+    # list element and then drops it because the list itself is unannotated;
+    # rather than reproduce that, fall back to the string form.
+    if isinstance(t, ListType) or (
+        isinstance(t, OptionalType) and isinstance(t.elem, ListType)
+    ):
+        return None
+    if len(annotation.alias_set) != 1 or annotation.alias_set_after:
+        return None
+    is_write = "true" if annotation.is_write else "false"
+    return f'makeAliasInfo("{annotation.alias_set[0]}", {is_write})'
+
+
+def argument_expr(a: Argument, *, kwarg_only: bool) -> Optional[str]:
+    types = type_exprs(a.type)
+    if types is None:
+        return None
+    fake, real = types
+    n = list_size(a.type)
+    n_expr = "c10::nullopt" if n is None else str(n)
+    if a.default is None:
+        d_expr: Optional[str] = "c10::nullopt"
+    else:
+        d_expr = default_expr(a.default, a.type, n)
+        if d_expr is None:
+            return None
+        if d_expr != "c10::IValue()":
+            d_expr = f"c10::IValue({d_expr})"
+    alias = alias_info_expr(a.annotation, a.type)
+    if alias is None:
+        return None
+    ko = "true" if kwarg_only else "false"
+    return f'c10::Argument("{a.name}", {fake}, {real}, {n_expr}, {d_expr}, {ko}, {alias})'
+
+
+def return_expr(r: Return) -> Optional[str]:
+    types = type_exprs(r.type)
+    if types is None:
+        return None
+    fake, real = types
+    n = list_size(r.type)
+    n_expr = "c10::nullopt" if n is None else str(n)
+    alias = alias_info_expr(r.annotation, r.type)
+    if alias is None:
+        return None
+    name = r.name if r.name is not None else ""
+    return f'c10::Argument("{name}", {fake}, {real}, {n_expr}, c10::nullopt, false, {alias})'
+
+
+def pre_parsed_schema_expr(func: FunctionSchema) -> Optional[str]:
+    arguments: List[str] = []
+    for a in func.arguments.flat_positional:
+        e = argument_expr(a, kwarg_only=False)
+        if e is None:
+            return None
+        arguments.append(e)
+    for a in list(func.arguments.flat_kwarg_only) + list(func.arguments.out):
+        e = argument_expr(a, kwarg_only=True)
+        if e is None:
+            return None
+        arguments.append(e)
+    returns: List[str] = []
+    for r in func.returns:
+        e = return_expr(r)
+        if e is None:
+            return None
+        returns.append(e)
+    args_str = ",\n        ".join(arguments)
+    rets_str = ",\n        ".join(returns)
+    return (
+        f'c10::FunctionSchema(\n'
+        f'    "{func.name.name}",\n'
+        f'    "{func.name.overload_name}",\n'
+        f'    {{{args_str}}},\n'
+        f'    {{{rets_str}}})'
+    )
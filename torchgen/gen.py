@@ -48,6 +48,7 @@ from torchgen.api.types import (
     SpecialArgName,
 )
 from torchgen.api import cpp
+from torchgen.api import cpp_schema
 import torchgen.api.dispatcher as dispatcher
 import torchgen.api.native as native
 import torchgen.api.meta as meta
@@ -501,6 +502,17 @@ class RegisterSchema:
     def __call__(self, f: NativeFunction) -> Optional[str]:
         if not self.selector.is_native_function_selected(f):
             return None
+        # Schemas we can reproduce exactly are registered as pre-constructed
+        # c10::FunctionSchema objects, which skips the schema string parser
+        # at static initialization time; anything cpp_schema cannot express
+        # falls back to the string form.
+        expr = cpp_schema.pre_parsed_schema_expr(f.func)
+        if expr is not None:
+            return (
+                f"// {f.func}\n"
+                f"m.def(torch::schema({expr},\n"
+                f"    c10::AliasAnalysisKind::FROM_SCHEMA));\n"
+            )
         return f"m.def({cpp_string(str(f.func))});\n"
 
 
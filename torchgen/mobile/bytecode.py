@@ -0,0 +1,150 @@
+"""Reader for the mobile bytecode archive of a serialized mobile model.
+
+A ``.ptl`` file is a zip archive whose ``bytecode.pkl`` entry holds, per
+method, the instruction stream, operator table, constant table, type table
+and register count that the lite interpreter executes
+(see torch/csrc/jit/serialization/export_module.cpp for the writer and
+torch/csrc/jit/mobile/parse_bytecode.cpp for the runtime reader).
+
+This module recovers just the metadata that AOT code generation needs.
+Constants that cannot be materialized without the full torch runtime
+(tensors, custom classes) are replaced by :class:`OpaqueConstant` stand-ins;
+generated code refers to those by their index in the constant table.
+"""
+
+import io
+import pickle
+import zipfile
+from dataclasses import dataclass
+from typing import Any, Dict, List, Optional, Tuple
+
+
+@dataclass(frozen=True)
+class Instruction:
+    """One lite-interpreter instruction; see torch/csrc/jit/runtime/instruction.h
+    for the meaning of X and N per opcode."""
+
+    op: str
+    X: int
+    N: int
+
+
+@dataclass(frozen=True)
+class OperatorCall:
+    """One entry of a method's operator table.  num_specified_args is None for
+    bytecode versions that predate trailing-default trimming (v5 and older)."""
+
+    name: str
+    overload_name: str
+    num_specified_args: Optional[int]
+
+
+@dataclass(frozen=True)
+class MobileMethod:
+    qualified_name: str
+    instructions: Tuple[Instruction, ...]
+    operators: Tuple[OperatorCall, ...]
+    constants: Tuple[Any, ...]
+    types: Tuple[str, ...]
+    register_size: int
+
+    @property
+    def name(self) -> str:
+        return self.qualified_name.rsplit(".", 1)[-1]
+
+
+class OpaqueConstant:
+    """Stand-in for a pickled value we deliberately do not materialize."""
+
+    def __init__(self, *args: Any, **kwargs: Any) -> None:
+        pass
+
+
+def _identity(data: Any) -> Any:
+    return data
+
+
+def _restore_type_tag(value: Any, type_str: str) -> Any:
+    return value
+
+
+class _BytecodeUnpickler(pickle.Unpickler):
+    """Unpickler restricted to what bytecode.pkl actually contains.
+
+    Tensor constants are stored behind persistent ids (their payload lives in
+    the constants archive of the zip file); we only need to know that a table
+    slot holds one, so persistent loads become OpaqueConstant markers.
+    """
+
+    def persistent_load(self, pid: Any) -> Any:
+        return OpaqueConstant(pid)
+
+    def find_class(self, module: str, name: str) -> Any:
+        if module == "torch.jit._pickle":
+            if name in (
+                "build_intlist",
+                "build_doublelist",
+                "build_boollist",
+                "build_tensorlist",
+                "build_tensor_from_id",
+            ):
+                return _identity
+            if name == "restore_type_tag":
+                return _restore_type_tag
+        if module == "torch" or module.startswith("torch."):
+            return OpaqueConstant
+        raise pickle.UnpicklingError(
+            f"unexpected global {module}.{name} in mobile bytecode archive"
+        )
+
+
+def _parse_table(table: Tuple[Any, ...]) -> Dict[str, Any]:
+    return {entry[0]: entry[1] for entry in table}
+
+
+def parse_bytecode_pickle(data: bytes) -> List[MobileMethod]:
+    """Parses the raw contents of bytecode.pkl into MobileMethods."""
+    archive = _BytecodeUnpickler(io.BytesIO(data)).load()
+    # Element 0 is the bytecode format version; each following element is
+    # (qualified_name, code_table, schema_table).
+    methods = []
+    for entry in archive[1:]:
+        qualified_name = entry[0]
+        code = _parse_table(entry[1])
+        instructions = tuple(
+            Instruction(op=ins[0], X=ins[1], N=ins[2]) for ins in code["instructions"]
+        )
+        operators = tuple(
+            OperatorCall(
+                name=op[0],
+                overload_name=op[1],
+                num_specified_args=op[2] if len(op) > 2 else None,
+            )
+            for op in code["operators"]
+        )
+        methods.append(
+            MobileMethod(
+                qualified_name=qualified_name,
+                instructions=instructions,
+                operators=operators,
+                constants=tuple(code["constants"]),
+                types=tuple(code["types"]),
+                register_size=code["register_size"],
+            )
+        )
+    return methods
+
+
+def load_mobile_methods(model_path: str) -> List[MobileMethod]:
+    """Loads all methods from a serialized mobile model (.ptl zip archive)."""
+    with zipfile.ZipFile(model_path) as archive:
+        bytecode_entries = [
+            name for name in archive.namelist() if name.endswith("bytecode.pkl")
+        ]
+        if len(bytecode_entries) != 1:
+            raise RuntimeError(
+                f"{model_path} does not look like a mobile model: expected exactly "
+                f"one bytecode.pkl entry, found {len(bytecode_entries)}"
+            )
+        data = archive.read(bytecode_entries[0])
+    return parse_bytecode_pickle(data)
@@ -0,0 +1,471 @@
+"""AOT compiler for mobile models: bytecode -> straight-line C++.
+
+The lite interpreter dispatches per instruction and resolves every operator
+through the dispatcher at model load. For latency-critical on-device models
+that is pure overhead, so this generator translates one method of a mobile
+model into a C++ function whose body is the method's op sequence spelled out
+as direct calls to the unboxed ``at::`` API — no interpreter loop, no operator
+table, no schema resolution at runtime. It plays the same role for mobile
+that torchgen/static_runtime's generated_ops.cpp plays for server.
+
+Only straight-line bytecode is supported: control flow (JF/JMP/LOOP), calls
+into other functions and class construction fall back with an error telling
+the user to keep using the interpreter for that method. Scalar constants are
+inlined into the generated code; tensor constants are passed in at runtime
+from the loaded module's constant table (loading stays unchanged — only
+execution is compiled ahead of time).
+
+Usage:
+
+    python -m torchgen.mobile.gen_aot_model \\
+        --model keyboard_model.ptl --method forward --output aot_forward.cpp
+
+The generated function has the signature
+
+    std::vector<c10::IValue> <method>(
+        c10::ArrayRef<c10::IValue> constants,
+        std::vector<c10::IValue> inputs);
+
+where ``constants`` is mobile::Function::get_code().constants_ of the loaded
+method and ``inputs`` is the usual stack input (self first, then arguments).
+"""
+
+import argparse
+import os
+from typing import Dict, List, Optional, Sequence
+
+from torchgen.gen import parse_native_yaml
+from torchgen.model import (
+    BaseTy,
+    BaseType,
+    ListType,
+    NativeFunction,
+    OptionalType,
+    Type,
+)
+from torchgen.mobile.bytecode import (
+    Instruction,
+    MobileMethod,
+    load_mobile_methods,
+)
+
+
+class AotUnsupportedError(RuntimeError):
+    """Raised when a method cannot be compiled ahead of time; such methods
+    must keep running on the lite interpreter."""
+
+
+# Accessors pulling an unboxed value of a given schema type out of an IValue.
+IVALUE_ACCESSORS: Dict[BaseTy, str] = {
+    BaseTy.Tensor: "toTensor()",
+    BaseTy.int: "toInt()",
+    BaseTy.float: "toDouble()",
+    BaseTy.bool: "toBool()",
+    BaseTy.str: "toStringRef()",
+    BaseTy.Scalar: "toScalar()",
+    BaseTy.ScalarType: "toScalarType()",
+    BaseTy.Layout: "toLayout()",
+    BaseTy.Device: "toDevice()",
+    BaseTy.MemoryFormat: "toMemoryFormat()",
+}
+
+# C++ payload types for optional arguments, used with IValue::toOptional<T>().
+OPTIONAL_PAYLOAD_TYPES: Dict[BaseTy, str] = {
+    BaseTy.Tensor: "at::Tensor",
+    BaseTy.int: "int64_t",
+    BaseTy.float: "double",
+    BaseTy.bool: "bool",
+    BaseTy.Scalar: "at::Scalar",
+    BaseTy.ScalarType: "at::ScalarType",
+    BaseTy.Layout: "at::Layout",
+    BaseTy.Device: "at::Device",
+    BaseTy.MemoryFormat: "at::MemoryFormat",
+}
+
+# Element types we know how to build a c10::List of, keyed by the type-table
+# string LIST_CONSTRUCT refers to.
+LIST_ELEMENT_TYPES: Dict[str, str] = {
+    "List[Tensor]": "at::Tensor",
+    "List[Optional[Tensor]]": "c10::optional<at::Tensor>",
+    "List[int]": "int64_t",
+    "List[float]": "double",
+    "List[bool]": "bool",
+}
+
+
+def cpp_string_literal(value: str) -> str:
+    escaped = (
+        value.replace("\\", "\\\\")
+        .replace('"', '\\"')
+        .replace("\n", "\\n")
+        .replace("\t", "\\t")
+    )
+    return f'"{escaped}"'
+
+
+def cpp_double_literal(value: float) -> str:
+    if value != value:  # NaN
+        return "std::numeric_limits<double>::quiet_NaN()"
+    if value == float("inf"):
+        return "std::numeric_limits<double>::infinity()"
+    if value == float("-inf"):
+        return "-std::numeric_limits<double>::infinity()"
+    return repr(value)
+
+
+class AotMethodEmitter:
+    """Emits the body of one MobileMethod as straight-line C++.
+
+    The interpreter's value stack is simulated at generation time: each slot
+    holds a C++ expression (all of type c10::IValue) and every push is popped
+    exactly once, so expressions never get re-evaluated.
+    """
+
+    def __init__(
+        self,
+        method: MobileMethod,
+        native_functions: Sequence[NativeFunction],
+        num_inputs: Optional[int] = None,
+    ) -> None:
+        self.method = method
+        self.ops_by_name: Dict[str, NativeFunction] = {
+            str(f.func.name): f for f in native_functions
+        }
+        self.lines: List[str] = []
+        self.stack: List[str] = []
+        self.declared_registers: List[int] = []
+        self.next_value_id = 0
+        if num_inputs is None:
+            num_inputs = self._infer_num_inputs()
+        self.stack = [f"std::move(inputs[{i}])" for i in range(num_inputs)]
+
+    def _infer_num_inputs(self) -> int:
+        # Methods conventionally begin by draining the input stack into
+        # registers; that STOREN tells us the arity.
+        instructions = self.method.instructions
+        if instructions and instructions[0].op == "STOREN":
+            return instructions[0].N
+        raise AotUnsupportedError(
+            f"{self.method.qualified_name} does not start with STOREN; pass "
+            "--num-inputs explicitly"
+        )
+
+    def fresh(self, prefix: str = "v") -> str:
+        name = f"{prefix}{self.next_value_id}"
+        self.next_value_id += 1
+        return name
+
+    def pop(self) -> str:
+        if not self.stack:
+            raise AotUnsupportedError(
+                f"value stack underflow while compiling {self.method.qualified_name}"
+            )
+        return self.stack.pop()
+
+    def pop_n(self, n: int) -> List[str]:
+        if len(self.stack) < n:
+            raise AotUnsupportedError(
+                f"value stack underflow while compiling {self.method.qualified_name}"
+            )
+        popped = self.stack[len(self.stack) - n :]
+        del self.stack[len(self.stack) - n :]
+        return popped
+
+    def register(self, index: int) -> str:
+        if index not in self.declared_registers:
+            self.declared_registers.append(index)
+        return f"r{index}"
+
+    def constant_expr(self, index: int) -> str:
+        value = self.method.constants[index]
+        if value is None:
+            return "c10::IValue()"
+        if isinstance(value, bool):
+            return f"c10::IValue({'true' if value else 'false'})"
+        if isinstance(value, int):
+            return f"c10::IValue(static_cast<int64_t>({value}))"
+        if isinstance(value, float):
+            return f"c10::IValue({cpp_double_literal(value)})"
+        if isinstance(value, str):
+            return f"c10::IValue(std::string({cpp_string_literal(value)}))"
+        # Tensors (and anything else we did not materialize) come from the
+        # loaded module's constant table at runtime.
+        return f"constants[{index}]"
+
+    def argument_from_ivalue(self, t: Type, expr: str) -> str:
+        if isinstance(t, BaseType):
+            accessor = IVALUE_ACCESSORS.get(t.name)
+            if accessor is not None:
+                return f"{expr}.{accessor}"
+        elif isinstance(t, OptionalType):
+            elem = t.elem
+            if isinstance(elem, BaseType):
+                payload = OPTIONAL_PAYLOAD_TYPES.get(elem.name)
+                if payload is not None:
+                    return f"{expr}.toOptional<{payload}>()"
+            if isinstance(elem, ListType) and elem.elem == BaseType(BaseTy.int):
+                # at:: takes OptionalIntArrayRef here; hoist the vector so the
+                # ArrayRef has storage for the duration of the call.
+                storage = self.fresh("optlist")
+                self.lines.append(
+                    f"auto {storage} = {expr}.isNone() ? std::vector<int64_t>() "
+                    f": {expr}.toIntVector();"
+                )
+                return (
+                    f"{expr}.isNone() ? c10::optional<at::IntArrayRef>(c10::nullopt) "
+                    f": c10::optional<at::IntArrayRef>({storage})"
+                )
+        elif isinstance(t, ListType):
+            if t.elem == BaseType(BaseTy.int):
+                return f"{expr}.toIntVector()"
+            if t.elem == BaseType(BaseTy.float):
+                return f"{expr}.toDoubleVector()"
+            if t.elem == BaseType(BaseTy.Tensor):
+                return f"{expr}.toTensorVector()"
+            if t.elem == OptionalType(BaseType(BaseTy.Tensor)):
+                return f"{expr}.toOptionalTensorList()"
+        raise AotUnsupportedError(f"no unboxing rule for argument type '{t}'")
+
+    def emit_op(self, op_index: int) -> None:
+        op = self.method.operators[op_index]
+        if not op.name.startswith("aten::"):
+            raise AotUnsupportedError(
+                f"operator {op.name} is not an aten op; only native_functions.yaml "
+                "ops can be compiled ahead of time"
+            )
+        key = op.name[len("aten::") :]
+        if op.overload_name:
+            key = f"{key}.{op.overload_name}"
+        f = self.ops_by_name.get(key)
+        if f is None:
+            raise AotUnsupportedError(f"operator aten::{key} not found in native_functions.yaml")
+        schema = f.func
+        schema_args = list(schema.schema_order_arguments())
+        num_args = (
+            op.num_specified_args
+            if op.num_specified_args is not None
+            else len(schema_args)
+        )
+        if schema.arguments.out and num_args != len(schema_args):
+            raise AotUnsupportedError(
+                f"aten::{key} is an out variant called with trimmed arguments"
+            )
+        arg_exprs = self.pop_n(num_args)
+        converted = [
+            self.argument_from_ivalue(a.type, e)
+            for a, e in zip(schema_args[:num_args], arg_exprs)
+        ]
+        name = schema.name.name.base
+        if schema.name.name.inplace:
+            name += "_"
+        if schema.arguments.out:
+            # The faithful _outf overload takes arguments in schema order,
+            # out tensors last — exactly how they sit on the stack.
+            call = f"at::{name}_outf({', '.join(converted)})"
+        else:
+            call = f"at::{name}({', '.join(converted)})"
+        returns = schema.returns
+        if len(returns) == 0:
+            self.lines.append(f"{call};")
+        elif len(returns) == 1:
+            out = self.fresh("out")
+            self.lines.append(f"auto {out} = {call};")
+            self.stack.append(f"c10::IValue({out})")
+        else:
+            out = self.fresh("out")
+            self.lines.append(f"auto {out} = {call};")
+            for i in range(len(returns)):
+                self.stack.append(f"c10::IValue(std::get<{i}>({out}))")
+
+    def emit_list_construct(self, type_index: int, num_elements: int) -> None:
+        list_type = self.method.types[type_index]
+        element_type = LIST_ELEMENT_TYPES.get(list_type)
+        if element_type is None:
+            raise AotUnsupportedError(f"LIST_CONSTRUCT of unsupported type '{list_type}'")
+        elements = self.pop_n(num_elements)
+        name = self.fresh("list")
+        self.lines.append(f"c10::List<{element_type}> {name};")
+        self.lines.append(f"{name}.reserve({num_elements});")
+        for element in elements:
+            self.lines.append(
+                f"{name}.push_back({self.argument_from_ivalue_list_elem(element_type, element)});"
+            )
+        self.stack.append(f"c10::IValue(std::move({name}))")
+
+    @staticmethod
+    def argument_from_ivalue_list_elem(element_type: str, expr: str) -> str:
+        if element_type == "at::Tensor":
+            return f"{expr}.toTensor()"
+        if element_type == "c10::optional<at::Tensor>":
+            return f"{expr}.toOptional<at::Tensor>()"
+        if element_type == "int64_t":
+            return f"{expr}.toInt()"
+        if element_type == "double":
+            return f"{expr}.toDouble()"
+        if element_type == "bool":
+            return f"{expr}.toBool()"
+        raise AotUnsupportedError(f"no list element rule for '{element_type}'")
+
+    def emit_instruction(self, ins: Instruction) -> bool:
+        """Emits one instruction; returns False once the method has returned."""
+        if ins.op == "OP" or ins.op == "OPN":
+            self.emit_op(ins.X)
+        elif ins.op == "LOAD":
+            self.stack.append(self.register(ins.X))
+        elif ins.op == "MOVE":
+            self.stack.append(f"std::move({self.register(ins.X)})")
+        elif ins.op == "STORE":
+            self.lines.append(f"{self.register(ins.X)} = {self.pop()};")
+        elif ins.op == "STOREN":
+            for i, expr in enumerate(self.pop_n(ins.N)):
+                self.lines.append(f"{self.register(ins.X + i)} = {expr};")
+        elif ins.op == "DROP":
+            # Stack values are pure expressions by construction (op results
+            # are materialized into locals), so a drop emits nothing.
+            self.pop()
+        elif ins.op == "DROPR":
+            pass  # registers are function-scoped locals
+        elif ins.op == "LOADC":
+            self.stack.append(self.constant_expr(ins.X))
+        elif ins.op == "GET_ATTR":
+            obj = self.pop()
+            self.stack.append(f"{obj}.toObject()->getSlot({ins.X})")
+        elif ins.op == "TUPLE_CONSTRUCT":
+            elements = self.pop_n(ins.X)
+            self.stack.append(
+                f"c10::IValue(c10::ivalue::Tuple::create({{{', '.join(elements)}}}))"
+            )
+        elif ins.op == "LIST_CONSTRUCT":
+            self.emit_list_construct(ins.X, ins.N)
+        elif ins.op == "RET":
+            outputs = ", ".join(self.stack)
+            self.lines.append(f"return std::vector<c10::IValue>{{{outputs}}};")
+            return False
+        else:
+            raise AotUnsupportedError(
+                f"instruction {ins.op} is not supported in AOT mode; "
+                f"{self.method.qualified_name} must run on the interpreter"
+            )
+        return True
+
+    def emit(self) -> str:
+        for ins in self.method.instructions:
+            if not self.emit_instruction(ins):
+                break
+        else:
+            raise AotUnsupportedError(
+                f"{self.method.qualified_name} has no RET instruction"
+            )
+        register_decls = [
+            f"c10::IValue r{index};" for index in sorted(self.declared_registers)
+        ]
+        body = register_decls + self.lines
+        return "\n".join(f"  {line}" for line in body)
+
+
+GENERATED_FILE_TEMPLATE = """// @generated by torchgen/mobile/gen_aot_model.py from {model_name}
+// AOT translation of {qualified_name}: the method's bytecode spelled out as
+// direct unboxed at:: calls, bypassing the lite interpreter entirely.
+//
+// `constants` is the constant table of the loaded method
+// (mobile::Function::get_code().constants_); `inputs` is the interpreter
+// calling convention (self first, then the method's arguments).
+#include <ATen/Functions.h>
+#include <ATen/core/ivalue.h>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace torch {{
+namespace jit {{
+namespace mobile {{
+namespace aot {{
+
+std::vector<c10::IValue> {function_name}(
+    c10::ArrayRef<c10::IValue> constants,
+    std::vector<c10::IValue> inputs) {{
+  (void)constants;
+{body}
+}}
+
+}} // namespace aot
+}} // namespace mobile
+}} // namespace jit
+}} // namespace torch
+"""
+
+
+def generate_aot_cpp(
+    method: MobileMethod,
+    native_functions: Sequence[NativeFunction],
+    model_name: str,
+    num_inputs: Optional[int] = None,
+) -> str:
+    emitter = AotMethodEmitter(method, native_functions, num_inputs=num_inputs)
+    body = emitter.emit()
+    return GENERATED_FILE_TEMPLATE.format(
+        model_name=model_name,
+        qualified_name=method.qualified_name,
+        function_name=method.name,
+        body=body,
+    )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Compile one method of a mobile model to straight-line C++"
+    )
+    parser.add_argument("--model", required=True, help="path to the .ptl model")
+    parser.add_argument(
+        "--method", default="forward", help="method to compile (default: forward)"
+    )
+    parser.add_argument("--output", "-o", required=True, help="path of the generated .cpp")
+    parser.add_argument(
+        "--num-inputs",
+        type=int,
+        default=None,
+        help="stack input count, if the method does not start with STOREN",
+    )
+    parser.add_argument(
+        "--aten-source-path",
+        default=None,
+        help="path to aten/src/ATen (defaults to the in-tree location)",
+    )
+    options = parser.parse_args()
+
+    if options.aten_source_path is None:
+        from torchgen.gen import get_torchgen_root
+
+        options.aten_source_path = os.path.join(
+            get_torchgen_root().parent, "aten", "src", "ATen"
+        )
+    native_yaml_path = os.path.join(options.aten_source_path, "native", "native_functions.yaml")
+    tags_yaml_path = os.path.join(options.aten_source_path, "native", "tags.yaml")
+    native_functions = parse_native_yaml(native_yaml_path, tags_yaml_path).native_functions
+
+    methods = load_mobile_methods(options.model)
+    matches = [m for m in methods if m.name == options.method]
+    if not matches:
+        available = ", ".join(m.qualified_name for m in methods)
+        raise RuntimeError(
+            f"method '{options.method}' not found in {options.model}; available: {available}"
+        )
+    if len(matches) > 1:
+        raise RuntimeError(
+            f"method name '{options.method}' is ambiguous in {options.model}; "
+            "pass the qualified name"
+        )
+
+    code = generate_aot_cpp(
+        matches[0],
+        native_functions,
+        model_name=os.path.basename(options.model),
+        num_inputs=options.num_inputs,
+    )
+    with open(options.output, "w") as f:
+        f.write(code)
+
+
+if __name__ == "__main__":
+    main()